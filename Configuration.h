@@ -886,8 +886,17 @@
  * curve to move acceleration, producing much smoother direction changes.
  *
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
+ *
+ * Each block eases in and out of its speed change, so a small change made
+ * quickly has a large jerk. S_CURVE_MAX_JERK makes the planner stretch such
+ * changes to keep the curve's jerk under the limit, and plan block speeds
+ * and times around it. This slows short segments the most, since each one
+ * eases on its own. Change at runtime with M205 K.
  */
 #define S_CURVE_ACCELERATION
+#if ENABLED(S_CURVE_ACCELERATION)
+// #	define S_CURVE_MAX_JERK 5000 // (mm/s³) Peak jerk of the speed curve
+#endif
 
 //===========================================================================
 //============================= Z Probe Options =============================
@@ -672,6 +672,7 @@
 // #define QUICK_HOME                          // If G28 contains XY do a diagonal move first
 #define HOME_Y_BEFORE_X // If G28 contains XY home Y before X
 #define HOME_Z_FIRST    // Home Z first. Requires a Z-MIN endstop (not a probe).
+#define CONCURRENT_HOMING // G28.2 references X, Y and A together, each stopping at its own endstop
 // #define CODEPENDENT_XY_HOMING               // If X/Y can't home without homing Y/X first
 
 // @section bltouch
@@ -907,6 +908,48 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+/**
+ * Line Coalescing
+ *
+ * Fuse runs of short, nearly collinear G0/G1 moves into single planner blocks
+ * before they reach the planner. Every vertex skipped stays within the
+ * tolerance of the fused line and the last end point is kept exactly.
+ * This stretches the lookahead over dense CAM output.
+ *
+ * Set the tolerance per job with G64 P<mm> (or Q<mm> alongside PATH_BLENDING).
+ * G64 P0 turns coalescing off. With PATH_BLENDING it's off until a G64.
+ */
+#define LINE_COALESCING
+#if ENABLED(LINE_COALESCING)
+#	define LINE_COALESCE_TOLERANCE 0.005 // (mm) Default deviation allowed from the fused line
+#	define LINE_COALESCE_POINTS    16    // Most vertices that may be fused into one block
+#endif
+
+/**
+ * Path Blending
+ *
+ * Round off the corners between G0/G1 moves with an arc tangent to both moves,
+ * so the machine keeps speed through sharp polyline corners instead of slowing
+ * down to the junction deviation speed. The arc comes no further than the
+ * tolerance from the programmed corner and takes at most half of the next move.
+ * Arcs are planned as chords, fine enough that the joins between them are no
+ * slower than the arc. Corners are only blended where the arc is wider than
+ * the one implied by the junction deviation (M205 J).
+ *
+ *   G64 P<mm> Q<mm> : Blend corners within P. Fuse moves within Q (default P).
+ *   G64             : Blend and fuse within the default tolerances.
+ *   G61             : Exact path. Follow every corner, no blending or fusing.
+ *   G61.1           : Exact stop. Also come to rest at the end of every move.
+ *
+ * The machine starts in G61, so a job only leaves the programmed path once it
+ * asks for G64. Requires LINE_COALESCING. Takes over G61 from SAVED_POSITIONS.
+ */
+#define PATH_BLENDING
+#if ENABLED(PATH_BLENDING)
+#	define PATH_BLEND_TOLERANCE 0.02 // (mm) Distance allowed from a programmed corner by a G64 without P
+#	define PATH_BLEND_SEGMENTS  8    // Most chords used for one blended corner
+#endif
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
@@ -1007,6 +1050,48 @@
  */
 // #define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Set up blocks for the stepper ISR in the main loop: step timing, Bézier
+ * coefficients and axis smoothing are worked out for the next few planned
+ * blocks, so the ISR only copies them when it starts a block. Short segments
+ * change blocks often, and this takes the longest ISR runs off those changes.
+ * A block replanned after it was set up is set up again.
+ *
+ * Check the ISR runs with STEPPER_ISR_PROFILE before and after enabling it.
+ */
+// #define STEPPER_PREPARE_BLOCKS
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+#	define STEPPER_PREPARED_BLOCKS 8 // Blocks set up ahead of the ISR
+#endif
+
+/**
+ * Input Shaping
+ *
+ * Light gantries ring after every change of speed or direction. A shaper
+ * splits each X/Y step into two or three smaller impulses spread over half
+ * to one ringing period, timed so that the ringing each one starts cancels
+ * the others. The path is unchanged, only smoothed and delayed by the shaper.
+ *
+ * Each axis is set with M2000 on /motion/xShaper and /motion/yShaper:
+ *   type       0 = None, 1 = ZV, 2 = ZVD, 3 = EI
+ *   frequency  (Hz) Ringing frequency of the axis
+ *   damping    Damping ratio of the ringing, 0 to 0.5
+ *
+ * ZV delays by half a period but needs the frequency to within a few percent.
+ * ZVD and EI delay by a full period and tolerate a larger error.
+ *
+ * Homing moves are never shaped. Shaped steps are queued for the shaper's
+ * delay, so the planner slows a shaped axis to the step rate its queue holds:
+ * SHAPING_MAX_STEPRATE for ZVD or EI at SHAPING_MIN_FREQ, more for ZV or a
+ * higher frequency. The queues take SHAPING_MAX_STEPRATE / SHAPING_MIN_FREQ
+ * * 10 bytes of RAM, 20KB as set here.
+ */
+// #define INPUT_SHAPING
+#if ENABLED(INPUT_SHAPING)
+#	define SHAPING_MIN_FREQ        20 // (Hz) Lowest frequency allowed, which sizes the queues
+#	define SHAPING_MAX_STEPRATE 40000 // (steps/s) Fastest step rate of an axis that is fully shaped
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1231,6 +1316,16 @@
 
 // #define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
 
+/**
+ * O-word subprograms in SD files. O<n> starts a subprogram and M99 ends it.
+ * M98 P<n> L<count> runs it count times, then carries on after the M98.
+ */
+#define GCODE_SUBPROGRAMS
+#if ENABLED(GCODE_SUBPROGRAMS)
+#	define SUBPROGRAM_DEPTH      4 // Nested M98 calls
+#	define SUBPROGRAM_CACHE_SIZE 8 // Subprogram file positions remembered per job
+#endif
+
 #	define SD_PROCEDURE_DEPTH         1 // Increase if you need more nested M32 calls
 
 #	define SD_FINISHED_STEPPERRELEASE false // Disable steppers when SD Print is finished
@@ -1888,6 +1983,7 @@
 //
 #define ARC_SUPPORT // Disable this feature to save ~3226 bytes
 #if ENABLED(ARC_SUPPORT)
+#	define ARC_CHORD_TOLERANCE  0.002 // (mm) Furthest a segment may stray from the arc. Longer segments on larger radii.
 #	define MM_PER_ARC_SEGMENT   0.1 // (mm) Length (or minimum length) of each arc segment
 // #define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Min
 #	define MIN_CIRCLE_SEGMENTS  128 // Minimum number of segments in a complete circle
@@ -1896,10 +1992,24 @@
 #	define ARC_P_CIRCLES        // Enable the 'P' parameter to specify complete circles
 #	define CNC_WORKSPACE_PLANES // Allow G2/G3 to operate in XY, ZX, or YZ planes
 // #define SF_ARC_FIX              // Enable only if using SkeinForge with "Arc Point" fillet procedure
+
+/**
+ * Queue arcs as arc blocks rather than chords. Each block covers up to a
+ * quarter turn and its speed is planned once for the whole of it. The
+ * stepper ISR follows the circle step by step, so the path is only ever
+ * a step from the arc, however deep the buffer or fast the feed.
+ */
+#	define ARC_BLOCKS
+#	if ENABLED(ARC_BLOCKS)
+#		define ARC_BLOCK_BUFFER_SIZE 32 // Arc blocks the planner can hold at once (44 bytes each)
+#	endif
 #endif
 
-// Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
-// #define BEZIER_CURVE_SUPPORT
+// Support for G5 cubic and G5.1 quadratic splines with XYZ destination and IJPQ offsets. Requires ~2666 bytes.
+#define BEZIER_CURVE_SUPPORT
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+#	define BEZIER_TOLERANCE 0.002 // (mm) Furthest a line may stray from the curve. Flat stretches take fewer, longer lines.
+#endif
 
 /**
  * Direct Stepping
@@ -1981,16 +2091,54 @@
 
 // @section motion
 
-// The number of linear moves that can be in the planner at once.
-// The value of BLOCK_BUFFER_SIZE must be a power of 2 (e.g. 8, 16, 32)
+// The number of linear moves that can be in the planner at once, up to 1024.
+// The startup report gives the bytes each block takes.
 #if BOTH(SDSUPPORT, DIRECT_STEPPING)
 #	define BLOCK_BUFFER_SIZE 8
 #elif ENABLED(SDSUPPORT)
-#	define BLOCK_BUFFER_SIZE 256
+#	define BLOCK_BUFFER_SIZE 312 // 88 byte blocks, in the RAM 256 blocks of 108 bytes took
 #else
 #	define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * Time-based Lookahead
+ *
+ * Bound the planner by how long its moves take instead of how many there are.
+ * Each replan walks back at most LOOKAHEAD_TIME_MS of moves from the newest
+ * one, and stops early once entry speeds stop changing. Older blocks keep
+ * the plan they have, so make this longer than the slowest stop from full
+ * speed (feed / acceleration).
+ *
+ * After the buffer runs dry, the first move waits until LOOKAHEAD_DELIVERY_MS
+ * of moves are queued behind it (or 100ms pass), instead of three moves.
+ */
+#define TIME_BASED_LOOKAHEAD
+#if ENABLED(TIME_BASED_LOOKAHEAD)
+#	define LOOKAHEAD_TIME_MS     1000 // (ms) Moves replanned for each new block
+#	define LOOKAHEAD_DELIVERY_MS   20 // (ms) Moves queued before starting from rest
+#endif
+
+// Count the blocks each replan visits (the simulator reports them)
+// #define PLANNER_STATS
+
+/**
+ * Keep live counters of how well the planner feeds the steppers: buffer
+ * occupancy, held-back first moves, the buffer running dry mid-job, replan
+ * time, the longest stepper ISR and the highest step rate reached.
+ * Read with M2000 ?/diagnostics/motion, reset with M2000 O2 ?/diagnostics >{"reset":1}
+ */
+#define MOTION_STATS
+
+/**
+ * Time the stepper ISR and each of its phases (pulses, shaping, advance,
+ * babystepping, block handling) with the cycle counter. Keeps a histogram of
+ * run times per phase and the longest run with the block it happened in.
+ * Costs a few cycles per phase, so leave it off for production.
+ * Read with M2000 ?/diagnostics/isr, reset with M2000 O2 ?/diagnostics >{"reset":1}
+ */
+// #define STEPPER_ISR_PROFILE
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -2041,6 +2189,21 @@
  */
 #define EMERGENCY_PARSER
 
+/**
+ * Host Jogging
+ *
+ * M2002 X Y Z F<units/min> jogs by the given distances, clamped to the
+ * soft limits of the homed axes. The jog is queued as short segments so
+ * M410 J can cut it short: the segments not needed to slow down at the
+ * jog's acceleration are dropped and the rest are replanned to stop.
+ * Moves queued after the jog are kept. Send M410 J through the
+ * EMERGENCY_PARSER so it doesn't wait behind the jog.
+ */
+#define JOGGING
+#if ENABLED(JOGGING)
+#	define JOG_SEGMENT_MS 20 // (ms) Travel time of each queued jog segment
+#endif
+
 // Bad Serial-connections can miss a received command by sending an 'ok'
 // Therefore some clients abort after 30 seconds in a timeout.
 // Some other clients start sending commands while receiving a 'wait'.
@@ -3335,10 +3498,18 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
 #	define GCODE_QUOTED_STRINGS // Support for quoted string parameters
+#	define GCODE_PARSE_AHEAD    // Parse commands as they are queued, so dispatch only restores the parsed state
 #endif
 
 // #define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
+/**
+ * Time every G-code, M-code and T-code as it is processed, and count the
+ * times the command queue or the planner runs dry during a job.
+ * Read with M2000 ?/diagnostics/commands, reset with M2000 O2 ?/diagnostics >{"reset":1}
+ */
+#define GCODE_COMMAND_STATS
+
 // #define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
 
 /**
@@ -3350,6 +3521,17 @@
 #define PAREN_COMMENTS     // Support for parentheses-delimited comments
 #define GCODE_MOTION_MODES // Remember the motion mode (G0 G1 G2 G3 G5 G38.X) and apply for X Y Z E F, etc.
 
+/**
+ * Canned drilling cycles G73, G81, G82 and G83 in the XY plane, with G98/G99
+ * retract modes. The cycle is modal: further X Y words drill more holes until G80.
+ * Requires GCODE_MOTION_MODES.
+ */
+#define CNC_CANNED_CYCLES
+#if ENABLED(CNC_CANNED_CYCLES)
+#	define CANNED_CYCLE_PECK_CLEARANCE 0.25 // (mm) G83 rapids back down to this far above the previous peck
+#	define CANNED_CYCLE_CHIP_BREAK     0.25 // (mm) G73 backs off this far after each peck
+#endif
+
 // Enable and set a (default) feedrate for all G0 moves
 #define G0_FEEDRATE        15000 // (mm/min)
 #ifdef G0_FEEDRATE
@@ -3367,12 +3549,14 @@
  * G-code Macros
  *
  * Add G-codes M810-M819 to define and run G-code macros.
- * Macros are not saved to EEPROM.
+ * Macros are saved with the configuration (M2000 ?/macros/slots) and are
+ * compiled into parsed commands, so running one doesn't re-parse its text.
  */
 #define GCODE_MACROS
 #if ENABLED(GCODE_MACROS)
-#	define GCODE_MACROS_SLOTS     10 // Up to 10 may be used
-#	define GCODE_MACROS_SLOT_SIZE 1024 // Maximum length of a single macro
+#	define GCODE_MACROS_SLOTS         10 // Up to 10 may be used
+#	define GCODE_MACROS_SLOT_SIZE     1024 // Maximum length of a single macro
+#	define GCODE_MACROS_SLOT_COMMANDS 8 // Maximum commands in a single macro, each compiled one takes ~180 bytes of RAM
 #endif
 
 /**
@@ -0,0 +1,122 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+#include "../../inc/MarlinConfig.h"
+
+#include "simulator.h"
+
+#include <chrono>
+
+HostSerial hostSerial;
+
+void (*HAL_pin_listener)(const int16_t pin, const bool value);
+
+static constexpr int16_t NUM_PINS = NUM_DIGITAL_PINS;
+static bool pin_state[NUM_PINS];
+
+// --------------------------------------------------------------------------
+// Pins
+// --------------------------------------------------------------------------
+
+void HAL_pin_write(const int16_t pin, const bool value) {
+  if (!WITHIN(pin, 0, NUM_PINS - 1) || pin_state[pin] == value) return;
+  pin_state[pin] = value;
+  if (HAL_pin_listener) HAL_pin_listener(pin, value);
+}
+
+bool HAL_pin_read(const int16_t pin) {
+  return WITHIN(pin, 0, NUM_PINS - 1) && pin_state[pin];
+}
+
+void HAL_pin_mode(const int16_t, const uint8_t) {}
+
+void pinMode(const int16_t pin, const uint8_t mode) { HAL_pin_mode(pin, mode); }
+void digitalWrite(const int16_t pin, const uint8_t value) { HAL_pin_write(pin, value); }
+int digitalRead(const int16_t pin) { return HAL_pin_read(pin); }
+void analogWrite(const int16_t, const int) {}
+int analogRead(const int16_t) { return 0; }
+
+// --------------------------------------------------------------------------
+// Time
+// --------------------------------------------------------------------------
+
+uint32_t millis() { return uint32_t(HAL_timer_now() / (HAL_TIMER_RATE / 1000)); }
+uint32_t micros() { return uint32_t(HAL_timer_now() / (HAL_TIMER_RATE / 1000000)); }
+
+// Waiting lets the stepper run on, just as it would on the board
+void delay(const uint32_t ms) { delayMicroseconds(ms * 1000); }
+void delayMicroseconds(const uint32_t us) {
+  simulator.advance(HAL_timer_now() + uint64_t(us) * (HAL_TIMER_RATE / 1000000));
+}
+
+uint32_t getCycleCount() {
+  using namespace std::chrono;
+  const auto ns = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+  return uint32_t(uint64_t(ns) * (F_CPU / 1000000) / 1000);
+}
+
+// --------------------------------------------------------------------------
+// HAL
+// --------------------------------------------------------------------------
+
+// Inputs rest at their inactive level, so no endstop, probe or E-stop is triggered
+void HAL_init() {
+  #if PIN_EXISTS(X_MIN)
+    pin_state[X_MIN_PIN] = X_MIN_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(X_MAX)
+    pin_state[X_MAX_PIN] = X_MAX_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(Y_MIN)
+    pin_state[Y_MIN_PIN] = Y_MIN_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(Y_MAX)
+    pin_state[Y_MAX_PIN] = Y_MAX_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(Y2_MIN)
+    pin_state[Y2_MIN_PIN] = Y2_MIN_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(Y2_MAX)
+    pin_state[Y2_MAX_PIN] = Y2_MAX_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(Z_MIN)
+    pin_state[Z_MIN_PIN] = Z_MIN_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(Z_MAX)
+    pin_state[Z_MAX_PIN] = Z_MAX_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(A_MAX)
+    pin_state[A_MAX_PIN] = A_MAX_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(Z_MIN_PROBE)
+    pin_state[Z_MIN_PROBE_PIN] = Z_MIN_PROBE_ENDSTOP_INVERTING;
+  #endif
+  #if PIN_EXISTS(ESTOP)
+    pin_state[ESTOP_PIN] = ESTOP_ENDSTOP_INVERTING;
+  #endif
+}
+
+// Each pass of the main loop costs simulated time
+void HAL_idletask() { simulator.idle(); }
+
+#endif // __PLAT_SIMULATOR__
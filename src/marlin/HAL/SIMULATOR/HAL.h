@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * HAL for the host planner/stepper simulator.
+ *
+ * Pins are plain memory, and the stepper timer runs on simulated time that
+ * the simulator advances from idle(). See HAL_timer_service().
+ */
+
+#define CPU_32_BIT
+
+#include "../shared/Marduino.h"
+#include "../shared/math_32bit.h"
+#include "../shared/HAL_SPI.h"
+#include "fastio.h"
+#include "watchdog.h"
+#include "HostSerial.h"
+#include "timers.h"
+
+#define MYSERIAL0 hostSerial
+
+typedef int16_t pin_t;
+
+//
+// Interrupts
+//
+#define CRITICAL_SECTION_START() NOOP
+#define CRITICAL_SECTION_END()   NOOP
+#define ISRS_ENABLED()           true
+#define ENABLE_ISRS()            NOOP
+#define DISABLE_ISRS()           NOOP
+
+#define cli() NOOP
+#define sei() NOOP
+
+inline void HAL_clear_reset_source() {}
+inline uint8_t HAL_get_reset_source() { return RST_POWER_ON; }
+
+inline void HAL_reboot() {}
+
+//
+// ADC
+//
+#define HAL_ANALOG_SELECT(pin)
+
+#define HAL_ADC_VREF         3.3
+#define HAL_ADC_RESOLUTION   10
+#define HAL_START_ADC(pin)   NOOP
+#define HAL_READ_ADC()       0
+#define HAL_ADC_READY()      true
+
+inline void HAL_adc_init() {}
+
+//
+// Pin Map
+//
+#define GET_PIN_MAP_PIN(index) index
+#define GET_PIN_MAP_INDEX(pin) pin
+#define PARSED_PIN_INDEX(code, dval) parser.intval(code, dval)
+
+void HAL_init();
+
+#define HAL_IDLETASK 1
+void HAL_idletask();
+
+// Called on every pin change, so the simulator can trace steps
+extern void (*HAL_pin_listener)(const int16_t pin, const bool value);
+
+FORCE_INLINE void _delay_ms(const int delay_ms) { delay(delay_ms); }
+
+inline int freeMemory() { return 0; }
@@ -0,0 +1,36 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+#include "../../inc/MarlinConfig.h"
+
+// The simulated SPI bus has nothing on it, so every read sees an idle line.
+
+void spiBegin() {}
+void spiInit(uint8_t) {}
+void spiSend(uint8_t) {}
+uint8_t spiRec() { return 0xFF; }
+void spiRead(uint8_t* buf, uint16_t nbyte) { memset(buf, 0xFF, nbyte); }
+void spiSendBlock(uint8_t, const uint8_t*) {}
+void spiBeginTransaction(uint32_t, uint8_t, uint8_t) {}
+
+#endif // __PLAT_SIMULATOR__
@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/**
+ * Serial port on the host's stderr, so it doesn't mix with the trace on stdout.
+ */
+class HostSerial {
+public:
+	void begin(const long) {}
+	void end() {}
+	operator bool() { return true; }
+	void flush() { fflush(stderr); }
+	void flushTX() { flush(); }
+	int available() { return 0; }
+	int read() { return -1; }
+	bool connected() { return true; }
+
+	size_t write(const uint8_t c) { return fputc(c, stderr) == EOF ? 0 : 1; }
+	size_t write(const char* s) { return fputs(s, stderr) == EOF ? 0 : 1; }
+	size_t write(const uint8_t* buffer, const size_t length) { return fwrite(buffer, 1, length, stderr); }
+
+	void print(const char* s) { fputs(s, stderr); }
+	void print(const char c) { fputc(c, stderr); }
+	void print(const int32_t v, const int base = 10) { print_long(v, base); }
+	void print(const uint32_t v, const int base = 10) { print_ulong(v, base); }
+	void print(const int16_t v, const int base = 10) { print_long(v, base); }
+	void print(const uint16_t v, const int base = 10) { print_ulong(v, base); }
+	void print(const uint8_t v, const int base = 10) { print_ulong(v, base); }
+	void print(const int64_t v, const int base = 10) { print_long(v, base); }
+	void print(const uint64_t v, const int base = 10) { print_ulong(v, base); }
+	void print(const double v, const int digits = 2) { fprintf(stderr, "%.*f", digits, v); }
+
+	template <typename T>
+	void println(const T v) {
+		print(v);
+		println();
+	}
+
+	template <typename T>
+	void println(const T v, const int base) {
+		print(v, base);
+		println();
+	}
+
+	void println() { fputc('\n', stderr); }
+
+	void printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+		va_list args;
+		va_start(args, format);
+		vfprintf(stderr, format, args);
+		va_end(args);
+	}
+
+private:
+	void print_long(const int64_t v, const int base) {
+		if (v < 0 && base == 10) {
+			fputc('-', stderr);
+			print_ulong(uint64_t(-v), base);
+		} else {
+			print_ulong(uint64_t(v), base);
+		}
+	}
+
+	void print_ulong(const uint64_t v, const int base) {
+		fprintf(stderr, base == 16 ? "%llx" : base == 8 ? "%llo" : "%llu", (unsigned long long) v);
+	}
+};
+
+extern HostSerial hostSerial;
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+#include "../../inc/MarlinConfig.h"
+
+#include "../shared/eeprom_api.h"
+
+/**
+ * The simulator's QSPI flash is erased RAM, so every run starts from the defaults.
+ */
+
+static uint8_t buffer[MARLIN_EEPROM_SIZE];
+static bool initialized;
+
+size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE; }
+
+bool PersistentStore::access_start() {
+  if (!initialized) {
+    memset(buffer, 0xFF, sizeof(buffer));
+    initialized = true;
+  }
+  return true;
+}
+
+bool PersistentStore::access_finish() { return true; }
+
+bool PersistentStore::write_data(int64_t &pos, uintptr_t ptr, size_t size, uint16_t *crc) {
+  while (size--) {
+    const uint8_t v = *(uint8_t*)ptr;
+    if (WITHIN(pos, 0, int64_t(MARLIN_EEPROM_SIZE) - 1)) buffer[pos] = v;
+    crc16(crc, &v, 1);
+    pos++;
+    ptr++;
+  }
+  return false;
+}
+
+bool PersistentStore::read_data(int64_t &pos, uintptr_t ptr, size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  while (size--) {
+    const uint8_t c = WITHIN(pos, 0, int64_t(MARLIN_EEPROM_SIZE) - 1) ? buffer[pos] : 0xFF;
+    if (writing) *(uint8_t*)ptr = c;
+    crc16(crc, &c, 1);
+    pos++;
+    ptr++;
+  }
+  return false;
+}
+
+#endif // __PLAT_SIMULATOR__
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Fast I/O for the simulator. Every pin is a bit in memory, and writes to
+ * the step and direction pins are reported to the simulator.
+ */
+
+#include <stdint.h>
+
+void HAL_pin_write(const int16_t pin, const bool value);
+bool HAL_pin_read(const int16_t pin);
+void HAL_pin_mode(const int16_t pin, const uint8_t mode);
+
+#define READ(IO)                HAL_pin_read(IO)
+#define WRITE(IO, V)            HAL_pin_write(IO, V)
+#define TOGGLE(IO)              HAL_pin_write(IO, !HAL_pin_read(IO))
+
+#define SET_INPUT(IO)           HAL_pin_mode(IO, INPUT)
+#define SET_INPUT_PULLUP(IO)    HAL_pin_mode(IO, INPUT_PULLUP)
+#define SET_INPUT_PULLDOWN(IO)  HAL_pin_mode(IO, INPUT_PULLDOWN)
+#define SET_OUTPUT(IO)          HAL_pin_mode(IO, OUTPUT)
+#define SET_OUTPUT_OD(IO)       HAL_pin_mode(IO, OUTPUT)
+#define SET_PWM                 SET_OUTPUT
+#define SET_PWM_OD              SET_OUTPUT_OD
+
+#define IS_OUTPUT(IO)           true
+#define IS_INPUT(IO)            false
+
+#define OUT_WRITE(IO, V)        do{ SET_OUTPUT(IO); WRITE(IO, V); }while(0)
+#define OUT_WRITE_OD(IO, V)     do{ SET_OUTPUT_OD(IO); WRITE(IO, V); }while(0)
+
+#define extDigitalRead(IO)      READ(IO)
+#define extDigitalWrite(IO, V)  WRITE(IO, V)
+
+#define PWM_PIN(P)              false
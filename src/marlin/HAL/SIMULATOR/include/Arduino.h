@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * The few parts of the Arduino API that Marlin uses outside the HAL,
+ * backed by simulated time and pins.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_DIGITAL_PINS 128
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT          0x0
+#define OUTPUT         0x1
+#define INPUT_PULLUP   0x2
+#define INPUT_PULLDOWN 0x3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+void setup();
+void loop();
+
+uint32_t millis();
+uint32_t micros();
+void delay(const uint32_t ms);
+void delayMicroseconds(const uint32_t us);
+
+void pinMode(const int16_t pin, const uint8_t mode);
+void digitalWrite(const int16_t pin, const uint8_t value);
+int digitalRead(const int16_t pin);
+void analogWrite(const int16_t pin, const int value);
+int analogRead(const int16_t pin);
+
+#define CHANGE  2
+#define FALLING 3
+#define RISING  4
+
+typedef void (*voidFuncPtr)();
+
+struct PinDescription { uint32_t ulExtInt; };
+extern const PinDescription g_APinDescription[];
+
+inline void attachInterrupt(const uint32_t, voidFuncPtr, const uint32_t) {}
+inline void detachInterrupt(const uint32_t) {}
+
+#include "../HostSerial.h"
+
+#define Serial hostSerial
+
+#ifndef constrain
+#  define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
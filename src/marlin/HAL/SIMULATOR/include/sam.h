@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Just enough of the CMSIS device header for the Swordfish core to compile.
+ */
+
+#include <stdint.h>
+
+typedef enum { NonMaskableInt_IRQn = -14 } IRQn_Type;
+
+typedef struct { uint32_t ICSR; } SCB_Type;
+
+inline SCB_Type sim_SCB;
+#define SCB (&sim_SCB)
+
+#define SCB_ICSR_VECTACTIVE_Msk 0x1FFUL
+
+typedef struct { uint32_t DHCSR; } CoreDebug_Type;
+
+inline CoreDebug_Type sim_CoreDebug; // No debugger is ever attached
+#define CoreDebug (&sim_CoreDebug)
+
+#define CoreDebug_DHCSR_C_DEBUGEN_Msk 0x1UL
+
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+inline void __DSB() {}
+inline void __ISB() {}
@@ -0,0 +1,233 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+/**
+ * Run a G-code program through the planner and stepper on the host.
+ *
+ *   swordfish-sim [-c setup.nc] [-s steps.csv] [-b blocks.csv] [-p profile.csv] [-l loop_us] [-e] [-d] program.nc
+ *   swordfish-sim -t
+ *
+ *  -c  Run this file first, untimed, e.g. the machine's M2000 configuration.
+ *      Without it the configuration is empty, so soft limits are turned off.
+ *  -s  Write the time, axis and direction of every step
+ *  -b  Write the time, length and nominal speed of every finished block
+ *  -p  Write the commanded and motor X/Y positions every millisecond, to
+ *      compare the shaped motion with the unshaped. Set the shapers in the
+ *      setup file, e.g. M2000 O2 ?/motion/xShaper >{"type":2,"frequency":40}
+ *  -l  Simulated cost of one main loop pass in µs (default 20)
+ *  -e  Simulate the homing switches, closed where the machine starts, so
+ *      G28.2 can find them
+ *  -d  Run the program from the simulated SD card with M23 and M24, as a
+ *      job would, rather than sending it line by line
+ *  -t  Time a round trip through each kind of logical/native transform
+ *      against the 4x4 matrices it replaces, then exit
+ *
+ * The machine starts homed, since without -e simulated endstops never trigger.
+ * Serial output goes to stderr, and the report goes to stdout.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#include "simulator.h"
+
+#include "../../MarlinCore.h"
+#include "../../gcode/queue.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
+#include "../../sd/cardreader.h"
+
+#include <swordfish/modules/motion/MotionModule.h>
+
+#include <chrono>
+#include <unistd.h>
+
+static void usage(const char * const name) {
+  fprintf(stderr, "usage: %s [-c setup.nc] [-s steps.csv] [-b blocks.csv] [-p profile.csv] [-l loop_us] [-e] [-d] program.nc\n", name);
+  fprintf(stderr, "       %s -t\n", name);
+  exit(2);
+}
+
+static FILE* open_file(const char * const path, const char * const mode) {
+  FILE * const file = fopen(path, mode);
+  if (!file) {
+    perror(path);
+    exit(1);
+  }
+  return file;
+}
+
+// Strip the comment and surrounding space, as the serial reader would
+static char* clean_line(char *line) {
+  char * const comment = strchr(line, ';');
+  if (comment) *comment = '\0';
+
+  while (*line == ' ' || *line == '\t') line++;
+
+  char *end = line + strlen(line);
+  while (end > line && (end[-1] == ' ' || end[-1] == '\t' || ISEOL(end[-1]))) end--;
+  *end = '\0';
+
+  return line;
+}
+
+// Feed every line of the file to the queue, running the main loop while it is full
+static void run_file(FILE * const file) {
+  char buffer[MAX_CMD_SIZE + 2];
+
+  while (fgets(buffer, sizeof(buffer), file)) {
+    const char * const line = clean_line(buffer);
+    if (!*line) continue;
+
+    if (*line == '!') {
+      char *command;
+      const float delay_ms = strtof(line + 1, &command);
+      Simulator::send_emergency(command + strspn(command, " "), delay_ms);
+      continue;
+    }
+
+    while (queue.length >= BUFSIZE) loop();
+
+    queue.enqueue_one_now(line);
+  }
+
+  fclose(file);
+}
+
+// Start the program on the card and run the main loop until the job is done
+static void run_card() {
+  queue.enqueue_one_now("M21");
+  queue.enqueue_one_now("M23 program.nc");
+  queue.enqueue_one_now("M24");
+
+  do loop(); while (queue.has_commands_queued() || IS_SD_PRINTING());
+}
+
+static void drain() {
+  while (queue.has_commands_queued() || planner.has_blocks_queued() || TERN0(INPUT_SHAPING, stepper.is_shaping())) loop();
+}
+
+// ns per round trip of a point through the transform, and through the matrices it replaces
+static void time_transform(const char * const name, const Eigen::Matrix4f &native) {
+  using namespace swordfish::math;
+  using clock = std::chrono::steady_clock;
+
+  constexpr uint32_t points = 1000000;
+
+  swordfish::motion::Transform transform;
+  transform.set(native);
+  const Eigen::Matrix4f logical = native.inverse();
+
+  Vector3f32 p { 1.25f, -3.5f, 0.75f }, sum = Vector3f32::Zero();
+
+  const auto start = clock::now();
+  for (uint32_t i = 0; i < points; i++) {
+    p.x() += 0.001f;
+    sum += transform.toNative(transform.toLogical(p));
+  }
+  const auto middle = clock::now();
+  for (uint32_t i = 0; i < points; i++) {
+    p.x() += 0.001f;
+    sum += (native * (logical * p.homogeneous())).head<3>();
+  }
+  const auto end = clock::now();
+
+  const auto ns = [](const clock::duration d) { return std::chrono::duration<double, std::nano>(d).count() / points; };
+
+  printf("%-12s %6.2f ns  matrix %6.2f ns  (%g)\n", name, ns(middle - start), ns(end - middle), double(sum.sum()));
+}
+
+static void time_transforms() {
+  Eigen::Matrix4f m = Eigen::Matrix4f::Identity();
+  time_transform("identity", m);
+
+  m.topRightCorner<3, 1>() = Eigen::Vector3f(-120.0f, -45.5f, 12.0f);
+  time_transform("translation", m);
+
+  m(1, 0) = std::tan(0.5f * float(M_PI) / 180.0f);
+  time_transform("shear", m);
+
+  m(0, 2) = 0.002f;
+  time_transform("general", m);
+}
+
+int main(int argc, char *argv[]) {
+  FILE *setup_file = nullptr;
+  bool from_card = false;
+
+  for (int opt; (opt = getopt(argc, argv, "c:s:b:p:l:edt")) != -1;) {
+    switch (opt) {
+      case 'c': setup_file = open_file(optarg, "r"); break;
+      case 's': Simulator::step_trace = open_file(optarg, "w"); break;
+      case 'b': Simulator::block_trace = open_file(optarg, "w"); break;
+      case 'p': Simulator::profile_trace = open_file(optarg, "w"); break;
+      case 'l': Simulator::loop_ticks = atoi(optarg) * STEPPER_TIMER_TICKS_PER_US; break;
+      case 'e': Simulator::endstops = true; break;
+      case 'd': from_card = true; break;
+      case 't': time_transforms(); return 0;
+      default: usage(argv[0]);
+    }
+  }
+
+  if (optind != argc - 1) usage(argv[0]);
+
+  FILE * const program = open_file(argv[optind], "r");
+
+  setup();
+
+  if (setup_file) {
+    run_file(setup_file);
+    drain();
+  }
+  else
+    swordfish::motion::MotionModule::getInstance().setLimitsEnabled(false);
+
+  set_axis_is_at_home(Axis::X());
+  set_axis_is_at_home(Axis::Y());
+  set_axis_is_at_home(Axis::Z());
+  sync_plan_position();
+
+  simulator.init();
+  Simulator::feeding = true;
+
+  if (from_card) {
+    Simulator::insert_card(program);
+    run_card();
+  }
+  else
+    run_file(program);
+
+  Simulator::feeding = false;
+
+  drain();
+
+  if (Simulator::step_trace) fclose(Simulator::step_trace);
+  if (Simulator::block_trace) fclose(Simulator::block_trace);
+  if (Simulator::profile_trace) fclose(Simulator::profile_trace);
+
+  simulator.report();
+
+  return 0;
+}
+
+#endif // __PLAT_SIMULATOR__
@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+/**
+ * Inert stand-ins for the board peripherals that the simulator leaves out of
+ * the build: the status LEDs, the PWM laser timer and the RS485 bus.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#include "../../libs/modbus.h"
+
+#include <swordfish/modules/status/WS2812Driver.h>
+#include <swordfish/modules/tools/drivers/PWMLaserDriverImpl.h>
+
+const PinDescription g_APinDescription[NUM_DIGITAL_PINS] = {};
+
+namespace modbus {
+	void init(uint32_t) {}
+	uint16_t read_parameters(uint8_t, uint16_t, uint16_t, uint16_t*) { return 0; }
+	uint16_t read_holding_registers(uint8_t, uint16_t, uint16_t, uint16_t*) { return 0; }
+	uint16_t read_input_registers(uint8_t, uint16_t, uint16_t, uint16_t*) { return 0; }
+	void write_parameter(uint8_t, uint16_t, uint16_t) {}
+	void write_holding_register(uint8_t, uint16_t, uint16_t) {}
+	void diagnostic(uint8_t, uint16_t, uint16_t) {}
+	void write_multiple_parameters(uint8_t, uint16_t, uint16_t, uint16_t*) {}
+	void write_multiple_holding_registers(uint8_t, uint16_t, uint8_t, uint16_t*) {}
+	void read_write_multiple_registers(uint8_t, uint16_t, uint16_t, uint16_t, uint16_t*) {}
+} // namespace modbus
+
+namespace swordfish::status {
+	WS2812Driver::WS2812Driver(u16 led_count, u8 led_brightness, u16 sweep_time) :
+			led_count_(led_count), brightness_(led_brightness) {
+		set_sweep_time(sweep_time);
+	}
+
+	void WS2812Driver::set_led_count(u16 led_count) { led_count_ = led_count; }
+	void WS2812Driver::set_sweep_time(u16 sweep_time) { sweep_time_ = sweep_time; }
+	void WS2812Driver::set_color(u8 r, u8 g, u8 b) {
+		active_r_ = r;
+		active_g_ = g;
+		active_b_ = b;
+	}
+	void WS2812Driver::set_sweep(bool sweep) { sweep_ = sweep; }
+	void WS2812Driver::set_brightness(u8 brightness) { brightness_ = brightness; }
+	void WS2812Driver::init() {}
+	void WS2812Driver::update() {}
+} // namespace swordfish::status
+
+namespace swordfish::tools::drivers {
+	void PWMLaserDriverImpl::init(uint16_t, DriverParameterTable&) {
+		_cyclesPerPeriod = 800;
+		_targetPower = 0;
+
+		apply();
+	}
+
+	void PWMLaserDriverImpl::idle() {}
+	bool PWMLaserDriverImpl::isEnabled() const { return _enabled; }
+	void PWMLaserDriverImpl::setEnabled(bool enabled) { _enabled = enabled; }
+	float32_t PWMLaserDriverImpl::getTargetPower() const { return _targetPower; }
+	void PWMLaserDriverImpl::setTargetPower(float32_t targetPower) { _targetPower = targetPower; }
+	float32_t PWMLaserDriverImpl::getCurrentPower() const { return _currentPower; }
+	uint32_t PWMLaserDriverImpl::getOutputFrequency() const { return _cyclesPerPeriod; }
+	float32_t PWMLaserDriverImpl::getPowerOverride() const { return _powerOverride; }
+	void PWMLaserDriverImpl::setPowerOverride(float32_t powerOverride) { _powerOverride = powerOverride; }
+	void PWMLaserDriverImpl::apply() { _currentPower = _enabled ? _targetPower : 0; }
+} // namespace swordfish::tools::drivers
+
+#endif // __PLAT_SIMULATOR__
@@ -0,0 +1,137 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+/**
+ * A simulated SD card in place of Sd2Card.cpp. Without a program inserted
+ * the card fails to initialize, as an empty slot would. With one, the card
+ * holds a FAT16 volume with no partition table and the program as its only
+ * file, PROGRAM.NC, so the firmware reads it through the real volume and
+ * file code.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SDSUPPORT)
+
+#include "simulator.h"
+
+#include "../../sd/Sd2Card.h"
+
+#include <vector>
+
+static std::vector<uint8_t> image;
+
+static constexpr uint16_t root_entries = 512;
+static constexpr uint32_t root_blocks = root_entries * 32 / 512;
+static constexpr uint32_t min_clusters = 4096; // Fewer would make it FAT12
+
+static void put16(uint8_t * const p, const uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void put32(uint8_t * const p, const uint32_t v) { put16(p, v); put16(p + 2, v >> 16); }
+
+void Simulator::insert_card(FILE * const program) {
+  std::vector<uint8_t> data;
+  for (int c; (c = fgetc(program)) != EOF;) data.push_back(c);
+  fclose(program);
+
+  // One block per cluster, one FAT, the file in the clusters from 2 on
+  const uint32_t file_blocks = (data.size() + 511) / 512,
+                 clusters = _MAX(min_clusters, file_blocks + 16),
+                 fat_blocks = ((clusters + 2) * 2 + 511) / 512,
+                 data_start = 1 + fat_blocks + root_blocks,
+                 total_blocks = data_start + clusters;
+
+  image.assign(total_blocks * 512, 0);
+
+  uint8_t * const boot = &image[0];
+  boot[0] = 0xEB; boot[1] = 0x3C; boot[2] = 0x90;
+  memcpy(boot + 3, "SIMULATR", 8);
+  put16(boot + 11, 512);          // Bytes per sector
+  boot[13] = 1;                   // Sectors per cluster
+  put16(boot + 14, 1);            // Reserved sectors
+  boot[16] = 1;                   // FATs
+  put16(boot + 17, root_entries);
+  if (total_blocks < 0x10000)
+    put16(boot + 19, total_blocks);
+  else
+    put32(boot + 32, total_blocks);
+  boot[21] = 0xF8;                // Fixed media
+  put16(boot + 22, fat_blocks);
+  boot[510] = 0x55; boot[511] = 0xAA;
+
+  uint8_t * const fat = &image[512];
+  put16(fat, 0xFFF8);
+  put16(fat + 2, 0xFFFF);
+  for (uint32_t i = 0; i < file_blocks; i++)
+    put16(fat + (2 + i) * 2, i + 1 < file_blocks ? 3 + i : 0xFFFF);
+
+  uint8_t * const entry = &image[(1 + fat_blocks) * 512];
+  memcpy(entry, "PROGRAM NC ", 11);
+  entry[11] = 0x20;               // Archive
+  put16(entry + 26, file_blocks ? 2 : 0);
+  put32(entry + 28, data.size());
+
+  if (data.size()) memcpy(&image[data_start * 512], data.data(), data.size());
+}
+
+bool Sd2Card::init(const uint8_t, const pin_t chipSelectPin) {
+  chipSelectPin_ = chipSelectPin;
+  type(SD_CARD_TYPE_SDHC);
+  errorCode_ = image.empty() ? SD_CARD_ERROR_CMD0 : 0;
+  return !errorCode_;
+}
+
+uint32_t Sd2Card::cardSize() { return image.size() / 512; }
+
+bool Sd2Card::readBlock(uint32_t block, uint8_t* dst) {
+  if (block >= cardSize()) {
+    error(SD_CARD_ERROR_CMD17);
+    return false;
+  }
+  memcpy(dst, &image[block * 512], 512);
+  return true;
+}
+
+bool Sd2Card::writeBlock(uint32_t block, const uint8_t* src) {
+  if (block >= cardSize()) {
+    error(SD_CARD_ERROR_CMD24);
+    return false;
+  }
+  memcpy(&image[block * 512], src, 512);
+  return true;
+}
+
+// Multiple block transfers, registers and erasing are left out, and fail
+bool Sd2Card::erase(uint32_t, uint32_t) { error(SD_CARD_ERROR_ERASE); return false; }
+bool Sd2Card::eraseSingleBlockEnable() { return false; }
+bool Sd2Card::readData(uint8_t*) { error(SD_CARD_ERROR_READ); return false; }
+bool Sd2Card::readStart(uint32_t) { error(SD_CARD_ERROR_CMD18); return false; }
+bool Sd2Card::readStop() { return true; }
+bool Sd2Card::setSckRate(const uint8_t) { return true; }
+bool Sd2Card::writeData(const uint8_t*) { error(SD_CARD_ERROR_WRITE); return false; }
+bool Sd2Card::writeStart(uint32_t, const uint32_t) { error(SD_CARD_ERROR_CMD25); return false; }
+bool Sd2Card::writeStop() { return true; }
+bool Sd2Card::readRegister(const uint8_t, void*) { error(SD_CARD_ERROR_READ_REG); return false; }
+
+#endif // SDSUPPORT
+
+#endif // __PLAT_SIMULATOR__
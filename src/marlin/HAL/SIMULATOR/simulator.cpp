@@ -0,0 +1,337 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+#include "../../inc/MarlinConfig.h"
+
+#include "simulator.h"
+
+#include "../../module/endstops.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
+
+#if ENABLED(EMERGENCY_PARSER)
+  #include "../../feature/e_parser.h"
+#endif
+
+Simulator simulator;
+
+FILE *Simulator::step_trace, *Simulator::block_trace, *Simulator::profile_trace;
+
+uint32_t Simulator::loop_ticks = 20 * STEPPER_TIMER_TICKS_PER_US;
+bool Simulator::feeding;
+bool Simulator::endstops;
+
+uint32_t Simulator::steps[4];
+int32_t Simulator::motor[4];
+int32_t Simulator::home[4];
+bool Simulator::endstops_changed;
+uint64_t Simulator::next_sample_ticks;
+uint32_t Simulator::blocks;
+uint64_t Simulator::start_ticks, Simulator::last_ticks, Simulator::last_block_ticks;
+uint16_t Simulator::last_tail, Simulator::last_occupancy, Simulator::min_occupancy = UINT16_MAX;
+long double Simulator::occupancy_ticks;
+uint32_t Simulator::starved;
+bool Simulator::running;
+float Simulator::distance;
+double Simulator::planned_s;
+char Simulator::emergency_command[MAX_CMD_SIZE + 1];
+uint64_t Simulator::emergency_ticks;
+
+typedef struct {
+  char letter;
+  int16_t step_pin, dir_pin;
+  bool step_on, dir_positive;
+} sim_axis_t;
+
+static constexpr sim_axis_t sim_axes[] = {
+  { 'X', X_STEP_PIN, X_DIR_PIN, !INVERT_X_STEP_PIN, !INVERT_X_DIR },
+  { 'Y', Y_STEP_PIN, Y_DIR_PIN, !INVERT_Y_STEP_PIN, !INVERT_Y_DIR },
+  { 'Z', Z_STEP_PIN, Z_DIR_PIN, !INVERT_Z_STEP_PIN, !INVERT_Z_DIR },
+  { 'A', A_STEP_PIN, A_DIR_PIN, !INVERT_A_STEP_PIN, !INVERT_A_DIR }
+};
+
+// The tool setter is a pad at machine X0 Y0, closed by a tool reaching its top
+static constexpr float tool_setter_radius = 5,  // (mm)
+                       tool_setter_z = -60;     // (mm) Machine Z of the top of the pad
+
+static inline double ticks_to_us(const uint64_t ticks) { return double(ticks) / STEPPER_TIMER_TICKS_PER_US; }
+
+void Simulator::init() {
+  HAL_pin_listener = pin_changed;
+
+  if (step_trace) fputs("time_us,axis,dir\n", step_trace);
+  if (block_trace) fputs("time_us,block,occupancy,mm,nominal_mm_s\n", block_trace);
+  if (profile_trace) fputs("time_ms,x_commanded,x,y_commanded,y\n", profile_trace);
+
+  // The motors start where the stepper counts are, and that's home
+  LOOP_L_N(i, COUNT(sim_axes)) home[i] = motor[i] = stepper.position(all_axes[i]);
+  if (endstops) LOOP_L_N(i, COUNT(sim_axes)) update_switch(i);
+
+  last_tail = planner.block_buffer_tail;
+  start_ticks = last_ticks = HAL_timer_now();
+  running = true;
+}
+
+void Simulator::pin_changed(const int16_t pin, const bool value) {
+  LOOP_L_N(i, COUNT(sim_axes)) {
+    const sim_axis_t &axis = sim_axes[i];
+    if (pin != axis.step_pin || value != axis.step_on) continue;
+
+    const int8_t dir = HAL_pin_read(axis.dir_pin) == axis.dir_positive ? 1 : -1;
+
+    steps[i]++;
+    motor[i] += dir;
+
+    if (endstops) update_switch(i);
+
+    if (step_trace)
+      fprintf(step_trace, "%.3f,%c,%d\n", ticks_to_us(HAL_timer_now() - start_ticks), axis.letter, dir);
+  }
+}
+
+// Set a switch pin to its active level when closed
+static bool set_switch(const int16_t pin, const bool inverting, const bool closed) {
+  const bool level = closed != inverting;
+  if (HAL_pin_read(pin) == level) return false;
+  HAL_pin_write(pin, level);
+  return true;
+}
+
+/**
+ * Open or close the homing switch of an axis for where its motor is now
+ */
+void Simulator::update_switch(const uint8_t i) {
+  const int32_t from_home = motor[i] - home[i];
+  bool changed = false;
+
+  switch (i) {
+    case 0:
+      #if X_HOME_DIR < 0 && PIN_EXISTS(X_MIN)
+        changed = set_switch(X_MIN_PIN, X_MIN_ENDSTOP_INVERTING, from_home <= 0);
+      #elif X_HOME_DIR > 0 && PIN_EXISTS(X_MAX)
+        changed = set_switch(X_MAX_PIN, X_MAX_ENDSTOP_INVERTING, from_home >= 0);
+      #endif
+      break;
+
+    case 1:
+      #if Y_HOME_DIR < 0 && PIN_EXISTS(Y_MIN)
+        changed = set_switch(Y_MIN_PIN, Y_MIN_ENDSTOP_INVERTING, from_home <= 0);
+        #if PIN_EXISTS(Y2_MIN)
+          changed |= set_switch(Y2_MIN_PIN, Y2_MIN_ENDSTOP_INVERTING, from_home <= 0);
+        #endif
+      #elif Y_HOME_DIR > 0 && PIN_EXISTS(Y_MAX)
+        changed = set_switch(Y_MAX_PIN, Y_MAX_ENDSTOP_INVERTING, from_home >= 0);
+        #if PIN_EXISTS(Y2_MAX)
+          changed |= set_switch(Y2_MAX_PIN, Y2_MAX_ENDSTOP_INVERTING, from_home >= 0);
+        #endif
+      #endif
+      break;
+
+    case 2:
+      #if Z_HOME_DIR < 0 && PIN_EXISTS(Z_MIN)
+        changed = set_switch(Z_MIN_PIN, Z_MIN_ENDSTOP_INVERTING, from_home <= 0);
+      #elif Z_HOME_DIR > 0 && PIN_EXISTS(Z_MAX)
+        changed = set_switch(Z_MAX_PIN, Z_MAX_ENDSTOP_INVERTING, from_home >= 0);
+      #endif
+      break;
+
+    case 3:
+      #if PIN_EXISTS(A_MAX)
+      {
+        const int32_t turn = LROUND(360 * planner.settings.axis_steps_per_unit[Axis::A()]),
+                      degree = LROUND(planner.settings.axis_steps_per_unit[Axis::A()]);
+        changed = set_switch(A_MAX_PIN, A_MAX_ENDSTOP_INVERTING, ((from_home % turn) + turn) % turn < degree);
+      }
+      #endif
+      break;
+  }
+
+  if (changed) endstops_changed = true;
+
+  if (i < 3) update_tool_setter();
+}
+
+/**
+ * Close the tool setter while the tool is over the pad and down on it
+ */
+void Simulator::update_tool_setter() {
+  #if HAS_TOOL_PROBE
+    const bool closed = ABS(motor[0] * planner.steps_to_unit.x()) <= tool_setter_radius
+                     && ABS(motor[1] * planner.steps_to_unit.y()) <= tool_setter_radius
+                     && motor[2] * planner.steps_to_unit.z() <= tool_setter_z;
+
+    if (set_switch(TOOL_PROBE_PIN, TOOL_PROBE_ENDSTOP_INVERTING, closed)) endstops_changed = true;
+  #endif
+}
+
+/**
+ * Weight the occupancy since the last event by its duration, and note any
+ * block the stepper has finished since.
+ */
+void Simulator::account() {
+  if (!running) return;
+
+  const uint64_t now = HAL_timer_now();
+
+  if (profile_trace) sample(now);
+
+  occupancy_ticks += (long double)last_occupancy * (now - last_ticks);
+  last_ticks = now;
+
+  // A finished block stays intact until the main loop queues another
+  for (; last_tail != planner.block_buffer_tail; last_tail = planner.next_block_index(last_tail)) {
+    const block_t &block = planner.block_buffer[last_tail];
+
+    blocks++;
+    distance += block.millimeters;
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // Both ramps and the cruise between them, as the planner laid them out
+      planned_s += double(block.acceleration_time + block.deceleration_time) / (STEPPER_TIMER_RATE)
+                 + (block.cruise_rate ? double(block.decelerate_after - block.accelerate_until) / block.cruise_rate : 0.0);
+    #endif
+    last_block_ticks = now;
+
+    if (block_trace)
+      fprintf(block_trace, "%.3f,%u,%u,%.4f,%.3f\n", ticks_to_us(now - start_ticks), unsigned(blocks), unsigned(planner.movesplanned()),
+        block.millimeters, SQRT(block.nominal_speed_sqr));
+  }
+
+  const uint16_t occupancy = planner.movesplanned();
+
+  // Only count a dry planner once moves have started and while more are to come
+  if (feeding && blocks) {
+    NOMORE(min_occupancy, occupancy);
+    if (!occupancy && last_occupancy) starved++;
+  }
+
+  last_occupancy = occupancy;
+}
+
+/**
+ * Write the X/Y positions for each millisecond passed since the last sample.
+ * The stepper counts are the commanded positions, and the motors lag them by
+ * the steps the shaper is still to play back.
+ */
+void Simulator::sample(const uint64_t now) {
+  constexpr uint32_t sample_ticks = (STEPPER_TIMER_RATE) / 1000;
+
+  if (!next_sample_ticks) next_sample_ticks = start_ticks;
+
+  for (; next_sample_ticks <= now; next_sample_ticks += sample_ticks)
+    fprintf(profile_trace, "%.0f,%.4f,%.4f,%.4f,%.4f\n", ticks_to_us(next_sample_ticks - start_ticks) / 1000,
+      stepper.position(Axis::X()) * planner.steps_to_unit.x(), motor[0] * planner.steps_to_unit.x(),
+      stepper.position(Axis::Y()) * planner.steps_to_unit.y(), motor[1] * planner.steps_to_unit.y());
+}
+
+void Simulator::send_emergency(const char * const command, const float delay_ms) {
+  strncpy(emergency_command, command, MAX_CMD_SIZE);
+  emergency_command[MAX_CMD_SIZE] = '\0';
+  emergency_ticks = HAL_timer_now() + uint64_t(delay_ms * 1000 * STEPPER_TIMER_TICKS_PER_US);
+}
+
+void Simulator::advance(const uint64_t until) {
+  account();
+  while (HAL_timer_service(until)) {
+    // Run the endstop check as the pin change interrupt would
+    if (endstops_changed) {
+      endstops_changed = false;
+      ::endstops.update();
+    }
+    account();
+  }
+  account();
+
+  // Deliver the command as the serial receive interrupt would
+  if (*emergency_command && HAL_timer_now() >= emergency_ticks) {
+    #if ENABLED(EMERGENCY_PARSER)
+      EmergencyParser::State state = EmergencyParser::EP_RESET;
+      for (const char *c = emergency_command; *c; c++) emergency_parser.update(state, *c);
+      emergency_parser.update(state, '\n');
+    #endif
+    *emergency_command = '\0';
+  }
+}
+
+void Simulator::report() {
+  const uint64_t now = HAL_timer_now();
+
+  printf("Simulated time: %.6f s\n", ticks_to_us(now) / 1e6);
+  const double cycle_s = ticks_to_us(blocks ? last_block_ticks - start_ticks : 0) / 1e6;
+
+  printf("Cycle time: %.6f s\n", cycle_s);
+  #if ENABLED(S_CURVE_ACCELERATION)
+    printf("Planned time: %.6f s\n", planned_s);
+  #endif
+  printf("Blocks: %u\n", unsigned(blocks));
+  printf("Distance: %.3f mm, average feed %.1f mm/min\n", double(distance), cycle_s ? distance / cycle_s * 60 : 0.0);
+
+  printf("Steps:");
+  LOOP_L_N(i, COUNT(sim_axes)) printf(" %c %u", sim_axes[i].letter, unsigned(steps[i]));
+  printf("\n");
+
+  // The minimum is only sampled while the program is still being fed
+  if (min_occupancy == UINT16_MAX)
+    printf("Planner occupancy: min -, ");
+  else
+    printf("Planner occupancy: min %u, ", unsigned(min_occupancy));
+
+  printf("avg %.2f of %u\n",
+    now > start_ticks ? double(occupancy_ticks / (now - start_ticks)) : 0.0,
+    unsigned(BLOCK_BUFFER_SIZE - 1)
+  );
+  printf("Planner empty with moves to come: %u\n", unsigned(starved));
+
+  #if ENABLED(PLANNER_STATS)
+    const planner_stats_t &stats = planner.stats;
+    const double per_block = stats.blocks ? 1.0 / stats.blocks : 0.0;
+    printf("Replan per block: reverse %.1f (max %u), forward %.1f, trapezoids %.1f of %.1f visited\n",
+      stats.reverse * per_block, unsigned(stats.reverse_max), stats.forward * per_block,
+      stats.trapezoids * per_block, stats.trapezoid_visits * per_block);
+  #endif
+
+  #if ENABLED(MOTION_STATS)
+    // As M2000 ?/diagnostics/motion reports them. Its times are host times, so they're left out.
+    const motion_stats_t &motion = planner.motion_stats;
+    printf("Motion stats: blocks %u, occupancy min %u avg %.2f, delayed %u, underruns %u, max step rate %u\n",
+      unsigned(motion.delivered), unsigned(motion.delivered ? motion.queued_min : 0),
+      motion.delivered ? double(motion.queued) / motion.delivered : 0.0,
+      unsigned(motion.delayed), unsigned(motion.underruns), unsigned(stepper.max_step_rate));
+  #endif
+
+  #if ENABLED(STEPPER_ISR_PROFILE)
+    // Host times from the simulator's cycle counter, only good for comparing runs on the same machine
+    static constexpr const char *phase_names[] = { "isr", "pulse", "shaping", "advance", "babystep", "block" };
+    printf("ISR profile over %u blocks (host us):\n", unsigned(stepper.isr_profile_block));
+    LOOP_L_N(phase, uint8_t(IsrPhase::Count)) {
+      const isr_profile_t &profile = stepper.isr_profile[phase];
+      if (!profile.count) continue;
+      printf("  %-8s count %u, max %.2f in block %u, histogram",
+        phase_names[phase], unsigned(profile.count), double(profile.max_cycles) / (F_CPU / 1000000UL), unsigned(profile.max_block));
+      LOOP_L_N(i, ISR_PROFILE_BUCKETS) printf(" %u", unsigned(profile.buckets[i]));
+      printf("\n");
+    }
+  #endif
+}
+
+#endif // __PLAT_SIMULATOR__
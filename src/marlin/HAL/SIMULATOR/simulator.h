@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "timers.h"
+
+/**
+ * Simulator for the planner and stepper
+ *
+ * The firmware runs unchanged on the host. Simulated time moves when the main
+ * loop idles or waits, by a fixed cost per idle() call, and the stepper ISR
+ * runs whenever its timer comes due. Times are from the start of the program.
+ * The simulator watches the step and direction pins and the planner ring to
+ * report:
+ *
+ *  - The time, axis and direction of every step (optional CSV)
+ *  - The commanded and motor X/Y positions every millisecond (optional CSV),
+ *    which differ by what the input shaper has still to play back
+ *  - The time, length and nominal speed of every finished block (optional CSV)
+ *  - The minimum and time-weighted average planner occupancy
+ *  - How often the planner ran dry with moves still to come
+ *  - The estimated cycle time of the program and the feed achieved over it
+ *
+ * A program line "!<ms> <command>" sends the command through the emergency
+ * parser that many milliseconds after the line is read, as a host sending it
+ * out of band would. The delay may be fractional, to land between commands.
+ *
+ * With endstops on, the X, Y and Z switches close wherever their motors are
+ * at or beyond where the machine started, towards home, and A's closes over
+ * the first degree of each turn from where it started. Each change runs the
+ * endstop check as the pin interrupt would, once the stepper ISR is done.
+ */
+class Simulator {
+public:
+  static FILE *step_trace, *block_trace, *profile_trace;
+
+  static uint32_t loop_ticks;   // Simulated cost of one main loop pass
+  static bool feeding;          // The program still has lines to queue
+  static bool endstops;         // Simulate the homing switches and the tool setter
+
+  static void init();
+
+  // Send a command through the emergency parser after a delay
+  static void send_emergency(const char * const command, const float delay_ms);
+
+  // Put the program on the simulated SD card as PROGRAM.NC
+  static void insert_card(FILE * const program);
+
+  // Advance simulated time, running the stepper ISR as it comes due
+  static void advance(const uint64_t until);
+
+  // Advance simulated time by one main loop pass
+  static inline void idle() { advance(HAL_timer_now() + loop_ticks); }
+
+  static void report();
+
+private:
+  static uint32_t steps[4];
+  static int32_t motor[4];
+  static int32_t home[4];
+  static bool endstops_changed;
+  static uint64_t next_sample_ticks;
+  static uint32_t blocks;
+  static uint64_t start_ticks, last_ticks, last_block_ticks;
+  static uint16_t last_tail, last_occupancy, min_occupancy;
+  static long double occupancy_ticks;
+  static uint32_t starved;
+  static bool running;
+  static float distance;
+  static double planned_s;
+
+  static char emergency_command[];
+  static uint64_t emergency_ticks;
+
+  static void account();
+  static void sample(const uint64_t now);
+  static void pin_changed(const int16_t pin, const bool value);
+  static void update_switch(const uint8_t i);
+  static void update_tool_setter();
+};
+
+extern Simulator simulator;
@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_SIMULATOR__
+
+// --------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------
+
+#include "../../inc/MarlinConfig.h"
+
+// --------------------------------------------------------------------------
+// Private Variables
+// --------------------------------------------------------------------------
+
+static uint64_t sim_ticks;        // Simulated time
+static uint64_t step_started;     // Time the step timer last restarted its count
+static hal_timer_t step_compare;
+static bool step_enabled;
+static bool in_step_isr;
+
+// --------------------------------------------------------------------------
+// Public functions
+// --------------------------------------------------------------------------
+
+void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
+  if (timer_num != STEP_TIMER_NUM) return;
+  step_started = sim_ticks;
+  step_compare = HAL_TIMER_RATE / frequency;
+}
+
+void HAL_timer_set_compare(const uint8_t timer_num, const hal_timer_t compare) {
+  if (timer_num == STEP_TIMER_NUM) step_compare = compare;
+}
+
+hal_timer_t HAL_timer_get_compare(const uint8_t timer_num) {
+  return timer_num == STEP_TIMER_NUM ? step_compare : 0;
+}
+
+hal_timer_t HAL_timer_get_count(const uint8_t timer_num) {
+  if (timer_num != STEP_TIMER_NUM) return 0;
+
+  // Nothing else moves time in the ISR, so each read costs a tick, as a
+  // busy wait on the count would
+  if (in_step_isr) sim_ticks++;
+
+  return hal_timer_t(sim_ticks - step_started);
+}
+
+void HAL_timer_enable_interrupt(const uint8_t timer_num) {
+  if (timer_num == STEP_TIMER_NUM) step_enabled = true;
+}
+
+void HAL_timer_disable_interrupt(const uint8_t timer_num) {
+  if (timer_num == STEP_TIMER_NUM) step_enabled = false;
+}
+
+bool HAL_timer_interrupt_enabled(const uint8_t timer_num) {
+  return timer_num == STEP_TIMER_NUM && step_enabled;
+}
+
+uint64_t HAL_timer_now() { return sim_ticks; }
+
+bool HAL_timer_service(const uint64_t until) {
+  // The ISR re-enables itself when it's done, so it can't nest
+  if (in_step_isr || !step_enabled || step_started + step_compare > until) {
+    if (until > sim_ticks) sim_ticks = until;
+    return false;
+  }
+
+  // As in MFRQ mode, the count restarts when the ISR fires. An ISR that
+  // overran its compare fires again as soon as it returns.
+  sim_ticks = _MAX(sim_ticks, step_started + step_compare);
+  step_started = sim_ticks;
+
+  in_step_isr = true;
+  HAL_step_timer_isr();
+  in_step_isr = false;
+
+  return true;
+}
+
+#endif // __PLAT_SIMULATOR__
@@ -45,6 +45,8 @@
   #define HAL_PATH(PATH, NAME) XSTR(PATH/LINUX/NAME)
 #elif defined(__SAMD51__)
   #define HAL_PATH(PATH, NAME) XSTR(PATH/SAMD51/NAME)
+#elif defined(__PLAT_SIMULATOR__)
+  #define HAL_PATH(PATH, NAME) XSTR(PATH/SIMULATOR/NAME)
 #else
   #error "Unsupported Platform!"
 #endif
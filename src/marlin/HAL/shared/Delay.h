@@ -177,6 +177,20 @@ FORCE_INLINE static void DELAY_CYCLES(uint16_t x) {
 }
 #	undef nop
 
+#elif defined(__PLAT_SIMULATOR__)
+
+#	include <stdint.h>
+
+// Cycle delays cost no simulated time. Waits on the step timer still pass,
+// since each read of its count moves simulated time on by a tick.
+// The cycle counter follows the host's monotonic clock for profiling.
+
+FORCE_INLINE static void enableCycleCounter() {}
+
+uint32_t getCycleCount();
+
+FORCE_INLINE static void DELAY_CYCLES(const uint32_t) {}
+
 #elif defined(__PLAT_LINUX__) || defined(ESP32)
 
 // specified inside platform
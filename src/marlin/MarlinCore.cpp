@@ -160,6 +160,10 @@ bool G38_did_trigger; // = false
 #	include "feature/repeat.h"
 #endif
 
+#if ENABLED(GCODE_SUBPROGRAMS)
+#	include "feature/subprogram.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
 #	include "feature/powerloss.h"
 #endif
@@ -429,6 +433,7 @@ bool printingIsPaused() {
 void startOrResumeJob() {
 	if (!printingIsPaused()) {
 		TERN_(GCODE_REPEAT_MARKERS, repeat.reset());
+		TERN_(GCODE_SUBPROGRAMS, subprograms.reset());
 		TERN_(CANCEL_OBJECTS, cancelable.reset());
 		TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator = 0);
 #if BOTH(LCD_SET_PROGRESS_MANUALLY, USE_M73_REMAINING_TIME)
@@ -732,6 +737,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep /*=false*/)) {
 	// Core Marlin activities
 	manage_inactivity(TERN_(ADVANCED_PAUSE_FEATURE, no_stepper_sleep));
 
+	// Set up the next blocks ahead of the Stepper ISR
+	TERN_(STEPPER_PREPARE_BLOCKS, stepper.prepare_blocks());
+
 	Controller::getInstance().idle();
 
 	//gcode.set_busy_state(NOT_BUSY);
@@ -1092,7 +1100,8 @@ void setup() {
 			" | Author: " STRING_CONFIG_H_AUTHOR);
 #endif
 	SERIAL_ECHO_MSG("Compiled: " __DATE__);
-	SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, (int) sizeof(block_t) * (BLOCK_BUFFER_SIZE));
+	SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, (int) sizeof(block_t) * (BLOCK_BUFFER_SIZE),
+	                STR_PLANNER_BLOCKS, BLOCK_BUFFER_SIZE, STR_PLANNER_BLOCK_BYTES, (int) sizeof(block_t), STR_PLANNER_ISR_BYTES, (int) sizeof(block_motion_t));
 
 #if ENABLED(NEOPIXEL2_SEPARATE)
 	SETUP_RUN(leds2.setup());
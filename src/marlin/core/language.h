@@ -111,6 +111,9 @@
 #define STR_SOFTWARE_RESET              " Software Reset"
 #define STR_FREE_MEMORY                 " Free Memory: "
 #define STR_PLANNER_BUFFER_BYTES        "  PlannerBufferBytes: "
+#define STR_PLANNER_BLOCKS              " Blocks: "
+#define STR_PLANNER_BLOCK_BYTES         " BlockBytes: "
+#define STR_PLANNER_ISR_BYTES           " ISRBytes: "
 #define STR_OK                          "ok"
 #define STR_WAIT                        "wait"
 #define STR_STATS                       "Stats: "
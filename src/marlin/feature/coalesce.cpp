@@ -0,0 +1,242 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LINE_COALESCING)
+
+#	include "coalesce.h"
+
+#	include "../gcode/queue.h"
+#	include "../module/motion.h"
+#	include "../module/planner.h"
+
+using namespace swordfish::math;
+using namespace swordfish::motion;
+using namespace swordfish::status;
+
+LineCoalescer coalescer;
+
+#	if ENABLED(PATH_BLENDING)
+// Start on the exact path (G61), jobs opt in to blending and fusing with G64
+float32_t LineCoalescer::tolerance = 0;
+float32_t LineCoalescer::blend_tolerance = 0;
+#	else
+float32_t LineCoalescer::tolerance = LINE_COALESCE_TOLERANCE;
+#	endif
+
+bool LineCoalescer::pending;
+Vector6f32 LineCoalescer::start, LineCoalescer::end;
+FeedRate LineCoalescer::feed_rate = FeedRate::UnitsPerSecond(0);
+MachineState LineCoalescer::machine_state;
+float32_t LineCoalescer::accel_mm_s2;
+
+Vector3f32 LineCoalescer::points[LINE_COALESCE_POINTS - 1];
+uint8_t LineCoalescer::point_count;
+
+bool LineCoalescer::same_motion(const FeedRate& fr, const MachineState state, const float32_t accel) {
+	return fr.type() == FeedRateType::UnitsPerSecond && fr.type() == feed_rate.type() && fr.value() == feed_rate.value()
+	    && state == machine_state && accel == accel_mm_s2;
+}
+
+bool LineCoalescer::extend(const Vector6f32& target, const FeedRate& fr, const MachineState state, const float32_t accel) {
+	if (point_count >= COUNT(points) || !same_motion(fr, state, accel) || target.tail<3>() != start.tail<3>()) {
+		return false;
+	}
+
+	const Vector3f32 origin = start.head<3>(),
+	                 chord = target.head<3>() - origin,
+	                 vertex = end.head<3>();
+
+	const float32_t chord_sq = chord.squaredNorm();
+
+	if (chord_sq == 0) {
+		return false;
+	}
+
+	const float32_t tolerance_sq = sq(tolerance);
+	float32_t last_t = 0;
+
+	// Each vertex must lie near the chord, in the order it was passed
+	auto fits = [&](const Vector3f32& point) {
+		const float32_t t = (point - origin).dot(chord) / chord_sq;
+
+		if (t < last_t || t > 1) {
+			return false;
+		}
+
+		last_t = t;
+
+		return (origin + chord * t - point).squaredNorm() <= tolerance_sq;
+	};
+
+	LOOP_L_N(i, point_count) {
+		if (!fits(points[i])) {
+			return false;
+		}
+	}
+
+	if (!fits(vertex)) {
+		return false;
+	}
+
+	points[point_count++] = vertex;
+	end = target;
+
+	return true;
+}
+
+#	if ENABLED(PATH_BLENDING)
+
+bool LineCoalescer::blend(const Vector6f32& target, const FeedRate& fr, const MachineState state, const float32_t accel) {
+	if (blend_tolerance <= 0 || !same_motion(fr, state, accel)
+	    || end.tail<3>() != start.tail<3>() || target.tail<3>() != end.tail<3>()) {
+		return false;
+	}
+
+	const Vector3f32 corner = end.head<3>(),
+	                 in = corner - start.head<3>(),
+	                 out = target.head<3>() - corner;
+
+	const float32_t in_mm = in.norm(),
+	                out_mm = out.norm();
+
+	if (in_mm == 0 || out_mm == 0) {
+		return false;
+	}
+
+	const Vector3f32 in_dir = in / in_mm,
+	                 out_dir = out / out_mm;
+
+	const float32_t cos_turn = in_dir.dot(out_dir);
+
+	// Nothing to round off on a straight line, and no room in a reversal
+	if (!WITHIN(cos_turn, -0.999f, 0.9999f)) {
+		return false;
+	}
+
+	// Half of the inside angle of the corner, by the half angle identities
+	const float32_t sin_half = SQRT(0.5f * (1.0f + cos_turn)),
+	                cos_half = SQRT(0.5f * (1.0f - cos_turn));
+
+	// Distance from the corner to where the arc meets the moves, putting the
+	// middle of the arc at the tolerance from the corner. Leave half of the
+	// next move for its own corner.
+	float32_t cut = blend_tolerance * cos_half / (1.0f - sin_half);
+	NOMORE(cut, in_mm);
+	NOMORE(cut, 0.5f * out_mm);
+
+	const float32_t radius = cut * sin_half / cos_half,
+	                turn = ACOS(cos_turn);
+
+	uint8_t segments = PATH_BLEND_SEGMENTS;
+
+#		if HAS_JUNCTION_DEVIATION
+	// The planner takes a sharp corner as fast as an arc of this radius, which is
+	// the same arc for a tolerance of J. A tighter blend would only slow it down.
+	if (radius <= planner.junction_deviation_mm * sin_half / (1.0f - sin_half)) {
+		return false;
+	}
+
+	// Chords turning by up to sqrt(8 * J / r) join no slower than the arc itself
+	const float32_t needed = CEIL(turn * SQRT(radius / (8.0f * planner.junction_deviation_mm)));
+
+	if (needed < segments) {
+		segments = uint8_t(_MAX(needed, 1.0f));
+	}
+#		endif
+
+	const Vector3f32 center = corner + (out_dir - in_dir).normalized() * (radius / sin_half),
+	                 entry = corner - in_dir * cut,
+	                 normal = (entry - center) / radius;
+
+	Vector6f32 point = end;
+
+	if (cut < in_mm) {
+		point.head<3>() = entry;
+		plan(point);
+	}
+
+	for (uint8_t i = 1; i <= segments; i++) {
+		if (i < segments) {
+			const float32_t angle = turn * i / segments;
+
+			point.head<3>() = center + (normal * cos(angle) + in_dir * sin(angle)) * radius;
+		} else {
+			point.head<3>() = corner + out_dir * cut; // Exactly on the next move
+		}
+
+		plan(point);
+	}
+
+	// Carry on from the end of the arc
+	start = point;
+	end = target;
+	point_count = 0;
+
+	return true;
+}
+
+#	endif // PATH_BLENDING
+
+void LineCoalescer::line_to(const Vector6f32& target, const FeedRate& fr, const MachineState state, const float32_t accel) {
+	if (pending && target != end && !extend(target, fr, state, accel)
+#	if ENABLED(PATH_BLENDING)
+	    && !blend(target, fr, state, accel)
+#	endif
+	) {
+		flush();
+	}
+
+	if (!pending && target != current_position) {
+		start = current_position;
+		end = target;
+		feed_rate = fr;
+		machine_state = state;
+		accel_mm_s2 = accel;
+		point_count = 0;
+		pending = true;
+	}
+
+	// Hold the run only while another move is queued to extend it
+	const parsed_command_t* const next = queue.peek_next();
+
+	if ((tolerance <= 0 && TERN1(PATH_BLENDING, blend_tolerance <= 0))
+	    || !next || next->command_letter != 'G' || next->codenum > 1) {
+		flush();
+	}
+}
+
+void LineCoalescer::flush() {
+	if (!pending) {
+		return;
+	}
+
+	pending = false;
+
+	plan(end);
+}
+
+void LineCoalescer::plan(const Vector6f32& target) {
+	planner.buffer_line(target, feed_rate, active_extruder, machine_state, 0.0, accel_mm_s2);
+}
+
+#endif // LINE_COALESCING
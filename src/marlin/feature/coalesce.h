@@ -0,0 +1,102 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../inc/MarlinConfigPre.h"
+
+#include <swordfish/math.h>
+#include <swordfish/modules/motion/FeedRate.h>
+#include <swordfish/modules/status/StatusModule.h>
+
+/**
+ * Fuse runs of short, nearly collinear G0/G1 moves into single planner blocks.
+ *
+ * A move is held back only while another G0/G1 is queued behind it. The next
+ * move either extends the held run or flushes it to the planner. A run grows
+ * as long as every vertex it passes stays within the tolerance of the straight
+ * line from its start to its new end, and progresses along that line. Runs
+ * never mix feed rates, motion types or accelerations, and never move A.
+ *
+ * The planner knows nothing of a held run, so to keep the order of moves its
+ * callers flush it first:
+ *  - GcodeSuite::process_parsed_command, for every command but G0/G1
+ *  - GCodeQueue::advance, once the queue runs dry
+ *  - prepare_line_to_destination, for a move that isn't coalesced
+ *  - wrap_rotary_a, before the planner's A position moves
+ * Anything new that queues blocks or moves the planner's position outside a
+ * command must do the same. Planner::quick_stop drops the run, and
+ * Planner::cancel_jog restarts it from where the jog ends.
+ *
+ * With PATH_BLENDING, a run that can't be extended meets the next move at a
+ * corner. The corner is cut by an arc tangent to both moves, planned as
+ * chords, and the next run starts where the arc ends.
+ */
+class LineCoalescer {
+private:
+	static bool pending;
+	static swordfish::math::Vector6f32 start, end;
+	static swordfish::motion::FeedRate feed_rate;
+	static swordfish::status::MachineState machine_state;
+	static float32_t accel_mm_s2;
+
+	// The vertices inside the held run, in order
+	static swordfish::math::Vector3f32 points[LINE_COALESCE_POINTS - 1];
+	static uint8_t point_count;
+
+	static bool same_motion(const swordfish::motion::FeedRate& fr, const swordfish::status::MachineState state, const float32_t accel);
+	static bool extend(const swordfish::math::Vector6f32& target, const swordfish::motion::FeedRate& fr, const swordfish::status::MachineState state, const float32_t accel);
+#if ENABLED(PATH_BLENDING)
+	static bool blend(const swordfish::math::Vector6f32& target, const swordfish::motion::FeedRate& fr, const swordfish::status::MachineState state, const float32_t accel);
+#endif
+
+	static void plan(const swordfish::math::Vector6f32& target);
+
+public:
+	static float32_t tolerance; // (mm) Set by G64 P (Q with PATH_BLENDING), 0 to disable
+#if ENABLED(PATH_BLENDING)
+	static float32_t blend_tolerance; // (mm) Set by G64 P, 0 to disable
+#endif
+
+	// Plan a line from current_position to the target, holding it back if it may be extended
+	static void line_to(const swordfish::math::Vector6f32& target, const swordfish::motion::FeedRate& fr, const swordfish::status::MachineState state, const float32_t accel);
+
+	// Send the held run to the planner
+	static void flush();
+
+	// Whether a run is held back from the planner
+	static inline bool is_pending() {
+		return pending;
+	}
+
+	// Forget the held run, when the planner has been emptied
+	static inline void discard() {
+		pending = false;
+	}
+
+	// Start the held run from a new position, when the planner has been cut back under it
+	static inline void restart(const swordfish::math::Vector6f32& from) {
+		start = from;
+		point_count = 0;
+	}
+};
+
+extern LineCoalescer coalescer;
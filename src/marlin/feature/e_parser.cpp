@@ -35,6 +35,10 @@ bool EmergencyParser::killed_by_M112, // = false
      EmergencyParser::quickstop_by_M410,
      EmergencyParser::enabled;
 
+#if ENABLED(JOGGING)
+  bool EmergencyParser::cancel_jog_by_M410; // = false
+#endif
+
 #if ENABLED(HOST_PROMPT_SUPPORT)
   uint8_t EmergencyParser::M876_reason; // = 0
 #endif
@@ -41,7 +41,7 @@ class EmergencyParser {
 
 public:
 
-  // Currently looking for: M108, M112, M410, M876
+  // Currently looking for: M108, M112, M410, M410 J, M876
   enum State : char {
     EP_RESET,
     EP_N,
@@ -56,6 +56,9 @@ public:
     EP_M4,
     EP_M41,
     EP_M410,
+    #if ENABLED(JOGGING)
+      EP_M410J,
+    #endif
     #if ENABLED(HOST_PROMPT_SUPPORT)
       EP_M8,
       EP_M87,
@@ -68,6 +71,9 @@ public:
 
   static bool killed_by_M112;
   static bool quickstop_by_M410;
+  #if ENABLED(JOGGING)
+    static bool cancel_jog_by_M410;
+  #endif
 
   #if ENABLED(HOST_PROMPT_SUPPORT)
     static uint8_t M876_reason;
@@ -172,6 +178,15 @@ public:
         if (ISEOL(c)) state = EP_RESET;
         break;
 
+      #if ENABLED(JOGGING)
+      case EP_M410:
+        if (c == 'J') {
+          state = EP_M410J;
+          break;
+        }
+        [[fallthrough]];
+      #endif
+
       default:
         if (ISEOL(c)) {
           if (enabled) switch (state) {
@@ -180,6 +195,9 @@ public:
             case EP_M112: killed_by_M112 = true; break;
 						case EP_M114: report_current_position_projected(); break;
             case EP_M410: quickstop_by_M410 = true; break;
+            #if ENABLED(JOGGING)
+              case EP_M410J: cancel_jog_by_M410 = true; break;
+            #endif
             #if ENABLED(HOST_PROMPT_SUPPORT)
               case EP_M876SN: host_response_handler(M876_reason); break;
             #endif
@@ -0,0 +1,249 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_SUBPROGRAMS)
+
+// #define DEBUG_GCODE_SUBPROGRAMS
+
+#	include "subprogram.h"
+
+#	include "../sd/cardreader.h"
+#	include "../module/temperature.h"
+#	include "../MarlinCore.h"
+
+#	define DEBUG_OUT ENABLED(DEBUG_GCODE_SUBPROGRAMS)
+#	include "../core/debug_out.h"
+
+Subprograms subprograms;
+
+subprogram_entry_t Subprograms::cache[SUBPROGRAM_CACHE_SIZE];
+uint8_t Subprograms::cache_count, Subprograms::cache_next;
+bool Subprograms::scanned, Subprograms::indexed;
+
+subprogram_frame_t Subprograms::stack[SUBPROGRAM_DEPTH];
+uint8_t Subprograms::depth;
+
+void Subprograms::reset() {
+	cache_count = cache_next = 0;
+	depth = 0;
+	scanned = indexed = false;
+}
+
+void Subprograms::remember(const uint32_t number, const uint32_t sdpos, const uint32_t end_sdpos) {
+	if (find(number))
+		return;
+
+	// Replace the oldest entry once the cache is full, the index is no longer complete
+	if (cache_count == SUBPROGRAM_CACHE_SIZE)
+		indexed = false;
+
+	cache[cache_next] = { number, sdpos, end_sdpos };
+	cache_next = (cache_next + 1) % SUBPROGRAM_CACHE_SIZE;
+	if (cache_count < SUBPROGRAM_CACHE_SIZE)
+		cache_count++;
+
+	DEBUG_ECHOLNPAIR("Cache O", number, " at ", sdpos, " to ", end_sdpos);
+}
+
+const subprogram_entry_t* Subprograms::find(const uint32_t number) {
+	LOOP_L_N(i, cache_count) {
+		if (cache[i].number == number)
+			return &cache[i];
+	}
+
+	return nullptr;
+}
+
+/**
+ * Read the file from sdpos, caching every O-word block closed by an M99 on the way.
+ * An O-word followed by another O-word or the end of the file before any M99 is
+ * just a program number, like the "O1234 (PART)" header of a Fanuc job.
+ *
+ * If open is an O-word, sdpos is the start of its body and only that block is read.
+ * Otherwise the file is read until the block for number is cached, or to the end
+ * if number is -1.
+ */
+const subprogram_entry_t* Subprograms::scan(const uint32_t sdpos, const int32_t open, const int32_t number) {
+	const uint32_t resume_sdpos = card.getIndex();
+	uint32_t pos = sdpos, body = sdpos;
+	int32_t block = open;
+	bool done = false;
+	char buffer[64], line[16];
+	uint8_t length = 0;
+
+	DEBUG_ECHOLNPAIR("Scan for O", number, " from ", sdpos);
+
+	card.setIndex(sdpos);
+
+	for (int16_t count; !done && (count = card.read(buffer, sizeof(buffer))) > 0;) {
+		// Keep the watchdog and the heaters going through a long file. Not idle(),
+		// which reads the job from the card while the scan has it elsewhere.
+		watchdog_refresh();
+		thermalManager.manage_heater();
+
+		for (int16_t i = 0; i < count && !done; i++, pos++) {
+			const char c = buffer[i];
+
+			if (!ISEOL(c)) {
+				// Keep the start of the line, enough to tell an O-word or an M99
+				if ((length || c != ' ') && length < sizeof(line) - 1)
+					line[length++] = c;
+
+				continue;
+			}
+
+			line[length] = '\0';
+			length = 0;
+
+			const char* const word = skip_line_number(line);
+
+			if (is_o_word(word)) {
+				done = open >= 0;
+				block = program_number(word + 1); // An M99 after an out of range O-word closes nothing
+				body = pos + 1;
+			} else if (block >= 0 && is_M(word, 99)) {
+				remember(block, body, pos + 1);
+				done = open >= 0 || block == number;
+				block = -1;
+			}
+		}
+	}
+
+	card.setIndex(resume_sdpos);
+
+	return number >= 0 ? find(number) : nullptr;
+}
+
+/**
+ * Find a subprogram, indexing the file on the first call of the job. If the index
+ * didn't hold every subprogram, scan from sdpos as scan() does.
+ */
+const subprogram_entry_t* Subprograms::lookup(const uint32_t number, const uint32_t sdpos, const int32_t open) {
+	if (!scanned) {
+		scanned = indexed = true;
+		scan(0, -1, -1);
+	}
+
+	return find(number) ?: (indexed ? nullptr : scan(sdpos, open, number));
+}
+
+void Subprograms::call(const uint32_t number, const uint16_t count) {
+	if (!count)
+		return;
+
+	if (depth >= SUBPROGRAM_DEPTH) {
+		SERIAL_ERROR_MSG("Exceeded max SUBPROGRAM depth:", int(SUBPROGRAM_DEPTH));
+		card.flag.abort_sd_printing = true;
+		return;
+	}
+
+	const subprogram_entry_t* entry = lookup(number, 0, -1);
+
+	if (!entry) {
+		SERIAL_ERROR_MSG("Subprogram not found: O", number);
+		card.flag.abort_sd_printing = true;
+		return;
+	}
+
+	stack[depth++] = { entry->sdpos, card.getIndex(), uint16_t(count - 1) };
+
+	DEBUG_ECHOLNPAIR("Call O", number, " at ", entry->sdpos, " x", count);
+
+	card.setIndex(entry->sdpos);
+}
+
+void Subprograms::ret() {
+	if (!depth) {
+		SERIAL_ECHO_MSG("!M99 outside a subprogram.");
+		return;
+	}
+
+	subprogram_frame_t& frame = stack[depth - 1];
+
+	if (frame.remaining) {
+		--frame.remaining;
+		card.setIndex(frame.start);
+	} else {
+		--depth;
+		card.setIndex(frame.return_sdpos);
+	}
+
+	DEBUG_ECHOLNPAIR("Return to ", card.getIndex());
+}
+
+bool Subprograms::early_parse(char* const cmd) {
+	const char* p = cmd;
+
+	while (*p == ' ')
+		p++;
+
+	p = skip_line_number(p);
+
+	// Jump over a subprogram met in the main flow. An O-word without an M99 is just a program number.
+	if (is_o_word(p)) {
+		const int32_t number = program_number(p + 1);
+
+		if (number < 0) {
+			SERIAL_ERROR_MSG("Subprogram number out of range.");
+			card.flag.abort_sd_printing = true;
+			return true;
+		}
+
+		const subprogram_entry_t* entry = lookup(number, card.getIndex(), number);
+
+		if (entry && entry->sdpos == card.getIndex())
+			card.setIndex(entry->end_sdpos);
+
+		return true;
+	}
+
+	// Read the words from the line. This runs while another command is being
+	// executed, so the parser still holds that command's words.
+	const bool is_M98 = is_M(p, 98), is_M99 = is_M(p, 99);
+
+	if (is_M98) {
+		const char* const P = find_word(p + 3, 'P');
+		const char* const L = find_word(p + 3, 'L');
+		const int32_t number = P ? program_number(P) : -1;
+
+		if (!P)
+			SERIAL_ECHO_MSG("!M98 needs a P word.");
+		else if (number < 0) {
+			SERIAL_ERROR_MSG("Subprogram number out of range.");
+			card.flag.abort_sd_printing = true;
+		} else
+			call(number, L ? atoi(L) : 1);
+
+		return true;
+	}
+
+	if (is_M99) {
+		ret();
+
+		return true;
+	}
+
+	return false;
+}
+
+#endif // GCODE_SUBPROGRAMS
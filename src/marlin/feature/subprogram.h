@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../inc/MarlinConfigPre.h"
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t number; // The O-word
+	uint32_t sdpos; // The file position of the first line of the body
+	uint32_t end_sdpos; // The file position of the line after the M99
+} subprogram_entry_t;
+
+typedef struct {
+	uint32_t start; // The file position of the first line of the body
+	uint32_t return_sdpos; // The file position of the line after the M98
+	uint16_t remaining; // Repeats left after the current pass
+} subprogram_frame_t;
+
+/**
+ * O-word subprograms in SD files, resolved by the file reader.
+ *
+ *   O100          ; Start of subprogram 100
+ *   ...
+ *   M99           ; End of subprogram, return to the caller
+ *
+ *   M98 P100 L3   ; Run subprogram 100 three times
+ *
+ * Calls and returns move the file position, so the queue only ever sees the
+ * body lines. A subprogram met in the main flow is skipped up to its M99, and
+ * an O-word with no M99 after it (a program number) is ignored.
+ *
+ * The bounds of every subprogram are indexed in one pass the first time the
+ * job reaches an O-word or an M98, so a job that uses neither never reads
+ * ahead. Only a file with more than SUBPROGRAM_CACHE_SIZE subprograms is
+ * rescanned for the ones that didn't fit. O-words run from 0 to 99999999.
+ */
+class Subprograms {
+private:
+	static subprogram_entry_t cache[SUBPROGRAM_CACHE_SIZE];
+	static uint8_t cache_count, cache_next;
+	static bool scanned; // The file has been indexed
+	static bool indexed; // Every subprogram in the file is in the cache
+
+	static subprogram_frame_t stack[SUBPROGRAM_DEPTH];
+	static uint8_t depth;
+
+	static void remember(const uint32_t number, const uint32_t sdpos, const uint32_t end_sdpos);
+	static const subprogram_entry_t* find(const uint32_t number);
+	static const subprogram_entry_t* scan(const uint32_t sdpos, const int32_t open, const int32_t number);
+	static const subprogram_entry_t* lookup(const uint32_t number, const uint32_t sdpos, const int32_t open);
+
+	// Skip a leading N line number, as the parser does
+	static const char* skip_line_number(const char* p) {
+		if ((p[0] == 'N' || TERN0(GCODE_CASE_INSENSITIVE, p[0] == 'n')) && NUMERIC_SIGNED(p[1])) {
+			p += 2;
+			while (NUMERIC(*p))
+				p++;
+			while (*p == ' ')
+				p++;
+		}
+
+		return p;
+	}
+
+	static bool is_o_word(const char* const line) {
+		return (line[0] == 'O' || TERN0(GCODE_CASE_INSENSITIVE, line[0] == 'o')) && NUMERIC(line[1]);
+	}
+
+	// The number of an O-word or P word, or -1 past 99999999
+	static int32_t program_number(const char* p) {
+		while (*p == '0')
+			p++;
+
+		int32_t number = 0;
+
+		for (uint8_t digits = 0; NUMERIC(*p); p++) {
+			if (++digits > 8)
+				return -1;
+
+			number = number * 10 + *p - '0';
+		}
+
+		return number;
+	}
+
+	// M98 or M99, as the parser reads it, so a block ends where its M99 runs
+	static bool is_M(const char* const line, const uint8_t code) {
+		return (line[0] == 'M' || TERN0(GCODE_CASE_INSENSITIVE, line[0] == 'm')) && line[1] == '0' + code / 10 && line[2] == '0' + code % 10 && !NUMERIC(line[3]);
+	}
+
+	// The digits of a word after the command, or nullptr without one
+	static const char* find_word(const char* p, const char letter) {
+		for (; *p && *p != ';' && *p != '('; p++) {
+			if ((*p == letter || TERN0(GCODE_CASE_INSENSITIVE, *p == letter + 'a' - 'A')) && NUMERIC(p[1]))
+				return p + 1;
+		}
+
+		return nullptr;
+	}
+
+	static void call(const uint32_t number, const uint16_t count);
+	static void ret();
+
+public:
+	// Forget the last job, the open file is indexed when it first needs it
+	static void reset();
+
+	// Handle O, M98 and M99 lines as they are read. Return true if the line was consumed.
+	static bool early_parse(char* const cmd);
+};
+
+extern Subprograms subprograms;
@@ -44,6 +44,8 @@ using namespace swordfish::status;
  *
  *  None  Home to all axes with no parameters.
  *        With QUICK_HOME enabled XY will home together, then Z.
+ *        With CONCURRENT_HOMING enabled G28.2 references Z, then
+ *        X, Y and A together.
  *
  *  O   Home only if position is unknown
  *
@@ -90,46 +92,84 @@ void GcodeSuite::G28(const int8_t subcode) {
 
 	const bool doZ = doX || doY || doA || forceZ;
 
+	const millis_t start_ms = millis();
+
+	// Moves to a known home are queued so they run on from one to the next,
+	// referencing waits for them since it has to watch the endstops
 	if (doZ) {
 		if (referencing && (!axis_is_trusted(Axis::Z()) || forceZ)) {
 			reference_linear_axis(Axis::Z());
 		} else {
-			do_blocking_move_to_z(MachineState::Homing, home_dir(Axis::Z()) > 0 ? Z_MAX_POS : Z_MIN_POS);
+			do_move_to_z(MachineState::Homing, home_dir(Axis::Z()) > 0 ? Z_MAX_POS : Z_MIN_POS);
+		}
+	}
+
+	// X, Y and A have switches of their own, so they can be referenced together
+	const bool concurrent = referencing && ENABLED(CONCURRENT_HOMING);
+
+#if ENABLED(CONCURRENT_HOMING)
+	if (concurrent) {
+		uint8_t axis_bits = 0;
+
+		if (doA && motionModule.shouldHomeFourth())
+			SBI(axis_bits, Axis::A());
+		if (doY)
+			SBI(axis_bits, Axis::Y());
+		if (doX)
+			SBI(axis_bits, Axis::X());
+
+		if (axis_bits) {
+			planner.synchronize();
+
+			reference_axes(axis_bits);
 		}
 	}
+#endif
 
-	if (doA && motionModule.shouldHomeFourth()) {
+	if (doA && motionModule.shouldHomeFourth() && !concurrent) {
 		if (referencing) {
+			planner.synchronize();
+
 			reference_rotary_axis(Axis::A());
 		} else {
 			debug()("home A");
 
-			do_blocking_move_to_a(MachineState::Homing, 0);
+			do_move_to_a(MachineState::Homing, 0);
 		}
 	}
 
-	if (doY) {
+	if (doY && !concurrent) {
 		if (referencing) {
+			planner.synchronize();
+
 			reference_linear_axis(Axis::Y());
 		} else {
-			do_blocking_move_to_y(MachineState::Homing, home_dir(Axis::Y()) > 0 ? Y_MAX_POS : Y_MIN_POS);
+			do_move_to_y(MachineState::Homing, home_dir(Axis::Y()) > 0 ? Y_MAX_POS : Y_MIN_POS);
 		}
 	}
 
-	if (doX) {
+	if (doX && !concurrent) {
 		if (referencing) {
+			planner.synchronize();
+
 			reference_linear_axis(Axis::X());
 		} else {
-			do_blocking_move_to_x(MachineState::Homing, home_dir(Axis::X()) > 0 ? X_MAX_POS : X_MIN_POS);
+			do_move_to_x(MachineState::Homing, home_dir(Axis::X()) > 0 ? X_MAX_POS : X_MIN_POS);
 		}
 	}
 
+	planner.synchronize();
+
 	sync_plan_position();
 
 	endstops.not_homing();
 
 	restore_feedrate_and_scaling();
 
+	if (referencing) {
+		SERIAL_ECHO_MSG("Homing time: ", millis() - start_ms, "ms");
+	}
+
 	if (toolsModule.isAutomatic()) {
 		// move to X min
 		do_blocking_move_to_x(MachineState::Homing, motionModule.getLimits().getMin().x());
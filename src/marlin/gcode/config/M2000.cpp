@@ -101,6 +101,7 @@ private:
 	Object* _context;
 	std::string_view _objectProperty;
 	int32_t _tableIndex;
+	bool _stored;
 
 	Object* getChild(Object* parent) {
 		if (_tableIndex >= 0) {
@@ -178,13 +179,18 @@ protected:
 		if (_tableIndex >= 0) {
 
 		} else {
-			parent->setValueFromJson(_objectProperty, value);
+			_stored |= parent->setValueFromJson(_objectProperty, value);
 		}
 	}
 
 public:
 	JsonApplicator(Object* context) :
-			_context(context) {
+			_context(context), _stored(false) {
+	}
+
+	// Whether any stored value changed, a reset of the diagnostics doesn't need saving
+	bool stored() const {
+		return _stored;
 	}
 };
 
@@ -214,7 +220,11 @@ void GcodeSuite::M2000(std::function<void(std::function<void(Writer&)>)> writeRe
 
 			applicator.read(parser.parameter_string);
 
-			controller.save();
+			if (op == Operation::Create || applicator.stored()) {
+				controller.save();
+			}
+
+			controller.changed(*object);
 
 			writeResult(nullptr);
 
@@ -239,6 +249,8 @@ void GcodeSuite::M2000(std::function<void(std::function<void(Writer&)>)> writeRe
 
 			controller.save();
 
+			controller.changed(*parent);
+
 			writeResult(nullptr);
 
 			break;
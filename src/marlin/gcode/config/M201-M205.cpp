@@ -93,6 +93,7 @@ void GcodeSuite::M204() {
  *    Z = Max Z Jerk (units/sec^2)
  *    E = Max E Jerk (units/sec^2)
  *    J = Junction Deviation (mm) (If not using CLASSIC_JERK)
+ *    K = S-Curve Jerk Limit (units/sec^3) (0 for none)
  */
 void GcodeSuite::M205() {
 #if HAS_JUNCTION_DEVIATION
@@ -100,12 +101,17 @@ void GcodeSuite::M205() {
 #else
 #	define J_PARAM
 #endif
+#if HAS_S_CURVE_JERK
+#	define K_PARAM "K"
+#else
+#	define K_PARAM
+#endif
 #if HAS_CLASSIC_JERK
 #	define XYZE_PARAM "XYZE"
 #else
 #	define XYZE_PARAM
 #endif
-	if (!parser.seen("BST" J_PARAM XYZE_PARAM))
+	if (!parser.seen("BST" J_PARAM K_PARAM XYZE_PARAM))
 		return;
 
 	// planner.synchronize();
@@ -125,6 +131,15 @@ void GcodeSuite::M205() {
 			SERIAL_ERROR_MSG("?J out of range (0.01 to 0.3)");
 	}
 #endif
+#if HAS_S_CURVE_JERK
+	if (parser.seen('K')) {
+		const float jerk = parser.value_linear_units();
+		if (jerk >= 0)
+			planner.s_curve_jerk = jerk;
+		else
+			SERIAL_ERROR_MSG("?K can't be negative");
+	}
+#endif
 #if HAS_CLASSIC_JERK
 	if (parser.seen('X'))
 		planner.set_max_jerk(X_AXIS, parser.value_linear_units());
@@ -26,6 +26,7 @@
 
 #include "../gcode.h"
 #include "../../MarlinCore.h" // for wait_for_heatup, kill, quickstop_stepper
+#include "../../module/planner.h"
 
 /**
  * M108: Stop the waiting for heaters in M109, M190, M303. Does not affect the target temperature.
@@ -47,8 +48,13 @@ void GcodeSuite::M112() {
  *
  * This will stop the carriages mid-move, so most likely they
  * will be out of sync with the stepper position after this.
+ *
+ * With J, only stop the jog (M2002), slowing down as it would.
  */
 void GcodeSuite::M410() {
+  #if ENABLED(JOGGING)
+    if (parser.seen('J')) return planner.cancel_jog();
+  #endif
   quickstop_stepper();
 }
 
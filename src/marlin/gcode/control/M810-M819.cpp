@@ -28,7 +28,11 @@
 #	include "../queue.h"
 #	include "../parser.h"
 
-char gcode_macros[GCODE_MACROS_SLOTS][GCODE_MACROS_SLOT_SIZE + 1] = { { 0 } };
+#	include <swordfish/Controller.h>
+#	include <swordfish/modules/macros/MacrosModule.h>
+
+using namespace swordfish;
+using namespace swordfish::macros;
 
 /**
  * M810_819: Set/execute a G-code macro.
@@ -42,24 +46,23 @@ void GcodeSuite::M810_819() {
 	if (index >= GCODE_MACROS_SLOTS)
 		return;
 
+	auto& table = MacrosModule::getInstance().getMacros();
+
 	const size_t len = strlen(parser.string_arg);
 
 	if (len) {
-		// Set a macro
-		if (len > GCODE_MACROS_SLOT_SIZE)
-			SERIAL_ERROR_MSG("Macro too long.");
-		else {
-			char c, *s = parser.string_arg, *d = gcode_macros[index];
-			do {
-				c = *s++;
-				*d++ = c == '|' ? '\n' : c;
-			} while (c);
-		}
+		// Set a macro, define() throws if it's too long or has too many commands
+		for (char* s = parser.string_arg; *s; s++)
+			if (*s == '|')
+				*s = '\n';
+
+		if (table.define(index, { parser.string_arg, len }))
+			Controller::getInstance().save();
 	} else {
 		// Execute a macro
-		char* const cmd = gcode_macros[index];
-		if (strlen(cmd))
-			process_subcommands_now(cmd);
+		auto* macro = table.get(index);
+		if (macro)
+			macro->execute();
 	}
 }
 
@@ -67,6 +67,14 @@ extern bool wifi_custom_command(char* const command_ptr);
 #	include "../feature/password/password.h"
 #endif
 
+#if ENABLED(EMERGENCY_PARSER)
+#	include "../feature/e_parser.h"
+#endif
+
+#if ENABLED(LINE_COALESCING)
+#	include "../feature/coalesce.h"
+#endif
+
 #include "../MarlinCore.h" // for idle()
 
 #include "../module/estop.h"
@@ -76,6 +84,10 @@ extern bool wifi_custom_command(char* const command_ptr);
 #include <swordfish/modules/motion/LimitException.h>
 #include <swordfish/modules/estop/EStopException.h>
 
+#if ENABLED(GCODE_COMMAND_STATS)
+#	include <swordfish/modules/diagnostics/DiagnosticsModule.h>
+#endif
+
 using namespace swordfish;
 using namespace swordfish::core;
 using namespace swordfish::estop;
@@ -189,14 +201,19 @@ void GcodeSuite::get_destination_from_command(bool rapid_move) {
 
 	debug()("linear_moves: ", linear_moves, ", radial_moves: ", radial_moves);
 
-	if (!rapid_move && linear_moves > 0 && radial_moves > 0 && parser.feedrate_type != FeedRateType::InverseTime) {
-		throw CommandException("Linear and radial moves can only be combined in G93 mode");
+	// At a rotary radius the planner feeds them together along the surface
+	if (!rapid_move && linear_moves > 0 && radial_moves > 0 && parser.feedrate_type != FeedRateType::InverseTime && !motionModule.getRotaryRadius()) {
+		throw CommandException("Linear and radial moves can only be combined in G93 mode or at a rotary radius");
 	}
 
 	if (parser.feedrate_type == FeedRateType::InverseTime && !parser.seen('F')) {
 		throw CommandException("Expected F parameter while in G93 mode.");
 	}
 
+	// On a rotary A, D1 or D-1 turns an absolute move the given way instead of the shortest
+	const bool rotary_a = motionModule.isRotaryA();
+	const int8_t rotary_direction = rotary_a && parser.seenval('D') ? SIGN(parser.value_int()) : 0;
+
 	// Get new XYZ position, whether absolute or relative
 	for (auto axis : all_axes) {
 
@@ -207,8 +224,12 @@ void GcodeSuite::get_destination_from_command(bool rapid_move) {
 
 			if (skip_move)
 				destination[axis] = current_position[axis];
+			else if (axis_is_relative(axis))
+				destination[axis] = current_position[axis] + v;
+			else if (rotary_a && axis == Axis::A())
+				destination[axis] = rotary_a_target(motionModule.toNative(axis, v), rotary_direction);
 			else
-				destination[axis] = axis_is_relative(axis) ? current_position[axis] + v : motionModule.toNative(axis, v);
+				destination[axis] = motionModule.toNative(axis, v);
 		} else
 			destination[axis] = current_position[axis];
 	}
@@ -328,6 +349,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok /*=false*/) {
 
 	//auto _ = keepalive_state(IN_HANDLER);
 
+#if ENABLED(GCODE_COMMAND_STATS)
+	diagnostics::CommandTimer commandTimer { diagnostics::DiagnosticsModule::getInstance().getCommandStats(), parser.command_letter, parser.codenum, TERN0(USE_GCODE_SUBCODES, parser.subcode) };
+#endif
+
 	auto& out = Console::out();
 
 	auto writeResult = [&](std::function<void(Writer & out)> write) {
@@ -349,6 +374,20 @@ void GcodeSuite::process_parsed_command(const bool no_ok /*=false*/) {
 	};
 
 	try {
+#if ENABLED(LINE_COALESCING)
+		// Only another G0/G1 may extend a held move
+		if (!(parser.command_letter == 'G' && parser.codenum <= 1)) {
+			coalescer.flush();
+		}
+#endif
+
+#if ENABLED(CNC_CANNED_CYCLES)
+		// Any other motion mode ends a canned cycle, just as G80 does
+		if (parser.command_letter == 'G' && parser.is_motion_mode(parser.codenum) && !parser.is_canned_cycle(parser.codenum)) {
+			reset_canned_cycle();
+		}
+#endif
+
 		// Handle a known G, M, or T
 		switch (parser.command_letter) {
 			case 'G':
@@ -376,7 +415,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok /*=false*/) {
 #if ENABLED(BEZIER_CURVE_SUPPORT)
 					case 5:
 						G5();
-						break; // G5: Cubic B_spline
+						break; // G5: Cubic B-spline, G5.1: Quadratic B-spline
 #endif
 
 #if ENABLED(DIRECT_STEPPING)
@@ -539,6 +578,16 @@ void GcodeSuite::process_parsed_command(const bool no_ok /*=false*/) {
 					case 61:
 						G61();
 						break; // G61:  Apply/restore saved coordinates.
+#elif ENABLED(PATH_BLENDING)
+					case 61:
+						G61();
+						break; // G61: Exact path, G61.1: Exact stop
+#endif
+
+#if ENABLED(LINE_COALESCING)
+					case 64:
+						G64();
+						break; // G64: Set the path tolerances
 #endif
 
 #if ENABLED(PROBE_TEMP_COMPENSATION)
@@ -547,6 +596,15 @@ void GcodeSuite::process_parsed_command(const bool no_ok /*=false*/) {
 						break; // G76: Calibrate first layer compensation values
 #endif
 
+#if ENABLED(CNC_CANNED_CYCLES)
+					case 73:
+					case 81:
+					case 82:
+					case 83:
+						G73_G81_G82_G83();
+						break; // G73, G81-G83: Canned drilling cycles
+#endif
+
 #if ENABLED(GCODE_MOTION_MODES)
 					case 80:
 						G80();
@@ -598,6 +656,20 @@ void GcodeSuite::process_parsed_command(const bool no_ok /*=false*/) {
 						break;
 					}
 
+#if ENABLED(CNC_CANNED_CYCLES)
+					case 98:
+					case 99:
+						if (parser.codenum == 98)
+							G98();
+						else
+							G99();
+
+						if (parser.chain()) // Command to chain?
+							process_parsed_command(true);
+
+						break; // G98, G99: Canned cycle retract mode
+#endif
+
 #if HAS_MESH
 					case 42:
 						G42();
@@ -1007,6 +1079,12 @@ void GcodeSuite::process_parsed_command(const bool no_ok /*=false*/) {
 						return;
 					}
 
+#if ENABLED(JOGGING)
+					case 2002:
+						M2002();
+						break; // M2002: Jog
+#endif
+
 					default:
 						parser.unknown_command_warning();
 						break;
@@ -1065,7 +1143,12 @@ void GcodeSuite::process_next_command() {
 	}
 
 	// Parse the next command in the queue
+#if ENABLED(GCODE_PARSE_AHEAD)
+	parser.restore(queue.parsed_command[queue.index_r]);
+	TERN_(GCODE_MOTION_MODES, parser.resolve_motion_mode());
+#else
 	parser.parse(current_command);
+#endif
 	process_parsed_command();
 }
 
@@ -1075,7 +1158,12 @@ void GcodeSuite::process_next_command() {
  */
 
 void GcodeSuite::process_subcommands_now_P(const char* pgcode) {
+#if ENABLED(GCODE_PARSE_AHEAD)
+	parsed_command_t saved_cmd;
+	parser.save(saved_cmd); // Save the parser state
+#else
 	char* const saved_cmd = parser.command_ptr; // Save the parser state
+#endif
 	for (;;) {
 		const char* delim = strchr(pgcode, '\n'); // Get address of next newline
 		const size_t len = delim ? delim - pgcode : strlen(pgcode); // Get the command length
@@ -1088,11 +1176,20 @@ void GcodeSuite::process_subcommands_now_P(const char* pgcode) {
 			break; // Last command?
 		pgcode = delim + 1; // Get the next command
 	}
+#if ENABLED(GCODE_PARSE_AHEAD)
+	parser.restore(saved_cmd); // Restore the parser state
+#else
 	parser.parse(saved_cmd); // Restore the parser state
+#endif
 }
 
 void GcodeSuite::process_subcommands_now(char* gcode) {
+#if ENABLED(GCODE_PARSE_AHEAD)
+	parsed_command_t saved_cmd;
+	parser.save(saved_cmd); // Save the parser state
+#else
 	char* const saved_cmd = parser.command_ptr; // Save the parser state
+#endif
 	for (;;) {
 		char* const delim = strchr(gcode, '\n'); // Get address of next newline
 		if (delim)
@@ -1105,9 +1202,38 @@ void GcodeSuite::process_subcommands_now(char* gcode) {
 			break; // Last command?
 		gcode = delim + 1; // Get the next command
 	}
+#if ENABLED(GCODE_PARSE_AHEAD)
+	parser.restore(saved_cmd); // Restore the parser state
+#else
 	parser.parse(saved_cmd); // Restore the parser state
+#endif
 }
 
+#if ENABLED(GCODE_PARSE_AHEAD)
+
+void GcodeSuite::process_parsed_now(const parsed_command_t* commands, const size_t count) {
+	parsed_command_t saved_cmd;
+	parser.save(saved_cmd); // Save the parser state
+
+	for (size_t i = 0; i < count; i++) {
+		const parsed_command_t& cmd = commands[i];
+
+		// A line with no command letter depends on the motion mode, so it's parsed when it runs
+		if (cmd.command_letter == '?')
+			parser.parse(cmd.command_ptr);
+		else {
+			parser.restore(cmd);
+			TERN_(GCODE_MOTION_MODES, parser.update_motion_mode());
+		}
+
+		process_parsed_command(true); // Process it
+	}
+
+	parser.restore(saved_cmd); // Restore the parser state
+}
+
+#endif // GCODE_PARSE_AHEAD
+
 const char* GcodeSuite::get_state() {
 	auto state = StatusModule::getInstance().peek_state();
 
@@ -1144,6 +1270,10 @@ const char* GcodeSuite::get_state() {
 			return "probing";
 		}
 
+		case MachineState::Jogging: {
+			return "jogging";
+		}
+
 		default: {
 			return "idle";
 		}
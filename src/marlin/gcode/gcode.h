@@ -47,7 +47,7 @@
  * G2   - CW ARC
  * G3   - CCW ARC
  * G4   - Dwell S<seconds> or P<milliseconds>
- * G5   - Cubic B-spline with XYZE destination and IJPQ offsets
+ * G5   - Cubic B-spline with XYZ destination and IJPQ offsets. G5.1: Quadratic with IJ offset.
  * G10  - Retract filament according to settings of M207 (Requires FWRETRACT)
  * G11  - Retract recover filament according to settings of M208 (Requires FWRETRACT)
  * G12  - Clean tool (Requires NOZZLE_CLEAN_FEATURE)
@@ -71,11 +71,19 @@
  * G42  - Coordinated move to a mesh point (Requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BLINEAR, or AUTO_BED_LEVELING_UBL)
  * G60  - Save current position. (Requires SAVED_POSITIONS)
  * G61  - Apply/restore saved coordinates. (Requires SAVED_POSITIONS)
+ *        Exact path / G61.1 exact stop. (Requires PATH_BLENDING)
+ * G64  - Set the path tolerances for fusing G0/G1 moves and blending corners: P<mm> Q<mm> (Requires LINE_COALESCING)
+ * G73  - Chip-breaking peck drilling cycle (Requires CNC_CANNED_CYCLES)
  * G76  - Calibrate first layer temperature offsets. (Requires PROBE_TEMP_COMPENSATION)
  * G80  - Cancel current motion mode (Requires GCODE_MOTION_MODES)
+ * G81  - Drilling cycle (Requires CNC_CANNED_CYCLES)
+ * G82  - Drilling cycle with dwell (Requires CNC_CANNED_CYCLES)
+ * G83  - Peck drilling cycle (Requires CNC_CANNED_CYCLES)
  * G90  - Use Absolute Coordinates
  * G91  - Use Relative Coordinates
  * G92  - Set current position to coordinates given
+ * G98  - Canned cycles retract to the starting Z (Requires CNC_CANNED_CYCLES)
+ * G99  - Canned cycles retract to R (Requires CNC_CANNED_CYCLES)
  *
  * "M" Codes
  *
@@ -213,7 +221,7 @@
  * M405 - Enable Filament Sensor flow control. "M405 D<delay_cm>". (Requires FILAMENT_WIDTH_SENSOR)
  * M406 - Disable Filament Sensor flow control. (Requires FILAMENT_WIDTH_SENSOR)
  * M407 - Display measured filament diameter in millimeters. (Requires FILAMENT_WIDTH_SENSOR)
- * M410 - Quickstop. Abort all planned moves.
+ * M410 - Quickstop. Abort all planned moves. "M410 J" stops a jog instead. (Requires JOGGING)
  * M412 - Enable / Disable Filament Runout Detection. (Requires FILAMENT_RUNOUT_SENSOR)
  * M413 - Enable / Disable Power-Loss Recovery. (Requires POWER_LOSS_RECOVERY)
  * M414 - Set language by index. (Requires LCD_LANGUAGE_2...)
@@ -295,6 +303,7 @@
  * M999 - Restart after being stopped by error
  * M1000 - Modbus
  * M2000 - Enable/disable ATC features.
+ * M2002 - Jog by the given distances. Cancel with "M410 J". (Requires JOGGING)
  * D... - Custom Development G-code. Add hooks to 'gcode_D.cpp' for developers to test features. (Requires MARLIN_DEV_MODE)
  *
  * "T" Codes
@@ -403,6 +412,11 @@ public:
 	static void process_subcommands_now_P(const char* gcode);
 	static void process_subcommands_now(char* gcode);
 
+#if ENABLED(GCODE_PARSE_AHEAD)
+	// Execute already-parsed G-code in-place, preserving current G-code parameters
+	static void process_parsed_now(const parsed_command_t* commands, const size_t count);
+#endif
+
 	static inline void home_all_axes(const bool keep_leveling = false) {
 		extern const char G28_STR[];
 		process_subcommands_now_P(keep_leveling ? G28_STR : TERN(G28_L0_ENSURES_LEVELING_OFF, "G28L0", G28_STR));
@@ -596,10 +610,21 @@ private:
 #if SAVED_POSITIONS
 	static void G60();
 	static void G61();
+#elif ENABLED(PATH_BLENDING)
+	static void G61();
 #endif
 
+	TERN_(LINE_COALESCING, static void G64());
+
 	TERN_(GCODE_MOTION_MODES, static void G80());
 
+#if ENABLED(CNC_CANNED_CYCLES)
+	static void G73_G81_G82_G83();
+	static void G98();
+	static void G99();
+	static void reset_canned_cycle();
+#endif
+
 	static void G92(bool report = true);
 	static void G93();
 	static void G94();
@@ -1019,6 +1044,8 @@ private:
 	static void M2000(std::function<void(std::function<void(swordfish::io::Writer&)>)> writeResult);
 	static void M2001(std::function<void(std::function<void(swordfish::io::Writer&)>)> writeResult);
 
+	TERN_(JOGGING, static void M2002());
+
 	TERN_(MAX7219_GCODE, static void M7219());
 
 	TERN_(CONTROLLER_FAN_EDITABLE, static void M710());
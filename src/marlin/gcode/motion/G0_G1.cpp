@@ -67,10 +67,11 @@ void GcodeSuite::G0_G1(const bool rapid_move/* = false*/) {
 			feedrate_mm_s = rapidrate_mm_s * 0.01f * rapidrate_percentage;
     }
 
-		debug()("accel_mm_s2: ", rapid_move ? planner.settings.travel_acceleration : planner.settings.acceleration);
 		debug()("feed_rate: type=", (i32) feedrate_mm_s.type(), ", value=", feedrate_mm_s.value());
 
-    prepare_line_to_destination(machine_state, rapid_move ? planner.settings.travel_acceleration : planner.settings.acceleration);
+		// The planner takes the acceleration from the machine state's motion profile
+    prepare_line_to_destination(machine_state, 0.0, true);
+    wrap_rotary_a();
 
 		// Restore the motion mode feedrate
     if (rapid_move) {
@@ -47,13 +47,66 @@ using namespace swordfish::status;
 #		define N_ARC_CORRECTION 1
 #	endif
 
+/**
+ * Check a whole arc against the limits before any of it is queued. Its bounding
+ * box takes in both ends and the quadrant points of the circle that it passes.
+ */
+static void throw_if_arc_outside(
+		const Vector6f32& start, // Start position
+		const Vector6f32& end, // End position
+		const Vector2f32& center, // Center of rotation in the plane
+		const float radius,
+		const float start_angle, // Angle of the start position from the center
+		const float angular_travel, // Signed, anything past a full turn covers the whole circle
+		const Axis p_axis,
+		const Axis q_axis) {
+
+	Vector3f32 min, max;
+	LOOP_L_N(i, 3) {
+		min[i] = _MIN(start[i], end[i]);
+		max[i] = _MAX(start[i], end[i]);
+	}
+
+	LOOP_L_N(quadrant, 4) {
+		const float angle = quadrant * RADIANS(90),
+								// How far round the arc the quadrant point is, in its direction of travel
+				along = fmod((angular_travel < 0 ? start_angle - angle : angle - start_angle) + RADIANS(720), RADIANS(360));
+
+		if (along > ABS(angular_travel))
+			continue;
+
+		switch (quadrant) {
+			case 0:
+				NOLESS(max[p_axis], center.x() + radius);
+				break;
+			case 1:
+				NOLESS(max[q_axis], center.y() + radius);
+				break;
+			case 2:
+				NOMORE(min[p_axis], center.x() - radius);
+				break;
+			case 3:
+				NOMORE(min[q_axis], center.y() - radius);
+				break;
+		}
+	}
+
+	auto& limits = MotionModule::getInstance().getLimits();
+
+	limits.throwIfOutside(min);
+	limits.throwIfOutside(max);
+}
+
 /**
  * Plan an arc in 2 dimensions, with optional linear motion in a 3rd dimension
  *
- * The arc is traced by generating many small linear segments, as configured by
- * MM_PER_ARC_SEGMENT (Default 1mm). In the future we hope more slicers will include
- * an option to generate G2/G3 arcs for curved surfaces, as this will allow faster
- * boards to produce much smoother curved surfaces.
+ * With ARC_BLOCKS the planner queues the arc itself, in blocks of up to a quarter turn,
+ * and the stepper follows the circle.
+ *
+ * Otherwise the arc is traced by generating many small linear segments. With
+ * ARC_CHORD_TOLERANCE the segments are as long as the radius allows without straying
+ * further than that from the arc, so large arcs take far fewer planner blocks than small
+ * ones. Otherwise they are MM_PER_ARC_SEGMENT long, or chosen by ARC_SEGMENTS_PER_R / _PER_SEC.
  */
 void plan_arc(
 		const Vector6f32& cart, // Destination position
@@ -61,8 +114,6 @@ void plan_arc(
 		const bool clockwise, // Clockwise?
 		const uint8_t circles // Take the scenic route
 ) {
-	auto& limits = MotionModule::getInstance().getLimits();
-
 	Axis p_axis = Axis::X();
 	Axis q_axis = Axis::Y();
 	Axis l_axis = Axis::Z();
@@ -134,6 +185,17 @@ void plan_arc(
 
 	float linear_travel = cart[l_axis] - start_L;
 
+	// The arc stays inside its bounding box, so the limits need checking only once
+	throw_if_arc_outside(
+			current_position,
+			cart,
+			{ center_P, center_Q },
+			radius,
+			ATAN2(rvec.y(), rvec.x()),
+			(ENABLED(ARC_P_CIRCLES) && circles) ? RADIANS(360) : angular_travel,
+			p_axis,
+			q_axis);
+
 	// If circling around...
 	if (ENABLED(ARC_P_CIRCLES) && circles) {
 		const float total_angular = angular_travel + circles * RADIANS(360), // Total rotation with all circles and remainder
@@ -156,19 +218,35 @@ void plan_arc(
 	//const FeedRate scaled_feed_rate = MMS_SCALED(feedrate_mm_s);
 	const FeedRate scaled_feed_rate = feedrate_mm_s;
 
+#	if ENABLED(ARC_BLOCKS)
+	// The planner queues the arc itself and the stepper follows the circle
+	planner.buffer_arc(current_position, cart, { center_P, center_Q }, angular_travel, p_axis, q_axis, scaled_feed_rate, active_extruder, MachineState::FeedMove);
+	current_position = cart;
+	UNUSED(min_segments);
+#	else
+#		ifdef ARC_CHORD_TOLERANCE
+	// The longest chord whose sagitta is within the tolerance. Arc length per chord is
+	// a little more, so sizing the segments along the arc keeps them within it.
+	float seg_length = radius > (ARC_CHORD_TOLERANCE)
+	                             ? _MAX(2 * SQRT((ARC_CHORD_TOLERANCE) * (2 * radius - (ARC_CHORD_TOLERANCE))), float(MM_PER_ARC_SEGMENT))
+	                             : float(MM_PER_ARC_SEGMENT);
+	uint16_t segments = _MIN(CEIL(ABS(flat_mm) / seg_length), float(UINT16_MAX));
+#		else
 	// Start with a nominal segment length
 	float seg_length = (
-#	ifdef ARC_SEGMENTS_PER_R
+#			ifdef ARC_SEGMENTS_PER_R
 			constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
-#	elif ARC_SEGMENTS_PER_SEC
+#			elif ARC_SEGMENTS_PER_SEC
 			_MAX(scaled_feed_rate * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
-#	else
+#			else
 			MM_PER_ARC_SEGMENT
-#	endif
+#			endif
 	);
 	// Divide total travel by nominal segment length
 	uint16_t segments = FLOOR(mm_of_travel / seg_length);
+#		endif
 	NOLESS(segments, min_segments); // At least some segments
+	NOLESS(segments, uint16_t(1));
 	seg_length = mm_of_travel / segments;
 
 	/**
@@ -209,15 +287,15 @@ void plan_arc(
 	// Initialize the linear axis
 	raw[l_axis] = current_position[l_axis];
 
-#	if ENABLED(SCARA_FEEDRATE_SCALING)
+#		if ENABLED(SCARA_FEEDRATE_SCALING)
 	const float inv_duration = scaled_fr_mm_s / seg_length;
-#	endif
+#		endif
 
 	millis_t next_idle_ms = millis() + 200UL;
 
-#	if N_ARC_CORRECTION > 1
+#		if N_ARC_CORRECTION > 1
 	int8_t arc_recalc_count = N_ARC_CORRECTION;
-#	endif
+#		endif
 
 	for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
 
@@ -227,18 +305,18 @@ void plan_arc(
 			idle();
 		}
 
-#	if N_ARC_CORRECTION > 1
+#		if N_ARC_CORRECTION > 1
 		if (--arc_recalc_count) {
 			// Apply vector rotation matrix to previous rvec.a / 1
 			const float r_new_Y = rvec.x() * sin_T + rvec.y() * cos_T;
 			rvec.x() = rvec.x() * cos_T - rvec.y() * sin_T;
 			rvec.y() = r_new_Y;
 		} else
-#	endif
+#		endif
 		{
-#	if N_ARC_CORRECTION > 1
+#		if N_ARC_CORRECTION > 1
 			arc_recalc_count = N_ARC_CORRECTION;
-#	endif
+#		endif
 
 			// Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
 			// Compute exact location by applying transformation matrix from initial radius vector(=-offset).
@@ -254,20 +332,17 @@ void plan_arc(
 		raw[q_axis] = center_Q + rvec.y();
 		raw[l_axis] += linear_per_segment;
 
-		Vector3f32 raw3f { raw.x(), raw.y(), raw.z() };
-
-		limits.throwIfOutside(raw3f);
 		gcode.throwIfAborted();
 
-#	if HAS_LEVELING && !PLANNER_LEVELING
+#		if HAS_LEVELING && !PLANNER_LEVELING
 		planner.apply_leveling(raw);
-#	endif
+#		endif
 
 		if (!planner.buffer_line(raw, scaled_feed_rate, active_extruder, MachineState::FeedMove, 0
-#	if ENABLED(SCARA_FEEDRATE_SCALING)
+#		if ENABLED(SCARA_FEEDRATE_SCALING)
 		                         ,
 		                         inv_duration
-#	endif
+#		endif
 		                         ))
 			break;
 	}
@@ -276,19 +351,16 @@ void plan_arc(
 	raw = cart;
 	TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = start_L);
 
-	Vector3f32 raw3f { raw.x(), raw.y(), raw.z() };
-
-	limits.throwIfOutside(raw3f);
-
 	planner.buffer_line(raw, scaled_feed_rate, active_extruder, MachineState::FeedMove, 0
-#	if ENABLED(SCARA_FEEDRATE_SCALING)
+#		if ENABLED(SCARA_FEEDRATE_SCALING)
 	                    ,
 	                    inv_duration
-#	endif
+#		endif
 	);
 
 	TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = start_L);
 	current_position = raw;
+#	endif
 
 } // plan_arc
 
@@ -388,6 +460,7 @@ void GcodeSuite::G2_G3(const bool clockwise) {
 
 			// Send the arc to the planner
 			plan_arc(destination, arc_offset, clockwise, circles_to_do);
+			wrap_rotary_a();
 			reset_stepper_timeout();
 		} else
 			SERIAL_ERROR_MSG(STR_ERR_ARC_ARGS);
@@ -27,6 +27,8 @@
 #include "../../module/motion.h"
 #include "../../module/planner_bezier.h"
 
+using namespace swordfish::math;
+
 /**
  * Parameters interpreted according to:
  * https://linuxcnc.org/docs/2.7/html/gcode/g-code.html#gcode:g5
@@ -39,6 +41,15 @@
 
 /**
  * G5: Cubic B-spline
+ *
+ *  I J - Offset from the start to the first control point
+ *  P Q - Offset from the end to the second control point
+ *
+ * G5.1: Quadratic B-spline
+ *
+ *  I J - Offset from the start to the control point
+ *
+ * A quadratic is queued as the cubic that traces the same curve.
  */
 void GcodeSuite::G5() {
   if (MOTION_CONDITIONS) {
@@ -50,15 +61,26 @@ void GcodeSuite::G5() {
       }
     #endif
 
-    get_destination_from_command();
+    get_destination_from_command(false);
+
+    const Vector2f32 start = { current_position.x(), current_position.y() },
+                     end = { destination.x(), destination.y() },
+                     first = { parser.linearval('I'), parser.linearval('J') };
+
+    Vector2f32 offsets[2];
 
-    const xy_pos_t offsets[2] = {
-      { parser.linearval('I'), parser.linearval('J') },
-      { parser.linearval('P'), parser.linearval('Q') }
-    };
+    if (parser.subcode == 1) {
+      // The cubic's control points are two thirds of the way from each end to the quadratic's
+      offsets[0] = first * (2.0f / 3.0f);
+      offsets[1] = (start + first - end) * (2.0f / 3.0f);
+    } else {
+      offsets[0] = first;
+      offsets[1] = { parser.linearval('P'), parser.linearval('Q') };
+    }
 
-    cubic_b_spline(current_position, destination, offsets, MMS_SCALED(feedrate_mm_s), active_extruder);
+    cubic_b_spline(current_position, destination, offsets, feedrate_mm_s, active_extruder);
     current_position = destination;
+    wrap_rotary_a();
   }
 }
 
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LINE_COALESCING)
+
+#	include "../gcode.h"
+#	include "../../feature/coalesce.h"
+
+#	if ENABLED(PATH_BLENDING)
+
+#		include "../../module/planner.h"
+
+/**
+ * G61: Follow the programmed path exactly
+ *
+ *  G61   - Exact path. Corners are neither blended nor fused away.
+ *  G61.1 - Exact stop. Also come to rest at the end of every move.
+ *
+ * The machine starts in G61. G64 turns blending on.
+ */
+void GcodeSuite::G61() {
+	coalescer.tolerance = 0;
+	coalescer.blend_tolerance = 0;
+	planner.exact_stop = parser.subcode == 1;
+}
+
+#	endif
+
+/**
+ * G64: Set the path tolerances
+ *
+ * With PATH_BLENDING:
+ *  P - Distance allowed between a corner and its blend. P0 stops blending.
+ *  Q - Deviation allowed from a fused line. Q0 stops fusing. Defaults to P.
+ *
+ * Without PATH_BLENDING:
+ *  P - Deviation allowed from a fused line. P0 turns coalescing off.
+ *
+ * Without P or Q the default tolerances are used.
+ */
+void GcodeSuite::G64() {
+#	if ENABLED(PATH_BLENDING)
+	planner.exact_stop = false;
+
+	coalescer.blend_tolerance = parser.seenval('P') ? ABS(parser.value_linear_units()) : float32_t(PATH_BLEND_TOLERANCE);
+
+	if (parser.seenval('Q')) {
+		coalescer.tolerance = ABS(parser.value_linear_units());
+	} else {
+		coalescer.tolerance = parser.seen('P') ? coalescer.blend_tolerance : float32_t(LINE_COALESCE_TOLERANCE);
+	}
+#	else
+	coalescer.tolerance = parser.seenval('P') ? ABS(parser.value_linear_units()) : float32_t(LINE_COALESCE_TOLERANCE);
+#	endif
+}
+
+#endif // LINE_COALESCING
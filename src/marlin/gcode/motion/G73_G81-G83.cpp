@@ -0,0 +1,237 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(CNC_CANNED_CYCLES)
+
+#	include <swordfish/Controller.h>
+
+using namespace swordfish;
+using namespace swordfish::motion;
+using namespace swordfish::status;
+
+#	include "../gcode.h"
+#	include "../../module/motion.h"
+#	include "../../module/planner.h"
+
+#	include "../../MarlinCore.h"
+
+extern FeedRate rapidrate_mm_s;
+extern int16_t rapidrate_percentage;
+
+namespace {
+	// Sticky cycle words, kept until G80 or another motion mode. Heights are native Z positions.
+	struct {
+		float32_t initial = NAN; // Initial level, the Z where the cycle was first commanded (G98)
+		float32_t r = NAN; // Retract plane
+		float32_t z = NAN; // Bottom of the hole
+		float32_t q = 0; // Peck depth (mm)
+		millis_t p = 0; // Dwell at the bottom (G82)
+	} cycle;
+
+	bool retract_to_r = false; // G99, otherwise G98
+
+	void cycle_move(const bool rapid) {
+		if (destination == current_position)
+			return;
+
+		if (rapid) {
+			FeedRate old_feedrate = feedrate_mm_s;
+
+			feedrate_mm_s = rapidrate_mm_s * 0.01f * rapidrate_percentage;
+
+			prepare_line_to_destination(MachineState::RapidMove);
+
+			feedrate_mm_s = old_feedrate;
+		} else {
+			prepare_line_to_destination(MachineState::FeedMove);
+		}
+	}
+
+	void cycle_move_z(const float32_t z, const bool rapid) {
+		destination = current_position;
+		destination.z() = z;
+
+		cycle_move(rapid);
+	}
+} // namespace
+
+void GcodeSuite::reset_canned_cycle() {
+	cycle = {};
+}
+
+/**
+ * G73, G81, G82, G83: Canned drilling cycles in the XY plane
+ *
+ *  X Y - Hole position. Further X Y words drill more holes until G80.
+ *  Z   - Bottom of the hole. Relative to R in G91.
+ *  R   - Retract plane. Relative to the initial level in G91.
+ *  Q   - Peck depth (G73, G83)
+ *  P   - Dwell at the bottom in milliseconds (G82)
+ *  F   - Feed rate of the drilling moves
+ *
+ *  G81 - Feed to Z, then rapid out
+ *  G82 - Feed to Z, dwell P, then rapid out
+ *  G83 - Peck by Q, rapid out to R after each peck, then rapid back down to just above the last peck
+ *  G73 - Peck by Q, back off CANNED_CYCLE_CHIP_BREAK after each peck to break the chip
+ *
+ * The tool retracts to the initial level (G98) or to R (G99) after each hole.
+ * The initial level is the Z where the cycle was first commanded, and holds
+ * until G80 or another motion mode.
+ *
+ * Every move goes straight into the planner, and the G82 dwell is a planner
+ * dwell block, so nothing here waits for the machine.
+ */
+void GcodeSuite::G73_G81_G82_G83() {
+	if (!IsRunning()
+#	if ENABLED(NO_MOTION_BEFORE_HOMING)
+	    || homing_needed_error(_BV(X_AXIS) | _BV(Y_AXIS) | _BV(Z_AXIS))
+#	endif
+	) {
+		return;
+	}
+
+	if (parser.feedrate_type == FeedRateType::InverseTime) {
+		throw CommandException("Canned cycles cannot be used in G93 mode");
+	}
+
+	auto& motionModule = MotionModule::getInstance();
+	const auto codenum = parser.codenum;
+	const bool relative = axis_is_relative(Axis::Z());
+
+	if (isnan(cycle.initial)) {
+		cycle.initial = current_position.z();
+	}
+
+	if (parser.seenval('R')) {
+		const float32_t r = parser.value_axis_units(Axis::Z());
+
+		cycle.r = relative ? cycle.initial + r : motionModule.toNative(Axis::Z(), r);
+	}
+
+	if (isnan(cycle.r)) {
+		throw CommandException("Expected R parameter");
+	}
+
+	if (parser.seenval('Z')) {
+		const float32_t z = parser.value_axis_units(Axis::Z());
+
+		cycle.z = relative ? cycle.r + z : motionModule.toNative(Axis::Z(), z);
+	}
+
+	if (isnan(cycle.z)) {
+		throw CommandException("Expected Z parameter");
+	}
+
+	if (cycle.z > cycle.r) {
+		throw CommandException("Z must not be above R");
+	}
+
+	if (parser.seenval('Q')) {
+		cycle.q = ABS(parser.value_linear_units());
+	}
+
+	if ((codenum == 73 || codenum == 83) && cycle.q <= 0) {
+		throw CommandException("Expected Q parameter");
+	}
+
+	if (parser.seenval('P')) {
+		cycle.p = parser.value_millis();
+	}
+
+	// Get X Y (and F), the hole depth is handled here
+	get_destination_from_command(false);
+
+	destination.z() = current_position.z();
+
+	const auto hole = destination;
+	const float32_t retract_z = retract_to_r ? cycle.r : _MAX(cycle.initial, cycle.r);
+
+	// Clear the retract plane before moving over the hole
+	if (current_position.z() < cycle.r) {
+		cycle_move_z(cycle.r, true);
+	}
+
+	destination = hole;
+	destination.z() = current_position.z();
+	cycle_move(true);
+
+	cycle_move_z(cycle.r, true);
+
+	switch (codenum) {
+		case 81:
+			cycle_move_z(cycle.z, false);
+			break;
+
+		case 82:
+			cycle_move_z(cycle.z, false);
+			planner.buffer_dwell_block(cycle.p, MachineState::FeedMove);
+			break;
+
+		case 83:
+			for (float32_t depth = cycle.r; depth > cycle.z;) {
+				if (depth < cycle.r) {
+					cycle_move_z(_MIN(depth + CANNED_CYCLE_PECK_CLEARANCE, cycle.r), true);
+				}
+
+				depth = _MAX(depth - cycle.q, cycle.z);
+
+				cycle_move_z(depth, false);
+
+				if (depth > cycle.z) {
+					cycle_move_z(cycle.r, true);
+				}
+			}
+			break;
+
+		case 73:
+			for (float32_t depth = cycle.r; depth > cycle.z;) {
+				depth = _MAX(depth - cycle.q, cycle.z);
+
+				cycle_move_z(depth, false);
+
+				if (depth > cycle.z) {
+					cycle_move_z(_MIN(depth + CANNED_CYCLE_CHIP_BREAK, cycle.r), true);
+				}
+			}
+			break;
+	}
+
+	cycle_move_z(retract_z, true);
+}
+
+/**
+ * G98: Retract to the initial level after each canned cycle hole
+ */
+void GcodeSuite::G98() {
+	retract_to_r = false;
+}
+
+/**
+ * G99: Retract to R after each canned cycle hole
+ */
+void GcodeSuite::G99() {
+	retract_to_r = true;
+}
+
+#endif // CNC_CANNED_CYCLES
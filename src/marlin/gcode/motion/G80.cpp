@@ -33,6 +33,8 @@ void GcodeSuite::G80() {
 
   parser.cancel_motion_mode();
 
+  TERN_(CNC_CANNED_CYCLES, reset_canned_cycle());
+
 }
 
 #endif // GCODE_MOTION_MODES
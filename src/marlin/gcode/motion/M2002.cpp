@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(JOGGING)
+
+#include <swordfish/modules/gcode/CommandException.h>
+#include <swordfish/modules/motion/MotionModule.h>
+
+#include "../gcode.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../MarlinCore.h" // for idle()
+
+using namespace swordfish;
+using namespace swordfish::math;
+using namespace swordfish::motion;
+using namespace swordfish::status;
+
+/**
+ * M2002: Jog
+ *
+ *  X Y Z - Distance to jog along each axis
+ *  F     - Feed rate (units/min)
+ *
+ * The target is clamped to the soft limits. The jog is queued as segments of
+ * JOG_SEGMENT_MS, waiting for room between them, and stops being queued as
+ * soon as M410 J cancels it.
+ */
+void GcodeSuite::M2002() {
+	const float32_t feed_rate = MMM_TO_MMS(parser.linearval('F'));
+
+	if (feed_rate <= 0) {
+		throw CommandException("Expected F parameter.");
+	}
+
+	const Vector3f32 start = { current_position.x(), current_position.y(), current_position.z() };
+	Vector3f32 target = start;
+
+	for (auto axis : linear_axes) {
+		if (parser.seenval(axis.to_char())) {
+			target[axis] += parser.value_axis_units(axis);
+		}
+	}
+
+	MotionModule::getInstance().getLimits().clamp(target);
+
+	const Vector3f32 travel = target - start;
+	const float32_t length = travel.norm();
+
+	if (length == 0) {
+		return;
+	}
+
+	const uint32_t segments = _MAX(1, CEIL(length * 1000.0f / (feed_rate * (JOG_SEGMENT_MS))));
+	const float32_t segment_length = length / segments;
+
+	planner.jog_cancelled = false;
+
+	for (uint32_t i = 1; i <= segments; i++) {
+		// Wait for room here rather than in the planner, so a cancel while
+		// waiting doesn't let another segment in
+		while (planner.is_full() && !planner.jog_cancelled) {
+			idle();
+		}
+
+		if (planner.jog_cancelled) {
+			break;
+		}
+
+		const Vector3f32 position = i == segments ? target : Vector3f32(start + travel * (float32_t(i) / segments));
+
+		current_position.x() = position.x();
+		current_position.y() = position.y();
+		current_position.z() = position.z();
+
+		planner.buffer_line(current_position, FeedRate::UnitsPerSecond(feed_rate), active_extruder, MachineState::Jogging, segment_length);
+	}
+}
+
+#endif // JOGGING
@@ -63,12 +63,23 @@ int16_t GCodeParser::motion_mode_codenum = -1;
 #	if ENABLED(USE_GCODE_SUBCODES)
 uint8_t GCodeParser::motion_mode_subcode;
 #	endif
+#	if ENABLED(GCODE_PARSE_AHEAD)
+int16_t GCodeParser::queued_motion_mode_codenum = -1;
+#		if ENABLED(USE_GCODE_SUBCODES)
+uint8_t GCodeParser::queued_motion_mode_subcode;
+#		endif
+#	endif
 #endif
 
 #if ENABLED(FASTER_GCODE_PARSER)
 // Optimized Parameters
 uint32_t GCodeParser::codebits; // found bits
 uint8_t GCodeParser::param[26]; // parameter offsets from command_ptr
+#	if ENABLED(GCODE_PARSE_AHEAD)
+uint32_t GCodeParser::valuebits; // decoded bits
+uint8_t GCodeParser::value_index; // index of the last seen parameter
+float GCodeParser::values[26]; // decoded parameter values
+#	endif
 #else
 char* GCodeParser::command_args; // start of parameters
 #endif
@@ -93,6 +104,7 @@ void GCodeParser::reset() {
 	TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
 #if ENABLED(FASTER_GCODE_PARSER)
 	codebits = 0; // No codes yet
+	TERN_(GCODE_PARSE_AHEAD, valuebits = 0); // No decoded values yet
 	// ZERO(param);                      // No parameters (should be safe to comment out this line)
 #endif
 }
@@ -233,24 +245,14 @@ void GCodeParser::parse(char* p) {
 			while (*p == ' ')
 				p++;
 
-#if ENABLED(GCODE_MOTION_MODES)
-			if (letter == 'G' && (codenum <= TERN(ARC_SUPPORT, 3, 1) || codenum == 5 || TERN0(G38_PROBE_TARGET, codenum == 38))) {
-				motion_mode_codenum = codenum;
-				TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
-			}
-#endif
+			TERN_(GCODE_MOTION_MODES, update_motion_mode());
 
 			break;
 
 #if ENABLED(GCODE_MOTION_MODES)
-#	if ENABLED(ARC_SUPPORT)
 		case 'I' ... 'J':
-		case 'R':
-			if (motion_mode_codenum != 2 && motion_mode_codenum != 3)
-				return;
-#	endif
-		case 'P' ... 'Q':
-			if (motion_mode_codenum != 5)
+		case 'P' ... 'R':
+			if (!motion_mode_accepts(letter))
 				return;
 		case 'X' ... 'Z':
 		case 'E' ... 'F':
@@ -326,7 +328,7 @@ void GCodeParser::parse(char* p) {
 
 			selector_string = { p, end ? end - p : strlen(p) };
 
-			p = end;
+			p = end ? end : p + strlen(p);
 		}
 
 		if (param == '>' && is_command('M', 2000)) {
@@ -334,7 +336,7 @@ void GCodeParser::parse(char* p) {
 
 			parameter_string = { p, end ? end - p : strlen(p) };
 
-			p = end;
+			p = end ? end : p + strlen(p);
 		}
 
 		if (param == '#') {
@@ -342,7 +344,7 @@ void GCodeParser::parse(char* p) {
 
 			id_string = { p, end ? end - p : strlen(p) };
 
-			p = end;
+			p = end ? end : p + strlen(p);
 		}
 
 #if ENABLED(GCODE_QUOTED_STRINGS)
@@ -411,6 +413,65 @@ void GCodeParser::parse(char* p) {
 	}
 }
 
+#if ENABLED(GCODE_MOTION_MODES)
+
+// Remember the motion mode set by the current command, if any
+void GCodeParser::update_motion_mode() {
+	if (command_letter != 'G')
+		return;
+
+	if (is_motion_mode(codenum)) {
+		motion_mode_codenum = codenum;
+		TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+	}
+#	if ENABLED(GCODE_PARSE_AHEAD)
+	// Lines are parsed when queued, so G80 must cancel the mode for the lines queued after it
+	else if (codenum == 80)
+		cancel_motion_mode();
+#	endif
+}
+
+#	if ENABLED(GCODE_PARSE_AHEAD)
+
+void GCodeParser::swap_motion_mode() {
+	std::swap(motion_mode_codenum, queued_motion_mode_codenum);
+	TERN_(USE_GCODE_SUBCODES, std::swap(motion_mode_subcode, queued_motion_mode_subcode));
+}
+
+void GCodeParser::resolve_motion_mode() {
+	// A line without its own G word took the motion mode queued before it,
+	// which chained, macro or sub-commands may have changed since.
+	const bool modal = command_letter == '?' || (command_letter == 'G' && command_ptr && *command_ptr != 'G' && *command_ptr != 'g');
+
+	if (modal && (command_letter == '?' || motion_mode_codenum != int16_t(codenum) || TERN0(USE_GCODE_SUBCODES, motion_mode_subcode != subcode))) {
+		parse(command_ptr);
+		decode_values();
+	} else
+		update_motion_mode();
+}
+
+#	endif
+
+bool GCodeParser::motion_mode_accepts(const char letter) {
+	switch (motion_mode_codenum) {
+#	if ENABLED(ARC_SUPPORT)
+		case 2 ... 3:
+			return letter == 'I' || letter == 'J' || letter == 'R';
+#	endif
+		case 5:
+			return letter != 'R';
+#	if ENABLED(CNC_CANNED_CYCLES)
+		case 73:
+		case 81 ... 83:
+			return letter != 'I' && letter != 'J';
+#	endif
+		default:
+			return false;
+	}
+}
+
+#endif // GCODE_MOTION_MODES
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
 // Parse the next parameter as a new command
@@ -435,6 +496,69 @@ bool GCodeParser::chain() {
 
 #endif // CNC_COORDINATE_SYSTEMS
 
+#if ENABLED(GCODE_PARSE_AHEAD)
+
+void GCodeParser::decode_values() {
+	valuebits = 0;
+
+	for (uint8_t ind = 0; ind < COUNT(param); ind++) {
+		if (TEST32(codebits, ind) && param[ind]) {
+			value_ptr = command_ptr + param[ind];
+			value_index = ind; // Not decoded yet, so value_float() reads the text
+			values[ind] = value_float();
+			SBI32(valuebits, ind);
+		}
+	}
+
+	value_ptr = nullptr;
+}
+
+void GCodeParser::save(parsed_command_t& cmd) {
+	cmd.command_ptr = command_ptr;
+	cmd.string_arg = string_arg;
+	cmd.value_ptr = value_ptr;
+	cmd.selector_string = selector_string;
+	cmd.parameter_string = parameter_string;
+	cmd.id_string = id_string;
+	cmd.command_letter = command_letter;
+	cmd.codenum = codenum;
+	TERN_(USE_GCODE_SUBCODES, cmd.subcode = subcode);
+	cmd.codebits = codebits;
+	cmd.valuebits = valuebits;
+	cmd.value_index = value_index;
+
+	COPY(cmd.param, param);
+
+	for (uint8_t ind = 0; ind < COUNT(values); ind++) {
+		if (TEST32(valuebits, ind))
+			cmd.values[ind] = values[ind];
+	}
+}
+
+void GCodeParser::restore(const parsed_command_t& cmd) {
+	command_ptr = cmd.command_ptr;
+	string_arg = cmd.string_arg;
+	value_ptr = cmd.value_ptr;
+	selector_string = cmd.selector_string;
+	parameter_string = cmd.parameter_string;
+	id_string = cmd.id_string;
+	command_letter = cmd.command_letter;
+	codenum = cmd.codenum;
+	TERN_(USE_GCODE_SUBCODES, subcode = cmd.subcode);
+	codebits = cmd.codebits;
+	valuebits = cmd.valuebits;
+	value_index = cmd.value_index;
+
+	COPY(param, cmd.param);
+
+	for (uint8_t ind = 0; ind < COUNT(values); ind++) {
+		if (TEST32(valuebits, ind))
+			values[ind] = cmd.values[ind];
+	}
+}
+
+#endif // GCODE_PARSE_AHEAD
+
 void GCodeParser::unknown_command_warning() {
 	SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
@@ -51,6 +51,34 @@ typedef enum : uint8_t { LINEARUNIT_MM,
 	                       LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#if ENABLED(GCODE_PARSE_AHEAD)
+/**
+ * The complete result of parsing one line. Pointers refer into the parsed
+ * line, so the line must stay in place for as long as the record is used.
+ */
+typedef struct {
+	char* command_ptr;
+	char* string_arg;
+	char* value_ptr;
+
+	std::string_view selector_string;
+	std::string_view parameter_string;
+	std::string_view id_string;
+
+	char command_letter;
+	uint16_t codenum;
+#	if ENABLED(USE_GCODE_SUBCODES)
+	uint8_t subcode;
+#	endif
+
+	uint32_t codebits;
+	uint32_t valuebits;
+	uint8_t value_index;
+	uint8_t param[26];
+	float values[26];
+} parsed_command_t;
+#endif
+
 /**
  * GCode parser
  *
@@ -71,6 +99,11 @@ private:
 #if ENABLED(FASTER_GCODE_PARSER)
 	static uint32_t codebits; // Parameters pre-scanned
 	static uint8_t param[26]; // For A-Z, offsets into command args
+#	if ENABLED(GCODE_PARSE_AHEAD)
+	static uint32_t valuebits; // Parameters with a pre-decoded value
+	static uint8_t value_index; // Set by seen, selects the pre-decoded value
+	static float values[26]; // For A-Z, pre-decoded values
+#	endif
 #else
 	static char* command_args; // Args start here, for slow scan
 #endif
@@ -111,6 +144,36 @@ public:
 	FORCE_INLINE static void cancel_motion_mode() {
 		motion_mode_codenum = -1;
 	}
+
+	// Remember the motion mode set by the current command, if any
+	static void update_motion_mode();
+
+	// Whether a line starting with this word continues the motion mode
+	static bool motion_mode_accepts(const char letter);
+
+#	if ENABLED(GCODE_PARSE_AHEAD)
+	// Lines are parsed when queued, ahead of the commands that run before them,
+	// so the queue keeps its own motion mode apart from the one in effect.
+	static int16_t queued_motion_mode_codenum;
+#		if ENABLED(USE_GCODE_SUBCODES)
+	static uint8_t queued_motion_mode_subcode;
+#		endif
+	static void swap_motion_mode();
+
+	// Re-parse a restored line that continues a different motion mode
+	static void resolve_motion_mode();
+#	endif
+
+#	if ENABLED(CNC_CANNED_CYCLES)
+	static constexpr bool is_canned_cycle(const uint16_t code) {
+		return code == 73 || WITHIN(code, 81, 83);
+	}
+#	endif
+
+	// Whether this G-code sets the motion mode
+	static constexpr bool is_motion_mode(const uint16_t code) {
+		return code <= TERN(ARC_SUPPORT, 3, 1) || code == 5 || TERN0(G38_PROBE_TARGET, code == 38) || TERN0(CNC_CANNED_CYCLES, is_canned_cycle(code));
+	}
 #endif
 
 #if ENABLED(DEBUG_GCODE_PARSER)
@@ -164,6 +227,7 @@ public:
 			return false; // Only A-Z
 		const bool b = TEST32(codebits, ind);
 		if (b) {
+			TERN_(GCODE_PARSE_AHEAD, value_index = ind);
 			if (param[ind]) {
 				char* ptr = command_ptr + param[ind];
 				// value_ptr = valid_number(ptr) ? ptr : nullptr;
@@ -286,6 +350,15 @@ public:
 	static bool chain();
 #endif
 
+#if ENABLED(GCODE_PARSE_AHEAD)
+	// Decode all parameter values up front so value_float() is a lookup
+	static void decode_values();
+
+	// Capture and reinstate the complete parser state
+	static void save(parsed_command_t& cmd);
+	static void restore(const parsed_command_t& cmd);
+#endif
+
 	// Test whether the parsed command matches the input
 	static inline bool is_command(const char ltr, const uint16_t num) {
 		return command_letter == ltr && codenum == num;
@@ -308,6 +381,10 @@ public:
 
 	// Float removes 'E' to prevent scientific notation interpretation
 	static float value_float() {
+#if ENABLED(GCODE_PARSE_AHEAD)
+		if (value_ptr && TEST32(valuebits, value_index))
+			return values[value_index];
+#endif
 		if (value_ptr) {
 			char* e = value_ptr;
 			for (;;) {
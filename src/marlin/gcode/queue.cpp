@@ -53,9 +53,21 @@ GCodeQueue queue;
 #	include "../feature/repeat.h"
 #endif
 
+#if ENABLED(GCODE_SUBPROGRAMS)
+#	include "../feature/subprogram.h"
+#endif
+
+#if ENABLED(LINE_COALESCING)
+#	include "../feature/coalesce.h"
+#endif
+
 #include <swordfish/modules/estop/EStopException.h>
 #include <swordfish/modules/motion/LimitException.h>
 
+#if ENABLED(GCODE_COMMAND_STATS)
+#	include <swordfish/modules/diagnostics/DiagnosticsModule.h>
+#endif
+
 using namespace swordfish;
 using namespace swordfish::estop;
 using namespace swordfish::motion;
@@ -82,6 +94,10 @@ uint8_t GCodeQueue::length = 0, // Count of commands in the queue
 
 char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
 
+#if ENABLED(GCODE_PARSE_AHEAD)
+parsed_command_t GCodeQueue::parsed_command[BUFSIZE];
+#endif
+
 /*
  * The port that the command was received on
  */
@@ -142,6 +158,27 @@ void GCodeQueue::_commit_command(bool say_ok
                                  int16_t p /*=-1*/
 #endif
 ) {
+#if ENABLED(GCODE_PARSE_AHEAD)
+	// Commands are committed from idle(), possibly while another command
+	// is mid-execution, so keep the parser state that command relies on.
+	parsed_command_t active;
+	parser.save(active);
+	TERN_(GCODE_MOTION_MODES, parser.swap_motion_mode());
+	parser.parse(command_buffer[index_w]);
+	parser.decode_values();
+	parser.save(parsed_command[index_w]);
+#	if BOTH(GCODE_MOTION_MODES, CNC_COORDINATE_SYSTEMS)
+	// A command chained after a modal G-code (e.g. "G90 G1 X10") sets the
+	// motion mode for the lines after it, so follow the chain here as well.
+	if (parser.command_letter == 'G' && parser.motion_mode_codenum != int16_t(parser.codenum)) {
+		while (parser.chain()) {
+		}
+	}
+#	endif
+	TERN_(GCODE_MOTION_MODES, parser.swap_motion_mode());
+	parser.restore(active);
+#endif
+
 	send_ok[index_w] = say_ok;
 	TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
 	TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
@@ -704,7 +741,8 @@ inline void GCodeQueue::get_sdcard_commands() {
 			// Reset stream state, terminate the buffer, and commit a non-empty command
 			if (!is_eol && sd_count)
 				++sd_count; // End of file with no newline
-			if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+			if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)
+			    && !TERN0(GCODE_SUBPROGRAMS, subprograms.early_parse(command_buffer[index_w]))) {
 
 				// M808 S saves the sdpos of the next line. M808 loops to a new sdpos.
 				TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command_buffer[index_w]));
@@ -747,8 +785,14 @@ void GCodeQueue::advance() {
 		return;
 
 	// Return if the G-code buffer is empty
-	if (!length)
+	if (!length) {
+		TERN_(GCODE_COMMAND_STATS, diagnostics::DiagnosticsModule::getInstance().getCommandStats().queueEmpty());
+
+		// A move held for a command that never ran (e.g. it threw) must still be made
+		TERN_(LINE_COALESCING, coalescer.flush());
+
 		return;
+	}
 
 	try {
 #if ENABLED(SDSUPPORT)
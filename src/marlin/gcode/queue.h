@@ -30,6 +30,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(GCODE_PARSE_AHEAD)
+  #include "parser.h"
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -54,6 +58,14 @@ public:
 
   static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
 
+  #if ENABLED(GCODE_PARSE_AHEAD)
+    /**
+     * The parsed form of each command, filled in as the command is committed
+     * so that process_next_command only has to restore it.
+     */
+    static parsed_command_t parsed_command[BUFSIZE];
+  #endif
+
   /**
    * The port that the command was received on
    */
@@ -119,6 +131,16 @@ public:
    */
   static bool has_commands_queued();
 
+  #if ENABLED(GCODE_PARSE_AHEAD)
+    /**
+     * The parsed form of the command queued after the one being processed,
+     * or nullptr if it hasn't arrived yet
+     */
+    static inline const parsed_command_t* peek_next() {
+      return length > 1 ? &parsed_command[(index_r + 1) % BUFSIZE] : nullptr;
+    }
+  #endif
+
   /**
    * Get the next command in the queue, optionally log it to SD, then dispatch it
    */
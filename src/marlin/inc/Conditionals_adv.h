@@ -558,3 +558,7 @@
 #	define USING_SERIAL_8 1
 #endif
 #undef ANY_SERIAL_IS
+
+#if ANY(GCODE_COMMAND_STATS, MOTION_STATS, STEPPER_ISR_PROFILE)
+#	define HAS_DIAGNOSTICS 1
+#endif
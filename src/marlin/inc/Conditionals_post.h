@@ -42,6 +42,16 @@
   #define HAS_LINEAR_E_JERK 1
 #endif
 
+// The planner limits the jerk of the S-curve
+#if ENABLED(S_CURVE_ACCELERATION) && defined(S_CURVE_MAX_JERK)
+  #define HAS_S_CURVE_JERK 1
+#endif
+
+// The planner keeps the time of the queued moves
+#if EITHER(HAS_WIRED_LCD, TIME_BASED_LOOKAHEAD)
+  #define HAS_BLOCK_RUNTIME 1
+#endif
+
 // Determine which type of 'EEPROM' is in use
 #if ENABLED(EEPROM_SETTINGS)
   // EEPROM type may be defined by compile flags, configs, HALs, or pins
@@ -1489,6 +1499,17 @@
   #define HAS_C_MS_PINS 1
 #endif
 
+// Axes, in X Y Z A B C order, that planner blocks carry step counts for
+#if HAS_C_STEP
+  #define STEPPED_AXES 6
+#elif HAS_B_STEP
+  #define STEPPED_AXES 5
+#elif HAS_A_STEP
+  #define STEPPED_AXES 4
+#else
+  #define STEPPED_AXES 3
+#endif
+
 //
 // Trinamic Stepper Drivers
 //
@@ -636,7 +636,7 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
-#if !(defined(TARGET_LPC1768) || defined(__SAMD51__)) && ANY( \
+#if !(defined(TARGET_LPC1768) || defined(__SAMD51__) || defined(__PLAT_SIMULATOR__)) && ANY( \
     ENDSTOPPULLDOWNS, \
     ENDSTOPPULLDOWN_XMAX, ENDSTOPPULLDOWN_YMAX, \
     ENDSTOPPULLDOWN_ZMAX, ENDSTOPPULLDOWN_XMIN, \
@@ -747,7 +747,7 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 #endif
 
 #if defined(EVENT_GCODE_SD_ABORT) && DISABLED(NOZZLE_PARK_FEATURE)
-  static_assert(nullptr == strstr(EVENT_GCODE_SD_ABORT, "G27"), "NOZZLE_PARK_FEATURE is required to use G27 in EVENT_GCODE_SD_ABORT.");
+  static_assert(nullptr == __builtin_strstr(EVENT_GCODE_SD_ABORT, "G27"), "NOZZLE_PARK_FEATURE is required to use G27 in EVENT_GCODE_SD_ABORT.");
 #endif
 
 /**
@@ -1524,6 +1524,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(CONCURRENT_HOMING)
+  #if IS_KINEMATIC || IS_CORE || ENABLED(MARKFORGED_XY)
+    #error "CONCURRENT_HOMING requires a Cartesian setup."
+  #elif ENABLED(SENSORLESS_HOMING)
+    #error "CONCURRENT_HOMING is incompatible with SENSORLESS_HOMING."
+  #elif ENABLED(CODEPENDENT_XY_HOMING)
+    #error "CONCURRENT_HOMING is incompatible with CODEPENDENT_XY_HOMING."
+  #endif
+#endif
+
 /**
  * Make sure Z_SAFE_HOMING point is reachable
  */
@@ -2680,9 +2690,9 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "CNC_COORDINATE_SYSTEMS is incompatible with NO_WORKSPACE_OFFSETS."
 #endif
 
-#if !BLOCK_BUFFER_SIZE || !IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
-  #error "BLOCK_BUFFER_SIZE must be a power of 2."
-#elif BLOCK_BUFFER_SIZE > 256
+#if BLOCK_BUFFER_SIZE < 2
+  #error "BLOCK_BUFFER_SIZE must be at least 2."
+#elif BLOCK_BUFFER_SIZE > 1024
   #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel."
 #endif
 
@@ -2766,6 +2776,108 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
 
 #if ENABLED(GCODE_MACROS) && !WITHIN(GCODE_MACROS_SLOTS, 1, 10)
   #error "GCODE_MACROS_SLOTS must be a number from 1 to 10."
+#elif ENABLED(GCODE_MACROS) && !WITHIN(GCODE_MACROS_SLOT_COMMANDS, 1, 255)
+  #error "GCODE_MACROS_SLOT_COMMANDS must be a number from 1 to 255."
+#endif
+
+#if ENABLED(GCODE_PARSE_AHEAD) && DISABLED(FASTER_GCODE_PARSER)
+  #error "GCODE_PARSE_AHEAD requires FASTER_GCODE_PARSER."
+#elif ENABLED(GCODE_MACROS) && DISABLED(GCODE_PARSE_AHEAD)
+  #error "GCODE_MACROS requires GCODE_PARSE_AHEAD."
+#endif
+
+#if ENABLED(CNC_CANNED_CYCLES) && DISABLED(GCODE_MOTION_MODES)
+  #error "CNC_CANNED_CYCLES requires GCODE_MOTION_MODES."
+#endif
+
+#if ENABLED(GCODE_SUBPROGRAMS) && DISABLED(SDSUPPORT)
+  #error "GCODE_SUBPROGRAMS requires SDSUPPORT."
+#endif
+
+#if ENABLED(LINE_COALESCING)
+  #if DISABLED(GCODE_PARSE_AHEAD)
+    #error "LINE_COALESCING requires GCODE_PARSE_AHEAD."
+  #elif !WITHIN(LINE_COALESCE_POINTS, 2, 255)
+    #error "LINE_COALESCE_POINTS must be a number from 2 to 255."
+  #endif
+#endif
+
+#if HAS_S_CURVE_JERK
+  static_assert(S_CURVE_MAX_JERK > 0, "S_CURVE_MAX_JERK must be greater than 0.");
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+  #if ENABLED(DIRECT_STEPPING)
+    #error "INPUT_SHAPING is not compatible with DIRECT_STEPPING."
+  #elif SHAPING_MIN_FREQ < 1
+    #error "SHAPING_MIN_FREQ must be at least 1."
+  #elif (SHAPING_MAX_STEPRATE) / (SHAPING_MIN_FREQ) > 50000
+    #error "SHAPING_MAX_STEPRATE / SHAPING_MIN_FREQ is too large for the shaping queues."
+  #endif
+#endif
+
+#if ENABLED(ARC_SUPPORT) && defined(ARC_CHORD_TOLERANCE)
+  #if defined(ARC_SEGMENTS_PER_R) || ARC_SEGMENTS_PER_SEC
+    #error "ARC_CHORD_TOLERANCE can't be used with ARC_SEGMENTS_PER_R or ARC_SEGMENTS_PER_SEC."
+  #endif
+  static_assert(ARC_CHORD_TOLERANCE > 0, "ARC_CHORD_TOLERANCE must be greater than 0.");
+#endif
+
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #ifndef BEZIER_TOLERANCE
+    #error "BEZIER_CURVE_SUPPORT requires BEZIER_TOLERANCE."
+  #endif
+  static_assert(BEZIER_TOLERANCE > 0, "BEZIER_TOLERANCE must be greater than 0.");
+#endif
+
+#if ENABLED(ARC_BLOCKS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_BLOCKS requires ARC_SUPPORT."
+  #elif IS_KINEMATIC
+    #error "ARC_BLOCKS is not supported on kinematic machines."
+  #elif HAS_POSITION_MODIFIERS
+    #error "ARC_BLOCKS can't be used with leveling, skew correction or firmware retraction."
+  #elif ENABLED(ADAPTIVE_STEP_SMOOTHING)
+    #error "ARC_BLOCKS can't be used with ADAPTIVE_STEP_SMOOTHING."
+  #elif !defined(ARC_BLOCK_BUFFER_SIZE) || !WITHIN(ARC_BLOCK_BUFFER_SIZE, 2, 256)
+    #error "ARC_BLOCK_BUFFER_SIZE must be from 2 to 256."
+  #endif
+#endif
+
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+  #ifdef __AVR__
+    #error "STEPPER_PREPARE_BLOCKS is not supported on AVR."
+  #elif !defined(STEPPER_PREPARED_BLOCKS) || STEPPER_PREPARED_BLOCKS < 1
+    #error "STEPPER_PREPARE_BLOCKS requires STEPPER_PREPARED_BLOCKS of at least 1."
+  #elif STEPPER_PREPARED_BLOCKS >= BLOCK_BUFFER_SIZE
+    #error "STEPPER_PREPARED_BLOCKS must be less than BLOCK_BUFFER_SIZE."
+  #endif
+#endif
+
+#if ENABLED(TIME_BASED_LOOKAHEAD)
+  #if LOOKAHEAD_TIME_MS < 1
+    #error "LOOKAHEAD_TIME_MS must be at least 1."
+  #elif LOOKAHEAD_DELIVERY_MS > LOOKAHEAD_TIME_MS
+    #error "LOOKAHEAD_DELIVERY_MS can't be longer than LOOKAHEAD_TIME_MS."
+  #endif
+#endif
+
+#if ENABLED(JOGGING)
+  #if IS_KINEMATIC
+    #error "JOGGING is not supported on kinematic machines."
+  #elif !defined(JOG_SEGMENT_MS) || JOG_SEGMENT_MS < 1
+    #error "JOG_SEGMENT_MS must be at least 1."
+  #endif
+#endif
+
+#if ENABLED(PATH_BLENDING)
+  #if DISABLED(LINE_COALESCING)
+    #error "PATH_BLENDING requires LINE_COALESCING."
+  #elif SAVED_POSITIONS
+    #error "PATH_BLENDING uses G61, so it can't be combined with SAVED_POSITIONS."
+  #elif !WITHIN(PATH_BLEND_SEGMENTS, 1, 255)
+    #error "PATH_BLEND_SEGMENTS must be a number from 1 to 255."
+  #endif
 #endif
 
 #if ENABLED(CUSTOM_USER_MENUS)
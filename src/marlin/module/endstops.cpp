@@ -377,6 +377,9 @@ void Endstops::enable(const bool onoff) {
 // Disable / Enable endstops based on ENSTOPS_ONLY_FOR_HOMING and global enable
 void Endstops::not_homing() {
 	enabled = enabled_globally;
+
+	// Homing is over, so no axis stays held at its switch
+	TERN_(CONCURRENT_HOMING, stepper.set_hold_on_endstop(false));
 }
 
 #if ENABLED(VALIDATE_HOMING_ENDSTOPS)
@@ -74,6 +74,10 @@ using namespace swordfish::status;
 #	include "../feature/tmc_util.h"
 #endif
 
+#if ENABLED(LINE_COALESCING)
+#	include "../feature/coalesce.h"
+#endif
+
 #if ENABLED(FWRETRACT)
 #	include "../feature/fwretract.h"
 #endif
@@ -381,10 +385,11 @@ void _internal_move_to_destination(const MachineState machine_state, const std::
 }
 
 /**
- * Plan a move to (X, Y, Z) and set the current_position
+ * Plan a move to (X, Y, Z) and set the current_position, without waiting
+ * for it, so moves queued one after another run without stopping between
  */
-void do_blocking_move_to(const MachineState machine_state, const Vector6f32& target, const std::optional<FeedRate>& feed_rate) {
-	DEBUG_SECTION(log_move, "do_blocking_move_to", DEBUGGING(LEVELING));
+void do_move_to(const MachineState machine_state, const Vector6f32& target, const std::optional<FeedRate>& feed_rate) {
+	DEBUG_SECTION(log_move, "do_move_to", DEBUGGING(LEVELING));
 	if (DEBUGGING(LEVELING))
 		DEBUG_XYZ("> ", target.x(), target.y(), target.z());
 
@@ -410,6 +415,13 @@ void do_blocking_move_to(const MachineState machine_state, const Vector6f32& tar
 
 		line_to_current_position(machine_state, z_feedrate);
 	}
+}
+
+/**
+ * Plan a move to (X, Y, Z), set the current_position and wait for it
+ */
+void do_blocking_move_to(const MachineState machine_state, const Vector6f32& target, const std::optional<FeedRate>& feed_rate) {
+	do_move_to(machine_state, target, feed_rate);
 
 	planner.synchronize();
 }
@@ -816,9 +828,12 @@ inline bool dual_x_carriage_unpark() {
  * Make sure current_position.e and destination.e are good
  * before calling or cold/lengthy extrusion may get missed.
  *
+ * With coalesce set, the move may be held back to be fused with
+ * the next one (LINE_COALESCING).
+ *
  * Before exit, current_position is set to destination.
  */
-void prepare_line_to_destination(const swordfish::status::MachineState machine_state, const float32_t accel_mm_s2 /* = 0.0 */) {
+void prepare_line_to_destination(const swordfish::status::MachineState machine_state, const float32_t accel_mm_s2 /* = 0.0 */, const bool coalesce /* = false */) {
 	auto& motionModule = MotionModule::getInstance();
 	auto& limits = motionModule.getLimits();
 
@@ -829,6 +844,20 @@ void prepare_line_to_destination(const swordfish::status::MachineState machine_s
 	debug()("current_position x: ", current_position.x(), ", y: ", current_position.y(), ", z: ", current_position.z(), ", a: ", current_position.a(), ", b: ", current_position.b(), ", c: ", current_position.c());
 	debug()("destination x: ", destination.x(), ", y: ", destination.y(), ", z: ", destination.z(), ", a: ", destination.a(), ", b: ", destination.b(), ", c: ", destination.c());
 
+#if ENABLED(LINE_COALESCING)
+	if (coalesce) {
+		coalescer.line_to(destination, feedrate_mm_s, machine_state, accel_mm_s2);
+
+		current_position = destination;
+
+		return;
+	}
+
+	// Keep the order of moves
+	coalescer.flush();
+#else
+	UNUSED(coalesce);
+#endif
 
 	if (line_to_destination_cartesian(machine_state, accel_mm_s2)) {
 		return;
@@ -837,6 +866,48 @@ void prepare_line_to_destination(const swordfish::status::MachineState machine_s
 	current_position = destination;
 }
 
+float32_t rotary_a_target(const float32_t target, const int8_t direction /* = 0 */) {
+	const float32_t current = current_position.a();
+	float32_t delta = target - current;
+
+	delta -= FLOOR(delta / 360.0f) * 360.0f; // 0 <= delta < 360
+
+	if (direction < 0) {
+		if (delta > 0) {
+			delta -= 360.0f;
+		}
+	} else if (direction == 0 && delta > 180.0f) {
+		delta -= 360.0f;
+	}
+
+	return current + delta;
+}
+
+/**
+ * Bring current_position.a back to 0-360 once a move has left it outside,
+ * moving the planner and stepper counts by the same whole turns. The
+ * stepper takes the new count from a sync block, so the queue keeps running.
+ */
+void wrap_rotary_a() {
+	if (!MotionModule::getInstance().isRotaryA()) {
+		return;
+	}
+
+	const float32_t turns = FLOOR(current_position.a() / 360.0f);
+
+	if (turns == 0) {
+		return;
+	}
+
+	// A held move ends in the old turn
+	TERN_(LINE_COALESCING, coalescer.flush());
+
+	current_position.a() -= turns * 360.0f;
+	destination.a() = current_position.a();
+
+	planner.unwind_axis(Axis::A(), turns * 360.0f);
+}
+
 uint8_t axes_should_home(uint8_t axis_bits /*=0x07*/) {
 #define SHOULD_HOME(A) TERN(HOME_AFTER_DEACTIVATE, axis_is_trusted, axis_was_homed)(A)
 	// Clear test bits that are trusted
@@ -858,10 +929,51 @@ bool homing_needed_error(uint8_t axis_bits /*=0x07*/) {
 	return false;
 }
 
+/**
+ * The homing settings of an axis, if it has any
+ */
+static AxisHoming* get_axis_homing(const Axis axis) {
+	auto& motionModule = MotionModule::getInstance();
+
+	switch (axis.value()) {
+		case AxisValue::X: return &motionModule.getXHoming();
+		case AxisValue::Y: return &motionModule.getYHoming();
+		case AxisValue::Z: return &motionModule.getZHoming();
+		case AxisValue::A: return &motionModule.getAHoming();
+		default: return nullptr;
+	}
+}
+
+/**
+ * Homing seek feedrate (mm/s)
+ */
+FeedRate homing_feedrate(const Axis axis) {
+	AxisHoming* homing = get_axis_homing(axis);
+
+	if (homing && homing->seekFeedRate() > 0)
+		return FeedRate::UnitsPerSecond(homing->seekFeedRate());
+
+	float v;
+
+	switch (axis.value()) {
+		case AxisValue::X: v = homing_feedrate_mm_m.x; break;
+		case AxisValue::Y: v = homing_feedrate_mm_m.y; break;
+		case AxisValue::Z:
+		default: v = homing_feedrate_mm_m.z; break;
+	}
+
+	return FeedRate::UnitsPerSecond(MMM_TO_MMS(v));
+}
+
 /**
  * Homing bump feedrate (mm/s)
  */
 FeedRate get_homing_bump_feedrate(const Axis axis) {
+	AxisHoming* homing = get_axis_homing(axis);
+
+	if (homing && homing->latchFeedRate() > 0)
+		return FeedRate::UnitsPerSecond(homing->latchFeedRate());
+
 	static const uint8_t homing_bump_divisor[] PROGMEM = HOMING_BUMP_DIVISOR;
 	uint8_t hbd = pgm_read_byte(&homing_bump_divisor[axis]);
 	if (hbd < 1) {
@@ -871,6 +983,18 @@ FeedRate get_homing_bump_feedrate(const Axis axis) {
 	return homing_feedrate(axis) / float(hbd);
 }
 
+/**
+ * Homing bump distance (mm)
+ */
+float get_homing_bump_mm(const Axis axis) {
+	AxisHoming* homing = get_axis_homing(axis);
+
+	if (homing && homing->latchDistance() > 0)
+		return homing->latchDistance();
+
+	return home_bump_mm(axis);
+}
+
 
 #if ENABLED(SENSORLESS_HOMING)
 /**
@@ -1284,128 +1408,11 @@ void backout_to_tmc_homing_phase(const AxisEnum axis) {
 #endif
 
 /**
- * Home an individual "raw axis" to its endstop.
- * This applies to XYZ on Cartesian and Core robots, and
- * to the individual ABC steppers on DELTA and SCARA.
- *
- * At the end of the procedure the axis is marked as
- * homed and the current position of that axis is updated.
- * Kinematic robots should wait till all axes are homed
- * before updating the current position.
+ * Square up the motors of a linear axis that has just latched on to its
+ * switch, and set it at home
  */
-
-void reference_rotary_axis(const Axis axis) {
-	if (axis.is_linear()) {
-		return;
-	}
-
-	const float move_length = 360;
-	const float bump = 3;
-	const float rebump = bump * 2;
-
-	debug()("approach");
-	endstops.enable_a_home(true);
-	do_homing_move(axis, move_length, homing_feedrate(axis), true);
-	endstops.enable_a_home(false);
-
-	debug()("bump");
-	do_homing_move(axis, -bump, homing_feedrate(axis), false);
-
-	debug()("final");
-	endstops.enable_a_home(true);
-	do_homing_move(axis, rebump, get_homing_bump_feedrate(axis), true);
-	endstops.enable_a_home(false);
-
-	set_axis_is_at_home(axis);
-	sync_plan_position();
-
-	destination[axis] = current_position[axis];
-}
-
-void reference_linear_axis(const Axis axis) {
-	/*#if ENABLED(TMC_DEBUG)
-	  REMEMBER(tmc_serial_port,report_tmc_status_serial_port,1);
-	  REMEMBER(tmc_interval,report_tmc_status_interval,10);
-	#endif
-	*/
-
-	#define _CAN_HOME(A) (axis == _AXIS(A) && (ENABLED(A##_SPI_SENSORLESS) || (_AXIS(A) == Axis::Z() && ENABLED(HOMING_Z_WITH_PROBE)) || (A##_MIN_PIN > -1 && A##_HOME_DIR < 0) || (A##_MAX_PIN > -1 && A##_HOME_DIR > 0)))
-
-	if (!_CAN_HOME(X) && !_CAN_HOME(Y) && !_CAN_HOME(Z))
-		return;
-
-	if (DEBUGGING(LEVELING))
-		DEBUG_ECHOLNPAIR(">>> homeaxis(", axis.to_char(), ")");
-
-	const int axis_home_dir = home_dir(axis);
-
-	const bool use_probe_bump = false;
-	const float bump = axis_home_dir * home_bump_mm(axis);
-
-	//
-	// Fast move towards endstop until triggered
-	//
-	const float move_length = 1.5f * max_length(TERN(DELTA, Z_AXIS, axis)) * axis_home_dir;
-
-	if (DEBUGGING(LEVELING))
-		DEBUG_ECHOLNPAIR("Home Fast: ", move_length, "mm");
-	do_homing_move(axis, move_length, homing_feedrate(axis), !use_probe_bump);
-
-	// If a second homing move is configured...
-	if (bump) {
-		// Move away from the endstop by the axis HOMING_BUMP_MM
-		if (DEBUGGING(LEVELING))
-			DEBUG_ECHOLNPAIR("Move Away: ", -bump, "mm");
-		do_homing_move(axis, -bump, homing_feedrate(axis), false);
-
-#if ENABLED(DETECT_BROKEN_ENDSTOP)
-		// Check for a broken endstop
-		EndstopEnum es;
-		switch (axis) {
-			default:
-			case X_AXIS:
-				es = X_ENDSTOP;
-				break;
-			case Y_AXIS:
-				es = Y_ENDSTOP;
-				break;
-			case Z_AXIS:
-				es = Z_ENDSTOP;
-				break;
-		}
-		if (TEST(endstops.state(), es)) {
-			SERIAL_ECHO_MSG("Bad ", axis.to_char(), " Endstop?");
-			kill(GET_TEXT(MSG_KILL_HOMING_FAILED));
-		}
-#endif
-
-		switch (axis.value()) {
-			TERN_(X_DUAL_ENDSTOPS, case AxisValue::X:)
-			TERN_(Y_DUAL_ENDSTOPS, case AxisValue::Y:)
-			TERN_(Z_MULTI_ENDSTOPS, case AxisValue::Z:)
-			stepper.set_separate_multi_axis(true);
-			default:
-				break;
-		}
-
-		// Slow move towards endstop until triggered
-		const float rebump = bump * 4;
-		if (DEBUGGING(LEVELING))
-			DEBUG_ECHOLNPAIR("Re-bump: ", rebump, "mm");
-		do_homing_move(axis, rebump, get_homing_bump_feedrate(axis), true);
-
-		switch (axis.value()) {
-			TERN_(X_DUAL_ENDSTOPS, case AxisValue::X:)
-			TERN_(Y_DUAL_ENDSTOPS, case AxisValue::Y:)
-			TERN_(Z_MULTI_ENDSTOPS, case AxisValue::Z:)
-			stepper.set_separate_multi_axis(false);
-			default:
-				break;
-		}
-	}
-
-	// move 1mm away from the sensors
-	do_homing_move(axis, -1.0 * axis_home_dir, homing_feedrate(axis), !use_probe_bump);
+static void finish_referencing(const Axis axis) {
+	[[maybe_unused]] const int axis_home_dir = home_dir(axis);
 
 #if HAS_EXTRA_ENDSTOPS
 	// Set flags for X, Y, Z motor locking
@@ -1578,11 +1585,315 @@ void reference_linear_axis(const Axis axis) {
 
 	if (DEBUGGING(LEVELING))
 		DEBUG_POS("> AFTER set_axis_is_at_home", current_position);
+}
+
+/**
+ * Home an individual "raw axis" to its endstop.
+ * This applies to XYZ on Cartesian and Core robots, and
+ * to the individual ABC steppers on DELTA and SCARA.
+ *
+ * At the end of the procedure the axis is marked as
+ * homed and the current position of that axis is updated.
+ * Kinematic robots should wait till all axes are homed
+ * before updating the current position.
+ */
+
+void reference_rotary_axis(const Axis axis) {
+	if (axis.is_linear()) {
+		return;
+	}
+
+	AxisHoming* homing = get_axis_homing(axis);
+
+	const float move_length = 360;
+	const float bump = homing && homing->latchDistance() > 0 ? homing->latchDistance() : 3;
+	const float rebump = bump * 2;
+
+	debug()("approach");
+	endstops.enable_a_home(true);
+	do_homing_move(axis, move_length, homing_feedrate(axis), true);
+	endstops.enable_a_home(false);
+
+	debug()("bump");
+	do_homing_move(axis, -bump, homing_feedrate(axis), false);
+
+	debug()("final");
+	endstops.enable_a_home(true);
+	do_homing_move(axis, rebump, get_homing_bump_feedrate(axis), true);
+	endstops.enable_a_home(false);
+
+	set_axis_is_at_home(axis);
+	sync_plan_position();
+
+	destination[axis] = current_position[axis];
+}
+
+void reference_linear_axis(const Axis axis) {
+	/*#if ENABLED(TMC_DEBUG)
+	  REMEMBER(tmc_serial_port,report_tmc_status_serial_port,1);
+	  REMEMBER(tmc_interval,report_tmc_status_interval,10);
+	#endif
+	*/
+
+	#define _CAN_HOME(A) (axis == _AXIS(A) && (ENABLED(A##_SPI_SENSORLESS) || (_AXIS(A) == Axis::Z() && ENABLED(HOMING_Z_WITH_PROBE)) || (A##_MIN_PIN > -1 && A##_HOME_DIR < 0) || (A##_MAX_PIN > -1 && A##_HOME_DIR > 0)))
+
+	if (!_CAN_HOME(X) && !_CAN_HOME(Y) && !_CAN_HOME(Z))
+		return;
+
+	if (DEBUGGING(LEVELING))
+		DEBUG_ECHOLNPAIR(">>> homeaxis(", axis.to_char(), ")");
+
+	const int axis_home_dir = home_dir(axis);
+
+	const bool use_probe_bump = false;
+	const float bump = axis_home_dir * get_homing_bump_mm(axis);
+
+	//
+	// Fast move towards endstop until triggered
+	//
+	const float move_length = 1.5f * max_length(TERN(DELTA, Z_AXIS, axis)) * axis_home_dir;
+
+	if (DEBUGGING(LEVELING))
+		DEBUG_ECHOLNPAIR("Home Fast: ", move_length, "mm");
+	do_homing_move(axis, move_length, homing_feedrate(axis), !use_probe_bump);
+
+	// If a second homing move is configured...
+	if (bump) {
+		// Move away from the endstop by the axis HOMING_BUMP_MM
+		if (DEBUGGING(LEVELING))
+			DEBUG_ECHOLNPAIR("Move Away: ", -bump, "mm");
+		do_homing_move(axis, -bump, homing_feedrate(axis), false);
+
+#if ENABLED(DETECT_BROKEN_ENDSTOP)
+		// Check for a broken endstop
+		EndstopEnum es;
+		switch (axis) {
+			default:
+			case X_AXIS:
+				es = X_ENDSTOP;
+				break;
+			case Y_AXIS:
+				es = Y_ENDSTOP;
+				break;
+			case Z_AXIS:
+				es = Z_ENDSTOP;
+				break;
+		}
+		if (TEST(endstops.state(), es)) {
+			SERIAL_ECHO_MSG("Bad ", axis.to_char(), " Endstop?");
+			kill(GET_TEXT(MSG_KILL_HOMING_FAILED));
+		}
+#endif
+
+		switch (axis.value()) {
+			TERN_(X_DUAL_ENDSTOPS, case AxisValue::X:)
+			TERN_(Y_DUAL_ENDSTOPS, case AxisValue::Y:)
+			TERN_(Z_MULTI_ENDSTOPS, case AxisValue::Z:)
+			stepper.set_separate_multi_axis(true);
+			default:
+				break;
+		}
+
+		// Slow move towards endstop until triggered
+		const float rebump = bump * 4;
+		if (DEBUGGING(LEVELING))
+			DEBUG_ECHOLNPAIR("Re-bump: ", rebump, "mm");
+		do_homing_move(axis, rebump, get_homing_bump_feedrate(axis), true);
+
+		switch (axis.value()) {
+			TERN_(X_DUAL_ENDSTOPS, case AxisValue::X:)
+			TERN_(Y_DUAL_ENDSTOPS, case AxisValue::Y:)
+			TERN_(Z_MULTI_ENDSTOPS, case AxisValue::Z:)
+			stepper.set_separate_multi_axis(false);
+			default:
+				break;
+		}
+	}
+
+	// move 1mm away from the sensors
+	do_homing_move(axis, -1.0 * axis_home_dir, homing_feedrate(axis), !use_probe_bump);
+
+	finish_referencing(axis);
 
 	if (DEBUGGING(LEVELING))
 		DEBUG_ECHOLNPAIR("<<< homeaxis(", axis.to_char(), ")");
 }
 
+#if ENABLED(CONCURRENT_HOMING)
+
+/**
+ * Move several axes at once, each at its own feed rate (units/s), in the
+ * time the slowest of them needs. Towards the endstops each axis is held at
+ * its own switch while the others go on, and is stretched to run the whole
+ * time so it doesn't slow down before it gets there.
+ */
+static void do_homing_move(const uint8_t axis_bits, const Vector6f32& distance, const Vector6f32& feed_rate, const bool is_home_dir) {
+	DEBUG_SECTION(log_move, "do_homing_move", DEBUGGING(LEVELING));
+
+	Vector6f32 target = planner.get_axis_positions_mm();
+	float32_t time = 0;
+
+	for (auto axis : stepped_axes) {
+		if (TEST(axis_bits, axis)) {
+			target[axis] = 0; // Set the homing axes to 0
+			NOLESS(time, ABS(distance[axis]) / feed_rate[axis]);
+		}
+	}
+
+	if (time == 0)
+		return;
+
+	planner.set_machine_position_mm(target); // Update the machine position
+
+	// Towards the switches every axis keeps going for the whole move, but a
+	// rotary axis goes no further than asked, one turn at most on the seek
+	for (auto axis : stepped_axes) {
+		if (TEST(axis_bits, axis)) {
+			if (!is_home_dir)
+				target[axis] = distance[axis];
+			else if (axis.is_linear())
+				target[axis] = SIGN(distance[axis]) * feed_rate[axis] * time;
+			else
+				target[axis] = SIGN(distance[axis]) * _MIN(feed_rate[axis] * time, ABS(distance[axis]));
+		}
+	}
+
+#	if HAS_DIST_MM_ARG
+	const xyze_float_t cart_dist_mm { 0 };
+#	endif
+
+	// Hold each axis at its switch towards them. Release the hold however the
+	// move ends, an abort included, or the held axes would drop later steps.
+	struct endstop_hold_t {
+		endstop_hold_t(const bool state) { stepper.set_hold_on_endstop(state); }
+		~endstop_hold_t() { stepper.set_hold_on_endstop(false); }
+	} hold(is_home_dir);
+
+	planner.buffer_segment(target
+#	if HAS_DIST_MM_ARG
+	                       ,
+	                       cart_dist_mm
+#	endif
+	                       ,
+	                       FeedRate::InverseTime(1 / time), active_extruder, MachineState::Homing);
+
+	planner.synchronize();
+
+	if (is_home_dir) {
+		// Every axis has to have reached its switch
+		const uint8_t missed = axis_bits & ~stepper.held_axes;
+
+		if (missed) {
+#	if ENABLED(VALIDATE_HOMING_ENDSTOPS)
+			kill(GET_TEXT(MSG_KILL_HOMING_FAILED));
+#	else
+			for (auto axis : stepped_axes) {
+				if (TEST(missed, axis))
+					SERIAL_ECHO_MSG("!", axis.to_char(), " endstop not reached.");
+			}
+#	endif
+		}
+
+		endstops.hit_on_purpose();
+	}
+}
+
+// Let each motor of a multi-motor axis stop at its own switch
+static void set_separate_multi_axes(const uint8_t axis_bits, const bool state) {
+#	if HAS_EXTRA_ENDSTOPS
+	bool separate = false;
+
+#		if ENABLED(X_DUAL_ENDSTOPS)
+	separate |= TEST(axis_bits, Axis::X());
+#		endif
+#		if ENABLED(Y_DUAL_ENDSTOPS)
+	separate |= TEST(axis_bits, Axis::Y());
+#		endif
+#		if ENABLED(Z_MULTI_ENDSTOPS)
+	separate |= TEST(axis_bits, Axis::Z());
+#		endif
+
+	if (separate)
+		stepper.set_separate_multi_axis(state);
+#	else
+	UNUSED(axis_bits);
+	UNUSED(state);
+#	endif
+}
+
+/**
+ * Home several axes together: a fast seek to every switch, a short back off,
+ * and a slow latch on to them. Each axis stops at its own switch while the
+ * rest go on, and runs at its own homing feed rates.
+ */
+void reference_axes(const uint8_t axis_bits) {
+	if (DEBUGGING(LEVELING))
+		DEBUG_ECHOLNPAIR(">>> reference_axes(", axis_bits, ")");
+
+	Vector6f32 seek = Vector6f32::Zero(), bump = Vector6f32::Zero(), away = Vector6f32::Zero();
+	Vector6f32 seek_rate = Vector6f32::Ones(), latch_rate = Vector6f32::Ones();
+	uint8_t linear_bits = 0;
+
+	for (auto axis : stepped_axes) {
+		if (!TEST(axis_bits, axis))
+			continue;
+
+		seek_rate[axis] = homing_feedrate(axis).value();
+		latch_rate[axis] = get_homing_bump_feedrate(axis).value();
+
+		if (axis.is_linear()) {
+			const int axis_home_dir = home_dir(axis);
+
+			seek[axis] = 1.5f * max_length(axis) * axis_home_dir;
+			bump[axis] = get_homing_bump_mm(axis) * axis_home_dir;
+			away[axis] = -1.0f * axis_home_dir;
+
+			SBI(linear_bits, axis);
+		} else {
+			AxisHoming* homing = get_axis_homing(axis);
+
+			seek[axis] = 360;
+			bump[axis] = homing && homing->latchDistance() > 0 ? homing->latchDistance() : 3;
+		}
+	}
+
+	const bool home_a = TEST(axis_bits, Axis::A());
+
+	// Fast move towards the endstops until each is triggered
+	endstops.enable_a_home(home_a);
+	do_homing_move(axis_bits, seek, seek_rate, true);
+	endstops.enable_a_home(false);
+
+	// Move away from them all together
+	do_homing_move(axis_bits, -bump, seek_rate, false);
+
+	// Slow move towards the endstops until each is triggered
+	set_separate_multi_axes(axis_bits, true);
+	endstops.enable_a_home(home_a);
+	do_homing_move(axis_bits, bump * 2, latch_rate, true);
+	endstops.enable_a_home(false);
+	set_separate_multi_axes(axis_bits, false);
+
+	// Move 1mm away from the linear sensors
+	do_homing_move(linear_bits, away, seek_rate, false);
+
+	for (auto axis : stepped_axes) {
+		if (TEST(linear_bits, axis)) {
+			finish_referencing(axis);
+		} else if (TEST(axis_bits, axis)) {
+			set_axis_is_at_home(axis);
+			sync_plan_position();
+
+			destination[axis] = current_position[axis];
+		}
+	}
+
+	if (DEBUGGING(LEVELING))
+		DEBUG_ECHOLNPAIR("<<< reference_axes(", axis_bits, ")");
+}
+
+#endif // CONCURRENT_HOMING
+
 float32_t toNative(const float32_t value, Axis axis) {
 	return MotionModule::getInstance().toNative(axis, value);
 }
@@ -28,6 +28,8 @@
  * Some of these methods may migrate to the planner class.
  */
 
+#include <optional>
+
 #include "../inc/MarlinConfig.h"
 
 #include <swordfish/Controller.h>
@@ -78,20 +80,11 @@ FORCE_INLINE bool axis_is_trusted(const Axis axis);
  */
 
 constexpr xyz_feedrate_t homing_feedrate_mm_m = HOMING_FEEDRATE_MM_M;
-FORCE_INLINE swordfish::motion::FeedRate homing_feedrate(const Axis a) {
-	float v;
-
-	switch (a.value()) {
-		case AxisValue::X: v = homing_feedrate_mm_m.x; break;
-		case AxisValue::Y: v = homing_feedrate_mm_m.y; break;
-		case AxisValue::Z:
-		default: v = homing_feedrate_mm_m.z; break;
-	}
-
-	return swordfish::motion::FeedRate::UnitsPerSecond(MMM_TO_MMS(v));
-}
 
+// Seek, latch and back off for homing, from the axis' homing settings or else the configuration
+swordfish::motion::FeedRate homing_feedrate(const Axis axis);
 swordfish::motion::FeedRate get_homing_bump_feedrate(const Axis axis);
+float get_homing_bump_mm(const Axis axis);
 
 
 /**
@@ -182,7 +175,15 @@ void line_to_current_position(const swordfish::status::MachineState machine_stat
   void unscaled_e_move(const float &length, const feedRate_t &fr_mm_s);
 #endif
 
-void prepare_line_to_destination(const swordfish::status::MachineState machine_state, const float32_t accel_mm_s2 = 0.0);
+void prepare_line_to_destination(const swordfish::status::MachineState machine_state, const float32_t accel_mm_s2 = 0.0, const bool coalesce = false);
+
+/**
+ * Rotary A. The native target of an absolute A move, reached the shortest
+ * way round (direction 0) or by turning the given way (1 or -1), and the
+ * unwinding of whole turns from current_position.a after a move.
+ */
+float32_t rotary_a_target(const float32_t target, const int8_t direction = 0);
+void wrap_rotary_a();
 
 void _internal_move_to_destination(const swordfish::status::MachineState machine_state, const std::optional<swordfish::motion::FeedRate> &feed_rate = std::nullopt
   #if IS_KINEMATIC
@@ -202,6 +203,43 @@ inline void prepare_internal_move_to_destination(const swordfish::status::Machin
   }
 #endif
 
+/**
+ * Queued movement and shorthand functions
+ */
+void do_move_to(const swordfish::status::MachineState machine_state, const swordfish::math::Vector6f32 &raw, const std::optional<swordfish::motion::FeedRate> &feed_rate = std::nullopt);
+
+FORCE_INLINE void do_move_to_x(const swordfish::status::MachineState machine_state, const float &rx, const std::optional<swordfish::motion::FeedRate> &feed_rate = std::nullopt) {
+	auto target = current_position;
+
+	target.x() = rx;
+
+	do_move_to(machine_state, target, feed_rate);
+}
+
+FORCE_INLINE void do_move_to_y(const swordfish::status::MachineState machine_state, const float &ry, const std::optional<swordfish::motion::FeedRate> &feed_rate = std::nullopt) {
+	auto target = current_position;
+
+	target.y() = ry;
+
+	do_move_to(machine_state, target, feed_rate);
+}
+
+FORCE_INLINE void do_move_to_z(const swordfish::status::MachineState machine_state, const float &rz, const std::optional<swordfish::motion::FeedRate> &feed_rate = std::nullopt) {
+	auto target = current_position;
+
+	target.z() = rz;
+
+	do_move_to(machine_state, target, feed_rate);
+}
+
+FORCE_INLINE void do_move_to_a(const swordfish::status::MachineState machine_state, const float &ra, const std::optional<swordfish::motion::FeedRate> &feed_rate = std::nullopt) {
+	auto target = current_position;
+
+	target.a() = ra;
+
+	do_move_to(machine_state, target, feed_rate);
+}
+
 /**
  * Blocking movement and shorthand functions
  */
@@ -254,6 +292,9 @@ extern uint8_t axis_homed, axis_trusted;
 
 void reference_linear_axis(const Axis axis);
 void reference_rotary_axis(const Axis axis);
+#if ENABLED(CONCURRENT_HOMING)
+  void reference_axes(const uint8_t axis_bits);
+#endif
 void set_axis_is_at_home(const Axis axis);
 void set_axis_never_homed(const Axis axis);
 uint8_t axes_should_home(uint8_t axis_bits=0x07);
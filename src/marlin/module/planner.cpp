@@ -119,6 +119,10 @@ using namespace swordfish::status;
 #	include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(LINE_COALESCING)
+#	include "../feature/coalesce.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -131,15 +135,36 @@ Planner planner;
  * A ring buffer of moves described in steps
  */
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
-volatile uint8_t Planner::block_buffer_head, // Index of the next block to be pushed
+volatile block_index_t Planner::block_buffer_head, // Index of the next block to be pushed
 		Planner::block_buffer_nonbusy, // Index of the first non-busy block
 		Planner::block_buffer_planned, // Index of the optimally planned block
 		Planner::block_buffer_tail; // Index of the busy block, if any
 uint16_t Planner::cleaning_buffer_counter; // A counter to disable queuing of blocks
+
+#if ENABLED(JOGGING)
+bool Planner::jog_cancelled; // Set by cancel_jog
+#endif
+
+#if ENABLED(ARC_BLOCKS)
+block_arc_t Planner::arc_buffer[ARC_BLOCK_BUFFER_SIZE];
+volatile uint8_t Planner::arc_buffer_head, // Slot for the next arc block's circle
+		Planner::arc_buffer_tail; // Slot of the next arc block to start
+#endif
 uint8_t Planner::delay_before_delivering; // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+#if ENABLED(PLANNER_STATS)
+planner_stats_t Planner::stats;
+#endif
+
+#if ENABLED(MOTION_STATS)
+motion_stats_t Planner::motion_stats = { .queued_min = BLOCK_BUFFER_SIZE - 1 };
+#endif
+
 planner_settings_t Planner::settings; // Initialized by settings.load()
 
+motion_profile_t Planner::motion_profiles[(uint8_t)swordfish::motion::MotionClass::__size__]; // Set by MotionModule
+f32 Planner::rotary_radius_mm = 0; // Set by MotionModule
+
 #if ENABLED(LASER_POWER_INLINE)
 laser_state_t Planner::laser_inline; // Current state for blocks
 #endif
@@ -155,6 +180,14 @@ float Planner::max_e_jerk[DISTINCT_E]; // Calculated from junction_deviation_mm
 #	endif
 #endif
 
+#if HAS_S_CURVE_JERK
+float Planner::s_curve_jerk; // (mm/s^3) M205 K
+#endif
+
+#if ENABLED(PATH_BLENDING)
+bool Planner::exact_stop; // G61.1
+#endif
+
 #if HAS_CLASSIC_JERK
 TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t)
 Planner::max_jerk;
@@ -243,7 +276,7 @@ xyze_pos_t Planner::position_float; // Needed for accurate maths. Steps cannot b
 xyze_pos_t Planner::position_cart;
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
 volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
@@ -717,9 +750,11 @@ static uint32_t get_period_inverse(uint32_t d) {
 #	else
 // All other 32-bit MPUs can easily do inverse using hardware division,
 // so we don't need to reduce precision or to use assembly language at all.
-// This routine, for all other archs, returns 0x100000000 / d ~= 0xFFFFFFFF / d
+// This routine, for all other archs, returns 0x100000000 / d with
+// PERIOD_INVERSE_EXTRA_BITS more bits of fraction, never wrapping once
+// multiplied by a time below d.
 static FORCE_INLINE uint32_t get_period_inverse(const uint32_t d) {
-	return d ? 0xFFFFFFFF / d : 0xFFFFFFFF;
+	return d ? uint32_t(_MIN((uint64_t(1) << (32 + PERIOD_INVERSE_EXTRA_BITS)) / d, uint64_t(0xFFFFFFFF))) : 0xFFFFFFFF;
 }
 #	endif
 #endif
@@ -736,7 +771,7 @@ static FORCE_INLINE uint32_t get_period_inverse(const uint32_t d) {
  */
 block_t* Planner::get_current_block() {
 	// Get the number of moves in the planner queue so far
-	const uint8_t nr_moves = movesplanned();
+	const block_index_t nr_moves = movesplanned();
 
 	// If there are any moves queued ...
 	if (nr_moves) {
@@ -744,10 +779,22 @@ block_t* Planner::get_current_block() {
 		// If there is still delay of delivery of blocks running, decrement it
 		if (delay_before_delivering) {
 			--delay_before_delivering;
+#if ENABLED(TIME_BASED_LOOKAHEAD)
+			// If less than LOOKAHEAD_DELIVERY_MS of movement is queued, and there is
+			//  still time to wait, do not deliver anything
+			if (block_buffer_runtime_us < (LOOKAHEAD_DELIVERY_MS) * 1000UL && delay_before_delivering)
+				return nullptr;
+#else
 			// If the number of movements queued is less than 3, and there is still time
 			//  to wait, do not deliver anything
 			if (nr_moves < 3 && delay_before_delivering)
 				return nullptr;
+#endif
+#if ENABLED(MOTION_STATS)
+			// Held back on an earlier call?
+			if (delay_before_delivering != BLOCK_DELAY_FOR_1ST_MOVE - 1)
+				motion_stats.delayed++;
+#endif
 			delay_before_delivering = 0;
 		}
 
@@ -759,7 +806,14 @@ block_t* Planner::get_current_block() {
 			return nullptr;
 
 		// We can't be sure how long an active block will take, so don't count it.
-		TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
+		TERN_(HAS_BLOCK_RUNTIME, block_buffer_runtime_us = block_buffer_runtime_us - block->segment_time_us);
+
+#if ENABLED(MOTION_STATS)
+		motion_stats.delivered++;
+		motion_stats.queued += nr_moves;
+		NOMORE(motion_stats.queued_min, nr_moves);
+		motion_stats.running = true;
+#endif
 
 		// As this block is busy, advance the nonbusy block pointer
 		block_buffer_nonbusy = next_block_index(block_buffer_tail);
@@ -773,7 +827,16 @@ block_t* Planner::get_current_block() {
 	}
 
 	// The queue became empty
-	TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+	TERN_(HAS_BLOCK_RUNTIME, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+
+#if ENABLED(MOTION_STATS)
+	// Ran dry mid-job, rather than at the end of one
+	if (motion_stats.running) {
+		motion_stats.running = false;
+		if (queue.has_commands_queued())
+			motion_stats.underruns++;
+	}
+#endif
 
 	return nullptr;
 }
@@ -789,6 +852,10 @@ block_t* Planner::get_current_block() {
  * alter its values.
  */
 void Planner::calculate_trapezoid_for_block(block_t* const block, const float& entry_factor, const float& exit_factor) {
+	TERN_(PLANNER_STATS, stats.trapezoids++);
+
+	// What the stepper prepared from the old trapezoid no longer holds
+	TERN_(STEPPER_PREPARE_BLOCKS, stepper.unprepare_block(block));
 
 	uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
 					 final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
@@ -801,7 +868,8 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float& e
 	uint32_t cruise_rate = initial_rate;
 #endif
 
-	const int32_t accel = block->acceleration_steps_per_s2;
+	// Back to steps/s^2, the planner only keeps the block's mm/s^2
+	const int32_t accel = LROUND(block->acceleration * block->step_event_count / block->millimeters);
 
 	// Steps required for acceleration, deceleration to/from nominal rate
 	uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
@@ -821,6 +889,8 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float& e
 #if ENABLED(S_CURVE_ACCELERATION)
 		// We won't reach the cruising rate. Let's calculate the speed we will reach
 		cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+		// Rounding can leave it short of the final rate, and the ramp down would wrap
+		NOLESS(cruise_rate, final_rate);
 #endif
 	}
 #if ENABLED(S_CURVE_ACCELERATION)
@@ -829,12 +899,48 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float& e
 #endif
 
 #if ENABLED(S_CURVE_ACCELERATION)
-	// Jerk controlled speed requires to express speed versus time, NOT steps
-	uint32_t acceleration_time = ((float) (cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-					 deceleration_time = ((float) (cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
-					 // And to offload calculations from the ISR, we also calculate the inverse of those times here
+#	if HAS_S_CURVE_JERK
+	// Small speed changes take longer than the acceleration allows, so find
+	// the steps of both ramps from their times under the jerk limit
+	if (s_curve_jerk) {
+		const float jerk = s_curve_jerk * block->step_event_count / block->millimeters; // (steps/s^3)
+		const auto ramp_steps = [&](const float low_rate, const float high_rate) {
+			return 0.5f * (low_rate + high_rate) * s_curve_ramp_time(low_rate, high_rate, accel, jerk);
+		};
+
+		// Without room to cruise, find the highest rate both ramps fit under
+		float rate = block->nominal_rate;
+		if (ramp_steps(initial_rate, rate) + ramp_steps(final_rate, rate) > block->step_event_count) {
+			float low_rate = _MAX(initial_rate, final_rate), high_rate = _MIN(rate, float(cruise_rate));
+			LOOP_L_N(i, 8) {
+				rate = 0.5f * (low_rate + high_rate);
+				if (ramp_steps(initial_rate, rate) + ramp_steps(final_rate, rate) > block->step_event_count)
+					high_rate = rate;
+				else
+					low_rate = rate;
+			}
+			rate = low_rate;
+		}
+
+		cruise_rate = rate;
+		accelerate_steps = _MIN(uint32_t(CEIL(ramp_steps(initial_rate, rate))), block->step_event_count);
+		// The stepper cruises at the nominal rate, so below it leave no plateau
+		if (rate < block->nominal_rate)
+			plateau_steps = 0;
+		else
+			plateau_steps = _MAX(int32_t(block->step_event_count - accelerate_steps - FLOOR(ramp_steps(final_rate, rate))), 0);
+	}
+#	endif
+
+	// Jerk controlled speed requires to express speed versus time, NOT steps.
+	// Time each ramp over its whole steps at its mean rate, so the curve ends
+	// on the ramp's last step even when rounding stretched or shortened it.
+	decelerate_steps = block->step_event_count - accelerate_steps - plateau_steps;
+	const uint32_t acceleration_time = 2.0f * (STEPPER_TIMER_RATE) * accelerate_steps / (initial_rate + cruise_rate),
+								 deceleration_time = 2.0f * (STEPPER_TIMER_RATE) * decelerate_steps / (cruise_rate + final_rate),
+								 // And to offload calculations from the ISR, we also calculate the inverse of those times here
 			acceleration_time_inverse = get_period_inverse(acceleration_time),
-					 deceleration_time_inverse = get_period_inverse(deceleration_time);
+								 deceleration_time_inverse = get_period_inverse(deceleration_time);
 #endif
 
 	// Store new block parameters
@@ -953,7 +1059,8 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float& e
 */
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void Planner::reverse_pass_kernel(block_t* const current, const block_t* const next) {
+// Return true if the entry speed of the block changed.
+bool Planner::reverse_pass_kernel(block_t* const current, const block_t* const next) {
 	if (current) {
 		// If entry speed is already at the maximum entry speed, and there was no change of speed
 		// in the next block, there is no need to recheck. Block is cruising and there is no need to
@@ -993,10 +1100,12 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t* const n
 					// Block is not BUSY so this is ahead of the Stepper ISR:
 					// Just Set the new entry speed.
 					current->entry_speed_sqr = new_entry_speed_sqr;
+					return true;
 				}
 			}
 		}
 	}
+	return false;
 }
 
 /**
@@ -1005,11 +1114,11 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t* const n
  */
 void Planner::reverse_pass() {
 	// Initialize block index to the last block in the planner buffer.
-	uint8_t block_index = prev_block_index(block_buffer_head);
+	block_index_t block_index = prev_block_index(block_buffer_head);
 
 	// Read the index of the last buffer planned block.
 	// The ISR may change it so get a stable local copy.
-	uint8_t planned_block_index = block_buffer_planned;
+	block_index_t planned_block_index = block_buffer_planned;
 
 	// If there was a race condition and block_buffer_planned was incremented
 	//  or was pointing at the head (queue empty) break loop now and avoid
@@ -1021,15 +1130,33 @@ void Planner::reverse_pass() {
 	// block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
 	// NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
 	const block_t* next = nullptr;
+	TERN_(TIME_BASED_LOOKAHEAD, uint32_t lookahead_us = 0);
+	TERN_(PLANNER_STATS, uint16_t visited = 0);
 	while (block_index != planned_block_index) {
 
 		// Perform the reverse pass
 		block_t* current = &block_buffer[block_index];
 
-		// Only consider non sync and page blocks
-		if (!TEST(current->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(current)) {
-			reverse_pass_kernel(current, next);
+		// Only consider non sync, dwell and page blocks
+		if (!TEST(current->flag, BLOCK_BIT_SYNC_POSITION) && !IS_DWELL(current) && !IS_PAGE(current)) {
+#if ENABLED(PLANNER_STATS)
+			stats.reverse++;
+			NOLESS(stats.reverse_max, ++visited);
+#endif
+
+			// Every block before one whose entry speed holds was planned
+			// against the same exit speed, so they hold as well.
+			if (!reverse_pass_kernel(current, next))
+				return;
+
 			next = current;
+
+#if ENABLED(TIME_BASED_LOOKAHEAD)
+			// Blocks further back than the lookahead time keep their plan
+			lookahead_us += current->segment_time_us;
+			if (lookahead_us >= (LOOKAHEAD_TIME_MS) * 1000UL)
+				return;
+#endif
 		}
 
 		// Advance to the next
@@ -1051,7 +1178,7 @@ void Planner::reverse_pass() {
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
-void Planner::forward_pass_kernel(const block_t* const previous, block_t* const current, const uint8_t block_index) {
+void Planner::forward_pass_kernel(const block_t* const previous, block_t* const current, const block_index_t block_index) {
 	if (previous) {
 		// If the previous block is an acceleration block, too short to complete the full speed
 		// change, adjust the entry speed accordingly. Entry speeds have already been reset,
@@ -1112,7 +1239,7 @@ void Planner::forward_pass() {
 	//  by the stepper ISR,  so read it ONCE. It it guaranteed that block_buffer_planned
 	//  will never lead head, so the loop is safe to execute. Also note that the forward
 	//  pass will never modify the values at the tail.
-	uint8_t block_index = block_buffer_planned;
+	block_index_t block_index = block_buffer_planned;
 
 	block_t* block;
 	const block_t* previous = nullptr;
@@ -1121,15 +1248,17 @@ void Planner::forward_pass() {
 		// Perform the forward pass
 		block = &block_buffer[block_index];
 
-		// Skip SYNC and page blocks
-		if (!TEST(block->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(block)) {
+		// Skip SYNC, dwell and page blocks
+		if (!TEST(block->flag, BLOCK_BIT_SYNC_POSITION) && !IS_DWELL(block) && !IS_PAGE(block)) {
 			// If there's no previous block or the previous block is not
 			// BUSY (thus, modifiable) run the forward_pass_kernel. Otherwise,
 			// the previous block became BUSY, so assume the current block's
 			// entry speed can't be altered (since that would also require
 			// updating the exit speed of the previous block).
-			if (!previous || !stepper.is_block_busy(previous))
+			if (!previous || !stepper.is_block_busy(previous)) {
+				TERN_(PLANNER_STATS, stats.forward++);
 				forward_pass_kernel(previous, block, block_index);
+			}
 			previous = block;
 		}
 		// Advance to the previous
@@ -1142,39 +1271,61 @@ void Planner::forward_pass() {
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
  */
-void Planner::recalculate_trapezoids() {
+void Planner::recalculate_trapezoids(const block_index_t planned_block_index) {
 	// The tail may be changed by the ISR so get a local copy.
-	uint8_t block_index = block_buffer_tail,
-					head_block_index = block_buffer_head;
+	block_index_t block_index = block_buffer_tail,
+								head_block_index = block_buffer_head;
+
+	// No block before the planned one changed its entry speed, so start at the
+	// last of them, whose exit is the planned block's entry. If the ISR took the
+	// planned block meanwhile, start at the tail.
+	if (block_distance(block_index, planned_block_index) < block_distance(block_index, head_block_index)) {
+		block_index_t start = planned_block_index;
+
+		while (start != block_index) {
+			start = prev_block_index(start);
+
+			const block_t* const block = &block_buffer[start];
+
+			if (!TEST(block->flag, BLOCK_BIT_SYNC_POSITION) && !IS_DWELL(block) && !IS_PAGE(block))
+				break;
+		}
+
+		block_index = start;
+	}
+
 	// Since there could be a sync block in the head of the queue, and the
 	// next loop must not recalculate the head block (as it needs to be
 	// specially handled), scan backwards to the first non-SYNC block.
 	while (head_block_index != block_index) {
 
 		// Go back (head always point to the first free block)
-		const uint8_t prev_index = prev_block_index(head_block_index);
+		const block_index_t prev_index = prev_block_index(head_block_index);
 
 		// Get the pointer to the block
 		block_t* prev = &block_buffer[prev_index];
 
-		// If not dealing with a sync block, we are done. The last block is not a SYNC block
-		if (!TEST(prev->flag, BLOCK_BIT_SYNC_POSITION))
+		// If not dealing with a sync or dwell block, we are done. The last block is not a SYNC block
+		if (!TEST(prev->flag, BLOCK_BIT_SYNC_POSITION) && !IS_DWELL(prev))
 			break;
 
 		// Examine the previous block. This and all following are SYNC blocks
 		head_block_index = prev_index;
 	}
 
-	// Go from the tail (currently executed block) to the first block, without including it)
+	// Go from there to the last block, without including it. The entry speeds
+	// are only needed (negative until then) for the junctions that changed.
 	block_t *block = nullptr, *next = nullptr;
-	float current_entry_speed = 0.0, next_entry_speed = 0.0;
+	float current_entry_speed = -1, next_entry_speed = -1;
 	while (block_index != head_block_index) {
 
 		next = &block_buffer[block_index];
 
-		// Skip sync and page blocks
-		if (!TEST(next->flag, BLOCK_BIT_SYNC_POSITION) && !IS_PAGE(next)) {
-			next_entry_speed = SQRT(next->entry_speed_sqr);
+		// Skip sync, dwell and page blocks
+		if (!TEST(next->flag, BLOCK_BIT_SYNC_POSITION) && !IS_DWELL(next) && !IS_PAGE(next)) {
+			TERN_(PLANNER_STATS, stats.trapezoid_visits++);
+
+			next_entry_speed = -1;
 
 			if (block) {
 				// Recalculate if current block entry or exit junction speed has changed.
@@ -1191,6 +1342,10 @@ void Planner::recalculate_trapezoids() {
 					if (!stepper.is_block_busy(block)) {
 						// Block is not BUSY, we won the race against the Stepper ISR:
 
+						if (current_entry_speed < 0)
+							current_entry_speed = SQRT(block->entry_speed_sqr);
+						next_entry_speed = SQRT(next->entry_speed_sqr);
+
 						// NOTE: Entry and exit factors always > 0 by all previous logic operations.
 						const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
 												nomr = 1.0f / current_nominal_speed;
@@ -1231,6 +1386,9 @@ void Planner::recalculate_trapezoids() {
 		if (!stepper.is_block_busy(block)) {
 			// Block is not BUSY, we won the race against the Stepper ISR:
 
+			if (next_entry_speed < 0)
+				next_entry_speed = SQRT(next->entry_speed_sqr);
+
 			const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
 									nomr = 1.0f / next_nominal_speed;
 			calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
@@ -1250,16 +1408,42 @@ void Planner::recalculate_trapezoids() {
 }
 
 void Planner::recalculate() {
+	TERN_(MOTION_STATS, const uint32_t start = getCycleCount());
+
 	// Initialize block index to the last block in the planner buffer.
-	const uint8_t block_index = prev_block_index(block_buffer_head);
+	const block_index_t block_index = prev_block_index(block_buffer_head);
+	// The passes can move the planned pointer over blocks they changed
+	const block_index_t planned_block_index = block_buffer_planned;
+
 	// If there is just one block, no planning can be done. Avoid it!
-	if (block_index != block_buffer_planned) {
+	if (block_index != planned_block_index) {
 		reverse_pass();
 		forward_pass();
 	}
-	recalculate_trapezoids();
+	recalculate_trapezoids(planned_block_index);
+
+#if ENABLED(MOTION_STATS)
+	const uint32_t cycles = getCycleCount() - start;
+	motion_stats.replans++;
+	motion_stats.replan_cycles += cycles;
+	NOLESS(motion_stats.replan_max_cycles, cycles);
+#endif
 }
 
+#if ENABLED(MOTION_STATS)
+
+void Planner::reset_motion_stats() {
+	// The Stepper ISR updates most of these
+	const bool was_enabled = stepper.suspend();
+	motion_stats = { .queued_min = BLOCK_BUFFER_SIZE - 1 };
+	stepper.isr_max_cycles = 0;
+	stepper.max_step_rate = 0;
+	if (was_enabled)
+		stepper.wake_up();
+}
+
+#endif
+
 #if ENABLED(AUTOTEMP)
 
 void Planner::getHighESpeed() {
@@ -1271,7 +1455,7 @@ void Planner::getHighESpeed() {
 		return; // probably temperature set to zero.
 
 	float high = 0.0;
-	for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+	for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
 		block_t* block = &block_buffer[b];
 		if (block->steps.x || block->steps.y || block->steps.z) {
 			const float se = (float) block->steps.e / block->step_event_count * SQRT(block->nominal_speed_sqr); // mm/sec;
@@ -1328,7 +1512,7 @@ void Planner::check_axes_activity() {
 #endif
 
 #if ANY(DISABLE_X, DISABLE_Y, DISABLE_Z, DISABLE_E)
-		for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+		for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
 			block_t* block = &block_buffer[b];
 			if (ENABLED(DISABLE_X) && block->steps.x)
 				axis_active.x = true;
@@ -1604,12 +1788,22 @@ void Planner::quick_stop() {
 	block_buffer_nonbusy = block_buffer_tail;
 	block_buffer_planned = block_buffer_tail;
 	block_buffer_head = block_buffer_tail;
+	TERN_(ARC_BLOCKS, arc_buffer_head = arc_buffer_tail);
+
+	// And any move still waiting to join the queue
+	TERN_(LINE_COALESCING, coalescer.discard());
+
+	// And the shaped steps still to go
+	TERN_(INPUT_SHAPING, stepper.discard_shaping());
+
+	// And any axes a homing move holds at their switches
+	TERN_(CONCURRENT_HOMING, stepper.set_hold_on_endstop(false));
 
 	// Restart the block delay for the first movement - As the queue was
 	// forced to empty, there's no risk the ISR will touch this.
 	delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
 	// Clear the accumulated runtime
 	clear_block_buffer_runtime();
 #endif
@@ -1625,6 +1819,115 @@ void Planner::quick_stop() {
 	stepper.quick_stop();
 }
 
+#if ENABLED(JOGGING)
+
+/**
+ * Stop a jog as soon as the acceleration allows. The jog blocks at the end of
+ * the queue that aren't needed to slow down are dropped, the ones kept are
+ * replanned to come to rest, and the position goes back to where they end.
+ * Moves queued after the jog are left alone, and a run held by the coalescer
+ * starts from where the jog now ends.
+ */
+void Planner::cancel_jog() {
+	jog_cancelled = true;
+
+	const bool was_enabled = stepper.suspend();
+
+	const block_index_t head = block_buffer_head;
+	const float min_speed_sqr = sq(float(MINIMUM_PLANNER_SPEED));
+
+	auto is_jog = [](const block_t* const block) {
+		return block->machine_state == swordfish::status::MachineState::Jogging && !TEST(block->flag, BLOCK_BIT_SYNC_POSITION) && !IS_DWELL(block);
+	};
+
+	// Only the jog blocks after the last other move may go
+	block_index_t cut = block_buffer_nonbusy;
+	for (block_index_t index = cut; index != head; index = next_block_index(index))
+		if (!is_jog(&block_buffer[index]))
+			cut = next_block_index(index);
+
+	// Keep the ones needed to slow down from the speed they're entered at
+	if (cut != head) {
+		float speed_sqr = block_buffer[cut].entry_speed_sqr;
+
+		while (cut != head && speed_sqr > min_speed_sqr) {
+			const block_t* const block = &block_buffer[cut];
+
+			speed_sqr -= 2 * block->acceleration * block->millimeters;
+			cut = next_block_index(cut);
+		}
+	}
+
+	if (cut == head) {
+		if (was_enabled)
+			stepper.wake_up();
+
+		return;
+	}
+
+	// Drop the rest, moving the position back over their steps
+	for (block_index_t index = cut; index != head; index = next_block_index(index)) {
+		block_t* const block = &block_buffer[index];
+
+		for (size_t i = 0; i < stepped_axes.size(); i++) {
+			const Axis axis = stepped_axes[i];
+			const int32_t steps = block->steps[i];
+
+			position[axis] += TEST(block->direction_bits, axis) ? steps : -steps;
+		}
+
+		TERN_(HAS_BLOCK_RUNTIME, block_buffer_runtime_us = block_buffer_runtime_us - block->segment_time_us);
+		TERN_(STEPPER_PREPARE_BLOCKS, stepper.unprepare_block(block));
+	}
+
+	block_buffer_head = cut;
+	block_buffer_planned = block_buffer_nonbusy;
+
+	// Replan the blocks kept to come to rest at the end. The first one's entry
+	// is the exit of the running block, which can't change.
+	const block_index_t first = block_buffer_tail == block_buffer_nonbusy ? block_buffer_nonbusy : next_block_index(block_buffer_nonbusy);
+	float exit_speed_sqr = min_speed_sqr;
+
+	for (block_index_t index = cut; index != first;) {
+		index = prev_block_index(index);
+
+		block_t* const block = &block_buffer[index];
+
+		if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION) || IS_DWELL(block) || IS_PAGE(block))
+			break;
+
+		const float entry_speed_sqr = max_allowable_speed_sqr(-block->acceleration, exit_speed_sqr, block->millimeters);
+
+		SBI(block->flag, BLOCK_BIT_RECALCULATE);
+
+		if (block->entry_speed_sqr <= entry_speed_sqr)
+			break;
+
+		block->entry_speed_sqr = entry_speed_sqr;
+		exit_speed_sqr = entry_speed_sqr;
+	}
+
+	recalculate_trapezoids(block_buffer_planned);
+
+	// The next move starts from rest
+	previous_speed.fill(0.0);
+	previous_nominal_speed_sqr = 0;
+
+	for (auto axis : stepped_axes)
+		current_position[axis] = position[axis] * steps_to_unit[axis];
+
+#if ENABLED(LINE_COALESCING)
+	// A move held back by the coalescer isn't in the buffer yet, so it now starts where the jog stops
+	if (coalescer.is_pending())
+		coalescer.restart(current_position);
+#endif
+
+	if (was_enabled)
+		stepper.wake_up();
+}
+
+#endif
+
 void Planner::endstop_triggered(const Axis axis) {
 	// Record stepper position and discard the current block
 	stepper.endstop_triggered(axis);
@@ -1696,7 +1999,7 @@ float Planner::get_axis_position_mm(const Axis axis) {
  * Block until all buffered steps are executed / cleaned
  */
 void Planner::synchronize() {
-	while (has_blocks_queued() || cleaning_buffer_counter || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING()))
+	while (has_blocks_queued() || cleaning_buffer_counter || TERN0(INPUT_SHAPING, stepper.is_shaping()) || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING()))
 		idle();
 }
 
@@ -1723,13 +2026,17 @@ bool Planner::_buffer_steps(
 		const MachineState machine_state,
 		const float& millimeters /* = 0.0*/,
 		const float32_t accel_mm_s2 /* = 0.0*/
+#if ENABLED(ARC_BLOCKS)
+		,
+		const planner_arc_t* const arc /* = nullptr*/
+#endif
 ) {
 	// If we are cleaning, do not accept queuing of movements
 	if (cleaning_buffer_counter)
 		return false;
 
 	// Wait for the next available block
-	uint8_t next_buffer_head;
+	block_index_t next_buffer_head;
 	block_t* const block = get_next_free_block(next_buffer_head);
 
 	// Fill the block with the specified movement
@@ -1744,7 +2051,12 @@ bool Planner::_buffer_steps(
 					extruder,
 					machine_state,
 					millimeters,
-					accel_mm_s2)) {
+					accel_mm_s2
+#if ENABLED(ARC_BLOCKS)
+					,
+					arc
+#endif
+					)) {
 		// Movement was not queued, probably because it was too short.
 		//  Simply accept that as movement queued and done
 		return true;
@@ -1760,6 +2072,16 @@ bool Planner::_buffer_steps(
 		delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 	}
 
+	TERN_(PLANNER_STATS, stats.blocks++);
+
+#if HAS_BLOCK_RUNTIME
+	// The Stepper ISR takes time off as it starts blocks
+	const bool was_enabled = stepper.suspend();
+	block_buffer_runtime_us = block_buffer_runtime_us + block->segment_time_us;
+	if (was_enabled)
+		stepper.wake_up();
+#endif
+
 	// Move buffer head
 	block_buffer_head = next_buffer_head;
 
@@ -1778,6 +2100,7 @@ bool Planner::_buffer_steps(
  *  target      - target position in steps units
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
+ *  arc         - the circle to follow, for an arc block
  *
  * Returns true if movement is acceptable, false otherwise
  */
@@ -1793,12 +2116,19 @@ bool Planner::_populate_block(
 		const MachineState machine_state,
 		const float& millimeters /* = 0.0*/,
 		float32_t accel_mm_s2 /* = 0.0*/
+#if ENABLED(ARC_BLOCKS)
+		,
+		const planner_arc_t* const arc /* = nullptr*/
+#endif
 ) {
 	EStopModule::getInstance().throwIfTriggered();
 
 	const Vector6i32 delta = target - position;
 
-	accel_mm_s2 = accel_mm_s2 ?: settings.acceleration;
+	// An acceleration given with the move wins over the profile's
+	const motion_profile_t& profile = motion_profile(machine_state);
+
+	accel_mm_s2 = accel_mm_s2 ?: motion_acceleration(machine_state);
 
 	// Compute direction bit-mask for this block
 	u8 dm = 0;
@@ -1824,25 +2154,21 @@ bool Planner::_populate_block(
 	block->laser.power = laser_inline.power;
 #endif
 
-	for (auto axis : all_axes) {
+	// Axes without a stepper get no steps, so they don't add time to the block
+	for (auto axis : stepped_axes) {
 		block->steps[axis] = abs(delta[axis]);
-	}
 
+		debug()("block->steps[", axis_codes[axis], "]: ", block->steps[axis]);
+	}
 
-	debug()("block->steps.x: ", block->steps.x());
-	debug()("block->steps.y: ", block->steps.y());
-	debug()("block->steps.z: ", block->steps.z());
-	debug()("block->steps.a: ", block->steps.a());
-	debug()("block->steps.b: ", block->steps.b());
-	debug()("block->steps.c: ", block->steps.c());
-
+	// Signed, so the junction angle sees an axis reversing
 	Vector6f32 steps_dist_unit = {
-		block->steps.x() * steps_to_unit.x(),
-		block->steps.y() * steps_to_unit.y(),
-		block->steps.z() * steps_to_unit.z(),
-		block->steps.a() * steps_to_unit.a(),
-		block->steps.b() * steps_to_unit.b(),
-		block->steps.c() * steps_to_unit.c()
+		delta.x() * steps_to_unit.x(),
+		delta.y() * steps_to_unit.y(),
+		delta.z() * steps_to_unit.z(),
+		delta.a() * steps_to_unit.a(),
+		delta.b() * steps_to_unit.b(),
+		delta.c() * steps_to_unit.c()
 	};
 
 	debug()("steps_dist_unit.x: ", steps_dist_unit.x());
@@ -1863,11 +2189,27 @@ bool Planner::_populate_block(
 		}
 	}
 
+	// At a rotary radius the rotary axes add the distance their surface
+	// travels, so one feed rate holds along linear and rotary moves alike
+	const f32 rotary_mm_per_unit = rotary_radius_mm * RADIANS(1);
+
+	if (rotary_mm_per_unit) {
+		f32 rotary_mm_sqr = 0;
+
+		for (auto axis : stepped_axes) {
+			if (axis.is_radial() && block->steps[axis] >= MIN_STEPS_PER_SEGMENT) {
+				rotary_mm_sqr += sq(steps_dist_unit[axis] * rotary_mm_per_unit);
+			}
+		}
+
+		block->millimeters = SQRT(sq(block->millimeters) + rotary_mm_sqr);
+	}
+
 	if (block->millimeters == 0.0) {
 		debug()("faking radial feed distance");
-		for (auto axis : radial_axes) {
-			if (!isnan(block->steps[axis]) && block->steps[axis] >= MIN_STEPS_PER_SEGMENT) {
-				block->millimeters += steps_dist_unit[axis];
+		for (auto axis : stepped_axes) {
+			if (axis.is_radial() && block->steps[axis] >= MIN_STEPS_PER_SEGMENT) {
+				block->millimeters += ABS(steps_dist_unit[axis]);
 			}
 		}
 	}
@@ -1882,6 +2224,14 @@ bool Planner::_populate_block(
 		return false;
 	}
 
+#if ENABLED(ARC_BLOCKS)
+	// Somewhere on an arc each plane axis moves at the whole speed in the plane,
+	// and the stepper may take only one step on it per step event
+	if (arc) {
+		NOLESS(block->step_event_count, u32(CEIL(arc->plane_mm * _MAX(settings.axis_steps_per_unit[arc->axis[0]], settings.axis_steps_per_unit[arc->axis[1]]))));
+	}
+#endif
+
 
 	// Enable active axes
 	if (block->steps.x()) {
@@ -1896,9 +2246,11 @@ bool Planner::_populate_block(
 		ENABLE_AXIS_Z();
 	}
 
+#if HAS_A_STEP
 	if (block->steps[Axis::A()]) {
 		ENABLE_AXIS_A();
 	}
+#endif
 
 	debug()("max_feedrate[X]: ", settings.max_feedrate_unit_per_s[Axis::X()]);
 	debug()("max_feedrate[Y]: ", settings.max_feedrate_unit_per_s[Axis::Y()]);
@@ -1947,8 +2299,9 @@ bool Planner::_populate_block(
 			}
 			*/
 
-			for (auto axis : all_axes) {
-				if (block->steps[axis]) {
+			for (auto axis : stepped_axes) {
+				// At a rotary radius the rotary axes are held to their own speed below
+				if (block->steps[axis] && !(rotary_mm_per_unit && axis.is_radial())) {
 					NOMORE(feed_rate.value(), settings.max_feedrate_unit_per_s[axis]);
 				}
 			}
@@ -1967,7 +2320,7 @@ bool Planner::_populate_block(
 	debug()("secs: ", 1 / inverse_secs);
 
 	// Get the number of non busy movements in queue (non busy means that they can be altered)
-	const uint8_t moves_queued = nonbusy_movesplanned();
+	const block_index_t moves_queued = nonbusy_movesplanned();
 
 	block->nominal_speed_sqr = sq(block->millimeters * inverse_secs); // (mm/sec)^2 Always > 0
 	block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
@@ -1988,6 +2341,59 @@ bool Planner::_populate_block(
 		}
 	}
 
+	// Rotary axes, in their own units
+	for (auto i : stepped_axes) {
+		if (i.is_radial()) {
+			current_speed[i] = steps_dist_unit[i] * inverse_secs;
+			const f32 cs = ABS(current_speed[i]);
+			const f32 max_fr = settings.max_feedrate_unit_per_s[i];
+
+			if (cs > max_fr) {
+				NOMORE(speed_factor, max_fr / cs);
+			}
+		}
+	}
+
+#if ENABLED(ARC_BLOCKS)
+	if (arc) {
+		// The plane axes each reach the whole speed in the plane, and the turn wants
+		// a centripetal acceleration the slower of them can give
+		const f32 plane_speed = arc->plane_mm * inverse_secs,
+							plane_accel = _MIN(accel_mm_s2, (f32) settings.max_acceleration_unit_per_s2[arc->axis[0]], (f32) settings.max_acceleration_unit_per_s2[arc->axis[1]]);
+
+		for (const uint8_t i : arc->axis) {
+			NOMORE(speed_factor, settings.max_feedrate_unit_per_s[i] / plane_speed);
+		}
+
+		NOMORE(speed_factor, SQRT(plane_accel * arc->plane_mm / ABS(arc->angle)) / plane_speed);
+	}
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+	// A shaped axis holds its steps for the shaper's delay, so it can't step
+	// faster than its queue holds them. Homing moves aren't shaped.
+	if (machine_state != MachineState::Homing) {
+		for (const Axis i : { Axis::X(), Axis::Y() }) {
+			const uint32_t max_rate = stepper.shaping_max_rate(i);
+			f32 rate = block->steps[i] * inverse_secs;
+#	if ENABLED(ARC_BLOCKS)
+			// Either axis of an arc reaches the whole speed in the plane
+			if (arc && (arc->axis[0] == i || arc->axis[1] == i))
+				rate = arc->plane_mm * inverse_secs * settings.axis_steps_per_unit[i];
+#	endif
+
+			if (max_rate && rate > max_rate) {
+				NOMORE(speed_factor, max_rate / rate);
+			}
+		}
+	}
+#endif
+
+	// And the profile's cap on the speed along the path
+	if (profile.max_feedrate_unit_per_s) {
+		NOMORE(speed_factor, profile.max_feedrate_unit_per_s / (block->millimeters * inverse_secs));
+	}
+
 	// Correct the speed
 	if (speed_factor < 1.0f) {
 		current_speed *= speed_factor;
@@ -1995,32 +2401,38 @@ bool Planner::_populate_block(
 		block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
 	}
 
+#if HAS_BLOCK_RUNTIME
+	// Time to run the block at its nominal speed
+	block->segment_time_us = LROUND(block->millimeters * 1000000.0f / SQRT(block->nominal_speed_sqr));
+#endif
+
 	// Compute and limit the acceleration rate for the trapezoid generator.
 	const f32 steps_per_mm = block->step_event_count * inverse_millimeters;
-	u32 accel;
-
-	if (!block->steps.x() && !block->steps.y() && !block->steps.z()) {
-		// convert to: acceleration steps/sec^2
-		accel = CEIL(settings.retract_acceleration * steps_per_mm);
-	} else {
-		accel = CEIL(accel_mm_s2 * steps_per_mm);
+	// Rotary-only moves too, so every axis is held to its own acceleration
+	u32 accel = CEIL(accel_mm_s2 * steps_per_mm);
 
-		for (auto axis : all_axes) {
-			if (block->steps[axis] && max_acceleration_steps_per_s2[axis] < accel) {
-				debug()("max_acceleration_steps_per_s2[", axis_codes[axis], "]: ", max_acceleration_steps_per_s2[axis]);
-				const float comp = (float) max_acceleration_steps_per_s2[axis] * (float) block->step_event_count;
+	for (auto axis : stepped_axes) {
+		if (block->steps[axis] && max_acceleration_steps_per_s2[axis] < accel) {
+			debug()("max_acceleration_steps_per_s2[", axis_codes[axis], "]: ", max_acceleration_steps_per_s2[axis]);
+			const float comp = (float) max_acceleration_steps_per_s2[axis] * (float) block->step_event_count;
 
-				if ((float) accel * (float) block->steps[axis] > comp) {
-					accel = comp / (float) block->steps[axis];
-				}
+			if ((float) accel * (float) block->steps[axis] > comp) {
+				accel = comp / (float) block->steps[axis];
 			}
 		}
 	}
 
-	block->acceleration_steps_per_s2 = accel;
+#if ENABLED(ARC_BLOCKS)
+	// Around an arc the plane axes take the whole of the acceleration along it in turn
+	if (arc) {
+		for (const uint8_t i : arc->axis) {
+			NOMORE(accel, u32(settings.max_acceleration_unit_per_s2[i] * steps_per_mm));
+		}
+	}
+#endif
+
 	block->acceleration = accel / steps_per_mm;
 
-	debug()("block->acceleration_steps_per_s2: ", block->acceleration_steps_per_s2);
 	debug()("block->acceleration: ", block->acceleration);
 
 #if DISABLED(S_CURVE_ACCELERATION)
@@ -2080,6 +2492,11 @@ bool Planner::_populate_block(
 
 	Vector6f32 unit_vec = steps_dist_unit;
 
+	// At a rotary radius the rotary axes move by the distance their surface travels, as the block's length counts them
+	if (rotary_mm_per_unit) {
+		scale_rotary(unit_vec, rotary_mm_per_unit);
+	}
+
 	/**
 	 * On CoreXY the length of the vector [A,B] is SQRT(2) times the length of the head movement vector [X,Y].
 	 * So taking Z and E into account, we cannot scale to a unit vector with "inverse_millimeters".
@@ -2092,6 +2509,13 @@ bool Planner::_populate_block(
 		unit_vec *= inverse_millimeters; // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
 	}
 
+#	if ENABLED(ARC_BLOCKS)
+	// An arc leaves the previous move along its tangent, not its chord
+	if (arc) {
+		unit_vec = arc->entry_unit_vec;
+	}
+#	endif
+
 	// Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
 	if (moves_queued && !UNEAR_ZERO(previous_nominal_speed_sqr)) {
 		// Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
@@ -2100,7 +2524,7 @@ bool Planner::_populate_block(
 				(-prev_unit_vec.x() * unit_vec.x())
 			+ (-prev_unit_vec.y() * unit_vec.y())
 			+ (-prev_unit_vec.z() * unit_vec.z())
-			//+ (-prev_unit_vec.a() * unit_vec.a())
+			+ (rotary_mm_per_unit ? -prev_unit_vec.a() * unit_vec.a() : 0) // Without a rotary radius A's degrees aren't a distance
 			//+ (-prev_unit_vec.b() * unit_vec.b())
 			//+ (-prev_unit_vec.c() * unit_vec.c())
 			;
@@ -2116,15 +2540,20 @@ bool Planner::_populate_block(
 			Vector6f32 junction_unit_vec = unit_vec - prev_unit_vec;
 			normalize_junction_vector(junction_unit_vec);
 
+			// Back to the rotary axes' own units to hold them to their own acceleration
+			if (rotary_mm_per_unit) {
+				scale_rotary(junction_unit_vec, 1.0f / rotary_mm_per_unit);
+			}
+
 			const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
 									sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
 
-			vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+			vmax_junction_sqr = junction_acceleration * (profile.junction_deviation_mm ?: junction_deviation_mm) * sin_theta_d2 / (1.0f - sin_theta_d2);
 
 #	if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
 
 			// For small moves with >135° junction (octagon) find speed for approximate arc
-			if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
+			if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f && !TERN0(ARC_BLOCKS, arc)) {
 
 #		if ENABLED(JD_USE_MATH_ACOS)
 
@@ -2214,6 +2643,13 @@ bool Planner::_populate_block(
 
 	prev_unit_vec = unit_vec;
 
+#	if ENABLED(ARC_BLOCKS)
+	// The next move meets an arc where its tangent ends up
+	if (arc) {
+		prev_unit_vec = arc->exit_unit_vec;
+	}
+#	endif
+
 #endif
 
 #ifdef USE_CACHED_SQRT
@@ -2352,10 +2788,44 @@ bool Planner::_populate_block(
 	                  ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH
 	                  : BLOCK_FLAG_RECALCULATE;
 
+#if ENABLED(ARC_BLOCKS)
+	if (arc) {
+		// Hand the circle to the stepper, in step units along the block's directions
+		block_arc_t& circle = arc_buffer[arc_buffer_head];
+		const f32 turn = arc->angle / block->step_event_count;
+
+		LOOP_L_N(i, 2) {
+			const uint8_t axis = arc->axis[i];
+			const f32 scale = delta[axis] < 0 ? -settings.axis_steps_per_unit[axis] : settings.axis_steps_per_unit[axis];
+
+			circle.axis[i] = axis;
+			circle.scale[i] = scale;
+			circle.offset[i] = arc->center[i] * scale - (delta[axis] < 0 ? -position[axis] : position[axis]);
+			circle.radius[i] = arc->radius[i];
+			circle.carry[i] = 0;
+		}
+
+		circle.turn_k = 2 * sq(sinf(turn / 2));
+		circle.turn_s = sinf(turn);
+
+		SBI(block->flag, BLOCK_BIT_ARC);
+		block->arc_index = arc_buffer_head;
+		arc_buffer_head = next_arc_index(arc_buffer_head);
+	}
+#endif
+
 	// Update previous path unit_vector and nominal speed
 	previous_speed = current_speed;
 	previous_nominal_speed_sqr = block->nominal_speed_sqr;
 
+#if ENABLED(PATH_BLENDING)
+	// In exact stop mode the next move starts from rest, as after a dwell
+	if (exact_stop) {
+		previous_speed.fill(0.0);
+		previous_nominal_speed_sqr = 0;
+	}
+#endif
+
 	position = target; // Update the position
 
 	TERN_(HAS_POSITION_FLOAT, position_float = target_float);
@@ -2372,7 +2842,7 @@ bool Planner::_populate_block(
  */
 void Planner::buffer_sync_block() {
 	// Wait for the next available block
-	uint8_t next_buffer_head;
+	block_index_t next_buffer_head;
 	block_t* const block = get_next_free_block(next_buffer_head);
 
 	// Clear block
@@ -2380,7 +2850,12 @@ void Planner::buffer_sync_block() {
 
 	block->flag = BLOCK_FLAG_SYNC_POSITION;
 
-	block->position = position;
+	block->position = position.head<STEPPED_AXES>();
+
+#if STEPPED_AXES < 6
+	// Nothing steps the other axes, so their counts can change right away
+	stepper.count_position.tail<6 - STEPPED_AXES>() = position.tail<6 - STEPPED_AXES>();
+#endif
 
 	// If this is the first added movement, reload the delay, otherwise, cancel it.
 	if (block_buffer_head == block_buffer_tail) {
@@ -2397,6 +2872,55 @@ void Planner::buffer_sync_block() {
 	stepper.wake_up();
 } // buffer_sync_block()
 
+/**
+ * Planner::buffer_dwell_block
+ *
+ * The stepper runs a dwell block like a motionless move of one step event per
+ * millisecond, so it needs no special handling in the ISR. The planner passes
+ * skip it, and the following move starts from rest.
+ */
+void Planner::buffer_dwell_block(const millis_t dwell_ms, const MachineState machine_state) {
+	if (!dwell_ms)
+		return;
+
+	// Wait for the next available block
+	block_index_t next_buffer_head;
+	block_t* const block = get_next_free_block(next_buffer_head);
+
+	// Clear block
+	block->reset();
+
+	block->flag = BLOCK_FLAG_DWELL;
+
+	// Drop anything prepared for a move that was here before
+	TERN_(STEPPER_PREPARE_BLOCKS, stepper.unprepare_block(block));
+
+	block->step_event_count = dwell_ms;
+	block->accelerate_until = 0;
+	block->decelerate_after = dwell_ms;
+	block->nominal_rate = block->initial_rate = block->final_rate = 1000; // One step event per millisecond
+#if ENABLED(S_CURVE_ACCELERATION)
+	block->cruise_rate = block->nominal_rate;
+#endif
+	block->machine_state = machine_state; // e.g. a drilling cycle stays busy through its dwell
+
+	// Keep the directions of the previous move so the ISR doesn't toggle them
+	if (block_buffer_head != block_buffer_tail)
+		block->direction_bits = block_buffer[prev_block_index(block_buffer_head)].direction_bits;
+
+	// The next move starts from rest
+	previous_speed.fill(0.0);
+	previous_nominal_speed_sqr = 0;
+
+	if (block_buffer_head == block_buffer_tail) {
+		delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
+	}
+
+	block_buffer_head = next_buffer_head;
+
+	stepper.wake_up();
+} // buffer_dwell_block()
+
 /**
  * Planner::buffer_segment
  *
@@ -2491,6 +3015,155 @@ bool Planner::buffer_line(
 			accel_mm_s2);
 } // buffer_line()
 
+#if ENABLED(ARC_BLOCKS)
+
+/**
+ * Planner::buffer_arc
+ *
+ * Add an arc to the buffer as arc blocks of up to a quarter turn, split where
+ * the arc crosses an axis of the circle so that each block moves every axis in
+ * one direction. The other axes move in proportion to the angle turned.
+ *
+ * Returns 'false' if the arc wasn't queued due to cleaning.
+ */
+bool Planner::buffer_arc(
+		const Vector6f32& start,
+		const Vector6f32& cart,
+		const Vector2f32& center,
+		const float angular_travel,
+		const Axis p_axis,
+		const Axis q_axis,
+		const FeedRate& feed_rate,
+		const uint8_t extruder,
+		const MachineState machine_state) {
+
+	// A quarter turn, with a little slack so an end close to an axis doesn't make a sliver of a block
+	constexpr float quarter = RADIANS(90), slack = 0.0001f;
+
+	const float radius = HYPOT(start[p_axis] - center.x(), start[q_axis] - center.y()),
+							total = ABS(angular_travel),
+							direction = angular_travel < 0 ? -1 : 1;
+
+	const Vector6f32 travel = cart - start;
+
+	// Linear travel off the plane, in proportion to the angle
+	float linear_mm = 0;
+	for (auto axis : linear_axes) {
+		if (axis != p_axis && axis != q_axis) {
+			linear_mm += sq(travel[axis]);
+		}
+	}
+	linear_mm = SQRT(linear_mm);
+
+	// Rotary travel by the distance its surface moves at the rotary radius, which each block adds to its length
+	const f32 rotary_mm_per_unit = rotary_radius_mm * RADIANS(1);
+	Vector6f32 surface_travel = travel;
+	float rotary_mm = 0;
+	if (rotary_mm_per_unit) {
+		scale_rotary(surface_travel, rotary_mm_per_unit);
+		for (auto axis : stepped_axes) {
+			if (axis.is_radial()) {
+				rotary_mm += sq(surface_travel[axis]);
+			}
+		}
+		rotary_mm = SQRT(rotary_mm);
+	}
+
+	planner_arc_t arc;
+	arc.axis[0] = p_axis;
+	arc.axis[1] = q_axis;
+	arc.center[0] = center.x();
+	arc.center[1] = center.y();
+
+	Vector6f32 from = start;
+	float angle = ATAN2(start[q_axis] - center.y(), start[p_axis] - center.x()),
+				turned = 0;
+
+	while (turned < total) {
+		// Turn up to the next axis of the circle, or to the end
+		const float boundary = quarter * (direction > 0 ? FLOOR(angle / quarter + slack) + 1 : CEIL(angle / quarter - slack) - 1);
+		float span = ABS(boundary - angle);
+
+		const bool last = turned + span >= total - slack;
+		if (last) {
+			span = total - turned;
+		}
+
+		const float end_angle = angle + direction * span,
+								portion = span / total;
+
+		Vector6f32 to;
+		if (last) {
+			to = cart;
+		} else {
+			to = from + travel * portion;
+			to[p_axis] = center.x() + radius * cosf(end_angle);
+			to[q_axis] = center.y() + radius * sinf(end_angle);
+		}
+
+		arc.radius[0] = from[p_axis] - center.x();
+		arc.radius[1] = from[q_axis] - center.y();
+		arc.angle = direction * span;
+		arc.plane_mm = radius * span;
+
+		const float millimeters = HYPOT(arc.plane_mm, linear_mm * portion),
+								inverse_mm = 1.0f / HYPOT(millimeters, rotary_mm * portion),
+								tangent = direction * arc.plane_mm * inverse_mm;
+
+		// Directions of travel at either end, the other axes keep theirs
+		arc.entry_unit_vec = surface_travel * (portion * inverse_mm);
+		arc.exit_unit_vec = arc.entry_unit_vec;
+		arc.entry_unit_vec[p_axis] = -sinf(angle) * tangent;
+		arc.entry_unit_vec[q_axis] = cosf(angle) * tangent;
+		arc.exit_unit_vec[p_axis] = -sinf(end_angle) * tangent;
+		arc.exit_unit_vec[q_axis] = cosf(end_angle) * tangent;
+
+		const Vector6i32 target = {
+			i32(LROUND(to[Axis::X()] * settings.axis_steps_per_unit[Axis::X()])),
+			i32(LROUND(to[Axis::Y()] * settings.axis_steps_per_unit[Axis::Y()])),
+			i32(LROUND(to[Axis::Z()] * settings.axis_steps_per_unit[Axis::Z()])),
+			i32(LROUND(to[Axis::A()] * settings.axis_steps_per_unit[Axis::A()])),
+			i32(LROUND(to[Axis::B()] * settings.axis_steps_per_unit[Axis::B()])),
+			i32(LROUND(to[Axis::C()] * settings.axis_steps_per_unit[Axis::C()]))
+		};
+
+		// An inverse time feed covers the whole arc, so each block gets its share of the time
+		FeedRate block_feed_rate = feed_rate;
+		if (feed_rate.type() == FeedRateType::InverseTime) {
+			block_feed_rate.value() /= portion;
+		}
+
+		// Wait for a slot for the circle
+		while (next_arc_index(arc_buffer_head) == arc_buffer_tail) {
+			idle();
+		}
+
+		if (!_buffer_steps(
+						target,
+#	if HAS_POSITION_FLOAT
+						to,
+#	endif
+						block_feed_rate,
+						extruder,
+						machine_state,
+						millimeters,
+						0.0,
+						&arc)) {
+			return false;
+		}
+
+		stepper.wake_up();
+
+		from = to;
+		angle = end_angle;
+		turned += span;
+	}
+
+	return true;
+} // buffer_arc()
+
+#endif // ARC_BLOCKS
+
 #if ENABLED(DIRECT_STEPPING)
 
 void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -2499,11 +3172,16 @@ void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, con
 		return;
 	}
 
-	uint8_t next_buffer_head;
+	block_index_t next_buffer_head;
 	block_t* const block = get_next_free_block(next_buffer_head);
 
 	block->flag = BLOCK_FLAG_IS_PAGE;
 
+	// Drop anything prepared for a move that was here before
+	TERN_(STEPPER_PREPARE_BLOCKS, stepper.unprepare_block(block));
+
+	TERN_(HAS_BLOCK_RUNTIME, block->segment_time_us = 0);
+
 #	if FAN_COUNT > 0
 	FANS_LOOP(i)
 	block->fan_speed[i] = thermalManager.fan_speed[i];
@@ -2581,6 +3259,16 @@ void Planner::set_machine_position_mm(const float& x, const float& y, const floa
 		stepper.set_position(position);
 }
 
+void Planner::unwind_axis(const Axis axis, const float32_t distance) {
+	position[axis] -= LROUND(distance * settings.axis_steps_per_unit[axis]);
+
+	if (has_blocks_queued()) {
+		buffer_sync_block();
+	} else {
+		stepper.set_position(position);
+	}
+}
+
 void Planner::set_position_mm(const float& rx, const float& ry, const float& rz, const float& e) {
 	Vector6f32 machine = { rx, ry, rz, e, 0, 0 };
 #if HAS_POSITION_MODIFIERS
@@ -2688,7 +3376,7 @@ void Planner::set_max_jerk(const Axis axis, float targetValue) {
 #endif
 }
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
 
 uint16_t Planner::block_buffer_runtime() {
 #	ifdef __AVR__
@@ -30,7 +30,10 @@
  * Copyright (c) 2009-2011 Simen Svale Skogsrud
  */
 
+#include <span>
+
 #include <swordfish/math.h>
+#include <swordfish/modules/motion/MotionProfile.h>
 
 #include "../MarlinCore.h"
 
@@ -75,6 +78,14 @@
   #define IS_PAGE(B) false
 #endif
 
+#define IS_DWELL(B) TEST(B->flag, BLOCK_BIT_DWELL)
+
+#if ENABLED(ARC_BLOCKS)
+  #define IS_ARC(B) TEST(B->flag, BLOCK_BIT_ARC)
+#else
+  #define IS_ARC(B) false
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   constexpr xyze_feedrate_t _mf = MANUAL_FEEDRATE,
@@ -98,12 +109,20 @@ enum BlockFlagBit : char {
   BLOCK_BIT_CONTINUED,
 
   // Sync the stepper counts from the block
-  BLOCK_BIT_SYNC_POSITION
+  BLOCK_BIT_SYNC_POSITION,
+
+  // Hold the steppers still for step_event_count milliseconds
+  BLOCK_BIT_DWELL
 
   // Direct stepping page
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_BIT_IS_PAGE
   #endif
+
+  // Arc, the stepper follows the circle in Planner::arc_buffer
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_BIT_ARC
+  #endif
 };
 
 enum BlockFlag : char {
@@ -111,9 +130,13 @@ enum BlockFlag : char {
   , BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH)
   , BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED)
   , BLOCK_FLAG_SYNC_POSITION        = _BV(BLOCK_BIT_SYNC_POSITION)
+  , BLOCK_FLAG_DWELL                = _BV(BLOCK_BIT_DWELL)
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_FLAG_IS_PAGE            = _BV(BLOCK_BIT_IS_PAGE)
   #endif
+  #if ENABLED(ARC_BLOCKS)
+    , BLOCK_FLAG_ARC                = _BV(BLOCK_BIT_ARC)
+  #endif
 };
 
 #if ENABLED(LASER_POWER_INLINE)
@@ -140,55 +163,70 @@ enum BlockFlag : char {
 
 #endif
 
+// Step counts, and the sync position, for the axes that have steppers
+typedef Eigen::Matrix<uint32_t, STEPPED_AXES, 1, Eigen::DontAlign> block_steps_t;
+typedef Eigen::Matrix<int32_t, STEPPED_AXES, 1, Eigen::DontAlign> block_position_t;
+
+// The axes block_steps_t covers
+static constexpr std::span<const Axis> stepped_axes { all_axes, STEPPED_AXES };
+
+#if ENABLED(ARC_BLOCKS)
+
+  /**
+   * struct block_arc_t
+   *
+   * The circle an arc block's two plane axes follow. Each step event turns
+   * the radius vector by the same angle, and an axis is stepped when its
+   * progress, offset + radius * scale, rounds past the steps it has taken.
+   * Offset and scale carry the axis direction, so progress runs from zero
+   * up to the block's steps on that axis.
+   *
+   * At a large radius a turn moves the vector by a few ulps of its length,
+   * so the rounding of every turn is carried into the next one. Otherwise
+   * it adds up to steps off the circle over a long arc.
+   */
+  typedef struct {
+    float offset[2],                        // Progress at the centre of the circle, in steps
+          scale[2],                         // Steps per mm, negative for an axis moving backwards
+          radius[2],                        // Radius vector from the centre to the start (mm)
+          carry[2],                         // Rounding the last turn lost from the radius vector (mm)
+          turn_k,                           // 1 - cos(angle per step event)
+          turn_s;                           // sin(angle per step event)
+    uint8_t axis[2];                        // The plane axes
+  } block_arc_t;
+
+  // An arc block as the planner queues it
+  typedef struct {
+    uint8_t axis[2];                        // The plane axes
+    float center[2],                        // Centre of the circle (mm)
+          radius[2],                        // Radius vector from the centre to the start (mm)
+          angle,                            // Angle to turn through, anticlockwise positive
+          plane_mm;                         // Length along the arc in the plane (mm)
+    swordfish::math::Vector6f32 entry_unit_vec, // Direction of travel at the start and at the end
+                                exit_unit_vec;
+  } planner_arc_t;
+
+#endif
+
 /**
- * struct block_t
- *
- * A single entry in the planner buffer.
- * Tracks linear movement over multiple axes.
+ * struct block_motion_t
  *
- * The "nominal" values are as-specified by gcode, and
- * may never actually be reached due to acceleration limits.
+ * The part of a planner block that the Stepper ISR reads. It leads block_t,
+ * so the ISR works on one contiguous run of the block (64 bytes on a four
+ * axis machine) and never pulls in the planner's floats.
  */
-typedef struct block_t {
-	block_t() {
-		reset();
-	}
-
-	void reset() {
-		flag = 0;
-		nominal_speed_sqr = 0.0;
-		max_entry_speed_sqr = 0.0;
-		millimeters = 0.0;
-		acceleration = 0.0;
-		steps = swordfish::math::Vector6u32 { 0, 0, 0, 0, 0, 0 };
-		step_event_count = 0;
-		accelerate_until = 0;
-		decelerate_after = 0;
-		cruise_rate = 0;
-		acceleration_time = 0;
-		deceleration_time = 0;
-		acceleration_time_inverse = 0;
-		deceleration_time_inverse = 0;
-		direction_bits = 0;
-		initial_rate = 0;
-		final_rate = 0;
-		acceleration_steps_per_s2 = 0;
-	}
+typedef struct block_motion_t {
+  block_motion_t() {}
 
   volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
+  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
-  union {
-    swordfish::math::Vector6u32 steps;                     // Step count along each axis
-    swordfish::math::Vector6i32 position;                   // New position to force when this sync block is executed
-  };
-  uint32_t step_event_count;                // The number of step events required to complete this block
+  swordfish::status::MachineState machine_state; // The machine state to report while this block runs
+
+  #if ENABLED(ARC_BLOCKS)
+    uint8_t arc_index;                      // The block's circle in Planner::arc_buffer
+  #endif
 
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
@@ -196,7 +234,11 @@ typedef struct block_t {
     static constexpr uint8_t extruder = 0;
   #endif
 
-  TERN_(MIXING_EXTRUDER, MIXER_BLOCK_FIELD); // Normalized color for the mixing steppers
+  union {
+    block_steps_t steps;                    // Step count along each stepped axis
+    block_position_t position;              // New position to force when this sync block is executed
+  };
+  uint32_t step_event_count;                // The number of step events required to complete this block
 
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
@@ -212,7 +254,11 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
+           initial_rate,                    // The jerk-adjusted step rate at start of block
+           final_rate;                      // The minimal rate at exit
+
+  TERN_(MIXING_EXTRUDER, MIXER_BLOCK_FIELD); // Normalized color for the mixing steppers
 
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
@@ -223,17 +269,64 @@ typedef struct block_t {
     float e_D_ratio;
   #endif
 
-  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
-           initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
-
-	swordfish::status::MachineState machine_state;
-
   #if ENABLED(DIRECT_STEPPING)
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(LASER_POWER_INLINE)
+    block_laser_t laser;
+  #endif
+
+} block_motion_t;
+
+/**
+ * struct block_t
+ *
+ * A single entry in the planner buffer.
+ * Tracks linear movement over multiple axes.
+ *
+ * The "nominal" values are as-specified by gcode, and
+ * may never actually be reached due to acceleration limits.
+ *
+ * Fields past block_motion_t are only used while planning.
+ */
+typedef struct block_t : block_motion_t {
+	block_t() {
+		reset();
+	}
+
+	void reset() {
+		flag = 0;
+		direction_bits = 0;
+		steps.setZero();
+		step_event_count = 0;
+		accelerate_until = 0;
+		decelerate_after = 0;
+		cruise_rate = 0;
+		acceleration_time = 0;
+		deceleration_time = 0;
+		acceleration_time_inverse = 0;
+		deceleration_time_inverse = 0;
+		initial_rate = 0;
+		final_rate = 0;
+		nominal_speed_sqr = 0.0;
+		max_entry_speed_sqr = 0.0;
+		millimeters = 0.0;
+		acceleration = 0.0;
+		TERN_(HAS_BLOCK_RUNTIME, segment_time_us = 0);
+	}
+
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
+
+  #if HAS_BLOCK_RUNTIME
+    uint32_t segment_time_us;
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -246,25 +339,25 @@ typedef struct block_t {
     uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
-  #if HAS_WIRED_LCD
-    uint32_t segment_time_us;
-  #endif
-
   #if ENABLED(POWER_LOSS_RECOVERY)
     uint32_t sdpos;
   #endif
 
-  #if ENABLED(LASER_POWER_INLINE)
-    block_laser_t laser;
-  #endif
-
 } block_t;
 
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL)
   #define HAS_POSITION_FLOAT 1
 #endif
 
-#define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
+// Index into the block ring buffer
+typedef IF<(BLOCK_BUFFER_SIZE > 256), uint16_t, uint8_t>::type block_index_t;
+
+#if ENABLED(S_CURVE_ACCELERATION) && !defined(__AVR__)
+  // Fraction bits the 32-bit period inverses keep below Q0.32. At the full
+  // CPU clock a half second ramp has an inverse near 68, and dropping its
+  // fraction would run the speed curve 1.5% slow.
+  #define PERIOD_INVERSE_EXTRA_BITS 8
+#endif
 
 #if ENABLED(LASER_POWER_INLINE)
   typedef struct {
@@ -295,6 +388,17 @@ typedef struct {
 	f32 min_travel_feedrate_unit_per_s;           // (mm/s) M205 T - Minimum travel feedrate
 } planner_settings_t;
 
+/**
+ * Acceleration, cornering and feed cap for one class of motion. Each is
+ * bounded by the axis limits in planner_settings_t, and zero falls back to
+ * the planner's own setting.
+ */
+typedef struct {
+  f32 acceleration;                       // (mm/s^2) Zero for M204 S, or M204 T for rapids
+  f32 junction_deviation_mm;              // (mm) Zero for M205 J
+  f32 max_feedrate_unit_per_s;            // (mm/s) Zero for no cap beyond the axes'
+} motion_profile_t;
+
 #if DISABLED(SKEW_CORRECTION)
   #define XY_SKEW_FACTOR 0
   #define XZ_SKEW_FACTOR 0
@@ -315,6 +419,33 @@ typedef struct {
   #endif
 } skew_factor_t;
 
+#if ENABLED(PLANNER_STATS)
+  // Work done by recalculate() since the last reset
+  typedef struct {
+    uint32_t blocks,            // Blocks added to the buffer
+             reverse,           // Blocks visited by reverse passes
+             forward,           // Blocks visited by forward passes
+             trapezoid_visits,  // Blocks visited by trapezoid passes
+             trapezoids;        // Trapezoids computed
+    uint16_t reverse_max;       // Most blocks visited by one reverse pass
+  } planner_stats_t;
+#endif
+
+#if ENABLED(MOTION_STATS)
+  // Block delivery and replanning since the last reset
+  typedef struct {
+    uint32_t delivered,         // Blocks handed to the Stepper ISR
+             queued;            // Sum of the blocks in the buffer at each hand-over
+    block_index_t queued_min;   // Fewest blocks in the buffer at a hand-over
+    uint32_t delayed,           // Hand-overs held back for more moves after the buffer ran dry
+             underruns,         // Times the buffer ran dry with commands still queued
+             replans,           // Calls to recalculate()
+             replan_cycles,     // CPU cycles spent in them, including any ISRs
+             replan_max_cycles; // The longest of them
+    bool running;               // Blocks were handed over since the buffer last ran dry
+  } motion_stats_t;
+#endif
+
 #if ENABLED(DISABLE_INACTIVE_EXTRUDER)
   typedef IF<(BLOCK_BUFFER_SIZE > 64), uint16_t, uint8_t>::type last_move_t;
 #endif
@@ -336,13 +467,32 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
-    static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
-                            block_buffer_nonbusy,   // Index of the first non busy block
-                            block_buffer_planned,   // Index of the optimally planned block
-                            block_buffer_tail;      // Index of the busy block, if any
+    static volatile block_index_t block_buffer_head,      // Index of the next block to be pushed
+                                  block_buffer_nonbusy,   // Index of the first non busy block
+                                  block_buffer_planned,   // Index of the optimally planned block
+                                  block_buffer_tail;      // Index of the busy block, if any
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
+
+    #if ENABLED(ARC_BLOCKS)
+      /**
+       * The circles of the queued arc blocks, in queue order. The planner
+       * writes head. The Stepper ISR copies each circle as its block starts
+       * and moves tail on, so only arcs still to start hold a slot.
+       */
+      static block_arc_t arc_buffer[ARC_BLOCK_BUFFER_SIZE];
+      static volatile uint8_t arc_buffer_head, arc_buffer_tail;
+    #endif
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(PLANNER_STATS)
+      static planner_stats_t stats;
+    #endif
+
+    #if ENABLED(MOTION_STATS)
+      static motion_stats_t motion_stats;
+      static void reset_motion_stats();
+    #endif
+
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -372,6 +522,28 @@ class Planner {
 
     static planner_settings_t settings;
 
+    // Set by MotionModule from its rapid, feed, probing and homing profiles
+    static motion_profile_t motion_profiles[(uint8_t)swordfish::motion::MotionClass::__size__];
+
+    // Set by MotionModule. The radius in mm the rotary axes' feed is taken at, or 0 for their own units
+    static f32 rotary_radius_mm;
+
+    // The profile for the moves of a machine state
+    static const motion_profile_t& motion_profile(const swordfish::status::MachineState machine_state) {
+      switch (machine_state) {
+        case swordfish::status::MachineState::RapidMove: return motion_profiles[(uint8_t)swordfish::motion::MotionClass::Rapid];
+        case swordfish::status::MachineState::Probing: return motion_profiles[(uint8_t)swordfish::motion::MotionClass::Probing];
+        case swordfish::status::MachineState::Homing: return motion_profiles[(uint8_t)swordfish::motion::MotionClass::Homing];
+        default: return motion_profiles[(uint8_t)swordfish::motion::MotionClass::Feed];
+      }
+    }
+
+    // The acceleration for the moves of a machine state, from its profile or else the settings
+    static f32 motion_acceleration(const swordfish::status::MachineState machine_state) {
+      return motion_profile(machine_state).acceleration
+        ?: (machine_state == swordfish::status::MachineState::RapidMove ? settings.travel_acceleration : settings.acceleration);
+    }
+
     #if ENABLED(LASER_POWER_INLINE)
       static laser_state_t laser_inline;
     #endif
@@ -386,6 +558,14 @@ class Planner {
       #endif
     #endif
 
+    #if HAS_S_CURVE_JERK
+      static float s_curve_jerk;                // (mm/s^3) M205 K
+    #endif
+
+    #if ENABLED(PATH_BLENDING)
+      static bool exact_stop;                   // G61.1 - Come to rest at the end of every move
+    #endif
+
     #if HAS_CLASSIC_JERK
       // (mm/s^2) M205 XYZ(E) - The largest speed change requiring no acceleration.
       static TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t) max_jerk;
@@ -470,7 +650,7 @@ class Planner {
       static last_move_t g_uc_extruder_last_move[EXTRUDERS];
     #endif
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
@@ -653,11 +833,26 @@ class Planner {
       }
     #endif // HAS_POSITION_MODIFIERS
 
+    /**
+     * Get the index of the next / previous block in the ring buffer.
+     * BLOCK_BUFFER_SIZE needn't be a power of 2, so wrap by comparison.
+     */
+    static constexpr block_index_t next_block_index(const block_index_t block_index) { return block_index == BLOCK_BUFFER_SIZE - 1 ? 0 : block_index + 1; }
+    static constexpr block_index_t prev_block_index(const block_index_t block_index) { return block_index ? block_index - 1 : BLOCK_BUFFER_SIZE - 1; }
+
+    // Number of blocks from one index up to another
+    static constexpr block_index_t block_distance(const block_index_t from, const block_index_t to) { return to >= from ? to - from : to + BLOCK_BUFFER_SIZE - from; }
+
     // Number of moves currently in the planner including the busy block, if any
-    FORCE_INLINE static uint8_t movesplanned() { return BLOCK_MOD(block_buffer_head - block_buffer_tail); }
+    FORCE_INLINE static block_index_t movesplanned() { return block_distance(block_buffer_tail, block_buffer_head); }
 
     // Number of nonbusy moves currently in the planner
-    FORCE_INLINE static uint8_t nonbusy_movesplanned() { return BLOCK_MOD(block_buffer_head - block_buffer_nonbusy); }
+    FORCE_INLINE static block_index_t nonbusy_movesplanned() { return block_distance(block_buffer_nonbusy, block_buffer_head); }
+
+    #if ENABLED(ARC_BLOCKS)
+      // Next slot in the arc ring buffer
+      static constexpr uint8_t next_arc_index(const uint8_t arc_index) { return arc_index == ARC_BLOCK_BUFFER_SIZE - 1 ? 0 : arc_index + 1; }
+    #endif
 
     // Remove all blocks from the buffer
     FORCE_INLINE static void clear_block_buffer() {
@@ -665,13 +860,17 @@ class Planner {
 			block_buffer_planned = 0;
 			block_buffer_head = 0;
 			block_buffer_tail = 0;
+			#if ENABLED(ARC_BLOCKS)
+				arc_buffer_head = 0;
+				arc_buffer_tail = 0;
+			#endif
 		}
 
     // Check if movement queue is full
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
 
     // Get count of movement slots free
-    FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
+    FORCE_INLINE static block_index_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
 
     /**
      * Planner::get_next_free_block
@@ -680,7 +879,7 @@ class Planner {
      * - Wait for the number of spaces to open up in the planner
      * - Return the first head block
      */
-    FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
+    FORCE_INLINE static block_t* get_next_free_block(block_index_t &next_buffer_head, const block_index_t count=1) {
 
       // Wait until there are enough slots free
       while (moves_free() < count) { idle(); }
@@ -699,6 +898,7 @@ class Planner {
      *  feed_rate     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the circle to follow, for an arc block
      *
      * Returns true if movement was buffered, false otherwise
      */
@@ -712,6 +912,9 @@ class Planner {
 			const swordfish::status::MachineState machine_state,
 			const float &millimeters = 0.0,
 			const float32_t accel_mm_s2 = 0.0
+      #if ENABLED(ARC_BLOCKS)
+        , const planner_arc_t* const arc = nullptr
+      #endif
     );
 
     /**
@@ -723,6 +926,7 @@ class Planner {
      *  feed_rate     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  arc         - the circle to follow, for an arc block
      *
      * Returns true is movement is acceptable, false otherwise
      */
@@ -738,6 +942,9 @@ class Planner {
 			const swordfish::status::MachineState machine_state,
 			const float &millimeters = 0.0,
 			const float32_t accel_mm_s2 = 0.0
+      #if ENABLED(ARC_BLOCKS)
+        , const planner_arc_t* const arc = nullptr
+      #endif
     );
 
     /**
@@ -746,6 +953,14 @@ class Planner {
      */
     static void buffer_sync_block();
 
+    /**
+     * Planner::buffer_dwell_block
+     * Add a block to the buffer that holds position for the given time
+     * without draining the queue. The moves on either side of it come
+     * to a stop at the dwell, which reports the given machine state.
+     */
+    static void buffer_dwell_block(const millis_t dwell_ms, const swordfish::status::MachineState machine_state);
+
   #if IS_KINEMATIC
     private:
 
@@ -796,6 +1011,33 @@ class Planner {
 			const float32_t accel_mm_s2 = 0.0
     );
 
+    #if ENABLED(ARC_BLOCKS)
+      /**
+       * Add an arc to the buffer as arc blocks, split where it crosses an
+       * axis of the circle so every axis moves one way in each block. The
+       * other axes move linearly along with it.
+       *
+       *  start          - start position in mm or degrees
+       *  cart           - target position in mm or degrees
+       *  center         - centre of the circle in the plane
+       *  angular_travel - signed angle to turn through, anticlockwise positive
+       *  p_axis, q_axis - the axes of the plane
+       *  feed_rate      - (target) speed of the move (mm/s)
+       *  extruder       - target extruder
+       */
+      static bool buffer_arc(
+        const swordfish::math::Vector6f32 &start,
+        const swordfish::math::Vector6f32 &cart,
+        const swordfish::math::Vector2f32 &center,
+        const float angular_travel,
+        const Axis p_axis,
+        const Axis q_axis,
+        const swordfish::motion::FeedRate &feed_rate,
+        const uint8_t extruder,
+        const swordfish::status::MachineState machine_state
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -826,6 +1068,13 @@ class Planner {
     static void set_machine_position_mm(const float &a, const float &b, const float &c, const float &e);
     FORCE_INLINE static void set_machine_position_mm(const swordfish::math::Vector6f32 &abce) { set_machine_position_mm(abce.x(), abce.y(), abce.z(), abce.a()); }
 
+    /**
+     * Take whole turns off a rotary axis. The planner and stepper
+     * counts move by the same number of steps, which is exact only
+     * when a turn is a whole number of steps.
+     */
+    static void unwind_axis(const Axis axis, const float32_t distance);
+
     /**
      * Get an axis position according to stepper position(s)
      * For CORE machines apply translation from ABC to XYZ.
@@ -852,6 +1101,14 @@ class Planner {
     // a Full Shutdown is required, or when endstops are hit)
     static void quick_stop();
 
+    #if ENABLED(JOGGING)
+      // Set by cancel_jog, so the jog being queued stops queuing
+      static bool jog_cancelled;
+
+      // Stop a jog as soon as the acceleration allows, keeping other moves
+      static void cancel_jog();
+    #endif
+
     // Called when an endstop is triggered. Causes the machine to stop inmediately
     static void endstop_triggered(const Axis axis);
 
@@ -894,7 +1151,7 @@ class Planner {
         block_buffer_tail = next_block_index(block_buffer_tail);
     }
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       static uint16_t block_buffer_runtime();
       static void clear_block_buffer_runtime();
     #endif
@@ -917,12 +1174,6 @@ class Planner {
 
   private:
 
-    /**
-     * Get the index of the next / previous block in the ring buffer
-     */
-    static constexpr uint8_t next_block_index(const uint8_t block_index) { return BLOCK_MOD(block_index + 1); }
-    static constexpr uint8_t prev_block_index(const uint8_t block_index) { return BLOCK_MOD(block_index - 1); }
-
     /**
      * Calculate the distance (not time) it takes to accelerate
      * from initial_rate to target_rate using the given acceleration:
@@ -951,9 +1202,47 @@ class Planner {
      * 'distance'.
      */
     static float max_allowable_speed_sqr(const float &accel, const float &target_velocity_sqr, const float &distance) {
-      return target_velocity_sqr - 2 * accel * distance;
+      const float speed_sqr = target_velocity_sqr - 2 * accel * distance;
+      #if HAS_S_CURVE_JERK
+        if (s_curve_jerk) return _MIN(speed_sqr, max_jerk_speed_sqr(target_velocity_sqr, distance));
+      #endif
+      return speed_sqr;
     }
 
+    #if HAS_S_CURVE_JERK
+      // Peak jerk of the stepper's Bézier speed curve is this times dv / t^2
+      static constexpr float s_curve_jerk_factor = 5.7735027f; // 10 / sqrt(3)
+
+      /**
+       * Calculate the maximum speed squared from which 'target_velocity_sqr'
+       * can be reached within 'distance' without the speed curve passing the
+       * jerk limit. A change of dv then takes t = sqrt(k dv / jerk) over
+       * (v + dv / 2) t, which is a cubic in u = sqrt(dv):
+       *
+       *   u^3 + 2 v u - 2 distance sqrt(jerk / k) = 0
+       *
+       * Newton's method converges on it from above.
+       */
+      static float max_jerk_speed_sqr(const float &target_velocity_sqr, const float &distance) {
+        const float v = SQRT(target_velocity_sqr),
+                    c = 2 * distance * SQRT(s_curve_jerk / s_curve_jerk_factor);
+        if (!c) return target_velocity_sqr;
+        float u = cbrtf(c);
+        if (v * u > 0.5f * c) u = 0.5f * c / v;
+        LOOP_L_N(i, 3) u -= (u * (sq(u) + 2 * v) - c) / (3 * sq(u) + 2 * v);
+        return sq(v + sq(u));
+      }
+
+      /**
+       * Calculate the time (s) the speed curve takes between two rates
+       * under the acceleration and jerk limits, all in steps.
+       */
+      static float s_curve_ramp_time(const float &low_rate, const float &high_rate, const float &accel, const float &jerk) {
+        const float dr = high_rate - low_rate;
+        return _MAX(dr / accel, SQRT(s_curve_jerk_factor * dr / jerk));
+      }
+    #endif
+
     #if ENABLED(S_CURVE_ACCELERATION)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
@@ -965,16 +1254,22 @@ class Planner {
 
     static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
 
-    static void reverse_pass_kernel(block_t* const current, const block_t * const next);
-    static void forward_pass_kernel(const block_t * const previous, block_t* const current, uint8_t block_index);
+    static bool reverse_pass_kernel(block_t* const current, const block_t * const next);
+    static void forward_pass_kernel(const block_t * const previous, block_t* const current, block_index_t block_index);
 
     static void reverse_pass();
     static void forward_pass();
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const block_index_t planned_block_index);
 
     static void recalculate();
 
+    // Scale the rotary components of a vector, e.g. from their units to the distance their surface travels
+    FORCE_INLINE static void scale_rotary(swordfish::math::Vector6f32 &vector, const f32 factor) {
+      for (auto axis : stepped_axes)
+        if (axis.is_radial()) vector[axis] *= factor;
+    }
+
     #if HAS_JUNCTION_DEVIATION
 
       FORCE_INLINE static void normalize_junction_vector(swordfish::math::Vector6f32 &vector) {
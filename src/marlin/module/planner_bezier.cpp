@@ -30,175 +30,232 @@
 
 #if ENABLED(BEZIER_CURVE_SUPPORT)
 
+#include <swordfish/Controller.h>
+
+using namespace swordfish;
+using namespace swordfish::math;
+using namespace swordfish::motion;
+using namespace swordfish::status;
+
 #include "planner.h"
 #include "motion.h"
 #include "temperature.h"
 
 #include "../MarlinCore.h"
-#include "../gcode/queue.h"
+#include "../gcode/gcode.h"
+
+// Deepest the curve is halved, 4096 lines at most
+#define BEZIER_MAX_DEPTH 12
 
-// See the meaning in the documentation of cubic_b_spline().
-#define MIN_STEP 0.002f
-#define MAX_STEP 0.1f
-#define SIGMA 0.1f
+// Points the curvature is sampled at to limit the feed
+#define BEZIER_CURVATURE_SAMPLES 32
 
-// Compute the linear interpolation between two real numbers.
-static inline float interp(const float &a, const float &b, const float &t) { return (1 - t) * a + t * b; }
+// A piece of the curve, as its four control points, and how many times it was halved
+typedef struct {
+  Vector2f32 p[4];
+  uint8_t depth;
+} bezier_piece_t;
 
 /**
- * Compute a Bézier curve using the De Casteljau's algorithm (see
- * https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm), which is
- * easy to code and has good numerical stability (very important,
- * since Arudino works with limited precision real numbers).
+ * Is the piece within BEZIER_TOLERANCE of its chord? This is the usual bound on how
+ * far a cubic strays from the line between its ends (Roger Willcocks), compared
+ * squared so it needs no roots.
  */
-static inline float eval_bezier(const float &a, const float &b, const float &c, const float &d, const float &t) {
-  const float iab = interp(a, b, t),
-              ibc = interp(b, c, t),
-              icd = interp(c, d, t),
-              iabc = interp(iab, ibc, t),
-              ibcd = interp(ibc, icd, t);
-  return interp(iabc, ibcd, t);
+static inline bool is_flat(const bezier_piece_t &piece) {
+  const Vector2f32 u = 3.0f * piece.p[1] - 2.0f * piece.p[0] - piece.p[3],
+                   v = 3.0f * piece.p[2] - piece.p[0] - 2.0f * piece.p[3];
+  return _MAX(sq(u.x()), sq(v.x())) + _MAX(sq(u.y()), sq(v.y())) <= 16 * sq(float(BEZIER_TOLERANCE));
 }
 
 /**
- * We approximate Euclidean distance with the sum of the coordinates
- * offset (so-called "norm 1"), which is quicker to compute.
+ * Halve a piece with De Casteljau's algorithm, which is simple and
+ * numerically stable in single precision.
  */
-static inline float dist1(const float &x1, const float &y1, const float &x2, const float &y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
+static inline void split(const bezier_piece_t &piece, bezier_piece_t &left, bezier_piece_t &right) {
+  const Vector2f32 ab = (piece.p[0] + piece.p[1]) * 0.5f,
+                   bc = (piece.p[1] + piece.p[2]) * 0.5f,
+                   cd = (piece.p[2] + piece.p[3]) * 0.5f,
+                   abc = (ab + bc) * 0.5f,
+                   bcd = (bc + cd) * 0.5f,
+                   mid = (abc + bcd) * 0.5f;
+
+  left = { { piece.p[0], ab, abc, mid }, uint8_t(piece.depth + 1) };
+  right = { { mid, bcd, cd, piece.p[3] }, uint8_t(piece.depth + 1) };
+}
 
 /**
- * The algorithm for computing the step is loosely based on the one in Kig
- * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
- * However, we do not use the stack.
- *
- * The algorithm goes as it follows: the parameters t runs from 0.0 to
- * 1.0 describing the curve, which is evaluated by eval_bezier(). At
- * each iteration we have to choose a step, i.e., the increment of the
- * t variable. By default the step of the previous iteration is taken,
- * and then it is enlarged or reduced depending on how straight the
- * curve locally is. The step is always clamped between MIN_STEP/2 and
- * 2*MAX_STEP. MAX_STEP is taken at the first iteration.
- *
- * For some t, the step value is considered acceptable if the curve in
- * the interval [t, t+step] is sufficiently straight, i.e.,
- * sufficiently close to linear interpolation. In practice the
- * following test is performed: the distance between eval_bezier(...,
- * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
- * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
- * seeks to find the larger step value which is considered acceptable.
- *
- * At every iteration the recorded step value is considered and then
- * iteratively halved until it becomes acceptable. If it was already
- * acceptable in the beginning (i.e., no halving were done), then
- * maybe it was necessary to enlarge it; then it is iteratively
- * doubled while it remains acceptable. The last acceptable value
- * found is taken, provided that it is between MIN_STEP and MAX_STEP
- * and does not bring t over 1.0.
+ * Walk the curve from start to end, halving pieces until each is flat enough,
+ * and pass the end of each flat piece to the callback. The pending right halves
+ * wait on a stack, which can't grow past BEZIER_MAX_DEPTH.
+ */
+template<typename F>
+static void flatten(const Vector2f32 (&control)[4], F &&line_to) {
+  bezier_piece_t stack[BEZIER_MAX_DEPTH + 1];
+  uint8_t count = 0;
+
+  stack[count++] = { { control[0], control[1], control[2], control[3] }, 0 };
+
+  while (count) {
+    const bezier_piece_t piece = stack[--count];
+
+    if (piece.depth >= BEZIER_MAX_DEPTH || is_flat(piece)) {
+      if (!line_to(piece.p[3]))
+        return;
+    } else {
+      split(piece, stack[count + 1], stack[count]);
+      count += 2;
+    }
+  }
+}
+
+/**
+ * The tightest radius along the curve, from its curvature |B' x B''| / |B'|^3
+ * sampled along it. Where the curve stops turning it is infinite.
+ */
+static float min_radius(const Vector2f32 (&control)[4]) {
+  const Vector2f32 d0 = control[1] - control[0],
+                   d1 = control[2] - control[1],
+                   d2 = control[3] - control[2],
+                   e0 = d1 - d0,
+                   e1 = d2 - d1;
+
+  float max_curvature = 0;
+
+  LOOP_LE_N(i, BEZIER_CURVATURE_SAMPLES) {
+    const float t = float(i) / (BEZIER_CURVATURE_SAMPLES), s = 1 - t;
+    const Vector2f32 velocity = 3.0f * (sq(s) * d0 + 2 * s * t * d1 + sq(t) * d2),
+                     acceleration = 6.0f * (s * e0 + t * e1);
+    const float speed = velocity.norm();
+
+    // A cusp is a corner, left to the junction speed
+    if (speed > 0.0001f)
+      NOLESS(max_curvature, ABS(velocity.x() * acceleration.y() - velocity.y() * acceleration.x()) / (speed * speed * speed));
+  }
+
+  return max_curvature ? 1 / max_curvature : INFINITY;
+}
+
+/**
+ * Widen a bounding box to take in a cubic along one axis: both ends, and the
+ * turning points where its derivative, a quadratic, is zero.
+ */
+static void bound_cubic(const float p0, const float p1, const float p2, const float p3, float &min, float &max) {
+  const float a = p3 - p0 + 3 * (p1 - p2),
+              b = 2 * (p0 - 2 * p1 + p2),
+              c = p1 - p0;
+
+  float roots[2];
+  uint8_t count = 0;
+
+  if (ABS(a) < 1e-9f) {
+    if (ABS(b) > 1e-9f)
+      roots[count++] = -c / b;
+  } else {
+    const float discriminant = sq(b) - 4 * a * c;
+    if (discriminant >= 0) {
+      const float root = SQRT(discriminant);
+      roots[count++] = (-b + root) / (2 * a);
+      roots[count++] = (-b - root) / (2 * a);
+    }
+  }
+
+  LOOP_L_N(i, count) {
+    const float t = roots[i], s = 1 - t;
+    if (t > 0 && t < 1) {
+      const float value = s * s * s * p0 + 3 * s * s * t * p1 + 3 * s * t * t * p2 + t * t * t * p3;
+      NOMORE(min, value);
+      NOLESS(max, value);
+    }
+  }
+}
+
+/**
+ * Queue a cubic Bézier curve in the XY plane as lines that stay within
+ * BEZIER_TOLERANCE of it. Flat stretches take few long lines and tight
+ * bends many short ones.
  *
- * Caveat: this algorithm is not perfect, since it can happen that a
- * step is considered acceptable even when the curve is not linear at
- * all in the interval [t, t+step] (but its mid point coincides "by
- * chance" with the midpoint according to the parametrization). This
- * kind of glitches can be eliminated with proper first derivative
- * estimates; however, given the improbability of such configurations,
- * the mitigation offered by MIN_STEP and the small computational
- * power available on Arduino, I think it is not wise to implement it.
+ * Ahead of that, the curve is walked once to measure it, so the other axes
+ * move in proportion to the length along it, and the tightest radius on it
+ * caps the feed for the whole curve so it can be followed without
+ * exceeding the acceleration. The whole curve is checked against the limits
+ * once, by its bounding box.
  */
 void cubic_b_spline(
-  const xyze_pos_t &position,       // current position
-  const xyze_pos_t &target,         // target position
-  const xy_pos_t (&offsets)[2],     // a pair of offsets
-  const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
+  const Vector6f32 &position,             // current position
+  const Vector6f32 &target,               // target position
+  const Vector2f32 (&offsets)[2],         // a pair of offsets
+  FeedRate feed_rate,                     // (target) speed of the move
   const uint8_t extruder
 ) {
   // Absolute first and second control points are recovered.
-  const xy_pos_t first = position + offsets[0], second = target + offsets[1];
+  const Vector2f32 start = { position.x(), position.y() },
+                   end = { target.x(), target.y() },
+                   control[4] = { start, start + offsets[0], end + offsets[1], end };
+
+  // The curve stays inside its bounding box, so the limits need checking only once
+  Vector3f32 min, max;
+  LOOP_L_N(i, 3) {
+    min[i] = _MIN(position[i], target[i]);
+    max[i] = _MAX(position[i], target[i]);
+  }
+  LOOP_L_N(i, 2) bound_cubic(control[0][i], control[1][i], control[2][i], control[3][i], min[i], max[i]);
+
+  auto &limits = MotionModule::getInstance().getLimits();
+  limits.throwIfOutside(min);
+  limits.throwIfOutside(max);
+
+  // Length along the flattened curve, in the plane
+  float plane_mm = 0;
+  Vector2f32 from = start;
+  flatten(control, [&](const Vector2f32 &to) {
+    plane_mm += (to - from).norm();
+    from = to;
+    return true;
+  });
+
+  const Vector6f32 travel = target - position;
+  const float linear_mm = SQRT(sq(plane_mm) + sq(travel.z()));
 
-  xyze_pos_t bez_target;
-  bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+  if (linear_mm < 0.001f)
+    return;
+
+  // An inverse time feed covers the whole curve
+  if (feed_rate.type() == FeedRateType::InverseTime)
+    feed_rate = FeedRate::UnitsPerSecond(feed_rate.value() * linear_mm);
+
+  // Fast enough round the tightest bend to need more than the acceleration? Slow the whole curve.
+  const float accel = _MIN(planner.motion_acceleration(MachineState::FeedMove), float(planner.settings.max_acceleration_unit_per_s2.x()), float(planner.settings.max_acceleration_unit_per_s2.y()));
+  if (plane_mm)
+    NOMORE(feed_rate.value(), SQRT(accel * min_radius(control)) * linear_mm / plane_mm);
 
   millis_t next_idle_ms = millis() + 200UL;
 
-  for (float t = 0; t < 1;) {
+  float along = 0;
+  from = start;
 
+  flatten(control, [&](const Vector2f32 &to) {
     thermalManager.manage_heater();
-    millis_t now = millis();
-    if (ELAPSED(now, next_idle_ms)) {
-      next_idle_ms = now + 200UL;
+    if (ELAPSED(millis(), next_idle_ms)) {
+      next_idle_ms = millis() + 200UL;
       idle();
     }
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
+    gcode.throwIfAborted();
 
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-    }
+    along += (to - from).norm();
+    from = to;
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
-      }
-    */
-
-    step = new_t - t;
-    t = new_t;
-
-    // Compute and send new position
-    xyze_pos_t new_bez = {
-      new_pos0, new_pos1,
-      interp(position.z, target.z, t),   // FIXME. These two are wrong, since the parameter t is
-      interp(position.e, target.e, t)    // not linear in the distance.
-    };
-    apply_motion_limits(new_bez);
-    bez_target = new_bez;
+    // The other axes move in proportion to the length along the curve
+    Vector6f32 raw = position + travel * (plane_mm ? along / plane_mm : 1);
+    raw.x() = to.x();
+    raw.y() = to.y();
 
     #if HAS_LEVELING && !PLANNER_LEVELING
-      xyze_pos_t pos = bez_target;
-      planner.apply_leveling(pos);
-    #else
-      const xyze_pos_t &pos = bez_target;
+      planner.apply_leveling(raw);
     #endif
 
-    if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, step))
-      break;
-  }
+    return planner.buffer_line(raw, feed_rate, extruder, MachineState::FeedMove);
+  });
 }
 
 #endif // BEZIER_CURVE_SUPPORT
@@ -27,12 +27,15 @@
  * Compute and buffer movement commands for Bézier curves
  */
 
+#include <swordfish/math.h>
+#include <swordfish/modules/motion/FeedRate.h>
+
 #include "../core/types.h"
 
 void cubic_b_spline(
-  const xyze_pos_t &position,       // current position
-  const xyze_pos_t &target,         // target position
-  const xy_pos_t (&offsets)[2],     // a pair of offsets
-  const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
+  const swordfish::math::Vector6f32 &position,    // current position
+  const swordfish::math::Vector6f32 &target,      // target position
+  const swordfish::math::Vector2f32 (&offsets)[2], // a pair of offsets
+  swordfish::motion::FeedRate feed_rate,          // (target) speed of the move
   const uint8_t extruder
 );
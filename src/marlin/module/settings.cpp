@@ -2713,6 +2713,8 @@ void MarlinSettings::reset() {
 	planner.junction_deviation_mm = float(JUNCTION_DEVIATION_MM);
 #endif
 
+	TERN_(HAS_S_CURVE_JERK, planner.s_curve_jerk = float(S_CURVE_MAX_JERK));
+
 #if HAS_SCARA_OFFSET
 	scara_home_offset.reset();
 #endif
@@ -3299,6 +3301,9 @@ void MarlinSettings::report(const bool forReplay) {
 #	if HAS_JUNCTION_DEVIATION
 			" J<junc_dev>"
 #	endif
+#	if HAS_S_CURVE_JERK
+			" K<s_curve_jerk>"
+#	endif
 #	if HAS_CLASSIC_JERK
 			" X<max_x_jerk> Y<max_y_jerk> Z<max_z_jerk>" TERN_(HAS_CLASSIC_E_JERK, " E<max_e_jerk>")
 #	endif
@@ -3310,6 +3315,10 @@ void MarlinSettings::report(const bool forReplay) {
 																																																																											,
 			PSTR(" J"), parser.linear_value_to_mm(planner.junction_deviation_mm)
 #	endif
+#	if HAS_S_CURVE_JERK
+			,
+			PSTR(" K"), LINEAR_UNIT(planner.s_curve_jerk)
+#	endif
 #	if HAS_CLASSIC_JERK
 											,
 			SP_X_STR, LINEAR_UNIT(planner.max_jerk.x), SP_Y_STR, LINEAR_UNIT(planner.max_jerk.y), SP_Z_STR, LINEAR_UNIT(planner.max_jerk.z)
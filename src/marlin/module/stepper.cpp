@@ -142,6 +142,11 @@ bool L64XX_OK_to_power_up = false; // flag to keep L64xx steppers powered down a
 bool Stepper::separate_multi_axis = false;
 #endif
 
+#if ENABLED(CONCURRENT_HOMING)
+bool Stepper::hold_on_endstop = false;
+volatile uint8_t Stepper::held_axes; // = 0
+#endif
+
 #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
 bool Stepper::initialized; // = false
 uint32_t Stepper::motor_current_setting[MOTOR_CURRENT_COUNT]; // Initialized by settings.load()
@@ -198,6 +203,11 @@ uint32_t Stepper::advance_divisor = 0,
 		Stepper::decelerate_after, // The count at which to start decelerating
 		Stepper::step_event_count; // The total event count for the current block
 
+#if ENABLED(ARC_BLOCKS)
+block_arc_t Stepper::arc;
+uint32_t Stepper::arc_steps[2];
+#endif
+
 #if EITHER(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER)
 uint8_t Stepper::stepper_extruder;
 #else
@@ -234,6 +244,28 @@ bool Stepper::LA_use_advance_lead;
 uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(MOTION_STATS)
+uint32_t Stepper::isr_max_cycles, Stepper::max_step_rate;
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+isr_profile_t Stepper::isr_profile[uint8_t(IsrPhase::Count)];
+uint32_t Stepper::isr_profile_block;
+#endif
+
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+prepared_block_t Stepper::prepared_blocks[STEPPER_PREPARED_BLOCKS],
+		Stepper::current_prepared;
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+uint32_t Stepper::nextShapingISR = SHAPING_NEVER,
+				 Stepper::shaping_clock;
+shaping_axis_t Stepper::shaping[2];
+uint8_t Stepper::shaper_axes,
+				Stepper::shaped_axes;
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
 page_step_state_t Stepper::page_step_state;
 #endif
@@ -557,11 +589,24 @@ void Stepper::set_directions() {
 		count_direction[_AXIS(A)] = 1; \
 	}
 
+#if ENABLED(INPUT_SHAPING)
+	// The shaper sets the DIR pin of a shaped axis as its steps go out
+#	define SET_SHAPED_DIR(A) \
+	if (TEST(shaped_axes, _AXIS(A))) { \
+		count_direction[_AXIS(A)] = motor_direction(_AXIS(A)) ? -1 : 1; \
+	} else { \
+		SET_STEP_DIR(A); \
+		shaping[_AXIS(A)].direction = count_direction[_AXIS(A)]; \
+	}
+#else
+#	define SET_SHAPED_DIR(A) SET_STEP_DIR(A)
+#endif
+
 #if HAS_X_DIR
-	SET_STEP_DIR(X);
+	SET_SHAPED_DIR(X);
 #endif
 #if HAS_Y_DIR
-	SET_STEP_DIR(Y);
+	SET_SHAPED_DIR(Y);
 #endif
 #if HAS_Z_DIR
 	SET_STEP_DIR(Z);
@@ -1358,7 +1403,7 @@ FORCE_INLINE int32_t Stepper::_eval_bezier_curve(const uint32_t curr_step) {
 	// For non ARM targets, we provide a fallback implementation. Really doubt it
 	// will be useful, unless the processor is fast and 32bit
 
-	uint32_t t = bezier_AV * curr_step; // t: Range 0 - 1^32 = 32 bits
+	uint32_t t = (uint64_t(bezier_AV) * curr_step) >> (PERIOD_INVERSE_EXTRA_BITS); // t: Range 0 - 1^32 = 32 bits
 	uint64_t f = t;
 	f *= t; // Range 32*2 = 64 bits (unsigned)
 	f >>= 32; // Range 32 bits  (unsigned)
@@ -1400,10 +1445,56 @@ HAL_STEP_TIMER_ISR() {
 #	define STEP_MULTIPLY(A, B) MultiU24X32toH16(A, B)
 #endif
 
+#if ENABLED(STEPPER_ISR_PROFILE)
+
+FORCE_INLINE void Stepper::isr_profile_record(const IsrPhase phase, const uint32_t cycles) {
+	static constexpr uint32_t limits_us[] = ISR_PROFILE_LIMITS_US;
+	isr_profile_t& profile = isr_profile[uint8_t(phase)];
+
+	profile.count++;
+
+	if (cycles > profile.max_cycles) {
+		profile.max_cycles = cycles;
+		profile.max_block = isr_profile_block;
+	}
+
+	uint8_t bucket = 0;
+	while (bucket < COUNT(limits_us) && cycles >= limits_us[bucket] * (F_CPU / 1000000UL))
+		bucket++;
+
+	profile.buckets[bucket]++;
+}
+
+void Stepper::reset_isr_profile() {
+	const bool was_enabled = suspend();
+	ZERO(isr_profile);
+	isr_profile_block = 0;
+	if (was_enabled)
+		wake_up();
+}
+
+// Time one phase of the ISR. Interrupts are on, so a phase includes any that preempt it.
+#	define ISR_PROFILED(PHASE, CALL) \
+		do { \
+			const uint32_t phase_start = getCycleCount(); \
+			CALL; \
+			isr_profile_record(IsrPhase::PHASE, getCycleCount() - phase_start); \
+		} while (0)
+
+#else
+
+#	define ISR_PROFILED(PHASE, CALL) CALL
+
+#endif
+
 void Stepper::isr() {
 
 	static uint32_t nextMainISR = 0; // Interval until the next main Stepper Pulse phase (0 = Now)
 
+#if EITHER(MOTION_STATS, STEPPER_ISR_PROFILE)
+	const uint32_t isr_start = getCycleCount();
+#endif
+
 #ifndef __AVR__
 	                                 // Disable interrupts, to avoid ISR preemption while we reprogram the period
 	// (AVR enters the ISR with global interrupts disabled, so no need to do it here)
@@ -1428,23 +1519,28 @@ void Stepper::isr() {
 		ENABLE_ISRS();
 
 		if (!nextMainISR)
-			pulse_phase_isr(); // 0 = Do coordinated axes Stepper pulses
+			ISR_PROFILED(Pulse, pulse_phase_isr()); // 0 = Do coordinated axes Stepper pulses
+
+#if ENABLED(INPUT_SHAPING)
+		if (!nextShapingISR)
+			ISR_PROFILED(Shaping, nextShapingISR = shaping_isr()); // 0 = Play back shaped X/Y steps that are due
+#endif
 
 #if ENABLED(LIN_ADVANCE)
 		if (!nextAdvanceISR)
-			nextAdvanceISR = advance_isr(); // 0 = Do Linear Advance E Stepper pulses
+			ISR_PROFILED(Advance, nextAdvanceISR = advance_isr()); // 0 = Do Linear Advance E Stepper pulses
 #endif
 
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 		const bool is_babystep = (nextBabystepISR == 0); // 0 = Do Babystepping (XY)Z pulses
 		if (is_babystep)
-			nextBabystepISR = babystepping_isr();
+			ISR_PROFILED(Babystep, nextBabystepISR = babystepping_isr());
 #endif
 
 		// ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
 		if (!nextMainISR)
-			nextMainISR = block_phase_isr(); // Manage acc/deceleration, get next block
+			ISR_PROFILED(Block, nextMainISR = block_phase_isr()); // Manage acc/deceleration, get next block
 
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 		if (is_babystep) // Avoid ANY stepping too soon after baby-stepping
@@ -1464,6 +1560,10 @@ void Stepper::isr() {
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 				,
 				nextBabystepISR // Come back early for Babystepping?
+#endif
+#if ENABLED(INPUT_SHAPING)
+				,
+				nextShapingISR // Come back early for a shaped step?
 #endif
 				,
 				uint32_t(HAL_TIMER_TYPE_MAX) // Come back in a very long time
@@ -1488,6 +1588,13 @@ void Stepper::isr() {
 			nextBabystepISR -= interval;
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+		if (nextShapingISR != SHAPING_NEVER)
+			nextShapingISR -= interval;
+
+		shaping_clock += interval;
+#endif
+
 		/**
 		 * This needs to avoid a race-condition caused by interleaving
 		 * of interrupts required by both the LA and Stepper algorithms.
@@ -1556,6 +1663,12 @@ void Stepper::isr() {
 	// Set the next ISR to fire at the proper time
 	HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(next_isr_ticks));
 
+#if EITHER(MOTION_STATS, STEPPER_ISR_PROFILE)
+	const uint32_t isr_cycles = getCycleCount() - isr_start;
+	TERN_(MOTION_STATS, NOLESS(isr_max_cycles, isr_cycles));
+	TERN_(STEPPER_ISR_PROFILE, isr_profile_record(IsrPhase::Isr, isr_cycles));
+#endif
+
 	// Don't forget to finally reenable interrupts
 	ENABLE_ISRS();
 }
@@ -1567,6 +1680,49 @@ void Stepper::isr() {
 #	define ISR_MULTI_STEPS 1
 #endif
 
+#if ENABLED(INPUT_SHAPING)
+
+// Play the delayed impulses of the oldest queued step now, freeing its slot
+void Stepper::shaping_play_oldest(shaping_axis_t& shaper) {
+	const uint16_t oldest = shaper.cursor[shaper.impulses - 1];
+	const bool forward = shaper.queue[oldest] & 1;
+
+	for (uint8_t k = 1; k < shaper.impulses; k++) {
+		uint16_t& cursor = shaper.cursor[k];
+
+		if (cursor == oldest) {
+			shaper.error += forward ? shaper.amplitude[k] : -shaper.amplitude[k];
+
+			if (++cursor == SHAPING_BUFFER_SIZE)
+				cursor = 0;
+		}
+	}
+}
+
+// Queue a commanded step of a shaped axis and apply its first impulse
+FORCE_INLINE void Stepper::shaping_queue_step(shaping_axis_t& shaper, const int8_t direction) {
+	shaper.lag += direction;
+
+	nextShapingISR = 0;
+
+	uint16_t next = shaper.head + 1;
+	if (next == SHAPING_BUFFER_SIZE)
+		next = 0;
+
+	// The planner keeps the step rate within what the queue holds. Should it
+	// fill anyway, the oldest step ends early, at most one step sooner.
+	if (next == shaper.cursor[shaper.impulses - 1])
+		shaping_play_oldest(shaper);
+
+	const int32_t first = shaper.amplitude[0];
+
+	shaper.error += direction > 0 ? first : -first;
+	shaper.queue[shaper.head] = (shaping_clock & ~1UL) | (direction > 0);
+	shaper.head = next;
+}
+
+#endif
+
 /**
  * This phase of the ISR should ONLY create the pulses for the steppers.
  * This prevents jitter caused by the interval between the start of the
@@ -1604,14 +1760,20 @@ void Stepper::pulse_phase_isr() {
 #define _APPLY_STEP(AXIS, INV, ALWAYS) AXIS##_APPLY_STEP(INV, ALWAYS)
 #define _INVERT_STEP_PIN(AXIS)         INVERT_##AXIS##_STEP_PIN
 
+// An axis held at its endstop drops its steps while the others go on
+#define PULSE_HELD(AXIS) TERN0(CONCURRENT_HOMING, TEST(held_axes, _AXIS(AXIS)))
+
 // Determine if a pulse is needed using Bresenham
 #define PULSE_PREP(AXIS) \
 	do { \
 		delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
 		step_needed[_AXIS(AXIS)] = (delta_error[_AXIS(AXIS)] >= 0); \
 		if (step_needed[_AXIS(AXIS)]) { \
-			count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
 			delta_error[_AXIS(AXIS)] -= advance_divisor; \
+			if (PULSE_HELD(AXIS)) \
+				step_needed[_AXIS(AXIS)] = false; \
+			else \
+				count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
 		} \
 	} while (0)
 
@@ -1769,6 +1931,54 @@ void Stepper::pulse_phase_isr() {
 #if HAS_C_STEP
 			PULSE_PREP(C);
 #endif
+
+#if ENABLED(ARC_BLOCKS)
+			// Turn the radius vector on by a step event, and step each plane axis
+			// whose progress round the circle now rounds past the steps it has taken
+			if (IS_ARC(current_block)) {
+				// Compensated sums, so the turns' rounding doesn't pile up over a long arc
+				const float x = arc.radius[0], y = arc.radius[1],
+				            dx = -(arc.turn_k * x + arc.turn_s * y) - arc.carry[0],
+				            dy = (arc.turn_s * x - arc.turn_k * y) - arc.carry[1];
+				arc.radius[0] = x + dx;
+				arc.radius[1] = y + dy;
+				arc.carry[0] = (arc.radius[0] - x) - dx;
+				arc.carry[1] = (arc.radius[1] - y) - dy;
+
+				// Step events still to come after this one
+				const int32_t events_left = step_event_count - step_events_completed + events_to_do - 1;
+
+				LOOP_L_N(i, 2) {
+					const uint8_t axis = arc.axis[i];
+					const int32_t steps = current_block->steps[axis];
+
+					// Never past the end, nor so far behind that the rest of the block can't catch up
+					int32_t target = int32_t(arc.offset[i] + arc.radius[i] * arc.scale[i] + 0.5f);
+					NOMORE(target, steps);
+					NOLESS(target, steps - events_left);
+
+					step_needed[axis] = target > int32_t(arc_steps[i]);
+					if (step_needed[axis]) {
+						arc_steps[i]++;
+						count_position[axis] += count_direction[axis];
+					}
+				}
+			}
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+// Hand the steps of shaped axes to the shaper, which sends them on
+#	define PULSE_SHAPE(AXIS) \
+	do { \
+		if (step_needed[_AXIS(AXIS)] && TEST(shaped_axes, _AXIS(AXIS))) { \
+			shaping_queue_step(shaping[_AXIS(AXIS)], count_direction[_AXIS(AXIS)]); \
+			step_needed[_AXIS(AXIS)] = false; \
+		} \
+	} while (0)
+
+			PULSE_SHAPE(X);
+			PULSE_SHAPE(Y);
+#endif
 		}
 
 #if ISR_MULTI_STEPS
@@ -1836,6 +2046,196 @@ void Stepper::pulse_phase_isr() {
 	} while (--events_to_do);
 }
 
+#if ENABLED(INPUT_SHAPING)
+
+/**
+ * Apply the delayed impulses of the queued steps that are due, then step
+ * each shaped motor until it is within half a step of the shaped position.
+ * Returns the time until the next impulse is due.
+ */
+uint32_t Stepper::shaping_isr() {
+	uint32_t interval = SHAPING_NEVER;
+
+	LOOP_L_N(i, COUNT(shaping)) {
+		shaping_axis_t& shaper = shaping[i];
+
+		for (uint8_t k = 1; k < shaper.impulses; k++) {
+			uint16_t& cursor = shaper.cursor[k];
+
+			while (cursor != shaper.head) {
+				const uint32_t stamp = shaper.queue[cursor],
+											 age = shaping_clock - (stamp & ~1UL);
+
+				if (age < shaper.delay[k]) {
+					NOMORE(interval, shaper.delay[k] - age);
+					break;
+				}
+
+				shaper.error += (stamp & 1) ? shaper.amplitude[k] : -shaper.amplitude[k];
+
+				if (++cursor == SHAPING_BUFFER_SIZE)
+					cursor = 0;
+			}
+		}
+	}
+
+// Take the next motor step of a shaped axis, setting its DIR pin first if needed
+#	define SHAPING_PREP(AXIS) \
+	do { \
+		shaping_axis_t& shaper = shaping[_AXIS(AXIS)]; \
+		const int8_t direction = shaper.error >= SHAPING_HALF ? 1 : shaper.error < -SHAPING_HALF ? -1 : 0; \
+		step_needed[_AXIS(AXIS)] = direction; \
+		if (direction) { \
+			if (direction != shaper.direction) { \
+				DIR_WAIT_BEFORE(); \
+				AXIS##_APPLY_DIR(direction > 0 ? !INVERT_##AXIS##_DIR : INVERT_##AXIS##_DIR, false); \
+				shaper.direction = direction; \
+				dir_changed = true; \
+			} \
+			shaper.error -= direction * SHAPING_ONE; \
+			shaper.lag -= direction; \
+		} \
+	} while (0)
+
+#	if ISR_MULTI_STEPS
+	bool firstStep = true;
+	USING_TIMED_PULSE();
+#	endif
+	bool step_needed[2];
+
+	for (;;) {
+		bool dir_changed = false;
+
+		SHAPING_PREP(X);
+		SHAPING_PREP(Y);
+
+		if (!step_needed[_AXIS(X)] && !step_needed[_AXIS(Y)])
+			break;
+
+		if (dir_changed)
+			DIR_WAIT_AFTER();
+
+#	if ISR_MULTI_STEPS
+		if (firstStep)
+			firstStep = false;
+		else
+			AWAIT_LOW_PULSE();
+#	endif
+
+		PULSE_START(X);
+		PULSE_START(Y);
+
+#	if ISR_MULTI_STEPS
+		START_HIGH_PULSE();
+		AWAIT_HIGH_PULSE();
+#	endif
+
+		PULSE_STOP(X);
+		PULSE_STOP(Y);
+
+#	if ISR_MULTI_STEPS
+		START_LOW_PULSE();
+#	endif
+	}
+
+	return interval;
+}
+
+void Stepper::set_shaping(const Axis axis, const ShaperType type, const float frequency, const float damping) {
+	// Ringing decays by k over each half period, so each impulse is k times the last
+	const float damped = SQRT(1 - sq(damping)),
+							k = exp(-damping * float(M_PI) / damped),
+							half_period = 0.5f / (frequency * damped);
+
+	float amplitude[SHAPING_MAX_IMPULSES];
+	uint8_t impulses = 0;
+
+	switch (type) {
+		case ShaperType::ZV:
+			impulses = 2;
+			amplitude[0] = 1;
+			amplitude[1] = k;
+			break;
+
+		case ShaperType::ZVD:
+			impulses = 3;
+			amplitude[0] = 1;
+			amplitude[1] = 2 * k;
+			amplitude[2] = sq(k);
+			break;
+
+		case ShaperType::EI: {
+			constexpr float vibration = 0.05f; // Residual vibration allowed at the design frequency
+			impulses = 3;
+			amplitude[0] = 0.25f * (1 + vibration);
+			amplitude[1] = 0.5f * (1 - vibration) * k;
+			amplitude[2] = 0.25f * (1 + vibration) * sq(k);
+		} break;
+
+		default:
+			break;
+	}
+
+	float total = 0;
+	LOOP_L_N(i, impulses) {
+		total += amplitude[i];
+	}
+
+	// Wait for the steps queued with the old shaper to play out
+	planner.synchronize();
+
+	const bool was_enabled = suspend();
+
+	shaping_axis_t& shaper = shaping[axis];
+
+	// The impulses add up to exactly one step
+	int32_t remaining = SHAPING_ONE;
+
+	LOOP_L_N(i, impulses) {
+		shaper.amplitude[i] = i < impulses - 1 ? LROUND(amplitude[i] / total * SHAPING_ONE) : remaining;
+		shaper.delay[i] = LROUND(i * half_period * (STEPPER_TIMER_RATE));
+		remaining -= shaper.amplitude[i];
+	}
+
+	shaper.impulses = impulses;
+	shaper.head = 0;
+	LOOP_L_N(i, SHAPING_MAX_IMPULSES) {
+		shaper.cursor[i] = 0;
+	}
+	shaper.error = shaper.lag = 0;
+
+	// The queue holds the steps of the longest delay, one slot kept free
+	shaper.max_rate = impulses ? (SHAPING_BUFFER_SIZE - 1) * uint64_t(STEPPER_TIMER_RATE) / shaper.delay[impulses - 1] : 0;
+
+	SET_BIT_TO(shaper_axes, axis, impulses);
+
+	if (was_enabled)
+		wake_up();
+}
+
+void Stepper::discard_shaping() {
+	const bool was_enabled = suspend();
+
+	LOOP_L_N(i, COUNT(shaping)) {
+		shaping_axis_t& shaper = shaping[i];
+
+		count_position[i] -= shaper.lag;
+
+		shaper.head = 0;
+		LOOP_L_N(k, SHAPING_MAX_IMPULSES) {
+			shaper.cursor[k] = 0;
+		}
+		shaper.error = shaper.lag = 0;
+	}
+
+	nextShapingISR = SHAPING_NEVER;
+
+	if (was_enabled)
+		wake_up();
+}
+
+#endif // INPUT_SHAPING
+
 void Stepper::update_state() {
 	using namespace swordfish::status;
 
@@ -1897,6 +2297,7 @@ uint32_t Stepper::block_phase_isr() {
 #endif
 
 				// acc_step_rate is in steps/second
+				TERN_(MOTION_STATS, NOLESS(max_step_rate, acc_step_rate));
 
 				// step_rate to timer interval and steps per stepper isr
 				interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
@@ -1940,7 +2341,11 @@ uint32_t Stepper::block_phase_isr() {
 				// If this is the 1st time we process the 2nd half of the trapezoid...
 				if (!bezier_2nd_half) {
 					// Initialize the Bézier speed curve
+#	if ENABLED(STEPPER_PREPARE_BLOCKS)
+					_load_bezier_curve_coeffs(current_prepared.decel);
+#	else
 					_calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+#	endif
 					bezier_2nd_half = true;
 					// The first point starts at cruise rate. Just save evaluation of the Bézier curve
 					step_rate = current_block->cruise_rate;
@@ -1962,6 +2367,7 @@ uint32_t Stepper::block_phase_isr() {
 #endif
 
 				// step_rate is in steps/second
+				TERN_(MOTION_STATS, NOLESS(max_step_rate, step_rate));
 
 				// step_rate to timer interval and steps per stepper isr
 				interval = calc_timer_interval(step_rate, &steps_per_isr);
@@ -2009,7 +2415,13 @@ uint32_t Stepper::block_phase_isr() {
 				// Calculate the ticks_nominal for this nominal speed, if not done yet
 				if (ticks_nominal < 0) {
 					// step_rate to timer interval and loops for the nominal speed
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+					ticks_nominal = current_prepared.nominal_interval;
+					steps_per_isr = current_prepared.nominal_loops;
+#else
 					ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
+#endif
+					TERN_(MOTION_STATS, NOLESS(max_step_rate, current_block->nominal_rate));
 				}
 
 				// The timer interval is just the nominal value for the nominal speed
@@ -2038,6 +2450,12 @@ uint32_t Stepper::block_phase_isr() {
 	// and prepare its movement
 	if (!current_block) {
 
+#if ENABLED(INPUT_SHAPING)
+		// A homing move waits for the shaped steps before it to play out
+		if (is_shaping() && planner.has_blocks_queued() && planner.block_buffer[planner.block_buffer_tail].machine_state == MachineState::Homing)
+			return interval;
+#endif
+
 		// Anything in the buffer?
 		if ((current_block = planner.get_current_block())) {
 
@@ -2056,10 +2474,38 @@ uint32_t Stepper::block_phase_isr() {
 
 			update_state();
 
+			TERN_(STEPPER_ISR_PROFILE, isr_profile_block++);
+
+#if ENABLED(INPUT_SHAPING)
+			// Homing moves stop on a switch, so they go to the motors unshaped
+			const uint8_t shaped = current_block->machine_state == MachineState::Homing ? 0 : shaper_axes;
+			const bool shaping_changed = shaped != shaped_axes;
+			shaped_axes = shaped;
+#endif
+
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+			// Take the setup the main loop prepared, or prepare it now if it didn't get to this block
+			prepared_block_t& slot = prepared_slot(current_block);
+			if (slot.block == current_block) {
+				current_prepared = slot;
+				slot.block = nullptr;
+			} else
+				prepare_block(current_block, current_prepared);
+
+			// Flag all moving axes for proper endstop handling
+			axis_did_move = current_prepared.axis_bits;
+
+			// No acceleration / deceleration time elapsed so far
+			acceleration_time = deceleration_time = 0;
+
+			TERN_(ADAPTIVE_STEP_SMOOTHING, oversampling_factor = current_prepared.oversampling);
+
+			step_event_count = current_prepared.step_event_count;
+#else
 			// Flag all moving axes for proper endstop handling
 			uint8_t axis_bits = 0;
 
-			for (auto axis : all_axes) {
+			for (auto axis : stepped_axes) {
 				if (!!current_block->steps[axis]) {
 					SBI(axis_bits, axis);
 				}
@@ -2070,7 +2516,7 @@ uint32_t Stepper::block_phase_isr() {
 			// No acceleration / deceleration time elapsed so far
 			acceleration_time = deceleration_time = 0;
 
-#if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+#	if ENABLED(ADAPTIVE_STEP_SMOOTHING)
 			uint8_t oversampling = 0; // Assume no axis smoothing (via oversampling)
 			// Decide if axis smoothing is possible
 			uint32_t max_rate = current_block->nominal_rate; // Get the step event rate
@@ -2080,14 +2526,15 @@ uint32_t Stepper::block_phase_isr() {
 					++oversampling; // Increase the oversampling (used for left-shift)
 			}
 			oversampling_factor = oversampling; // For all timer interval calculations
-#else
+#	else
 			constexpr uint8_t oversampling = 0;
-#endif
+#	endif
 
 			// Based on the oversampling factor, do the calculations
 			step_event_count = current_block->step_event_count << oversampling;
+#endif
 
-			for (auto axis : all_axes) {
+			for (auto axis : stepped_axes) {
 				// Initialize Bresenham delta errors to 1/2
 				delta_error[axis] = -i32(step_event_count);
 
@@ -2097,12 +2544,27 @@ uint32_t Stepper::block_phase_isr() {
 
 			advance_divisor = step_event_count << 1;
 
+#if ENABLED(ARC_BLOCKS)
+			// An arc block takes its circle, freeing the slot, and steps its plane axes round it
+			if (IS_ARC(current_block)) {
+				arc = planner.arc_buffer[current_block->arc_index];
+				planner.arc_buffer_tail = planner.next_arc_index(current_block->arc_index);
+				arc_steps[0] = arc_steps[1] = 0;
+				advance_dividend[arc.axis[0]] = advance_dividend[arc.axis[1]] = 0;
+			}
+#endif
+
 			// No step events completed so far
 			step_events_completed = 0;
 
 			// Compute the acceleration and deceleration points
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+			accelerate_until = current_prepared.accelerate_until;
+			decelerate_after = current_prepared.decelerate_after;
+#else
 			accelerate_until = current_block->accelerate_until << oversampling;
 			decelerate_after = current_block->decelerate_after << oversampling;
+#endif
 
 #if ENABLED(MIXING_EXTRUDER)
 			MIXER_STEPPER_SETUP();
@@ -2129,7 +2591,8 @@ uint32_t Stepper::block_phase_isr() {
 
 			if (ENABLED(HAS_L64XX) // Always set direction for L64xx (Also enables the chips)
 			    || ENABLED(DUAL_X_CARRIAGE) // TODO: Find out why this fixes "jittery" small circles
-			    || current_block->direction_bits != last_direction_bits || TERN(MIXING_EXTRUDER, false, stepper_extruder != last_moved_extruder)) {
+			    || current_block->direction_bits != last_direction_bits || TERN(MIXING_EXTRUDER, false, stepper_extruder != last_moved_extruder)
+			    || TERN0(INPUT_SHAPING, shaping_changed)) {
 				TERN_(HAS_MULTI_EXTRUDER, last_moved_extruder = stepper_extruder);
 				TERN_(HAS_L64XX, L64XX_OK_to_power_up = true);
 				set_directions(current_block->direction_bits);
@@ -2188,7 +2651,11 @@ uint32_t Stepper::block_phase_isr() {
 
 #if ENABLED(S_CURVE_ACCELERATION)
 			// Initialize the Bézier speed curve
+#	if ENABLED(STEPPER_PREPARE_BLOCKS)
+			_load_bezier_curve_coeffs(current_prepared.accel);
+#	else
 			_calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
+#	endif
 			// We haven't started the 2nd half of the trapezoid
 			bezier_2nd_half = false;
 #else
@@ -2197,7 +2664,12 @@ uint32_t Stepper::block_phase_isr() {
 #endif
 
 			// Calculate the initial timer interval
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+			interval = current_prepared.initial_interval;
+			steps_per_isr = current_prepared.initial_loops;
+#else
 			interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+#endif
 		} else {
 			// No new block found; so apply inline laser parameters
 
@@ -2235,6 +2707,90 @@ uint32_t Stepper::babystepping_isr() {
 
 #endif
 
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+
+#	if ENABLED(S_CURVE_ACCELERATION)
+void Stepper::_calc_bezier_curve_coeffs(bezier_coeffs_t& coeffs, const int32_t v0, const int32_t v1, const uint32_t av) {
+	coeffs.A = 768 * (v1 - v0);
+	coeffs.B = 1920 * (v0 - v1);
+	coeffs.C = 1280 * (v1 - v0);
+	coeffs.F = 128 * v0;
+	coeffs.AV = av;
+}
+#	endif
+
+void Stepper::prepare_block(const block_t* const block, prepared_block_t& prepared) {
+	prepared.block = block;
+
+	prepared.axis_bits = 0;
+	for (auto axis : stepped_axes) {
+		if (!!block->steps[axis]) {
+			SBI(prepared.axis_bits, axis);
+		}
+	}
+
+#	if ENABLED(ADAPTIVE_STEP_SMOOTHING)
+	uint8_t oversampling = 0; // Assume no axis smoothing (via oversampling)
+	// Decide if axis smoothing is possible
+	uint32_t max_rate = block->nominal_rate; // Get the step event rate
+	while (max_rate < MIN_STEP_ISR_FREQUENCY) { // As long as more ISRs are possible...
+		max_rate <<= 1; // Try to double the rate
+		if (max_rate < MIN_STEP_ISR_FREQUENCY) // Don't exceed the estimated ISR limit
+			++oversampling; // Increase the oversampling (used for left-shift)
+	}
+#	else
+	constexpr uint8_t oversampling = 0;
+#	endif
+	prepared.oversampling = oversampling;
+
+	// Based on the oversampling factor, do the calculations
+	prepared.step_event_count = block->step_event_count << oversampling;
+	prepared.accelerate_until = block->accelerate_until << oversampling;
+	prepared.decelerate_after = block->decelerate_after << oversampling;
+
+	prepared.initial_interval = calc_timer_interval(block->initial_rate, oversampling, &prepared.initial_loops);
+	prepared.nominal_interval = calc_timer_interval(block->nominal_rate, oversampling, &prepared.nominal_loops);
+
+#	if ENABLED(S_CURVE_ACCELERATION)
+	_calc_bezier_curve_coeffs(prepared.accel, block->initial_rate, block->cruise_rate, block->acceleration_time_inverse);
+	_calc_bezier_curve_coeffs(prepared.decel, block->cruise_rate, block->final_rate, block->deceleration_time_inverse);
+#	endif
+}
+
+void Stepper::prepare_blocks() {
+	// The ISR moves the nonbusy index on, so read it once
+	block_index_t block_index = planner.block_buffer_nonbusy;
+	const block_index_t head_block_index = planner.block_buffer_head;
+
+	for (uint8_t i = 0; i < STEPPER_PREPARED_BLOCKS && block_index != head_block_index; i++, block_index = planner.next_block_index(block_index)) {
+		const block_t* const block = &planner.block_buffer[block_index];
+
+		// Still being planned? So are the blocks after it.
+		if (TEST(block->flag, BLOCK_BIT_RECALCULATE))
+			break;
+
+		// Only moves need setting up
+		if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION) || IS_DWELL(block) || IS_PAGE(block))
+			continue;
+
+		prepared_block_t& slot = prepared_slot(block);
+		if (slot.block == block)
+			continue;
+
+		prepared_block_t prepared;
+		prepare_block(block, prepared);
+
+		// The ISR may have started the block meanwhile, and then it must not find it
+		const bool was_enabled = suspend();
+		if (planner.block_distance(planner.block_buffer_nonbusy, block_index) < planner.nonbusy_movesplanned())
+			slot = prepared;
+		if (was_enabled)
+			wake_up();
+	}
+}
+
+#endif
+
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
@@ -2461,6 +3017,11 @@ void Stepper::_set_position(const Vector6i32& position) {
 	count_position = position;
 }
 
+// A sync block only carries the stepped axes
+void Stepper::_set_position(const block_position_t& position) {
+	count_position.head<STEPPED_AXES>() = position;
+}
+
 /**
  * Get a stepper's position in steps.
  */
@@ -2492,6 +3053,23 @@ void Stepper::set_axis_position(const Axis a, const int32_t& v) {
 void Stepper::endstop_triggered(const Axis axis) {
 
 	const bool was_enabled = suspend();
+
+#if ENABLED(CONCURRENT_HOMING)
+	// Hold just this axis where it triggered, and let the others go on to theirs
+	if (hold_on_endstop && current_block) {
+		if (!TEST(held_axes, axis)) {
+			endstops_trigsteps[axis] = count_position[axis];
+			SBI(held_axes, axis);
+		}
+
+		if (axis_did_move & ~held_axes) {
+			if (was_enabled)
+				wake_up();
+			return;
+		}
+	}
+#endif
+
 	endstops_trigsteps[axis] = (
 #if IS_CORE
 			(axis == CORE_AXIS_2
@@ -2510,6 +3088,9 @@ void Stepper::endstop_triggered(const Axis axis) {
 	// Discard the rest of the move if there is a current block
 	quick_stop();
 
+	// And the shaped steps still to go
+	TERN_(INPUT_SHAPING, discard_shaping());
+
 	if (was_enabled)
 		wake_up();
 }
@@ -234,6 +234,85 @@
 // Perhaps DISABLE_MULTI_STEPPING should be required with ADAPTIVE_STEP_SMOOTHING.
 #define MIN_STEP_ISR_FREQUENCY (MAX_STEP_ISR_FREQUENCY_1X / 2)
 
+#if ENABLED(INPUT_SHAPING)
+
+  // Impulses in the longest shaper (ZVD, EI)
+  #define SHAPING_MAX_IMPULSES 3
+
+  // Steps each queue holds: one period of the slowest shaper, with room for damping
+  #define SHAPING_BUFFER_SIZE ((SHAPING_MAX_STEPRATE) / (SHAPING_MIN_FREQ) * 5 / 4)
+
+  enum class ShaperType : uint8_t { None, ZV, ZVD, EI };
+
+  /**
+   * The input shaper of one axis. Each commanded step is split into impulses
+   * that add up to one step, played back after their delays. A step goes to
+   * the motor each time the shaped position gets half a step ahead of it.
+   */
+  typedef struct {
+    uint8_t impulses;                            // Impulses in the shaper (0 = not shaped)
+    uint32_t delay[SHAPING_MAX_IMPULSES];        // (ticks) Delay of each impulse after its step
+    int32_t amplitude[SHAPING_MAX_IMPULSES];     // Share of a step for each impulse, of SHAPING_ONE
+    uint32_t queue[SHAPING_BUFFER_SIZE];         // Time of each queued step, with its direction in bit 0
+    uint16_t head,                               // Where the next step is queued
+             cursor[SHAPING_MAX_IMPULSES];       // Next step to play back for each delayed impulse
+    int32_t error;                               // Shaped position ahead of the motor, of SHAPING_ONE
+    int32_t lag;                                 // Commanded steps not yet sent to the motor
+    int8_t direction;                            // Direction the DIR pin is set to
+    uint32_t max_rate;                           // (steps/s) Fastest the queue holds the steps of the delay
+  } shaping_axis_t;
+
+  #define SHAPING_ONE  0x10000L
+  #define SHAPING_HALF (SHAPING_ONE / 2)
+
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+
+  // The parts of the Stepper ISR that are timed. IsrPhase::Isr is the whole of it.
+  enum class IsrPhase : uint8_t { Isr, Pulse, Shaping, Advance, Babystep, Block, Count };
+
+  // Upper bounds (exclusive) of the histogram buckets in µs, the last bucket is unbounded
+  #define ISR_PROFILE_LIMITS_US { 1, 2, 5, 10, 20, 50, 100 }
+  #define ISR_PROFILE_BUCKETS 8
+
+  typedef struct {
+    uint32_t count,                              // Times the phase ran
+             max_cycles,                         // Its longest run
+             max_block;                          // The block (counted from the reset) the longest run was in
+    uint32_t buckets[ISR_PROFILE_BUCKETS];       // Runs by duration
+  } isr_profile_t;
+
+#endif
+
+#if ENABLED(STEPPER_PREPARE_BLOCKS)
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    typedef struct {
+      int32_t A, B, C;                           // Bézier speed curve coefficients
+      uint32_t F, AV;
+    } bezier_coeffs_t;
+  #endif
+
+  // What the Stepper ISR sets up when it starts a block, worked out in the main loop
+  typedef struct {
+    const block_t *block;                        // The block this was prepared from, nullptr if none
+    uint32_t step_event_count,                   // Scaled by the oversampling, as are the next two
+             accelerate_until,
+             decelerate_after,
+             initial_interval,                   // Timer ticks at the initial rate
+             nominal_interval;                   // Timer ticks at the nominal rate
+    uint8_t initial_loops,                       // Steps per ISR at the initial rate
+            nominal_loops,                       // Steps per ISR at the nominal rate
+            oversampling,                        // Axis smoothing, as log2 of the multiplier
+            axis_bits;                           // Axes that move
+    #if ENABLED(S_CURVE_ACCELERATION)
+      bezier_coeffs_t accel, decel;              // Speed curves of the ramps up and down
+    #endif
+  } prepared_block_t;
+
+#endif
+
 //
 // Stepper class definition
 //
@@ -245,6 +324,11 @@ class Stepper {
       static bool separate_multi_axis;
     #endif
 
+    #if ENABLED(CONCURRENT_HOMING)
+      static bool hold_on_endstop;        // An endstop holds just its axis, ending the block once every moving axis is held
+      static volatile uint8_t held_axes;  // The axes held at their endstops
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       #if HAS_MOTOR_CURRENT_PWM
         #ifndef PWM_MOTOR_CURRENT
@@ -310,6 +394,11 @@ class Stepper {
                     decelerate_after,       // The point from where we need to start decelerating
                     step_event_count;       // The total event count for the current block
 
+    #if ENABLED(ARC_BLOCKS)
+      static block_arc_t arc;               // The circle of the running arc block, turned as it runs
+      static uint32_t arc_steps[2];         // Steps taken so far on its plane axes
+    #endif
+
     #if EITHER(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER)
       static uint8_t stepper_extruder;
     #else
@@ -341,6 +430,35 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      static constexpr uint32_t SHAPING_NEVER = 0xFFFFFFFF;
+      static uint32_t nextShapingISR,
+                      shaping_clock;        // (ticks) Time of the current ISR phase, to stamp queued steps
+      static shaping_axis_t shaping[2];     // X and Y
+      static uint8_t shaper_axes,           // Axes with a shaper set
+                     shaped_axes;           // Axes shaped in the current block
+
+      static void shaping_play_oldest(shaping_axis_t &shaper);
+      FORCE_INLINE static void shaping_queue_step(shaping_axis_t &shaper, const int8_t direction);
+    #endif
+
+    #if ENABLED(STEPPER_ISR_PROFILE)
+      // Add a run of one ISR phase to its profile
+      FORCE_INLINE static void isr_profile_record(const IsrPhase phase, const uint32_t cycles);
+    #endif
+
+    #if ENABLED(STEPPER_PREPARE_BLOCKS)
+      static prepared_block_t prepared_blocks[STEPPER_PREPARED_BLOCKS], // The next blocks, by buffer index
+                              current_prepared; // Setup of the current block
+
+      // Work out what starting a block sets up
+      static void prepare_block(const block_t* const block, prepared_block_t &prepared);
+
+      FORCE_INLINE static prepared_block_t& prepared_slot(const block_t* const block) {
+        return prepared_blocks[(block - planner.block_buffer) % (STEPPER_PREPARED_BLOCKS)];
+      }
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
@@ -357,6 +475,17 @@ class Stepper {
     // Positions of stepper motors, in step units
     static swordfish::math::Vector6i32 count_position;
 
+    #if ENABLED(MOTION_STATS)
+      static uint32_t isr_max_cycles,       // Longest run of isr() since the last reset
+                      max_step_rate;        // Highest step event rate reached (steps/s)
+    #endif
+
+    #if ENABLED(STEPPER_ISR_PROFILE)
+      static isr_profile_t isr_profile[uint8_t(IsrPhase::Count)];
+      static uint32_t isr_profile_block;    // Blocks started since the last reset
+      static void reset_isr_profile();
+    #endif
+
 	private:
     // Current stepper motor directions (+1 or -1)
     static swordfish::math::Vector6i8 count_direction;
@@ -400,7 +529,6 @@ class Stepper {
 
     // The ISR scheduler
     static void isr();
-
     // The stepper pulse ISR phase
     static void pulse_phase_isr();
 
@@ -415,6 +543,27 @@ class Stepper {
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      // The Input Shaping ISR phase
+      static uint32_t shaping_isr();
+
+      // Set the shaper of the X or Y axis, once the queues have played out
+      static void set_shaping(const Axis axis, const ShaperType type, const float frequency, const float damping);
+
+      // The fastest the planner may step a shaped axis, 0 if it isn't shaped
+      static uint32_t shaping_max_rate(const Axis axis) { return axis < COUNT(shaping) && TEST(shaper_axes, axis) ? shaping[axis].max_rate : 0; }
+
+      // Shaped steps are still to go to the motors
+      static bool is_shaping() {
+        LOOP_L_N(i, COUNT(shaping))
+          if (shaping[i].impulses && shaping[i].cursor[shaping[i].impulses - 1] != shaping[i].head) return true;
+        return false;
+      }
+
+      // Drop the shaped steps still to go, leaving the positions where the motors are
+      static void discard_shaping();
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       // The Babystepping ISR phase
       static uint32_t babystepping_isr();
@@ -429,6 +578,17 @@ class Stepper {
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t* const block);
 
+    #if ENABLED(STEPPER_PREPARE_BLOCKS)
+      // Set up the next blocks so the ISR only has to copy them - Call from the main loop
+      static void prepare_blocks();
+
+      // Forget a block's setup when its trapezoid changes - The block must not be busy
+      FORCE_INLINE static void unprepare_block(const block_t* const block) {
+        prepared_block_t &slot = prepared_slot(block);
+        if (slot.block == block) slot.block = nullptr;
+      }
+    #endif
+
     // Get the position of a stepper, in steps
     static int32_t position(const Axis axis);
 
@@ -480,6 +640,9 @@ class Stepper {
     #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
       FORCE_INLINE static void set_separate_multi_axis(const bool state) { separate_multi_axis = state; }
     #endif
+    #if ENABLED(CONCURRENT_HOMING)
+      FORCE_INLINE static void set_hold_on_endstop(const bool state) { hold_on_endstop = state; held_axes = 0; }
+    #endif
     #if ENABLED(X_DUAL_ENDSTOPS)
       FORCE_INLINE static void set_x_lock(const bool state) { locked_X_motor = state; }
       FORCE_INLINE static void set_x2_lock(const bool state) { locked_X2_motor = state; }
@@ -530,12 +693,17 @@ class Stepper {
 
     // Set the current position in steps
     static void _set_position(const swordfish::math::Vector6i32 &spos);
+    static void _set_position(const block_position_t &spos);
 
     FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t* loops) {
+      return calc_timer_interval(step_rate, oversampling_factor, loops);
+    }
+
+    FORCE_INLINE static uint32_t calc_timer_interval(uint32_t step_rate, const uint8_t oversampling, uint8_t* loops) {
       uint32_t timer;
 
       // Scale the frequency, as requested by the caller
-      step_rate <<= oversampling_factor;
+      step_rate <<= oversampling;
 
       uint8_t multistep = 1;
       #if DISABLED(DISABLE_MULTI_STEPPING)
@@ -594,6 +762,13 @@ class Stepper {
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
+      #if ENABLED(STEPPER_PREPARE_BLOCKS)
+        static void _calc_bezier_curve_coeffs(bezier_coeffs_t &coeffs, const int32_t v0, const int32_t v1, const uint32_t av);
+        FORCE_INLINE static void _load_bezier_curve_coeffs(const bezier_coeffs_t &coeffs) {
+          bezier_A = coeffs.A; bezier_B = coeffs.B; bezier_C = coeffs.C;
+          bezier_F = coeffs.F; bezier_AV = coeffs.AV;
+        }
+      #endif
     #endif
 
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
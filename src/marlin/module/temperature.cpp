@@ -1068,6 +1068,13 @@ void Temperature::manage_heater() {
       emergency_parser.quickstop_by_M410 = false; // quickstop_stepper may call idle so clear this now!
       quickstop_stepper();
     }
+
+    #if ENABLED(JOGGING)
+      if (emergency_parser.cancel_jog_by_M410) {
+        emergency_parser.cancel_jog_by_M410 = false;
+        planner.cancel_jog();
+      }
+    #endif
   #endif
 
 	watchdog_refresh();
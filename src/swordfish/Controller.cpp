@@ -16,7 +16,10 @@
 
 #include <Adafruit_SPIFlashBase.h>
 
-#include <marlin/HAL/SAMD51/watchdog.h>
+#ifdef __SAMD51__
+#	include <marlin/HAL/SAMD51/watchdog.h>
+#endif
+
 #include <marlin/MarlinCore.h>
 
 namespace swordfish {
@@ -31,6 +34,9 @@ namespace swordfish {
 	core::ObjectField<estop::EStopModule> Controller::__estopModuleField = { "estop", 2, getEStopModule };
 	core::ObjectField<gpio::GPIOModule> Controller::__gpioModuleField = { "gpio", 3, getGPIOModule };
 	core::ObjectField<status::StatusModule> Controller::__statusModuleField = { "status", 4, getStatusModule };
+	// Present even with no diagnostics built, as the modules are stored by position
+	core::ObjectField<diagnostics::DiagnosticsModule> Controller::__diagnosticsModuleField = { "diagnostics", 5, getDiagnosticsModule };
+	core::ObjectField<macros::MacrosModule> Controller::__macrosModuleField = { "macros", 6, getMacrosModule };
 
 	core::Schema Controller::__schema = {
 		utils::typeName<Controller>(),
@@ -41,7 +47,9 @@ namespace swordfish {
 			__motionModuleField,
 			__estopModuleField,
 			__gpioModuleField,
-			__statusModuleField
+			__statusModuleField,
+			__diagnosticsModuleField,
+			__macrosModuleField
 		}
 	};
 
@@ -173,12 +181,15 @@ namespace swordfish {
 			&static_cast<Module&>(__motionModuleField.get(_pack)),
 			&static_cast<Module&>(__estopModuleField.get(_pack)),
 			&static_cast<Module&>(__gpioModuleField.get(_pack)),
-			&static_cast<Module&>(__statusModuleField.get(_pack))
+			&static_cast<Module&>(__statusModuleField.get(_pack)),
+			&static_cast<Module&>(__diagnosticsModuleField.get(_pack)),
+			&static_cast<Module&>(__macrosModuleField.get(_pack))
 		}) {
 
 	}
 
 	void Controller::init() {
+#ifdef __SAMD51__
 		// Setup a 24Mhz clock
 		GCLK->GENCTRL[7].reg =
 			GCLK_GENCTRL_DIV(2) |
@@ -187,6 +198,7 @@ namespace swordfish {
 			GCLK_GENCTRL_SRC(GCLK_GENCTRL_SRC_DFLL_Val);
 
 		while (GCLK->SYNCBUSY.bit.GENCTRL7);               // Wait for synchronization
+#endif
 
 		// Check startup - does nothing if bootloader sets MCUSR to 0
 		const byte mcu = HAL_get_reset_source();
@@ -209,6 +221,21 @@ namespace swordfish {
 		}
 	}
 
+	// Tells the module that owns the object (or every module, for the controller) that it changed
+	void Controller::changed(core::Object& object) {
+		auto* child = &object;
+
+		while(child && child != this && child->getParent() != this) {
+			child = child->getParent();
+		}
+
+		for(auto* module : _modules) {
+			if(child == this || child == module) {
+				module->changed();
+			}
+		}
+	}
+
 	bool Controller::findNewestConfig(PersistentStoreInputStream& store, io::WrappingInputStream& stream, offset_t& offset) {
 		offset = 0;
 		offset_t lastOffset = 0;
@@ -333,13 +360,14 @@ namespace swordfish {
 	}
 
 	void Controller::reset() {
+		_configStart = _configEnd = _configVersion = 0;
+
+#ifdef __SAMD51__
 		Adafruit_FlashTransport_QSPI transport = { };
 		Adafruit_SPIFlashBase flash = { &transport };
 
 		flash.begin(nullptr);
 
-		_configStart = _configEnd = _configVersion = 0;
-
 		uint32_t offset = CONFIG_START;
 
 		debug()("Resetting eeprom.");
@@ -365,6 +393,7 @@ namespace swordfish {
 
 			HAL_watchdog_refresh();
 		}
+#endif
 	}
 
 	swordfish::Controller& Controller::getInstance() {
@@ -390,4 +419,12 @@ namespace swordfish {
 	swordfish::status::StatusModule* Controller::getStatusModule([[maybe_unused]] Object* parent) {
 		return &status::StatusModule::getInstance(parent);
 	}
+
+	swordfish::diagnostics::DiagnosticsModule* Controller::getDiagnosticsModule([[maybe_unused]] Object* parent) {
+		return &diagnostics::DiagnosticsModule::getInstance(parent);
+	}
+
+	swordfish::macros::MacrosModule* Controller::getMacrosModule([[maybe_unused]] Object* parent) {
+		return &macros::MacrosModule::getInstance(parent);
+	}
 }
\ No newline at end of file
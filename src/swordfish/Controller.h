@@ -21,6 +21,8 @@
 #include <swordfish/modules/gcode/CommandException.h>
 #include <swordfish/modules/gpio/GPIOModule.h>
 #include <swordfish/modules/status/StatusModule.h>
+#include <swordfish/modules/diagnostics/DiagnosticsModule.h>
+#include <swordfish/modules/macros/MacrosModule.h>
 
 #include "PersistentStore.h"
 
@@ -41,11 +43,17 @@ namespace swordfish {
 
 		static status::StatusModule* getStatusModule([[maybe_unused]] Object* parent);
 
+		static diagnostics::DiagnosticsModule* getDiagnosticsModule([[maybe_unused]] Object* parent);
+
+		static macros::MacrosModule* getMacrosModule([[maybe_unused]] Object* parent);
+
 		static core::ObjectField<tools::ToolsModule> __toolingModuleField;
 		static core::ObjectField<motion::MotionModule> __motionModuleField;
 		static core::ObjectField<estop::EStopModule> __estopModuleField;
 		static core::ObjectField<gpio::GPIOModule> __gpioModuleField;
 		static core::ObjectField<status::StatusModule> __statusModuleField;
+		static core::ObjectField<diagnostics::DiagnosticsModule> __diagnosticsModuleField;
+		static core::ObjectField<macros::MacrosModule> __macrosModuleField;
 
 		static Controller* __instance;
 
@@ -63,7 +71,7 @@ namespace swordfish {
 		uint32_t _configStart;
 		uint32_t _configEnd;
 
-		std::array<Module*, 5> _modules;
+		std::array<Module*, 7> _modules;
 
 		virtual core::Pack& getPack() override;
 
@@ -74,6 +82,7 @@ namespace swordfish {
 
 		void init();
 		void idle();
+		void changed(core::Object& object);
 		void load();
 		void save();
 		void reset();
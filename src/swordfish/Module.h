@@ -48,5 +48,8 @@ namespace swordfish {
 		
 		virtual void init() = 0;
 		virtual void idle() { }
+
+		// Called once a client has changed the module's configuration
+		virtual void changed() { }
 	};
 }
\ No newline at end of file
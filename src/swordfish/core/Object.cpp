@@ -106,7 +106,7 @@ namespace swordfish::core {
 		return nullptr;
 	}
 
-	void Object::setValueFromJson(std::string_view name, std::string_view value) {
+	bool Object::setValueFromJson(std::string_view name, std::string_view value) {
 		debug()("setting ", name, " to ", value);
 
 		auto* pack = &getPack();
@@ -117,7 +117,7 @@ namespace swordfish::core {
 				if (strncmp(field.get().name(), name.data(), name.size()) == 0) {
 					field.get().readJson(*pack, value);
 
-					return;
+					return true;
 				}
 			}
 
@@ -132,7 +132,7 @@ namespace swordfish::core {
 					if (string) {
 						string->value(value);
 
-						return;
+						return true;
 					}
 				}
 			}
@@ -143,12 +143,14 @@ namespace swordfish::core {
 				if (strncmp(field.get().name(), name.data(), name.size()) == 0) {
 					field.get().set(*pack, value);
 
-					return;
+					return field.get().stores();
 				}
 			}
 
 			schema = schema->parent();
 			pack = pack->getParent();
 		}
+
+		return false;
 	}
 } // namespace swordfish::core
\ No newline at end of file
@@ -59,7 +59,8 @@ namespace swordfish::core {
 		virtual Object* getChild(std::string_view name);
 		virtual Object* select(std::string_view selector);
 
-		virtual void setValueFromJson(std::string_view name, std::string_view value);
+		// Returns whether a stored value was changed, and so needs saving.
+		virtual bool setValueFromJson(std::string_view name, std::string_view value);
 
 		virtual data::ITable* asTable() {
 			return nullptr;
@@ -357,15 +357,23 @@ namespace swordfish::core {
 	};
 
 	class TransientFieldBase : public Field {
+	private:
+		const bool _stores;
+
 	public:
-		TransientFieldBase(const char* name) :
-				Field(name) {
+		TransientFieldBase(const char* name, bool stores = true) :
+				Field(name), _stores(stores) {
 		}
 
 		FieldType type() const override {
 			return FieldType::Transient;
 		}
 
+		// Whether setting the field changes stored values, which then need saving
+		bool stores() const {
+			return _stores;
+		}
+
 		virtual void set(Pack& pack, std::string_view value) = 0;
 	};
 
@@ -378,8 +386,8 @@ namespace swordfish::core {
 		std::function<void(TObject&, TValue)> _setter;
 
 	public:
-		TransientField(const char* name, std::function<TValue(TObject&)> getter, std::function<void(TObject&, TValue)> setter) :
-				TransientFieldBase(name), _getter(getter), _setter(setter) {
+		TransientField(const char* name, std::function<TValue(TObject&)> getter, std::function<void(TObject&, TValue)> setter, bool stores = true) :
+				TransientFieldBase(name, stores), _getter(getter), _setter(setter) {
 		}
 
 		virtual void set(Pack& pack, std::string_view value) override {
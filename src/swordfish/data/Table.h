@@ -24,12 +24,8 @@ namespace swordfish::io {
 
 namespace swordfish::data {
 	struct Pagination {
-		int16_t page;
-		int16_t pageLength;
-
-		Pagination(int16_t page = -1, int16_t pageLength = -1) :
-				page(page), pageLength(pageLength) {
-		}
+		int16_t page = -1;
+		int16_t pageLength = -1;
 	};
 
 	class ITable {
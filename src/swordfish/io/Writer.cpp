@@ -31,6 +31,7 @@ namespace swordfish::io {
 		return *this;
 	}
 	
+#ifndef __PLAT_SIMULATOR__
 	Writer& Writer::operator<<(int value) {
 		char buffer[20];
 		
@@ -44,6 +45,7 @@ namespace swordfish::io {
 			
 		return *this;
 	}
+#endif
 	
 	Writer& Writer::operator<<(int8_t value) {
 		char buffer[20];
@@ -101,6 +103,7 @@ namespace swordfish::io {
 		return *this;
 	}
 	
+#ifndef __PLAT_SIMULATOR__
 	Writer& Writer::operator<<(unsigned int value) {
 		char buffer[20];
 		
@@ -114,6 +117,7 @@ namespace swordfish::io {
 		
 		return *this;
 	}	
+#endif
 	
 	Writer& Writer::operator<<(uint8_t value) {
 		char buffer[20];
@@ -45,13 +45,17 @@ namespace swordfish::io {
 		
 		Writer& operator<<(const char value);
 		
+#ifndef __PLAT_SIMULATOR__ // int32_t is int on the host
 		Writer& operator<<(int value);
+#endif
 		Writer& operator<<(int8_t value);
 		Writer& operator<<(int16_t value);
 		Writer& operator<<(int32_t value);
 		Writer& operator<<(int64_t value);
 		
+#ifndef __PLAT_SIMULATOR__
 		Writer& operator<<(unsigned int value);
+#endif
 		Writer& operator<<(uint8_t value);
 		Writer& operator<<(uint16_t value);
 		Writer& operator<<(uint32_t value);
@@ -0,0 +1,168 @@
+/*
+ * CommandStats.cpp
+ */
+
+#include <marlin/module/planner.h>
+
+#include "CommandStats.h"
+
+#if ENABLED(GCODE_COMMAND_STATS)
+
+namespace swordfish::diagnostics {
+	static constexpr uint32_t CyclesPerMicrosecond = F_CPU / 1000000UL;
+
+	core::Schema CommandStats::__schema = {
+		utils::typeName<CommandStats>(),
+		nullptr,
+		{
+
+		},
+		{
+
+		}
+	};
+
+	CommandStats::CommandStats(core::Object* parent) :
+			core::Object(parent), _pack(__schema, *this) {
+		reset();
+	}
+
+	void CommandStats::reset() {
+		for (auto& entry : _entries) {
+			entry = {};
+		}
+
+		_dropped = 0;
+		_queueEmpty = 0;
+		_plannerStarved = 0;
+		_queueWasEmpty = true;
+		_plannerWasBusy = false;
+	}
+
+	CommandStats::Entry* CommandStats::find(char letter, uint16_t codenum, uint8_t subcode) {
+		const auto start = ((uint32_t(letter) * 1021 + codenum) * 10 + subcode) % EntryCount;
+
+		for (auto i = 0u; i < EntryCount; i++) {
+			auto& entry = _entries[(start + i) % EntryCount];
+
+			if (entry.letter == letter && entry.codenum == codenum && entry.subcode == subcode) {
+				return &entry;
+			}
+
+			if (!entry.letter) {
+				entry.letter = letter;
+				entry.codenum = codenum;
+				entry.subcode = subcode;
+
+				return &entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void CommandStats::started() {
+		if (_plannerWasBusy && !planner.has_blocks_queued()) {
+			_plannerStarved++;
+		}
+
+		_queueWasEmpty = false;
+	}
+
+	void CommandStats::queueEmpty() {
+		if (!_queueWasEmpty && planner.has_blocks_queued()) {
+			_queueEmpty++;
+		}
+
+		_queueWasEmpty = true;
+	}
+
+	void CommandStats::finished(char letter, uint16_t codenum, uint8_t subcode, uint32_t us) {
+		_plannerWasBusy = planner.has_blocks_queued();
+
+		auto* entry = find(letter, codenum, subcode);
+
+		if (!entry) {
+			_dropped++;
+
+			return;
+		}
+
+		entry->count++;
+		entry->total += us;
+
+		if (us > entry->max) {
+			entry->max = us;
+		}
+
+		auto bucket = 0u;
+
+		while (bucket < BucketLimits.size() && us >= BucketLimits[bucket]) {
+			bucket++;
+		}
+
+		entry->buckets[bucket]++;
+	}
+
+	void CommandStats::writeJson(io::Writer& out) {
+		out << "{\"queueEmpty\":" << _queueEmpty;
+		out << ",\"plannerStarved\":" << _plannerStarved;
+		out << ",\"dropped\":" << _dropped;
+		out << ",\"buckets\":[";
+
+		for (auto i = 0u; i < BucketLimits.size(); i++) {
+			out << (i ? "," : "") << BucketLimits[i];
+		}
+
+		out << "],\"codes\":{";
+
+		auto separator = "";
+
+		for (auto& entry : _entries) {
+			if (!entry.letter || !entry.count) {
+				continue;
+			}
+
+			out << separator << '"' << entry.letter << entry.codenum;
+
+			if (entry.subcode) {
+				out << '.' << entry.subcode;
+			}
+
+			out << "\":{";
+			out << "\"count\":" << entry.count;
+			out << ",\"total\":" << entry.total;
+			out << ",\"max\":" << entry.max;
+			out << ",\"histogram\":[";
+
+			for (auto i = 0u; i < BucketCount; i++) {
+				out << (i ? "," : "") << entry.buckets[i];
+			}
+
+			out << "]}";
+
+			separator = ",";
+		}
+
+		out << "}}";
+	}
+
+	CommandTimer* CommandTimer::_innermost = nullptr;
+
+	CommandTimer::~CommandTimer() {
+		// The cycle counter is good for about 35s at 120MHz, past a second millis() is close enough
+		const millis_t ms = millis() - _startMillis;
+		const uint32_t us = ms < 1000 ? (getCycleCount() - _startCycles) / CyclesPerMicrosecond : _MIN(ms, UINT32_MAX / 1000) * 1000;
+
+		_stats.finished(_letter, _codenum, _subcode, us - _MIN(_nestedMicros, us));
+
+		// The command that ran this one doesn't count its time as its own
+		if (_outer) {
+			_outer->_nestedMicros += us;
+		}
+
+		_innermost = _outer;
+	}
+} // namespace swordfish::diagnostics
+
+#endif // GCODE_COMMAND_STATS
@@ -0,0 +1,114 @@
+/*
+ * CommandStats.h
+ */
+
+#pragma once
+
+#include <array>
+
+#include <swordfish/types.h>
+#include <swordfish/io/Writer.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include <swordfish/core/Object.h>
+#include <swordfish/core/Pack.h>
+#include <swordfish/core/Schema.h>
+
+#include <sam.h>
+#include <Arduino.h>
+
+#include <marlin/core/millis_t.h>
+#include <marlin/HAL/shared/Delay.h>
+
+namespace swordfish::diagnostics {
+	/**
+	 * Execution time of each G/M/T code and subcode, e.g. G61 and G61.1 apart, as
+	 * measured around process_parsed_command,
+	 * along with the number of times the command queue and the planner ran dry.
+	 * A command that runs others, e.g. a macro, is charged only its own time.
+	 *
+	 * Times are taken from the CPU cycle counter, which wraps after half a minute
+	 * or so, and from millis() for anything longer. They're reported in microseconds.
+	 */
+	class CommandStats : public core::Object {
+	public:
+		// Upper bounds (exclusive) of the histogram buckets in microseconds, the last bucket is unbounded.
+		static constexpr std::array<uint32_t, 6> BucketLimits = { 10, 100, 1000, 10000, 100000, 1000000 };
+		static constexpr size_t BucketCount = BucketLimits.size() + 1;
+		static constexpr size_t EntryCount = 32;
+
+	private:
+		struct Entry {
+			char letter;
+			uint16_t codenum;
+			uint8_t subcode;
+			uint32_t count;
+			uint64_t total;
+			uint32_t max;
+			std::array<uint32_t, BucketCount> buckets;
+		};
+
+		std::array<Entry, EntryCount> _entries;
+		uint32_t _dropped;
+		uint32_t _queueEmpty;
+		uint32_t _plannerStarved;
+		bool _queueWasEmpty;
+		bool _plannerWasBusy;
+
+		Entry* find(char letter, uint16_t codenum, uint8_t subcode);
+
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		virtual core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		CommandStats(core::Object* parent);
+
+		void reset();
+
+		// Called as a command is dispatched. Counts the planner as starved if it
+		// held blocks when the previous command finished but has since drained.
+		void started();
+
+		// Called as a command finishes, with the microseconds it took.
+		void finished(char letter, uint16_t codenum, uint8_t subcode, uint32_t us);
+
+		// Called when the command queue has nothing to dispatch. Counts each time
+		// the queue runs dry while there is still motion in the planner.
+		void queueEmpty();
+
+		virtual void writeJson(io::Writer& out) override;
+	};
+
+	/**
+	 * Times the enclosing scope and records it against the given command, less
+	 * the time of the commands timed inside it.
+	 */
+	class CommandTimer {
+	private:
+		static CommandTimer* _innermost;
+
+		CommandStats& _stats;
+		CommandTimer* const _outer;
+		const char _letter;
+		const uint16_t _codenum;
+		const uint8_t _subcode;
+		const uint32_t _startCycles;
+		const millis_t _startMillis;
+		uint32_t _nestedMicros;
+
+	public:
+		CommandTimer(CommandStats& stats, char letter, uint16_t codenum, uint8_t subcode) :
+				_stats(stats), _outer(_innermost), _letter(letter), _codenum(codenum), _subcode(subcode), _startCycles(getCycleCount()), _startMillis(millis()), _nestedMicros(0) {
+			_innermost = this;
+			_stats.started();
+		}
+
+		~CommandTimer();
+	};
+} // namespace swordfish::diagnostics
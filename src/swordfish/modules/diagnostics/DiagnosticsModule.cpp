@@ -0,0 +1,73 @@
+/*
+ * DiagnosticsModule.cpp
+ */
+
+#include "DiagnosticsModule.h"
+
+namespace swordfish::diagnostics {
+	DiagnosticsModule* DiagnosticsModule::__instance = nullptr;
+
+#if ENABLED(GCODE_COMMAND_STATS)
+	core::ObjectField<CommandStats> DiagnosticsModule::__commandStatsField = { "commands", 0 };
+#endif
+
+#if ENABLED(MOTION_STATS)
+	core::ObjectField<MotionStats> DiagnosticsModule::__motionStatsField = { "motion", TERN(GCODE_COMMAND_STATS, 1, 0) };
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+	core::ObjectField<IsrProfile> DiagnosticsModule::__isrProfileField = { "isr", TERN0(GCODE_COMMAND_STATS, 1) + TERN0(MOTION_STATS, 1) };
+#endif
+
+	core::TransientField<DiagnosticsModule, uint8_t> DiagnosticsModule::__resetField = {
+		"reset",
+		[](DiagnosticsModule&) -> uint8_t {
+			return 0;
+		},
+		[](DiagnosticsModule& module, uint8_t value) {
+			if (value) {
+				module.reset();
+			}
+		},
+		false
+	};
+
+	core::Schema DiagnosticsModule::__schema = {
+		utils::typeName<DiagnosticsModule>(),
+		&(Module::__schema),
+		{
+
+		},
+		{
+#if ENABLED(GCODE_COMMAND_STATS)
+				__commandStatsField,
+#endif
+#if ENABLED(MOTION_STATS)
+				__motionStatsField,
+#endif
+#if ENABLED(STEPPER_ISR_PROFILE)
+				__isrProfileField,
+#endif
+		},
+		{ __resetField }
+	};
+
+	DiagnosticsModule::DiagnosticsModule(core::Object* parent) :
+			Module(parent),
+			_pack(__schema, *this, &(Module::_pack)) {
+	}
+
+	void DiagnosticsModule::init() {
+		TERN_(HAS_DIAGNOSTICS, enableCycleCounter());
+	}
+
+	void DiagnosticsModule::reset() {
+		TERN_(GCODE_COMMAND_STATS, getCommandStats().reset());
+		TERN_(MOTION_STATS, getMotionStats().reset());
+		TERN_(STEPPER_ISR_PROFILE, getIsrProfile().reset());
+	}
+
+	DiagnosticsModule& DiagnosticsModule::getInstance(core::Object* parent /*= nullptr*/) {
+		return *(__instance ?: __instance = new DiagnosticsModule(parent));
+	}
+} // namespace swordfish::diagnostics
@@ -0,0 +1,87 @@
+/*
+ * DiagnosticsModule.h
+ */
+
+#pragma once
+
+#include <swordfish/Module.h>
+#include <swordfish/core/Schema.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include <marlin/inc/MarlinConfigPre.h>
+
+#if ENABLED(GCODE_COMMAND_STATS)
+#	include "CommandStats.h"
+#endif
+#if ENABLED(STEPPER_ISR_PROFILE)
+#	include "IsrProfile.h"
+#endif
+#if ENABLED(MOTION_STATS)
+#	include "MotionStats.h"
+#endif
+
+namespace swordfish::diagnostics {
+	/**
+	 * Diagnostic counters. The module is always present so the controller's
+	 * stored modules keep their positions; it has no children when
+	 * GCODE_COMMAND_STATS, MOTION_STATS and STEPPER_ISR_PROFILE are all off.
+	 */
+	class DiagnosticsModule : public Module {
+	private:
+#if ENABLED(GCODE_COMMAND_STATS)
+		static core::ObjectField<CommandStats> __commandStatsField;
+#endif
+#if ENABLED(MOTION_STATS)
+		static core::ObjectField<MotionStats> __motionStatsField;
+#endif
+#if ENABLED(STEPPER_ISR_PROFILE)
+		static core::ObjectField<IsrProfile> __isrProfileField;
+#endif
+		static core::TransientField<DiagnosticsModule, uint8_t> __resetField;
+
+		static DiagnosticsModule* __instance;
+
+		DiagnosticsModule(core::Object* parent);
+
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		virtual ~DiagnosticsModule() {
+		}
+
+		virtual const char* name() override {
+			return "Diagnostics";
+		}
+
+		virtual void init() override;
+
+#if ENABLED(GCODE_COMMAND_STATS)
+		CommandStats& getCommandStats() {
+			return __commandStatsField.get(_pack);
+		}
+#endif
+
+#if ENABLED(MOTION_STATS)
+		MotionStats& getMotionStats() {
+			return __motionStatsField.get(_pack);
+		}
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+		IsrProfile& getIsrProfile() {
+			return __isrProfileField.get(_pack);
+		}
+#endif
+
+		void reset();
+
+		static DiagnosticsModule& getInstance(core::Object* parent = nullptr);
+	};
+} // namespace swordfish::diagnostics
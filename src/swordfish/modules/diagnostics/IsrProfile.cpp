@@ -0,0 +1,87 @@
+/*
+ * IsrProfile.cpp
+ */
+
+#include <marlin/module/stepper.h>
+
+#include "IsrProfile.h"
+
+#if ENABLED(STEPPER_ISR_PROFILE)
+
+namespace swordfish::diagnostics {
+	static constexpr float32_t CyclesPerMicrosecond = F_CPU / 1000000UL;
+
+	static constexpr uint32_t BucketLimits[] = ISR_PROFILE_LIMITS_US;
+
+	static_assert(COUNT(BucketLimits) + 1 == ISR_PROFILE_BUCKETS, "ISR_PROFILE_LIMITS_US needs one entry fewer than ISR_PROFILE_BUCKETS.");
+
+	// Indexed by IsrPhase
+	static constexpr const char* PhaseNames[] = { "isr", "pulse", "shaping", "advance", "babystep", "block" };
+
+	static_assert(COUNT(PhaseNames) == uint8_t(IsrPhase::Count), "Every IsrPhase needs a name.");
+
+	core::Schema IsrProfile::__schema = {
+		utils::typeName<IsrProfile>(),
+		nullptr,
+		{
+
+		},
+		{
+
+		}
+	};
+
+	IsrProfile::IsrProfile(core::Object* parent) :
+			core::Object(parent), _pack(__schema, *this) {
+	}
+
+	void IsrProfile::reset() {
+		stepper.reset_isr_profile();
+	}
+
+	void IsrProfile::writeJson(io::Writer& out) {
+		// Copy the profile while the stepper ISR can't add to it, then write the copy
+		const bool was_enabled = stepper.suspend();
+
+		isr_profile_t profiles[uint8_t(IsrPhase::Count)];
+		memcpy(profiles, stepper.isr_profile, sizeof(profiles));
+		const uint32_t blocks = stepper.isr_profile_block;
+
+		if (was_enabled) {
+			stepper.wake_up();
+		}
+
+		out << "{\"blocks\":" << blocks;
+
+		out << ",\"buckets\":[";
+		for (uint8_t i = 0; i < COUNT(BucketLimits); i++) {
+			out << (i ? "," : "") << BucketLimits[i];
+		}
+		out << "],\"phases\":{";
+
+		bool first = true;
+		for (uint8_t phase = 0; phase < uint8_t(IsrPhase::Count); phase++) {
+			const isr_profile_t& profile = profiles[phase];
+
+			// Phases that aren't compiled in never run
+			if (phase != uint8_t(IsrPhase::Isr) && !profile.count) {
+				continue;
+			}
+
+			out << (first ? "\"" : ",\"") << PhaseNames[phase] << "\":{\"count\":" << profile.count;
+			out << ",\"max\":" << profile.max_cycles / CyclesPerMicrosecond;
+			out << ",\"maxBlock\":" << profile.max_block;
+			out << ",\"histogram\":[";
+			for (uint8_t i = 0; i < ISR_PROFILE_BUCKETS; i++) {
+				out << (i ? "," : "") << profile.buckets[i];
+			}
+			out << "]}";
+
+			first = false;
+		}
+
+		out << "}}";
+	}
+} // namespace swordfish::diagnostics
+
+#endif // STEPPER_ISR_PROFILE
@@ -0,0 +1,40 @@
+/*
+ * IsrProfile.h
+ */
+
+#pragma once
+
+#include <swordfish/types.h>
+#include <swordfish/io/Writer.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include <swordfish/core/Object.h>
+#include <swordfish/core/Pack.h>
+#include <swordfish/core/Schema.h>
+
+namespace swordfish::diagnostics {
+	/**
+	 * Where the stepper ISR spends its time: for the whole ISR and each of its
+	 * phases, how often it ran, a histogram of run times and the longest run
+	 * along with the block (counted from the last reset) it happened in.
+	 *
+	 * The stepper does the timing, this only reports it.
+	 */
+	class IsrProfile : public core::Object {
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		virtual core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		IsrProfile(core::Object* parent);
+
+		void reset();
+
+		virtual void writeJson(io::Writer& out) override;
+	};
+} // namespace swordfish::diagnostics
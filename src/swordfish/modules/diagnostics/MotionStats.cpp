@@ -0,0 +1,60 @@
+/*
+ * MotionStats.cpp
+ */
+
+#include <marlin/module/planner.h>
+#include <marlin/module/stepper.h>
+
+#include "MotionStats.h"
+
+#if ENABLED(MOTION_STATS)
+
+namespace swordfish::diagnostics {
+	static constexpr float32_t CyclesPerMicrosecond = F_CPU / 1000000UL;
+
+	core::Schema MotionStats::__schema = {
+		utils::typeName<MotionStats>(),
+		nullptr,
+		{
+
+		},
+		{
+
+		}
+	};
+
+	MotionStats::MotionStats(core::Object* parent) :
+			core::Object(parent), _pack(__schema, *this) {
+	}
+
+	void MotionStats::reset() {
+		planner.reset_motion_stats();
+	}
+
+	void MotionStats::writeJson(io::Writer& out) {
+		// The stepper ISR updates some of these, so copy them while it's held off
+		const bool was_enabled = stepper.suspend();
+
+		const motion_stats_t stats = planner.motion_stats;
+		const uint32_t isr_max_cycles = stepper.isr_max_cycles, max_step_rate = stepper.max_step_rate;
+
+		if (was_enabled) {
+			stepper.wake_up();
+		}
+
+		out << "{\"blocks\":" << stats.delivered;
+		out << ",\"occupancy\":{\"min\":" << (stats.delivered ? uint32_t(stats.queued_min) : 0u);
+		out << ",\"avg\":" << (stats.delivered ? float32_t(stats.queued) / stats.delivered : 0.0f);
+		out << ",\"size\":" << uint32_t(BLOCK_BUFFER_SIZE - 1) << "}";
+		out << ",\"delayed\":" << stats.delayed;
+		out << ",\"underruns\":" << stats.underruns;
+		out << ",\"replan\":{\"count\":" << stats.replans;
+		out << ",\"avg\":" << (stats.replans ? stats.replan_cycles / CyclesPerMicrosecond / stats.replans : 0.0f);
+		out << ",\"max\":" << stats.replan_max_cycles / CyclesPerMicrosecond << "}";
+		out << ",\"isrMax\":" << isr_max_cycles / CyclesPerMicrosecond;
+		out << ",\"maxStepRate\":" << max_step_rate;
+		out << "}";
+	}
+} // namespace swordfish::diagnostics
+
+#endif // MOTION_STATS
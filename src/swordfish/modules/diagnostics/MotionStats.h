@@ -0,0 +1,41 @@
+/*
+ * MotionStats.h
+ */
+
+#pragma once
+
+#include <swordfish/types.h>
+#include <swordfish/io/Writer.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include <swordfish/core/Object.h>
+#include <swordfish/core/Pack.h>
+#include <swordfish/core/Schema.h>
+
+namespace swordfish::diagnostics {
+	/**
+	 * How well the planner keeps the steppers fed: buffer occupancy as blocks
+	 * are handed to the stepper ISR, first moves held back to let the buffer
+	 * fill, the buffer running dry mid-job, time spent replanning, the longest
+	 * stepper ISR and the highest step rate reached.
+	 *
+	 * The counters live in the planner and stepper, this only reports them.
+	 */
+	class MotionStats : public core::Object {
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		virtual core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		MotionStats(core::Object* parent);
+
+		void reset();
+
+		virtual void writeJson(io::Writer& out) override;
+	};
+} // namespace swordfish::diagnostics
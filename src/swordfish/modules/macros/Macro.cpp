@@ -0,0 +1,164 @@
+/*
+ * Macro.cpp
+ */
+
+#include <cstring>
+
+#include <swordfish/core/InvalidOperationException.h>
+
+#include <marlin/gcode/gcode.h>
+
+#include "Macro.h"
+
+namespace swordfish::macros {
+	core::ValueField<int16_t> Macro::__indexField = { "index", 0, 0 };
+	core::ObjectField<core::String> Macro::__textField = { "text", 0 };
+
+	core::Schema Macro::__schema = {
+		utils::typeName<Macro>(),
+		nullptr,
+		{ __indexField },
+		{ __textField }
+	};
+
+	uint8_t Macro::validateText(std::string_view text) {
+		if (text.size() > GCODE_MACROS_SLOT_SIZE) {
+			throw core::InvalidOperationException { "Macro too long." };
+		}
+
+		size_t count = 0;
+
+		for (size_t start = 0; start < text.size();) {
+			auto eol = text.find('\n', start);
+
+			if (eol == std::string_view::npos) {
+				eol = text.size();
+			}
+
+			if (text.find_first_not_of(' ', start) < eol) {
+				count++;
+			}
+
+			start = eol + 1;
+		}
+
+		if (count > GCODE_MACROS_SLOT_COMMANDS) {
+			throw core::InvalidOperationException { "Macro has too many commands." };
+		}
+
+		return count;
+	}
+
+	bool Macro::setText(std::string_view text) {
+		auto& field = __textField.get(_pack);
+
+		if (field.value() == text) {
+			return false;
+		}
+
+		field.value(text);
+
+		_compiled = false;
+
+		return true;
+	}
+
+	void Macro::read(io::InputStream& stream) {
+		data::Record::read(stream);
+
+		_compiled = false;
+	}
+
+	bool Macro::setValueFromJson(std::string_view name, std::string_view value) {
+		if (name == __textField.name()) {
+			validateText(value);
+		}
+
+		const auto stored = data::Record::setValueFromJson(name, value);
+
+		_compiled = false;
+
+		return stored;
+	}
+
+	void Macro::compile() {
+		const auto text = getText();
+
+		// Text loaded from an older configuration may not fit
+		const auto count = validateText(text);
+
+		_source.reset(new char[text.size() + 1]);
+		_commands.reset(new parsed_command_t[count]);
+		_commandCount = 0;
+
+		memcpy(_source.get(), text.data(), text.size());
+		_source[text.size()] = '\0';
+
+		parsed_command_t active;
+		parser.save(active);
+
+#if ENABLED(GCODE_MOTION_MODES)
+		// Lines with only parameters take the motion mode in effect when the macro runs,
+		// so compile without one and leave those lines for process_parsed_now to parse.
+		const auto motion_mode_codenum = parser.motion_mode_codenum;
+#	if ENABLED(USE_GCODE_SUBCODES)
+		const auto motion_mode_subcode = parser.motion_mode_subcode;
+#	endif
+
+		parser.cancel_motion_mode();
+#endif
+
+		char* line = _source.get();
+		char* const end = line + text.size();
+
+		while (line < end) {
+			char* eol = strchr(line, '\n');
+
+			if (eol) {
+				*eol = '\0';
+			} else {
+				eol = end;
+			}
+
+			while (*line == ' ') {
+				line++;
+			}
+
+			if (*line) {
+				parser.parse(line);
+				parser.decode_values();
+				parser.save(_commands[_commandCount++]);
+			}
+
+			line = eol + 1;
+		}
+
+#if ENABLED(GCODE_MOTION_MODES)
+		parser.motion_mode_codenum = motion_mode_codenum;
+		TERN_(USE_GCODE_SUBCODES, parser.motion_mode_subcode = motion_mode_subcode);
+#endif
+
+		parser.restore(active);
+
+		_compiled = true;
+	}
+
+	void Macro::execute() {
+		// Compiling replaces the commands, so wait until an outer run of this macro is done
+		if (!_compiled && !_running) {
+			compile();
+		}
+
+		_running++;
+
+		try {
+			GcodeSuite::process_parsed_now(_commands.get(), _commandCount);
+		} catch (...) {
+			_running--;
+
+			throw;
+		}
+
+		_running--;
+	}
+} // namespace swordfish::macros
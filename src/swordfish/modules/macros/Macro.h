@@ -0,0 +1,83 @@
+/*
+ * Macro.h
+ */
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+#include <swordfish/types.h>
+
+#include <swordfish/utils/TypeInfo.h>
+
+#include <swordfish/core/Object.h>
+#include <swordfish/core/Pack.h>
+#include <swordfish/core/Schema.h>
+#include <swordfish/core/String.h>
+
+#include <swordfish/data/Record.h>
+
+#include <marlin/gcode/parser.h>
+
+namespace swordfish::macros {
+	/**
+	 * A G-code macro (M810-M819). The text is persisted, and is compiled into
+	 * parsed commands the first time it runs after being loaded or changed.
+	 * A macro redefined while it runs keeps running its old commands.
+	 *
+	 * Compiling allocates a copy of the text, which the commands point into,
+	 * and the commands themselves, both sized to the macro. A macro may hold
+	 * at most GCODE_MACROS_SLOT_COMMANDS commands.
+	 */
+	class Macro : public data::Record {
+	private:
+		static core::ValueField<int16_t> __indexField;
+		static core::ObjectField<core::String> __textField;
+
+		std::unique_ptr<char[]> _source;
+		std::unique_ptr<parsed_command_t[]> _commands;
+		uint8_t _commandCount;
+		bool _compiled;
+		uint8_t _running; // Nesting depth, the commands can't be replaced while it's non-zero
+
+		void compile();
+
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		virtual core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		Macro(core::Object* parent) :
+				data::Record(parent), _commandCount(0), _compiled(false), _running(0), _pack(__schema, *this) {
+		}
+
+		virtual int16_t getIndex() override {
+			return __indexField.get(_pack);
+		}
+
+		virtual void setIndex(int16_t value) override {
+			__indexField.set(_pack, value);
+		}
+
+		std::string_view getText() {
+			return __textField.get(_pack).value();
+		}
+
+		// Returns the number of commands in the text, throws if it won't fit in a macro.
+		static uint8_t validateText(std::string_view text);
+
+		// Returns whether the text changed.
+		bool setText(std::string_view text);
+
+		void execute();
+
+		virtual void read(io::InputStream& stream) override;
+		virtual bool setValueFromJson(std::string_view name, std::string_view value) override;
+	};
+} // namespace swordfish::macros
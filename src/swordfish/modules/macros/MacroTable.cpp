@@ -0,0 +1,28 @@
+/*
+ * MacroTable.cpp
+ */
+
+#include "MacroTable.h"
+
+namespace swordfish::macros {
+	MacroTable::MacroTable(core::Object* parent) :
+			data::Table<Macro, MacroTable>(parent) {
+	}
+
+	bool MacroTable::define(int16_t index, std::string_view text) {
+		Macro::validateText(text);
+
+		auto* macro = get(index);
+
+		if (!macro) {
+			macro = &static_cast<Macro&>(createChild());
+
+			macro->setIndex(index);
+			macro->setText(text);
+
+			return true;
+		}
+
+		return macro->setText(text);
+	}
+} // namespace swordfish::macros
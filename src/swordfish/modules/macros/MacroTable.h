@@ -0,0 +1,26 @@
+/*
+ * MacroTable.h
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include <swordfish/data/Table.h>
+
+#include "Macro.h"
+
+namespace swordfish::macros {
+	class MacroTable : public data::Table<Macro, MacroTable> {
+	public:
+		MacroTable(core::Object* parent);
+
+		virtual const char* getName() override {
+			return "macro";
+		}
+
+		// Sets the text of a macro, adding it if needed. Returns whether anything changed,
+		// and throws if the text won't fit.
+		bool define(int16_t index, std::string_view text);
+	};
+} // namespace swordfish::macros
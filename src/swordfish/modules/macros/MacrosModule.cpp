@@ -0,0 +1,29 @@
+/*
+ * MacrosModule.cpp
+ */
+
+#include "MacrosModule.h"
+
+namespace swordfish::macros {
+	MacrosModule* MacrosModule::__instance = nullptr;
+
+	core::ObjectField<MacroTable> MacrosModule::__slotsField = { "slots", 0 };
+
+	core::Schema MacrosModule::__schema = {
+		utils::typeName<MacrosModule>(),
+		&(Module::__schema),
+		{
+
+		},
+		{ __slotsField }
+	};
+
+	MacrosModule::MacrosModule(core::Object* parent) :
+			Module(parent),
+			_pack(__schema, *this, &(Module::_pack)) {
+	}
+
+	MacrosModule& MacrosModule::getInstance(core::Object* parent /*= nullptr*/) {
+		return *(__instance ?: __instance = new MacrosModule(parent));
+	}
+} // namespace swordfish::macros
@@ -0,0 +1,48 @@
+/*
+ * MacrosModule.h
+ */
+
+#pragma once
+
+#include <swordfish/Module.h>
+#include <swordfish/core/Schema.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include "MacroTable.h"
+
+namespace swordfish::macros {
+	class MacrosModule : public Module {
+	private:
+		static core::ObjectField<MacroTable> __slotsField;
+
+		static MacrosModule* __instance;
+
+		MacrosModule(core::Object* parent);
+
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		virtual ~MacrosModule() {
+		}
+
+		virtual const char* name() override {
+			return "Macros";
+		}
+
+		virtual void init() override {
+		}
+
+		MacroTable& getMacros() {
+			return __slotsField.get(_pack);
+		}
+
+		static MacrosModule& getInstance(core::Object* parent = nullptr);
+	};
+} // namespace swordfish::macros
@@ -0,0 +1,30 @@
+/*
+ * AxisHoming.cpp
+ */
+
+#include <swordfish/core/InvalidOperationException.h>
+
+#include "AxisHoming.h"
+
+namespace swordfish::motion {
+	core::ValidatedValueField<float32_t> AxisHoming::__seekFeedRateField = { "seekFeedRate", 0, 0.0f, validateNotNegative };
+	core::ValidatedValueField<float32_t> AxisHoming::__latchFeedRateField = { "latchFeedRate", 4, 0.0f, validateNotNegative };
+	core::ValidatedValueField<float32_t> AxisHoming::__latchDistanceField = { "latchDistance", 8, 0.0f, validateNotNegative };
+
+	core::Schema AxisHoming::__schema = {
+		utils::typeName<AxisHoming>(),
+		nullptr,
+		{ __seekFeedRateField,
+		  __latchFeedRateField,
+		  __latchDistanceField },
+		{
+
+		}
+	};
+
+	void AxisHoming::validateNotNegative(float32_t oldValue, float32_t newValue) {
+		if (!(newValue >= 0)) {
+			throw core::InvalidOperationException { "Homing values can't be negative." };
+		}
+	}
+} // namespace swordfish::motion
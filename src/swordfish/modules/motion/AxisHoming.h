@@ -0,0 +1,57 @@
+/*
+ * AxisHoming.h
+ */
+
+#pragma once
+
+#include <swordfish/types.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include <swordfish/core/Object.h>
+#include <swordfish/core/Pack.h>
+#include <swordfish/core/Schema.h>
+
+namespace swordfish::motion {
+	/**
+	 * How one axis finds its switch: a fast seek to it, then a back off and a
+	 * slow latch on to it. Zero leaves a value to the HOMING_FEEDRATE_MM_M,
+	 * HOMING_BUMP_DIVISOR and HOMING_BUMP_MM configuration.
+	 */
+	class AxisHoming : public core::Object {
+	private:
+		static core::ValidatedValueField<float32_t> __seekFeedRateField;
+		static core::ValidatedValueField<float32_t> __latchFeedRateField;
+		static core::ValidatedValueField<float32_t> __latchDistanceField;
+
+		static void validateNotNegative(float32_t oldValue, float32_t newValue);
+
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		virtual core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		AxisHoming(core::Object* parent) :
+				core::Object(parent), _pack(__schema, *this) {
+		}
+
+		// Speed of the seek to the switch, in units/s
+		inline float32_t seekFeedRate() {
+			return __seekFeedRateField.get(_pack);
+		}
+
+		// Speed of the latch on to the switch, in units/s
+		inline float32_t latchFeedRate() {
+			return __latchFeedRateField.get(_pack);
+		}
+
+		// How far to back off the switch before the latch, in units
+		inline float32_t latchDistance() {
+			return __latchDistanceField.get(_pack);
+		}
+	};
+} // namespace swordfish::motion
@@ -0,0 +1,61 @@
+/*
+ * InputShaper.cpp
+ */
+
+#include <swordfish/core/InvalidOperationException.h>
+
+#include <marlin/module/stepper.h>
+
+#include "InputShaper.h"
+
+namespace swordfish::motion {
+	core::ValidatedValueField<float32_t> InputShaper::__frequencyField = { "frequency", 0, 40.0f, validateFrequency };
+	core::ValidatedValueField<float32_t> InputShaper::__dampingField = { "damping", 4, 0.1f, validateDamping };
+	core::ValidatedValueField<uint8_t> InputShaper::__typeField = { "type", 8, 0, validateType };
+
+	core::Schema InputShaper::__schema = {
+		utils::typeName<InputShaper>(),
+		nullptr,
+		{ __frequencyField,
+		  __dampingField,
+		  __typeField },
+		{
+
+		}
+	};
+
+	void InputShaper::validateFrequency(float32_t oldValue, float32_t newValue) {
+#if ENABLED(INPUT_SHAPING)
+		if (!(newValue >= SHAPING_MIN_FREQ)) {
+			throw core::InvalidOperationException { "Shaper frequency is below SHAPING_MIN_FREQ." };
+		}
+#endif
+	}
+
+	void InputShaper::validateDamping(float32_t oldValue, float32_t newValue) {
+		if (!(newValue >= 0 && newValue <= 0.5f)) {
+			throw core::InvalidOperationException { "Shaper damping must be from 0 to 0.5." };
+		}
+	}
+
+	void InputShaper::validateType(uint8_t oldValue, uint8_t newValue) {
+		if (newValue > 3) {
+			throw core::InvalidOperationException { "Shaper type must be 0 (None), 1 (ZV), 2 (ZVD) or 3 (EI)." };
+		}
+	}
+
+	void InputShaper::apply(Axis axis) {
+		if (type() == _appliedType && frequency() == _appliedFrequency && damping() == _appliedDamping) {
+			return;
+		}
+
+		_appliedType = type();
+		_appliedFrequency = frequency();
+		_appliedDamping = damping();
+
+#if ENABLED(INPUT_SHAPING)
+		// Waits for the moves queued with the old shaper to finish
+		stepper.set_shaping(axis, (ShaperType) _appliedType, _appliedFrequency, _appliedDamping);
+#endif
+	}
+} // namespace swordfish::motion
@@ -0,0 +1,62 @@
+/*
+ * InputShaper.h
+ */
+
+#pragma once
+
+#include <swordfish/types.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include <swordfish/core/Object.h>
+#include <swordfish/core/Pack.h>
+#include <swordfish/core/Schema.h>
+
+namespace swordfish::motion {
+	class InputShaper : public core::Object {
+	private:
+		static core::ValidatedValueField<float32_t> __frequencyField;
+		static core::ValidatedValueField<float32_t> __dampingField;
+		static core::ValidatedValueField<uint8_t> __typeField;
+
+		static void validateFrequency(float32_t oldValue, float32_t newValue);
+		static void validateDamping(float32_t oldValue, float32_t newValue);
+		static void validateType(uint8_t oldValue, uint8_t newValue);
+
+		// What the stepper was last given
+		uint8_t _appliedType;
+		float32_t _appliedFrequency;
+		float32_t _appliedDamping;
+
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		virtual core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		InputShaper(core::Object* parent) :
+				core::Object(parent), _appliedType(0), _appliedFrequency(0), _appliedDamping(0), _pack(__schema, *this) {
+		}
+
+		// 0 = None, 1 = ZV, 2 = ZVD, 3 = EI
+		inline uint8_t type() {
+			return __typeField.get(_pack);
+		}
+
+		// Ringing frequency of the axis, in Hz
+		inline float32_t frequency() {
+			return __frequencyField.get(_pack);
+		}
+
+		// Damping ratio of the ringing
+		inline float32_t damping() {
+			return __dampingField.get(_pack);
+		}
+
+		// Hand the shaper to the stepper for the given axis, if it has changed
+		void apply(Axis axis);
+	};
+} // namespace swordfish::motion
@@ -17,6 +17,7 @@
 
 
 #include <swordfish/debug.h>
+#include <swordfish/core/InvalidOperationException.h>
 #include <swordfish/modules/estop/EStopModule.h>
 #include <swordfish/modules/status/StatusModule.h>
 
@@ -34,21 +35,43 @@ namespace swordfish::motion {
 
 	core::ValueField<int16_t> MotionModule::__activeCoordinateSystemField = { "wcs", 0, 0 };
 	core::ValueField<bool> MotionModule::__shouldHomeFourth = { "shouldHomeFourth", 18, false };
+	core::ValueField<bool> MotionModule::__rotaryA = { "rotaryA", 19, false };
+	core::ValidatedValueField<float32_t> MotionModule::__rotaryRadius = { "rotaryRadius", 20, 0.0f, validateRotaryRadius };
 	core::ObjectField<CoordinateSystemTable> MotionModule::__workCoordinateSystemsField = { "workCoordinateSystems", 0 };
 	core::ObjectField<Limits> MotionModule::__limitsField = { "limits", 1 };
 	core::ObjectField<core::LinearVector3> MotionModule::__homeOffsetField = { "homeOffset", 2 };
 	core::ObjectField<core::LinearVector3> MotionModule::__workOffsetField = { "workOffset", 3 };
 	core::ObjectField<core::LinearVector3> MotionModule::__toolOffsetField = { "toolOffset", 4 };
+	core::ObjectField<InputShaper> MotionModule::__xShaperField = { "xShaper", 5 };
+	core::ObjectField<InputShaper> MotionModule::__yShaperField = { "yShaper", 6 };
+	core::ObjectField<MotionProfile> MotionModule::__rapidProfileField = { "rapidProfile", 7 };
+	core::ObjectField<MotionProfile> MotionModule::__feedProfileField = { "feedProfile", 8 };
+	core::ObjectField<MotionProfile> MotionModule::__probingProfileField = { "probingProfile", 9 };
+	core::ObjectField<MotionProfile> MotionModule::__homingProfileField = { "homingProfile", 10 };
+	core::ObjectField<AxisHoming> MotionModule::__xHomingField = { "xHoming", 11 };
+	core::ObjectField<AxisHoming> MotionModule::__yHomingField = { "yHoming", 12 };
+	core::ObjectField<AxisHoming> MotionModule::__zHomingField = { "zHoming", 13 };
+	core::ObjectField<AxisHoming> MotionModule::__aHomingField = { "aHoming", 14 };
 
 	core::Schema MotionModule::__schema = {
 		utils::typeName<MotionModule>(),
 		&(Module::__schema),
-		{ __activeCoordinateSystemField, __shouldHomeFourth },
+		{ __activeCoordinateSystemField, __shouldHomeFourth, __rotaryA, __rotaryRadius },
 		{ __workCoordinateSystemsField,
 		                    __limitsField,
 		                    __homeOffsetField,
 		                    __workOffsetField,
-		                    __toolOffsetField }
+		                    __toolOffsetField,
+		                    __xShaperField,
+		                    __yShaperField,
+		                    __rapidProfileField,
+		                    __feedProfileField,
+		                    __probingProfileField,
+		                    __homingProfileField,
+		                    __xHomingField,
+		                    __yHomingField,
+		                    __zHomingField,
+		                    __aHomingField }
 	};
 
 	MotionModule::MotionModule(Object* parent) :
@@ -80,6 +103,8 @@ namespace swordfish::motion {
 		}
 
 		updateOffset();
+
+		changed();
 	}
 
 	void MotionModule::init() {
@@ -103,6 +128,14 @@ namespace swordfish::motion {
 		updateOffset();
 	}
 
+	void MotionModule::changed() {
+		applyShaping();
+
+		applyProfiles();
+
+		applyRotary();
+	}
+
 	static inline const char* absoluteOrRelative(AxisSelector axis, Flags<AxisSelector>& relativeAxis) {
 		return relativeAxis & axis ? "relative" : "absolute";
 	}
@@ -110,16 +143,15 @@ namespace swordfish::motion {
 	void MotionModule::move(Movement movement) {
 		gcode.throwIfAborted();
 
-		Vector4f32 currentNative { current_position.x(), current_position.y(), current_position.z(), 1 };
-		Vector4f32 currentLogical = _logicalTransform * currentNative;
-		Vector4f32 targetLogical {
+		Vector3f32 currentNative { current_position.x(), current_position.y(), current_position.z() };
+		Vector3f32 currentLogical = _transform.toLogical(currentNative);
+		Vector3f32 targetLogical {
 			isnan(movement.x) ? currentLogical.x() : (movement.relativeAxes & AxisSelector::X ? currentLogical.x() + movement.x : movement.x),
 			isnan(movement.y) ? currentLogical.y() : (movement.relativeAxes & AxisSelector::Y ? currentLogical.y() + movement.y : movement.y),
-			isnan(movement.z) ? currentLogical.z() : (movement.relativeAxes & AxisSelector::Z ? currentLogical.z() + movement.z : movement.z),
-			1
+			isnan(movement.z) ? currentLogical.z() : (movement.relativeAxes & AxisSelector::Z ? currentLogical.z() + movement.z : movement.z)
 		};
 
-		Vector4f32 targetNative = _nativeTransform * targetLogical;
+		Vector3f32 targetNative = _transform.toNative(targetLogical);
 
 		debug()("===============================================");
 		debug()(
@@ -132,15 +164,16 @@ namespace swordfish::motion {
 		debug()("target logical -> x: ", targetLogical.x(), ", y: ", targetLogical.y(), ", z: ", targetLogical.z());
 		debug()("target native -> x: ", targetNative.x(), ", y: ", targetNative.y(), ", z: ", targetNative.z());
 
-		_limits.throwIfOutside({ targetNative.x(), targetNative.y(), targetNative.z() });
+		_limits.throwIfOutside(targetNative);
 
+		// Rotary axes stay where they are
 		Vector6f32 target = {
 			targetNative.x(),
 			targetNative.y(),
 			targetNative.z(),
-			0,
-			0,
-			0
+			current_position.a(),
+			current_position.b(),
+			current_position.c()
 		};
 
 		auto feed_rate = movement.feed_rate.has_value() ? movement.feed_rate.value() : feedrate_mm_s;
@@ -168,6 +201,29 @@ namespace swordfish::motion {
 		planner.synchronize();
 	}
 
+	void MotionModule::applyShaping() {
+		getXShaper().apply(Axis::X());
+		getYShaper().apply(Axis::Y());
+	}
+
+	void MotionModule::applyProfiles() {
+		getRapidProfile().apply(MotionClass::Rapid);
+		getFeedProfile().apply(MotionClass::Feed);
+		getProbingProfile().apply(MotionClass::Probing);
+		getHomingProfile().apply(MotionClass::Homing);
+	}
+
+	void MotionModule::validateRotaryRadius(float32_t oldValue, float32_t newValue) {
+		if (!(newValue >= 0)) {
+			throw core::InvalidOperationException { "Rotary radius can't be negative." };
+		}
+	}
+
+	void MotionModule::applyRotary() {
+		// A's surface speed is worked out as each move is planned; queued moves keep the radius they were planned with
+		planner.rotary_radius_mm = getRotaryRadius();
+	}
+
 	void MotionModule::setActiveCoordinateSystem(CoordinateSystem& coordinateSystem) {
 		__activeCoordinateSystemField.set(_pack, coordinateSystem.getIndex());
 
@@ -204,8 +260,7 @@ namespace swordfish::motion {
 			{				0.0, 0.0, 0.0, 1.0}
 		};
 
-		_nativeTransform = translate * shear;
-		_logicalTransform = _nativeTransform.inverse();
+		_transform.set(translate * shear);
 	}
 
 	void MotionModule::updateOffset() {
@@ -272,7 +327,7 @@ namespace swordfish::motion {
 		       .z = movement.z,
 		       .feed_rate = movement.feed_rate.has_value() ? movement.feed_rate.value() : rapidrate_mm_s,
 		       .relativeAxes = movement.relativeAxes,
-		       .accel_mm_s2 = isnan(movement.accel_mm_s2) ? planner.settings.travel_acceleration : movement.accel_mm_s2,
+		       .accel_mm_s2 = movement.accel_mm_s2,
 					 .state = MachineState::RapidMove });
 	}
 
@@ -282,7 +337,7 @@ namespace swordfish::motion {
 		       .z = movement.z,
 		       .feed_rate = movement.feed_rate.has_value() ? movement.feed_rate.value() : feedrate_mm_s,
 		       .relativeAxes = movement.relativeAxes,
-		       .accel_mm_s2 = isnan(movement.accel_mm_s2) ? planner.settings.acceleration : movement.accel_mm_s2,
+		       .accel_mm_s2 = movement.accel_mm_s2,
 					 .state = MachineState::FeedMove });
 	}
 } // namespace swordfish::motion
\ No newline at end of file
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <limits>
+#include <optional>
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -23,11 +24,15 @@
 #include <swordfish/core/Pack.h>
 #include <swordfish/modules/status/StatusModule.h>
 
+#include "AxisHoming.h"
 #include "CoordinateSystem.h"
 #include "CoordinateSystemTable.h"
-#include "Feedrate.h"
+#include "FeedRate.h"
+#include "InputShaper.h"
 #include "Limits.h"
+#include "MotionProfile.h"
 #include "NotHomedException.h"
+#include "Transform.h"
 
 #include <marlin/core/types.h>
 
@@ -61,16 +66,30 @@ namespace swordfish::motion {
 	private:
 		static core::ValueField<int16_t> __activeCoordinateSystemField;
 		static core::ValueField<bool> __shouldHomeFourth;
+		static core::ValueField<bool> __rotaryA;
+		static core::ValidatedValueField<float32_t> __rotaryRadius;
 		static core::ObjectField<CoordinateSystemTable> __workCoordinateSystemsField;
 		static core::ObjectField<Limits> __limitsField;
 		static core::ObjectField<core::LinearVector3> __homeOffsetField;
 		static core::ObjectField<core::LinearVector3> __workOffsetField;
 		static core::ObjectField<core::LinearVector3> __toolOffsetField;
+		static core::ObjectField<InputShaper> __xShaperField;
+		static core::ObjectField<InputShaper> __yShaperField;
+		static core::ObjectField<MotionProfile> __rapidProfileField;
+		static core::ObjectField<MotionProfile> __feedProfileField;
+		static core::ObjectField<MotionProfile> __probingProfileField;
+		static core::ObjectField<MotionProfile> __homingProfileField;
+		static core::ObjectField<AxisHoming> __xHomingField;
+		static core::ObjectField<AxisHoming> __yHomingField;
+		static core::ObjectField<AxisHoming> __zHomingField;
+		static core::ObjectField<AxisHoming> __aHomingField;
 
 		MotionModule(core::Object* parent);
 
 		static MotionModule* __instance;
 
+		static void validateRotaryRadius(float32_t oldValue, float32_t newValue);
+
 	protected:
 		static core::Schema __schema;
 
@@ -86,8 +105,7 @@ namespace swordfish::motion {
 
 		swordfish::math::Vector3f32 _offset;
 		swordfish::math::Vector3f32 _rotation;
-		Eigen::Matrix4f _nativeTransform;
-		Eigen::Matrix4f _logicalTransform;
+		Transform _transform;
 
 		virtual core::Pack& getPack() override;
 
@@ -102,6 +120,7 @@ namespace swordfish::motion {
 			return "Motion Module";
 		}
 		virtual void init() override;
+		virtual void changed() override;
 
 		void setLimitsEnabled(bool limitsEnabled) {
 			_limits.setEnabled(limitsEnabled);
@@ -137,10 +156,66 @@ namespace swordfish::motion {
 			return __shouldHomeFourth.get(_pack);
 		}
 
+		// A is a rotary table: it tracks 0-360 and absolute moves take the shortest way round
+		bool isRotaryA() {
+			return __rotaryA.get(_pack);
+		}
+
+		// The radius in mm that A's feed is taken at, so it shares F with X, Y and Z (0 for degrees)
+		float32_t getRotaryRadius() {
+			return __rotaryRadius.get(_pack);
+		}
+
 		Limits& getLimits() {
 			return _limits;
 		}
 
+		InputShaper& getXShaper() {
+			return __xShaperField.get(_pack);
+		}
+
+		InputShaper& getYShaper() {
+			return __yShaperField.get(_pack);
+		}
+
+		void applyShaping();
+
+		MotionProfile& getRapidProfile() {
+			return __rapidProfileField.get(_pack);
+		}
+
+		MotionProfile& getFeedProfile() {
+			return __feedProfileField.get(_pack);
+		}
+
+		MotionProfile& getProbingProfile() {
+			return __probingProfileField.get(_pack);
+		}
+
+		MotionProfile& getHomingProfile() {
+			return __homingProfileField.get(_pack);
+		}
+
+		void applyProfiles();
+
+		AxisHoming& getXHoming() {
+			return __xHomingField.get(_pack);
+		}
+
+		AxisHoming& getYHoming() {
+			return __yHomingField.get(_pack);
+		}
+
+		AxisHoming& getZHoming() {
+			return __zHomingField.get(_pack);
+		}
+
+		AxisHoming& getAHoming() {
+			return __aHomingField.get(_pack);
+		}
+
+		void applyRotary();
+
 		CoordinateSystem& getMachineCoordiateSystem() {
 			return _machineCoordinateSystem;
 		}
@@ -167,6 +242,11 @@ namespace swordfish::motion {
 
 		void synchronize();
 
+		const Transform& getTransform() const {
+			return _transform;
+		}
+
+		// A single axis can only be translated, Y's shear needs X as well
 		FORCE_INLINE float32_t toLogical(Axis axis, f32 value) {
 			if (axis.is_linear()) {
 				return value + _offset[axis];
@@ -183,89 +263,87 @@ namespace swordfish::motion {
 		}
 
 		FORCE_INLINE swordfish::math::Vector2f32 toLogical(const swordfish::math::Vector2f32& raw) {
-			return {
-				raw.x() + _offset.x(),
-				raw.y() + _offset.y()
-			};
+			return _transform.toLogical({ raw.x(), raw.y(), 0 }).head<2>();
 		}
 
 		FORCE_INLINE swordfish::math::Vector3f32 toLogical(const swordfish::math::Vector3f32& raw) {
-			return {
-				raw.x() + _offset.x(),
-				raw.y() + _offset.y(),
-				raw.z() + _offset.z()
-			};
+			return _transform.toLogical(raw);
 		}
 
 		FORCE_INLINE swordfish::math::Vector4f32 toLogical(const swordfish::math::Vector4f32& raw) {
+			const auto linear = _transform.toLogical(raw.head<3>());
+
 			return {
-				raw.x() + _offset.x(),
-				raw.y() + _offset.y(),
-				raw.z() + _offset.z(),
+				linear.x(),
+				linear.y(),
+				linear.z(),
 				raw.a() + _rotation.x()
 			};
 		}
 
 		FORCE_INLINE swordfish::math::Vector5f32 toLogical(const swordfish::math::Vector5f32& raw) {
+			const auto linear = _transform.toLogical(raw.head<3>());
+
 			return {
-				raw.x() + _offset.x(),
-				raw.y() + _offset.y(),
-				raw.z() + _offset.z(),
+				linear.x(),
+				linear.y(),
+				linear.z(),
 				raw.a() + _rotation.x(),
 				raw.b() + _rotation.y()
 			};
 		}
 
 		FORCE_INLINE swordfish::math::Vector6f32 toLogical(const swordfish::math::Vector6f32& raw) {
+			const auto linear = _transform.toLogical(raw.head<3>());
+
 			return {
-				raw.x() + _offset.x(),
-				raw.y() + _offset.y(),
-				raw.z() + _offset.z(),
+				linear.x(),
+				linear.y(),
+				linear.z(),
 				raw.a() + _rotation.x(),
 				raw.b() + _rotation.y(),
 				raw.c() + _rotation.z()
 			};
 		}
 
-FORCE_INLINE swordfish::math::Vector2f32 toNative(const swordfish::math::Vector2f32& raw) {
-			return {
-				raw.x() - _offset.x(),
-				raw.y() - _offset.y()
-			};
+		FORCE_INLINE swordfish::math::Vector2f32 toNative(const swordfish::math::Vector2f32& raw) {
+			return _transform.toNative({ raw.x(), raw.y(), 0 }).head<2>();
 		}
 
 		FORCE_INLINE swordfish::math::Vector3f32 toNative(const swordfish::math::Vector3f32& raw) {
-			return {
-				raw.x() - _offset.x(),
-				raw.y() - _offset.y(),
-				raw.z() - _offset.z()
-			};
+			return _transform.toNative(raw);
 		}
 
 		FORCE_INLINE swordfish::math::Vector4f32 toNative(const swordfish::math::Vector4f32& raw) {
+			const auto linear = _transform.toNative(raw.head<3>());
+
 			return {
-				raw.x() - _offset.x(),
-				raw.y() - _offset.y(),
-				raw.z() - _offset.z(),
+				linear.x(),
+				linear.y(),
+				linear.z(),
 				raw.a() - _rotation.x()
 			};
 		}
 
 		FORCE_INLINE swordfish::math::Vector5f32 toNative(const swordfish::math::Vector5f32& raw) {
+			const auto linear = _transform.toNative(raw.head<3>());
+
 			return {
-				raw.x() - _offset.x(),
-				raw.y() - _offset.y(),
-				raw.z() - _offset.z(),
+				linear.x(),
+				linear.y(),
+				linear.z(),
 				raw.a() - _rotation.x(),
 				raw.b() - _rotation.y()
 			};
 		}
 
 		FORCE_INLINE swordfish::math::Vector6f32 toNative(const swordfish::math::Vector6f32& raw) {
+			const auto linear = _transform.toNative(raw.head<3>());
+
 			return {
-				raw.x() - _offset.x(),
-				raw.y() - _offset.y(),
-				raw.z() - _offset.z(),
+				linear.x(),
+				linear.y(),
+				linear.z(),
 				raw.a() - _rotation.x(),
 				raw.b() - _rotation.y(),
 				raw.c() - _rotation.z()
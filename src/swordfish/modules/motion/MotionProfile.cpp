@@ -0,0 +1,41 @@
+/*
+ * MotionProfile.cpp
+ */
+
+#include <swordfish/core/InvalidOperationException.h>
+
+#include <marlin/module/planner.h>
+
+#include "MotionProfile.h"
+
+namespace swordfish::motion {
+	core::ValidatedValueField<float32_t> MotionProfile::__accelerationField = { "acceleration", 0, 0.0f, validateNotNegative };
+	core::ValidatedValueField<float32_t> MotionProfile::__junctionDeviationField = { "junctionDeviation", 4, 0.0f, validateNotNegative };
+	core::ValidatedValueField<float32_t> MotionProfile::__maxFeedRateField = { "maxFeedRate", 8, 0.0f, validateNotNegative };
+
+	core::Schema MotionProfile::__schema = {
+		utils::typeName<MotionProfile>(),
+		nullptr,
+		{ __accelerationField,
+		  __junctionDeviationField,
+		  __maxFeedRateField },
+		{
+
+		}
+	};
+
+	void MotionProfile::validateNotNegative(float32_t oldValue, float32_t newValue) {
+		if (!(newValue >= 0)) {
+			throw core::InvalidOperationException { "Motion profile values can't be negative." };
+		}
+	}
+
+	void MotionProfile::apply(MotionClass motionClass) {
+		// Blocks copy their limits when they're planned, so moves already queued keep the old profile
+		planner.motion_profiles[(uint8_t) motionClass] = {
+			.acceleration = acceleration(),
+			.junction_deviation_mm = junctionDeviation(),
+			.max_feedrate_unit_per_s = maxFeedRate()
+		};
+	}
+} // namespace swordfish::motion
@@ -0,0 +1,68 @@
+/*
+ * MotionProfile.h
+ */
+
+#pragma once
+
+#include <swordfish/types.h>
+#include <swordfish/utils/TypeInfo.h>
+
+#include <swordfish/core/Object.h>
+#include <swordfish/core/Pack.h>
+#include <swordfish/core/Schema.h>
+
+namespace swordfish::motion {
+	// The classes of motion that get their own profile
+	enum class MotionClass : uint8_t {
+		Feed, // Cutting, and anything not below
+		Rapid,
+		Probing,
+		Homing,
+		__size__
+	};
+
+	/**
+	 * How hard one class of motion (rapid, feed, probing or homing) may drive
+	 * the axes. Zero leaves a value to the planner's M204/M205 settings.
+	 */
+	class MotionProfile : public core::Object {
+	private:
+		static core::ValidatedValueField<float32_t> __accelerationField;
+		static core::ValidatedValueField<float32_t> __junctionDeviationField;
+		static core::ValidatedValueField<float32_t> __maxFeedRateField;
+
+		static void validateNotNegative(float32_t oldValue, float32_t newValue);
+
+	protected:
+		static core::Schema __schema;
+
+		core::Pack _pack;
+
+		virtual core::Pack& getPack() override {
+			return _pack;
+		}
+
+	public:
+		MotionProfile(core::Object* parent) :
+				core::Object(parent), _pack(__schema, *this) {
+		}
+
+		// Acceleration along the path, in mm/s²
+		inline float32_t acceleration() {
+			return __accelerationField.get(_pack);
+		}
+
+		// Junction deviation for the corners, in mm
+		inline float32_t junctionDeviation() {
+			return __junctionDeviationField.get(_pack);
+		}
+
+		// Cap on the speed along the path, in mm/s
+		inline float32_t maxFeedRate() {
+			return __maxFeedRateField.get(_pack);
+		}
+
+		// Hand the profile to the planner for the given class of motion
+		void apply(MotionClass motionClass);
+	};
+} // namespace swordfish::motion
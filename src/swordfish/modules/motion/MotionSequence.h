@@ -0,0 +1,59 @@
+/*
+ * MotionSequence.h
+ */
+
+#pragma once
+
+#include "CoordinateSystem.h"
+#include "MotionModule.h"
+
+namespace swordfish::motion {
+	/**
+	 * A chain of moves for internal routines such as tool changes. The legs are
+	 * queued back to back, so the planner carries speed through the corners
+	 * between them instead of stopping and waiting for the next one to be
+	 * queued. Only sync() waits for the machine, so call it where the routine
+	 * reads a sensor or drives a pin.
+	 */
+	class MotionSequence {
+	private:
+		MotionModule& _motionModule;
+
+	public:
+		MotionSequence(MotionModule& motionModule) :
+				_motionModule(motionModule) {
+		}
+
+		// The legs after this are in the given coordinate system
+		MotionSequence& in(CoordinateSystem& coordinateSystem) {
+			_motionModule.setActiveCoordinateSystem(coordinateSystem);
+
+			return *this;
+		}
+
+		MotionSequence& move(Movement movement) {
+			_motionModule.move(movement);
+
+			return *this;
+		}
+
+		MotionSequence& rapid(Movement movement) {
+			_motionModule.rapidMove(movement);
+
+			return *this;
+		}
+
+		MotionSequence& feed(Movement movement) {
+			_motionModule.feedMove(movement);
+
+			return *this;
+		}
+
+		// Wait until every leg so far has finished
+		MotionSequence& sync() {
+			_motionModule.synchronize();
+
+			return *this;
+		}
+	};
+} // namespace swordfish::motion
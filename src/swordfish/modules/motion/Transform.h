@@ -0,0 +1,105 @@
+/*
+ * Transform.h
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include <swordfish/macros.h>
+#include <swordfish/math.h>
+#include <swordfish/types.h>
+
+namespace swordfish::motion {
+	enum class TransformKind : u8 {
+		Identity,
+		Translation,
+		Shear, // Translation plus Y sheared along X
+		General
+	};
+
+	/**
+	 * The logical to native transform of X, Y and Z. It is classified when set,
+	 * so the usual pure translation is a few adds instead of a 4x4 multiply and
+	 * only a general transform is inverted.
+	 */
+	class Transform {
+	private:
+		TransformKind _kind = TransformKind::Identity;
+		math::Vector3f32 _translation = math::Vector3f32::Zero();
+		f32 _shear = 0;
+		Eigen::Matrix4f _native = Eigen::Matrix4f::Identity();
+		Eigen::Matrix4f _logical = Eigen::Matrix4f::Identity();
+
+	public:
+		void set(const Eigen::Matrix4f& native) {
+			const Eigen::Matrix3f linear = native.topLeftCorner<3, 3>();
+			Eigen::Matrix3f sheared = Eigen::Matrix3f::Identity();
+
+			sheared(1, 0) = linear(1, 0);
+
+			_translation = native.topRightCorner<3, 1>();
+			_shear = linear(1, 0);
+			_native = native;
+
+			if (native.row(3) != Eigen::RowVector4f(0, 0, 0, 1) || linear != sheared) {
+				_kind = TransformKind::General;
+				_logical = native.inverse();
+			} else if (_shear != 0) {
+				_kind = TransformKind::Shear;
+			} else if (!_translation.isZero(0)) {
+				_kind = TransformKind::Translation;
+			} else {
+				_kind = TransformKind::Identity;
+			}
+		}
+
+		TransformKind kind() const {
+			return _kind;
+		}
+
+		FORCE_INLINE math::Vector3f32 toNative(const math::Vector3f32& logical) const {
+			switch (_kind) {
+				case TransformKind::Identity:
+					return logical;
+
+				case TransformKind::Translation:
+					return logical + _translation;
+
+				case TransformKind::Shear:
+					return {
+						logical.x() + _translation.x(),
+						logical.y() + _shear * logical.x() + _translation.y(),
+						logical.z() + _translation.z()
+					};
+
+				default:
+					return _native.topLeftCorner<3, 3>() * logical + _native.topRightCorner<3, 1>();
+			}
+		}
+
+		FORCE_INLINE math::Vector3f32 toLogical(const math::Vector3f32& native) const {
+			switch (_kind) {
+				case TransformKind::Identity:
+					return native;
+
+				case TransformKind::Translation:
+					return native - _translation;
+
+				case TransformKind::Shear: {
+					const f32 x = native.x() - _translation.x();
+
+					return {
+						x,
+						native.y() - _translation.y() - _shear * x,
+						native.z() - _translation.z()
+					};
+				}
+
+				default:
+					return _logical.topLeftCorner<3, 3>() * native + _logical.topRightCorner<3, 1>();
+			}
+		}
+	};
+} // namespace swordfish::motion
@@ -129,6 +129,15 @@ namespace swordfish::status {
 
 				break;
 			}
+
+			case MachineState::Jogging: {
+				//debug()("MachineState::Jogging");
+
+				driver_.set_color(128, 128, 0);
+				driver_.set_sweep(true);
+
+				break;
+			}
 		}
 	}
 
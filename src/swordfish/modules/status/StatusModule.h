@@ -16,7 +16,7 @@
 #include "WS2812Driver.h"
 
 namespace swordfish::status {
-	enum class MachineState {
+	enum class MachineState : uint8_t {
 		Idle,
 		EmergencyStop,
 		FeedMove,
@@ -25,6 +25,7 @@ namespace swordfish::status {
 		AwaitingInput,
 		SpindleRamp,
 		Probing,
+		Jogging,
 	};
 
 	class StatusModule : public Module {
@@ -23,6 +23,7 @@
 #include <swordfish/io/Writer.h>
 #include <swordfish/modules/estop/EStopException.h>
 #include <swordfish/modules/motion/MotionModule.h>
+#include <swordfish/modules/motion/MotionSequence.h>
 #include <swordfish/modules/status/StatusModule.h>
 
 #include "ToolsModule.h"
@@ -340,21 +341,17 @@ start:
 		auto& mcs = motionModule.getMachineCoordiateSystem();
 		auto& tcs = motionModule.getToolChangeCoordinateSystem();
 		auto& tccs = motionModule.getToolChangeCoordinateSystem();
+		MotionSequence sequence(motionModule);
 
-		motionModule.setActiveCoordinateSystem(mcs);
-		motionModule.rapidMove({ .z = 0 });
+		sequence.in(mcs).rapid({ .z = 0 });
 
 		auto nativeClearanceX = motionModule.toNative(Axis::X(), CaddyClearanceX);
 
 		if (current_position.x() < nativeClearanceX) {
-			motionModule.setActiveCoordinateSystem(tcs);
-			motionModule.rapidMove({ .x = CaddyClearanceX });
+			sequence.in(tcs).rapid({ .x = CaddyClearanceX });
 		}
 
-		motionModule.setActiveCoordinateSystem(tccs);
-		motionModule.rapidMove({ .x = 0, .y = 0 });
-
-		motionModule.synchronize();
+		sequence.in(tccs).rapid({ .x = 0, .y = 0 }).sync();
 	}
 
 	void ToolsModule::manualChange() {
@@ -526,23 +523,22 @@ start:
 		auto& tcs = motionModule.getToolCoordinateSystem();
 		auto homeOffset = motionModule.getHomeOffset();
 		auto workOffset = motionModule.getWorkOffset();
+		MotionSequence sequence(motionModule);
 
 		// Clear any active tool offset
 		motionModule.setToolOffset({ 0, 0, 0 });
 
-		motionModule.setActiveCoordinateSystem(mcs);
-		motionModule.rapidMove({ .z = 0 });
-
-		motionModule.setActiveCoordinateSystem(tcs);
+		sequence.in(mcs).rapid({ .z = 0 }).in(tcs);
 
 		if (isAutomatic()) {
-			motionModule.rapidMove({ .x = CaddyClearanceX });
-			motionModule.rapidMove({ .y = 0 });
-			motionModule.rapidMove({ .x = 0 });
+			sequence.rapid({ .x = CaddyClearanceX }).rapid({ .y = 0 }).rapid({ .x = 0 });
 		} else {
-			motionModule.rapidMove({ .x = 0, .y = 0 });
+			sequence.rapid({ .x = 0, .y = 0 });
 		}
 
+		// The probe must not be armed until the machine is over it
+		sequence.sync();
+
 		// Run the tool probe
 		remember_feedrate_scaling_off();
 
@@ -567,14 +563,13 @@ start:
 		debug()("tool offsetZ: ", offsetZ);
 
 		// Raise the Z axis
-		motionModule.setActiveCoordinateSystem(mcs);
-		motionModule.rapidMove({ .z = 0 });
+		sequence.in(mcs).rapid({ .z = 0 });
 
 		if (isAutomatic()) {
 			auto& limits = motionModule.getLimits();
 			auto& minObj = limits.getMin();
 
-			motionModule.move({ .x = minObj.x(), .feed_rate = homing_feedrate(Axis::X()) });
+			sequence.move({ .x = minObj.x(), .feed_rate = homing_feedrate(Axis::X()) });
 		}
 
 		return offsetZ;
@@ -621,9 +616,9 @@ start:
 
 			_flags[HomingFlag] = true;
 
-			motionModule.move({ .x = 100, .feed_rate = homing_feedrate(Axis::X()), .relativeAxes = AxisSelector::All, .state = MachineState::Homing });
-
-			planner.synchronize();
+			MotionSequence(motionModule)
+					.move({ .x = 100, .feed_rate = homing_feedrate(Axis::X()), .relativeAxes = AxisSelector::All, .state = MachineState::Homing })
+					.sync();
 
 			_flags[HomingFlag] = false;
 		}
@@ -640,13 +635,10 @@ start:
 		debug()("storing in pocket: ", pocket.getIndex());
 
 		Vector3f32 target = pocket.getOffset();
+		MotionSequence sequence(motionModule);
 
 		// move z to top
-		motionModule.setActiveCoordinateSystem(mcs);
-		motionModule.rapidMove({ .z = 0 });
-		motionModule.synchronize();
-
-		motionModule.setActiveCoordinateSystem(tcs);
+		sequence.in(mcs).rapid({ .z = 0 }).in(tcs);
 
 		// first we have to move to a position inline with the Y position of the pocket,
 		// and clear of the caddy on the X axis.
@@ -663,17 +655,14 @@ start:
 		auto nativeClearanceX = motionModule.toNative(Axis::X(), caddyClearanceX);
 
 		if (current_position.x() >= nativeClearanceX) {
-			motionModule.rapidMove({ .x = caddyClearanceX, .y = target.y() });
-			motionModule.synchronize();
+			sequence.rapid({ .x = caddyClearanceX, .y = target.y() });
 		} else {
-			motionModule.rapidMove({ .x = caddyClearanceX });
-			motionModule.synchronize();
-
-			motionModule.rapidMove({ .y = target.y() });
-			motionModule.synchronize();
+			sequence.rapid({ .x = caddyClearanceX }).rapid({ .y = target.y() });
 		}
 
 		if (hasATCDustShoe()) {
+			sequence.sync();
+
 			WRITE(ATC_SEAL_PIN, ATC_SEAL_PIN_INVERTED);
 
 			safe_delay(500);
@@ -681,23 +670,18 @@ start:
 
 		// move to the tool clip clearance position on the X axis, this is slightly closer to the pocket than
 		// the caddy clearance position.
-		motionModule.move({ .x = target.x() + ToolClipClearanceX, .feed_rate = homing_feedrate(Axis::X()) });
-		motionModule.synchronize();
+		sequence.move({ .x = target.x() + ToolClipClearanceX, .feed_rate = homing_feedrate(Axis::X()) });
 
 		// move z to pocket offset.z
-		motionModule.move({ .z = target.z(), .feed_rate = homing_feedrate(Axis::Z()) });
-		motionModule.synchronize();
+		sequence.move({ .z = target.z(), .feed_rate = homing_feedrate(Axis::Z()) });
 
 		// move to x position of pocket offset
-		motionModule.move({ .x = target.x(), .feed_rate = homing_feedrate(Axis::X()) });
-		motionModule.synchronize();
+		sequence.move({ .x = target.x(), .feed_rate = homing_feedrate(Axis::X()) }).sync();
 
 		unlock();
 
 		// move z to top
-		motionModule.setActiveCoordinateSystem(mcs);
-		motionModule.rapidMove({ .z = 0 });
-		motionModule.synchronize();
+		sequence.in(mcs).rapid({ .z = 0 }).sync();
 
 		lock();
 
@@ -731,37 +715,30 @@ start:
 
 			promptUserToLoadTool(tool.getIndex());
 		} else {
-			// move z to top
-			motionModule.setActiveCoordinateSystem(mcs);
-			motionModule.rapidMove({ .z = 0 });
-			motionModule.synchronize();
+			MotionSequence sequence(motionModule);
 
-			motionModule.setActiveCoordinateSystem(tcs);
+			// move z to top
+			sequence.in(mcs).rapid({ .z = 0 }).in(tcs);
 
 			Vector3f32 target = sourcePocket->getOffset();
 
 			debug()("target -> x: ", target.x(), ", y: ", target.y());
 
 			// move to x y of pocket offset
-			motionModule.rapidMove({ .x = target.x(), .y = target.y() });
-			motionModule.synchronize();
+			sequence.rapid({ .x = target.x(), .y = target.y() }).sync();
 
 			unlock();
 
 			// move z to pocket offset.z
-			motionModule.move({ .z = target.z(), .feed_rate = homing_feedrate(Axis::Z()) });
-			motionModule.synchronize();
+			sequence.move({ .z = target.z(), .feed_rate = homing_feedrate(Axis::Z()) }).sync();
 
 			lock();
 
 			// remove tool from pocket
-			motionModule.move({ .x = target.x() + ToolClipClearanceX, .feed_rate = homing_feedrate(Axis::X()) });
-			motionModule.synchronize();
+			sequence.move({ .x = target.x() + ToolClipClearanceX, .feed_rate = homing_feedrate(Axis::X()) });
 
 			// move z to top
-			motionModule.setActiveCoordinateSystem(mcs);
-			motionModule.rapidMove({ .z = 0 });
-			motionModule.synchronize();
+			sequence.in(mcs).rapid({ .z = 0 });
 
 			auto caddyClearanceX = CaddyClearanceX;
 
@@ -770,9 +747,7 @@ start:
 			}
 
 			// move to clear caddy
-			motionModule.setActiveCoordinateSystem(tcs);
-			motionModule.rapidMove({ .x = caddyClearanceX });
-			motionModule.synchronize();
+			sequence.in(tcs).rapid({ .x = caddyClearanceX }).sync();
 
 			sourcePocket->setToolIndex(-1);
 		}
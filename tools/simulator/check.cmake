@@ -0,0 +1,94 @@
+# Runs one program through the simulator and checks its results.
+#
+#   cmake -DSIMULATOR=<swordfish-sim> [-DSETUP=<setup.nc>] [-DENDSTOPS=ON]
+#         [-DCARD=ON] [-DECHO="<messages>"]
+#         -DPROGRAM=<file.nc> -DCYCLE_TIME=<s> -DTOLERANCE=<fraction>
+#         -DSTEPS="X .. Y .. Z .. A .." -P check.cmake
+#
+# ECHO is the order the program's "M118 #<message>" lines must run in.
+
+set(arguments ${PROGRAM})
+if(SETUP)
+	list(PREPEND arguments -c ${SETUP})
+endif()
+if(ENDSTOPS)
+	list(PREPEND arguments -e)
+endif()
+if(CARD)
+	list(PREPEND arguments -d)
+endif()
+
+execute_process(
+	COMMAND ${SIMULATOR} ${arguments}
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE output
+	RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "${SIMULATOR} exited with ${result}:\n${output}")
+endif()
+
+if(NOT output MATCHES "Cycle time: ([0-9.]+) s")
+	message(FATAL_ERROR "No cycle time in the simulator output:\n${output}")
+endif()
+
+set(cycle_time ${CMAKE_MATCH_1})
+
+if(NOT output MATCHES "\nSteps: ([^\n]*)")
+	message(FATAL_ERROR "No step counts in the simulator output:\n${output}")
+endif()
+
+set(steps ${CMAKE_MATCH_1})
+
+message(STATUS "Cycle time: ${cycle_time} s (expected ${CYCLE_TIME} s)")
+message(STATUS "Steps: ${steps} (expected ${STEPS})")
+
+if(NOT steps STREQUAL STEPS)
+	message(FATAL_ERROR "Step counts differ: ${steps}, expected ${STEPS}")
+endif()
+
+if(ECHO)
+	string(REGEX MATCHALL "\n#[^\n]*" echoes "${output}")
+	string(REPLACE "\n#" " " echoes "${echoes}")
+	string(REPLACE ";" "" echoes "${echoes}")
+	string(STRIP "${echoes}" echoes)
+
+	message(STATUS "Echoes: ${echoes} (expected ${ECHO})")
+
+	if(NOT echoes STREQUAL ECHO)
+		message(FATAL_ERROR "Lines ran out of order: ${echoes}, expected ${ECHO}")
+	endif()
+endif()
+
+# CMake has no floating point, so compare in millionths
+function(to_millionths value out)
+	if(NOT value MATCHES "^([0-9]*)\\.?([0-9]*)$")
+		message(FATAL_ERROR "Not a number: ${value}")
+	endif()
+
+	set(whole ${CMAKE_MATCH_1})
+	string(SUBSTRING "${CMAKE_MATCH_2}000000" 0 6 fraction)
+
+	if(whole STREQUAL "")
+		set(whole 0)
+	endif()
+
+	# The leading 1 keeps the fraction from reading as octal
+	math(EXPR result "${whole} * 1000000 + 1${fraction} - 1000000")
+	set(${out} ${result} PARENT_SCOPE)
+endfunction()
+
+to_millionths(${cycle_time} actual_us)
+to_millionths(${CYCLE_TIME} expected_us)
+to_millionths(${TOLERANCE} tolerance)
+math(EXPR allowed_us "${expected_us} * ${tolerance} / 1000000")
+
+math(EXPR difference_us "${actual_us} - ${expected_us}")
+if(difference_us LESS 0)
+	math(EXPR difference_us "-${difference_us}")
+endif()
+
+if(difference_us GREATER allowed_us)
+	message(FATAL_ERROR "Cycle time ${cycle_time} s differs from ${CYCLE_TIME} s by more than ${TOLERANCE} of it")
+endif()
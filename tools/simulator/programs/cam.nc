@@ -0,0 +1,20014 @@
+G21
+G90
+G0 X0 Y0 Z5
+G1 Z0 F1000
+G1 X0.000 Y0.000 Z-21.8000 F3000
+G1 X0.020 Y0.000 Z-21.8000 F3000
+G1 X0.040 Y0.000 Z-21.8000 F3000
+G1 X0.060 Y0.000 Z-21.8000 F3000
+G1 X0.080 Y0.000 Z-21.8000 F3000
+G1 X0.100 Y0.000 Z-21.8000 F3000
+G1 X0.120 Y0.000 Z-21.8000 F3000
+G1 X0.140 Y0.000 Z-21.8000 F3000
+G1 X0.160 Y0.000 Z-21.4473 F3000
+G1 X0.180 Y0.000 Z-20.8421 F3000
+G1 X0.200 Y0.000 Z-20.4923 F3000
+G1 X0.220 Y0.000 Z-20.2184 F3000
+G1 X0.240 Y0.000 Z-19.9855 F3000
+G1 X0.260 Y0.000 Z-19.7795 F3000
+G1 X0.280 Y0.000 Z-19.5928 F3000
+G1 X0.300 Y0.000 Z-19.4209 F3000
+G1 X0.320 Y0.000 Z-19.2608 F3000
+G1 X0.340 Y0.000 Z-19.1103 F3000
+G1 X0.360 Y0.000 Z-18.9680 F3000
+G1 X0.380 Y0.000 Z-18.8326 F3000
+G1 X0.400 Y0.000 Z-18.7032 F3000
+G1 X0.420 Y0.000 Z-18.5792 F3000
+G1 X0.440 Y0.000 Z-18.4599 F3000
+G1 X0.460 Y0.000 Z-18.3448 F3000
+G1 X0.480 Y0.000 Z-18.2335 F3000
+G1 X0.500 Y0.000 Z-18.1258 F3000
+G1 X0.520 Y0.000 Z-18.0212 F3000
+G1 X0.540 Y0.000 Z-17.9195 F3000
+G1 X0.560 Y0.000 Z-17.8205 F3000
+G1 X0.580 Y0.000 Z-17.7240 F3000
+G1 X0.600 Y0.000 Z-17.6299 F3000
+G1 X0.620 Y0.000 Z-17.5379 F3000
+G1 X0.640 Y0.000 Z-17.4479 F3000
+G1 X0.660 Y0.000 Z-17.3599 F3000
+G1 X0.680 Y0.000 Z-17.2737 F3000
+G1 X0.700 Y0.000 Z-17.1891 F3000
+G1 X0.720 Y0.000 Z-17.1062 F3000
+G1 X0.740 Y0.000 Z-17.0248 F3000
+G1 X0.760 Y0.000 Z-16.9449 F3000
+G1 X0.780 Y0.000 Z-16.8663 F3000
+G1 X0.800 Y0.000 Z-16.7890 F3000
+G1 X0.820 Y0.000 Z-16.7130 F3000
+G1 X0.840 Y0.000 Z-16.6382 F3000
+G1 X0.860 Y0.000 Z-16.5645 F3000
+G1 X0.880 Y0.000 Z-16.4919 F3000
+G1 X0.900 Y0.000 Z-16.4204 F3000
+G1 X0.920 Y0.000 Z-16.3499 F3000
+G1 X0.940 Y0.000 Z-16.2804 F3000
+G1 X0.960 Y0.000 Z-16.2118 F3000
+G1 X0.980 Y0.000 Z-16.1441 F3000
+G1 X1.000 Y0.000 Z-16.0772 F3000
+G1 X1.020 Y0.000 Z-16.0113 F3000
+G1 X1.040 Y0.000 Z-15.9461 F3000
+G1 X1.060 Y0.000 Z-15.8817 F3000
+G1 X1.080 Y0.000 Z-15.8181 F3000
+G1 X1.100 Y0.000 Z-15.7552 F3000
+G1 X1.120 Y0.000 Z-15.6930 F3000
+G1 X1.140 Y0.000 Z-15.6315 F3000
+G1 X1.160 Y0.000 Z-15.5707 F3000
+G1 X1.180 Y0.000 Z-15.5105 F3000
+G1 X1.200 Y0.000 Z-15.4510 F3000
+G1 X1.220 Y0.000 Z-15.3921 F3000
+G1 X1.240 Y0.000 Z-15.3337 F3000
+G1 X1.260 Y0.000 Z-15.2760 F3000
+G1 X1.280 Y0.000 Z-15.2188 F3000
+G1 X1.300 Y0.000 Z-15.1622 F3000
+G1 X1.320 Y0.000 Z-15.1062 F3000
+G1 X1.340 Y0.000 Z-15.0506 F3000
+G1 X1.360 Y0.000 Z-14.9956 F3000
+G1 X1.380 Y0.000 Z-14.9410 F3000
+G1 X1.400 Y0.000 Z-14.8870 F3000
+G1 X1.420 Y0.000 Z-14.8334 F3000
+G1 X1.440 Y0.000 Z-14.7803 F3000
+G1 X1.460 Y0.000 Z-14.7276 F3000
+G1 X1.480 Y0.000 Z-14.6754 F3000
+G1 X1.500 Y0.000 Z-14.6236 F3000
+G1 X1.520 Y0.000 Z-14.5723 F3000
+G1 X1.540 Y0.000 Z-14.5214 F3000
+G1 X1.560 Y0.000 Z-14.4709 F3000
+G1 X1.580 Y0.000 Z-14.4207 F3000
+G1 X1.600 Y0.000 Z-14.3710 F3000
+G1 X1.620 Y0.000 Z-14.3217 F3000
+G1 X1.640 Y0.000 Z-14.2727 F3000
+G1 X1.660 Y0.000 Z-14.2241 F3000
+G1 X1.680 Y0.000 Z-14.1759 F3000
+G1 X1.700 Y0.000 Z-14.1280 F3000
+G1 X1.720 Y0.000 Z-14.0804 F3000
+G1 X1.740 Y0.000 Z-14.0333 F3000
+G1 X1.760 Y0.000 Z-13.9864 F3000
+G1 X1.780 Y0.000 Z-13.9399 F3000
+G1 X1.800 Y0.000 Z-13.8937 F3000
+G1 X1.820 Y0.000 Z-13.8478 F3000
+G1 X1.840 Y0.000 Z-13.8022 F3000
+G1 X1.860 Y0.000 Z-13.7570 F3000
+G1 X1.880 Y0.000 Z-13.7120 F3000
+G1 X1.900 Y0.000 Z-13.6673 F3000
+G1 X1.920 Y0.000 Z-13.6230 F3000
+G1 X1.940 Y0.000 Z-13.5789 F3000
+G1 X1.960 Y0.000 Z-13.5351 F3000
+G1 X1.980 Y0.000 Z-13.4916 F3000
+G1 X2.000 Y0.000 Z-13.4484 F3000
+G1 X2.020 Y0.000 Z-13.4054 F3000
+G1 X2.040 Y0.000 Z-13.3627 F3000
+G1 X2.060 Y0.000 Z-13.3202 F3000
+G1 X2.080 Y0.000 Z-13.2781 F3000
+G1 X2.100 Y0.000 Z-13.2361 F3000
+G1 X2.120 Y0.000 Z-13.1944 F3000
+G1 X2.140 Y0.000 Z-13.1530 F3000
+G1 X2.160 Y0.000 Z-13.1118 F3000
+G1 X2.180 Y0.000 Z-13.0709 F3000
+G1 X2.200 Y0.000 Z-13.0302 F3000
+G1 X2.220 Y0.000 Z-12.9897 F3000
+G1 X2.240 Y0.000 Z-12.9494 F3000
+G1 X2.260 Y0.000 Z-12.9094 F3000
+G1 X2.280 Y0.000 Z-12.8696 F3000
+G1 X2.300 Y0.000 Z-12.8301 F3000
+G1 X2.320 Y0.000 Z-12.7907 F3000
+G1 X2.340 Y0.000 Z-12.7516 F3000
+G1 X2.360 Y0.000 Z-12.7126 F3000
+G1 X2.380 Y0.000 Z-12.6739 F3000
+G1 X2.400 Y0.000 Z-12.6354 F3000
+G1 X2.420 Y0.000 Z-12.5971 F3000
+G1 X2.440 Y0.000 Z-12.5590 F3000
+G1 X2.460 Y0.000 Z-12.5211 F3000
+G1 X2.480 Y0.000 Z-12.4834 F3000
+G1 X2.500 Y0.000 Z-12.4459 F3000
+G1 X2.520 Y0.000 Z-12.4085 F3000
+G1 X2.540 Y0.000 Z-12.3714 F3000
+G1 X2.560 Y0.000 Z-12.3345 F3000
+G1 X2.580 Y0.000 Z-12.2977 F3000
+G1 X2.600 Y0.000 Z-12.2611 F3000
+G1 X2.620 Y0.000 Z-12.2247 F3000
+G1 X2.640 Y0.000 Z-12.1885 F3000
+G1 X2.660 Y0.000 Z-12.1525 F3000
+G1 X2.680 Y0.000 Z-12.1166 F3000
+G1 X2.700 Y0.000 Z-12.0809 F3000
+G1 X2.720 Y0.000 Z-12.0454 F3000
+G1 X2.740 Y0.000 Z-12.0101 F3000
+G1 X2.760 Y0.000 Z-11.9749 F3000
+G1 X2.780 Y0.000 Z-11.9399 F3000
+G1 X2.800 Y0.000 Z-11.9051 F3000
+G1 X2.820 Y0.000 Z-11.8704 F3000
+G1 X2.840 Y0.000 Z-11.8358 F3000
+G1 X2.860 Y0.000 Z-11.8015 F3000
+G1 X2.880 Y0.000 Z-11.7673 F3000
+G1 X2.900 Y0.000 Z-11.7332 F3000
+G1 X2.920 Y0.000 Z-11.6993 F3000
+G1 X2.940 Y0.000 Z-11.6656 F3000
+G1 X2.960 Y0.000 Z-11.6320 F3000
+G1 X2.980 Y0.000 Z-11.5985 F3000
+G1 X3.000 Y0.000 Z-11.5653 F3000
+G1 X3.020 Y0.000 Z-11.5321 F3000
+G1 X3.040 Y0.000 Z-11.4991 F3000
+G1 X3.060 Y0.000 Z-11.4662 F3000
+G1 X3.080 Y0.000 Z-11.4335 F3000
+G1 X3.100 Y0.000 Z-11.4010 F3000
+G1 X3.120 Y0.000 Z-11.3685 F3000
+G1 X3.140 Y0.000 Z-11.3362 F3000
+G1 X3.160 Y0.000 Z-11.3041 F3000
+G1 X3.180 Y0.000 Z-11.2721 F3000
+G1 X3.200 Y0.000 Z-11.2402 F3000
+G1 X3.220 Y0.000 Z-11.2084 F3000
+G1 X3.240 Y0.000 Z-11.1768 F3000
+G1 X3.260 Y0.000 Z-11.1453 F3000
+G1 X3.280 Y0.000 Z-11.1140 F3000
+G1 X3.300 Y0.000 Z-11.0827 F3000
+G1 X3.320 Y0.000 Z-11.0516 F3000
+G1 X3.340 Y0.000 Z-11.0206 F3000
+G1 X3.360 Y0.000 Z-10.9898 F3000
+G1 X3.380 Y0.000 Z-10.9591 F3000
+G1 X3.400 Y0.000 Z-10.9285 F3000
+G1 X3.420 Y0.000 Z-10.8980 F3000
+G1 X3.440 Y0.000 Z-10.8676 F3000
+G1 X3.460 Y0.000 Z-10.8374 F3000
+G1 X3.480 Y0.000 Z-10.8073 F3000
+G1 X3.500 Y0.000 Z-10.7773 F3000
+G1 X3.520 Y0.000 Z-10.7474 F3000
+G1 X3.540 Y0.000 Z-10.7177 F3000
+G1 X3.560 Y0.000 Z-10.6880 F3000
+G1 X3.580 Y0.000 Z-10.6585 F3000
+G1 X3.600 Y0.000 Z-10.6291 F3000
+G1 X3.620 Y0.000 Z-10.5998 F3000
+G1 X3.640 Y0.000 Z-10.5706 F3000
+G1 X3.660 Y0.000 Z-10.5415 F3000
+G1 X3.680 Y0.000 Z-10.5125 F3000
+G1 X3.700 Y0.000 Z-10.4836 F3000
+G1 X3.720 Y0.000 Z-10.4549 F3000
+G1 X3.740 Y0.000 Z-10.4262 F3000
+G1 X3.760 Y0.000 Z-10.3977 F3000
+G1 X3.780 Y0.000 Z-10.3693 F3000
+G1 X3.800 Y0.000 Z-10.3409 F3000
+G1 X3.820 Y0.000 Z-10.3127 F3000
+G1 X3.840 Y0.000 Z-10.2846 F3000
+G1 X3.860 Y0.000 Z-10.2566 F3000
+G1 X3.880 Y0.000 Z-10.2287 F3000
+G1 X3.900 Y0.000 Z-10.2009 F3000
+G1 X3.920 Y0.000 Z-10.1732 F3000
+G1 X3.940 Y0.000 Z-10.1455 F3000
+G1 X3.960 Y0.000 Z-10.1180 F3000
+G1 X3.980 Y0.000 Z-10.0906 F3000
+G1 X4.000 Y0.000 Z-10.0633 F3000
+G1 X4.020 Y0.000 Z-10.0361 F3000
+G1 X4.040 Y0.000 Z-10.0090 F3000
+G1 X4.060 Y0.000 Z-9.9819 F3000
+G1 X4.080 Y0.000 Z-9.9550 F3000
+G1 X4.100 Y0.000 Z-9.9282 F3000
+G1 X4.120 Y0.000 Z-9.9014 F3000
+G1 X4.140 Y0.000 Z-9.8748 F3000
+G1 X4.160 Y0.000 Z-9.8482 F3000
+G1 X4.180 Y0.000 Z-9.8218 F3000
+G1 X4.200 Y0.000 Z-9.7954 F3000
+G1 X4.220 Y0.000 Z-9.7691 F3000
+G1 X4.240 Y0.000 Z-9.7430 F3000
+G1 X4.260 Y0.000 Z-9.7169 F3000
+G1 X4.280 Y0.000 Z-9.6908 F3000
+G1 X4.300 Y0.000 Z-9.6649 F3000
+G1 X4.320 Y0.000 Z-9.6391 F3000
+G1 X4.340 Y0.000 Z-9.6134 F3000
+G1 X4.360 Y0.000 Z-9.5877 F3000
+G1 X4.380 Y0.000 Z-9.5621 F3000
+G1 X4.400 Y0.000 Z-9.5366 F3000
+G1 X4.420 Y0.000 Z-9.5112 F3000
+G1 X4.440 Y0.000 Z-9.4859 F3000
+G1 X4.460 Y0.000 Z-9.4607 F3000
+G1 X4.480 Y0.000 Z-9.4356 F3000
+G1 X4.500 Y0.000 Z-9.4105 F3000
+G1 X4.520 Y0.000 Z-9.3855 F3000
+G1 X4.540 Y0.000 Z-9.3606 F3000
+G1 X4.560 Y0.000 Z-9.3358 F3000
+G1 X4.580 Y0.000 Z-9.3111 F3000
+G1 X4.600 Y0.000 Z-9.2864 F3000
+G1 X4.620 Y0.000 Z-9.2618 F3000
+G1 X4.640 Y0.000 Z-9.2373 F3000
+G1 X4.660 Y0.000 Z-9.2129 F3000
+G1 X4.680 Y0.000 Z-9.1886 F3000
+G1 X4.700 Y0.000 Z-9.1643 F3000
+G1 X4.720 Y0.000 Z-9.1402 F3000
+G1 X4.740 Y0.000 Z-9.1161 F3000
+G1 X4.760 Y0.000 Z-9.0920 F3000
+G1 X4.780 Y0.000 Z-9.0681 F3000
+G1 X4.800 Y0.000 Z-9.0442 F3000
+G1 X4.820 Y0.000 Z-9.0204 F3000
+G1 X4.840 Y0.000 Z-8.9967 F3000
+G1 X4.860 Y0.000 Z-8.9731 F3000
+G1 X4.880 Y0.000 Z-8.9495 F3000
+G1 X4.900 Y0.000 Z-8.9260 F3000
+G1 X4.920 Y0.000 Z-8.9026 F3000
+G1 X4.940 Y0.000 Z-8.8792 F3000
+G1 X4.960 Y0.000 Z-8.8560 F3000
+G1 X4.980 Y0.000 Z-8.8327 F3000
+G1 X5.000 Y0.000 Z-8.8096 F3000
+G1 X5.020 Y0.000 Z-8.7866 F3000
+G1 X5.040 Y0.000 Z-8.7636 F3000
+G1 X5.060 Y0.000 Z-8.7407 F3000
+G1 X5.080 Y0.000 Z-8.7178 F3000
+G1 X5.100 Y0.000 Z-8.6950 F3000
+G1 X5.120 Y0.000 Z-8.6723 F3000
+G1 X5.140 Y0.000 Z-8.6497 F3000
+G1 X5.160 Y0.000 Z-8.6271 F3000
+G1 X5.180 Y0.000 Z-8.6046 F3000
+G1 X5.200 Y0.000 Z-8.5822 F3000
+G1 X5.220 Y0.000 Z-8.5598 F3000
+G1 X5.240 Y0.000 Z-8.5376 F3000
+G1 X5.260 Y0.000 Z-8.5153 F3000
+G1 X5.280 Y0.000 Z-8.4932 F3000
+G1 X5.300 Y0.000 Z-8.4711 F3000
+G1 X5.320 Y0.000 Z-8.4491 F3000
+G1 X5.340 Y0.000 Z-8.4271 F3000
+G1 X5.360 Y0.000 Z-8.4052 F3000
+G1 X5.380 Y0.000 Z-8.3834 F3000
+G1 X5.400 Y0.000 Z-8.3616 F3000
+G1 X5.420 Y0.000 Z-8.3399 F3000
+G1 X5.440 Y0.000 Z-8.3183 F3000
+G1 X5.460 Y0.000 Z-8.2967 F3000
+G1 X5.480 Y0.000 Z-8.2752 F3000
+G1 X5.500 Y0.000 Z-8.2538 F3000
+G1 X5.520 Y0.000 Z-8.2324 F3000
+G1 X5.540 Y0.000 Z-8.2111 F3000
+G1 X5.560 Y0.000 Z-8.1898 F3000
+G1 X5.580 Y0.000 Z-8.1687 F3000
+G1 X5.600 Y0.000 Z-8.1475 F3000
+G1 X5.620 Y0.000 Z-8.1265 F3000
+G1 X5.640 Y0.000 Z-8.1055 F3000
+G1 X5.660 Y0.000 Z-8.0845 F3000
+G1 X5.680 Y0.000 Z-8.0636 F3000
+G1 X5.700 Y0.000 Z-8.0428 F3000
+G1 X5.720 Y0.000 Z-8.0221 F3000
+G1 X5.740 Y0.000 Z-8.0014 F3000
+G1 X5.760 Y0.000 Z-7.9807 F3000
+G1 X5.780 Y0.000 Z-7.9601 F3000
+G1 X5.800 Y0.000 Z-7.9396 F3000
+G1 X5.820 Y0.000 Z-7.9192 F3000
+G1 X5.840 Y0.000 Z-7.8988 F3000
+G1 X5.860 Y0.000 Z-7.8784 F3000
+G1 X5.880 Y0.000 Z-7.8581 F3000
+G1 X5.900 Y0.000 Z-7.8379 F3000
+G1 X5.920 Y0.000 Z-7.8177 F3000
+G1 X5.940 Y0.000 Z-7.7976 F3000
+G1 X5.960 Y0.000 Z-7.7776 F3000
+G1 X5.980 Y0.000 Z-7.7576 F3000
+G1 X6.000 Y0.000 Z-7.7376 F3000
+G1 X6.020 Y0.000 Z-7.7178 F3000
+G1 X6.040 Y0.000 Z-7.6979 F3000
+G1 X6.060 Y0.000 Z-7.6782 F3000
+G1 X6.080 Y0.000 Z-7.6584 F3000
+G1 X6.100 Y0.000 Z-7.6388 F3000
+G1 X6.120 Y0.000 Z-7.6192 F3000
+G1 X6.140 Y0.000 Z-7.5996 F3000
+G1 X6.160 Y0.000 Z-7.5801 F3000
+G1 X6.180 Y0.000 Z-7.5607 F3000
+G1 X6.200 Y0.000 Z-7.5413 F3000
+G1 X6.220 Y0.000 Z-7.5220 F3000
+G1 X6.240 Y0.000 Z-7.5027 F3000
+G1 X6.260 Y0.000 Z-7.4835 F3000
+G1 X6.280 Y0.000 Z-7.4643 F3000
+G1 X6.300 Y0.000 Z-7.4452 F3000
+G1 X6.320 Y0.000 Z-7.4261 F3000
+G1 X6.340 Y0.000 Z-7.4071 F3000
+G1 X6.360 Y0.000 Z-7.3882 F3000
+G1 X6.380 Y0.000 Z-7.3693 F3000
+G1 X6.400 Y0.000 Z-7.3504 F3000
+G1 X6.420 Y0.000 Z-7.3316 F3000
+G1 X6.440 Y0.000 Z-7.3129 F3000
+G1 X6.460 Y0.000 Z-7.2942 F3000
+G1 X6.480 Y0.000 Z-7.2756 F3000
+G1 X6.500 Y0.000 Z-7.2570 F3000
+G1 X6.520 Y0.000 Z-7.2384 F3000
+G1 X6.540 Y0.000 Z-7.2199 F3000
+G1 X6.560 Y0.000 Z-7.2015 F3000
+G1 X6.580 Y0.000 Z-7.1831 F3000
+G1 X6.600 Y0.000 Z-7.1648 F3000
+G1 X6.620 Y0.000 Z-7.1465 F3000
+G1 X6.640 Y0.000 Z-7.1282 F3000
+G1 X6.660 Y0.000 Z-7.1101 F3000
+G1 X6.680 Y0.000 Z-7.0919 F3000
+G1 X6.700 Y0.000 Z-7.0738 F3000
+G1 X6.720 Y0.000 Z-7.0558 F3000
+G1 X6.740 Y0.000 Z-7.0378 F3000
+G1 X6.760 Y0.000 Z-7.0199 F3000
+G1 X6.780 Y0.000 Z-7.0020 F3000
+G1 X6.800 Y0.000 Z-6.9841 F3000
+G1 X6.820 Y0.000 Z-6.9663 F3000
+G1 X6.840 Y0.000 Z-6.9486 F3000
+G1 X6.860 Y0.000 Z-6.9309 F3000
+G1 X6.880 Y0.000 Z-6.9132 F3000
+G1 X6.900 Y0.000 Z-6.8956 F3000
+G1 X6.920 Y0.000 Z-6.8781 F3000
+G1 X6.940 Y0.000 Z-6.8606 F3000
+G1 X6.960 Y0.000 Z-6.8431 F3000
+G1 X6.980 Y0.000 Z-6.8257 F3000
+G1 X7.000 Y0.000 Z-6.8083 F3000
+G1 X7.020 Y0.000 Z-6.7910 F3000
+G1 X7.040 Y0.000 Z-6.7737 F3000
+G1 X7.060 Y0.000 Z-6.7565 F3000
+G1 X7.080 Y0.000 Z-6.7393 F3000
+G1 X7.100 Y0.000 Z-6.7222 F3000
+G1 X7.120 Y0.000 Z-6.7051 F3000
+G1 X7.140 Y0.000 Z-6.6881 F3000
+G1 X7.160 Y0.000 Z-6.6711 F3000
+G1 X7.180 Y0.000 Z-6.6541 F3000
+G1 X7.200 Y0.000 Z-6.6372 F3000
+G1 X7.220 Y0.000 Z-6.6204 F3000
+G1 X7.240 Y0.000 Z-6.6035 F3000
+G1 X7.260 Y0.000 Z-6.5868 F3000
+G1 X7.280 Y0.000 Z-6.5700 F3000
+G1 X7.300 Y0.000 Z-6.5534 F3000
+G1 X7.320 Y0.000 Z-6.5367 F3000
+G1 X7.340 Y0.000 Z-6.5201 F3000
+G1 X7.360 Y0.000 Z-6.5036 F3000
+G1 X7.380 Y0.000 Z-6.4871 F3000
+G1 X7.400 Y0.000 Z-6.4706 F3000
+G1 X7.420 Y0.000 Z-6.4542 F3000
+G1 X7.440 Y0.000 Z-6.4378 F3000
+G1 X7.460 Y0.000 Z-6.4215 F3000
+G1 X7.480 Y0.000 Z-6.4052 F3000
+G1 X7.500 Y0.000 Z-6.3890 F3000
+G1 X7.520 Y0.000 Z-6.3728 F3000
+G1 X7.540 Y0.000 Z-6.3566 F3000
+G1 X7.560 Y0.000 Z-6.3405 F3000
+G1 X7.580 Y0.000 Z-6.3244 F3000
+G1 X7.600 Y0.000 Z-6.3084 F3000
+G1 X7.620 Y0.000 Z-6.2924 F3000
+G1 X7.640 Y0.000 Z-6.2765 F3000
+G1 X7.660 Y0.000 Z-6.2606 F3000
+G1 X7.680 Y0.000 Z-6.2447 F3000
+G1 X7.700 Y0.000 Z-6.2289 F3000
+G1 X7.720 Y0.000 Z-6.2131 F3000
+G1 X7.740 Y0.000 Z-6.1974 F3000
+G1 X7.760 Y0.000 Z-6.1817 F3000
+G1 X7.780 Y0.000 Z-6.1660 F3000
+G1 X7.800 Y0.000 Z-6.1504 F3000
+G1 X7.820 Y0.000 Z-6.1348 F3000
+G1 X7.840 Y0.000 Z-6.1193 F3000
+G1 X7.860 Y0.000 Z-6.1038 F3000
+G1 X7.880 Y0.000 Z-6.0884 F3000
+G1 X7.900 Y0.000 Z-6.0730 F3000
+G1 X7.920 Y0.000 Z-6.0576 F3000
+G1 X7.940 Y0.000 Z-6.0423 F3000
+G1 X7.960 Y0.000 Z-6.0270 F3000
+G1 X7.980 Y0.000 Z-6.0117 F3000
+G1 X8.000 Y0.000 Z-5.9965 F3000
+G1 X8.020 Y0.000 Z-5.9814 F3000
+G1 X8.040 Y0.000 Z-5.9662 F3000
+G1 X8.060 Y0.000 Z-5.9511 F3000
+G1 X8.080 Y0.000 Z-5.9361 F3000
+G1 X8.100 Y0.000 Z-5.9211 F3000
+G1 X8.120 Y0.000 Z-5.9061 F3000
+G1 X8.140 Y0.000 Z-5.8912 F3000
+G1 X8.160 Y0.000 Z-5.8763 F3000
+G1 X8.180 Y0.000 Z-5.8614 F3000
+G1 X8.200 Y0.000 Z-5.8466 F3000
+G1 X8.220 Y0.000 Z-5.8319 F3000
+G1 X8.240 Y0.000 Z-5.8171 F3000
+G1 X8.260 Y0.000 Z-5.8024 F3000
+G1 X8.280 Y0.000 Z-5.7878 F3000
+G1 X8.300 Y0.000 Z-5.7731 F3000
+G1 X8.320 Y0.000 Z-5.7586 F3000
+G1 X8.340 Y0.000 Z-5.7440 F3000
+G1 X8.360 Y0.000 Z-5.7295 F3000
+G1 X8.380 Y0.000 Z-5.7151 F3000
+G1 X8.400 Y0.000 Z-5.7006 F3000
+G1 X8.420 Y0.000 Z-5.6862 F3000
+G1 X8.440 Y0.000 Z-5.6719 F3000
+G1 X8.460 Y0.000 Z-5.6576 F3000
+G1 X8.480 Y0.000 Z-5.6433 F3000
+G1 X8.500 Y0.000 Z-5.6290 F3000
+G1 X8.520 Y0.000 Z-5.6148 F3000
+G1 X8.540 Y0.000 Z-5.6007 F3000
+G1 X8.560 Y0.000 Z-5.5865 F3000
+G1 X8.580 Y0.000 Z-5.5724 F3000
+G1 X8.600 Y0.000 Z-5.5584 F3000
+G1 X8.620 Y0.000 Z-5.5444 F3000
+G1 X8.640 Y0.000 Z-5.5304 F3000
+G1 X8.660 Y0.000 Z-5.5164 F3000
+G1 X8.680 Y0.000 Z-5.5025 F3000
+G1 X8.700 Y0.000 Z-5.4887 F3000
+G1 X8.720 Y0.000 Z-5.4748 F3000
+G1 X8.740 Y0.000 Z-5.4610 F3000
+G1 X8.760 Y0.000 Z-5.4473 F3000
+G1 X8.780 Y0.000 Z-5.4335 F3000
+G1 X8.800 Y0.000 Z-5.4198 F3000
+G1 X8.820 Y0.000 Z-5.4062 F3000
+G1 X8.840 Y0.000 Z-5.3926 F3000
+G1 X8.860 Y0.000 Z-5.3790 F3000
+G1 X8.880 Y0.000 Z-5.3654 F3000
+G1 X8.900 Y0.000 Z-5.3519 F3000
+G1 X8.920 Y0.000 Z-5.3384 F3000
+G1 X8.940 Y0.000 Z-5.3250 F3000
+G1 X8.960 Y0.000 Z-5.3116 F3000
+G1 X8.980 Y0.000 Z-5.2982 F3000
+G1 X9.000 Y0.000 Z-5.2849 F3000
+G1 X9.020 Y0.000 Z-5.2716 F3000
+G1 X9.040 Y0.000 Z-5.2583 F3000
+G1 X9.060 Y0.000 Z-5.2450 F3000
+G1 X9.080 Y0.000 Z-5.2318 F3000
+G1 X9.100 Y0.000 Z-5.2187 F3000
+G1 X9.120 Y0.000 Z-5.2056 F3000
+G1 X9.140 Y0.000 Z-5.1925 F3000
+G1 X9.160 Y0.000 Z-5.1794 F3000
+G1 X9.180 Y0.000 Z-5.1664 F3000
+G1 X9.200 Y0.000 Z-5.1534 F3000
+G1 X9.220 Y0.000 Z-5.1404 F3000
+G1 X9.240 Y0.000 Z-5.1275 F3000
+G1 X9.260 Y0.000 Z-5.1146 F3000
+G1 X9.280 Y0.000 Z-5.1017 F3000
+G1 X9.300 Y0.000 Z-5.0889 F3000
+G1 X9.320 Y0.000 Z-5.0761 F3000
+G1 X9.340 Y0.000 Z-5.0634 F3000
+G1 X9.360 Y0.000 Z-5.0507 F3000
+G1 X9.380 Y0.000 Z-5.0380 F3000
+G1 X9.400 Y0.000 Z-5.0253 F3000
+G1 X9.420 Y0.000 Z-5.0127 F3000
+G1 X9.440 Y0.000 Z-5.0001 F3000
+G1 X9.460 Y0.000 Z-4.9876 F3000
+G1 X9.480 Y0.000 Z-4.9750 F3000
+G1 X9.500 Y0.000 Z-4.9625 F3000
+G1 X9.520 Y0.000 Z-4.9501 F3000
+G1 X9.540 Y0.000 Z-4.9377 F3000
+G1 X9.560 Y0.000 Z-4.9253 F3000
+G1 X9.580 Y0.000 Z-4.9129 F3000
+G1 X9.600 Y0.000 Z-4.9006 F3000
+G1 X9.620 Y0.000 Z-4.8883 F3000
+G1 X9.640 Y0.000 Z-4.8760 F3000
+G1 X9.660 Y0.000 Z-4.8638 F3000
+G1 X9.680 Y0.000 Z-4.8516 F3000
+G1 X9.700 Y0.000 Z-4.8395 F3000
+G1 X9.720 Y0.000 Z-4.8273 F3000
+G1 X9.740 Y0.000 Z-4.8152 F3000
+G1 X9.760 Y0.000 Z-4.8032 F3000
+G1 X9.780 Y0.000 Z-4.7911 F3000
+G1 X9.800 Y0.000 Z-4.7791 F3000
+G1 X9.820 Y0.000 Z-4.7672 F3000
+G1 X9.840 Y0.000 Z-4.7552 F3000
+G1 X9.860 Y0.000 Z-4.7433 F3000
+G1 X9.880 Y0.000 Z-4.7314 F3000
+G1 X9.900 Y0.000 Z-4.7196 F3000
+G1 X9.920 Y0.000 Z-4.7078 F3000
+G1 X9.940 Y0.000 Z-4.6960 F3000
+G1 X9.960 Y0.000 Z-4.6843 F3000
+G1 X9.980 Y0.000 Z-4.6725 F3000
+G1 X10.000 Y0.000 Z-4.6609 F3000
+G1 X10.020 Y0.000 Z-4.6492 F3000
+G1 X10.040 Y0.000 Z-4.6376 F3000
+G1 X10.060 Y0.000 Z-4.6260 F3000
+G1 X10.080 Y0.000 Z-4.6144 F3000
+G1 X10.100 Y0.000 Z-4.6029 F3000
+G1 X10.120 Y0.000 Z-4.5914 F3000
+G1 X10.140 Y0.000 Z-4.5799 F3000
+G1 X10.160 Y0.000 Z-4.5685 F3000
+G1 X10.180 Y0.000 Z-4.5571 F3000
+G1 X10.200 Y0.000 Z-4.5457 F3000
+G1 X10.220 Y0.000 Z-4.5344 F3000
+G1 X10.240 Y0.000 Z-4.5231 F3000
+G1 X10.260 Y0.000 Z-4.5118 F3000
+G1 X10.280 Y0.000 Z-4.5005 F3000
+G1 X10.300 Y0.000 Z-4.4893 F3000
+G1 X10.320 Y0.000 Z-4.4781 F3000
+G1 X10.340 Y0.000 Z-4.4670 F3000
+G1 X10.360 Y0.000 Z-4.4558 F3000
+G1 X10.380 Y0.000 Z-4.4447 F3000
+G1 X10.400 Y0.000 Z-4.4337 F3000
+G1 X10.420 Y0.000 Z-4.4226 F3000
+G1 X10.440 Y0.000 Z-4.4116 F3000
+G1 X10.460 Y0.000 Z-4.4006 F3000
+G1 X10.480 Y0.000 Z-4.3897 F3000
+G1 X10.500 Y0.000 Z-4.3787 F3000
+G1 X10.520 Y0.000 Z-4.3679 F3000
+G1 X10.540 Y0.000 Z-4.3570 F3000
+G1 X10.560 Y0.000 Z-4.3462 F3000
+G1 X10.580 Y0.000 Z-4.3354 F3000
+G1 X10.600 Y0.000 Z-4.3246 F3000
+G1 X10.620 Y0.000 Z-4.3138 F3000
+G1 X10.640 Y0.000 Z-4.3031 F3000
+G1 X10.660 Y0.000 Z-4.2924 F3000
+G1 X10.680 Y0.000 Z-4.2818 F3000
+G1 X10.700 Y0.000 Z-4.2712 F3000
+G1 X10.720 Y0.000 Z-4.2606 F3000
+G1 X10.740 Y0.000 Z-4.2500 F3000
+G1 X10.760 Y0.000 Z-4.2395 F3000
+G1 X10.780 Y0.000 Z-4.2290 F3000
+G1 X10.800 Y0.000 Z-4.2185 F3000
+G1 X10.820 Y0.000 Z-4.2080 F3000
+G1 X10.840 Y0.000 Z-4.1976 F3000
+G1 X10.860 Y0.000 Z-4.1872 F3000
+G1 X10.880 Y0.000 Z-4.1768 F3000
+G1 X10.900 Y0.000 Z-4.1665 F3000
+G1 X10.920 Y0.000 Z-4.1562 F3000
+G1 X10.940 Y0.000 Z-4.1459 F3000
+G1 X10.960 Y0.000 Z-4.1357 F3000
+G1 X10.980 Y0.000 Z-4.1255 F3000
+G1 X11.000 Y0.000 Z-4.1153 F3000
+G1 X11.020 Y0.000 Z-4.1051 F3000
+G1 X11.040 Y0.000 Z-4.0950 F3000
+G1 X11.060 Y0.000 Z-4.0849 F3000
+G1 X11.080 Y0.000 Z-4.0748 F3000
+G1 X11.100 Y0.000 Z-4.0647 F3000
+G1 X11.120 Y0.000 Z-4.0547 F3000
+G1 X11.140 Y0.000 Z-4.0447 F3000
+G1 X11.160 Y0.000 Z-4.0347 F3000
+G1 X11.180 Y0.000 Z-4.0248 F3000
+G1 X11.200 Y0.000 Z-4.0149 F3000
+G1 X11.220 Y0.000 Z-4.0050 F3000
+G1 X11.240 Y0.000 Z-3.9952 F3000
+G1 X11.260 Y0.000 Z-3.9853 F3000
+G1 X11.280 Y0.000 Z-3.9755 F3000
+G1 X11.300 Y0.000 Z-3.9658 F3000
+G1 X11.320 Y0.000 Z-3.9560 F3000
+G1 X11.340 Y0.000 Z-3.9463 F3000
+G1 X11.360 Y0.000 Z-3.9366 F3000
+G1 X11.380 Y0.000 Z-3.9270 F3000
+G1 X11.400 Y0.000 Z-3.9173 F3000
+G1 X11.420 Y0.000 Z-3.9077 F3000
+G1 X11.440 Y0.000 Z-3.8981 F3000
+G1 X11.460 Y0.000 Z-3.8886 F3000
+G1 X11.480 Y0.000 Z-3.8791 F3000
+G1 X11.500 Y0.000 Z-3.8696 F3000
+G1 X11.520 Y0.000 Z-3.8601 F3000
+G1 X11.540 Y0.000 Z-3.8507 F3000
+G1 X11.560 Y0.000 Z-3.8413 F3000
+G1 X11.580 Y0.000 Z-3.8319 F3000
+G1 X11.600 Y0.000 Z-3.8225 F3000
+G1 X11.620 Y0.000 Z-3.8132 F3000
+G1 X11.640 Y0.000 Z-3.8039 F3000
+G1 X11.660 Y0.000 Z-3.7946 F3000
+G1 X11.680 Y0.000 Z-3.7854 F3000
+G1 X11.700 Y0.000 Z-3.7761 F3000
+G1 X11.720 Y0.000 Z-3.7669 F3000
+G1 X11.740 Y0.000 Z-3.7578 F3000
+G1 X11.760 Y0.000 Z-3.7486 F3000
+G1 X11.780 Y0.000 Z-3.7395 F3000
+G1 X11.800 Y0.000 Z-3.7304 F3000
+G1 X11.820 Y0.000 Z-3.7213 F3000
+G1 X11.840 Y0.000 Z-3.7123 F3000
+G1 X11.860 Y0.000 Z-3.7033 F3000
+G1 X11.880 Y0.000 Z-3.6943 F3000
+G1 X11.900 Y0.000 Z-3.6854 F3000
+G1 X11.920 Y0.000 Z-3.6764 F3000
+G1 X11.940 Y0.000 Z-3.6675 F3000
+G1 X11.960 Y0.000 Z-3.6587 F3000
+G1 X11.980 Y0.000 Z-3.6498 F3000
+G1 X12.000 Y0.000 Z-3.6410 F3000
+G1 X12.020 Y0.000 Z-3.6322 F3000
+G1 X12.040 Y0.000 Z-3.6234 F3000
+G1 X12.060 Y0.000 Z-3.6147 F3000
+G1 X12.080 Y0.000 Z-3.6059 F3000
+G1 X12.100 Y0.000 Z-3.5973 F3000
+G1 X12.120 Y0.000 Z-3.5886 F3000
+G1 X12.140 Y0.000 Z-3.5799 F3000
+G1 X12.160 Y0.000 Z-3.5713 F3000
+G1 X12.180 Y0.000 Z-3.5627 F3000
+G1 X12.200 Y0.000 Z-3.5542 F3000
+G1 X12.220 Y0.000 Z-3.5456 F3000
+G1 X12.240 Y0.000 Z-3.5371 F3000
+G1 X12.260 Y0.000 Z-3.5286 F3000
+G1 X12.280 Y0.000 Z-3.5202 F3000
+G1 X12.300 Y0.000 Z-3.5118 F3000
+G1 X12.320 Y0.000 Z-3.5033 F3000
+G1 X12.340 Y0.000 Z-3.4950 F3000
+G1 X12.360 Y0.000 Z-3.4866 F3000
+G1 X12.380 Y0.000 Z-3.4783 F3000
+G1 X12.400 Y0.000 Z-3.4700 F3000
+G1 X12.420 Y0.000 Z-3.4617 F3000
+G1 X12.440 Y0.000 Z-3.4534 F3000
+G1 X12.460 Y0.000 Z-3.4452 F3000
+G1 X12.480 Y0.000 Z-3.4370 F3000
+G1 X12.500 Y0.000 Z-3.4288 F3000
+G1 X12.520 Y0.000 Z-3.4207 F3000
+G1 X12.540 Y0.000 Z-3.4125 F3000
+G1 X12.560 Y0.000 Z-3.4044 F3000
+G1 X12.580 Y0.000 Z-3.3964 F3000
+G1 X12.600 Y0.000 Z-3.3883 F3000
+G1 X12.620 Y0.000 Z-3.3803 F3000
+G1 X12.640 Y0.000 Z-3.3723 F3000
+G1 X12.660 Y0.000 Z-3.3643 F3000
+G1 X12.680 Y0.000 Z-3.3564 F3000
+G1 X12.700 Y0.000 Z-3.3484 F3000
+G1 X12.720 Y0.000 Z-3.3405 F3000
+G1 X12.740 Y0.000 Z-3.3327 F3000
+G1 X12.760 Y0.000 Z-3.3248 F3000
+G1 X12.780 Y0.000 Z-3.3170 F3000
+G1 X12.800 Y0.000 Z-3.3092 F3000
+G1 X12.820 Y0.000 Z-3.3014 F3000
+G1 X12.840 Y0.000 Z-3.2937 F3000
+G1 X12.860 Y0.000 Z-3.2859 F3000
+G1 X12.880 Y0.000 Z-3.2782 F3000
+G1 X12.900 Y0.000 Z-3.2706 F3000
+G1 X12.920 Y0.000 Z-3.2629 F3000
+G1 X12.940 Y0.000 Z-3.2553 F3000
+G1 X12.960 Y0.000 Z-3.2477 F3000
+G1 X12.980 Y0.000 Z-3.2401 F3000
+G1 X13.000 Y0.000 Z-3.2326 F3000
+G1 X13.020 Y0.000 Z-3.2250 F3000
+G1 X13.040 Y0.000 Z-3.2175 F3000
+G1 X13.060 Y0.000 Z-3.2100 F3000
+G1 X13.080 Y0.000 Z-3.2026 F3000
+G1 X13.100 Y0.000 Z-3.1952 F3000
+G1 X13.120 Y0.000 Z-3.1878 F3000
+G1 X13.140 Y0.000 Z-3.1804 F3000
+G1 X13.160 Y0.000 Z-3.1730 F3000
+G1 X13.180 Y0.000 Z-3.1657 F3000
+G1 X13.200 Y0.000 Z-3.1584 F3000
+G1 X13.220 Y0.000 Z-3.1511 F3000
+G1 X13.240 Y0.000 Z-3.1438 F3000
+G1 X13.260 Y0.000 Z-3.1366 F3000
+G1 X13.280 Y0.000 Z-3.1294 F3000
+G1 X13.300 Y0.000 Z-3.1222 F3000
+G1 X13.320 Y0.000 Z-3.1150 F3000
+G1 X13.340 Y0.000 Z-3.1079 F3000
+G1 X13.360 Y0.000 Z-3.1008 F3000
+G1 X13.380 Y0.000 Z-3.0937 F3000
+G1 X13.400 Y0.000 Z-3.0866 F3000
+G1 X13.420 Y0.000 Z-3.0796 F3000
+G1 X13.440 Y0.000 Z-3.0726 F3000
+G1 X13.460 Y0.000 Z-3.0656 F3000
+G1 X13.480 Y0.000 Z-3.0586 F3000
+G1 X13.500 Y0.000 Z-3.0517 F3000
+G1 X13.520 Y0.000 Z-3.0447 F3000
+G1 X13.540 Y0.000 Z-3.0378 F3000
+G1 X13.560 Y0.000 Z-3.0310 F3000
+G1 X13.580 Y0.000 Z-3.0241 F3000
+G1 X13.600 Y0.000 Z-3.0173 F3000
+G1 X13.620 Y0.000 Z-3.0105 F3000
+G1 X13.640 Y0.000 Z-3.0037 F3000
+G1 X13.660 Y0.000 Z-2.9970 F3000
+G1 X13.680 Y0.000 Z-2.9902 F3000
+G1 X13.700 Y0.000 Z-2.9835 F3000
+G1 X13.720 Y0.000 Z-2.9768 F3000
+G1 X13.740 Y0.000 Z-2.9702 F3000
+G1 X13.760 Y0.000 Z-2.9635 F3000
+G1 X13.780 Y0.000 Z-2.9569 F3000
+G1 X13.800 Y0.000 Z-2.9503 F3000
+G1 X13.820 Y0.000 Z-2.9438 F3000
+G1 X13.840 Y0.000 Z-2.9372 F3000
+G1 X13.860 Y0.000 Z-2.9307 F3000
+G1 X13.880 Y0.000 Z-2.9242 F3000
+G1 X13.900 Y0.000 Z-2.9177 F3000
+G1 X13.920 Y0.000 Z-2.9113 F3000
+G1 X13.940 Y0.000 Z-2.9049 F3000
+G1 X13.960 Y0.000 Z-2.8985 F3000
+G1 X13.980 Y0.000 Z-2.8921 F3000
+G1 X14.000 Y0.000 Z-2.8857 F3000
+G1 X14.020 Y0.000 Z-2.8794 F3000
+G1 X14.040 Y0.000 Z-2.8731 F3000
+G1 X14.060 Y0.000 Z-2.8668 F3000
+G1 X14.080 Y0.000 Z-2.8605 F3000
+G1 X14.100 Y0.000 Z-2.8543 F3000
+G1 X14.120 Y0.000 Z-2.8481 F3000
+G1 X14.140 Y0.000 Z-2.8419 F3000
+G1 X14.160 Y0.000 Z-2.8357 F3000
+G1 X14.180 Y0.000 Z-2.8296 F3000
+G1 X14.200 Y0.000 Z-2.8234 F3000
+G1 X14.220 Y0.000 Z-2.8173 F3000
+G1 X14.240 Y0.000 Z-2.8113 F3000
+G1 X14.260 Y0.000 Z-2.8052 F3000
+G1 X14.280 Y0.000 Z-2.7992 F3000
+G1 X14.300 Y0.000 Z-2.7932 F3000
+G1 X14.320 Y0.000 Z-2.7872 F3000
+G1 X14.340 Y0.000 Z-2.7812 F3000
+G1 X14.360 Y0.000 Z-2.7753 F3000
+G1 X14.380 Y0.000 Z-2.7694 F3000
+G1 X14.400 Y0.000 Z-2.7635 F3000
+G1 X14.420 Y0.000 Z-2.7576 F3000
+G1 X14.440 Y0.000 Z-2.7517 F3000
+G1 X14.460 Y0.000 Z-2.7459 F3000
+G1 X14.480 Y0.000 Z-2.7401 F3000
+G1 X14.500 Y0.000 Z-2.7343 F3000
+G1 X14.520 Y0.000 Z-2.7286 F3000
+G1 X14.540 Y0.000 Z-2.7228 F3000
+G1 X14.560 Y0.000 Z-2.7171 F3000
+G1 X14.580 Y0.000 Z-2.7114 F3000
+G1 X14.600 Y0.000 Z-2.7058 F3000
+G1 X14.620 Y0.000 Z-2.7001 F3000
+G1 X14.640 Y0.000 Z-2.6945 F3000
+G1 X14.660 Y0.000 Z-2.6889 F3000
+G1 X14.680 Y0.000 Z-2.6833 F3000
+G1 X14.700 Y0.000 Z-2.6778 F3000
+G1 X14.720 Y0.000 Z-2.6722 F3000
+G1 X14.740 Y0.000 Z-2.6667 F3000
+G1 X14.760 Y0.000 Z-2.6612 F3000
+G1 X14.780 Y0.000 Z-2.6558 F3000
+G1 X14.800 Y0.000 Z-2.6503 F3000
+G1 X14.820 Y0.000 Z-2.6449 F3000
+G1 X14.840 Y0.000 Z-2.6395 F3000
+G1 X14.860 Y0.000 Z-2.6341 F3000
+G1 X14.880 Y0.000 Z-2.6288 F3000
+G1 X14.900 Y0.000 Z-2.6235 F3000
+G1 X14.920 Y0.000 Z-2.6181 F3000
+G1 X14.940 Y0.000 Z-2.6129 F3000
+G1 X14.960 Y0.000 Z-2.6076 F3000
+G1 X14.980 Y0.000 Z-2.6024 F3000
+G1 X15.000 Y0.000 Z-2.5971 F3000
+G1 X15.020 Y0.000 Z-2.5919 F3000
+G1 X15.040 Y0.000 Z-2.5868 F3000
+G1 X15.060 Y0.000 Z-2.5816 F3000
+G1 X15.080 Y0.000 Z-2.5765 F3000
+G1 X15.100 Y0.000 Z-2.5714 F3000
+G1 X15.120 Y0.000 Z-2.5663 F3000
+G1 X15.140 Y0.000 Z-2.5612 F3000
+G1 X15.160 Y0.000 Z-2.5562 F3000
+G1 X15.180 Y0.000 Z-2.5512 F3000
+G1 X15.200 Y0.000 Z-2.5462 F3000
+G1 X15.220 Y0.000 Z-2.5412 F3000
+G1 X15.240 Y0.000 Z-2.5362 F3000
+G1 X15.260 Y0.000 Z-2.5313 F3000
+G1 X15.280 Y0.000 Z-2.5264 F3000
+G1 X15.300 Y0.000 Z-2.5215 F3000
+G1 X15.320 Y0.000 Z-2.5166 F3000
+G1 X15.340 Y0.000 Z-2.5118 F3000
+G1 X15.360 Y0.000 Z-2.5070 F3000
+G1 X15.380 Y0.000 Z-2.5022 F3000
+G1 X15.400 Y0.000 Z-2.4974 F3000
+G1 X15.420 Y0.000 Z-2.4927 F3000
+G1 X15.440 Y0.000 Z-2.4879 F3000
+G1 X15.460 Y0.000 Z-2.4832 F3000
+G1 X15.480 Y0.000 Z-2.4785 F3000
+G1 X15.500 Y0.000 Z-2.4739 F3000
+G1 X15.520 Y0.000 Z-2.4692 F3000
+G1 X15.540 Y0.000 Z-2.4646 F3000
+G1 X15.560 Y0.000 Z-2.4600 F3000
+G1 X15.580 Y0.000 Z-2.4554 F3000
+G1 X15.600 Y0.000 Z-2.4508 F3000
+G1 X15.620 Y0.000 Z-2.4463 F3000
+G1 X15.640 Y0.000 Z-2.4418 F3000
+G1 X15.660 Y0.000 Z-2.4373 F3000
+G1 X15.680 Y0.000 Z-2.4328 F3000
+G1 X15.700 Y0.000 Z-2.4284 F3000
+G1 X15.720 Y0.000 Z-2.4239 F3000
+G1 X15.740 Y0.000 Z-2.4195 F3000
+G1 X15.760 Y0.000 Z-2.4152 F3000
+G1 X15.780 Y0.000 Z-2.4108 F3000
+G1 X15.800 Y0.000 Z-2.4064 F3000
+G1 X15.820 Y0.000 Z-2.4021 F3000
+G1 X15.840 Y0.000 Z-2.3978 F3000
+G1 X15.860 Y0.000 Z-2.3935 F3000
+G1 X15.880 Y0.000 Z-2.3893 F3000
+G1 X15.900 Y0.000 Z-2.3851 F3000
+G1 X15.920 Y0.000 Z-2.3808 F3000
+G1 X15.940 Y0.000 Z-2.3767 F3000
+G1 X15.960 Y0.000 Z-2.3725 F3000
+G1 X15.980 Y0.000 Z-2.3683 F3000
+G1 X16.000 Y0.000 Z-2.3642 F3000
+G1 X16.020 Y0.000 Z-2.3601 F3000
+G1 X16.040 Y0.000 Z-2.3560 F3000
+G1 X16.060 Y0.000 Z-2.3520 F3000
+G1 X16.080 Y0.000 Z-2.3479 F3000
+G1 X16.100 Y0.000 Z-2.3439 F3000
+G1 X16.120 Y0.000 Z-2.3399 F3000
+G1 X16.140 Y0.000 Z-2.3359 F3000
+G1 X16.160 Y0.000 Z-2.3320 F3000
+G1 X16.180 Y0.000 Z-2.3280 F3000
+G1 X16.200 Y0.000 Z-2.3241 F3000
+G1 X16.220 Y0.000 Z-2.3202 F3000
+G1 X16.240 Y0.000 Z-2.3164 F3000
+G1 X16.260 Y0.000 Z-2.3125 F3000
+G1 X16.280 Y0.000 Z-2.3087 F3000
+G1 X16.300 Y0.000 Z-2.3049 F3000
+G1 X16.320 Y0.000 Z-2.3011 F3000
+G1 X16.340 Y0.000 Z-2.2973 F3000
+G1 X16.360 Y0.000 Z-2.2936 F3000
+G1 X16.380 Y0.000 Z-2.2899 F3000
+G1 X16.400 Y0.000 Z-2.2862 F3000
+G1 X16.420 Y0.000 Z-2.2825 F3000
+G1 X16.440 Y0.000 Z-2.2788 F3000
+G1 X16.460 Y0.000 Z-2.2752 F3000
+G1 X16.480 Y0.000 Z-2.2716 F3000
+G1 X16.500 Y0.000 Z-2.2680 F3000
+G1 X16.520 Y0.000 Z-2.2644 F3000
+G1 X16.540 Y0.000 Z-2.2608 F3000
+G1 X16.560 Y0.000 Z-2.2573 F3000
+G1 X16.580 Y0.000 Z-2.2538 F3000
+G1 X16.600 Y0.000 Z-2.2503 F3000
+G1 X16.620 Y0.000 Z-2.2469 F3000
+G1 X16.640 Y0.000 Z-2.2434 F3000
+G1 X16.660 Y0.000 Z-2.2400 F3000
+G1 X16.680 Y0.000 Z-2.2366 F3000
+G1 X16.700 Y0.000 Z-2.2332 F3000
+G1 X16.720 Y0.000 Z-2.2298 F3000
+G1 X16.740 Y0.000 Z-2.2265 F3000
+G1 X16.760 Y0.000 Z-2.2232 F3000
+G1 X16.780 Y0.000 Z-2.2199 F3000
+G1 X16.800 Y0.000 Z-2.2166 F3000
+G1 X16.820 Y0.000 Z-2.2133 F3000
+G1 X16.840 Y0.000 Z-2.2101 F3000
+G1 X16.860 Y0.000 Z-2.2069 F3000
+G1 X16.880 Y0.000 Z-2.2037 F3000
+G1 X16.900 Y0.000 Z-2.2005 F3000
+G1 X16.920 Y0.000 Z-2.1974 F3000
+G1 X16.940 Y0.000 Z-2.1942 F3000
+G1 X16.960 Y0.000 Z-2.1911 F3000
+G1 X16.980 Y0.000 Z-2.1880 F3000
+G1 X17.000 Y0.000 Z-2.1850 F3000
+G1 X17.020 Y0.000 Z-2.1819 F3000
+G1 X17.040 Y0.000 Z-2.1789 F3000
+G1 X17.060 Y0.000 Z-2.1759 F3000
+G1 X17.080 Y0.000 Z-2.1729 F3000
+G1 X17.100 Y0.000 Z-2.1699 F3000
+G1 X17.120 Y0.000 Z-2.1670 F3000
+G1 X17.140 Y0.000 Z-2.1641 F3000
+G1 X17.160 Y0.000 Z-2.1612 F3000
+G1 X17.180 Y0.000 Z-2.1583 F3000
+G1 X17.200 Y0.000 Z-2.1554 F3000
+G1 X17.220 Y0.000 Z-2.1526 F3000
+G1 X17.240 Y0.000 Z-2.1497 F3000
+G1 X17.260 Y0.000 Z-2.1469 F3000
+G1 X17.280 Y0.000 Z-2.1442 F3000
+G1 X17.300 Y0.000 Z-2.1414 F3000
+G1 X17.320 Y0.000 Z-2.1387 F3000
+G1 X17.340 Y0.000 Z-2.1360 F3000
+G1 X17.360 Y0.000 Z-2.1333 F3000
+G1 X17.380 Y0.000 Z-2.1306 F3000
+G1 X17.400 Y0.000 Z-2.1279 F3000
+G1 X17.420 Y0.000 Z-2.1253 F3000
+G1 X17.440 Y0.000 Z-2.1227 F3000
+G1 X17.460 Y0.000 Z-2.1201 F3000
+G1 X17.480 Y0.000 Z-2.1175 F3000
+G1 X17.500 Y0.000 Z-2.1150 F3000
+G1 X17.520 Y0.000 Z-2.1125 F3000
+G1 X17.540 Y0.000 Z-2.1099 F3000
+G1 X17.560 Y0.000 Z-2.1075 F3000
+G1 X17.580 Y0.000 Z-2.1050 F3000
+G1 X17.600 Y0.000 Z-2.1025 F3000
+G1 X17.620 Y0.000 Z-2.1001 F3000
+G1 X17.640 Y0.000 Z-2.0977 F3000
+G1 X17.660 Y0.000 Z-2.0953 F3000
+G1 X17.680 Y0.000 Z-2.0930 F3000
+G1 X17.700 Y0.000 Z-2.0906 F3000
+G1 X17.720 Y0.000 Z-2.0883 F3000
+G1 X17.740 Y0.000 Z-2.0860 F3000
+G1 X17.760 Y0.000 Z-2.0837 F3000
+G1 X17.780 Y0.000 Z-2.0814 F3000
+G1 X17.800 Y0.000 Z-2.0792 F3000
+G1 X17.820 Y0.000 Z-2.0770 F3000
+G1 X17.840 Y0.000 Z-2.0748 F3000
+G1 X17.860 Y0.000 Z-2.0726 F3000
+G1 X17.880 Y0.000 Z-2.0704 F3000
+G1 X17.900 Y0.000 Z-2.0683 F3000
+G1 X17.920 Y0.000 Z-2.0662 F3000
+G1 X17.940 Y0.000 Z-2.0641 F3000
+G1 X17.960 Y0.000 Z-2.0620 F3000
+G1 X17.980 Y0.000 Z-2.0599 F3000
+G1 X18.000 Y0.000 Z-2.0579 F3000
+G1 X18.020 Y0.000 Z-2.0559 F3000
+G1 X18.040 Y0.000 Z-2.0539 F3000
+G1 X18.060 Y0.000 Z-2.0519 F3000
+G1 X18.080 Y0.000 Z-2.0500 F3000
+G1 X18.100 Y0.000 Z-2.0480 F3000
+G1 X18.120 Y0.000 Z-2.0461 F3000
+G1 X18.140 Y0.000 Z-2.0442 F3000
+G1 X18.160 Y0.000 Z-2.0424 F3000
+G1 X18.180 Y0.000 Z-2.0405 F3000
+G1 X18.200 Y0.000 Z-2.0387 F3000
+G1 X18.220 Y0.000 Z-2.0369 F3000
+G1 X18.240 Y0.000 Z-2.0351 F3000
+G1 X18.260 Y0.000 Z-2.0333 F3000
+G1 X18.280 Y0.000 Z-2.0316 F3000
+G1 X18.300 Y0.000 Z-2.0298 F3000
+G1 X18.320 Y0.000 Z-2.0281 F3000
+G1 X18.340 Y0.000 Z-2.0264 F3000
+G1 X18.360 Y0.000 Z-2.0248 F3000
+G1 X18.380 Y0.000 Z-2.0231 F3000
+G1 X18.400 Y0.000 Z-2.0215 F3000
+G1 X18.420 Y0.000 Z-2.0199 F3000
+G1 X18.440 Y0.000 Z-2.0183 F3000
+G1 X18.460 Y0.000 Z-2.0167 F3000
+G1 X18.480 Y0.000 Z-2.0152 F3000
+G1 X18.500 Y0.000 Z-2.0136 F3000
+G1 X18.520 Y0.000 Z-2.0121 F3000
+G1 X18.540 Y0.000 Z-2.0106 F3000
+G1 X18.560 Y0.000 Z-2.0092 F3000
+G1 X18.580 Y0.000 Z-2.0077 F3000
+G1 X18.600 Y0.000 Z-2.0063 F3000
+G1 X18.620 Y0.000 Z-2.0049 F3000
+G1 X18.640 Y0.000 Z-2.0035 F3000
+G1 X18.660 Y0.000 Z-2.0022 F3000
+G1 X18.680 Y0.000 Z-2.0008 F3000
+G1 X18.700 Y0.000 Z-1.9995 F3000
+G1 X18.720 Y0.000 Z-1.9982 F3000
+G1 X18.740 Y0.000 Z-1.9969 F3000
+G1 X18.760 Y0.000 Z-1.9956 F3000
+G1 X18.780 Y0.000 Z-1.9944 F3000
+G1 X18.800 Y0.000 Z-1.9932 F3000
+G1 X18.820 Y0.000 Z-1.9920 F3000
+G1 X18.840 Y0.000 Z-1.9908 F3000
+G1 X18.860 Y0.000 Z-1.9896 F3000
+G1 X18.880 Y0.000 Z-1.9885 F3000
+G1 X18.900 Y0.000 Z-1.9874 F3000
+G1 X18.920 Y0.000 Z-1.9863 F3000
+G1 X18.940 Y0.000 Z-1.9852 F3000
+G1 X18.960 Y0.000 Z-1.9841 F3000
+G1 X18.980 Y0.000 Z-1.9831 F3000
+G1 X19.000 Y0.000 Z-1.9821 F3000
+G1 X19.020 Y0.000 Z-1.9811 F3000
+G1 X19.040 Y0.000 Z-1.9801 F3000
+G1 X19.060 Y0.000 Z-1.9791 F3000
+G1 X19.080 Y0.000 Z-1.9782 F3000
+G1 X19.100 Y0.000 Z-1.9773 F3000
+G1 X19.120 Y0.000 Z-1.9764 F3000
+G1 X19.140 Y0.000 Z-1.9755 F3000
+G1 X19.160 Y0.000 Z-1.9747 F3000
+G1 X19.180 Y0.000 Z-1.9738 F3000
+G1 X19.200 Y0.000 Z-1.9730 F3000
+G1 X19.220 Y0.000 Z-1.9722 F3000
+G1 X19.240 Y0.000 Z-1.9714 F3000
+G1 X19.260 Y0.000 Z-1.9707 F3000
+G1 X19.280 Y0.000 Z-1.9699 F3000
+G1 X19.300 Y0.000 Z-1.9692 F3000
+G1 X19.320 Y0.000 Z-1.9685 F3000
+G1 X19.340 Y0.000 Z-1.9678 F3000
+G1 X19.360 Y0.000 Z-1.9672 F3000
+G1 X19.380 Y0.000 Z-1.9666 F3000
+G1 X19.400 Y0.000 Z-1.9659 F3000
+G1 X19.420 Y0.000 Z-1.9653 F3000
+G1 X19.440 Y0.000 Z-1.9648 F3000
+G1 X19.460 Y0.000 Z-1.9642 F3000
+G1 X19.480 Y0.000 Z-1.9637 F3000
+G1 X19.500 Y0.000 Z-1.9632 F3000
+G1 X19.520 Y0.000 Z-1.9627 F3000
+G1 X19.540 Y0.000 Z-1.9622 F3000
+G1 X19.560 Y0.000 Z-1.9617 F3000
+G1 X19.580 Y0.000 Z-1.9613 F3000
+G1 X19.600 Y0.000 Z-1.9609 F3000
+G1 X19.620 Y0.000 Z-1.9605 F3000
+G1 X19.640 Y0.000 Z-1.9601 F3000
+G1 X19.660 Y0.000 Z-1.9598 F3000
+G1 X19.680 Y0.000 Z-1.9594 F3000
+G1 X19.700 Y0.000 Z-1.9591 F3000
+G1 X19.720 Y0.000 Z-1.9588 F3000
+G1 X19.740 Y0.000 Z-1.9586 F3000
+G1 X19.760 Y0.000 Z-1.9583 F3000
+G1 X19.780 Y0.000 Z-1.9581 F3000
+G1 X19.800 Y0.000 Z-1.9579 F3000
+G1 X19.820 Y0.000 Z-1.9577 F3000
+G1 X19.840 Y0.000 Z-1.9575 F3000
+G1 X19.860 Y0.000 Z-1.9574 F3000
+G1 X19.880 Y0.000 Z-1.9572 F3000
+G1 X19.900 Y0.000 Z-1.9571 F3000
+G1 X19.920 Y0.000 Z-1.9570 F3000
+G1 X19.940 Y0.000 Z-1.9570 F3000
+G1 X19.960 Y0.000 Z-1.9569 F3000
+G1 X19.980 Y0.000 Z-1.9569 F3000
+G1 X20.000 Y0.000 Z-1.9569 F3000
+G1 X20.020 Y0.000 Z-1.9569 F3000
+G1 X20.040 Y0.000 Z-1.9569 F3000
+G1 X20.060 Y0.000 Z-1.9570 F3000
+G1 X20.080 Y0.000 Z-1.9570 F3000
+G1 X20.100 Y0.000 Z-1.9571 F3000
+G1 X20.120 Y0.000 Z-1.9572 F3000
+G1 X20.140 Y0.000 Z-1.9574 F3000
+G1 X20.160 Y0.000 Z-1.9575 F3000
+G1 X20.180 Y0.000 Z-1.9577 F3000
+G1 X20.200 Y0.000 Z-1.9579 F3000
+G1 X20.220 Y0.000 Z-1.9581 F3000
+G1 X20.240 Y0.000 Z-1.9583 F3000
+G1 X20.260 Y0.000 Z-1.9586 F3000
+G1 X20.280 Y0.000 Z-1.9588 F3000
+G1 X20.300 Y0.000 Z-1.9591 F3000
+G1 X20.320 Y0.000 Z-1.9594 F3000
+G1 X20.340 Y0.000 Z-1.9598 F3000
+G1 X20.360 Y0.000 Z-1.9601 F3000
+G1 X20.380 Y0.000 Z-1.9605 F3000
+G1 X20.400 Y0.000 Z-1.9609 F3000
+G1 X20.420 Y0.000 Z-1.9613 F3000
+G1 X20.440 Y0.000 Z-1.9617 F3000
+G1 X20.460 Y0.000 Z-1.9622 F3000
+G1 X20.480 Y0.000 Z-1.9627 F3000
+G1 X20.500 Y0.000 Z-1.9632 F3000
+G1 X20.520 Y0.000 Z-1.9637 F3000
+G1 X20.540 Y0.000 Z-1.9642 F3000
+G1 X20.560 Y0.000 Z-1.9648 F3000
+G1 X20.580 Y0.000 Z-1.9653 F3000
+G1 X20.600 Y0.000 Z-1.9659 F3000
+G1 X20.620 Y0.000 Z-1.9666 F3000
+G1 X20.640 Y0.000 Z-1.9672 F3000
+G1 X20.660 Y0.000 Z-1.9678 F3000
+G1 X20.680 Y0.000 Z-1.9685 F3000
+G1 X20.700 Y0.000 Z-1.9692 F3000
+G1 X20.720 Y0.000 Z-1.9699 F3000
+G1 X20.740 Y0.000 Z-1.9707 F3000
+G1 X20.760 Y0.000 Z-1.9714 F3000
+G1 X20.780 Y0.000 Z-1.9722 F3000
+G1 X20.800 Y0.000 Z-1.9730 F3000
+G1 X20.820 Y0.000 Z-1.9738 F3000
+G1 X20.840 Y0.000 Z-1.9747 F3000
+G1 X20.860 Y0.000 Z-1.9755 F3000
+G1 X20.880 Y0.000 Z-1.9764 F3000
+G1 X20.900 Y0.000 Z-1.9773 F3000
+G1 X20.920 Y0.000 Z-1.9782 F3000
+G1 X20.940 Y0.000 Z-1.9791 F3000
+G1 X20.960 Y0.000 Z-1.9801 F3000
+G1 X20.980 Y0.000 Z-1.9811 F3000
+G1 X21.000 Y0.000 Z-1.9821 F3000
+G1 X21.020 Y0.000 Z-1.9831 F3000
+G1 X21.040 Y0.000 Z-1.9841 F3000
+G1 X21.060 Y0.000 Z-1.9852 F3000
+G1 X21.080 Y0.000 Z-1.9863 F3000
+G1 X21.100 Y0.000 Z-1.9874 F3000
+G1 X21.120 Y0.000 Z-1.9885 F3000
+G1 X21.140 Y0.000 Z-1.9896 F3000
+G1 X21.160 Y0.000 Z-1.9908 F3000
+G1 X21.180 Y0.000 Z-1.9920 F3000
+G1 X21.200 Y0.000 Z-1.9932 F3000
+G1 X21.220 Y0.000 Z-1.9944 F3000
+G1 X21.240 Y0.000 Z-1.9956 F3000
+G1 X21.260 Y0.000 Z-1.9969 F3000
+G1 X21.280 Y0.000 Z-1.9982 F3000
+G1 X21.300 Y0.000 Z-1.9995 F3000
+G1 X21.320 Y0.000 Z-2.0008 F3000
+G1 X21.340 Y0.000 Z-2.0022 F3000
+G1 X21.360 Y0.000 Z-2.0035 F3000
+G1 X21.380 Y0.000 Z-2.0049 F3000
+G1 X21.400 Y0.000 Z-2.0063 F3000
+G1 X21.420 Y0.000 Z-2.0077 F3000
+G1 X21.440 Y0.000 Z-2.0092 F3000
+G1 X21.460 Y0.000 Z-2.0106 F3000
+G1 X21.480 Y0.000 Z-2.0121 F3000
+G1 X21.500 Y0.000 Z-2.0136 F3000
+G1 X21.520 Y0.000 Z-2.0152 F3000
+G1 X21.540 Y0.000 Z-2.0167 F3000
+G1 X21.560 Y0.000 Z-2.0183 F3000
+G1 X21.580 Y0.000 Z-2.0199 F3000
+G1 X21.600 Y0.000 Z-2.0215 F3000
+G1 X21.620 Y0.000 Z-2.0231 F3000
+G1 X21.640 Y0.000 Z-2.0248 F3000
+G1 X21.660 Y0.000 Z-2.0264 F3000
+G1 X21.680 Y0.000 Z-2.0281 F3000
+G1 X21.700 Y0.000 Z-2.0298 F3000
+G1 X21.720 Y0.000 Z-2.0316 F3000
+G1 X21.740 Y0.000 Z-2.0333 F3000
+G1 X21.760 Y0.000 Z-2.0351 F3000
+G1 X21.780 Y0.000 Z-2.0369 F3000
+G1 X21.800 Y0.000 Z-2.0387 F3000
+G1 X21.820 Y0.000 Z-2.0405 F3000
+G1 X21.840 Y0.000 Z-2.0424 F3000
+G1 X21.860 Y0.000 Z-2.0442 F3000
+G1 X21.880 Y0.000 Z-2.0461 F3000
+G1 X21.900 Y0.000 Z-2.0480 F3000
+G1 X21.920 Y0.000 Z-2.0500 F3000
+G1 X21.940 Y0.000 Z-2.0519 F3000
+G1 X21.960 Y0.000 Z-2.0539 F3000
+G1 X21.980 Y0.000 Z-2.0559 F3000
+G1 X22.000 Y0.000 Z-2.0579 F3000
+G1 X22.020 Y0.000 Z-2.0599 F3000
+G1 X22.040 Y0.000 Z-2.0620 F3000
+G1 X22.060 Y0.000 Z-2.0641 F3000
+G1 X22.080 Y0.000 Z-2.0662 F3000
+G1 X22.100 Y0.000 Z-2.0683 F3000
+G1 X22.120 Y0.000 Z-2.0704 F3000
+G1 X22.140 Y0.000 Z-2.0726 F3000
+G1 X22.160 Y0.000 Z-2.0748 F3000
+G1 X22.180 Y0.000 Z-2.0770 F3000
+G1 X22.200 Y0.000 Z-2.0792 F3000
+G1 X22.220 Y0.000 Z-2.0814 F3000
+G1 X22.240 Y0.000 Z-2.0837 F3000
+G1 X22.260 Y0.000 Z-2.0860 F3000
+G1 X22.280 Y0.000 Z-2.0883 F3000
+G1 X22.300 Y0.000 Z-2.0906 F3000
+G1 X22.320 Y0.000 Z-2.0930 F3000
+G1 X22.340 Y0.000 Z-2.0953 F3000
+G1 X22.360 Y0.000 Z-2.0977 F3000
+G1 X22.380 Y0.000 Z-2.1001 F3000
+G1 X22.400 Y0.000 Z-2.1025 F3000
+G1 X22.420 Y0.000 Z-2.1050 F3000
+G1 X22.440 Y0.000 Z-2.1075 F3000
+G1 X22.460 Y0.000 Z-2.1099 F3000
+G1 X22.480 Y0.000 Z-2.1125 F3000
+G1 X22.500 Y0.000 Z-2.1150 F3000
+G1 X22.520 Y0.000 Z-2.1175 F3000
+G1 X22.540 Y0.000 Z-2.1201 F3000
+G1 X22.560 Y0.000 Z-2.1227 F3000
+G1 X22.580 Y0.000 Z-2.1253 F3000
+G1 X22.600 Y0.000 Z-2.1279 F3000
+G1 X22.620 Y0.000 Z-2.1306 F3000
+G1 X22.640 Y0.000 Z-2.1333 F3000
+G1 X22.660 Y0.000 Z-2.1360 F3000
+G1 X22.680 Y0.000 Z-2.1387 F3000
+G1 X22.700 Y0.000 Z-2.1414 F3000
+G1 X22.720 Y0.000 Z-2.1442 F3000
+G1 X22.740 Y0.000 Z-2.1469 F3000
+G1 X22.760 Y0.000 Z-2.1497 F3000
+G1 X22.780 Y0.000 Z-2.1526 F3000
+G1 X22.800 Y0.000 Z-2.1554 F3000
+G1 X22.820 Y0.000 Z-2.1583 F3000
+G1 X22.840 Y0.000 Z-2.1612 F3000
+G1 X22.860 Y0.000 Z-2.1641 F3000
+G1 X22.880 Y0.000 Z-2.1670 F3000
+G1 X22.900 Y0.000 Z-2.1699 F3000
+G1 X22.920 Y0.000 Z-2.1729 F3000
+G1 X22.940 Y0.000 Z-2.1759 F3000
+G1 X22.960 Y0.000 Z-2.1789 F3000
+G1 X22.980 Y0.000 Z-2.1819 F3000
+G1 X23.000 Y0.000 Z-2.1850 F3000
+G1 X23.020 Y0.000 Z-2.1880 F3000
+G1 X23.040 Y0.000 Z-2.1911 F3000
+G1 X23.060 Y0.000 Z-2.1942 F3000
+G1 X23.080 Y0.000 Z-2.1974 F3000
+G1 X23.100 Y0.000 Z-2.2005 F3000
+G1 X23.120 Y0.000 Z-2.2037 F3000
+G1 X23.140 Y0.000 Z-2.2069 F3000
+G1 X23.160 Y0.000 Z-2.2101 F3000
+G1 X23.180 Y0.000 Z-2.2133 F3000
+G1 X23.200 Y0.000 Z-2.2166 F3000
+G1 X23.220 Y0.000 Z-2.2199 F3000
+G1 X23.240 Y0.000 Z-2.2232 F3000
+G1 X23.260 Y0.000 Z-2.2265 F3000
+G1 X23.280 Y0.000 Z-2.2298 F3000
+G1 X23.300 Y0.000 Z-2.2332 F3000
+G1 X23.320 Y0.000 Z-2.2366 F3000
+G1 X23.340 Y0.000 Z-2.2400 F3000
+G1 X23.360 Y0.000 Z-2.2434 F3000
+G1 X23.380 Y0.000 Z-2.2469 F3000
+G1 X23.400 Y0.000 Z-2.2503 F3000
+G1 X23.420 Y0.000 Z-2.2538 F3000
+G1 X23.440 Y0.000 Z-2.2573 F3000
+G1 X23.460 Y0.000 Z-2.2608 F3000
+G1 X23.480 Y0.000 Z-2.2644 F3000
+G1 X23.500 Y0.000 Z-2.2680 F3000
+G1 X23.520 Y0.000 Z-2.2716 F3000
+G1 X23.540 Y0.000 Z-2.2752 F3000
+G1 X23.560 Y0.000 Z-2.2788 F3000
+G1 X23.580 Y0.000 Z-2.2825 F3000
+G1 X23.600 Y0.000 Z-2.2862 F3000
+G1 X23.620 Y0.000 Z-2.2899 F3000
+G1 X23.640 Y0.000 Z-2.2936 F3000
+G1 X23.660 Y0.000 Z-2.2973 F3000
+G1 X23.680 Y0.000 Z-2.3011 F3000
+G1 X23.700 Y0.000 Z-2.3049 F3000
+G1 X23.720 Y0.000 Z-2.3087 F3000
+G1 X23.740 Y0.000 Z-2.3125 F3000
+G1 X23.760 Y0.000 Z-2.3164 F3000
+G1 X23.780 Y0.000 Z-2.3202 F3000
+G1 X23.800 Y0.000 Z-2.3241 F3000
+G1 X23.820 Y0.000 Z-2.3280 F3000
+G1 X23.840 Y0.000 Z-2.3320 F3000
+G1 X23.860 Y0.000 Z-2.3359 F3000
+G1 X23.880 Y0.000 Z-2.3399 F3000
+G1 X23.900 Y0.000 Z-2.3439 F3000
+G1 X23.920 Y0.000 Z-2.3479 F3000
+G1 X23.940 Y0.000 Z-2.3520 F3000
+G1 X23.960 Y0.000 Z-2.3560 F3000
+G1 X23.980 Y0.000 Z-2.3601 F3000
+G1 X24.000 Y0.000 Z-2.3642 F3000
+G1 X24.020 Y0.000 Z-2.3683 F3000
+G1 X24.040 Y0.000 Z-2.3725 F3000
+G1 X24.060 Y0.000 Z-2.3767 F3000
+G1 X24.080 Y0.000 Z-2.3808 F3000
+G1 X24.100 Y0.000 Z-2.3851 F3000
+G1 X24.120 Y0.000 Z-2.3893 F3000
+G1 X24.140 Y0.000 Z-2.3935 F3000
+G1 X24.160 Y0.000 Z-2.3978 F3000
+G1 X24.180 Y0.000 Z-2.4021 F3000
+G1 X24.200 Y0.000 Z-2.4064 F3000
+G1 X24.220 Y0.000 Z-2.4108 F3000
+G1 X24.240 Y0.000 Z-2.4152 F3000
+G1 X24.260 Y0.000 Z-2.4195 F3000
+G1 X24.280 Y0.000 Z-2.4239 F3000
+G1 X24.300 Y0.000 Z-2.4284 F3000
+G1 X24.320 Y0.000 Z-2.4328 F3000
+G1 X24.340 Y0.000 Z-2.4373 F3000
+G1 X24.360 Y0.000 Z-2.4418 F3000
+G1 X24.380 Y0.000 Z-2.4463 F3000
+G1 X24.400 Y0.000 Z-2.4508 F3000
+G1 X24.420 Y0.000 Z-2.4554 F3000
+G1 X24.440 Y0.000 Z-2.4600 F3000
+G1 X24.460 Y0.000 Z-2.4646 F3000
+G1 X24.480 Y0.000 Z-2.4692 F3000
+G1 X24.500 Y0.000 Z-2.4739 F3000
+G1 X24.520 Y0.000 Z-2.4785 F3000
+G1 X24.540 Y0.000 Z-2.4832 F3000
+G1 X24.560 Y0.000 Z-2.4879 F3000
+G1 X24.580 Y0.000 Z-2.4927 F3000
+G1 X24.600 Y0.000 Z-2.4974 F3000
+G1 X24.620 Y0.000 Z-2.5022 F3000
+G1 X24.640 Y0.000 Z-2.5070 F3000
+G1 X24.660 Y0.000 Z-2.5118 F3000
+G1 X24.680 Y0.000 Z-2.5166 F3000
+G1 X24.700 Y0.000 Z-2.5215 F3000
+G1 X24.720 Y0.000 Z-2.5264 F3000
+G1 X24.740 Y0.000 Z-2.5313 F3000
+G1 X24.760 Y0.000 Z-2.5362 F3000
+G1 X24.780 Y0.000 Z-2.5412 F3000
+G1 X24.800 Y0.000 Z-2.5462 F3000
+G1 X24.820 Y0.000 Z-2.5512 F3000
+G1 X24.840 Y0.000 Z-2.5562 F3000
+G1 X24.860 Y0.000 Z-2.5612 F3000
+G1 X24.880 Y0.000 Z-2.5663 F3000
+G1 X24.900 Y0.000 Z-2.5714 F3000
+G1 X24.920 Y0.000 Z-2.5765 F3000
+G1 X24.940 Y0.000 Z-2.5816 F3000
+G1 X24.960 Y0.000 Z-2.5868 F3000
+G1 X24.980 Y0.000 Z-2.5919 F3000
+G1 X25.000 Y0.000 Z-2.5971 F3000
+G1 X25.020 Y0.000 Z-2.6024 F3000
+G1 X25.040 Y0.000 Z-2.6076 F3000
+G1 X25.060 Y0.000 Z-2.6129 F3000
+G1 X25.080 Y0.000 Z-2.6181 F3000
+G1 X25.100 Y0.000 Z-2.6235 F3000
+G1 X25.120 Y0.000 Z-2.6288 F3000
+G1 X25.140 Y0.000 Z-2.6341 F3000
+G1 X25.160 Y0.000 Z-2.6395 F3000
+G1 X25.180 Y0.000 Z-2.6449 F3000
+G1 X25.200 Y0.000 Z-2.6503 F3000
+G1 X25.220 Y0.000 Z-2.6558 F3000
+G1 X25.240 Y0.000 Z-2.6612 F3000
+G1 X25.260 Y0.000 Z-2.6667 F3000
+G1 X25.280 Y0.000 Z-2.6722 F3000
+G1 X25.300 Y0.000 Z-2.6778 F3000
+G1 X25.320 Y0.000 Z-2.6833 F3000
+G1 X25.340 Y0.000 Z-2.6889 F3000
+G1 X25.360 Y0.000 Z-2.6945 F3000
+G1 X25.380 Y0.000 Z-2.7001 F3000
+G1 X25.400 Y0.000 Z-2.7058 F3000
+G1 X25.420 Y0.000 Z-2.7114 F3000
+G1 X25.440 Y0.000 Z-2.7171 F3000
+G1 X25.460 Y0.000 Z-2.7228 F3000
+G1 X25.480 Y0.000 Z-2.7286 F3000
+G1 X25.500 Y0.000 Z-2.7343 F3000
+G1 X25.520 Y0.000 Z-2.7401 F3000
+G1 X25.540 Y0.000 Z-2.7459 F3000
+G1 X25.560 Y0.000 Z-2.7517 F3000
+G1 X25.580 Y0.000 Z-2.7576 F3000
+G1 X25.600 Y0.000 Z-2.7635 F3000
+G1 X25.620 Y0.000 Z-2.7694 F3000
+G1 X25.640 Y0.000 Z-2.7753 F3000
+G1 X25.660 Y0.000 Z-2.7812 F3000
+G1 X25.680 Y0.000 Z-2.7872 F3000
+G1 X25.700 Y0.000 Z-2.7932 F3000
+G1 X25.720 Y0.000 Z-2.7992 F3000
+G1 X25.740 Y0.000 Z-2.8052 F3000
+G1 X25.760 Y0.000 Z-2.8113 F3000
+G1 X25.780 Y0.000 Z-2.8173 F3000
+G1 X25.800 Y0.000 Z-2.8234 F3000
+G1 X25.820 Y0.000 Z-2.8296 F3000
+G1 X25.840 Y0.000 Z-2.8357 F3000
+G1 X25.860 Y0.000 Z-2.8419 F3000
+G1 X25.880 Y0.000 Z-2.8481 F3000
+G1 X25.900 Y0.000 Z-2.8543 F3000
+G1 X25.920 Y0.000 Z-2.8605 F3000
+G1 X25.940 Y0.000 Z-2.8668 F3000
+G1 X25.960 Y0.000 Z-2.8731 F3000
+G1 X25.980 Y0.000 Z-2.8794 F3000
+G1 X26.000 Y0.000 Z-2.8857 F3000
+G1 X26.020 Y0.000 Z-2.8921 F3000
+G1 X26.040 Y0.000 Z-2.8985 F3000
+G1 X26.060 Y0.000 Z-2.9049 F3000
+G1 X26.080 Y0.000 Z-2.9113 F3000
+G1 X26.100 Y0.000 Z-2.9177 F3000
+G1 X26.120 Y0.000 Z-2.9242 F3000
+G1 X26.140 Y0.000 Z-2.9307 F3000
+G1 X26.160 Y0.000 Z-2.9372 F3000
+G1 X26.180 Y0.000 Z-2.9438 F3000
+G1 X26.200 Y0.000 Z-2.9503 F3000
+G1 X26.220 Y0.000 Z-2.9569 F3000
+G1 X26.240 Y0.000 Z-2.9635 F3000
+G1 X26.260 Y0.000 Z-2.9702 F3000
+G1 X26.280 Y0.000 Z-2.9768 F3000
+G1 X26.300 Y0.000 Z-2.9835 F3000
+G1 X26.320 Y0.000 Z-2.9902 F3000
+G1 X26.340 Y0.000 Z-2.9970 F3000
+G1 X26.360 Y0.000 Z-3.0037 F3000
+G1 X26.380 Y0.000 Z-3.0105 F3000
+G1 X26.400 Y0.000 Z-3.0173 F3000
+G1 X26.420 Y0.000 Z-3.0241 F3000
+G1 X26.440 Y0.000 Z-3.0310 F3000
+G1 X26.460 Y0.000 Z-3.0378 F3000
+G1 X26.480 Y0.000 Z-3.0447 F3000
+G1 X26.500 Y0.000 Z-3.0517 F3000
+G1 X26.520 Y0.000 Z-3.0586 F3000
+G1 X26.540 Y0.000 Z-3.0656 F3000
+G1 X26.560 Y0.000 Z-3.0726 F3000
+G1 X26.580 Y0.000 Z-3.0796 F3000
+G1 X26.600 Y0.000 Z-3.0866 F3000
+G1 X26.620 Y0.000 Z-3.0937 F3000
+G1 X26.640 Y0.000 Z-3.1008 F3000
+G1 X26.660 Y0.000 Z-3.1079 F3000
+G1 X26.680 Y0.000 Z-3.1150 F3000
+G1 X26.700 Y0.000 Z-3.1222 F3000
+G1 X26.720 Y0.000 Z-3.1294 F3000
+G1 X26.740 Y0.000 Z-3.1366 F3000
+G1 X26.760 Y0.000 Z-3.1438 F3000
+G1 X26.780 Y0.000 Z-3.1511 F3000
+G1 X26.800 Y0.000 Z-3.1584 F3000
+G1 X26.820 Y0.000 Z-3.1657 F3000
+G1 X26.840 Y0.000 Z-3.1730 F3000
+G1 X26.860 Y0.000 Z-3.1804 F3000
+G1 X26.880 Y0.000 Z-3.1878 F3000
+G1 X26.900 Y0.000 Z-3.1952 F3000
+G1 X26.920 Y0.000 Z-3.2026 F3000
+G1 X26.940 Y0.000 Z-3.2100 F3000
+G1 X26.960 Y0.000 Z-3.2175 F3000
+G1 X26.980 Y0.000 Z-3.2250 F3000
+G1 X27.000 Y0.000 Z-3.2326 F3000
+G1 X27.020 Y0.000 Z-3.2401 F3000
+G1 X27.040 Y0.000 Z-3.2477 F3000
+G1 X27.060 Y0.000 Z-3.2553 F3000
+G1 X27.080 Y0.000 Z-3.2629 F3000
+G1 X27.100 Y0.000 Z-3.2706 F3000
+G1 X27.120 Y0.000 Z-3.2782 F3000
+G1 X27.140 Y0.000 Z-3.2859 F3000
+G1 X27.160 Y0.000 Z-3.2937 F3000
+G1 X27.180 Y0.000 Z-3.3014 F3000
+G1 X27.200 Y0.000 Z-3.3092 F3000
+G1 X27.220 Y0.000 Z-3.3170 F3000
+G1 X27.240 Y0.000 Z-3.3248 F3000
+G1 X27.260 Y0.000 Z-3.3327 F3000
+G1 X27.280 Y0.000 Z-3.3405 F3000
+G1 X27.300 Y0.000 Z-3.3484 F3000
+G1 X27.320 Y0.000 Z-3.3564 F3000
+G1 X27.340 Y0.000 Z-3.3643 F3000
+G1 X27.360 Y0.000 Z-3.3723 F3000
+G1 X27.380 Y0.000 Z-3.3803 F3000
+G1 X27.400 Y0.000 Z-3.3883 F3000
+G1 X27.420 Y0.000 Z-3.3964 F3000
+G1 X27.440 Y0.000 Z-3.4044 F3000
+G1 X27.460 Y0.000 Z-3.4125 F3000
+G1 X27.480 Y0.000 Z-3.4207 F3000
+G1 X27.500 Y0.000 Z-3.4288 F3000
+G1 X27.520 Y0.000 Z-3.4370 F3000
+G1 X27.540 Y0.000 Z-3.4452 F3000
+G1 X27.560 Y0.000 Z-3.4534 F3000
+G1 X27.580 Y0.000 Z-3.4617 F3000
+G1 X27.600 Y0.000 Z-3.4700 F3000
+G1 X27.620 Y0.000 Z-3.4783 F3000
+G1 X27.640 Y0.000 Z-3.4866 F3000
+G1 X27.660 Y0.000 Z-3.4950 F3000
+G1 X27.680 Y0.000 Z-3.5033 F3000
+G1 X27.700 Y0.000 Z-3.5118 F3000
+G1 X27.720 Y0.000 Z-3.5202 F3000
+G1 X27.740 Y0.000 Z-3.5286 F3000
+G1 X27.760 Y0.000 Z-3.5371 F3000
+G1 X27.780 Y0.000 Z-3.5456 F3000
+G1 X27.800 Y0.000 Z-3.5542 F3000
+G1 X27.820 Y0.000 Z-3.5627 F3000
+G1 X27.840 Y0.000 Z-3.5713 F3000
+G1 X27.860 Y0.000 Z-3.5799 F3000
+G1 X27.880 Y0.000 Z-3.5886 F3000
+G1 X27.900 Y0.000 Z-3.5973 F3000
+G1 X27.920 Y0.000 Z-3.6059 F3000
+G1 X27.940 Y0.000 Z-3.6147 F3000
+G1 X27.960 Y0.000 Z-3.6234 F3000
+G1 X27.980 Y0.000 Z-3.6322 F3000
+G1 X28.000 Y0.000 Z-3.6410 F3000
+G1 X28.020 Y0.000 Z-3.6498 F3000
+G1 X28.040 Y0.000 Z-3.6587 F3000
+G1 X28.060 Y0.000 Z-3.6675 F3000
+G1 X28.080 Y0.000 Z-3.6764 F3000
+G1 X28.100 Y0.000 Z-3.6854 F3000
+G1 X28.120 Y0.000 Z-3.6943 F3000
+G1 X28.140 Y0.000 Z-3.7033 F3000
+G1 X28.160 Y0.000 Z-3.7123 F3000
+G1 X28.180 Y0.000 Z-3.7213 F3000
+G1 X28.200 Y0.000 Z-3.7304 F3000
+G1 X28.220 Y0.000 Z-3.7395 F3000
+G1 X28.240 Y0.000 Z-3.7486 F3000
+G1 X28.260 Y0.000 Z-3.7578 F3000
+G1 X28.280 Y0.000 Z-3.7669 F3000
+G1 X28.300 Y0.000 Z-3.7761 F3000
+G1 X28.320 Y0.000 Z-3.7854 F3000
+G1 X28.340 Y0.000 Z-3.7946 F3000
+G1 X28.360 Y0.000 Z-3.8039 F3000
+G1 X28.380 Y0.000 Z-3.8132 F3000
+G1 X28.400 Y0.000 Z-3.8225 F3000
+G1 X28.420 Y0.000 Z-3.8319 F3000
+G1 X28.440 Y0.000 Z-3.8413 F3000
+G1 X28.460 Y0.000 Z-3.8507 F3000
+G1 X28.480 Y0.000 Z-3.8601 F3000
+G1 X28.500 Y0.000 Z-3.8696 F3000
+G1 X28.520 Y0.000 Z-3.8791 F3000
+G1 X28.540 Y0.000 Z-3.8886 F3000
+G1 X28.560 Y0.000 Z-3.8981 F3000
+G1 X28.580 Y0.000 Z-3.9077 F3000
+G1 X28.600 Y0.000 Z-3.9173 F3000
+G1 X28.620 Y0.000 Z-3.9270 F3000
+G1 X28.640 Y0.000 Z-3.9366 F3000
+G1 X28.660 Y0.000 Z-3.9463 F3000
+G1 X28.680 Y0.000 Z-3.9560 F3000
+G1 X28.700 Y0.000 Z-3.9658 F3000
+G1 X28.720 Y0.000 Z-3.9755 F3000
+G1 X28.740 Y0.000 Z-3.9853 F3000
+G1 X28.760 Y0.000 Z-3.9952 F3000
+G1 X28.780 Y0.000 Z-4.0050 F3000
+G1 X28.800 Y0.000 Z-4.0149 F3000
+G1 X28.820 Y0.000 Z-4.0248 F3000
+G1 X28.840 Y0.000 Z-4.0347 F3000
+G1 X28.860 Y0.000 Z-4.0447 F3000
+G1 X28.880 Y0.000 Z-4.0547 F3000
+G1 X28.900 Y0.000 Z-4.0647 F3000
+G1 X28.920 Y0.000 Z-4.0748 F3000
+G1 X28.940 Y0.000 Z-4.0849 F3000
+G1 X28.960 Y0.000 Z-4.0950 F3000
+G1 X28.980 Y0.000 Z-4.1051 F3000
+G1 X29.000 Y0.000 Z-4.1153 F3000
+G1 X29.020 Y0.000 Z-4.1255 F3000
+G1 X29.040 Y0.000 Z-4.1357 F3000
+G1 X29.060 Y0.000 Z-4.1459 F3000
+G1 X29.080 Y0.000 Z-4.1562 F3000
+G1 X29.100 Y0.000 Z-4.1665 F3000
+G1 X29.120 Y0.000 Z-4.1768 F3000
+G1 X29.140 Y0.000 Z-4.1872 F3000
+G1 X29.160 Y0.000 Z-4.1976 F3000
+G1 X29.180 Y0.000 Z-4.2080 F3000
+G1 X29.200 Y0.000 Z-4.2185 F3000
+G1 X29.220 Y0.000 Z-4.2290 F3000
+G1 X29.240 Y0.000 Z-4.2395 F3000
+G1 X29.260 Y0.000 Z-4.2500 F3000
+G1 X29.280 Y0.000 Z-4.2606 F3000
+G1 X29.300 Y0.000 Z-4.2712 F3000
+G1 X29.320 Y0.000 Z-4.2818 F3000
+G1 X29.340 Y0.000 Z-4.2924 F3000
+G1 X29.360 Y0.000 Z-4.3031 F3000
+G1 X29.380 Y0.000 Z-4.3138 F3000
+G1 X29.400 Y0.000 Z-4.3246 F3000
+G1 X29.420 Y0.000 Z-4.3354 F3000
+G1 X29.440 Y0.000 Z-4.3462 F3000
+G1 X29.460 Y0.000 Z-4.3570 F3000
+G1 X29.480 Y0.000 Z-4.3679 F3000
+G1 X29.500 Y0.000 Z-4.3787 F3000
+G1 X29.520 Y0.000 Z-4.3897 F3000
+G1 X29.540 Y0.000 Z-4.4006 F3000
+G1 X29.560 Y0.000 Z-4.4116 F3000
+G1 X29.580 Y0.000 Z-4.4226 F3000
+G1 X29.600 Y0.000 Z-4.4337 F3000
+G1 X29.620 Y0.000 Z-4.4447 F3000
+G1 X29.640 Y0.000 Z-4.4558 F3000
+G1 X29.660 Y0.000 Z-4.4670 F3000
+G1 X29.680 Y0.000 Z-4.4781 F3000
+G1 X29.700 Y0.000 Z-4.4893 F3000
+G1 X29.720 Y0.000 Z-4.5005 F3000
+G1 X29.740 Y0.000 Z-4.5118 F3000
+G1 X29.760 Y0.000 Z-4.5231 F3000
+G1 X29.780 Y0.000 Z-4.5344 F3000
+G1 X29.800 Y0.000 Z-4.5457 F3000
+G1 X29.820 Y0.000 Z-4.5571 F3000
+G1 X29.840 Y0.000 Z-4.5685 F3000
+G1 X29.860 Y0.000 Z-4.5799 F3000
+G1 X29.880 Y0.000 Z-4.5914 F3000
+G1 X29.900 Y0.000 Z-4.6029 F3000
+G1 X29.920 Y0.000 Z-4.6144 F3000
+G1 X29.940 Y0.000 Z-4.6260 F3000
+G1 X29.960 Y0.000 Z-4.6376 F3000
+G1 X29.980 Y0.000 Z-4.6492 F3000
+G1 X30.000 Y0.000 Z-4.6609 F3000
+G1 X30.020 Y0.000 Z-4.6725 F3000
+G1 X30.040 Y0.000 Z-4.6843 F3000
+G1 X30.060 Y0.000 Z-4.6960 F3000
+G1 X30.080 Y0.000 Z-4.7078 F3000
+G1 X30.100 Y0.000 Z-4.7196 F3000
+G1 X30.120 Y0.000 Z-4.7314 F3000
+G1 X30.140 Y0.000 Z-4.7433 F3000
+G1 X30.160 Y0.000 Z-4.7552 F3000
+G1 X30.180 Y0.000 Z-4.7672 F3000
+G1 X30.200 Y0.000 Z-4.7791 F3000
+G1 X30.220 Y0.000 Z-4.7911 F3000
+G1 X30.240 Y0.000 Z-4.8032 F3000
+G1 X30.260 Y0.000 Z-4.8152 F3000
+G1 X30.280 Y0.000 Z-4.8273 F3000
+G1 X30.300 Y0.000 Z-4.8395 F3000
+G1 X30.320 Y0.000 Z-4.8516 F3000
+G1 X30.340 Y0.000 Z-4.8638 F3000
+G1 X30.360 Y0.000 Z-4.8760 F3000
+G1 X30.380 Y0.000 Z-4.8883 F3000
+G1 X30.400 Y0.000 Z-4.9006 F3000
+G1 X30.420 Y0.000 Z-4.9129 F3000
+G1 X30.440 Y0.000 Z-4.9253 F3000
+G1 X30.460 Y0.000 Z-4.9377 F3000
+G1 X30.480 Y0.000 Z-4.9501 F3000
+G1 X30.500 Y0.000 Z-4.9625 F3000
+G1 X30.520 Y0.000 Z-4.9750 F3000
+G1 X30.540 Y0.000 Z-4.9876 F3000
+G1 X30.560 Y0.000 Z-5.0001 F3000
+G1 X30.580 Y0.000 Z-5.0127 F3000
+G1 X30.600 Y0.000 Z-5.0253 F3000
+G1 X30.620 Y0.000 Z-5.0380 F3000
+G1 X30.640 Y0.000 Z-5.0507 F3000
+G1 X30.660 Y0.000 Z-5.0634 F3000
+G1 X30.680 Y0.000 Z-5.0761 F3000
+G1 X30.700 Y0.000 Z-5.0889 F3000
+G1 X30.720 Y0.000 Z-5.1017 F3000
+G1 X30.740 Y0.000 Z-5.1146 F3000
+G1 X30.760 Y0.000 Z-5.1275 F3000
+G1 X30.780 Y0.000 Z-5.1404 F3000
+G1 X30.800 Y0.000 Z-5.1534 F3000
+G1 X30.820 Y0.000 Z-5.1664 F3000
+G1 X30.840 Y0.000 Z-5.1794 F3000
+G1 X30.860 Y0.000 Z-5.1925 F3000
+G1 X30.880 Y0.000 Z-5.2056 F3000
+G1 X30.900 Y0.000 Z-5.2187 F3000
+G1 X30.920 Y0.000 Z-5.2318 F3000
+G1 X30.940 Y0.000 Z-5.2450 F3000
+G1 X30.960 Y0.000 Z-5.2583 F3000
+G1 X30.980 Y0.000 Z-5.2716 F3000
+G1 X31.000 Y0.000 Z-5.2849 F3000
+G1 X31.020 Y0.000 Z-5.2982 F3000
+G1 X31.040 Y0.000 Z-5.3116 F3000
+G1 X31.060 Y0.000 Z-5.3250 F3000
+G1 X31.080 Y0.000 Z-5.3384 F3000
+G1 X31.100 Y0.000 Z-5.3519 F3000
+G1 X31.120 Y0.000 Z-5.3654 F3000
+G1 X31.140 Y0.000 Z-5.3790 F3000
+G1 X31.160 Y0.000 Z-5.3926 F3000
+G1 X31.180 Y0.000 Z-5.4062 F3000
+G1 X31.200 Y0.000 Z-5.4198 F3000
+G1 X31.220 Y0.000 Z-5.4335 F3000
+G1 X31.240 Y0.000 Z-5.4473 F3000
+G1 X31.260 Y0.000 Z-5.4610 F3000
+G1 X31.280 Y0.000 Z-5.4748 F3000
+G1 X31.300 Y0.000 Z-5.4887 F3000
+G1 X31.320 Y0.000 Z-5.5025 F3000
+G1 X31.340 Y0.000 Z-5.5164 F3000
+G1 X31.360 Y0.000 Z-5.5304 F3000
+G1 X31.380 Y0.000 Z-5.5444 F3000
+G1 X31.400 Y0.000 Z-5.5584 F3000
+G1 X31.420 Y0.000 Z-5.5724 F3000
+G1 X31.440 Y0.000 Z-5.5865 F3000
+G1 X31.460 Y0.000 Z-5.6007 F3000
+G1 X31.480 Y0.000 Z-5.6148 F3000
+G1 X31.500 Y0.000 Z-5.6290 F3000
+G1 X31.520 Y0.000 Z-5.6433 F3000
+G1 X31.540 Y0.000 Z-5.6576 F3000
+G1 X31.560 Y0.000 Z-5.6719 F3000
+G1 X31.580 Y0.000 Z-5.6862 F3000
+G1 X31.600 Y0.000 Z-5.7006 F3000
+G1 X31.620 Y0.000 Z-5.7151 F3000
+G1 X31.640 Y0.000 Z-5.7295 F3000
+G1 X31.660 Y0.000 Z-5.7440 F3000
+G1 X31.680 Y0.000 Z-5.7586 F3000
+G1 X31.700 Y0.000 Z-5.7731 F3000
+G1 X31.720 Y0.000 Z-5.7878 F3000
+G1 X31.740 Y0.000 Z-5.8024 F3000
+G1 X31.760 Y0.000 Z-5.8171 F3000
+G1 X31.780 Y0.000 Z-5.8319 F3000
+G1 X31.800 Y0.000 Z-5.8466 F3000
+G1 X31.820 Y0.000 Z-5.8614 F3000
+G1 X31.840 Y0.000 Z-5.8763 F3000
+G1 X31.860 Y0.000 Z-5.8912 F3000
+G1 X31.880 Y0.000 Z-5.9061 F3000
+G1 X31.900 Y0.000 Z-5.9211 F3000
+G1 X31.920 Y0.000 Z-5.9361 F3000
+G1 X31.940 Y0.000 Z-5.9511 F3000
+G1 X31.960 Y0.000 Z-5.9662 F3000
+G1 X31.980 Y0.000 Z-5.9814 F3000
+G1 X32.000 Y0.000 Z-5.9965 F3000
+G1 X32.020 Y0.000 Z-6.0117 F3000
+G1 X32.040 Y0.000 Z-6.0270 F3000
+G1 X32.060 Y0.000 Z-6.0423 F3000
+G1 X32.080 Y0.000 Z-6.0576 F3000
+G1 X32.100 Y0.000 Z-6.0730 F3000
+G1 X32.120 Y0.000 Z-6.0884 F3000
+G1 X32.140 Y0.000 Z-6.1038 F3000
+G1 X32.160 Y0.000 Z-6.1193 F3000
+G1 X32.180 Y0.000 Z-6.1348 F3000
+G1 X32.200 Y0.000 Z-6.1504 F3000
+G1 X32.220 Y0.000 Z-6.1660 F3000
+G1 X32.240 Y0.000 Z-6.1817 F3000
+G1 X32.260 Y0.000 Z-6.1974 F3000
+G1 X32.280 Y0.000 Z-6.2131 F3000
+G1 X32.300 Y0.000 Z-6.2289 F3000
+G1 X32.320 Y0.000 Z-6.2447 F3000
+G1 X32.340 Y0.000 Z-6.2606 F3000
+G1 X32.360 Y0.000 Z-6.2765 F3000
+G1 X32.380 Y0.000 Z-6.2924 F3000
+G1 X32.400 Y0.000 Z-6.3084 F3000
+G1 X32.420 Y0.000 Z-6.3244 F3000
+G1 X32.440 Y0.000 Z-6.3405 F3000
+G1 X32.460 Y0.000 Z-6.3566 F3000
+G1 X32.480 Y0.000 Z-6.3728 F3000
+G1 X32.500 Y0.000 Z-6.3890 F3000
+G1 X32.520 Y0.000 Z-6.4052 F3000
+G1 X32.540 Y0.000 Z-6.4215 F3000
+G1 X32.560 Y0.000 Z-6.4378 F3000
+G1 X32.580 Y0.000 Z-6.4542 F3000
+G1 X32.600 Y0.000 Z-6.4706 F3000
+G1 X32.620 Y0.000 Z-6.4871 F3000
+G1 X32.640 Y0.000 Z-6.5036 F3000
+G1 X32.660 Y0.000 Z-6.5201 F3000
+G1 X32.680 Y0.000 Z-6.5367 F3000
+G1 X32.700 Y0.000 Z-6.5534 F3000
+G1 X32.720 Y0.000 Z-6.5700 F3000
+G1 X32.740 Y0.000 Z-6.5868 F3000
+G1 X32.760 Y0.000 Z-6.6035 F3000
+G1 X32.780 Y0.000 Z-6.6204 F3000
+G1 X32.800 Y0.000 Z-6.6372 F3000
+G1 X32.820 Y0.000 Z-6.6541 F3000
+G1 X32.840 Y0.000 Z-6.6711 F3000
+G1 X32.860 Y0.000 Z-6.6881 F3000
+G1 X32.880 Y0.000 Z-6.7051 F3000
+G1 X32.900 Y0.000 Z-6.7222 F3000
+G1 X32.920 Y0.000 Z-6.7393 F3000
+G1 X32.940 Y0.000 Z-6.7565 F3000
+G1 X32.960 Y0.000 Z-6.7737 F3000
+G1 X32.980 Y0.000 Z-6.7910 F3000
+G1 X33.000 Y0.000 Z-6.8083 F3000
+G1 X33.020 Y0.000 Z-6.8257 F3000
+G1 X33.040 Y0.000 Z-6.8431 F3000
+G1 X33.060 Y0.000 Z-6.8606 F3000
+G1 X33.080 Y0.000 Z-6.8781 F3000
+G1 X33.100 Y0.000 Z-6.8956 F3000
+G1 X33.120 Y0.000 Z-6.9132 F3000
+G1 X33.140 Y0.000 Z-6.9309 F3000
+G1 X33.160 Y0.000 Z-6.9486 F3000
+G1 X33.180 Y0.000 Z-6.9663 F3000
+G1 X33.200 Y0.000 Z-6.9841 F3000
+G1 X33.220 Y0.000 Z-7.0020 F3000
+G1 X33.240 Y0.000 Z-7.0199 F3000
+G1 X33.260 Y0.000 Z-7.0378 F3000
+G1 X33.280 Y0.000 Z-7.0558 F3000
+G1 X33.300 Y0.000 Z-7.0738 F3000
+G1 X33.320 Y0.000 Z-7.0919 F3000
+G1 X33.340 Y0.000 Z-7.1101 F3000
+G1 X33.360 Y0.000 Z-7.1282 F3000
+G1 X33.380 Y0.000 Z-7.1465 F3000
+G1 X33.400 Y0.000 Z-7.1648 F3000
+G1 X33.420 Y0.000 Z-7.1831 F3000
+G1 X33.440 Y0.000 Z-7.2015 F3000
+G1 X33.460 Y0.000 Z-7.2199 F3000
+G1 X33.480 Y0.000 Z-7.2384 F3000
+G1 X33.500 Y0.000 Z-7.2570 F3000
+G1 X33.520 Y0.000 Z-7.2756 F3000
+G1 X33.540 Y0.000 Z-7.2942 F3000
+G1 X33.560 Y0.000 Z-7.3129 F3000
+G1 X33.580 Y0.000 Z-7.3316 F3000
+G1 X33.600 Y0.000 Z-7.3504 F3000
+G1 X33.620 Y0.000 Z-7.3693 F3000
+G1 X33.640 Y0.000 Z-7.3882 F3000
+G1 X33.660 Y0.000 Z-7.4071 F3000
+G1 X33.680 Y0.000 Z-7.4261 F3000
+G1 X33.700 Y0.000 Z-7.4452 F3000
+G1 X33.720 Y0.000 Z-7.4643 F3000
+G1 X33.740 Y0.000 Z-7.4835 F3000
+G1 X33.760 Y0.000 Z-7.5027 F3000
+G1 X33.780 Y0.000 Z-7.5220 F3000
+G1 X33.800 Y0.000 Z-7.5413 F3000
+G1 X33.820 Y0.000 Z-7.5607 F3000
+G1 X33.840 Y0.000 Z-7.5801 F3000
+G1 X33.860 Y0.000 Z-7.5996 F3000
+G1 X33.880 Y0.000 Z-7.6192 F3000
+G1 X33.900 Y0.000 Z-7.6388 F3000
+G1 X33.920 Y0.000 Z-7.6584 F3000
+G1 X33.940 Y0.000 Z-7.6782 F3000
+G1 X33.960 Y0.000 Z-7.6979 F3000
+G1 X33.980 Y0.000 Z-7.7178 F3000
+G1 X34.000 Y0.000 Z-7.7376 F3000
+G1 X34.020 Y0.000 Z-7.7576 F3000
+G1 X34.040 Y0.000 Z-7.7776 F3000
+G1 X34.060 Y0.000 Z-7.7976 F3000
+G1 X34.080 Y0.000 Z-7.8177 F3000
+G1 X34.100 Y0.000 Z-7.8379 F3000
+G1 X34.120 Y0.000 Z-7.8581 F3000
+G1 X34.140 Y0.000 Z-7.8784 F3000
+G1 X34.160 Y0.000 Z-7.8988 F3000
+G1 X34.180 Y0.000 Z-7.9192 F3000
+G1 X34.200 Y0.000 Z-7.9396 F3000
+G1 X34.220 Y0.000 Z-7.9601 F3000
+G1 X34.240 Y0.000 Z-7.9807 F3000
+G1 X34.260 Y0.000 Z-8.0014 F3000
+G1 X34.280 Y0.000 Z-8.0221 F3000
+G1 X34.300 Y0.000 Z-8.0428 F3000
+G1 X34.320 Y0.000 Z-8.0636 F3000
+G1 X34.340 Y0.000 Z-8.0845 F3000
+G1 X34.360 Y0.000 Z-8.1055 F3000
+G1 X34.380 Y0.000 Z-8.1265 F3000
+G1 X34.400 Y0.000 Z-8.1475 F3000
+G1 X34.420 Y0.000 Z-8.1687 F3000
+G1 X34.440 Y0.000 Z-8.1898 F3000
+G1 X34.460 Y0.000 Z-8.2111 F3000
+G1 X34.480 Y0.000 Z-8.2324 F3000
+G1 X34.500 Y0.000 Z-8.2538 F3000
+G1 X34.520 Y0.000 Z-8.2752 F3000
+G1 X34.540 Y0.000 Z-8.2967 F3000
+G1 X34.560 Y0.000 Z-8.3183 F3000
+G1 X34.580 Y0.000 Z-8.3399 F3000
+G1 X34.600 Y0.000 Z-8.3616 F3000
+G1 X34.620 Y0.000 Z-8.3834 F3000
+G1 X34.640 Y0.000 Z-8.4052 F3000
+G1 X34.660 Y0.000 Z-8.4271 F3000
+G1 X34.680 Y0.000 Z-8.4491 F3000
+G1 X34.700 Y0.000 Z-8.4711 F3000
+G1 X34.720 Y0.000 Z-8.4932 F3000
+G1 X34.740 Y0.000 Z-8.5153 F3000
+G1 X34.760 Y0.000 Z-8.5376 F3000
+G1 X34.780 Y0.000 Z-8.5598 F3000
+G1 X34.800 Y0.000 Z-8.5822 F3000
+G1 X34.820 Y0.000 Z-8.6046 F3000
+G1 X34.840 Y0.000 Z-8.6271 F3000
+G1 X34.860 Y0.000 Z-8.6497 F3000
+G1 X34.880 Y0.000 Z-8.6723 F3000
+G1 X34.900 Y0.000 Z-8.6950 F3000
+G1 X34.920 Y0.000 Z-8.7178 F3000
+G1 X34.940 Y0.000 Z-8.7407 F3000
+G1 X34.960 Y0.000 Z-8.7636 F3000
+G1 X34.980 Y0.000 Z-8.7866 F3000
+G1 X35.000 Y0.000 Z-8.8096 F3000
+G1 X35.020 Y0.000 Z-8.8327 F3000
+G1 X35.040 Y0.000 Z-8.8560 F3000
+G1 X35.060 Y0.000 Z-8.8792 F3000
+G1 X35.080 Y0.000 Z-8.9026 F3000
+G1 X35.100 Y0.000 Z-8.9260 F3000
+G1 X35.120 Y0.000 Z-8.9495 F3000
+G1 X35.140 Y0.000 Z-8.9731 F3000
+G1 X35.160 Y0.000 Z-8.9967 F3000
+G1 X35.180 Y0.000 Z-9.0204 F3000
+G1 X35.200 Y0.000 Z-9.0442 F3000
+G1 X35.220 Y0.000 Z-9.0681 F3000
+G1 X35.240 Y0.000 Z-9.0920 F3000
+G1 X35.260 Y0.000 Z-9.1161 F3000
+G1 X35.280 Y0.000 Z-9.1402 F3000
+G1 X35.300 Y0.000 Z-9.1643 F3000
+G1 X35.320 Y0.000 Z-9.1886 F3000
+G1 X35.340 Y0.000 Z-9.2129 F3000
+G1 X35.360 Y0.000 Z-9.2373 F3000
+G1 X35.380 Y0.000 Z-9.2618 F3000
+G1 X35.400 Y0.000 Z-9.2864 F3000
+G1 X35.420 Y0.000 Z-9.3111 F3000
+G1 X35.440 Y0.000 Z-9.3358 F3000
+G1 X35.460 Y0.000 Z-9.3606 F3000
+G1 X35.480 Y0.000 Z-9.3855 F3000
+G1 X35.500 Y0.000 Z-9.4105 F3000
+G1 X35.520 Y0.000 Z-9.4356 F3000
+G1 X35.540 Y0.000 Z-9.4607 F3000
+G1 X35.560 Y0.000 Z-9.4859 F3000
+G1 X35.580 Y0.000 Z-9.5112 F3000
+G1 X35.600 Y0.000 Z-9.5366 F3000
+G1 X35.620 Y0.000 Z-9.5621 F3000
+G1 X35.640 Y0.000 Z-9.5877 F3000
+G1 X35.660 Y0.000 Z-9.6134 F3000
+G1 X35.680 Y0.000 Z-9.6391 F3000
+G1 X35.700 Y0.000 Z-9.6649 F3000
+G1 X35.720 Y0.000 Z-9.6908 F3000
+G1 X35.740 Y0.000 Z-9.7169 F3000
+G1 X35.760 Y0.000 Z-9.7430 F3000
+G1 X35.780 Y0.000 Z-9.7691 F3000
+G1 X35.800 Y0.000 Z-9.7954 F3000
+G1 X35.820 Y0.000 Z-9.8218 F3000
+G1 X35.840 Y0.000 Z-9.8482 F3000
+G1 X35.860 Y0.000 Z-9.8748 F3000
+G1 X35.880 Y0.000 Z-9.9014 F3000
+G1 X35.900 Y0.000 Z-9.9282 F3000
+G1 X35.920 Y0.000 Z-9.9550 F3000
+G1 X35.940 Y0.000 Z-9.9819 F3000
+G1 X35.960 Y0.000 Z-10.0090 F3000
+G1 X35.980 Y0.000 Z-10.0361 F3000
+G1 X36.000 Y0.000 Z-10.0633 F3000
+G1 X36.020 Y0.000 Z-10.0906 F3000
+G1 X36.040 Y0.000 Z-10.1180 F3000
+G1 X36.060 Y0.000 Z-10.1455 F3000
+G1 X36.080 Y0.000 Z-10.1732 F3000
+G1 X36.100 Y0.000 Z-10.2009 F3000
+G1 X36.120 Y0.000 Z-10.2287 F3000
+G1 X36.140 Y0.000 Z-10.2566 F3000
+G1 X36.160 Y0.000 Z-10.2846 F3000
+G1 X36.180 Y0.000 Z-10.3127 F3000
+G1 X36.200 Y0.000 Z-10.3409 F3000
+G1 X36.220 Y0.000 Z-10.3693 F3000
+G1 X36.240 Y0.000 Z-10.3977 F3000
+G1 X36.260 Y0.000 Z-10.4262 F3000
+G1 X36.280 Y0.000 Z-10.4549 F3000
+G1 X36.300 Y0.000 Z-10.4836 F3000
+G1 X36.320 Y0.000 Z-10.5125 F3000
+G1 X36.340 Y0.000 Z-10.5415 F3000
+G1 X36.360 Y0.000 Z-10.5706 F3000
+G1 X36.380 Y0.000 Z-10.5998 F3000
+G1 X36.400 Y0.000 Z-10.6291 F3000
+G1 X36.420 Y0.000 Z-10.6585 F3000
+G1 X36.440 Y0.000 Z-10.6880 F3000
+G1 X36.460 Y0.000 Z-10.7177 F3000
+G1 X36.480 Y0.000 Z-10.7474 F3000
+G1 X36.500 Y0.000 Z-10.7773 F3000
+G1 X36.520 Y0.000 Z-10.8073 F3000
+G1 X36.540 Y0.000 Z-10.8374 F3000
+G1 X36.560 Y0.000 Z-10.8676 F3000
+G1 X36.580 Y0.000 Z-10.8980 F3000
+G1 X36.600 Y0.000 Z-10.9285 F3000
+G1 X36.620 Y0.000 Z-10.9591 F3000
+G1 X36.640 Y0.000 Z-10.9898 F3000
+G1 X36.660 Y0.000 Z-11.0206 F3000
+G1 X36.680 Y0.000 Z-11.0516 F3000
+G1 X36.700 Y0.000 Z-11.0827 F3000
+G1 X36.720 Y0.000 Z-11.1140 F3000
+G1 X36.740 Y0.000 Z-11.1453 F3000
+G1 X36.760 Y0.000 Z-11.1768 F3000
+G1 X36.780 Y0.000 Z-11.2084 F3000
+G1 X36.800 Y0.000 Z-11.2402 F3000
+G1 X36.820 Y0.000 Z-11.2721 F3000
+G1 X36.840 Y0.000 Z-11.3041 F3000
+G1 X36.860 Y0.000 Z-11.3362 F3000
+G1 X36.880 Y0.000 Z-11.3685 F3000
+G1 X36.900 Y0.000 Z-11.4010 F3000
+G1 X36.920 Y0.000 Z-11.4335 F3000
+G1 X36.940 Y0.000 Z-11.4662 F3000
+G1 X36.960 Y0.000 Z-11.4991 F3000
+G1 X36.980 Y0.000 Z-11.5321 F3000
+G1 X37.000 Y0.000 Z-11.5653 F3000
+G1 X37.020 Y0.000 Z-11.5985 F3000
+G1 X37.040 Y0.000 Z-11.6320 F3000
+G1 X37.060 Y0.000 Z-11.6656 F3000
+G1 X37.080 Y0.000 Z-11.6993 F3000
+G1 X37.100 Y0.000 Z-11.7332 F3000
+G1 X37.120 Y0.000 Z-11.7673 F3000
+G1 X37.140 Y0.000 Z-11.8015 F3000
+G1 X37.160 Y0.000 Z-11.8358 F3000
+G1 X37.180 Y0.000 Z-11.8704 F3000
+G1 X37.200 Y0.000 Z-11.9051 F3000
+G1 X37.220 Y0.000 Z-11.9399 F3000
+G1 X37.240 Y0.000 Z-11.9749 F3000
+G1 X37.260 Y0.000 Z-12.0101 F3000
+G1 X37.280 Y0.000 Z-12.0454 F3000
+G1 X37.300 Y0.000 Z-12.0809 F3000
+G1 X37.320 Y0.000 Z-12.1166 F3000
+G1 X37.340 Y0.000 Z-12.1525 F3000
+G1 X37.360 Y0.000 Z-12.1885 F3000
+G1 X37.380 Y0.000 Z-12.2247 F3000
+G1 X37.400 Y0.000 Z-12.2611 F3000
+G1 X37.420 Y0.000 Z-12.2977 F3000
+G1 X37.440 Y0.000 Z-12.3345 F3000
+G1 X37.460 Y0.000 Z-12.3714 F3000
+G1 X37.480 Y0.000 Z-12.4085 F3000
+G1 X37.500 Y0.000 Z-12.4459 F3000
+G1 X37.520 Y0.000 Z-12.4834 F3000
+G1 X37.540 Y0.000 Z-12.5211 F3000
+G1 X37.560 Y0.000 Z-12.5590 F3000
+G1 X37.580 Y0.000 Z-12.5971 F3000
+G1 X37.600 Y0.000 Z-12.6354 F3000
+G1 X37.620 Y0.000 Z-12.6739 F3000
+G1 X37.640 Y0.000 Z-12.7126 F3000
+G1 X37.660 Y0.000 Z-12.7516 F3000
+G1 X37.680 Y0.000 Z-12.7907 F3000
+G1 X37.700 Y0.000 Z-12.8301 F3000
+G1 X37.720 Y0.000 Z-12.8696 F3000
+G1 X37.740 Y0.000 Z-12.9094 F3000
+G1 X37.760 Y0.000 Z-12.9494 F3000
+G1 X37.780 Y0.000 Z-12.9897 F3000
+G1 X37.800 Y0.000 Z-13.0302 F3000
+G1 X37.820 Y0.000 Z-13.0709 F3000
+G1 X37.840 Y0.000 Z-13.1118 F3000
+G1 X37.860 Y0.000 Z-13.1530 F3000
+G1 X37.880 Y0.000 Z-13.1944 F3000
+G1 X37.900 Y0.000 Z-13.2361 F3000
+G1 X37.920 Y0.000 Z-13.2781 F3000
+G1 X37.940 Y0.000 Z-13.3202 F3000
+G1 X37.960 Y0.000 Z-13.3627 F3000
+G1 X37.980 Y0.000 Z-13.4054 F3000
+G1 X38.000 Y0.000 Z-13.4484 F3000
+G1 X38.020 Y0.000 Z-13.4916 F3000
+G1 X38.040 Y0.000 Z-13.5351 F3000
+G1 X38.060 Y0.000 Z-13.5789 F3000
+G1 X38.080 Y0.000 Z-13.6230 F3000
+G1 X38.100 Y0.000 Z-13.6673 F3000
+G1 X38.120 Y0.000 Z-13.7120 F3000
+G1 X38.140 Y0.000 Z-13.7570 F3000
+G1 X38.160 Y0.000 Z-13.8022 F3000
+G1 X38.180 Y0.000 Z-13.8478 F3000
+G1 X38.200 Y0.000 Z-13.8937 F3000
+G1 X38.220 Y0.000 Z-13.9399 F3000
+G1 X38.240 Y0.000 Z-13.9864 F3000
+G1 X38.260 Y0.000 Z-14.0333 F3000
+G1 X38.280 Y0.000 Z-14.0804 F3000
+G1 X38.300 Y0.000 Z-14.1280 F3000
+G1 X38.320 Y0.000 Z-14.1759 F3000
+G1 X38.340 Y0.000 Z-14.2241 F3000
+G1 X38.360 Y0.000 Z-14.2727 F3000
+G1 X38.380 Y0.000 Z-14.3217 F3000
+G1 X38.400 Y0.000 Z-14.3710 F3000
+G1 X38.420 Y0.000 Z-14.4207 F3000
+G1 X38.440 Y0.000 Z-14.4709 F3000
+G1 X38.460 Y0.000 Z-14.5214 F3000
+G1 X38.480 Y0.000 Z-14.5723 F3000
+G1 X38.500 Y0.000 Z-14.6236 F3000
+G1 X38.520 Y0.000 Z-14.6754 F3000
+G1 X38.540 Y0.000 Z-14.7276 F3000
+G1 X38.560 Y0.000 Z-14.7803 F3000
+G1 X38.580 Y0.000 Z-14.8334 F3000
+G1 X38.600 Y0.000 Z-14.8870 F3000
+G1 X38.620 Y0.000 Z-14.9410 F3000
+G1 X38.640 Y0.000 Z-14.9956 F3000
+G1 X38.660 Y0.000 Z-15.0506 F3000
+G1 X38.680 Y0.000 Z-15.1062 F3000
+G1 X38.700 Y0.000 Z-15.1622 F3000
+G1 X38.720 Y0.000 Z-15.2188 F3000
+G1 X38.740 Y0.000 Z-15.2760 F3000
+G1 X38.760 Y0.000 Z-15.3337 F3000
+G1 X38.780 Y0.000 Z-15.3921 F3000
+G1 X38.800 Y0.000 Z-15.4510 F3000
+G1 X38.820 Y0.000 Z-15.5105 F3000
+G1 X38.840 Y0.000 Z-15.5707 F3000
+G1 X38.860 Y0.000 Z-15.6315 F3000
+G1 X38.880 Y0.000 Z-15.6930 F3000
+G1 X38.900 Y0.000 Z-15.7552 F3000
+G1 X38.920 Y0.000 Z-15.8181 F3000
+G1 X38.940 Y0.000 Z-15.8817 F3000
+G1 X38.960 Y0.000 Z-15.9461 F3000
+G1 X38.980 Y0.000 Z-16.0113 F3000
+G1 X39.000 Y0.000 Z-16.0772 F3000
+G1 X39.020 Y0.000 Z-16.1441 F3000
+G1 X39.040 Y0.000 Z-16.2118 F3000
+G1 X39.060 Y0.000 Z-16.2804 F3000
+G1 X39.080 Y0.000 Z-16.3499 F3000
+G1 X39.100 Y0.000 Z-16.4204 F3000
+G1 X39.120 Y0.000 Z-16.4919 F3000
+G1 X39.140 Y0.000 Z-16.5645 F3000
+G1 X39.160 Y0.000 Z-16.6382 F3000
+G1 X39.180 Y0.000 Z-16.7130 F3000
+G1 X39.200 Y0.000 Z-16.7890 F3000
+G1 X39.220 Y0.000 Z-16.8663 F3000
+G1 X39.240 Y0.000 Z-16.9449 F3000
+G1 X39.260 Y0.000 Z-17.0248 F3000
+G1 X39.280 Y0.000 Z-17.1062 F3000
+G1 X39.300 Y0.000 Z-17.1891 F3000
+G1 X39.320 Y0.000 Z-17.2737 F3000
+G1 X39.340 Y0.000 Z-17.3599 F3000
+G1 X39.360 Y0.000 Z-17.4479 F3000
+G1 X39.380 Y0.000 Z-17.5379 F3000
+G1 X39.400 Y0.000 Z-17.6299 F3000
+G1 X39.420 Y0.000 Z-17.7240 F3000
+G1 X39.440 Y0.000 Z-17.8205 F3000
+G1 X39.460 Y0.000 Z-17.9195 F3000
+G1 X39.480 Y0.000 Z-18.0212 F3000
+G1 X39.500 Y0.000 Z-18.1258 F3000
+G1 X39.520 Y0.000 Z-18.2335 F3000
+G1 X39.540 Y0.000 Z-18.3448 F3000
+G1 X39.560 Y0.000 Z-18.4599 F3000
+G1 X39.580 Y0.000 Z-18.5792 F3000
+G1 X39.600 Y0.000 Z-18.7032 F3000
+G1 X39.620 Y0.000 Z-18.8326 F3000
+G1 X39.640 Y0.000 Z-18.9680 F3000
+G1 X39.660 Y0.000 Z-19.1103 F3000
+G1 X39.680 Y0.000 Z-19.2608 F3000
+G1 X39.700 Y0.000 Z-19.4209 F3000
+G1 X39.720 Y0.000 Z-19.5928 F3000
+G1 X39.740 Y0.000 Z-19.7795 F3000
+G1 X39.760 Y0.000 Z-19.9855 F3000
+G1 X39.780 Y0.000 Z-20.2184 F3000
+G1 X39.800 Y0.000 Z-20.4923 F3000
+G1 X39.820 Y0.000 Z-20.8421 F3000
+G1 X39.840 Y0.000 Z-21.4473 F3000
+G1 X39.860 Y0.000 Z-21.8000 F3000
+G1 X39.880 Y0.000 Z-21.8000 F3000
+G1 X39.900 Y0.000 Z-21.8000 F3000
+G1 X39.920 Y0.000 Z-21.8000 F3000
+G1 X39.940 Y0.000 Z-21.8000 F3000
+G1 X39.960 Y0.000 Z-21.8000 F3000
+G1 X39.980 Y0.000 Z-21.8000 F3000
+G1 X40.000 Y0.000 Z-21.8000 F3000
+G1 X40.000 Y0.500 Z-21.8000 F3000
+G1 X39.980 Y0.500 Z-21.8000 F3000
+G1 X39.960 Y0.500 Z-21.8000 F3000
+G1 X39.940 Y0.500 Z-21.8000 F3000
+G1 X39.920 Y0.500 Z-21.8000 F3000
+G1 X39.900 Y0.500 Z-21.8000 F3000
+G1 X39.880 Y0.500 Z-20.9137 F3000
+G1 X39.860 Y0.500 Z-20.5429 F3000
+G1 X39.840 Y0.500 Z-20.2591 F3000
+G1 X39.820 Y0.500 Z-20.0202 F3000
+G1 X39.800 Y0.500 Z-19.8100 F3000
+G1 X39.780 Y0.500 Z-19.6202 F3000
+G1 X39.760 Y0.500 Z-19.4458 F3000
+G1 X39.740 Y0.500 Z-19.2836 F3000
+G1 X39.720 Y0.500 Z-19.1314 F3000
+G1 X39.700 Y0.500 Z-18.9875 F3000
+G1 X39.680 Y0.500 Z-18.8508 F3000
+G1 X39.660 Y0.500 Z-18.7203 F3000
+G1 X39.640 Y0.500 Z-18.5953 F3000
+G1 X39.620 Y0.500 Z-18.4750 F3000
+G1 X39.600 Y0.500 Z-18.3591 F3000
+G1 X39.580 Y0.500 Z-18.2470 F3000
+G1 X39.560 Y0.500 Z-18.1385 F3000
+G1 X39.540 Y0.500 Z-18.0333 F3000
+G1 X39.520 Y0.500 Z-17.9309 F3000
+G1 X39.500 Y0.500 Z-17.8314 F3000
+G1 X39.480 Y0.500 Z-17.7343 F3000
+G1 X39.460 Y0.500 Z-17.6397 F3000
+G1 X39.440 Y0.500 Z-17.5472 F3000
+G1 X39.420 Y0.500 Z-17.4568 F3000
+G1 X39.400 Y0.500 Z-17.3683 F3000
+G1 X39.380 Y0.500 Z-17.2816 F3000
+G1 X39.360 Y0.500 Z-17.1967 F3000
+G1 X39.340 Y0.500 Z-17.1134 F3000
+G1 X39.320 Y0.500 Z-17.0316 F3000
+G1 X39.300 Y0.500 Z-16.9513 F3000
+G1 X39.280 Y0.500 Z-16.8724 F3000
+G1 X39.260 Y0.500 Z-16.7948 F3000
+G1 X39.240 Y0.500 Z-16.7184 F3000
+G1 X39.220 Y0.500 Z-16.6433 F3000
+G1 X39.200 Y0.500 Z-16.5693 F3000
+G1 X39.180 Y0.500 Z-16.4965 F3000
+G1 X39.160 Y0.500 Z-16.4246 F3000
+G1 X39.140 Y0.500 Z-16.3539 F3000
+G1 X39.120 Y0.500 Z-16.2841 F3000
+G1 X39.100 Y0.500 Z-16.2152 F3000
+G1 X39.080 Y0.500 Z-16.1472 F3000
+G1 X39.060 Y0.500 Z-16.0802 F3000
+G1 X39.040 Y0.500 Z-16.0139 F3000
+G1 X39.020 Y0.500 Z-15.9485 F3000
+G1 X39.000 Y0.500 Z-15.8839 F3000
+G1 X38.980 Y0.500 Z-15.8201 F3000
+G1 X38.960 Y0.500 Z-15.7570 F3000
+G1 X38.940 Y0.500 Z-15.6946 F3000
+G1 X38.920 Y0.500 Z-15.6329 F3000
+G1 X38.900 Y0.500 Z-15.5718 F3000
+G1 X38.880 Y0.500 Z-15.5115 F3000
+G1 X38.860 Y0.500 Z-15.4517 F3000
+G1 X38.840 Y0.500 Z-15.3926 F3000
+G1 X38.820 Y0.500 Z-15.3341 F3000
+G1 X38.800 Y0.500 Z-15.2762 F3000
+G1 X38.780 Y0.500 Z-15.2188 F3000
+G1 X38.760 Y0.500 Z-15.1620 F3000
+G1 X38.740 Y0.500 Z-15.1058 F3000
+G1 X38.720 Y0.500 Z-15.0501 F3000
+G1 X38.700 Y0.500 Z-14.9949 F3000
+G1 X38.680 Y0.500 Z-14.9401 F3000
+G1 X38.660 Y0.500 Z-14.8859 F3000
+G1 X38.640 Y0.500 Z-14.8322 F3000
+G1 X38.620 Y0.500 Z-14.7789 F3000
+G1 X38.600 Y0.500 Z-14.7261 F3000
+G1 X38.580 Y0.500 Z-14.6737 F3000
+G1 X38.560 Y0.500 Z-14.6218 F3000
+G1 X38.540 Y0.500 Z-14.5703 F3000
+G1 X38.520 Y0.500 Z-14.5192 F3000
+G1 X38.500 Y0.500 Z-14.4686 F3000
+G1 X38.480 Y0.500 Z-14.4183 F3000
+G1 X38.460 Y0.500 Z-14.3684 F3000
+G1 X38.440 Y0.500 Z-14.3189 F3000
+G1 X38.420 Y0.500 Z-14.2698 F3000
+G1 X38.400 Y0.500 Z-14.2211 F3000
+G1 X38.380 Y0.500 Z-14.1727 F3000
+G1 X38.360 Y0.500 Z-14.1247 F3000
+G1 X38.340 Y0.500 Z-14.0770 F3000
+G1 X38.320 Y0.500 Z-14.0297 F3000
+G1 X38.300 Y0.500 Z-13.9827 F3000
+G1 X38.280 Y0.500 Z-13.9361 F3000
+G1 X38.260 Y0.500 Z-13.8897 F3000
+G1 X38.240 Y0.500 Z-13.8437 F3000
+G1 X38.220 Y0.500 Z-13.7980 F3000
+G1 X38.200 Y0.500 Z-13.7526 F3000
+G1 X38.180 Y0.500 Z-13.7076 F3000
+G1 X38.160 Y0.500 Z-13.6628 F3000
+G1 X38.140 Y0.500 Z-13.6183 F3000
+G1 X38.120 Y0.500 Z-13.5741 F3000
+G1 X38.100 Y0.500 Z-13.5302 F3000
+G1 X38.080 Y0.500 Z-13.4865 F3000
+G1 X38.060 Y0.500 Z-13.4432 F3000
+G1 X38.040 Y0.500 Z-13.4001 F3000
+G1 X38.020 Y0.500 Z-13.3573 F3000
+G1 X38.000 Y0.500 Z-13.3147 F3000
+G1 X37.980 Y0.500 Z-13.2724 F3000
+G1 X37.960 Y0.500 Z-13.2304 F3000
+G1 X37.940 Y0.500 Z-13.1886 F3000
+G1 X37.920 Y0.500 Z-13.1470 F3000
+G1 X37.900 Y0.500 Z-13.1057 F3000
+G1 X37.880 Y0.500 Z-13.0647 F3000
+G1 X37.860 Y0.500 Z-13.0239 F3000
+G1 X37.840 Y0.500 Z-12.9833 F3000
+G1 X37.820 Y0.500 Z-12.9429 F3000
+G1 X37.800 Y0.500 Z-12.9028 F3000
+G1 X37.780 Y0.500 Z-12.8629 F3000
+G1 X37.760 Y0.500 Z-12.8232 F3000
+G1 X37.740 Y0.500 Z-12.7838 F3000
+G1 X37.720 Y0.500 Z-12.7445 F3000
+G1 X37.700 Y0.500 Z-12.7055 F3000
+G1 X37.680 Y0.500 Z-12.6667 F3000
+G1 X37.660 Y0.500 Z-12.6281 F3000
+G1 X37.640 Y0.500 Z-12.5897 F3000
+G1 X37.620 Y0.500 Z-12.5515 F3000
+G1 X37.600 Y0.500 Z-12.5135 F3000
+G1 X37.580 Y0.500 Z-12.4756 F3000
+G1 X37.560 Y0.500 Z-12.4380 F3000
+G1 X37.540 Y0.500 Z-12.4006 F3000
+G1 X37.520 Y0.500 Z-12.3634 F3000
+G1 X37.500 Y0.500 Z-12.3264 F3000
+G1 X37.480 Y0.500 Z-12.2895 F3000
+G1 X37.460 Y0.500 Z-12.2528 F3000
+G1 X37.440 Y0.500 Z-12.2163 F3000
+G1 X37.420 Y0.500 Z-12.1800 F3000
+G1 X37.400 Y0.500 Z-12.1439 F3000
+G1 X37.380 Y0.500 Z-12.1080 F3000
+G1 X37.360 Y0.500 Z-12.0722 F3000
+G1 X37.340 Y0.500 Z-12.0366 F3000
+G1 X37.320 Y0.500 Z-12.0011 F3000
+G1 X37.300 Y0.500 Z-11.9659 F3000
+G1 X37.280 Y0.500 Z-11.9308 F3000
+G1 X37.260 Y0.500 Z-11.8958 F3000
+G1 X37.240 Y0.500 Z-11.8611 F3000
+G1 X37.220 Y0.500 Z-11.8265 F3000
+G1 X37.200 Y0.500 Z-11.7920 F3000
+G1 X37.180 Y0.500 Z-11.7577 F3000
+G1 X37.160 Y0.500 Z-11.7236 F3000
+G1 X37.140 Y0.500 Z-11.6896 F3000
+G1 X37.120 Y0.500 Z-11.6558 F3000
+G1 X37.100 Y0.500 Z-11.6221 F3000
+G1 X37.080 Y0.500 Z-11.5886 F3000
+G1 X37.060 Y0.500 Z-11.5552 F3000
+G1 X37.040 Y0.500 Z-11.5219 F3000
+G1 X37.020 Y0.500 Z-11.4889 F3000
+G1 X37.000 Y0.500 Z-11.4559 F3000
+G1 X36.980 Y0.500 Z-11.4231 F3000
+G1 X36.960 Y0.500 Z-11.3905 F3000
+G1 X36.940 Y0.500 Z-11.3580 F3000
+G1 X36.920 Y0.500 Z-11.3256 F3000
+G1 X36.900 Y0.500 Z-11.2933 F3000
+G1 X36.880 Y0.500 Z-11.2612 F3000
+G1 X36.860 Y0.500 Z-11.2293 F3000
+G1 X36.840 Y0.500 Z-11.1974 F3000
+G1 X36.820 Y0.500 Z-11.1657 F3000
+G1 X36.800 Y0.500 Z-11.1342 F3000
+G1 X36.780 Y0.500 Z-11.1027 F3000
+G1 X36.760 Y0.500 Z-11.0714 F3000
+G1 X36.740 Y0.500 Z-11.0402 F3000
+G1 X36.720 Y0.500 Z-11.0092 F3000
+G1 X36.700 Y0.500 Z-10.9783 F3000
+G1 X36.680 Y0.500 Z-10.9475 F3000
+G1 X36.660 Y0.500 Z-10.9168 F3000
+G1 X36.640 Y0.500 Z-10.8862 F3000
+G1 X36.620 Y0.500 Z-10.8558 F3000
+G1 X36.600 Y0.500 Z-10.8255 F3000
+G1 X36.580 Y0.500 Z-10.7953 F3000
+G1 X36.560 Y0.500 Z-10.7652 F3000
+G1 X36.540 Y0.500 Z-10.7353 F3000
+G1 X36.520 Y0.500 Z-10.7054 F3000
+G1 X36.500 Y0.500 Z-10.6757 F3000
+G1 X36.480 Y0.500 Z-10.6461 F3000
+G1 X36.460 Y0.500 Z-10.6166 F3000
+G1 X36.440 Y0.500 Z-10.5872 F3000
+G1 X36.420 Y0.500 Z-10.5580 F3000
+G1 X36.400 Y0.500 Z-10.5288 F3000
+G1 X36.380 Y0.500 Z-10.4998 F3000
+G1 X36.360 Y0.500 Z-10.4708 F3000
+G1 X36.340 Y0.500 Z-10.4420 F3000
+G1 X36.320 Y0.500 Z-10.4133 F3000
+G1 X36.300 Y0.500 Z-10.3847 F3000
+G1 X36.280 Y0.500 Z-10.3562 F3000
+G1 X36.260 Y0.500 Z-10.3278 F3000
+G1 X36.240 Y0.500 Z-10.2995 F3000
+G1 X36.220 Y0.500 Z-10.2713 F3000
+G1 X36.200 Y0.500 Z-10.2432 F3000
+G1 X36.180 Y0.500 Z-10.2152 F3000
+G1 X36.160 Y0.500 Z-10.1873 F3000
+G1 X36.140 Y0.500 Z-10.1595 F3000
+G1 X36.120 Y0.500 Z-10.1319 F3000
+G1 X36.100 Y0.500 Z-10.1043 F3000
+G1 X36.080 Y0.500 Z-10.0768 F3000
+G1 X36.060 Y0.500 Z-10.0494 F3000
+G1 X36.040 Y0.500 Z-10.0221 F3000
+G1 X36.020 Y0.500 Z-9.9949 F3000
+G1 X36.000 Y0.500 Z-9.9678 F3000
+G1 X35.980 Y0.500 Z-9.9408 F3000
+G1 X35.960 Y0.500 Z-9.9139 F3000
+G1 X35.940 Y0.500 Z-9.8871 F3000
+G1 X35.920 Y0.500 Z-9.8604 F3000
+G1 X35.900 Y0.500 Z-9.8338 F3000
+G1 X35.880 Y0.500 Z-9.8073 F3000
+G1 X35.860 Y0.500 Z-9.7808 F3000
+G1 X35.840 Y0.500 Z-9.7545 F3000
+G1 X35.820 Y0.500 Z-9.7282 F3000
+G1 X35.800 Y0.500 Z-9.7021 F3000
+G1 X35.780 Y0.500 Z-9.6760 F3000
+G1 X35.760 Y0.500 Z-9.6500 F3000
+G1 X35.740 Y0.500 Z-9.6241 F3000
+G1 X35.720 Y0.500 Z-9.5983 F3000
+G1 X35.700 Y0.500 Z-9.5726 F3000
+G1 X35.680 Y0.500 Z-9.5469 F3000
+G1 X35.660 Y0.500 Z-9.5214 F3000
+G1 X35.640 Y0.500 Z-9.4959 F3000
+G1 X35.620 Y0.500 Z-9.4705 F3000
+G1 X35.600 Y0.500 Z-9.4452 F3000
+G1 X35.580 Y0.500 Z-9.4200 F3000
+G1 X35.560 Y0.500 Z-9.3949 F3000
+G1 X35.540 Y0.500 Z-9.3699 F3000
+G1 X35.520 Y0.500 Z-9.3449 F3000
+G1 X35.500 Y0.500 Z-9.3200 F3000
+G1 X35.480 Y0.500 Z-9.2952 F3000
+G1 X35.460 Y0.500 Z-9.2705 F3000
+G1 X35.440 Y0.500 Z-9.2459 F3000
+G1 X35.420 Y0.500 Z-9.2213 F3000
+G1 X35.400 Y0.500 Z-9.1968 F3000
+G1 X35.380 Y0.500 Z-9.1724 F3000
+G1 X35.360 Y0.500 Z-9.1481 F3000
+G1 X35.340 Y0.500 Z-9.1239 F3000
+G1 X35.320 Y0.500 Z-9.0997 F3000
+G1 X35.300 Y0.500 Z-9.0756 F3000
+G1 X35.280 Y0.500 Z-9.0516 F3000
+G1 X35.260 Y0.500 Z-9.0277 F3000
+G1 X35.240 Y0.500 Z-9.0038 F3000
+G1 X35.220 Y0.500 Z-8.9800 F3000
+G1 X35.200 Y0.500 Z-8.9563 F3000
+G1 X35.180 Y0.500 Z-8.9327 F3000
+G1 X35.160 Y0.500 Z-8.9091 F3000
+G1 X35.140 Y0.500 Z-8.8857 F3000
+G1 X35.120 Y0.500 Z-8.8622 F3000
+G1 X35.100 Y0.500 Z-8.8389 F3000
+G1 X35.080 Y0.500 Z-8.8156 F3000
+G1 X35.060 Y0.500 Z-8.7924 F3000
+G1 X35.040 Y0.500 Z-8.7693 F3000
+G1 X35.020 Y0.500 Z-8.7463 F3000
+G1 X35.000 Y0.500 Z-8.7233 F3000
+G1 X34.980 Y0.500 Z-8.7004 F3000
+G1 X34.960 Y0.500 Z-8.6776 F3000
+G1 X34.940 Y0.500 Z-8.6548 F3000
+G1 X34.920 Y0.500 Z-8.6321 F3000
+G1 X34.900 Y0.500 Z-8.6095 F3000
+G1 X34.880 Y0.500 Z-8.5869 F3000
+G1 X34.860 Y0.500 Z-8.5644 F3000
+G1 X34.840 Y0.500 Z-8.5420 F3000
+G1 X34.820 Y0.500 Z-8.5197 F3000
+G1 X34.800 Y0.500 Z-8.4974 F3000
+G1 X34.780 Y0.500 Z-8.4752 F3000
+G1 X34.760 Y0.500 Z-8.4530 F3000
+G1 X34.740 Y0.500 Z-8.4309 F3000
+G1 X34.720 Y0.500 Z-8.4089 F3000
+G1 X34.700 Y0.500 Z-8.3869 F3000
+G1 X34.680 Y0.500 Z-8.3651 F3000
+G1 X34.660 Y0.500 Z-8.3432 F3000
+G1 X34.640 Y0.500 Z-8.3215 F3000
+G1 X34.620 Y0.500 Z-8.2998 F3000
+G1 X34.600 Y0.500 Z-8.2782 F3000
+G1 X34.580 Y0.500 Z-8.2566 F3000
+G1 X34.560 Y0.500 Z-8.2351 F3000
+G1 X34.540 Y0.500 Z-8.2137 F3000
+G1 X34.520 Y0.500 Z-8.1923 F3000
+G1 X34.500 Y0.500 Z-8.1710 F3000
+G1 X34.480 Y0.500 Z-8.1497 F3000
+G1 X34.460 Y0.500 Z-8.1286 F3000
+G1 X34.440 Y0.500 Z-8.1074 F3000
+G1 X34.420 Y0.500 Z-8.0864 F3000
+G1 X34.400 Y0.500 Z-8.0654 F3000
+G1 X34.380 Y0.500 Z-8.0444 F3000
+G1 X34.360 Y0.500 Z-8.0236 F3000
+G1 X34.340 Y0.500 Z-8.0027 F3000
+G1 X34.320 Y0.500 Z-7.9820 F3000
+G1 X34.300 Y0.500 Z-7.9613 F3000
+G1 X34.280 Y0.500 Z-7.9406 F3000
+G1 X34.260 Y0.500 Z-7.9201 F3000
+G1 X34.240 Y0.500 Z-7.8996 F3000
+G1 X34.220 Y0.500 Z-7.8791 F3000
+G1 X34.200 Y0.500 Z-7.8587 F3000
+G1 X34.180 Y0.500 Z-7.8384 F3000
+G1 X34.160 Y0.500 Z-7.8181 F3000
+G1 X34.140 Y0.500 Z-7.7978 F3000
+G1 X34.120 Y0.500 Z-7.7777 F3000
+G1 X34.100 Y0.500 Z-7.7576 F3000
+G1 X34.080 Y0.500 Z-7.7375 F3000
+G1 X34.060 Y0.500 Z-7.7175 F3000
+G1 X34.040 Y0.500 Z-7.6976 F3000
+G1 X34.020 Y0.500 Z-7.6777 F3000
+G1 X34.000 Y0.500 Z-7.6579 F3000
+G1 X33.980 Y0.500 Z-7.6381 F3000
+G1 X33.960 Y0.500 Z-7.6184 F3000
+G1 X33.940 Y0.500 Z-7.5987 F3000
+G1 X33.920 Y0.500 Z-7.5791 F3000
+G1 X33.900 Y0.500 Z-7.5596 F3000
+G1 X33.880 Y0.500 Z-7.5401 F3000
+G1 X33.860 Y0.500 Z-7.5206 F3000
+G1 X33.840 Y0.500 Z-7.5012 F3000
+G1 X33.820 Y0.500 Z-7.4819 F3000
+G1 X33.800 Y0.500 Z-7.4626 F3000
+G1 X33.780 Y0.500 Z-7.4434 F3000
+G1 X33.760 Y0.500 Z-7.4242 F3000
+G1 X33.740 Y0.500 Z-7.4051 F3000
+G1 X33.720 Y0.500 Z-7.3861 F3000
+G1 X33.700 Y0.500 Z-7.3671 F3000
+G1 X33.680 Y0.500 Z-7.3481 F3000
+G1 X33.660 Y0.500 Z-7.3292 F3000
+G1 X33.640 Y0.500 Z-7.3103 F3000
+G1 X33.620 Y0.500 Z-7.2915 F3000
+G1 X33.600 Y0.500 Z-7.2728 F3000
+G1 X33.580 Y0.500 Z-7.2541 F3000
+G1 X33.560 Y0.500 Z-7.2354 F3000
+G1 X33.540 Y0.500 Z-7.2168 F3000
+G1 X33.520 Y0.500 Z-7.1983 F3000
+G1 X33.500 Y0.500 Z-7.1798 F3000
+G1 X33.480 Y0.500 Z-7.1614 F3000
+G1 X33.460 Y0.500 Z-7.1430 F3000
+G1 X33.440 Y0.500 Z-7.1246 F3000
+G1 X33.420 Y0.500 Z-7.1063 F3000
+G1 X33.400 Y0.500 Z-7.0881 F3000
+G1 X33.380 Y0.500 Z-7.0699 F3000
+G1 X33.360 Y0.500 Z-7.0518 F3000
+G1 X33.340 Y0.500 Z-7.0337 F3000
+G1 X33.320 Y0.500 Z-7.0156 F3000
+G1 X33.300 Y0.500 Z-6.9976 F3000
+G1 X33.280 Y0.500 Z-6.9797 F3000
+G1 X33.260 Y0.500 Z-6.9618 F3000
+G1 X33.240 Y0.500 Z-6.9439 F3000
+G1 X33.220 Y0.500 Z-6.9261 F3000
+G1 X33.200 Y0.500 Z-6.9084 F3000
+G1 X33.180 Y0.500 Z-6.8907 F3000
+G1 X33.160 Y0.500 Z-6.8730 F3000
+G1 X33.140 Y0.500 Z-6.8554 F3000
+G1 X33.120 Y0.500 Z-6.8379 F3000
+G1 X33.100 Y0.500 Z-6.8203 F3000
+G1 X33.080 Y0.500 Z-6.8029 F3000
+G1 X33.060 Y0.500 Z-6.7855 F3000
+G1 X33.040 Y0.500 Z-6.7681 F3000
+G1 X33.020 Y0.500 Z-6.7508 F3000
+G1 X33.000 Y0.500 Z-6.7335 F3000
+G1 X32.980 Y0.500 Z-6.7162 F3000
+G1 X32.960 Y0.500 Z-6.6991 F3000
+G1 X32.940 Y0.500 Z-6.6819 F3000
+G1 X32.920 Y0.500 Z-6.6648 F3000
+G1 X32.900 Y0.500 Z-6.6478 F3000
+G1 X32.880 Y0.500 Z-6.6308 F3000
+G1 X32.860 Y0.500 Z-6.6138 F3000
+G1 X32.840 Y0.500 Z-6.5969 F3000
+G1 X32.820 Y0.500 Z-6.5800 F3000
+G1 X32.800 Y0.500 Z-6.5632 F3000
+G1 X32.780 Y0.500 Z-6.5464 F3000
+G1 X32.760 Y0.500 Z-6.5297 F3000
+G1 X32.740 Y0.500 Z-6.5130 F3000
+G1 X32.720 Y0.500 Z-6.4964 F3000
+G1 X32.700 Y0.500 Z-6.4798 F3000
+G1 X32.680 Y0.500 Z-6.4632 F3000
+G1 X32.660 Y0.500 Z-6.4467 F3000
+G1 X32.640 Y0.500 Z-6.4302 F3000
+G1 X32.620 Y0.500 Z-6.4138 F3000
+G1 X32.600 Y0.500 Z-6.3974 F3000
+G1 X32.580 Y0.500 Z-6.3811 F3000
+G1 X32.560 Y0.500 Z-6.3648 F3000
+G1 X32.540 Y0.500 Z-6.3485 F3000
+G1 X32.520 Y0.500 Z-6.3323 F3000
+G1 X32.500 Y0.500 Z-6.3161 F3000
+G1 X32.480 Y0.500 Z-6.3000 F3000
+G1 X32.460 Y0.500 Z-6.2839 F3000
+G1 X32.440 Y0.500 Z-6.2679 F3000
+G1 X32.420 Y0.500 Z-6.2519 F3000
+G1 X32.400 Y0.500 Z-6.2359 F3000
+G1 X32.380 Y0.500 Z-6.2200 F3000
+G1 X32.360 Y0.500 Z-6.2042 F3000
+G1 X32.340 Y0.500 Z-6.1883 F3000
+G1 X32.320 Y0.500 Z-6.1725 F3000
+G1 X32.300 Y0.500 Z-6.1568 F3000
+G1 X32.280 Y0.500 Z-6.1411 F3000
+G1 X32.260 Y0.500 Z-6.1254 F3000
+G1 X32.240 Y0.500 Z-6.1098 F3000
+G1 X32.220 Y0.500 Z-6.0942 F3000
+G1 X32.200 Y0.500 Z-6.0787 F3000
+G1 X32.180 Y0.500 Z-6.0632 F3000
+G1 X32.160 Y0.500 Z-6.0477 F3000
+G1 X32.140 Y0.500 Z-6.0323 F3000
+G1 X32.120 Y0.500 Z-6.0169 F3000
+G1 X32.100 Y0.500 Z-6.0016 F3000
+G1 X32.080 Y0.500 Z-5.9863 F3000
+G1 X32.060 Y0.500 Z-5.9710 F3000
+G1 X32.040 Y0.500 Z-5.9558 F3000
+G1 X32.020 Y0.500 Z-5.9406 F3000
+G1 X32.000 Y0.500 Z-5.9255 F3000
+G1 X31.980 Y0.500 Z-5.9104 F3000
+G1 X31.960 Y0.500 Z-5.8953 F3000
+G1 X31.940 Y0.500 Z-5.8803 F3000
+G1 X31.920 Y0.500 Z-5.8653 F3000
+G1 X31.900 Y0.500 Z-5.8504 F3000
+G1 X31.880 Y0.500 Z-5.8355 F3000
+G1 X31.860 Y0.500 Z-5.8206 F3000
+G1 X31.840 Y0.500 Z-5.8058 F3000
+G1 X31.820 Y0.500 Z-5.7910 F3000
+G1 X31.800 Y0.500 Z-5.7763 F3000
+G1 X31.780 Y0.500 Z-5.7616 F3000
+G1 X31.760 Y0.500 Z-5.7469 F3000
+G1 X31.740 Y0.500 Z-5.7323 F3000
+G1 X31.720 Y0.500 Z-5.7177 F3000
+G1 X31.700 Y0.500 Z-5.7031 F3000
+G1 X31.680 Y0.500 Z-5.6886 F3000
+G1 X31.660 Y0.500 Z-5.6741 F3000
+G1 X31.640 Y0.500 Z-5.6597 F3000
+G1 X31.620 Y0.500 Z-5.6453 F3000
+G1 X31.600 Y0.500 Z-5.6309 F3000
+G1 X31.580 Y0.500 Z-5.6166 F3000
+G1 X31.560 Y0.500 Z-5.6023 F3000
+G1 X31.540 Y0.500 Z-5.5880 F3000
+G1 X31.520 Y0.500 Z-5.5738 F3000
+G1 X31.500 Y0.500 Z-5.5596 F3000
+G1 X31.480 Y0.500 Z-5.5455 F3000
+G1 X31.460 Y0.500 Z-5.5314 F3000
+G1 X31.440 Y0.500 Z-5.5173 F3000
+G1 X31.420 Y0.500 Z-5.5033 F3000
+G1 X31.400 Y0.500 Z-5.4893 F3000
+G1 X31.380 Y0.500 Z-5.4753 F3000
+G1 X31.360 Y0.500 Z-5.4614 F3000
+G1 X31.340 Y0.500 Z-5.4475 F3000
+G1 X31.320 Y0.500 Z-5.4336 F3000
+G1 X31.300 Y0.500 Z-5.4198 F3000
+G1 X31.280 Y0.500 Z-5.4060 F3000
+G1 X31.260 Y0.500 Z-5.3923 F3000
+G1 X31.240 Y0.500 Z-5.3786 F3000
+G1 X31.220 Y0.500 Z-5.3649 F3000
+G1 X31.200 Y0.500 Z-5.3513 F3000
+G1 X31.180 Y0.500 Z-5.3377 F3000
+G1 X31.160 Y0.500 Z-5.3241 F3000
+G1 X31.140 Y0.500 Z-5.3106 F3000
+G1 X31.120 Y0.500 Z-5.2971 F3000
+G1 X31.100 Y0.500 Z-5.2836 F3000
+G1 X31.080 Y0.500 Z-5.2702 F3000
+G1 X31.060 Y0.500 Z-5.2568 F3000
+G1 X31.040 Y0.500 Z-5.2435 F3000
+G1 X31.020 Y0.500 Z-5.2302 F3000
+G1 X31.000 Y0.500 Z-5.2169 F3000
+G1 X30.980 Y0.500 Z-5.2036 F3000
+G1 X30.960 Y0.500 Z-5.1904 F3000
+G1 X30.940 Y0.500 Z-5.1772 F3000
+G1 X30.920 Y0.500 Z-5.1641 F3000
+G1 X30.900 Y0.500 Z-5.1510 F3000
+G1 X30.880 Y0.500 Z-5.1379 F3000
+G1 X30.860 Y0.500 Z-5.1249 F3000
+G1 X30.840 Y0.500 Z-5.1118 F3000
+G1 X30.820 Y0.500 Z-5.0989 F3000
+G1 X30.800 Y0.500 Z-5.0859 F3000
+G1 X30.780 Y0.500 Z-5.0730 F3000
+G1 X30.760 Y0.500 Z-5.0602 F3000
+G1 X30.740 Y0.500 Z-5.0473 F3000
+G1 X30.720 Y0.500 Z-5.0345 F3000
+G1 X30.700 Y0.500 Z-5.0217 F3000
+G1 X30.680 Y0.500 Z-5.0090 F3000
+G1 X30.660 Y0.500 Z-4.9963 F3000
+G1 X30.640 Y0.500 Z-4.9836 F3000
+G1 X30.620 Y0.500 Z-4.9710 F3000
+G1 X30.600 Y0.500 Z-4.9584 F3000
+G1 X30.580 Y0.500 Z-4.9458 F3000
+G1 X30.560 Y0.500 Z-4.9333 F3000
+G1 X30.540 Y0.500 Z-4.9208 F3000
+G1 X30.520 Y0.500 Z-4.9083 F3000
+G1 X30.500 Y0.500 Z-4.8959 F3000
+G1 X30.480 Y0.500 Z-4.8835 F3000
+G1 X30.460 Y0.500 Z-4.8711 F3000
+G1 X30.440 Y0.500 Z-4.8587 F3000
+G1 X30.420 Y0.500 Z-4.8464 F3000
+G1 X30.400 Y0.500 Z-4.8342 F3000
+G1 X30.380 Y0.500 Z-4.8219 F3000
+G1 X30.360 Y0.500 Z-4.8097 F3000
+G1 X30.340 Y0.500 Z-4.7975 F3000
+G1 X30.320 Y0.500 Z-4.7854 F3000
+G1 X30.300 Y0.500 Z-4.7733 F3000
+G1 X30.280 Y0.500 Z-4.7612 F3000
+G1 X30.260 Y0.500 Z-4.7491 F3000
+G1 X30.240 Y0.500 Z-4.7371 F3000
+G1 X30.220 Y0.500 Z-4.7251 F3000
+G1 X30.200 Y0.500 Z-4.7132 F3000
+G1 X30.180 Y0.500 Z-4.7012 F3000
+G1 X30.160 Y0.500 Z-4.6893 F3000
+G1 X30.140 Y0.500 Z-4.6775 F3000
+G1 X30.120 Y0.500 Z-4.6657 F3000
+G1 X30.100 Y0.500 Z-4.6539 F3000
+G1 X30.080 Y0.500 Z-4.6421 F3000
+G1 X30.060 Y0.500 Z-4.6304 F3000
+G1 X30.040 Y0.500 Z-4.6187 F3000
+G1 X30.020 Y0.500 Z-4.6070 F3000
+G1 X30.000 Y0.500 Z-4.5953 F3000
+G1 X29.980 Y0.500 Z-4.5837 F3000
+G1 X29.960 Y0.500 Z-4.5722 F3000
+G1 X29.940 Y0.500 Z-4.5606 F3000
+G1 X29.920 Y0.500 Z-4.5491 F3000
+G1 X29.900 Y0.500 Z-4.5376 F3000
+G1 X29.880 Y0.500 Z-4.5262 F3000
+G1 X29.860 Y0.500 Z-4.5147 F3000
+G1 X29.840 Y0.500 Z-4.5033 F3000
+G1 X29.820 Y0.500 Z-4.4920 F3000
+G1 X29.800 Y0.500 Z-4.4806 F3000
+G1 X29.780 Y0.500 Z-4.4693 F3000
+G1 X29.760 Y0.500 Z-4.4581 F3000
+G1 X29.740 Y0.500 Z-4.4468 F3000
+G1 X29.720 Y0.500 Z-4.4356 F3000
+G1 X29.700 Y0.500 Z-4.4244 F3000
+G1 X29.680 Y0.500 Z-4.4133 F3000
+G1 X29.660 Y0.500 Z-4.4022 F3000
+G1 X29.640 Y0.500 Z-4.3911 F3000
+G1 X29.620 Y0.500 Z-4.3800 F3000
+G1 X29.600 Y0.500 Z-4.3690 F3000
+G1 X29.580 Y0.500 Z-4.3580 F3000
+G1 X29.560 Y0.500 Z-4.3470 F3000
+G1 X29.540 Y0.500 Z-4.3361 F3000
+G1 X29.520 Y0.500 Z-4.3252 F3000
+G1 X29.500 Y0.500 Z-4.3143 F3000
+G1 X29.480 Y0.500 Z-4.3034 F3000
+G1 X29.460 Y0.500 Z-4.2926 F3000
+G1 X29.440 Y0.500 Z-4.2818 F3000
+G1 X29.420 Y0.500 Z-4.2711 F3000
+G1 X29.400 Y0.500 Z-4.2603 F3000
+G1 X29.380 Y0.500 Z-4.2496 F3000
+G1 X29.360 Y0.500 Z-4.2390 F3000
+G1 X29.340 Y0.500 Z-4.2283 F3000
+G1 X29.320 Y0.500 Z-4.2177 F3000
+G1 X29.300 Y0.500 Z-4.2071 F3000
+G1 X29.280 Y0.500 Z-4.1965 F3000
+G1 X29.260 Y0.500 Z-4.1860 F3000
+G1 X29.240 Y0.500 Z-4.1755 F3000
+G1 X29.220 Y0.500 Z-4.1650 F3000
+G1 X29.200 Y0.500 Z-4.1546 F3000
+G1 X29.180 Y0.500 Z-4.1442 F3000
+G1 X29.160 Y0.500 Z-4.1338 F3000
+G1 X29.140 Y0.500 Z-4.1235 F3000
+G1 X29.120 Y0.500 Z-4.1131 F3000
+G1 X29.100 Y0.500 Z-4.1028 F3000
+G1 X29.080 Y0.500 Z-4.0926 F3000
+G1 X29.060 Y0.500 Z-4.0823 F3000
+G1 X29.040 Y0.500 Z-4.0721 F3000
+G1 X29.020 Y0.500 Z-4.0619 F3000
+G1 X29.000 Y0.500 Z-4.0518 F3000
+G1 X28.980 Y0.500 Z-4.0416 F3000
+G1 X28.960 Y0.500 Z-4.0315 F3000
+G1 X28.940 Y0.500 Z-4.0215 F3000
+G1 X28.920 Y0.500 Z-4.0114 F3000
+G1 X28.900 Y0.500 Z-4.0014 F3000
+G1 X28.880 Y0.500 Z-3.9914 F3000
+G1 X28.860 Y0.500 Z-3.9815 F3000
+G1 X28.840 Y0.500 Z-3.9715 F3000
+G1 X28.820 Y0.500 Z-3.9616 F3000
+G1 X28.800 Y0.500 Z-3.9518 F3000
+G1 X28.780 Y0.500 Z-3.9419 F3000
+G1 X28.760 Y0.500 Z-3.9321 F3000
+G1 X28.740 Y0.500 Z-3.9223 F3000
+G1 X28.720 Y0.500 Z-3.9125 F3000
+G1 X28.700 Y0.500 Z-3.9028 F3000
+G1 X28.680 Y0.500 Z-3.8931 F3000
+G1 X28.660 Y0.500 Z-3.8834 F3000
+G1 X28.640 Y0.500 Z-3.8738 F3000
+G1 X28.620 Y0.500 Z-3.8641 F3000
+G1 X28.600 Y0.500 Z-3.8545 F3000
+G1 X28.580 Y0.500 Z-3.8450 F3000
+G1 X28.560 Y0.500 Z-3.8354 F3000
+G1 X28.540 Y0.500 Z-3.8259 F3000
+G1 X28.520 Y0.500 Z-3.8164 F3000
+G1 X28.500 Y0.500 Z-3.8069 F3000
+G1 X28.480 Y0.500 Z-3.7975 F3000
+G1 X28.460 Y0.500 Z-3.7881 F3000
+G1 X28.440 Y0.500 Z-3.7787 F3000
+G1 X28.420 Y0.500 Z-3.7694 F3000
+G1 X28.400 Y0.500 Z-3.7600 F3000
+G1 X28.380 Y0.500 Z-3.7507 F3000
+G1 X28.360 Y0.500 Z-3.7415 F3000
+G1 X28.340 Y0.500 Z-3.7322 F3000
+G1 X28.320 Y0.500 Z-3.7230 F3000
+G1 X28.300 Y0.500 Z-3.7138 F3000
+G1 X28.280 Y0.500 Z-3.7047 F3000
+G1 X28.260 Y0.500 Z-3.6955 F3000
+G1 X28.240 Y0.500 Z-3.6864 F3000
+G1 X28.220 Y0.500 Z-3.6773 F3000
+G1 X28.200 Y0.500 Z-3.6683 F3000
+G1 X28.180 Y0.500 Z-3.6592 F3000
+G1 X28.160 Y0.500 Z-3.6502 F3000
+G1 X28.140 Y0.500 Z-3.6412 F3000
+G1 X28.120 Y0.500 Z-3.6323 F3000
+G1 X28.100 Y0.500 Z-3.6234 F3000
+G1 X28.080 Y0.500 Z-3.6145 F3000
+G1 X28.060 Y0.500 Z-3.6056 F3000
+G1 X28.040 Y0.500 Z-3.5967 F3000
+G1 X28.020 Y0.500 Z-3.5879 F3000
+G1 X28.000 Y0.500 Z-3.5791 F3000
+G1 X27.980 Y0.500 Z-3.5704 F3000
+G1 X27.960 Y0.500 Z-3.5616 F3000
+G1 X27.940 Y0.500 Z-3.5529 F3000
+G1 X27.920 Y0.500 Z-3.5442 F3000
+G1 X27.900 Y0.500 Z-3.5356 F3000
+G1 X27.880 Y0.500 Z-3.5269 F3000
+G1 X27.860 Y0.500 Z-3.5183 F3000
+G1 X27.840 Y0.500 Z-3.5097 F3000
+G1 X27.820 Y0.500 Z-3.5012 F3000
+G1 X27.800 Y0.500 Z-3.4926 F3000
+G1 X27.780 Y0.500 Z-3.4841 F3000
+G1 X27.760 Y0.500 Z-3.4756 F3000
+G1 X27.740 Y0.500 Z-3.4672 F3000
+G1 X27.720 Y0.500 Z-3.4587 F3000
+G1 X27.700 Y0.500 Z-3.4503 F3000
+G1 X27.680 Y0.500 Z-3.4420 F3000
+G1 X27.660 Y0.500 Z-3.4336 F3000
+G1 X27.640 Y0.500 Z-3.4253 F3000
+G1 X27.620 Y0.500 Z-3.4170 F3000
+G1 X27.600 Y0.500 Z-3.4087 F3000
+G1 X27.580 Y0.500 Z-3.4004 F3000
+G1 X27.560 Y0.500 Z-3.3922 F3000
+G1 X27.540 Y0.500 Z-3.3840 F3000
+G1 X27.520 Y0.500 Z-3.3758 F3000
+G1 X27.500 Y0.500 Z-3.3677 F3000
+G1 X27.480 Y0.500 Z-3.3596 F3000
+G1 X27.460 Y0.500 Z-3.3515 F3000
+G1 X27.440 Y0.500 Z-3.3434 F3000
+G1 X27.420 Y0.500 Z-3.3353 F3000
+G1 X27.400 Y0.500 Z-3.3273 F3000
+G1 X27.380 Y0.500 Z-3.3193 F3000
+G1 X27.360 Y0.500 Z-3.3113 F3000
+G1 X27.340 Y0.500 Z-3.3034 F3000
+G1 X27.320 Y0.500 Z-3.2955 F3000
+G1 X27.300 Y0.500 Z-3.2876 F3000
+G1 X27.280 Y0.500 Z-3.2797 F3000
+G1 X27.260 Y0.500 Z-3.2718 F3000
+G1 X27.240 Y0.500 Z-3.2640 F3000
+G1 X27.220 Y0.500 Z-3.2562 F3000
+G1 X27.200 Y0.500 Z-3.2485 F3000
+G1 X27.180 Y0.500 Z-3.2407 F3000
+G1 X27.160 Y0.500 Z-3.2330 F3000
+G1 X27.140 Y0.500 Z-3.2253 F3000
+G1 X27.120 Y0.500 Z-3.2176 F3000
+G1 X27.100 Y0.500 Z-3.2099 F3000
+G1 X27.080 Y0.500 Z-3.2023 F3000
+G1 X27.060 Y0.500 Z-3.1947 F3000
+G1 X27.040 Y0.500 Z-3.1871 F3000
+G1 X27.020 Y0.500 Z-3.1796 F3000
+G1 X27.000 Y0.500 Z-3.1721 F3000
+G1 X26.980 Y0.500 Z-3.1646 F3000
+G1 X26.960 Y0.500 Z-3.1571 F3000
+G1 X26.940 Y0.500 Z-3.1496 F3000
+G1 X26.920 Y0.500 Z-3.1422 F3000
+G1 X26.900 Y0.500 Z-3.1348 F3000
+G1 X26.880 Y0.500 Z-3.1274 F3000
+G1 X26.860 Y0.500 Z-3.1201 F3000
+G1 X26.840 Y0.500 Z-3.1127 F3000
+G1 X26.820 Y0.500 Z-3.1054 F3000
+G1 X26.800 Y0.500 Z-3.0981 F3000
+G1 X26.780 Y0.500 Z-3.0909 F3000
+G1 X26.760 Y0.500 Z-3.0836 F3000
+G1 X26.740 Y0.500 Z-3.0764 F3000
+G1 X26.720 Y0.500 Z-3.0692 F3000
+G1 X26.700 Y0.500 Z-3.0621 F3000
+G1 X26.680 Y0.500 Z-3.0549 F3000
+G1 X26.660 Y0.500 Z-3.0478 F3000
+G1 X26.640 Y0.500 Z-3.0407 F3000
+G1 X26.620 Y0.500 Z-3.0337 F3000
+G1 X26.600 Y0.500 Z-3.0266 F3000
+G1 X26.580 Y0.500 Z-3.0196 F3000
+G1 X26.560 Y0.500 Z-3.0126 F3000
+G1 X26.540 Y0.500 Z-3.0056 F3000
+G1 X26.520 Y0.500 Z-2.9987 F3000
+G1 X26.500 Y0.500 Z-2.9918 F3000
+G1 X26.480 Y0.500 Z-2.9849 F3000
+G1 X26.460 Y0.500 Z-2.9780 F3000
+G1 X26.440 Y0.500 Z-2.9711 F3000
+G1 X26.420 Y0.500 Z-2.9643 F3000
+G1 X26.400 Y0.500 Z-2.9575 F3000
+G1 X26.380 Y0.500 Z-2.9507 F3000
+G1 X26.360 Y0.500 Z-2.9440 F3000
+G1 X26.340 Y0.500 Z-2.9372 F3000
+G1 X26.320 Y0.500 Z-2.9305 F3000
+G1 X26.300 Y0.500 Z-2.9238 F3000
+G1 X26.280 Y0.500 Z-2.9172 F3000
+G1 X26.260 Y0.500 Z-2.9105 F3000
+G1 X26.240 Y0.500 Z-2.9039 F3000
+G1 X26.220 Y0.500 Z-2.8973 F3000
+G1 X26.200 Y0.500 Z-2.8907 F3000
+G1 X26.180 Y0.500 Z-2.8842 F3000
+G1 X26.160 Y0.500 Z-2.8777 F3000
+G1 X26.140 Y0.500 Z-2.8712 F3000
+G1 X26.120 Y0.500 Z-2.8647 F3000
+G1 X26.100 Y0.500 Z-2.8582 F3000
+G1 X26.080 Y0.500 Z-2.8518 F3000
+G1 X26.060 Y0.500 Z-2.8454 F3000
+G1 X26.040 Y0.500 Z-2.8390 F3000
+G1 X26.020 Y0.500 Z-2.8327 F3000
+G1 X26.000 Y0.500 Z-2.8263 F3000
+G1 X25.980 Y0.500 Z-2.8200 F3000
+G1 X25.960 Y0.500 Z-2.8137 F3000
+G1 X25.940 Y0.500 Z-2.8075 F3000
+G1 X25.920 Y0.500 Z-2.8012 F3000
+G1 X25.900 Y0.500 Z-2.7950 F3000
+G1 X25.880 Y0.500 Z-2.7888 F3000
+G1 X25.860 Y0.500 Z-2.7826 F3000
+G1 X25.840 Y0.500 Z-2.7765 F3000
+G1 X25.820 Y0.500 Z-2.7703 F3000
+G1 X25.800 Y0.500 Z-2.7642 F3000
+G1 X25.780 Y0.500 Z-2.7582 F3000
+G1 X25.760 Y0.500 Z-2.7521 F3000
+G1 X25.740 Y0.500 Z-2.7461 F3000
+G1 X25.720 Y0.500 Z-2.7401 F3000
+G1 X25.700 Y0.500 Z-2.7341 F3000
+G1 X25.680 Y0.500 Z-2.7281 F3000
+G1 X25.660 Y0.500 Z-2.7221 F3000
+G1 X25.640 Y0.500 Z-2.7162 F3000
+G1 X25.620 Y0.500 Z-2.7103 F3000
+G1 X25.600 Y0.500 Z-2.7045 F3000
+G1 X25.580 Y0.500 Z-2.6986 F3000
+G1 X25.560 Y0.500 Z-2.6928 F3000
+G1 X25.540 Y0.500 Z-2.6870 F3000
+G1 X25.520 Y0.500 Z-2.6812 F3000
+G1 X25.500 Y0.500 Z-2.6754 F3000
+G1 X25.480 Y0.500 Z-2.6697 F3000
+G1 X25.460 Y0.500 Z-2.6640 F3000
+G1 X25.440 Y0.500 Z-2.6583 F3000
+G1 X25.420 Y0.500 Z-2.6526 F3000
+G1 X25.400 Y0.500 Z-2.6469 F3000
+G1 X25.380 Y0.500 Z-2.6413 F3000
+G1 X25.360 Y0.500 Z-2.6357 F3000
+G1 X25.340 Y0.500 Z-2.6301 F3000
+G1 X25.320 Y0.500 Z-2.6246 F3000
+G1 X25.300 Y0.500 Z-2.6190 F3000
+G1 X25.280 Y0.500 Z-2.6135 F3000
+G1 X25.260 Y0.500 Z-2.6080 F3000
+G1 X25.240 Y0.500 Z-2.6025 F3000
+G1 X25.220 Y0.500 Z-2.5971 F3000
+G1 X25.200 Y0.500 Z-2.5917 F3000
+G1 X25.180 Y0.500 Z-2.5863 F3000
+G1 X25.160 Y0.500 Z-2.5809 F3000
+G1 X25.140 Y0.500 Z-2.5755 F3000
+G1 X25.120 Y0.500 Z-2.5702 F3000
+G1 X25.100 Y0.500 Z-2.5649 F3000
+G1 X25.080 Y0.500 Z-2.5596 F3000
+G1 X25.060 Y0.500 Z-2.5543 F3000
+G1 X25.040 Y0.500 Z-2.5491 F3000
+G1 X25.020 Y0.500 Z-2.5438 F3000
+G1 X25.000 Y0.500 Z-2.5386 F3000
+G1 X24.980 Y0.500 Z-2.5335 F3000
+G1 X24.960 Y0.500 Z-2.5283 F3000
+G1 X24.940 Y0.500 Z-2.5232 F3000
+G1 X24.920 Y0.500 Z-2.5180 F3000
+G1 X24.900 Y0.500 Z-2.5130 F3000
+G1 X24.880 Y0.500 Z-2.5079 F3000
+G1 X24.860 Y0.500 Z-2.5028 F3000
+G1 X24.840 Y0.500 Z-2.4978 F3000
+G1 X24.820 Y0.500 Z-2.4928 F3000
+G1 X24.800 Y0.500 Z-2.4878 F3000
+G1 X24.780 Y0.500 Z-2.4829 F3000
+G1 X24.760 Y0.500 Z-2.4779 F3000
+G1 X24.740 Y0.500 Z-2.4730 F3000
+G1 X24.720 Y0.500 Z-2.4681 F3000
+G1 X24.700 Y0.500 Z-2.4632 F3000
+G1 X24.680 Y0.500 Z-2.4584 F3000
+G1 X24.660 Y0.500 Z-2.4536 F3000
+G1 X24.640 Y0.500 Z-2.4488 F3000
+G1 X24.620 Y0.500 Z-2.4440 F3000
+G1 X24.600 Y0.500 Z-2.4392 F3000
+G1 X24.580 Y0.500 Z-2.4345 F3000
+G1 X24.560 Y0.500 Z-2.4298 F3000
+G1 X24.540 Y0.500 Z-2.4251 F3000
+G1 X24.520 Y0.500 Z-2.4204 F3000
+G1 X24.500 Y0.500 Z-2.4157 F3000
+G1 X24.480 Y0.500 Z-2.4111 F3000
+G1 X24.460 Y0.500 Z-2.4065 F3000
+G1 X24.440 Y0.500 Z-2.4019 F3000
+G1 X24.420 Y0.500 Z-2.3973 F3000
+G1 X24.400 Y0.500 Z-2.3928 F3000
+G1 X24.380 Y0.500 Z-2.3883 F3000
+G1 X24.360 Y0.500 Z-2.3838 F3000
+G1 X24.340 Y0.500 Z-2.3793 F3000
+G1 X24.320 Y0.500 Z-2.3748 F3000
+G1 X24.300 Y0.500 Z-2.3704 F3000
+G1 X24.280 Y0.500 Z-2.3660 F3000
+G1 X24.260 Y0.500 Z-2.3616 F3000
+G1 X24.240 Y0.500 Z-2.3572 F3000
+G1 X24.220 Y0.500 Z-2.3529 F3000
+G1 X24.200 Y0.500 Z-2.3485 F3000
+G1 X24.180 Y0.500 Z-2.3442 F3000
+G1 X24.160 Y0.500 Z-2.3399 F3000
+G1 X24.140 Y0.500 Z-2.3357 F3000
+G1 X24.120 Y0.500 Z-2.3314 F3000
+G1 X24.100 Y0.500 Z-2.3272 F3000
+G1 X24.080 Y0.500 Z-2.3230 F3000
+G1 X24.060 Y0.500 Z-2.3188 F3000
+G1 X24.040 Y0.500 Z-2.3147 F3000
+G1 X24.020 Y0.500 Z-2.3105 F3000
+G1 X24.000 Y0.500 Z-2.3064 F3000
+G1 X23.980 Y0.500 Z-2.3023 F3000
+G1 X23.960 Y0.500 Z-2.2982 F3000
+G1 X23.940 Y0.500 Z-2.2942 F3000
+G1 X23.920 Y0.500 Z-2.2902 F3000
+G1 X23.900 Y0.500 Z-2.2862 F3000
+G1 X23.880 Y0.500 Z-2.2822 F3000
+G1 X23.860 Y0.500 Z-2.2782 F3000
+G1 X23.840 Y0.500 Z-2.2743 F3000
+G1 X23.820 Y0.500 Z-2.2703 F3000
+G1 X23.800 Y0.500 Z-2.2664 F3000
+G1 X23.780 Y0.500 Z-2.2626 F3000
+G1 X23.760 Y0.500 Z-2.2587 F3000
+G1 X23.740 Y0.500 Z-2.2549 F3000
+G1 X23.720 Y0.500 Z-2.2510 F3000
+G1 X23.700 Y0.500 Z-2.2473 F3000
+G1 X23.680 Y0.500 Z-2.2435 F3000
+G1 X23.660 Y0.500 Z-2.2397 F3000
+G1 X23.640 Y0.500 Z-2.2360 F3000
+G1 X23.620 Y0.500 Z-2.2323 F3000
+G1 X23.600 Y0.500 Z-2.2286 F3000
+G1 X23.580 Y0.500 Z-2.2249 F3000
+G1 X23.560 Y0.500 Z-2.2213 F3000
+G1 X23.540 Y0.500 Z-2.2177 F3000
+G1 X23.520 Y0.500 Z-2.2140 F3000
+G1 X23.500 Y0.500 Z-2.2105 F3000
+G1 X23.480 Y0.500 Z-2.2069 F3000
+G1 X23.460 Y0.500 Z-2.2034 F3000
+G1 X23.440 Y0.500 Z-2.1998 F3000
+G1 X23.420 Y0.500 Z-2.1963 F3000
+G1 X23.400 Y0.500 Z-2.1929 F3000
+G1 X23.380 Y0.500 Z-2.1894 F3000
+G1 X23.360 Y0.500 Z-2.1860 F3000
+G1 X23.340 Y0.500 Z-2.1825 F3000
+G1 X23.320 Y0.500 Z-2.1792 F3000
+G1 X23.300 Y0.500 Z-2.1758 F3000
+G1 X23.280 Y0.500 Z-2.1724 F3000
+G1 X23.260 Y0.500 Z-2.1691 F3000
+G1 X23.240 Y0.500 Z-2.1658 F3000
+G1 X23.220 Y0.500 Z-2.1625 F3000
+G1 X23.200 Y0.500 Z-2.1592 F3000
+G1 X23.180 Y0.500 Z-2.1560 F3000
+G1 X23.160 Y0.500 Z-2.1528 F3000
+G1 X23.140 Y0.500 Z-2.1495 F3000
+G1 X23.120 Y0.500 Z-2.1464 F3000
+G1 X23.100 Y0.500 Z-2.1432 F3000
+G1 X23.080 Y0.500 Z-2.1401 F3000
+G1 X23.060 Y0.500 Z-2.1369 F3000
+G1 X23.040 Y0.500 Z-2.1338 F3000
+G1 X23.020 Y0.500 Z-2.1307 F3000
+G1 X23.000 Y0.500 Z-2.1277 F3000
+G1 X22.980 Y0.500 Z-2.1246 F3000
+G1 X22.960 Y0.500 Z-2.1216 F3000
+G1 X22.940 Y0.500 Z-2.1186 F3000
+G1 X22.920 Y0.500 Z-2.1157 F3000
+G1 X22.900 Y0.500 Z-2.1127 F3000
+G1 X22.880 Y0.500 Z-2.1098 F3000
+G1 X22.860 Y0.500 Z-2.1068 F3000
+G1 X22.840 Y0.500 Z-2.1039 F3000
+G1 X22.820 Y0.500 Z-2.1011 F3000
+G1 X22.800 Y0.500 Z-2.0982 F3000
+G1 X22.780 Y0.500 Z-2.0954 F3000
+G1 X22.760 Y0.500 Z-2.0926 F3000
+G1 X22.740 Y0.500 Z-2.0898 F3000
+G1 X22.720 Y0.500 Z-2.0870 F3000
+G1 X22.700 Y0.500 Z-2.0843 F3000
+G1 X22.680 Y0.500 Z-2.0815 F3000
+G1 X22.660 Y0.500 Z-2.0788 F3000
+G1 X22.640 Y0.500 Z-2.0761 F3000
+G1 X22.620 Y0.500 Z-2.0735 F3000
+G1 X22.600 Y0.500 Z-2.0708 F3000
+G1 X22.580 Y0.500 Z-2.0682 F3000
+G1 X22.560 Y0.500 Z-2.0656 F3000
+G1 X22.540 Y0.500 Z-2.0630 F3000
+G1 X22.520 Y0.500 Z-2.0605 F3000
+G1 X22.500 Y0.500 Z-2.0579 F3000
+G1 X22.480 Y0.500 Z-2.0554 F3000
+G1 X22.460 Y0.500 Z-2.0529 F3000
+G1 X22.440 Y0.500 Z-2.0504 F3000
+G1 X22.420 Y0.500 Z-2.0479 F3000
+G1 X22.400 Y0.500 Z-2.0455 F3000
+G1 X22.380 Y0.500 Z-2.0431 F3000
+G1 X22.360 Y0.500 Z-2.0407 F3000
+G1 X22.340 Y0.500 Z-2.0383 F3000
+G1 X22.320 Y0.500 Z-2.0360 F3000
+G1 X22.300 Y0.500 Z-2.0336 F3000
+G1 X22.280 Y0.500 Z-2.0313 F3000
+G1 X22.260 Y0.500 Z-2.0290 F3000
+G1 X22.240 Y0.500 Z-2.0267 F3000
+G1 X22.220 Y0.500 Z-2.0245 F3000
+G1 X22.200 Y0.500 Z-2.0222 F3000
+G1 X22.180 Y0.500 Z-2.0200 F3000
+G1 X22.160 Y0.500 Z-2.0178 F3000
+G1 X22.140 Y0.500 Z-2.0157 F3000
+G1 X22.120 Y0.500 Z-2.0135 F3000
+G1 X22.100 Y0.500 Z-2.0114 F3000
+G1 X22.080 Y0.500 Z-2.0093 F3000
+G1 X22.060 Y0.500 Z-2.0072 F3000
+G1 X22.040 Y0.500 Z-2.0051 F3000
+G1 X22.020 Y0.500 Z-2.0030 F3000
+G1 X22.000 Y0.500 Z-2.0010 F3000
+G1 X21.980 Y0.500 Z-1.9990 F3000
+G1 X21.960 Y0.500 Z-1.9970 F3000
+G1 X21.940 Y0.500 Z-1.9950 F3000
+G1 X21.920 Y0.500 Z-1.9931 F3000
+G1 X21.900 Y0.500 Z-1.9912 F3000
+G1 X21.880 Y0.500 Z-1.9893 F3000
+G1 X21.860 Y0.500 Z-1.9874 F3000
+G1 X21.840 Y0.500 Z-1.9855 F3000
+G1 X21.820 Y0.500 Z-1.9837 F3000
+G1 X21.800 Y0.500 Z-1.9818 F3000
+G1 X21.780 Y0.500 Z-1.9800 F3000
+G1 X21.760 Y0.500 Z-1.9782 F3000
+G1 X21.740 Y0.500 Z-1.9765 F3000
+G1 X21.720 Y0.500 Z-1.9747 F3000
+G1 X21.700 Y0.500 Z-1.9730 F3000
+G1 X21.680 Y0.500 Z-1.9713 F3000
+G1 X21.660 Y0.500 Z-1.9696 F3000
+G1 X21.640 Y0.500 Z-1.9679 F3000
+G1 X21.620 Y0.500 Z-1.9663 F3000
+G1 X21.600 Y0.500 Z-1.9647 F3000
+G1 X21.580 Y0.500 Z-1.9631 F3000
+G1 X21.560 Y0.500 Z-1.9615 F3000
+G1 X21.540 Y0.500 Z-1.9599 F3000
+G1 X21.520 Y0.500 Z-1.9584 F3000
+G1 X21.500 Y0.500 Z-1.9569 F3000
+G1 X21.480 Y0.500 Z-1.9554 F3000
+G1 X21.460 Y0.500 Z-1.9539 F3000
+G1 X21.440 Y0.500 Z-1.9524 F3000
+G1 X21.420 Y0.500 Z-1.9510 F3000
+G1 X21.400 Y0.500 Z-1.9496 F3000
+G1 X21.380 Y0.500 Z-1.9482 F3000
+G1 X21.360 Y0.500 Z-1.9468 F3000
+G1 X21.340 Y0.500 Z-1.9454 F3000
+G1 X21.320 Y0.500 Z-1.9441 F3000
+G1 X21.300 Y0.500 Z-1.9428 F3000
+G1 X21.280 Y0.500 Z-1.9415 F3000
+G1 X21.260 Y0.500 Z-1.9402 F3000
+G1 X21.240 Y0.500 Z-1.9389 F3000
+G1 X21.220 Y0.500 Z-1.9377 F3000
+G1 X21.200 Y0.500 Z-1.9365 F3000
+G1 X21.180 Y0.500 Z-1.9353 F3000
+G1 X21.160 Y0.500 Z-1.9341 F3000
+G1 X21.140 Y0.500 Z-1.9329 F3000
+G1 X21.120 Y0.500 Z-1.9318 F3000
+G1 X21.100 Y0.500 Z-1.9307 F3000
+G1 X21.080 Y0.500 Z-1.9296 F3000
+G1 X21.060 Y0.500 Z-1.9285 F3000
+G1 X21.040 Y0.500 Z-1.9274 F3000
+G1 X21.020 Y0.500 Z-1.9264 F3000
+G1 X21.000 Y0.500 Z-1.9254 F3000
+G1 X20.980 Y0.500 Z-1.9244 F3000
+G1 X20.960 Y0.500 Z-1.9234 F3000
+G1 X20.940 Y0.500 Z-1.9225 F3000
+G1 X20.920 Y0.500 Z-1.9215 F3000
+G1 X20.900 Y0.500 Z-1.9206 F3000
+G1 X20.880 Y0.500 Z-1.9197 F3000
+G1 X20.860 Y0.500 Z-1.9188 F3000
+G1 X20.840 Y0.500 Z-1.9180 F3000
+G1 X20.820 Y0.500 Z-1.9172 F3000
+G1 X20.800 Y0.500 Z-1.9163 F3000
+G1 X20.780 Y0.500 Z-1.9155 F3000
+G1 X20.760 Y0.500 Z-1.9148 F3000
+G1 X20.740 Y0.500 Z-1.9140 F3000
+G1 X20.720 Y0.500 Z-1.9133 F3000
+G1 X20.700 Y0.500 Z-1.9126 F3000
+G1 X20.680 Y0.500 Z-1.9119 F3000
+G1 X20.660 Y0.500 Z-1.9112 F3000
+G1 X20.640 Y0.500 Z-1.9105 F3000
+G1 X20.620 Y0.500 Z-1.9099 F3000
+G1 X20.600 Y0.500 Z-1.9093 F3000
+G1 X20.580 Y0.500 Z-1.9087 F3000
+G1 X20.560 Y0.500 Z-1.9081 F3000
+G1 X20.540 Y0.500 Z-1.9076 F3000
+G1 X20.520 Y0.500 Z-1.9070 F3000
+G1 X20.500 Y0.500 Z-1.9065 F3000
+G1 X20.480 Y0.500 Z-1.9060 F3000
+G1 X20.460 Y0.500 Z-1.9056 F3000
+G1 X20.440 Y0.500 Z-1.9051 F3000
+G1 X20.420 Y0.500 Z-1.9047 F3000
+G1 X20.400 Y0.500 Z-1.9043 F3000
+G1 X20.380 Y0.500 Z-1.9039 F3000
+G1 X20.360 Y0.500 Z-1.9035 F3000
+G1 X20.340 Y0.500 Z-1.9032 F3000
+G1 X20.320 Y0.500 Z-1.9028 F3000
+G1 X20.300 Y0.500 Z-1.9025 F3000
+G1 X20.280 Y0.500 Z-1.9022 F3000
+G1 X20.260 Y0.500 Z-1.9019 F3000
+G1 X20.240 Y0.500 Z-1.9017 F3000
+G1 X20.220 Y0.500 Z-1.9015 F3000
+G1 X20.200 Y0.500 Z-1.9013 F3000
+G1 X20.180 Y0.500 Z-1.9011 F3000
+G1 X20.160 Y0.500 Z-1.9009 F3000
+G1 X20.140 Y0.500 Z-1.9007 F3000
+G1 X20.120 Y0.500 Z-1.9006 F3000
+G1 X20.100 Y0.500 Z-1.9005 F3000
+G1 X20.080 Y0.500 Z-1.9004 F3000
+G1 X20.060 Y0.500 Z-1.9003 F3000
+G1 X20.040 Y0.500 Z-1.9003 F3000
+G1 X20.020 Y0.500 Z-1.9003 F3000
+G1 X20.000 Y0.500 Z-1.9003 F3000
+G1 X19.980 Y0.500 Z-1.9003 F3000
+G1 X19.960 Y0.500 Z-1.9003 F3000
+G1 X19.940 Y0.500 Z-1.9003 F3000
+G1 X19.920 Y0.500 Z-1.9004 F3000
+G1 X19.900 Y0.500 Z-1.9005 F3000
+G1 X19.880 Y0.500 Z-1.9006 F3000
+G1 X19.860 Y0.500 Z-1.9007 F3000
+G1 X19.840 Y0.500 Z-1.9009 F3000
+G1 X19.820 Y0.500 Z-1.9011 F3000
+G1 X19.800 Y0.500 Z-1.9013 F3000
+G1 X19.780 Y0.500 Z-1.9015 F3000
+G1 X19.760 Y0.500 Z-1.9017 F3000
+G1 X19.740 Y0.500 Z-1.9019 F3000
+G1 X19.720 Y0.500 Z-1.9022 F3000
+G1 X19.700 Y0.500 Z-1.9025 F3000
+G1 X19.680 Y0.500 Z-1.9028 F3000
+G1 X19.660 Y0.500 Z-1.9032 F3000
+G1 X19.640 Y0.500 Z-1.9035 F3000
+G1 X19.620 Y0.500 Z-1.9039 F3000
+G1 X19.600 Y0.500 Z-1.9043 F3000
+G1 X19.580 Y0.500 Z-1.9047 F3000
+G1 X19.560 Y0.500 Z-1.9051 F3000
+G1 X19.540 Y0.500 Z-1.9056 F3000
+G1 X19.520 Y0.500 Z-1.9060 F3000
+G1 X19.500 Y0.500 Z-1.9065 F3000
+G1 X19.480 Y0.500 Z-1.9070 F3000
+G1 X19.460 Y0.500 Z-1.9076 F3000
+G1 X19.440 Y0.500 Z-1.9081 F3000
+G1 X19.420 Y0.500 Z-1.9087 F3000
+G1 X19.400 Y0.500 Z-1.9093 F3000
+G1 X19.380 Y0.500 Z-1.9099 F3000
+G1 X19.360 Y0.500 Z-1.9105 F3000
+G1 X19.340 Y0.500 Z-1.9112 F3000
+G1 X19.320 Y0.500 Z-1.9119 F3000
+G1 X19.300 Y0.500 Z-1.9126 F3000
+G1 X19.280 Y0.500 Z-1.9133 F3000
+G1 X19.260 Y0.500 Z-1.9140 F3000
+G1 X19.240 Y0.500 Z-1.9148 F3000
+G1 X19.220 Y0.500 Z-1.9155 F3000
+G1 X19.200 Y0.500 Z-1.9163 F3000
+G1 X19.180 Y0.500 Z-1.9172 F3000
+G1 X19.160 Y0.500 Z-1.9180 F3000
+G1 X19.140 Y0.500 Z-1.9188 F3000
+G1 X19.120 Y0.500 Z-1.9197 F3000
+G1 X19.100 Y0.500 Z-1.9206 F3000
+G1 X19.080 Y0.500 Z-1.9215 F3000
+G1 X19.060 Y0.500 Z-1.9225 F3000
+G1 X19.040 Y0.500 Z-1.9234 F3000
+G1 X19.020 Y0.500 Z-1.9244 F3000
+G1 X19.000 Y0.500 Z-1.9254 F3000
+G1 X18.980 Y0.500 Z-1.9264 F3000
+G1 X18.960 Y0.500 Z-1.9274 F3000
+G1 X18.940 Y0.500 Z-1.9285 F3000
+G1 X18.920 Y0.500 Z-1.9296 F3000
+G1 X18.900 Y0.500 Z-1.9307 F3000
+G1 X18.880 Y0.500 Z-1.9318 F3000
+G1 X18.860 Y0.500 Z-1.9329 F3000
+G1 X18.840 Y0.500 Z-1.9341 F3000
+G1 X18.820 Y0.500 Z-1.9353 F3000
+G1 X18.800 Y0.500 Z-1.9365 F3000
+G1 X18.780 Y0.500 Z-1.9377 F3000
+G1 X18.760 Y0.500 Z-1.9389 F3000
+G1 X18.740 Y0.500 Z-1.9402 F3000
+G1 X18.720 Y0.500 Z-1.9415 F3000
+G1 X18.700 Y0.500 Z-1.9428 F3000
+G1 X18.680 Y0.500 Z-1.9441 F3000
+G1 X18.660 Y0.500 Z-1.9454 F3000
+G1 X18.640 Y0.500 Z-1.9468 F3000
+G1 X18.620 Y0.500 Z-1.9482 F3000
+G1 X18.600 Y0.500 Z-1.9496 F3000
+G1 X18.580 Y0.500 Z-1.9510 F3000
+G1 X18.560 Y0.500 Z-1.9524 F3000
+G1 X18.540 Y0.500 Z-1.9539 F3000
+G1 X18.520 Y0.500 Z-1.9554 F3000
+G1 X18.500 Y0.500 Z-1.9569 F3000
+G1 X18.480 Y0.500 Z-1.9584 F3000
+G1 X18.460 Y0.500 Z-1.9599 F3000
+G1 X18.440 Y0.500 Z-1.9615 F3000
+G1 X18.420 Y0.500 Z-1.9631 F3000
+G1 X18.400 Y0.500 Z-1.9647 F3000
+G1 X18.380 Y0.500 Z-1.9663 F3000
+G1 X18.360 Y0.500 Z-1.9679 F3000
+G1 X18.340 Y0.500 Z-1.9696 F3000
+G1 X18.320 Y0.500 Z-1.9713 F3000
+G1 X18.300 Y0.500 Z-1.9730 F3000
+G1 X18.280 Y0.500 Z-1.9747 F3000
+G1 X18.260 Y0.500 Z-1.9765 F3000
+G1 X18.240 Y0.500 Z-1.9782 F3000
+G1 X18.220 Y0.500 Z-1.9800 F3000
+G1 X18.200 Y0.500 Z-1.9818 F3000
+G1 X18.180 Y0.500 Z-1.9837 F3000
+G1 X18.160 Y0.500 Z-1.9855 F3000
+G1 X18.140 Y0.500 Z-1.9874 F3000
+G1 X18.120 Y0.500 Z-1.9893 F3000
+G1 X18.100 Y0.500 Z-1.9912 F3000
+G1 X18.080 Y0.500 Z-1.9931 F3000
+G1 X18.060 Y0.500 Z-1.9950 F3000
+G1 X18.040 Y0.500 Z-1.9970 F3000
+G1 X18.020 Y0.500 Z-1.9990 F3000
+G1 X18.000 Y0.500 Z-2.0010 F3000
+G1 X17.980 Y0.500 Z-2.0030 F3000
+G1 X17.960 Y0.500 Z-2.0051 F3000
+G1 X17.940 Y0.500 Z-2.0072 F3000
+G1 X17.920 Y0.500 Z-2.0093 F3000
+G1 X17.900 Y0.500 Z-2.0114 F3000
+G1 X17.880 Y0.500 Z-2.0135 F3000
+G1 X17.860 Y0.500 Z-2.0157 F3000
+G1 X17.840 Y0.500 Z-2.0178 F3000
+G1 X17.820 Y0.500 Z-2.0200 F3000
+G1 X17.800 Y0.500 Z-2.0222 F3000
+G1 X17.780 Y0.500 Z-2.0245 F3000
+G1 X17.760 Y0.500 Z-2.0267 F3000
+G1 X17.740 Y0.500 Z-2.0290 F3000
+G1 X17.720 Y0.500 Z-2.0313 F3000
+G1 X17.700 Y0.500 Z-2.0336 F3000
+G1 X17.680 Y0.500 Z-2.0360 F3000
+G1 X17.660 Y0.500 Z-2.0383 F3000
+G1 X17.640 Y0.500 Z-2.0407 F3000
+G1 X17.620 Y0.500 Z-2.0431 F3000
+G1 X17.600 Y0.500 Z-2.0455 F3000
+G1 X17.580 Y0.500 Z-2.0479 F3000
+G1 X17.560 Y0.500 Z-2.0504 F3000
+G1 X17.540 Y0.500 Z-2.0529 F3000
+G1 X17.520 Y0.500 Z-2.0554 F3000
+G1 X17.500 Y0.500 Z-2.0579 F3000
+G1 X17.480 Y0.500 Z-2.0605 F3000
+G1 X17.460 Y0.500 Z-2.0630 F3000
+G1 X17.440 Y0.500 Z-2.0656 F3000
+G1 X17.420 Y0.500 Z-2.0682 F3000
+G1 X17.400 Y0.500 Z-2.0708 F3000
+G1 X17.380 Y0.500 Z-2.0735 F3000
+G1 X17.360 Y0.500 Z-2.0761 F3000
+G1 X17.340 Y0.500 Z-2.0788 F3000
+G1 X17.320 Y0.500 Z-2.0815 F3000
+G1 X17.300 Y0.500 Z-2.0843 F3000
+G1 X17.280 Y0.500 Z-2.0870 F3000
+G1 X17.260 Y0.500 Z-2.0898 F3000
+G1 X17.240 Y0.500 Z-2.0926 F3000
+G1 X17.220 Y0.500 Z-2.0954 F3000
+G1 X17.200 Y0.500 Z-2.0982 F3000
+G1 X17.180 Y0.500 Z-2.1011 F3000
+G1 X17.160 Y0.500 Z-2.1039 F3000
+G1 X17.140 Y0.500 Z-2.1068 F3000
+G1 X17.120 Y0.500 Z-2.1098 F3000
+G1 X17.100 Y0.500 Z-2.1127 F3000
+G1 X17.080 Y0.500 Z-2.1157 F3000
+G1 X17.060 Y0.500 Z-2.1186 F3000
+G1 X17.040 Y0.500 Z-2.1216 F3000
+G1 X17.020 Y0.500 Z-2.1246 F3000
+G1 X17.000 Y0.500 Z-2.1277 F3000
+G1 X16.980 Y0.500 Z-2.1307 F3000
+G1 X16.960 Y0.500 Z-2.1338 F3000
+G1 X16.940 Y0.500 Z-2.1369 F3000
+G1 X16.920 Y0.500 Z-2.1401 F3000
+G1 X16.900 Y0.500 Z-2.1432 F3000
+G1 X16.880 Y0.500 Z-2.1464 F3000
+G1 X16.860 Y0.500 Z-2.1495 F3000
+G1 X16.840 Y0.500 Z-2.1528 F3000
+G1 X16.820 Y0.500 Z-2.1560 F3000
+G1 X16.800 Y0.500 Z-2.1592 F3000
+G1 X16.780 Y0.500 Z-2.1625 F3000
+G1 X16.760 Y0.500 Z-2.1658 F3000
+G1 X16.740 Y0.500 Z-2.1691 F3000
+G1 X16.720 Y0.500 Z-2.1724 F3000
+G1 X16.700 Y0.500 Z-2.1758 F3000
+G1 X16.680 Y0.500 Z-2.1792 F3000
+G1 X16.660 Y0.500 Z-2.1825 F3000
+G1 X16.640 Y0.500 Z-2.1860 F3000
+G1 X16.620 Y0.500 Z-2.1894 F3000
+G1 X16.600 Y0.500 Z-2.1929 F3000
+G1 X16.580 Y0.500 Z-2.1963 F3000
+G1 X16.560 Y0.500 Z-2.1998 F3000
+G1 X16.540 Y0.500 Z-2.2034 F3000
+G1 X16.520 Y0.500 Z-2.2069 F3000
+G1 X16.500 Y0.500 Z-2.2105 F3000
+G1 X16.480 Y0.500 Z-2.2140 F3000
+G1 X16.460 Y0.500 Z-2.2177 F3000
+G1 X16.440 Y0.500 Z-2.2213 F3000
+G1 X16.420 Y0.500 Z-2.2249 F3000
+G1 X16.400 Y0.500 Z-2.2286 F3000
+G1 X16.380 Y0.500 Z-2.2323 F3000
+G1 X16.360 Y0.500 Z-2.2360 F3000
+G1 X16.340 Y0.500 Z-2.2397 F3000
+G1 X16.320 Y0.500 Z-2.2435 F3000
+G1 X16.300 Y0.500 Z-2.2473 F3000
+G1 X16.280 Y0.500 Z-2.2510 F3000
+G1 X16.260 Y0.500 Z-2.2549 F3000
+G1 X16.240 Y0.500 Z-2.2587 F3000
+G1 X16.220 Y0.500 Z-2.2626 F3000
+G1 X16.200 Y0.500 Z-2.2664 F3000
+G1 X16.180 Y0.500 Z-2.2703 F3000
+G1 X16.160 Y0.500 Z-2.2743 F3000
+G1 X16.140 Y0.500 Z-2.2782 F3000
+G1 X16.120 Y0.500 Z-2.2822 F3000
+G1 X16.100 Y0.500 Z-2.2862 F3000
+G1 X16.080 Y0.500 Z-2.2902 F3000
+G1 X16.060 Y0.500 Z-2.2942 F3000
+G1 X16.040 Y0.500 Z-2.2982 F3000
+G1 X16.020 Y0.500 Z-2.3023 F3000
+G1 X16.000 Y0.500 Z-2.3064 F3000
+G1 X15.980 Y0.500 Z-2.3105 F3000
+G1 X15.960 Y0.500 Z-2.3147 F3000
+G1 X15.940 Y0.500 Z-2.3188 F3000
+G1 X15.920 Y0.500 Z-2.3230 F3000
+G1 X15.900 Y0.500 Z-2.3272 F3000
+G1 X15.880 Y0.500 Z-2.3314 F3000
+G1 X15.860 Y0.500 Z-2.3357 F3000
+G1 X15.840 Y0.500 Z-2.3399 F3000
+G1 X15.820 Y0.500 Z-2.3442 F3000
+G1 X15.800 Y0.500 Z-2.3485 F3000
+G1 X15.780 Y0.500 Z-2.3529 F3000
+G1 X15.760 Y0.500 Z-2.3572 F3000
+G1 X15.740 Y0.500 Z-2.3616 F3000
+G1 X15.720 Y0.500 Z-2.3660 F3000
+G1 X15.700 Y0.500 Z-2.3704 F3000
+G1 X15.680 Y0.500 Z-2.3748 F3000
+G1 X15.660 Y0.500 Z-2.3793 F3000
+G1 X15.640 Y0.500 Z-2.3838 F3000
+G1 X15.620 Y0.500 Z-2.3883 F3000
+G1 X15.600 Y0.500 Z-2.3928 F3000
+G1 X15.580 Y0.500 Z-2.3973 F3000
+G1 X15.560 Y0.500 Z-2.4019 F3000
+G1 X15.540 Y0.500 Z-2.4065 F3000
+G1 X15.520 Y0.500 Z-2.4111 F3000
+G1 X15.500 Y0.500 Z-2.4157 F3000
+G1 X15.480 Y0.500 Z-2.4204 F3000
+G1 X15.460 Y0.500 Z-2.4251 F3000
+G1 X15.440 Y0.500 Z-2.4298 F3000
+G1 X15.420 Y0.500 Z-2.4345 F3000
+G1 X15.400 Y0.500 Z-2.4392 F3000
+G1 X15.380 Y0.500 Z-2.4440 F3000
+G1 X15.360 Y0.500 Z-2.4488 F3000
+G1 X15.340 Y0.500 Z-2.4536 F3000
+G1 X15.320 Y0.500 Z-2.4584 F3000
+G1 X15.300 Y0.500 Z-2.4632 F3000
+G1 X15.280 Y0.500 Z-2.4681 F3000
+G1 X15.260 Y0.500 Z-2.4730 F3000
+G1 X15.240 Y0.500 Z-2.4779 F3000
+G1 X15.220 Y0.500 Z-2.4829 F3000
+G1 X15.200 Y0.500 Z-2.4878 F3000
+G1 X15.180 Y0.500 Z-2.4928 F3000
+G1 X15.160 Y0.500 Z-2.4978 F3000
+G1 X15.140 Y0.500 Z-2.5028 F3000
+G1 X15.120 Y0.500 Z-2.5079 F3000
+G1 X15.100 Y0.500 Z-2.5130 F3000
+G1 X15.080 Y0.500 Z-2.5180 F3000
+G1 X15.060 Y0.500 Z-2.5232 F3000
+G1 X15.040 Y0.500 Z-2.5283 F3000
+G1 X15.020 Y0.500 Z-2.5335 F3000
+G1 X15.000 Y0.500 Z-2.5386 F3000
+G1 X14.980 Y0.500 Z-2.5438 F3000
+G1 X14.960 Y0.500 Z-2.5491 F3000
+G1 X14.940 Y0.500 Z-2.5543 F3000
+G1 X14.920 Y0.500 Z-2.5596 F3000
+G1 X14.900 Y0.500 Z-2.5649 F3000
+G1 X14.880 Y0.500 Z-2.5702 F3000
+G1 X14.860 Y0.500 Z-2.5755 F3000
+G1 X14.840 Y0.500 Z-2.5809 F3000
+G1 X14.820 Y0.500 Z-2.5863 F3000
+G1 X14.800 Y0.500 Z-2.5917 F3000
+G1 X14.780 Y0.500 Z-2.5971 F3000
+G1 X14.760 Y0.500 Z-2.6025 F3000
+G1 X14.740 Y0.500 Z-2.6080 F3000
+G1 X14.720 Y0.500 Z-2.6135 F3000
+G1 X14.700 Y0.500 Z-2.6190 F3000
+G1 X14.680 Y0.500 Z-2.6246 F3000
+G1 X14.660 Y0.500 Z-2.6301 F3000
+G1 X14.640 Y0.500 Z-2.6357 F3000
+G1 X14.620 Y0.500 Z-2.6413 F3000
+G1 X14.600 Y0.500 Z-2.6469 F3000
+G1 X14.580 Y0.500 Z-2.6526 F3000
+G1 X14.560 Y0.500 Z-2.6583 F3000
+G1 X14.540 Y0.500 Z-2.6640 F3000
+G1 X14.520 Y0.500 Z-2.6697 F3000
+G1 X14.500 Y0.500 Z-2.6754 F3000
+G1 X14.480 Y0.500 Z-2.6812 F3000
+G1 X14.460 Y0.500 Z-2.6870 F3000
+G1 X14.440 Y0.500 Z-2.6928 F3000
+G1 X14.420 Y0.500 Z-2.6986 F3000
+G1 X14.400 Y0.500 Z-2.7045 F3000
+G1 X14.380 Y0.500 Z-2.7103 F3000
+G1 X14.360 Y0.500 Z-2.7162 F3000
+G1 X14.340 Y0.500 Z-2.7221 F3000
+G1 X14.320 Y0.500 Z-2.7281 F3000
+G1 X14.300 Y0.500 Z-2.7341 F3000
+G1 X14.280 Y0.500 Z-2.7401 F3000
+G1 X14.260 Y0.500 Z-2.7461 F3000
+G1 X14.240 Y0.500 Z-2.7521 F3000
+G1 X14.220 Y0.500 Z-2.7582 F3000
+G1 X14.200 Y0.500 Z-2.7642 F3000
+G1 X14.180 Y0.500 Z-2.7703 F3000
+G1 X14.160 Y0.500 Z-2.7765 F3000
+G1 X14.140 Y0.500 Z-2.7826 F3000
+G1 X14.120 Y0.500 Z-2.7888 F3000
+G1 X14.100 Y0.500 Z-2.7950 F3000
+G1 X14.080 Y0.500 Z-2.8012 F3000
+G1 X14.060 Y0.500 Z-2.8075 F3000
+G1 X14.040 Y0.500 Z-2.8137 F3000
+G1 X14.020 Y0.500 Z-2.8200 F3000
+G1 X14.000 Y0.500 Z-2.8263 F3000
+G1 X13.980 Y0.500 Z-2.8327 F3000
+G1 X13.960 Y0.500 Z-2.8390 F3000
+G1 X13.940 Y0.500 Z-2.8454 F3000
+G1 X13.920 Y0.500 Z-2.8518 F3000
+G1 X13.900 Y0.500 Z-2.8582 F3000
+G1 X13.880 Y0.500 Z-2.8647 F3000
+G1 X13.860 Y0.500 Z-2.8712 F3000
+G1 X13.840 Y0.500 Z-2.8777 F3000
+G1 X13.820 Y0.500 Z-2.8842 F3000
+G1 X13.800 Y0.500 Z-2.8907 F3000
+G1 X13.780 Y0.500 Z-2.8973 F3000
+G1 X13.760 Y0.500 Z-2.9039 F3000
+G1 X13.740 Y0.500 Z-2.9105 F3000
+G1 X13.720 Y0.500 Z-2.9172 F3000
+G1 X13.700 Y0.500 Z-2.9238 F3000
+G1 X13.680 Y0.500 Z-2.9305 F3000
+G1 X13.660 Y0.500 Z-2.9372 F3000
+G1 X13.640 Y0.500 Z-2.9440 F3000
+G1 X13.620 Y0.500 Z-2.9507 F3000
+G1 X13.600 Y0.500 Z-2.9575 F3000
+G1 X13.580 Y0.500 Z-2.9643 F3000
+G1 X13.560 Y0.500 Z-2.9711 F3000
+G1 X13.540 Y0.500 Z-2.9780 F3000
+G1 X13.520 Y0.500 Z-2.9849 F3000
+G1 X13.500 Y0.500 Z-2.9918 F3000
+G1 X13.480 Y0.500 Z-2.9987 F3000
+G1 X13.460 Y0.500 Z-3.0056 F3000
+G1 X13.440 Y0.500 Z-3.0126 F3000
+G1 X13.420 Y0.500 Z-3.0196 F3000
+G1 X13.400 Y0.500 Z-3.0266 F3000
+G1 X13.380 Y0.500 Z-3.0337 F3000
+G1 X13.360 Y0.500 Z-3.0407 F3000
+G1 X13.340 Y0.500 Z-3.0478 F3000
+G1 X13.320 Y0.500 Z-3.0549 F3000
+G1 X13.300 Y0.500 Z-3.0621 F3000
+G1 X13.280 Y0.500 Z-3.0692 F3000
+G1 X13.260 Y0.500 Z-3.0764 F3000
+G1 X13.240 Y0.500 Z-3.0836 F3000
+G1 X13.220 Y0.500 Z-3.0909 F3000
+G1 X13.200 Y0.500 Z-3.0981 F3000
+G1 X13.180 Y0.500 Z-3.1054 F3000
+G1 X13.160 Y0.500 Z-3.1127 F3000
+G1 X13.140 Y0.500 Z-3.1201 F3000
+G1 X13.120 Y0.500 Z-3.1274 F3000
+G1 X13.100 Y0.500 Z-3.1348 F3000
+G1 X13.080 Y0.500 Z-3.1422 F3000
+G1 X13.060 Y0.500 Z-3.1496 F3000
+G1 X13.040 Y0.500 Z-3.1571 F3000
+G1 X13.020 Y0.500 Z-3.1646 F3000
+G1 X13.000 Y0.500 Z-3.1721 F3000
+G1 X12.980 Y0.500 Z-3.1796 F3000
+G1 X12.960 Y0.500 Z-3.1871 F3000
+G1 X12.940 Y0.500 Z-3.1947 F3000
+G1 X12.920 Y0.500 Z-3.2023 F3000
+G1 X12.900 Y0.500 Z-3.2099 F3000
+G1 X12.880 Y0.500 Z-3.2176 F3000
+G1 X12.860 Y0.500 Z-3.2253 F3000
+G1 X12.840 Y0.500 Z-3.2330 F3000
+G1 X12.820 Y0.500 Z-3.2407 F3000
+G1 X12.800 Y0.500 Z-3.2485 F3000
+G1 X12.780 Y0.500 Z-3.2562 F3000
+G1 X12.760 Y0.500 Z-3.2640 F3000
+G1 X12.740 Y0.500 Z-3.2718 F3000
+G1 X12.720 Y0.500 Z-3.2797 F3000
+G1 X12.700 Y0.500 Z-3.2876 F3000
+G1 X12.680 Y0.500 Z-3.2955 F3000
+G1 X12.660 Y0.500 Z-3.3034 F3000
+G1 X12.640 Y0.500 Z-3.3113 F3000
+G1 X12.620 Y0.500 Z-3.3193 F3000
+G1 X12.600 Y0.500 Z-3.3273 F3000
+G1 X12.580 Y0.500 Z-3.3353 F3000
+G1 X12.560 Y0.500 Z-3.3434 F3000
+G1 X12.540 Y0.500 Z-3.3515 F3000
+G1 X12.520 Y0.500 Z-3.3596 F3000
+G1 X12.500 Y0.500 Z-3.3677 F3000
+G1 X12.480 Y0.500 Z-3.3758 F3000
+G1 X12.460 Y0.500 Z-3.3840 F3000
+G1 X12.440 Y0.500 Z-3.3922 F3000
+G1 X12.420 Y0.500 Z-3.4004 F3000
+G1 X12.400 Y0.500 Z-3.4087 F3000
+G1 X12.380 Y0.500 Z-3.4170 F3000
+G1 X12.360 Y0.500 Z-3.4253 F3000
+G1 X12.340 Y0.500 Z-3.4336 F3000
+G1 X12.320 Y0.500 Z-3.4420 F3000
+G1 X12.300 Y0.500 Z-3.4503 F3000
+G1 X12.280 Y0.500 Z-3.4587 F3000
+G1 X12.260 Y0.500 Z-3.4672 F3000
+G1 X12.240 Y0.500 Z-3.4756 F3000
+G1 X12.220 Y0.500 Z-3.4841 F3000
+G1 X12.200 Y0.500 Z-3.4926 F3000
+G1 X12.180 Y0.500 Z-3.5012 F3000
+G1 X12.160 Y0.500 Z-3.5097 F3000
+G1 X12.140 Y0.500 Z-3.5183 F3000
+G1 X12.120 Y0.500 Z-3.5269 F3000
+G1 X12.100 Y0.500 Z-3.5356 F3000
+G1 X12.080 Y0.500 Z-3.5442 F3000
+G1 X12.060 Y0.500 Z-3.5529 F3000
+G1 X12.040 Y0.500 Z-3.5616 F3000
+G1 X12.020 Y0.500 Z-3.5704 F3000
+G1 X12.000 Y0.500 Z-3.5791 F3000
+G1 X11.980 Y0.500 Z-3.5879 F3000
+G1 X11.960 Y0.500 Z-3.5967 F3000
+G1 X11.940 Y0.500 Z-3.6056 F3000
+G1 X11.920 Y0.500 Z-3.6145 F3000
+G1 X11.900 Y0.500 Z-3.6234 F3000
+G1 X11.880 Y0.500 Z-3.6323 F3000
+G1 X11.860 Y0.500 Z-3.6412 F3000
+G1 X11.840 Y0.500 Z-3.6502 F3000
+G1 X11.820 Y0.500 Z-3.6592 F3000
+G1 X11.800 Y0.500 Z-3.6683 F3000
+G1 X11.780 Y0.500 Z-3.6773 F3000
+G1 X11.760 Y0.500 Z-3.6864 F3000
+G1 X11.740 Y0.500 Z-3.6955 F3000
+G1 X11.720 Y0.500 Z-3.7047 F3000
+G1 X11.700 Y0.500 Z-3.7138 F3000
+G1 X11.680 Y0.500 Z-3.7230 F3000
+G1 X11.660 Y0.500 Z-3.7322 F3000
+G1 X11.640 Y0.500 Z-3.7415 F3000
+G1 X11.620 Y0.500 Z-3.7507 F3000
+G1 X11.600 Y0.500 Z-3.7600 F3000
+G1 X11.580 Y0.500 Z-3.7694 F3000
+G1 X11.560 Y0.500 Z-3.7787 F3000
+G1 X11.540 Y0.500 Z-3.7881 F3000
+G1 X11.520 Y0.500 Z-3.7975 F3000
+G1 X11.500 Y0.500 Z-3.8069 F3000
+G1 X11.480 Y0.500 Z-3.8164 F3000
+G1 X11.460 Y0.500 Z-3.8259 F3000
+G1 X11.440 Y0.500 Z-3.8354 F3000
+G1 X11.420 Y0.500 Z-3.8450 F3000
+G1 X11.400 Y0.500 Z-3.8545 F3000
+G1 X11.380 Y0.500 Z-3.8641 F3000
+G1 X11.360 Y0.500 Z-3.8738 F3000
+G1 X11.340 Y0.500 Z-3.8834 F3000
+G1 X11.320 Y0.500 Z-3.8931 F3000
+G1 X11.300 Y0.500 Z-3.9028 F3000
+G1 X11.280 Y0.500 Z-3.9125 F3000
+G1 X11.260 Y0.500 Z-3.9223 F3000
+G1 X11.240 Y0.500 Z-3.9321 F3000
+G1 X11.220 Y0.500 Z-3.9419 F3000
+G1 X11.200 Y0.500 Z-3.9518 F3000
+G1 X11.180 Y0.500 Z-3.9616 F3000
+G1 X11.160 Y0.500 Z-3.9715 F3000
+G1 X11.140 Y0.500 Z-3.9815 F3000
+G1 X11.120 Y0.500 Z-3.9914 F3000
+G1 X11.100 Y0.500 Z-4.0014 F3000
+G1 X11.080 Y0.500 Z-4.0114 F3000
+G1 X11.060 Y0.500 Z-4.0215 F3000
+G1 X11.040 Y0.500 Z-4.0315 F3000
+G1 X11.020 Y0.500 Z-4.0416 F3000
+G1 X11.000 Y0.500 Z-4.0518 F3000
+G1 X10.980 Y0.500 Z-4.0619 F3000
+G1 X10.960 Y0.500 Z-4.0721 F3000
+G1 X10.940 Y0.500 Z-4.0823 F3000
+G1 X10.920 Y0.500 Z-4.0926 F3000
+G1 X10.900 Y0.500 Z-4.1028 F3000
+G1 X10.880 Y0.500 Z-4.1131 F3000
+G1 X10.860 Y0.500 Z-4.1235 F3000
+G1 X10.840 Y0.500 Z-4.1338 F3000
+G1 X10.820 Y0.500 Z-4.1442 F3000
+G1 X10.800 Y0.500 Z-4.1546 F3000
+G1 X10.780 Y0.500 Z-4.1650 F3000
+G1 X10.760 Y0.500 Z-4.1755 F3000
+G1 X10.740 Y0.500 Z-4.1860 F3000
+G1 X10.720 Y0.500 Z-4.1965 F3000
+G1 X10.700 Y0.500 Z-4.2071 F3000
+G1 X10.680 Y0.500 Z-4.2177 F3000
+G1 X10.660 Y0.500 Z-4.2283 F3000
+G1 X10.640 Y0.500 Z-4.2390 F3000
+G1 X10.620 Y0.500 Z-4.2496 F3000
+G1 X10.600 Y0.500 Z-4.2603 F3000
+G1 X10.580 Y0.500 Z-4.2711 F3000
+G1 X10.560 Y0.500 Z-4.2818 F3000
+G1 X10.540 Y0.500 Z-4.2926 F3000
+G1 X10.520 Y0.500 Z-4.3034 F3000
+G1 X10.500 Y0.500 Z-4.3143 F3000
+G1 X10.480 Y0.500 Z-4.3252 F3000
+G1 X10.460 Y0.500 Z-4.3361 F3000
+G1 X10.440 Y0.500 Z-4.3470 F3000
+G1 X10.420 Y0.500 Z-4.3580 F3000
+G1 X10.400 Y0.500 Z-4.3690 F3000
+G1 X10.380 Y0.500 Z-4.3800 F3000
+G1 X10.360 Y0.500 Z-4.3911 F3000
+G1 X10.340 Y0.500 Z-4.4022 F3000
+G1 X10.320 Y0.500 Z-4.4133 F3000
+G1 X10.300 Y0.500 Z-4.4244 F3000
+G1 X10.280 Y0.500 Z-4.4356 F3000
+G1 X10.260 Y0.500 Z-4.4468 F3000
+G1 X10.240 Y0.500 Z-4.4581 F3000
+G1 X10.220 Y0.500 Z-4.4693 F3000
+G1 X10.200 Y0.500 Z-4.4806 F3000
+G1 X10.180 Y0.500 Z-4.4920 F3000
+G1 X10.160 Y0.500 Z-4.5033 F3000
+G1 X10.140 Y0.500 Z-4.5147 F3000
+G1 X10.120 Y0.500 Z-4.5262 F3000
+G1 X10.100 Y0.500 Z-4.5376 F3000
+G1 X10.080 Y0.500 Z-4.5491 F3000
+G1 X10.060 Y0.500 Z-4.5606 F3000
+G1 X10.040 Y0.500 Z-4.5722 F3000
+G1 X10.020 Y0.500 Z-4.5837 F3000
+G1 X10.000 Y0.500 Z-4.5953 F3000
+G1 X9.980 Y0.500 Z-4.6070 F3000
+G1 X9.960 Y0.500 Z-4.6187 F3000
+G1 X9.940 Y0.500 Z-4.6304 F3000
+G1 X9.920 Y0.500 Z-4.6421 F3000
+G1 X9.900 Y0.500 Z-4.6539 F3000
+G1 X9.880 Y0.500 Z-4.6657 F3000
+G1 X9.860 Y0.500 Z-4.6775 F3000
+G1 X9.840 Y0.500 Z-4.6893 F3000
+G1 X9.820 Y0.500 Z-4.7012 F3000
+G1 X9.800 Y0.500 Z-4.7132 F3000
+G1 X9.780 Y0.500 Z-4.7251 F3000
+G1 X9.760 Y0.500 Z-4.7371 F3000
+G1 X9.740 Y0.500 Z-4.7491 F3000
+G1 X9.720 Y0.500 Z-4.7612 F3000
+G1 X9.700 Y0.500 Z-4.7733 F3000
+G1 X9.680 Y0.500 Z-4.7854 F3000
+G1 X9.660 Y0.500 Z-4.7975 F3000
+G1 X9.640 Y0.500 Z-4.8097 F3000
+G1 X9.620 Y0.500 Z-4.8219 F3000
+G1 X9.600 Y0.500 Z-4.8342 F3000
+G1 X9.580 Y0.500 Z-4.8464 F3000
+G1 X9.560 Y0.500 Z-4.8587 F3000
+G1 X9.540 Y0.500 Z-4.8711 F3000
+G1 X9.520 Y0.500 Z-4.8835 F3000
+G1 X9.500 Y0.500 Z-4.8959 F3000
+G1 X9.480 Y0.500 Z-4.9083 F3000
+G1 X9.460 Y0.500 Z-4.9208 F3000
+G1 X9.440 Y0.500 Z-4.9333 F3000
+G1 X9.420 Y0.500 Z-4.9458 F3000
+G1 X9.400 Y0.500 Z-4.9584 F3000
+G1 X9.380 Y0.500 Z-4.9710 F3000
+G1 X9.360 Y0.500 Z-4.9836 F3000
+G1 X9.340 Y0.500 Z-4.9963 F3000
+G1 X9.320 Y0.500 Z-5.0090 F3000
+G1 X9.300 Y0.500 Z-5.0217 F3000
+G1 X9.280 Y0.500 Z-5.0345 F3000
+G1 X9.260 Y0.500 Z-5.0473 F3000
+G1 X9.240 Y0.500 Z-5.0602 F3000
+G1 X9.220 Y0.500 Z-5.0730 F3000
+G1 X9.200 Y0.500 Z-5.0859 F3000
+G1 X9.180 Y0.500 Z-5.0989 F3000
+G1 X9.160 Y0.500 Z-5.1118 F3000
+G1 X9.140 Y0.500 Z-5.1249 F3000
+G1 X9.120 Y0.500 Z-5.1379 F3000
+G1 X9.100 Y0.500 Z-5.1510 F3000
+G1 X9.080 Y0.500 Z-5.1641 F3000
+G1 X9.060 Y0.500 Z-5.1772 F3000
+G1 X9.040 Y0.500 Z-5.1904 F3000
+G1 X9.020 Y0.500 Z-5.2036 F3000
+G1 X9.000 Y0.500 Z-5.2169 F3000
+G1 X8.980 Y0.500 Z-5.2302 F3000
+G1 X8.960 Y0.500 Z-5.2435 F3000
+G1 X8.940 Y0.500 Z-5.2568 F3000
+G1 X8.920 Y0.500 Z-5.2702 F3000
+G1 X8.900 Y0.500 Z-5.2836 F3000
+G1 X8.880 Y0.500 Z-5.2971 F3000
+G1 X8.860 Y0.500 Z-5.3106 F3000
+G1 X8.840 Y0.500 Z-5.3241 F3000
+G1 X8.820 Y0.500 Z-5.3377 F3000
+G1 X8.800 Y0.500 Z-5.3513 F3000
+G1 X8.780 Y0.500 Z-5.3649 F3000
+G1 X8.760 Y0.500 Z-5.3786 F3000
+G1 X8.740 Y0.500 Z-5.3923 F3000
+G1 X8.720 Y0.500 Z-5.4060 F3000
+G1 X8.700 Y0.500 Z-5.4198 F3000
+G1 X8.680 Y0.500 Z-5.4336 F3000
+G1 X8.660 Y0.500 Z-5.4475 F3000
+G1 X8.640 Y0.500 Z-5.4614 F3000
+G1 X8.620 Y0.500 Z-5.4753 F3000
+G1 X8.600 Y0.500 Z-5.4893 F3000
+G1 X8.580 Y0.500 Z-5.5033 F3000
+G1 X8.560 Y0.500 Z-5.5173 F3000
+G1 X8.540 Y0.500 Z-5.5314 F3000
+G1 X8.520 Y0.500 Z-5.5455 F3000
+G1 X8.500 Y0.500 Z-5.5596 F3000
+G1 X8.480 Y0.500 Z-5.5738 F3000
+G1 X8.460 Y0.500 Z-5.5880 F3000
+G1 X8.440 Y0.500 Z-5.6023 F3000
+G1 X8.420 Y0.500 Z-5.6166 F3000
+G1 X8.400 Y0.500 Z-5.6309 F3000
+G1 X8.380 Y0.500 Z-5.6453 F3000
+G1 X8.360 Y0.500 Z-5.6597 F3000
+G1 X8.340 Y0.500 Z-5.6741 F3000
+G1 X8.320 Y0.500 Z-5.6886 F3000
+G1 X8.300 Y0.500 Z-5.7031 F3000
+G1 X8.280 Y0.500 Z-5.7177 F3000
+G1 X8.260 Y0.500 Z-5.7323 F3000
+G1 X8.240 Y0.500 Z-5.7469 F3000
+G1 X8.220 Y0.500 Z-5.7616 F3000
+G1 X8.200 Y0.500 Z-5.7763 F3000
+G1 X8.180 Y0.500 Z-5.7910 F3000
+G1 X8.160 Y0.500 Z-5.8058 F3000
+G1 X8.140 Y0.500 Z-5.8206 F3000
+G1 X8.120 Y0.500 Z-5.8355 F3000
+G1 X8.100 Y0.500 Z-5.8504 F3000
+G1 X8.080 Y0.500 Z-5.8653 F3000
+G1 X8.060 Y0.500 Z-5.8803 F3000
+G1 X8.040 Y0.500 Z-5.8953 F3000
+G1 X8.020 Y0.500 Z-5.9104 F3000
+G1 X8.000 Y0.500 Z-5.9255 F3000
+G1 X7.980 Y0.500 Z-5.9406 F3000
+G1 X7.960 Y0.500 Z-5.9558 F3000
+G1 X7.940 Y0.500 Z-5.9710 F3000
+G1 X7.920 Y0.500 Z-5.9863 F3000
+G1 X7.900 Y0.500 Z-6.0016 F3000
+G1 X7.880 Y0.500 Z-6.0169 F3000
+G1 X7.860 Y0.500 Z-6.0323 F3000
+G1 X7.840 Y0.500 Z-6.0477 F3000
+G1 X7.820 Y0.500 Z-6.0632 F3000
+G1 X7.800 Y0.500 Z-6.0787 F3000
+G1 X7.780 Y0.500 Z-6.0942 F3000
+G1 X7.760 Y0.500 Z-6.1098 F3000
+G1 X7.740 Y0.500 Z-6.1254 F3000
+G1 X7.720 Y0.500 Z-6.1411 F3000
+G1 X7.700 Y0.500 Z-6.1568 F3000
+G1 X7.680 Y0.500 Z-6.1725 F3000
+G1 X7.660 Y0.500 Z-6.1883 F3000
+G1 X7.640 Y0.500 Z-6.2042 F3000
+G1 X7.620 Y0.500 Z-6.2200 F3000
+G1 X7.600 Y0.500 Z-6.2359 F3000
+G1 X7.580 Y0.500 Z-6.2519 F3000
+G1 X7.560 Y0.500 Z-6.2679 F3000
+G1 X7.540 Y0.500 Z-6.2839 F3000
+G1 X7.520 Y0.500 Z-6.3000 F3000
+G1 X7.500 Y0.500 Z-6.3161 F3000
+G1 X7.480 Y0.500 Z-6.3323 F3000
+G1 X7.460 Y0.500 Z-6.3485 F3000
+G1 X7.440 Y0.500 Z-6.3648 F3000
+G1 X7.420 Y0.500 Z-6.3811 F3000
+G1 X7.400 Y0.500 Z-6.3974 F3000
+G1 X7.380 Y0.500 Z-6.4138 F3000
+G1 X7.360 Y0.500 Z-6.4302 F3000
+G1 X7.340 Y0.500 Z-6.4467 F3000
+G1 X7.320 Y0.500 Z-6.4632 F3000
+G1 X7.300 Y0.500 Z-6.4798 F3000
+G1 X7.280 Y0.500 Z-6.4964 F3000
+G1 X7.260 Y0.500 Z-6.5130 F3000
+G1 X7.240 Y0.500 Z-6.5297 F3000
+G1 X7.220 Y0.500 Z-6.5464 F3000
+G1 X7.200 Y0.500 Z-6.5632 F3000
+G1 X7.180 Y0.500 Z-6.5800 F3000
+G1 X7.160 Y0.500 Z-6.5969 F3000
+G1 X7.140 Y0.500 Z-6.6138 F3000
+G1 X7.120 Y0.500 Z-6.6308 F3000
+G1 X7.100 Y0.500 Z-6.6478 F3000
+G1 X7.080 Y0.500 Z-6.6648 F3000
+G1 X7.060 Y0.500 Z-6.6819 F3000
+G1 X7.040 Y0.500 Z-6.6991 F3000
+G1 X7.020 Y0.500 Z-6.7162 F3000
+G1 X7.000 Y0.500 Z-6.7335 F3000
+G1 X6.980 Y0.500 Z-6.7508 F3000
+G1 X6.960 Y0.500 Z-6.7681 F3000
+G1 X6.940 Y0.500 Z-6.7855 F3000
+G1 X6.920 Y0.500 Z-6.8029 F3000
+G1 X6.900 Y0.500 Z-6.8203 F3000
+G1 X6.880 Y0.500 Z-6.8379 F3000
+G1 X6.860 Y0.500 Z-6.8554 F3000
+G1 X6.840 Y0.500 Z-6.8730 F3000
+G1 X6.820 Y0.500 Z-6.8907 F3000
+G1 X6.800 Y0.500 Z-6.9084 F3000
+G1 X6.780 Y0.500 Z-6.9261 F3000
+G1 X6.760 Y0.500 Z-6.9439 F3000
+G1 X6.740 Y0.500 Z-6.9618 F3000
+G1 X6.720 Y0.500 Z-6.9797 F3000
+G1 X6.700 Y0.500 Z-6.9976 F3000
+G1 X6.680 Y0.500 Z-7.0156 F3000
+G1 X6.660 Y0.500 Z-7.0337 F3000
+G1 X6.640 Y0.500 Z-7.0518 F3000
+G1 X6.620 Y0.500 Z-7.0699 F3000
+G1 X6.600 Y0.500 Z-7.0881 F3000
+G1 X6.580 Y0.500 Z-7.1063 F3000
+G1 X6.560 Y0.500 Z-7.1246 F3000
+G1 X6.540 Y0.500 Z-7.1430 F3000
+G1 X6.520 Y0.500 Z-7.1614 F3000
+G1 X6.500 Y0.500 Z-7.1798 F3000
+G1 X6.480 Y0.500 Z-7.1983 F3000
+G1 X6.460 Y0.500 Z-7.2168 F3000
+G1 X6.440 Y0.500 Z-7.2354 F3000
+G1 X6.420 Y0.500 Z-7.2541 F3000
+G1 X6.400 Y0.500 Z-7.2728 F3000
+G1 X6.380 Y0.500 Z-7.2915 F3000
+G1 X6.360 Y0.500 Z-7.3103 F3000
+G1 X6.340 Y0.500 Z-7.3292 F3000
+G1 X6.320 Y0.500 Z-7.3481 F3000
+G1 X6.300 Y0.500 Z-7.3671 F3000
+G1 X6.280 Y0.500 Z-7.3861 F3000
+G1 X6.260 Y0.500 Z-7.4051 F3000
+G1 X6.240 Y0.500 Z-7.4242 F3000
+G1 X6.220 Y0.500 Z-7.4434 F3000
+G1 X6.200 Y0.500 Z-7.4626 F3000
+G1 X6.180 Y0.500 Z-7.4819 F3000
+G1 X6.160 Y0.500 Z-7.5012 F3000
+G1 X6.140 Y0.500 Z-7.5206 F3000
+G1 X6.120 Y0.500 Z-7.5401 F3000
+G1 X6.100 Y0.500 Z-7.5596 F3000
+G1 X6.080 Y0.500 Z-7.5791 F3000
+G1 X6.060 Y0.500 Z-7.5987 F3000
+G1 X6.040 Y0.500 Z-7.6184 F3000
+G1 X6.020 Y0.500 Z-7.6381 F3000
+G1 X6.000 Y0.500 Z-7.6579 F3000
+G1 X5.980 Y0.500 Z-7.6777 F3000
+G1 X5.960 Y0.500 Z-7.6976 F3000
+G1 X5.940 Y0.500 Z-7.7175 F3000
+G1 X5.920 Y0.500 Z-7.7375 F3000
+G1 X5.900 Y0.500 Z-7.7576 F3000
+G1 X5.880 Y0.500 Z-7.7777 F3000
+G1 X5.860 Y0.500 Z-7.7978 F3000
+G1 X5.840 Y0.500 Z-7.8181 F3000
+G1 X5.820 Y0.500 Z-7.8384 F3000
+G1 X5.800 Y0.500 Z-7.8587 F3000
+G1 X5.780 Y0.500 Z-7.8791 F3000
+G1 X5.760 Y0.500 Z-7.8996 F3000
+G1 X5.740 Y0.500 Z-7.9201 F3000
+G1 X5.720 Y0.500 Z-7.9406 F3000
+G1 X5.700 Y0.500 Z-7.9613 F3000
+G1 X5.680 Y0.500 Z-7.9820 F3000
+G1 X5.660 Y0.500 Z-8.0027 F3000
+G1 X5.640 Y0.500 Z-8.0236 F3000
+G1 X5.620 Y0.500 Z-8.0444 F3000
+G1 X5.600 Y0.500 Z-8.0654 F3000
+G1 X5.580 Y0.500 Z-8.0864 F3000
+G1 X5.560 Y0.500 Z-8.1074 F3000
+G1 X5.540 Y0.500 Z-8.1286 F3000
+G1 X5.520 Y0.500 Z-8.1497 F3000
+G1 X5.500 Y0.500 Z-8.1710 F3000
+G1 X5.480 Y0.500 Z-8.1923 F3000
+G1 X5.460 Y0.500 Z-8.2137 F3000
+G1 X5.440 Y0.500 Z-8.2351 F3000
+G1 X5.420 Y0.500 Z-8.2566 F3000
+G1 X5.400 Y0.500 Z-8.2782 F3000
+G1 X5.380 Y0.500 Z-8.2998 F3000
+G1 X5.360 Y0.500 Z-8.3215 F3000
+G1 X5.340 Y0.500 Z-8.3432 F3000
+G1 X5.320 Y0.500 Z-8.3651 F3000
+G1 X5.300 Y0.500 Z-8.3869 F3000
+G1 X5.280 Y0.500 Z-8.4089 F3000
+G1 X5.260 Y0.500 Z-8.4309 F3000
+G1 X5.240 Y0.500 Z-8.4530 F3000
+G1 X5.220 Y0.500 Z-8.4752 F3000
+G1 X5.200 Y0.500 Z-8.4974 F3000
+G1 X5.180 Y0.500 Z-8.5197 F3000
+G1 X5.160 Y0.500 Z-8.5420 F3000
+G1 X5.140 Y0.500 Z-8.5644 F3000
+G1 X5.120 Y0.500 Z-8.5869 F3000
+G1 X5.100 Y0.500 Z-8.6095 F3000
+G1 X5.080 Y0.500 Z-8.6321 F3000
+G1 X5.060 Y0.500 Z-8.6548 F3000
+G1 X5.040 Y0.500 Z-8.6776 F3000
+G1 X5.020 Y0.500 Z-8.7004 F3000
+G1 X5.000 Y0.500 Z-8.7233 F3000
+G1 X4.980 Y0.500 Z-8.7463 F3000
+G1 X4.960 Y0.500 Z-8.7693 F3000
+G1 X4.940 Y0.500 Z-8.7924 F3000
+G1 X4.920 Y0.500 Z-8.8156 F3000
+G1 X4.900 Y0.500 Z-8.8389 F3000
+G1 X4.880 Y0.500 Z-8.8622 F3000
+G1 X4.860 Y0.500 Z-8.8857 F3000
+G1 X4.840 Y0.500 Z-8.9091 F3000
+G1 X4.820 Y0.500 Z-8.9327 F3000
+G1 X4.800 Y0.500 Z-8.9563 F3000
+G1 X4.780 Y0.500 Z-8.9800 F3000
+G1 X4.760 Y0.500 Z-9.0038 F3000
+G1 X4.740 Y0.500 Z-9.0277 F3000
+G1 X4.720 Y0.500 Z-9.0516 F3000
+G1 X4.700 Y0.500 Z-9.0756 F3000
+G1 X4.680 Y0.500 Z-9.0997 F3000
+G1 X4.660 Y0.500 Z-9.1239 F3000
+G1 X4.640 Y0.500 Z-9.1481 F3000
+G1 X4.620 Y0.500 Z-9.1724 F3000
+G1 X4.600 Y0.500 Z-9.1968 F3000
+G1 X4.580 Y0.500 Z-9.2213 F3000
+G1 X4.560 Y0.500 Z-9.2459 F3000
+G1 X4.540 Y0.500 Z-9.2705 F3000
+G1 X4.520 Y0.500 Z-9.2952 F3000
+G1 X4.500 Y0.500 Z-9.3200 F3000
+G1 X4.480 Y0.500 Z-9.3449 F3000
+G1 X4.460 Y0.500 Z-9.3699 F3000
+G1 X4.440 Y0.500 Z-9.3949 F3000
+G1 X4.420 Y0.500 Z-9.4200 F3000
+G1 X4.400 Y0.500 Z-9.4452 F3000
+G1 X4.380 Y0.500 Z-9.4705 F3000
+G1 X4.360 Y0.500 Z-9.4959 F3000
+G1 X4.340 Y0.500 Z-9.5214 F3000
+G1 X4.320 Y0.500 Z-9.5469 F3000
+G1 X4.300 Y0.500 Z-9.5726 F3000
+G1 X4.280 Y0.500 Z-9.5983 F3000
+G1 X4.260 Y0.500 Z-9.6241 F3000
+G1 X4.240 Y0.500 Z-9.6500 F3000
+G1 X4.220 Y0.500 Z-9.6760 F3000
+G1 X4.200 Y0.500 Z-9.7021 F3000
+G1 X4.180 Y0.500 Z-9.7282 F3000
+G1 X4.160 Y0.500 Z-9.7545 F3000
+G1 X4.140 Y0.500 Z-9.7808 F3000
+G1 X4.120 Y0.500 Z-9.8073 F3000
+G1 X4.100 Y0.500 Z-9.8338 F3000
+G1 X4.080 Y0.500 Z-9.8604 F3000
+G1 X4.060 Y0.500 Z-9.8871 F3000
+G1 X4.040 Y0.500 Z-9.9139 F3000
+G1 X4.020 Y0.500 Z-9.9408 F3000
+G1 X4.000 Y0.500 Z-9.9678 F3000
+G1 X3.980 Y0.500 Z-9.9949 F3000
+G1 X3.960 Y0.500 Z-10.0221 F3000
+G1 X3.940 Y0.500 Z-10.0494 F3000
+G1 X3.920 Y0.500 Z-10.0768 F3000
+G1 X3.900 Y0.500 Z-10.1043 F3000
+G1 X3.880 Y0.500 Z-10.1319 F3000
+G1 X3.860 Y0.500 Z-10.1595 F3000
+G1 X3.840 Y0.500 Z-10.1873 F3000
+G1 X3.820 Y0.500 Z-10.2152 F3000
+G1 X3.800 Y0.500 Z-10.2432 F3000
+G1 X3.780 Y0.500 Z-10.2713 F3000
+G1 X3.760 Y0.500 Z-10.2995 F3000
+G1 X3.740 Y0.500 Z-10.3278 F3000
+G1 X3.720 Y0.500 Z-10.3562 F3000
+G1 X3.700 Y0.500 Z-10.3847 F3000
+G1 X3.680 Y0.500 Z-10.4133 F3000
+G1 X3.660 Y0.500 Z-10.4420 F3000
+G1 X3.640 Y0.500 Z-10.4708 F3000
+G1 X3.620 Y0.500 Z-10.4998 F3000
+G1 X3.600 Y0.500 Z-10.5288 F3000
+G1 X3.580 Y0.500 Z-10.5580 F3000
+G1 X3.560 Y0.500 Z-10.5872 F3000
+G1 X3.540 Y0.500 Z-10.6166 F3000
+G1 X3.520 Y0.500 Z-10.6461 F3000
+G1 X3.500 Y0.500 Z-10.6757 F3000
+G1 X3.480 Y0.500 Z-10.7054 F3000
+G1 X3.460 Y0.500 Z-10.7353 F3000
+G1 X3.440 Y0.500 Z-10.7652 F3000
+G1 X3.420 Y0.500 Z-10.7953 F3000
+G1 X3.400 Y0.500 Z-10.8255 F3000
+G1 X3.380 Y0.500 Z-10.8558 F3000
+G1 X3.360 Y0.500 Z-10.8862 F3000
+G1 X3.340 Y0.500 Z-10.9168 F3000
+G1 X3.320 Y0.500 Z-10.9475 F3000
+G1 X3.300 Y0.500 Z-10.9783 F3000
+G1 X3.280 Y0.500 Z-11.0092 F3000
+G1 X3.260 Y0.500 Z-11.0402 F3000
+G1 X3.240 Y0.500 Z-11.0714 F3000
+G1 X3.220 Y0.500 Z-11.1027 F3000
+G1 X3.200 Y0.500 Z-11.1342 F3000
+G1 X3.180 Y0.500 Z-11.1657 F3000
+G1 X3.160 Y0.500 Z-11.1974 F3000
+G1 X3.140 Y0.500 Z-11.2293 F3000
+G1 X3.120 Y0.500 Z-11.2612 F3000
+G1 X3.100 Y0.500 Z-11.2933 F3000
+G1 X3.080 Y0.500 Z-11.3256 F3000
+G1 X3.060 Y0.500 Z-11.3580 F3000
+G1 X3.040 Y0.500 Z-11.3905 F3000
+G1 X3.020 Y0.500 Z-11.4231 F3000
+G1 X3.000 Y0.500 Z-11.4559 F3000
+G1 X2.980 Y0.500 Z-11.4889 F3000
+G1 X2.960 Y0.500 Z-11.5219 F3000
+G1 X2.940 Y0.500 Z-11.5552 F3000
+G1 X2.920 Y0.500 Z-11.5886 F3000
+G1 X2.900 Y0.500 Z-11.6221 F3000
+G1 X2.880 Y0.500 Z-11.6558 F3000
+G1 X2.860 Y0.500 Z-11.6896 F3000
+G1 X2.840 Y0.500 Z-11.7236 F3000
+G1 X2.820 Y0.500 Z-11.7577 F3000
+G1 X2.800 Y0.500 Z-11.7920 F3000
+G1 X2.780 Y0.500 Z-11.8265 F3000
+G1 X2.760 Y0.500 Z-11.8611 F3000
+G1 X2.740 Y0.500 Z-11.8958 F3000
+G1 X2.720 Y0.500 Z-11.9308 F3000
+G1 X2.700 Y0.500 Z-11.9659 F3000
+G1 X2.680 Y0.500 Z-12.0011 F3000
+G1 X2.660 Y0.500 Z-12.0366 F3000
+G1 X2.640 Y0.500 Z-12.0722 F3000
+G1 X2.620 Y0.500 Z-12.1080 F3000
+G1 X2.600 Y0.500 Z-12.1439 F3000
+G1 X2.580 Y0.500 Z-12.1800 F3000
+G1 X2.560 Y0.500 Z-12.2163 F3000
+G1 X2.540 Y0.500 Z-12.2528 F3000
+G1 X2.520 Y0.500 Z-12.2895 F3000
+G1 X2.500 Y0.500 Z-12.3264 F3000
+G1 X2.480 Y0.500 Z-12.3634 F3000
+G1 X2.460 Y0.500 Z-12.4006 F3000
+G1 X2.440 Y0.500 Z-12.4380 F3000
+G1 X2.420 Y0.500 Z-12.4756 F3000
+G1 X2.400 Y0.500 Z-12.5135 F3000
+G1 X2.380 Y0.500 Z-12.5515 F3000
+G1 X2.360 Y0.500 Z-12.5897 F3000
+G1 X2.340 Y0.500 Z-12.6281 F3000
+G1 X2.320 Y0.500 Z-12.6667 F3000
+G1 X2.300 Y0.500 Z-12.7055 F3000
+G1 X2.280 Y0.500 Z-12.7445 F3000
+G1 X2.260 Y0.500 Z-12.7838 F3000
+G1 X2.240 Y0.500 Z-12.8232 F3000
+G1 X2.220 Y0.500 Z-12.8629 F3000
+G1 X2.200 Y0.500 Z-12.9028 F3000
+G1 X2.180 Y0.500 Z-12.9429 F3000
+G1 X2.160 Y0.500 Z-12.9833 F3000
+G1 X2.140 Y0.500 Z-13.0239 F3000
+G1 X2.120 Y0.500 Z-13.0647 F3000
+G1 X2.100 Y0.500 Z-13.1057 F3000
+G1 X2.080 Y0.500 Z-13.1470 F3000
+G1 X2.060 Y0.500 Z-13.1886 F3000
+G1 X2.040 Y0.500 Z-13.2304 F3000
+G1 X2.020 Y0.500 Z-13.2724 F3000
+G1 X2.000 Y0.500 Z-13.3147 F3000
+G1 X1.980 Y0.500 Z-13.3573 F3000
+G1 X1.960 Y0.500 Z-13.4001 F3000
+G1 X1.940 Y0.500 Z-13.4432 F3000
+G1 X1.920 Y0.500 Z-13.4865 F3000
+G1 X1.900 Y0.500 Z-13.5302 F3000
+G1 X1.880 Y0.500 Z-13.5741 F3000
+G1 X1.860 Y0.500 Z-13.6183 F3000
+G1 X1.840 Y0.500 Z-13.6628 F3000
+G1 X1.820 Y0.500 Z-13.7076 F3000
+G1 X1.800 Y0.500 Z-13.7526 F3000
+G1 X1.780 Y0.500 Z-13.7980 F3000
+G1 X1.760 Y0.500 Z-13.8437 F3000
+G1 X1.740 Y0.500 Z-13.8897 F3000
+G1 X1.720 Y0.500 Z-13.9361 F3000
+G1 X1.700 Y0.500 Z-13.9827 F3000
+G1 X1.680 Y0.500 Z-14.0297 F3000
+G1 X1.660 Y0.500 Z-14.0770 F3000
+G1 X1.640 Y0.500 Z-14.1247 F3000
+G1 X1.620 Y0.500 Z-14.1727 F3000
+G1 X1.600 Y0.500 Z-14.2211 F3000
+G1 X1.580 Y0.500 Z-14.2698 F3000
+G1 X1.560 Y0.500 Z-14.3189 F3000
+G1 X1.540 Y0.500 Z-14.3684 F3000
+G1 X1.520 Y0.500 Z-14.4183 F3000
+G1 X1.500 Y0.500 Z-14.4686 F3000
+G1 X1.480 Y0.500 Z-14.5192 F3000
+G1 X1.460 Y0.500 Z-14.5703 F3000
+G1 X1.440 Y0.500 Z-14.6218 F3000
+G1 X1.420 Y0.500 Z-14.6737 F3000
+G1 X1.400 Y0.500 Z-14.7261 F3000
+G1 X1.380 Y0.500 Z-14.7789 F3000
+G1 X1.360 Y0.500 Z-14.8322 F3000
+G1 X1.340 Y0.500 Z-14.8859 F3000
+G1 X1.320 Y0.500 Z-14.9401 F3000
+G1 X1.300 Y0.500 Z-14.9949 F3000
+G1 X1.280 Y0.500 Z-15.0501 F3000
+G1 X1.260 Y0.500 Z-15.1058 F3000
+G1 X1.240 Y0.500 Z-15.1620 F3000
+G1 X1.220 Y0.500 Z-15.2188 F3000
+G1 X1.200 Y0.500 Z-15.2762 F3000
+G1 X1.180 Y0.500 Z-15.3341 F3000
+G1 X1.160 Y0.500 Z-15.3926 F3000
+G1 X1.140 Y0.500 Z-15.4517 F3000
+G1 X1.120 Y0.500 Z-15.5115 F3000
+G1 X1.100 Y0.500 Z-15.5718 F3000
+G1 X1.080 Y0.500 Z-15.6329 F3000
+G1 X1.060 Y0.500 Z-15.6946 F3000
+G1 X1.040 Y0.500 Z-15.7570 F3000
+G1 X1.020 Y0.500 Z-15.8201 F3000
+G1 X1.000 Y0.500 Z-15.8839 F3000
+G1 X0.980 Y0.500 Z-15.9485 F3000
+G1 X0.960 Y0.500 Z-16.0139 F3000
+G1 X0.940 Y0.500 Z-16.0802 F3000
+G1 X0.920 Y0.500 Z-16.1472 F3000
+G1 X0.900 Y0.500 Z-16.2152 F3000
+G1 X0.880 Y0.500 Z-16.2841 F3000
+G1 X0.860 Y0.500 Z-16.3539 F3000
+G1 X0.840 Y0.500 Z-16.4246 F3000
+G1 X0.820 Y0.500 Z-16.4965 F3000
+G1 X0.800 Y0.500 Z-16.5693 F3000
+G1 X0.780 Y0.500 Z-16.6433 F3000
+G1 X0.760 Y0.500 Z-16.7184 F3000
+G1 X0.740 Y0.500 Z-16.7948 F3000
+G1 X0.720 Y0.500 Z-16.8724 F3000
+G1 X0.700 Y0.500 Z-16.9513 F3000
+G1 X0.680 Y0.500 Z-17.0316 F3000
+G1 X0.660 Y0.500 Z-17.1134 F3000
+G1 X0.640 Y0.500 Z-17.1967 F3000
+G1 X0.620 Y0.500 Z-17.2816 F3000
+G1 X0.600 Y0.500 Z-17.3683 F3000
+G1 X0.580 Y0.500 Z-17.4568 F3000
+G1 X0.560 Y0.500 Z-17.5472 F3000
+G1 X0.540 Y0.500 Z-17.6397 F3000
+G1 X0.520 Y0.500 Z-17.7343 F3000
+G1 X0.500 Y0.500 Z-17.8314 F3000
+G1 X0.480 Y0.500 Z-17.9309 F3000
+G1 X0.460 Y0.500 Z-18.0333 F3000
+G1 X0.440 Y0.500 Z-18.1385 F3000
+G1 X0.420 Y0.500 Z-18.2470 F3000
+G1 X0.400 Y0.500 Z-18.3591 F3000
+G1 X0.380 Y0.500 Z-18.4750 F3000
+G1 X0.360 Y0.500 Z-18.5953 F3000
+G1 X0.340 Y0.500 Z-18.7203 F3000
+G1 X0.320 Y0.500 Z-18.8508 F3000
+G1 X0.300 Y0.500 Z-18.9875 F3000
+G1 X0.280 Y0.500 Z-19.1314 F3000
+G1 X0.260 Y0.500 Z-19.2836 F3000
+G1 X0.240 Y0.500 Z-19.4458 F3000
+G1 X0.220 Y0.500 Z-19.6202 F3000
+G1 X0.200 Y0.500 Z-19.8100 F3000
+G1 X0.180 Y0.500 Z-20.0202 F3000
+G1 X0.160 Y0.500 Z-20.2591 F3000
+G1 X0.140 Y0.500 Z-20.5429 F3000
+G1 X0.120 Y0.500 Z-20.9137 F3000
+G1 X0.100 Y0.500 Z-21.8000 F3000
+G1 X0.080 Y0.500 Z-21.8000 F3000
+G1 X0.060 Y0.500 Z-21.8000 F3000
+G1 X0.040 Y0.500 Z-21.8000 F3000
+G1 X0.020 Y0.500 Z-21.8000 F3000
+G1 X0.000 Y0.500 Z-21.8000 F3000
+G1 X0.000 Y1.000 Z-21.8000 F3000
+G1 X0.020 Y1.000 Z-21.8000 F3000
+G1 X0.040 Y1.000 Z-21.8000 F3000
+G1 X0.060 Y1.000 Z-21.4174 F3000
+G1 X0.080 Y1.000 Z-20.8286 F3000
+G1 X0.100 Y1.000 Z-20.4809 F3000
+G1 X0.120 Y1.000 Z-20.2076 F3000
+G1 X0.140 Y1.000 Z-19.9751 F3000
+G1 X0.160 Y1.000 Z-19.7691 F3000
+G1 X0.180 Y1.000 Z-19.5824 F3000
+G1 X0.200 Y1.000 Z-19.4104 F3000
+G1 X0.220 Y1.000 Z-19.2502 F3000
+G1 X0.240 Y1.000 Z-19.0996 F3000
+G1 X0.260 Y1.000 Z-18.9570 F3000
+G1 X0.280 Y1.000 Z-18.8215 F3000
+G1 X0.300 Y1.000 Z-18.6919 F3000
+G1 X0.320 Y1.000 Z-18.5677 F3000
+G1 X0.340 Y1.000 Z-18.4482 F3000
+G1 X0.360 Y1.000 Z-18.3330 F3000
+G1 X0.380 Y1.000 Z-18.2215 F3000
+G1 X0.400 Y1.000 Z-18.1135 F3000
+G1 X0.420 Y1.000 Z-18.0087 F3000
+G1 X0.440 Y1.000 Z-17.9069 F3000
+G1 X0.460 Y1.000 Z-17.8077 F3000
+G1 X0.480 Y1.000 Z-17.7110 F3000
+G1 X0.500 Y1.000 Z-17.6167 F3000
+G1 X0.520 Y1.000 Z-17.5245 F3000
+G1 X0.540 Y1.000 Z-17.4344 F3000
+G1 X0.560 Y1.000 Z-17.3462 F3000
+G1 X0.580 Y1.000 Z-17.2598 F3000
+G1 X0.600 Y1.000 Z-17.1751 F3000
+G1 X0.620 Y1.000 Z-17.0920 F3000
+G1 X0.640 Y1.000 Z-17.0104 F3000
+G1 X0.660 Y1.000 Z-16.9303 F3000
+G1 X0.680 Y1.000 Z-16.8515 F3000
+G1 X0.700 Y1.000 Z-16.7741 F3000
+G1 X0.720 Y1.000 Z-16.6979 F3000
+G1 X0.740 Y1.000 Z-16.6229 F3000
+G1 X0.760 Y1.000 Z-16.5491 F3000
+G1 X0.780 Y1.000 Z-16.4763 F3000
+G1 X0.800 Y1.000 Z-16.4046 F3000
+G1 X0.820 Y1.000 Z-16.3340 F3000
+G1 X0.840 Y1.000 Z-16.2643 F3000
+G1 X0.860 Y1.000 Z-16.1955 F3000
+G1 X0.880 Y1.000 Z-16.1276 F3000
+G1 X0.900 Y1.000 Z-16.0607 F3000
+G1 X0.920 Y1.000 Z-15.9945 F3000
+G1 X0.940 Y1.000 Z-15.9292 F3000
+G1 X0.960 Y1.000 Z-15.8646 F3000
+G1 X0.980 Y1.000 Z-15.8009 F3000
+G1 X1.000 Y1.000 Z-15.7378 F3000
+G1 X1.020 Y1.000 Z-15.6755 F3000
+G1 X1.040 Y1.000 Z-15.6139 F3000
+G1 X1.060 Y1.000 Z-15.5529 F3000
+G1 X1.080 Y1.000 Z-15.4926 F3000
+G1 X1.100 Y1.000 Z-15.4329 F3000
+G1 X1.120 Y1.000 Z-15.3738 F3000
+G1 X1.140 Y1.000 Z-15.3154 F3000
+G1 X1.160 Y1.000 Z-15.2575 F3000
+G1 X1.180 Y1.000 Z-15.2002 F3000
+G1 X1.200 Y1.000 Z-15.1434 F3000
+G1 X1.220 Y1.000 Z-15.0872 F3000
+G1 X1.240 Y1.000 Z-15.0315 F3000
+G1 X1.260 Y1.000 Z-14.9763 F3000
+G1 X1.280 Y1.000 Z-14.9217 F3000
+G1 X1.300 Y1.000 Z-14.8675 F3000
+G1 X1.320 Y1.000 Z-14.8138 F3000
+G1 X1.340 Y1.000 Z-14.7605 F3000
+G1 X1.360 Y1.000 Z-14.7077 F3000
+G1 X1.380 Y1.000 Z-14.6554 F3000
+G1 X1.400 Y1.000 Z-14.6035 F3000
+G1 X1.420 Y1.000 Z-14.5520 F3000
+G1 X1.440 Y1.000 Z-14.5009 F3000
+G1 X1.460 Y1.000 Z-14.4503 F3000
+G1 X1.480 Y1.000 Z-14.4000 F3000
+G1 X1.500 Y1.000 Z-14.3502 F3000
+G1 X1.520 Y1.000 Z-14.3007 F3000
+G1 X1.540 Y1.000 Z-14.2516 F3000
+G1 X1.560 Y1.000 Z-14.2029 F3000
+G1 X1.580 Y1.000 Z-14.1545 F3000
+G1 X1.600 Y1.000 Z-14.1065 F3000
+G1 X1.620 Y1.000 Z-14.0588 F3000
+G1 X1.640 Y1.000 Z-14.0115 F3000
+G1 X1.660 Y1.000 Z-13.9645 F3000
+G1 X1.680 Y1.000 Z-13.9179 F3000
+G1 X1.700 Y1.000 Z-13.8716 F3000
+G1 X1.720 Y1.000 Z-13.8256 F3000
+G1 X1.740 Y1.000 Z-13.7799 F3000
+G1 X1.760 Y1.000 Z-13.7345 F3000
+G1 X1.780 Y1.000 Z-13.6894 F3000
+G1 X1.800 Y1.000 Z-13.6446 F3000
+G1 X1.820 Y1.000 Z-13.6001 F3000
+G1 X1.840 Y1.000 Z-13.5559 F3000
+G1 X1.860 Y1.000 Z-13.5120 F3000
+G1 X1.880 Y1.000 Z-13.4684 F3000
+G1 X1.900 Y1.000 Z-13.4250 F3000
+G1 X1.920 Y1.000 Z-13.3819 F3000
+G1 X1.940 Y1.000 Z-13.3391 F3000
+G1 X1.960 Y1.000 Z-13.2966 F3000
+G1 X1.980 Y1.000 Z-13.2543 F3000
+G1 X2.000 Y1.000 Z-13.2122 F3000
+G1 X2.020 Y1.000 Z-13.1704 F3000
+G1 X2.040 Y1.000 Z-13.1289 F3000
+G1 X2.060 Y1.000 Z-13.0876 F3000
+G1 X2.080 Y1.000 Z-13.0465 F3000
+G1 X2.100 Y1.000 Z-13.0057 F3000
+G1 X2.120 Y1.000 Z-12.9651 F3000
+G1 X2.140 Y1.000 Z-12.9247 F3000
+G1 X2.160 Y1.000 Z-12.8846 F3000
+G1 X2.180 Y1.000 Z-12.8447 F3000
+G1 X2.200 Y1.000 Z-12.8050 F3000
+G1 X2.220 Y1.000 Z-12.7655 F3000
+G1 X2.240 Y1.000 Z-12.7263 F3000
+G1 X2.260 Y1.000 Z-12.6872 F3000
+G1 X2.280 Y1.000 Z-12.6484 F3000
+G1 X2.300 Y1.000 Z-12.6098 F3000
+G1 X2.320 Y1.000 Z-12.5714 F3000
+G1 X2.340 Y1.000 Z-12.5332 F3000
+G1 X2.360 Y1.000 Z-12.4951 F3000
+G1 X2.380 Y1.000 Z-12.4573 F3000
+G1 X2.400 Y1.000 Z-12.4197 F3000
+G1 X2.420 Y1.000 Z-12.3823 F3000
+G1 X2.440 Y1.000 Z-12.3450 F3000
+G1 X2.460 Y1.000 Z-12.3080 F3000
+G1 X2.480 Y1.000 Z-12.2711 F3000
+G1 X2.500 Y1.000 Z-12.2344 F3000
+G1 X2.520 Y1.000 Z-12.1979 F3000
+G1 X2.540 Y1.000 Z-12.1616 F3000
+G1 X2.560 Y1.000 Z-12.1255 F3000
+G1 X2.580 Y1.000 Z-12.0895 F3000
+G1 X2.600 Y1.000 Z-12.0537 F3000
+G1 X2.620 Y1.000 Z-12.0181 F3000
+G1 X2.640 Y1.000 Z-11.9826 F3000
+G1 X2.660 Y1.000 Z-11.9474 F3000
+G1 X2.680 Y1.000 Z-11.9123 F3000
+G1 X2.700 Y1.000 Z-11.8773 F3000
+G1 X2.720 Y1.000 Z-11.8425 F3000
+G1 X2.740 Y1.000 Z-11.8079 F3000
+G1 X2.760 Y1.000 Z-11.7734 F3000
+G1 X2.780 Y1.000 Z-11.7391 F3000
+G1 X2.800 Y1.000 Z-11.7050 F3000
+G1 X2.820 Y1.000 Z-11.6710 F3000
+G1 X2.840 Y1.000 Z-11.6371 F3000
+G1 X2.860 Y1.000 Z-11.6034 F3000
+G1 X2.880 Y1.000 Z-11.5699 F3000
+G1 X2.900 Y1.000 Z-11.5365 F3000
+G1 X2.920 Y1.000 Z-11.5032 F3000
+G1 X2.940 Y1.000 Z-11.4701 F3000
+G1 X2.960 Y1.000 Z-11.4372 F3000
+G1 X2.980 Y1.000 Z-11.4043 F3000
+G1 X3.000 Y1.000 Z-11.3717 F3000
+G1 X3.020 Y1.000 Z-11.3391 F3000
+G1 X3.040 Y1.000 Z-11.3067 F3000
+G1 X3.060 Y1.000 Z-11.2745 F3000
+G1 X3.080 Y1.000 Z-11.2424 F3000
+G1 X3.100 Y1.000 Z-11.2104 F3000
+G1 X3.120 Y1.000 Z-11.1785 F3000
+G1 X3.140 Y1.000 Z-11.1468 F3000
+G1 X3.160 Y1.000 Z-11.1152 F3000
+G1 X3.180 Y1.000 Z-11.0838 F3000
+G1 X3.200 Y1.000 Z-11.0524 F3000
+G1 X3.220 Y1.000 Z-11.0212 F3000
+G1 X3.240 Y1.000 Z-10.9902 F3000
+G1 X3.260 Y1.000 Z-10.9592 F3000
+G1 X3.280 Y1.000 Z-10.9284 F3000
+G1 X3.300 Y1.000 Z-10.8977 F3000
+G1 X3.320 Y1.000 Z-10.8671 F3000
+G1 X3.340 Y1.000 Z-10.8367 F3000
+G1 X3.360 Y1.000 Z-10.8063 F3000
+G1 X3.380 Y1.000 Z-10.7761 F3000
+G1 X3.400 Y1.000 Z-10.7460 F3000
+G1 X3.420 Y1.000 Z-10.7161 F3000
+G1 X3.440 Y1.000 Z-10.6862 F3000
+G1 X3.460 Y1.000 Z-10.6565 F3000
+G1 X3.480 Y1.000 Z-10.6268 F3000
+G1 X3.500 Y1.000 Z-10.5973 F3000
+G1 X3.520 Y1.000 Z-10.5679 F3000
+G1 X3.540 Y1.000 Z-10.5386 F3000
+G1 X3.560 Y1.000 Z-10.5095 F3000
+G1 X3.580 Y1.000 Z-10.4804 F3000
+G1 X3.600 Y1.000 Z-10.4514 F3000
+G1 X3.620 Y1.000 Z-10.4226 F3000
+G1 X3.640 Y1.000 Z-10.3938 F3000
+G1 X3.660 Y1.000 Z-10.3652 F3000
+G1 X3.680 Y1.000 Z-10.3367 F3000
+G1 X3.700 Y1.000 Z-10.3083 F3000
+G1 X3.720 Y1.000 Z-10.2799 F3000
+G1 X3.740 Y1.000 Z-10.2517 F3000
+G1 X3.760 Y1.000 Z-10.2236 F3000
+G1 X3.780 Y1.000 Z-10.1956 F3000
+G1 X3.800 Y1.000 Z-10.1677 F3000
+G1 X3.820 Y1.000 Z-10.1399 F3000
+G1 X3.840 Y1.000 Z-10.1122 F3000
+G1 X3.860 Y1.000 Z-10.0846 F3000
+G1 X3.880 Y1.000 Z-10.0571 F3000
+G1 X3.900 Y1.000 Z-10.0297 F3000
+G1 X3.920 Y1.000 Z-10.0024 F3000
+G1 X3.940 Y1.000 Z-9.9752 F3000
+G1 X3.960 Y1.000 Z-9.9481 F3000
+G1 X3.980 Y1.000 Z-9.9210 F3000
+G1 X4.000 Y1.000 Z-9.8941 F3000
+G1 X4.020 Y1.000 Z-9.8673 F3000
+G1 X4.040 Y1.000 Z-9.8406 F3000
+G1 X4.060 Y1.000 Z-9.8139 F3000
+G1 X4.080 Y1.000 Z-9.7874 F3000
+G1 X4.100 Y1.000 Z-9.7609 F3000
+G1 X4.120 Y1.000 Z-9.7345 F3000
+G1 X4.140 Y1.000 Z-9.7083 F3000
+G1 X4.160 Y1.000 Z-9.6821 F3000
+G1 X4.180 Y1.000 Z-9.6560 F3000
+G1 X4.200 Y1.000 Z-9.6300 F3000
+G1 X4.220 Y1.000 Z-9.6040 F3000
+G1 X4.240 Y1.000 Z-9.5782 F3000
+G1 X4.260 Y1.000 Z-9.5525 F3000
+G1 X4.280 Y1.000 Z-9.5268 F3000
+G1 X4.300 Y1.000 Z-9.5012 F3000
+G1 X4.320 Y1.000 Z-9.4757 F3000
+G1 X4.340 Y1.000 Z-9.4503 F3000
+G1 X4.360 Y1.000 Z-9.4250 F3000
+G1 X4.380 Y1.000 Z-9.3998 F3000
+G1 X4.400 Y1.000 Z-9.3746 F3000
+G1 X4.420 Y1.000 Z-9.3496 F3000
+G1 X4.440 Y1.000 Z-9.3246 F3000
+G1 X4.460 Y1.000 Z-9.2997 F3000
+G1 X4.480 Y1.000 Z-9.2748 F3000
+G1 X4.500 Y1.000 Z-9.2501 F3000
+G1 X4.520 Y1.000 Z-9.2254 F3000
+G1 X4.540 Y1.000 Z-9.2009 F3000
+G1 X4.560 Y1.000 Z-9.1764 F3000
+G1 X4.580 Y1.000 Z-9.1519 F3000
+G1 X4.600 Y1.000 Z-9.1276 F3000
+G1 X4.620 Y1.000 Z-9.1033 F3000
+G1 X4.640 Y1.000 Z-9.0791 F3000
+G1 X4.660 Y1.000 Z-9.0550 F3000
+G1 X4.680 Y1.000 Z-9.0310 F3000
+G1 X4.700 Y1.000 Z-9.0070 F3000
+G1 X4.720 Y1.000 Z-8.9832 F3000
+G1 X4.740 Y1.000 Z-8.9593 F3000
+G1 X4.760 Y1.000 Z-8.9356 F3000
+G1 X4.780 Y1.000 Z-8.9120 F3000
+G1 X4.800 Y1.000 Z-8.8884 F3000
+G1 X4.820 Y1.000 Z-8.8649 F3000
+G1 X4.840 Y1.000 Z-8.8414 F3000
+G1 X4.860 Y1.000 Z-8.8181 F3000
+G1 X4.880 Y1.000 Z-8.7948 F3000
+G1 X4.900 Y1.000 Z-8.7716 F3000
+G1 X4.920 Y1.000 Z-8.7484 F3000
+G1 X4.940 Y1.000 Z-8.7254 F3000
+G1 X4.960 Y1.000 Z-8.7024 F3000
+G1 X4.980 Y1.000 Z-8.6794 F3000
+G1 X5.000 Y1.000 Z-8.6566 F3000
+G1 X5.020 Y1.000 Z-8.6338 F3000
+G1 X5.040 Y1.000 Z-8.6111 F3000
+G1 X5.060 Y1.000 Z-8.5884 F3000
+G1 X5.080 Y1.000 Z-8.5658 F3000
+G1 X5.100 Y1.000 Z-8.5433 F3000
+G1 X5.120 Y1.000 Z-8.5209 F3000
+G1 X5.140 Y1.000 Z-8.4985 F3000
+G1 X5.160 Y1.000 Z-8.4762 F3000
+G1 X5.180 Y1.000 Z-8.4539 F3000
+G1 X5.200 Y1.000 Z-8.4318 F3000
+G1 X5.220 Y1.000 Z-8.4096 F3000
+G1 X5.240 Y1.000 Z-8.3876 F3000
+G1 X5.260 Y1.000 Z-8.3656 F3000
+G1 X5.280 Y1.000 Z-8.3437 F3000
+G1 X5.300 Y1.000 Z-8.3219 F3000
+G1 X5.320 Y1.000 Z-8.3001 F3000
+G1 X5.340 Y1.000 Z-8.2784 F3000
+G1 X5.360 Y1.000 Z-8.2567 F3000
+G1 X5.380 Y1.000 Z-8.2351 F3000
+G1 X5.400 Y1.000 Z-8.2136 F3000
+G1 X5.420 Y1.000 Z-8.1921 F3000
+G1 X5.440 Y1.000 Z-8.1708 F3000
+G1 X5.460 Y1.000 Z-8.1494 F3000
+G1 X5.480 Y1.000 Z-8.1281 F3000
+G1 X5.500 Y1.000 Z-8.1069 F3000
+G1 X5.520 Y1.000 Z-8.0858 F3000
+G1 X5.540 Y1.000 Z-8.0647 F3000
+G1 X5.560 Y1.000 Z-8.0437 F3000
+G1 X5.580 Y1.000 Z-8.0227 F3000
+G1 X5.600 Y1.000 Z-8.0018 F3000
+G1 X5.620 Y1.000 Z-7.9810 F3000
+G1 X5.640 Y1.000 Z-7.9602 F3000
+G1 X5.660 Y1.000 Z-7.9395 F3000
+G1 X5.680 Y1.000 Z-7.9188 F3000
+G1 X5.700 Y1.000 Z-7.8982 F3000
+G1 X5.720 Y1.000 Z-7.8777 F3000
+G1 X5.740 Y1.000 Z-7.8572 F3000
+G1 X5.760 Y1.000 Z-7.8367 F3000
+G1 X5.780 Y1.000 Z-7.8164 F3000
+G1 X5.800 Y1.000 Z-7.7961 F3000
+G1 X5.820 Y1.000 Z-7.7758 F3000
+G1 X5.840 Y1.000 Z-7.7556 F3000
+G1 X5.860 Y1.000 Z-7.7355 F3000
+G1 X5.880 Y1.000 Z-7.7154 F3000
+G1 X5.900 Y1.000 Z-7.6954 F3000
+G1 X5.920 Y1.000 Z-7.6754 F3000
+G1 X5.940 Y1.000 Z-7.6555 F3000
+G1 X5.960 Y1.000 Z-7.6357 F3000
+G1 X5.980 Y1.000 Z-7.6159 F3000
+G1 X6.000 Y1.000 Z-7.5961 F3000
+G1 X6.020 Y1.000 Z-7.5764 F3000
+G1 X6.040 Y1.000 Z-7.5568 F3000
+G1 X6.060 Y1.000 Z-7.5372 F3000
+G1 X6.080 Y1.000 Z-7.5177 F3000
+G1 X6.100 Y1.000 Z-7.4983 F3000
+G1 X6.120 Y1.000 Z-7.4788 F3000
+G1 X6.140 Y1.000 Z-7.4595 F3000
+G1 X6.160 Y1.000 Z-7.4402 F3000
+G1 X6.180 Y1.000 Z-7.4209 F3000
+G1 X6.200 Y1.000 Z-7.4017 F3000
+G1 X6.220 Y1.000 Z-7.3826 F3000
+G1 X6.240 Y1.000 Z-7.3635 F3000
+G1 X6.260 Y1.000 Z-7.3445 F3000
+G1 X6.280 Y1.000 Z-7.3255 F3000
+G1 X6.300 Y1.000 Z-7.3066 F3000
+G1 X6.320 Y1.000 Z-7.2877 F3000
+G1 X6.340 Y1.000 Z-7.2688 F3000
+G1 X6.360 Y1.000 Z-7.2501 F3000
+G1 X6.380 Y1.000 Z-7.2313 F3000
+G1 X6.400 Y1.000 Z-7.2127 F3000
+G1 X6.420 Y1.000 Z-7.1941 F3000
+G1 X6.440 Y1.000 Z-7.1755 F3000
+G1 X6.460 Y1.000 Z-7.1570 F3000
+G1 X6.480 Y1.000 Z-7.1385 F3000
+G1 X6.500 Y1.000 Z-7.1201 F3000
+G1 X6.520 Y1.000 Z-7.1017 F3000
+G1 X6.540 Y1.000 Z-7.0834 F3000
+G1 X6.560 Y1.000 Z-7.0651 F3000
+G1 X6.580 Y1.000 Z-7.0469 F3000
+G1 X6.600 Y1.000 Z-7.0287 F3000
+G1 X6.620 Y1.000 Z-7.0106 F3000
+G1 X6.640 Y1.000 Z-6.9926 F3000
+G1 X6.660 Y1.000 Z-6.9745 F3000
+G1 X6.680 Y1.000 Z-6.9566 F3000
+G1 X6.700 Y1.000 Z-6.9386 F3000
+G1 X6.720 Y1.000 Z-6.9208 F3000
+G1 X6.740 Y1.000 Z-6.9029 F3000
+G1 X6.760 Y1.000 Z-6.8852 F3000
+G1 X6.780 Y1.000 Z-6.8674 F3000
+G1 X6.800 Y1.000 Z-6.8497 F3000
+G1 X6.820 Y1.000 Z-6.8321 F3000
+G1 X6.840 Y1.000 Z-6.8145 F3000
+G1 X6.860 Y1.000 Z-6.7970 F3000
+G1 X6.880 Y1.000 Z-6.7795 F3000
+G1 X6.900 Y1.000 Z-6.7620 F3000
+G1 X6.920 Y1.000 Z-6.7446 F3000
+G1 X6.940 Y1.000 Z-6.7273 F3000
+G1 X6.960 Y1.000 Z-6.7100 F3000
+G1 X6.980 Y1.000 Z-6.6927 F3000
+G1 X7.000 Y1.000 Z-6.6755 F3000
+G1 X7.020 Y1.000 Z-6.6583 F3000
+G1 X7.040 Y1.000 Z-6.6412 F3000
+G1 X7.060 Y1.000 Z-6.6242 F3000
+G1 X7.080 Y1.000 Z-6.6071 F3000
+G1 X7.100 Y1.000 Z-6.5901 F3000
+G1 X7.120 Y1.000 Z-6.5732 F3000
+G1 X7.140 Y1.000 Z-6.5563 F3000
+G1 X7.160 Y1.000 Z-6.5394 F3000
+G1 X7.180 Y1.000 Z-6.5226 F3000
+G1 X7.200 Y1.000 Z-6.5059 F3000
+G1 X7.220 Y1.000 Z-6.4892 F3000
+G1 X7.240 Y1.000 Z-6.4725 F3000
+G1 X7.260 Y1.000 Z-6.4559 F3000
+G1 X7.280 Y1.000 Z-6.4393 F3000
+G1 X7.300 Y1.000 Z-6.4227 F3000
+G1 X7.320 Y1.000 Z-6.4062 F3000
+G1 X7.340 Y1.000 Z-6.3898 F3000
+G1 X7.360 Y1.000 Z-6.3734 F3000
+G1 X7.380 Y1.000 Z-6.3570 F3000
+G1 X7.400 Y1.000 Z-6.3407 F3000
+G1 X7.420 Y1.000 Z-6.3244 F3000
+G1 X7.440 Y1.000 Z-6.3082 F3000
+G1 X7.460 Y1.000 Z-6.2920 F3000
+G1 X7.480 Y1.000 Z-6.2758 F3000
+G1 X7.500 Y1.000 Z-6.2597 F3000
+G1 X7.520 Y1.000 Z-6.2437 F3000
+G1 X7.540 Y1.000 Z-6.2276 F3000
+G1 X7.560 Y1.000 Z-6.2117 F3000
+G1 X7.580 Y1.000 Z-6.1957 F3000
+G1 X7.600 Y1.000 Z-6.1798 F3000
+G1 X7.620 Y1.000 Z-6.1640 F3000
+G1 X7.640 Y1.000 Z-6.1482 F3000
+G1 X7.660 Y1.000 Z-6.1324 F3000
+G1 X7.680 Y1.000 Z-6.1166 F3000
+G1 X7.700 Y1.000 Z-6.1010 F3000
+G1 X7.720 Y1.000 Z-6.0853 F3000
+G1 X7.740 Y1.000 Z-6.0697 F3000
+G1 X7.760 Y1.000 Z-6.0541 F3000
+G1 X7.780 Y1.000 Z-6.0386 F3000
+G1 X7.800 Y1.000 Z-6.0231 F3000
+G1 X7.820 Y1.000 Z-6.0077 F3000
+G1 X7.840 Y1.000 Z-5.9923 F3000
+G1 X7.860 Y1.000 Z-5.9769 F3000
+G1 X7.880 Y1.000 Z-5.9616 F3000
+G1 X7.900 Y1.000 Z-5.9463 F3000
+G1 X7.920 Y1.000 Z-5.9310 F3000
+G1 X7.940 Y1.000 Z-5.9158 F3000
+G1 X7.960 Y1.000 Z-5.9007 F3000
+G1 X7.980 Y1.000 Z-5.8856 F3000
+G1 X8.000 Y1.000 Z-5.8705 F3000
+G1 X8.020 Y1.000 Z-5.8554 F3000
+G1 X8.040 Y1.000 Z-5.8404 F3000
+G1 X8.060 Y1.000 Z-5.8254 F3000
+G1 X8.080 Y1.000 Z-5.8105 F3000
+G1 X8.100 Y1.000 Z-5.7956 F3000
+G1 X8.120 Y1.000 Z-5.7808 F3000
+G1 X8.140 Y1.000 Z-5.7660 F3000
+G1 X8.160 Y1.000 Z-5.7512 F3000
+G1 X8.180 Y1.000 Z-5.7365 F3000
+G1 X8.200 Y1.000 Z-5.7218 F3000
+G1 X8.220 Y1.000 Z-5.7071 F3000
+G1 X8.240 Y1.000 Z-5.6925 F3000
+G1 X8.260 Y1.000 Z-5.6779 F3000
+G1 X8.280 Y1.000 Z-5.6633 F3000
+G1 X8.300 Y1.000 Z-5.6488 F3000
+G1 X8.320 Y1.000 Z-5.6344 F3000
+G1 X8.340 Y1.000 Z-5.6199 F3000
+G1 X8.360 Y1.000 Z-5.6055 F3000
+G1 X8.380 Y1.000 Z-5.5912 F3000
+G1 X8.400 Y1.000 Z-5.5769 F3000
+G1 X8.420 Y1.000 Z-5.5626 F3000
+G1 X8.440 Y1.000 Z-5.5483 F3000
+G1 X8.460 Y1.000 Z-5.5341 F3000
+G1 X8.480 Y1.000 Z-5.5200 F3000
+G1 X8.500 Y1.000 Z-5.5058 F3000
+G1 X8.520 Y1.000 Z-5.4917 F3000
+G1 X8.540 Y1.000 Z-5.4777 F3000
+G1 X8.560 Y1.000 Z-5.4636 F3000
+G1 X8.580 Y1.000 Z-5.4497 F3000
+G1 X8.600 Y1.000 Z-5.4357 F3000
+G1 X8.620 Y1.000 Z-5.4218 F3000
+G1 X8.640 Y1.000 Z-5.4079 F3000
+G1 X8.660 Y1.000 Z-5.3941 F3000
+G1 X8.680 Y1.000 Z-5.3803 F3000
+G1 X8.700 Y1.000 Z-5.3665 F3000
+G1 X8.720 Y1.000 Z-5.3528 F3000
+G1 X8.740 Y1.000 Z-5.3391 F3000
+G1 X8.760 Y1.000 Z-5.3254 F3000
+G1 X8.780 Y1.000 Z-5.3118 F3000
+G1 X8.800 Y1.000 Z-5.2982 F3000
+G1 X8.820 Y1.000 Z-5.2846 F3000
+G1 X8.840 Y1.000 Z-5.2711 F3000
+G1 X8.860 Y1.000 Z-5.2576 F3000
+G1 X8.880 Y1.000 Z-5.2442 F3000
+G1 X8.900 Y1.000 Z-5.2308 F3000
+G1 X8.920 Y1.000 Z-5.2174 F3000
+G1 X8.940 Y1.000 Z-5.2040 F3000
+G1 X8.960 Y1.000 Z-5.1907 F3000
+G1 X8.980 Y1.000 Z-5.1774 F3000
+G1 X9.000 Y1.000 Z-5.1642 F3000
+G1 X9.020 Y1.000 Z-5.1510 F3000
+G1 X9.040 Y1.000 Z-5.1378 F3000
+G1 X9.060 Y1.000 Z-5.1247 F3000
+G1 X9.080 Y1.000 Z-5.1116 F3000
+G1 X9.100 Y1.000 Z-5.0985 F3000
+G1 X9.120 Y1.000 Z-5.0855 F3000
+G1 X9.140 Y1.000 Z-5.0725 F3000
+G1 X9.160 Y1.000 Z-5.0595 F3000
+G1 X9.180 Y1.000 Z-5.0466 F3000
+G1 X9.200 Y1.000 Z-5.0337 F3000
+G1 X9.220 Y1.000 Z-5.0208 F3000
+G1 X9.240 Y1.000 Z-5.0080 F3000
+G1 X9.260 Y1.000 Z-4.9952 F3000
+G1 X9.280 Y1.000 Z-4.9824 F3000
+G1 X9.300 Y1.000 Z-4.9697 F3000
+G1 X9.320 Y1.000 Z-4.9570 F3000
+G1 X9.340 Y1.000 Z-4.9443 F3000
+G1 X9.360 Y1.000 Z-4.9317 F3000
+G1 X9.380 Y1.000 Z-4.9191 F3000
+G1 X9.400 Y1.000 Z-4.9065 F3000
+G1 X9.420 Y1.000 Z-4.8940 F3000
+G1 X9.440 Y1.000 Z-4.8815 F3000
+G1 X9.460 Y1.000 Z-4.8690 F3000
+G1 X9.480 Y1.000 Z-4.8566 F3000
+G1 X9.500 Y1.000 Z-4.8442 F3000
+G1 X9.520 Y1.000 Z-4.8318 F3000
+G1 X9.540 Y1.000 Z-4.8195 F3000
+G1 X9.560 Y1.000 Z-4.8072 F3000
+G1 X9.580 Y1.000 Z-4.7949 F3000
+G1 X9.600 Y1.000 Z-4.7827 F3000
+G1 X9.620 Y1.000 Z-4.7704 F3000
+G1 X9.640 Y1.000 Z-4.7583 F3000
+G1 X9.660 Y1.000 Z-4.7461 F3000
+G1 X9.680 Y1.000 Z-4.7340 F3000
+G1 X9.700 Y1.000 Z-4.7219 F3000
+G1 X9.720 Y1.000 Z-4.7099 F3000
+G1 X9.740 Y1.000 Z-4.6979 F3000
+G1 X9.760 Y1.000 Z-4.6859 F3000
+G1 X9.780 Y1.000 Z-4.6739 F3000
+G1 X9.800 Y1.000 Z-4.6620 F3000
+G1 X9.820 Y1.000 Z-4.6501 F3000
+G1 X9.840 Y1.000 Z-4.6383 F3000
+G1 X9.860 Y1.000 Z-4.6265 F3000
+G1 X9.880 Y1.000 Z-4.6147 F3000
+G1 X9.900 Y1.000 Z-4.6029 F3000
+G1 X9.920 Y1.000 Z-4.5912 F3000
+G1 X9.940 Y1.000 Z-4.5795 F3000
+G1 X9.960 Y1.000 Z-4.5678 F3000
+G1 X9.980 Y1.000 Z-4.5562 F3000
+G1 X10.000 Y1.000 Z-4.5446 F3000
+G1 X10.020 Y1.000 Z-4.5330 F3000
+G1 X10.040 Y1.000 Z-4.5214 F3000
+G1 X10.060 Y1.000 Z-4.5099 F3000
+G1 X10.080 Y1.000 Z-4.4985 F3000
+G1 X10.100 Y1.000 Z-4.4870 F3000
+G1 X10.120 Y1.000 Z-4.4756 F3000
+G1 X10.140 Y1.000 Z-4.4642 F3000
+G1 X10.160 Y1.000 Z-4.4528 F3000
+G1 X10.180 Y1.000 Z-4.4415 F3000
+G1 X10.200 Y1.000 Z-4.4302 F3000
+G1 X10.220 Y1.000 Z-4.4189 F3000
+G1 X10.240 Y1.000 Z-4.4077 F3000
+G1 X10.260 Y1.000 Z-4.3965 F3000
+G1 X10.280 Y1.000 Z-4.3853 F3000
+G1 X10.300 Y1.000 Z-4.3742 F3000
+G1 X10.320 Y1.000 Z-4.3630 F3000
+G1 X10.340 Y1.000 Z-4.3520 F3000
+G1 X10.360 Y1.000 Z-4.3409 F3000
+G1 X10.380 Y1.000 Z-4.3299 F3000
+G1 X10.400 Y1.000 Z-4.3189 F3000
+G1 X10.420 Y1.000 Z-4.3079 F3000
+G1 X10.440 Y1.000 Z-4.2970 F3000
+G1 X10.460 Y1.000 Z-4.2861 F3000
+G1 X10.480 Y1.000 Z-4.2752 F3000
+G1 X10.500 Y1.000 Z-4.2643 F3000
+G1 X10.520 Y1.000 Z-4.2535 F3000
+G1 X10.540 Y1.000 Z-4.2427 F3000
+G1 X10.560 Y1.000 Z-4.2319 F3000
+G1 X10.580 Y1.000 Z-4.2212 F3000
+G1 X10.600 Y1.000 Z-4.2105 F3000
+G1 X10.620 Y1.000 Z-4.1998 F3000
+G1 X10.640 Y1.000 Z-4.1892 F3000
+G1 X10.660 Y1.000 Z-4.1786 F3000
+G1 X10.680 Y1.000 Z-4.1680 F3000
+G1 X10.700 Y1.000 Z-4.1574 F3000
+G1 X10.720 Y1.000 Z-4.1469 F3000
+G1 X10.740 Y1.000 Z-4.1364 F3000
+G1 X10.760 Y1.000 Z-4.1259 F3000
+G1 X10.780 Y1.000 Z-4.1155 F3000
+G1 X10.800 Y1.000 Z-4.1051 F3000
+G1 X10.820 Y1.000 Z-4.0947 F3000
+G1 X10.840 Y1.000 Z-4.0843 F3000
+G1 X10.860 Y1.000 Z-4.0740 F3000
+G1 X10.880 Y1.000 Z-4.0637 F3000
+G1 X10.900 Y1.000 Z-4.0535 F3000
+G1 X10.920 Y1.000 Z-4.0432 F3000
+G1 X10.940 Y1.000 Z-4.0330 F3000
+G1 X10.960 Y1.000 Z-4.0228 F3000
+G1 X10.980 Y1.000 Z-4.0127 F3000
+G1 X11.000 Y1.000 Z-4.0025 F3000
+G1 X11.020 Y1.000 Z-3.9924 F3000
+G1 X11.040 Y1.000 Z-3.9824 F3000
+G1 X11.060 Y1.000 Z-3.9723 F3000
+G1 X11.080 Y1.000 Z-3.9623 F3000
+G1 X11.100 Y1.000 Z-3.9523 F3000
+G1 X11.120 Y1.000 Z-3.9424 F3000
+G1 X11.140 Y1.000 Z-3.9324 F3000
+G1 X11.160 Y1.000 Z-3.9225 F3000
+G1 X11.180 Y1.000 Z-3.9126 F3000
+G1 X11.200 Y1.000 Z-3.9028 F3000
+G1 X11.220 Y1.000 Z-3.8930 F3000
+G1 X11.240 Y1.000 Z-3.8832 F3000
+G1 X11.260 Y1.000 Z-3.8734 F3000
+G1 X11.280 Y1.000 Z-3.8637 F3000
+G1 X11.300 Y1.000 Z-3.8540 F3000
+G1 X11.320 Y1.000 Z-3.8443 F3000
+G1 X11.340 Y1.000 Z-3.8346 F3000
+G1 X11.360 Y1.000 Z-3.8250 F3000
+G1 X11.380 Y1.000 Z-3.8154 F3000
+G1 X11.400 Y1.000 Z-3.8058 F3000
+G1 X11.420 Y1.000 Z-3.7963 F3000
+G1 X11.440 Y1.000 Z-3.7868 F3000
+G1 X11.460 Y1.000 Z-3.7773 F3000
+G1 X11.480 Y1.000 Z-3.7678 F3000
+G1 X11.500 Y1.000 Z-3.7584 F3000
+G1 X11.520 Y1.000 Z-3.7490 F3000
+G1 X11.540 Y1.000 Z-3.7396 F3000
+G1 X11.560 Y1.000 Z-3.7302 F3000
+G1 X11.580 Y1.000 Z-3.7209 F3000
+G1 X11.600 Y1.000 Z-3.7116 F3000
+G1 X11.620 Y1.000 Z-3.7023 F3000
+G1 X11.640 Y1.000 Z-3.6931 F3000
+G1 X11.660 Y1.000 Z-3.6839 F3000
+G1 X11.680 Y1.000 Z-3.6747 F3000
+G1 X11.700 Y1.000 Z-3.6655 F3000
+G1 X11.720 Y1.000 Z-3.6564 F3000
+G1 X11.740 Y1.000 Z-3.6472 F3000
+G1 X11.760 Y1.000 Z-3.6382 F3000
+G1 X11.780 Y1.000 Z-3.6291 F3000
+G1 X11.800 Y1.000 Z-3.6201 F3000
+G1 X11.820 Y1.000 Z-3.6111 F3000
+G1 X11.840 Y1.000 Z-3.6021 F3000
+G1 X11.860 Y1.000 Z-3.5931 F3000
+G1 X11.880 Y1.000 Z-3.5842 F3000
+G1 X11.900 Y1.000 Z-3.5753 F3000
+G1 X11.920 Y1.000 Z-3.5664 F3000
+G1 X11.940 Y1.000 Z-3.5576 F3000
+G1 X11.960 Y1.000 Z-3.5487 F3000
+G1 X11.980 Y1.000 Z-3.5399 F3000
+G1 X12.000 Y1.000 Z-3.5312 F3000
+G1 X12.020 Y1.000 Z-3.5224 F3000
+G1 X12.040 Y1.000 Z-3.5137 F3000
+G1 X12.060 Y1.000 Z-3.5050 F3000
+G1 X12.080 Y1.000 Z-3.4964 F3000
+G1 X12.100 Y1.000 Z-3.4877 F3000
+G1 X12.120 Y1.000 Z-3.4791 F3000
+G1 X12.140 Y1.000 Z-3.4705 F3000
+G1 X12.160 Y1.000 Z-3.4619 F3000
+G1 X12.180 Y1.000 Z-3.4534 F3000
+G1 X12.200 Y1.000 Z-3.4449 F3000
+G1 X12.220 Y1.000 Z-3.4364 F3000
+G1 X12.240 Y1.000 Z-3.4279 F3000
+G1 X12.260 Y1.000 Z-3.4195 F3000
+G1 X12.280 Y1.000 Z-3.4111 F3000
+G1 X12.300 Y1.000 Z-3.4027 F3000
+G1 X12.320 Y1.000 Z-3.3944 F3000
+G1 X12.340 Y1.000 Z-3.3860 F3000
+G1 X12.360 Y1.000 Z-3.3777 F3000
+G1 X12.380 Y1.000 Z-3.3694 F3000
+G1 X12.400 Y1.000 Z-3.3612 F3000
+G1 X12.420 Y1.000 Z-3.3530 F3000
+G1 X12.440 Y1.000 Z-3.3447 F3000
+G1 X12.460 Y1.000 Z-3.3366 F3000
+G1 X12.480 Y1.000 Z-3.3284 F3000
+G1 X12.500 Y1.000 Z-3.3203 F3000
+G1 X12.520 Y1.000 Z-3.3122 F3000
+G1 X12.540 Y1.000 Z-3.3041 F3000
+G1 X12.560 Y1.000 Z-3.2960 F3000
+G1 X12.580 Y1.000 Z-3.2880 F3000
+G1 X12.600 Y1.000 Z-3.2800 F3000
+G1 X12.620 Y1.000 Z-3.2720 F3000
+G1 X12.640 Y1.000 Z-3.2641 F3000
+G1 X12.660 Y1.000 Z-3.2561 F3000
+G1 X12.680 Y1.000 Z-3.2482 F3000
+G1 X12.700 Y1.000 Z-3.2404 F3000
+G1 X12.720 Y1.000 Z-3.2325 F3000
+G1 X12.740 Y1.000 Z-3.2247 F3000
+G1 X12.760 Y1.000 Z-3.2169 F3000
+G1 X12.780 Y1.000 Z-3.2091 F3000
+G1 X12.800 Y1.000 Z-3.2013 F3000
+G1 X12.820 Y1.000 Z-3.1936 F3000
+G1 X12.840 Y1.000 Z-3.1859 F3000
+G1 X12.860 Y1.000 Z-3.1782 F3000
+G1 X12.880 Y1.000 Z-3.1706 F3000
+G1 X12.900 Y1.000 Z-3.1629 F3000
+G1 X12.920 Y1.000 Z-3.1553 F3000
+G1 X12.940 Y1.000 Z-3.1478 F3000
+G1 X12.960 Y1.000 Z-3.1402 F3000
+G1 X12.980 Y1.000 Z-3.1327 F3000
+G1 X13.000 Y1.000 Z-3.1252 F3000
+G1 X13.020 Y1.000 Z-3.1177 F3000
+G1 X13.040 Y1.000 Z-3.1102 F3000
+G1 X13.060 Y1.000 Z-3.1028 F3000
+G1 X13.080 Y1.000 Z-3.0954 F3000
+G1 X13.100 Y1.000 Z-3.0880 F3000
+G1 X13.120 Y1.000 Z-3.0806 F3000
+G1 X13.140 Y1.000 Z-3.0733 F3000
+G1 X13.160 Y1.000 Z-3.0660 F3000
+G1 X13.180 Y1.000 Z-3.0587 F3000
+G1 X13.200 Y1.000 Z-3.0514 F3000
+G1 X13.220 Y1.000 Z-3.0442 F3000
+G1 X13.240 Y1.000 Z-3.0369 F3000
+G1 X13.260 Y1.000 Z-3.0297 F3000
+G1 X13.280 Y1.000 Z-3.0226 F3000
+G1 X13.300 Y1.000 Z-3.0154 F3000
+G1 X13.320 Y1.000 Z-3.0083 F3000
+G1 X13.340 Y1.000 Z-3.0012 F3000
+G1 X13.360 Y1.000 Z-2.9941 F3000
+G1 X13.380 Y1.000 Z-2.9871 F3000
+G1 X13.400 Y1.000 Z-2.9801 F3000
+G1 X13.420 Y1.000 Z-2.9731 F3000
+G1 X13.440 Y1.000 Z-2.9661 F3000
+G1 X13.460 Y1.000 Z-2.9591 F3000
+G1 X13.480 Y1.000 Z-2.9522 F3000
+G1 X13.500 Y1.000 Z-2.9453 F3000
+G1 X13.520 Y1.000 Z-2.9384 F3000
+G1 X13.540 Y1.000 Z-2.9316 F3000
+G1 X13.560 Y1.000 Z-2.9247 F3000
+G1 X13.580 Y1.000 Z-2.9179 F3000
+G1 X13.600 Y1.000 Z-2.9111 F3000
+G1 X13.620 Y1.000 Z-2.9043 F3000
+G1 X13.640 Y1.000 Z-2.8976 F3000
+G1 X13.660 Y1.000 Z-2.8909 F3000
+G1 X13.680 Y1.000 Z-2.8842 F3000
+G1 X13.700 Y1.000 Z-2.8775 F3000
+G1 X13.720 Y1.000 Z-2.8709 F3000
+G1 X13.740 Y1.000 Z-2.8643 F3000
+G1 X13.760 Y1.000 Z-2.8577 F3000
+G1 X13.780 Y1.000 Z-2.8511 F3000
+G1 X13.800 Y1.000 Z-2.8445 F3000
+G1 X13.820 Y1.000 Z-2.8380 F3000
+G1 X13.840 Y1.000 Z-2.8315 F3000
+G1 X13.860 Y1.000 Z-2.8250 F3000
+G1 X13.880 Y1.000 Z-2.8185 F3000
+G1 X13.900 Y1.000 Z-2.8121 F3000
+G1 X13.920 Y1.000 Z-2.8057 F3000
+G1 X13.940 Y1.000 Z-2.7993 F3000
+G1 X13.960 Y1.000 Z-2.7929 F3000
+G1 X13.980 Y1.000 Z-2.7866 F3000
+G1 X14.000 Y1.000 Z-2.7803 F3000
+G1 X14.020 Y1.000 Z-2.7740 F3000
+G1 X14.040 Y1.000 Z-2.7677 F3000
+G1 X14.060 Y1.000 Z-2.7614 F3000
+G1 X14.080 Y1.000 Z-2.7552 F3000
+G1 X14.100 Y1.000 Z-2.7490 F3000
+G1 X14.120 Y1.000 Z-2.7428 F3000
+G1 X14.140 Y1.000 Z-2.7367 F3000
+G1 X14.160 Y1.000 Z-2.7305 F3000
+G1 X14.180 Y1.000 Z-2.7244 F3000
+G1 X14.200 Y1.000 Z-2.7183 F3000
+G1 X14.220 Y1.000 Z-2.7123 F3000
+G1 X14.240 Y1.000 Z-2.7062 F3000
+G1 X14.260 Y1.000 Z-2.7002 F3000
+G1 X14.280 Y1.000 Z-2.6942 F3000
+G1 X14.300 Y1.000 Z-2.6882 F3000
+G1 X14.320 Y1.000 Z-2.6823 F3000
+G1 X14.340 Y1.000 Z-2.6763 F3000
+G1 X14.360 Y1.000 Z-2.6704 F3000
+G1 X14.380 Y1.000 Z-2.6645 F3000
+G1 X14.400 Y1.000 Z-2.6587 F3000
+G1 X14.420 Y1.000 Z-2.6528 F3000
+G1 X14.440 Y1.000 Z-2.6470 F3000
+G1 X14.460 Y1.000 Z-2.6412 F3000
+G1 X14.480 Y1.000 Z-2.6355 F3000
+G1 X14.500 Y1.000 Z-2.6297 F3000
+G1 X14.520 Y1.000 Z-2.6240 F3000
+G1 X14.540 Y1.000 Z-2.6183 F3000
+G1 X14.560 Y1.000 Z-2.6126 F3000
+G1 X14.580 Y1.000 Z-2.6069 F3000
+G1 X14.600 Y1.000 Z-2.6013 F3000
+G1 X14.620 Y1.000 Z-2.5957 F3000
+G1 X14.640 Y1.000 Z-2.5901 F3000
+G1 X14.660 Y1.000 Z-2.5845 F3000
+G1 X14.680 Y1.000 Z-2.5790 F3000
+G1 X14.700 Y1.000 Z-2.5735 F3000
+G1 X14.720 Y1.000 Z-2.5680 F3000
+G1 X14.740 Y1.000 Z-2.5625 F3000
+G1 X14.760 Y1.000 Z-2.5570 F3000
+G1 X14.780 Y1.000 Z-2.5516 F3000
+G1 X14.800 Y1.000 Z-2.5462 F3000
+G1 X14.820 Y1.000 Z-2.5408 F3000
+G1 X14.840 Y1.000 Z-2.5354 F3000
+G1 X14.860 Y1.000 Z-2.5301 F3000
+G1 X14.880 Y1.000 Z-2.5247 F3000
+G1 X14.900 Y1.000 Z-2.5194 F3000
+G1 X14.920 Y1.000 Z-2.5142 F3000
+G1 X14.940 Y1.000 Z-2.5089 F3000
+G1 X14.960 Y1.000 Z-2.5037 F3000
+G1 X14.980 Y1.000 Z-2.4985 F3000
+G1 X15.000 Y1.000 Z-2.4933 F3000
+G1 X15.020 Y1.000 Z-2.4881 F3000
+G1 X15.040 Y1.000 Z-2.4830 F3000
+G1 X15.060 Y1.000 Z-2.4778 F3000
+G1 X15.080 Y1.000 Z-2.4727 F3000
+G1 X15.100 Y1.000 Z-2.4676 F3000
+G1 X15.120 Y1.000 Z-2.4626 F3000
+G1 X15.140 Y1.000 Z-2.4575 F3000
+G1 X15.160 Y1.000 Z-2.4525 F3000
+G1 X15.180 Y1.000 Z-2.4475 F3000
+G1 X15.200 Y1.000 Z-2.4426 F3000
+G1 X15.220 Y1.000 Z-2.4376 F3000
+G1 X15.240 Y1.000 Z-2.4327 F3000
+G1 X15.260 Y1.000 Z-2.4278 F3000
+G1 X15.280 Y1.000 Z-2.4229 F3000
+G1 X15.300 Y1.000 Z-2.4180 F3000
+G1 X15.320 Y1.000 Z-2.4132 F3000
+G1 X15.340 Y1.000 Z-2.4084 F3000
+G1 X15.360 Y1.000 Z-2.4036 F3000
+G1 X15.380 Y1.000 Z-2.3988 F3000
+G1 X15.400 Y1.000 Z-2.3941 F3000
+G1 X15.420 Y1.000 Z-2.3893 F3000
+G1 X15.440 Y1.000 Z-2.3846 F3000
+G1 X15.460 Y1.000 Z-2.3799 F3000
+G1 X15.480 Y1.000 Z-2.3753 F3000
+G1 X15.500 Y1.000 Z-2.3706 F3000
+G1 X15.520 Y1.000 Z-2.3660 F3000
+G1 X15.540 Y1.000 Z-2.3614 F3000
+G1 X15.560 Y1.000 Z-2.3568 F3000
+G1 X15.580 Y1.000 Z-2.3523 F3000
+G1 X15.600 Y1.000 Z-2.3478 F3000
+G1 X15.620 Y1.000 Z-2.3432 F3000
+G1 X15.640 Y1.000 Z-2.3387 F3000
+G1 X15.660 Y1.000 Z-2.3343 F3000
+G1 X15.680 Y1.000 Z-2.3298 F3000
+G1 X15.700 Y1.000 Z-2.3254 F3000
+G1 X15.720 Y1.000 Z-2.3210 F3000
+G1 X15.740 Y1.000 Z-2.3166 F3000
+G1 X15.760 Y1.000 Z-2.3123 F3000
+G1 X15.780 Y1.000 Z-2.3079 F3000
+G1 X15.800 Y1.000 Z-2.3036 F3000
+G1 X15.820 Y1.000 Z-2.2993 F3000
+G1 X15.840 Y1.000 Z-2.2950 F3000
+G1 X15.860 Y1.000 Z-2.2908 F3000
+G1 X15.880 Y1.000 Z-2.2865 F3000
+G1 X15.900 Y1.000 Z-2.2823 F3000
+G1 X15.920 Y1.000 Z-2.2781 F3000
+G1 X15.940 Y1.000 Z-2.2740 F3000
+G1 X15.960 Y1.000 Z-2.2698 F3000
+G1 X15.980 Y1.000 Z-2.2657 F3000
+G1 X16.000 Y1.000 Z-2.2616 F3000
+G1 X16.020 Y1.000 Z-2.2575 F3000
+G1 X16.040 Y1.000 Z-2.2534 F3000
+G1 X16.060 Y1.000 Z-2.2494 F3000
+G1 X16.080 Y1.000 Z-2.2454 F3000
+G1 X16.100 Y1.000 Z-2.2414 F3000
+G1 X16.120 Y1.000 Z-2.2374 F3000
+G1 X16.140 Y1.000 Z-2.2334 F3000
+G1 X16.160 Y1.000 Z-2.2295 F3000
+G1 X16.180 Y1.000 Z-2.2256 F3000
+G1 X16.200 Y1.000 Z-2.2217 F3000
+G1 X16.220 Y1.000 Z-2.2178 F3000
+G1 X16.240 Y1.000 Z-2.2140 F3000
+G1 X16.260 Y1.000 Z-2.2101 F3000
+G1 X16.280 Y1.000 Z-2.2063 F3000
+G1 X16.300 Y1.000 Z-2.2026 F3000
+G1 X16.320 Y1.000 Z-2.1988 F3000
+G1 X16.340 Y1.000 Z-2.1950 F3000
+G1 X16.360 Y1.000 Z-2.1913 F3000
+G1 X16.380 Y1.000 Z-2.1876 F3000
+G1 X16.400 Y1.000 Z-2.1839 F3000
+G1 X16.420 Y1.000 Z-2.1803 F3000
+G1 X16.440 Y1.000 Z-2.1766 F3000
+G1 X16.460 Y1.000 Z-2.1730 F3000
+G1 X16.480 Y1.000 Z-2.1694 F3000
+G1 X16.500 Y1.000 Z-2.1658 F3000
+G1 X16.520 Y1.000 Z-2.1623 F3000
+G1 X16.540 Y1.000 Z-2.1588 F3000
+G1 X16.560 Y1.000 Z-2.1552 F3000
+G1 X16.580 Y1.000 Z-2.1518 F3000
+G1 X16.600 Y1.000 Z-2.1483 F3000
+G1 X16.620 Y1.000 Z-2.1448 F3000
+G1 X16.640 Y1.000 Z-2.1414 F3000
+G1 X16.660 Y1.000 Z-2.1380 F3000
+G1 X16.680 Y1.000 Z-2.1346 F3000
+G1 X16.700 Y1.000 Z-2.1312 F3000
+G1 X16.720 Y1.000 Z-2.1279 F3000
+G1 X16.740 Y1.000 Z-2.1246 F3000
+G1 X16.760 Y1.000 Z-2.1213 F3000
+G1 X16.780 Y1.000 Z-2.1180 F3000
+G1 X16.800 Y1.000 Z-2.1147 F3000
+G1 X16.820 Y1.000 Z-2.1115 F3000
+G1 X16.840 Y1.000 Z-2.1083 F3000
+G1 X16.860 Y1.000 Z-2.1051 F3000
+G1 X16.880 Y1.000 Z-2.1019 F3000
+G1 X16.900 Y1.000 Z-2.0987 F3000
+G1 X16.920 Y1.000 Z-2.0956 F3000
+G1 X16.940 Y1.000 Z-2.0925 F3000
+G1 X16.960 Y1.000 Z-2.0894 F3000
+G1 X16.980 Y1.000 Z-2.0863 F3000
+G1 X17.000 Y1.000 Z-2.0833 F3000
+G1 X17.020 Y1.000 Z-2.0802 F3000
+G1 X17.040 Y1.000 Z-2.0772 F3000
+G1 X17.060 Y1.000 Z-2.0742 F3000
+G1 X17.080 Y1.000 Z-2.0712 F3000
+G1 X17.100 Y1.000 Z-2.0683 F3000
+G1 X17.120 Y1.000 Z-2.0654 F3000
+G1 X17.140 Y1.000 Z-2.0625 F3000
+G1 X17.160 Y1.000 Z-2.0596 F3000
+G1 X17.180 Y1.000 Z-2.0567 F3000
+G1 X17.200 Y1.000 Z-2.0539 F3000
+G1 X17.220 Y1.000 Z-2.0510 F3000
+G1 X17.240 Y1.000 Z-2.0482 F3000
+G1 X17.260 Y1.000 Z-2.0454 F3000
+G1 X17.280 Y1.000 Z-2.0427 F3000
+G1 X17.300 Y1.000 Z-2.0399 F3000
+G1 X17.320 Y1.000 Z-2.0372 F3000
+G1 X17.340 Y1.000 Z-2.0345 F3000
+G1 X17.360 Y1.000 Z-2.0318 F3000
+G1 X17.380 Y1.000 Z-2.0292 F3000
+G1 X17.400 Y1.000 Z-2.0265 F3000
+G1 X17.420 Y1.000 Z-2.0239 F3000
+G1 X17.440 Y1.000 Z-2.0213 F3000
+G1 X17.460 Y1.000 Z-2.0187 F3000
+G1 X17.480 Y1.000 Z-2.0162 F3000
+G1 X17.500 Y1.000 Z-2.0136 F3000
+G1 X17.520 Y1.000 Z-2.0111 F3000
+G1 X17.540 Y1.000 Z-2.0086 F3000
+G1 X17.560 Y1.000 Z-2.0062 F3000
+G1 X17.580 Y1.000 Z-2.0037 F3000
+G1 X17.600 Y1.000 Z-2.0013 F3000
+G1 X17.620 Y1.000 Z-1.9988 F3000
+G1 X17.640 Y1.000 Z-1.9965 F3000
+G1 X17.660 Y1.000 Z-1.9941 F3000
+G1 X17.680 Y1.000 Z-1.9917 F3000
+G1 X17.700 Y1.000 Z-1.9894 F3000
+G1 X17.720 Y1.000 Z-1.9871 F3000
+G1 X17.740 Y1.000 Z-1.9848 F3000
+G1 X17.760 Y1.000 Z-1.9825 F3000
+G1 X17.780 Y1.000 Z-1.9803 F3000
+G1 X17.800 Y1.000 Z-1.9780 F3000
+G1 X17.820 Y1.000 Z-1.9758 F3000
+G1 X17.840 Y1.000 Z-1.9736 F3000
+G1 X17.860 Y1.000 Z-1.9715 F3000
+G1 X17.880 Y1.000 Z-1.9693 F3000
+G1 X17.900 Y1.000 Z-1.9672 F3000
+G1 X17.920 Y1.000 Z-1.9651 F3000
+G1 X17.940 Y1.000 Z-1.9630 F3000
+G1 X17.960 Y1.000 Z-1.9609 F3000
+G1 X17.980 Y1.000 Z-1.9589 F3000
+G1 X18.000 Y1.000 Z-1.9569 F3000
+G1 X18.020 Y1.000 Z-1.9549 F3000
+G1 X18.040 Y1.000 Z-1.9529 F3000
+G1 X18.060 Y1.000 Z-1.9509 F3000
+G1 X18.080 Y1.000 Z-1.9490 F3000
+G1 X18.100 Y1.000 Z-1.9470 F3000
+G1 X18.120 Y1.000 Z-1.9451 F3000
+G1 X18.140 Y1.000 Z-1.9433 F3000
+G1 X18.160 Y1.000 Z-1.9414 F3000
+G1 X18.180 Y1.000 Z-1.9395 F3000
+G1 X18.200 Y1.000 Z-1.9377 F3000
+G1 X18.220 Y1.000 Z-1.9359 F3000
+G1 X18.240 Y1.000 Z-1.9341 F3000
+G1 X18.260 Y1.000 Z-1.9324 F3000
+G1 X18.280 Y1.000 Z-1.9306 F3000
+G1 X18.300 Y1.000 Z-1.9289 F3000
+G1 X18.320 Y1.000 Z-1.9272 F3000
+G1 X18.340 Y1.000 Z-1.9255 F3000
+G1 X18.360 Y1.000 Z-1.9239 F3000
+G1 X18.380 Y1.000 Z-1.9222 F3000
+G1 X18.400 Y1.000 Z-1.9206 F3000
+G1 X18.420 Y1.000 Z-1.9190 F3000
+G1 X18.440 Y1.000 Z-1.9174 F3000
+G1 X18.460 Y1.000 Z-1.9159 F3000
+G1 X18.480 Y1.000 Z-1.9143 F3000
+G1 X18.500 Y1.000 Z-1.9128 F3000
+G1 X18.520 Y1.000 Z-1.9113 F3000
+G1 X18.540 Y1.000 Z-1.9098 F3000
+G1 X18.560 Y1.000 Z-1.9084 F3000
+G1 X18.580 Y1.000 Z-1.9069 F3000
+G1 X18.600 Y1.000 Z-1.9055 F3000
+G1 X18.620 Y1.000 Z-1.9041 F3000
+G1 X18.640 Y1.000 Z-1.9028 F3000
+G1 X18.660 Y1.000 Z-1.9014 F3000
+G1 X18.680 Y1.000 Z-1.9001 F3000
+G1 X18.700 Y1.000 Z-1.8987 F3000
+G1 X18.720 Y1.000 Z-1.8974 F3000
+G1 X18.740 Y1.000 Z-1.8962 F3000
+G1 X18.760 Y1.000 Z-1.8949 F3000
+G1 X18.780 Y1.000 Z-1.8937 F3000
+G1 X18.800 Y1.000 Z-1.8925 F3000
+G1 X18.820 Y1.000 Z-1.8913 F3000
+G1 X18.840 Y1.000 Z-1.8901 F3000
+G1 X18.860 Y1.000 Z-1.8889 F3000
+G1 X18.880 Y1.000 Z-1.8878 F3000
+G1 X18.900 Y1.000 Z-1.8867 F3000
+G1 X18.920 Y1.000 Z-1.8856 F3000
+G1 X18.940 Y1.000 Z-1.8845 F3000
+G1 X18.960 Y1.000 Z-1.8835 F3000
+G1 X18.980 Y1.000 Z-1.8824 F3000
+G1 X19.000 Y1.000 Z-1.8814 F3000
+G1 X19.020 Y1.000 Z-1.8804 F3000
+G1 X19.040 Y1.000 Z-1.8794 F3000
+G1 X19.060 Y1.000 Z-1.8785 F3000
+G1 X19.080 Y1.000 Z-1.8776 F3000
+G1 X19.100 Y1.000 Z-1.8766 F3000
+G1 X19.120 Y1.000 Z-1.8758 F3000
+G1 X19.140 Y1.000 Z-1.8749 F3000
+G1 X19.160 Y1.000 Z-1.8740 F3000
+G1 X19.180 Y1.000 Z-1.8732 F3000
+G1 X19.200 Y1.000 Z-1.8724 F3000
+G1 X19.220 Y1.000 Z-1.8716 F3000
+G1 X19.240 Y1.000 Z-1.8708 F3000
+G1 X19.260 Y1.000 Z-1.8701 F3000
+G1 X19.280 Y1.000 Z-1.8693 F3000
+G1 X19.300 Y1.000 Z-1.8686 F3000
+G1 X19.320 Y1.000 Z-1.8679 F3000
+G1 X19.340 Y1.000 Z-1.8673 F3000
+G1 X19.360 Y1.000 Z-1.8666 F3000
+G1 X19.380 Y1.000 Z-1.8660 F3000
+G1 X19.400 Y1.000 Z-1.8654 F3000
+G1 X19.420 Y1.000 Z-1.8648 F3000
+G1 X19.440 Y1.000 Z-1.8642 F3000
+G1 X19.460 Y1.000 Z-1.8636 F3000
+G1 X19.480 Y1.000 Z-1.8631 F3000
+G1 X19.500 Y1.000 Z-1.8626 F3000
+G1 X19.520 Y1.000 Z-1.8621 F3000
+G1 X19.540 Y1.000 Z-1.8616 F3000
+G1 X19.560 Y1.000 Z-1.8612 F3000
+G1 X19.580 Y1.000 Z-1.8608 F3000
+G1 X19.600 Y1.000 Z-1.8603 F3000
+G1 X19.620 Y1.000 Z-1.8599 F3000
+G1 X19.640 Y1.000 Z-1.8596 F3000
+G1 X19.660 Y1.000 Z-1.8592 F3000
+G1 X19.680 Y1.000 Z-1.8589 F3000
+G1 X19.700 Y1.000 Z-1.8586 F3000
+G1 X19.720 Y1.000 Z-1.8583 F3000
+G1 X19.740 Y1.000 Z-1.8580 F3000
+G1 X19.760 Y1.000 Z-1.8578 F3000
+G1 X19.780 Y1.000 Z-1.8575 F3000
+G1 X19.800 Y1.000 Z-1.8573 F3000
+G1 X19.820 Y1.000 Z-1.8571 F3000
+G1 X19.840 Y1.000 Z-1.8570 F3000
+G1 X19.860 Y1.000 Z-1.8568 F3000
+G1 X19.880 Y1.000 Z-1.8567 F3000
+G1 X19.900 Y1.000 Z-1.8566 F3000
+G1 X19.920 Y1.000 Z-1.8565 F3000
+G1 X19.940 Y1.000 Z-1.8564 F3000
+G1 X19.960 Y1.000 Z-1.8564 F3000
+G1 X19.980 Y1.000 Z-1.8563 F3000
+G1 X20.000 Y1.000 Z-1.8563 F3000
+G1 X20.020 Y1.000 Z-1.8563 F3000
+G1 X20.040 Y1.000 Z-1.8564 F3000
+G1 X20.060 Y1.000 Z-1.8564 F3000
+G1 X20.080 Y1.000 Z-1.8565 F3000
+G1 X20.100 Y1.000 Z-1.8566 F3000
+G1 X20.120 Y1.000 Z-1.8567 F3000
+G1 X20.140 Y1.000 Z-1.8568 F3000
+G1 X20.160 Y1.000 Z-1.8570 F3000
+G1 X20.180 Y1.000 Z-1.8571 F3000
+G1 X20.200 Y1.000 Z-1.8573 F3000
+G1 X20.220 Y1.000 Z-1.8575 F3000
+G1 X20.240 Y1.000 Z-1.8578 F3000
+G1 X20.260 Y1.000 Z-1.8580 F3000
+G1 X20.280 Y1.000 Z-1.8583 F3000
+G1 X20.300 Y1.000 Z-1.8586 F3000
+G1 X20.320 Y1.000 Z-1.8589 F3000
+G1 X20.340 Y1.000 Z-1.8592 F3000
+G1 X20.360 Y1.000 Z-1.8596 F3000
+G1 X20.380 Y1.000 Z-1.8599 F3000
+G1 X20.400 Y1.000 Z-1.8603 F3000
+G1 X20.420 Y1.000 Z-1.8608 F3000
+G1 X20.440 Y1.000 Z-1.8612 F3000
+G1 X20.460 Y1.000 Z-1.8616 F3000
+G1 X20.480 Y1.000 Z-1.8621 F3000
+G1 X20.500 Y1.000 Z-1.8626 F3000
+G1 X20.520 Y1.000 Z-1.8631 F3000
+G1 X20.540 Y1.000 Z-1.8636 F3000
+G1 X20.560 Y1.000 Z-1.8642 F3000
+G1 X20.580 Y1.000 Z-1.8648 F3000
+G1 X20.600 Y1.000 Z-1.8654 F3000
+G1 X20.620 Y1.000 Z-1.8660 F3000
+G1 X20.640 Y1.000 Z-1.8666 F3000
+G1 X20.660 Y1.000 Z-1.8673 F3000
+G1 X20.680 Y1.000 Z-1.8679 F3000
+G1 X20.700 Y1.000 Z-1.8686 F3000
+G1 X20.720 Y1.000 Z-1.8693 F3000
+G1 X20.740 Y1.000 Z-1.8701 F3000
+G1 X20.760 Y1.000 Z-1.8708 F3000
+G1 X20.780 Y1.000 Z-1.8716 F3000
+G1 X20.800 Y1.000 Z-1.8724 F3000
+G1 X20.820 Y1.000 Z-1.8732 F3000
+G1 X20.840 Y1.000 Z-1.8740 F3000
+G1 X20.860 Y1.000 Z-1.8749 F3000
+G1 X20.880 Y1.000 Z-1.8758 F3000
+G1 X20.900 Y1.000 Z-1.8766 F3000
+G1 X20.920 Y1.000 Z-1.8776 F3000
+G1 X20.940 Y1.000 Z-1.8785 F3000
+G1 X20.960 Y1.000 Z-1.8794 F3000
+G1 X20.980 Y1.000 Z-1.8804 F3000
+G1 X21.000 Y1.000 Z-1.8814 F3000
+G1 X21.020 Y1.000 Z-1.8824 F3000
+G1 X21.040 Y1.000 Z-1.8835 F3000
+G1 X21.060 Y1.000 Z-1.8845 F3000
+G1 X21.080 Y1.000 Z-1.8856 F3000
+G1 X21.100 Y1.000 Z-1.8867 F3000
+G1 X21.120 Y1.000 Z-1.8878 F3000
+G1 X21.140 Y1.000 Z-1.8889 F3000
+G1 X21.160 Y1.000 Z-1.8901 F3000
+G1 X21.180 Y1.000 Z-1.8913 F3000
+G1 X21.200 Y1.000 Z-1.8925 F3000
+G1 X21.220 Y1.000 Z-1.8937 F3000
+G1 X21.240 Y1.000 Z-1.8949 F3000
+G1 X21.260 Y1.000 Z-1.8962 F3000
+G1 X21.280 Y1.000 Z-1.8974 F3000
+G1 X21.300 Y1.000 Z-1.8987 F3000
+G1 X21.320 Y1.000 Z-1.9001 F3000
+G1 X21.340 Y1.000 Z-1.9014 F3000
+G1 X21.360 Y1.000 Z-1.9028 F3000
+G1 X21.380 Y1.000 Z-1.9041 F3000
+G1 X21.400 Y1.000 Z-1.9055 F3000
+G1 X21.420 Y1.000 Z-1.9069 F3000
+G1 X21.440 Y1.000 Z-1.9084 F3000
+G1 X21.460 Y1.000 Z-1.9098 F3000
+G1 X21.480 Y1.000 Z-1.9113 F3000
+G1 X21.500 Y1.000 Z-1.9128 F3000
+G1 X21.520 Y1.000 Z-1.9143 F3000
+G1 X21.540 Y1.000 Z-1.9159 F3000
+G1 X21.560 Y1.000 Z-1.9174 F3000
+G1 X21.580 Y1.000 Z-1.9190 F3000
+G1 X21.600 Y1.000 Z-1.9206 F3000
+G1 X21.620 Y1.000 Z-1.9222 F3000
+G1 X21.640 Y1.000 Z-1.9239 F3000
+G1 X21.660 Y1.000 Z-1.9255 F3000
+G1 X21.680 Y1.000 Z-1.9272 F3000
+G1 X21.700 Y1.000 Z-1.9289 F3000
+G1 X21.720 Y1.000 Z-1.9306 F3000
+G1 X21.740 Y1.000 Z-1.9324 F3000
+G1 X21.760 Y1.000 Z-1.9341 F3000
+G1 X21.780 Y1.000 Z-1.9359 F3000
+G1 X21.800 Y1.000 Z-1.9377 F3000
+G1 X21.820 Y1.000 Z-1.9395 F3000
+G1 X21.840 Y1.000 Z-1.9414 F3000
+G1 X21.860 Y1.000 Z-1.9433 F3000
+G1 X21.880 Y1.000 Z-1.9451 F3000
+G1 X21.900 Y1.000 Z-1.9470 F3000
+G1 X21.920 Y1.000 Z-1.9490 F3000
+G1 X21.940 Y1.000 Z-1.9509 F3000
+G1 X21.960 Y1.000 Z-1.9529 F3000
+G1 X21.980 Y1.000 Z-1.9549 F3000
+G1 X22.000 Y1.000 Z-1.9569 F3000
+G1 X22.020 Y1.000 Z-1.9589 F3000
+G1 X22.040 Y1.000 Z-1.9609 F3000
+G1 X22.060 Y1.000 Z-1.9630 F3000
+G1 X22.080 Y1.000 Z-1.9651 F3000
+G1 X22.100 Y1.000 Z-1.9672 F3000
+G1 X22.120 Y1.000 Z-1.9693 F3000
+G1 X22.140 Y1.000 Z-1.9715 F3000
+G1 X22.160 Y1.000 Z-1.9736 F3000
+G1 X22.180 Y1.000 Z-1.9758 F3000
+G1 X22.200 Y1.000 Z-1.9780 F3000
+G1 X22.220 Y1.000 Z-1.9803 F3000
+G1 X22.240 Y1.000 Z-1.9825 F3000
+G1 X22.260 Y1.000 Z-1.9848 F3000
+G1 X22.280 Y1.000 Z-1.9871 F3000
+G1 X22.300 Y1.000 Z-1.9894 F3000
+G1 X22.320 Y1.000 Z-1.9917 F3000
+G1 X22.340 Y1.000 Z-1.9941 F3000
+G1 X22.360 Y1.000 Z-1.9965 F3000
+G1 X22.380 Y1.000 Z-1.9988 F3000
+G1 X22.400 Y1.000 Z-2.0013 F3000
+G1 X22.420 Y1.000 Z-2.0037 F3000
+G1 X22.440 Y1.000 Z-2.0062 F3000
+G1 X22.460 Y1.000 Z-2.0086 F3000
+G1 X22.480 Y1.000 Z-2.0111 F3000
+G1 X22.500 Y1.000 Z-2.0136 F3000
+G1 X22.520 Y1.000 Z-2.0162 F3000
+G1 X22.540 Y1.000 Z-2.0187 F3000
+G1 X22.560 Y1.000 Z-2.0213 F3000
+G1 X22.580 Y1.000 Z-2.0239 F3000
+G1 X22.600 Y1.000 Z-2.0265 F3000
+G1 X22.620 Y1.000 Z-2.0292 F3000
+G1 X22.640 Y1.000 Z-2.0318 F3000
+G1 X22.660 Y1.000 Z-2.0345 F3000
+G1 X22.680 Y1.000 Z-2.0372 F3000
+G1 X22.700 Y1.000 Z-2.0399 F3000
+G1 X22.720 Y1.000 Z-2.0427 F3000
+G1 X22.740 Y1.000 Z-2.0454 F3000
+G1 X22.760 Y1.000 Z-2.0482 F3000
+G1 X22.780 Y1.000 Z-2.0510 F3000
+G1 X22.800 Y1.000 Z-2.0539 F3000
+G1 X22.820 Y1.000 Z-2.0567 F3000
+G1 X22.840 Y1.000 Z-2.0596 F3000
+G1 X22.860 Y1.000 Z-2.0625 F3000
+G1 X22.880 Y1.000 Z-2.0654 F3000
+G1 X22.900 Y1.000 Z-2.0683 F3000
+G1 X22.920 Y1.000 Z-2.0712 F3000
+G1 X22.940 Y1.000 Z-2.0742 F3000
+G1 X22.960 Y1.000 Z-2.0772 F3000
+G1 X22.980 Y1.000 Z-2.0802 F3000
+G1 X23.000 Y1.000 Z-2.0833 F3000
+G1 X23.020 Y1.000 Z-2.0863 F3000
+G1 X23.040 Y1.000 Z-2.0894 F3000
+G1 X23.060 Y1.000 Z-2.0925 F3000
+G1 X23.080 Y1.000 Z-2.0956 F3000
+G1 X23.100 Y1.000 Z-2.0987 F3000
+G1 X23.120 Y1.000 Z-2.1019 F3000
+G1 X23.140 Y1.000 Z-2.1051 F3000
+G1 X23.160 Y1.000 Z-2.1083 F3000
+G1 X23.180 Y1.000 Z-2.1115 F3000
+G1 X23.200 Y1.000 Z-2.1147 F3000
+G1 X23.220 Y1.000 Z-2.1180 F3000
+G1 X23.240 Y1.000 Z-2.1213 F3000
+G1 X23.260 Y1.000 Z-2.1246 F3000
+G1 X23.280 Y1.000 Z-2.1279 F3000
+G1 X23.300 Y1.000 Z-2.1312 F3000
+G1 X23.320 Y1.000 Z-2.1346 F3000
+G1 X23.340 Y1.000 Z-2.1380 F3000
+G1 X23.360 Y1.000 Z-2.1414 F3000
+G1 X23.380 Y1.000 Z-2.1448 F3000
+G1 X23.400 Y1.000 Z-2.1483 F3000
+G1 X23.420 Y1.000 Z-2.1518 F3000
+G1 X23.440 Y1.000 Z-2.1552 F3000
+G1 X23.460 Y1.000 Z-2.1588 F3000
+G1 X23.480 Y1.000 Z-2.1623 F3000
+G1 X23.500 Y1.000 Z-2.1658 F3000
+G1 X23.520 Y1.000 Z-2.1694 F3000
+G1 X23.540 Y1.000 Z-2.1730 F3000
+G1 X23.560 Y1.000 Z-2.1766 F3000
+G1 X23.580 Y1.000 Z-2.1803 F3000
+G1 X23.600 Y1.000 Z-2.1839 F3000
+G1 X23.620 Y1.000 Z-2.1876 F3000
+G1 X23.640 Y1.000 Z-2.1913 F3000
+G1 X23.660 Y1.000 Z-2.1950 F3000
+G1 X23.680 Y1.000 Z-2.1988 F3000
+G1 X23.700 Y1.000 Z-2.2026 F3000
+G1 X23.720 Y1.000 Z-2.2063 F3000
+G1 X23.740 Y1.000 Z-2.2101 F3000
+G1 X23.760 Y1.000 Z-2.2140 F3000
+G1 X23.780 Y1.000 Z-2.2178 F3000
+G1 X23.800 Y1.000 Z-2.2217 F3000
+G1 X23.820 Y1.000 Z-2.2256 F3000
+G1 X23.840 Y1.000 Z-2.2295 F3000
+G1 X23.860 Y1.000 Z-2.2334 F3000
+G1 X23.880 Y1.000 Z-2.2374 F3000
+G1 X23.900 Y1.000 Z-2.2414 F3000
+G1 X23.920 Y1.000 Z-2.2454 F3000
+G1 X23.940 Y1.000 Z-2.2494 F3000
+G1 X23.960 Y1.000 Z-2.2534 F3000
+G1 X23.980 Y1.000 Z-2.2575 F3000
+G1 X24.000 Y1.000 Z-2.2616 F3000
+G1 X24.020 Y1.000 Z-2.2657 F3000
+G1 X24.040 Y1.000 Z-2.2698 F3000
+G1 X24.060 Y1.000 Z-2.2740 F3000
+G1 X24.080 Y1.000 Z-2.2781 F3000
+G1 X24.100 Y1.000 Z-2.2823 F3000
+G1 X24.120 Y1.000 Z-2.2865 F3000
+G1 X24.140 Y1.000 Z-2.2908 F3000
+G1 X24.160 Y1.000 Z-2.2950 F3000
+G1 X24.180 Y1.000 Z-2.2993 F3000
+G1 X24.200 Y1.000 Z-2.3036 F3000
+G1 X24.220 Y1.000 Z-2.3079 F3000
+G1 X24.240 Y1.000 Z-2.3123 F3000
+G1 X24.260 Y1.000 Z-2.3166 F3000
+G1 X24.280 Y1.000 Z-2.3210 F3000
+G1 X24.300 Y1.000 Z-2.3254 F3000
+G1 X24.320 Y1.000 Z-2.3298 F3000
+G1 X24.340 Y1.000 Z-2.3343 F3000
+G1 X24.360 Y1.000 Z-2.3387 F3000
+G1 X24.380 Y1.000 Z-2.3432 F3000
+G1 X24.400 Y1.000 Z-2.3478 F3000
+G1 X24.420 Y1.000 Z-2.3523 F3000
+G1 X24.440 Y1.000 Z-2.3568 F3000
+G1 X24.460 Y1.000 Z-2.3614 F3000
+G1 X24.480 Y1.000 Z-2.3660 F3000
+G1 X24.500 Y1.000 Z-2.3706 F3000
+G1 X24.520 Y1.000 Z-2.3753 F3000
+G1 X24.540 Y1.000 Z-2.3799 F3000
+G1 X24.560 Y1.000 Z-2.3846 F3000
+G1 X24.580 Y1.000 Z-2.3893 F3000
+G1 X24.600 Y1.000 Z-2.3941 F3000
+G1 X24.620 Y1.000 Z-2.3988 F3000
+G1 X24.640 Y1.000 Z-2.4036 F3000
+G1 X24.660 Y1.000 Z-2.4084 F3000
+G1 X24.680 Y1.000 Z-2.4132 F3000
+G1 X24.700 Y1.000 Z-2.4180 F3000
+G1 X24.720 Y1.000 Z-2.4229 F3000
+G1 X24.740 Y1.000 Z-2.4278 F3000
+G1 X24.760 Y1.000 Z-2.4327 F3000
+G1 X24.780 Y1.000 Z-2.4376 F3000
+G1 X24.800 Y1.000 Z-2.4426 F3000
+G1 X24.820 Y1.000 Z-2.4475 F3000
+G1 X24.840 Y1.000 Z-2.4525 F3000
+G1 X24.860 Y1.000 Z-2.4575 F3000
+G1 X24.880 Y1.000 Z-2.4626 F3000
+G1 X24.900 Y1.000 Z-2.4676 F3000
+G1 X24.920 Y1.000 Z-2.4727 F3000
+G1 X24.940 Y1.000 Z-2.4778 F3000
+G1 X24.960 Y1.000 Z-2.4830 F3000
+G1 X24.980 Y1.000 Z-2.4881 F3000
+G1 X25.000 Y1.000 Z-2.4933 F3000
+G1 X25.020 Y1.000 Z-2.4985 F3000
+G1 X25.040 Y1.000 Z-2.5037 F3000
+G1 X25.060 Y1.000 Z-2.5089 F3000
+G1 X25.080 Y1.000 Z-2.5142 F3000
+G1 X25.100 Y1.000 Z-2.5194 F3000
+G1 X25.120 Y1.000 Z-2.5247 F3000
+G1 X25.140 Y1.000 Z-2.5301 F3000
+G1 X25.160 Y1.000 Z-2.5354 F3000
+G1 X25.180 Y1.000 Z-2.5408 F3000
+G1 X25.200 Y1.000 Z-2.5462 F3000
+G1 X25.220 Y1.000 Z-2.5516 F3000
+G1 X25.240 Y1.000 Z-2.5570 F3000
+G1 X25.260 Y1.000 Z-2.5625 F3000
+G1 X25.280 Y1.000 Z-2.5680 F3000
+G1 X25.300 Y1.000 Z-2.5735 F3000
+G1 X25.320 Y1.000 Z-2.5790 F3000
+G1 X25.340 Y1.000 Z-2.5845 F3000
+G1 X25.360 Y1.000 Z-2.5901 F3000
+G1 X25.380 Y1.000 Z-2.5957 F3000
+G1 X25.400 Y1.000 Z-2.6013 F3000
+G1 X25.420 Y1.000 Z-2.6069 F3000
+G1 X25.440 Y1.000 Z-2.6126 F3000
+G1 X25.460 Y1.000 Z-2.6183 F3000
+G1 X25.480 Y1.000 Z-2.6240 F3000
+G1 X25.500 Y1.000 Z-2.6297 F3000
+G1 X25.520 Y1.000 Z-2.6355 F3000
+G1 X25.540 Y1.000 Z-2.6412 F3000
+G1 X25.560 Y1.000 Z-2.6470 F3000
+G1 X25.580 Y1.000 Z-2.6528 F3000
+G1 X25.600 Y1.000 Z-2.6587 F3000
+G1 X25.620 Y1.000 Z-2.6645 F3000
+G1 X25.640 Y1.000 Z-2.6704 F3000
+G1 X25.660 Y1.000 Z-2.6763 F3000
+G1 X25.680 Y1.000 Z-2.6823 F3000
+G1 X25.700 Y1.000 Z-2.6882 F3000
+G1 X25.720 Y1.000 Z-2.6942 F3000
+G1 X25.740 Y1.000 Z-2.7002 F3000
+G1 X25.760 Y1.000 Z-2.7062 F3000
+G1 X25.780 Y1.000 Z-2.7123 F3000
+G1 X25.800 Y1.000 Z-2.7183 F3000
+G1 X25.820 Y1.000 Z-2.7244 F3000
+G1 X25.840 Y1.000 Z-2.7305 F3000
+G1 X25.860 Y1.000 Z-2.7367 F3000
+G1 X25.880 Y1.000 Z-2.7428 F3000
+G1 X25.900 Y1.000 Z-2.7490 F3000
+G1 X25.920 Y1.000 Z-2.7552 F3000
+G1 X25.940 Y1.000 Z-2.7614 F3000
+G1 X25.960 Y1.000 Z-2.7677 F3000
+G1 X25.980 Y1.000 Z-2.7740 F3000
+G1 X26.000 Y1.000 Z-2.7803 F3000
+G1 X26.020 Y1.000 Z-2.7866 F3000
+G1 X26.040 Y1.000 Z-2.7929 F3000
+G1 X26.060 Y1.000 Z-2.7993 F3000
+G1 X26.080 Y1.000 Z-2.8057 F3000
+G1 X26.100 Y1.000 Z-2.8121 F3000
+G1 X26.120 Y1.000 Z-2.8185 F3000
+G1 X26.140 Y1.000 Z-2.8250 F3000
+G1 X26.160 Y1.000 Z-2.8315 F3000
+G1 X26.180 Y1.000 Z-2.8380 F3000
+G1 X26.200 Y1.000 Z-2.8445 F3000
+G1 X26.220 Y1.000 Z-2.8511 F3000
+G1 X26.240 Y1.000 Z-2.8577 F3000
+G1 X26.260 Y1.000 Z-2.8643 F3000
+G1 X26.280 Y1.000 Z-2.8709 F3000
+G1 X26.300 Y1.000 Z-2.8775 F3000
+G1 X26.320 Y1.000 Z-2.8842 F3000
+G1 X26.340 Y1.000 Z-2.8909 F3000
+G1 X26.360 Y1.000 Z-2.8976 F3000
+G1 X26.380 Y1.000 Z-2.9043 F3000
+G1 X26.400 Y1.000 Z-2.9111 F3000
+G1 X26.420 Y1.000 Z-2.9179 F3000
+G1 X26.440 Y1.000 Z-2.9247 F3000
+G1 X26.460 Y1.000 Z-2.9316 F3000
+G1 X26.480 Y1.000 Z-2.9384 F3000
+G1 X26.500 Y1.000 Z-2.9453 F3000
+G1 X26.520 Y1.000 Z-2.9522 F3000
+G1 X26.540 Y1.000 Z-2.9591 F3000
+G1 X26.560 Y1.000 Z-2.9661 F3000
+G1 X26.580 Y1.000 Z-2.9731 F3000
+G1 X26.600 Y1.000 Z-2.9801 F3000
+G1 X26.620 Y1.000 Z-2.9871 F3000
+G1 X26.640 Y1.000 Z-2.9941 F3000
+G1 X26.660 Y1.000 Z-3.0012 F3000
+G1 X26.680 Y1.000 Z-3.0083 F3000
+G1 X26.700 Y1.000 Z-3.0154 F3000
+G1 X26.720 Y1.000 Z-3.0226 F3000
+G1 X26.740 Y1.000 Z-3.0297 F3000
+G1 X26.760 Y1.000 Z-3.0369 F3000
+G1 X26.780 Y1.000 Z-3.0442 F3000
+G1 X26.800 Y1.000 Z-3.0514 F3000
+G1 X26.820 Y1.000 Z-3.0587 F3000
+G1 X26.840 Y1.000 Z-3.0660 F3000
+G1 X26.860 Y1.000 Z-3.0733 F3000
+G1 X26.880 Y1.000 Z-3.0806 F3000
+G1 X26.900 Y1.000 Z-3.0880 F3000
+G1 X26.920 Y1.000 Z-3.0954 F3000
+G1 X26.940 Y1.000 Z-3.1028 F3000
+G1 X26.960 Y1.000 Z-3.1102 F3000
+G1 X26.980 Y1.000 Z-3.1177 F3000
+G1 X27.000 Y1.000 Z-3.1252 F3000
+G1 X27.020 Y1.000 Z-3.1327 F3000
+G1 X27.040 Y1.000 Z-3.1402 F3000
+G1 X27.060 Y1.000 Z-3.1478 F3000
+G1 X27.080 Y1.000 Z-3.1553 F3000
+G1 X27.100 Y1.000 Z-3.1629 F3000
+G1 X27.120 Y1.000 Z-3.1706 F3000
+G1 X27.140 Y1.000 Z-3.1782 F3000
+G1 X27.160 Y1.000 Z-3.1859 F3000
+G1 X27.180 Y1.000 Z-3.1936 F3000
+G1 X27.200 Y1.000 Z-3.2013 F3000
+G1 X27.220 Y1.000 Z-3.2091 F3000
+G1 X27.240 Y1.000 Z-3.2169 F3000
+G1 X27.260 Y1.000 Z-3.2247 F3000
+G1 X27.280 Y1.000 Z-3.2325 F3000
+G1 X27.300 Y1.000 Z-3.2404 F3000
+G1 X27.320 Y1.000 Z-3.2482 F3000
+G1 X27.340 Y1.000 Z-3.2561 F3000
+G1 X27.360 Y1.000 Z-3.2641 F3000
+G1 X27.380 Y1.000 Z-3.2720 F3000
+G1 X27.400 Y1.000 Z-3.2800 F3000
+G1 X27.420 Y1.000 Z-3.2880 F3000
+G1 X27.440 Y1.000 Z-3.2960 F3000
+G1 X27.460 Y1.000 Z-3.3041 F3000
+G1 X27.480 Y1.000 Z-3.3122 F3000
+G1 X27.500 Y1.000 Z-3.3203 F3000
+G1 X27.520 Y1.000 Z-3.3284 F3000
+G1 X27.540 Y1.000 Z-3.3366 F3000
+G1 X27.560 Y1.000 Z-3.3447 F3000
+G1 X27.580 Y1.000 Z-3.3530 F3000
+G1 X27.600 Y1.000 Z-3.3612 F3000
+G1 X27.620 Y1.000 Z-3.3694 F3000
+G1 X27.640 Y1.000 Z-3.3777 F3000
+G1 X27.660 Y1.000 Z-3.3860 F3000
+G1 X27.680 Y1.000 Z-3.3944 F3000
+G1 X27.700 Y1.000 Z-3.4027 F3000
+G1 X27.720 Y1.000 Z-3.4111 F3000
+G1 X27.740 Y1.000 Z-3.4195 F3000
+G1 X27.760 Y1.000 Z-3.4279 F3000
+G1 X27.780 Y1.000 Z-3.4364 F3000
+G1 X27.800 Y1.000 Z-3.4449 F3000
+G1 X27.820 Y1.000 Z-3.4534 F3000
+G1 X27.840 Y1.000 Z-3.4619 F3000
+G1 X27.860 Y1.000 Z-3.4705 F3000
+G1 X27.880 Y1.000 Z-3.4791 F3000
+G1 X27.900 Y1.000 Z-3.4877 F3000
+G1 X27.920 Y1.000 Z-3.4964 F3000
+G1 X27.940 Y1.000 Z-3.5050 F3000
+G1 X27.960 Y1.000 Z-3.5137 F3000
+G1 X27.980 Y1.000 Z-3.5224 F3000
+G1 X28.000 Y1.000 Z-3.5312 F3000
+G1 X28.020 Y1.000 Z-3.5399 F3000
+G1 X28.040 Y1.000 Z-3.5487 F3000
+G1 X28.060 Y1.000 Z-3.5576 F3000
+G1 X28.080 Y1.000 Z-3.5664 F3000
+G1 X28.100 Y1.000 Z-3.5753 F3000
+G1 X28.120 Y1.000 Z-3.5842 F3000
+G1 X28.140 Y1.000 Z-3.5931 F3000
+G1 X28.160 Y1.000 Z-3.6021 F3000
+G1 X28.180 Y1.000 Z-3.6111 F3000
+G1 X28.200 Y1.000 Z-3.6201 F3000
+G1 X28.220 Y1.000 Z-3.6291 F3000
+G1 X28.240 Y1.000 Z-3.6382 F3000
+G1 X28.260 Y1.000 Z-3.6472 F3000
+G1 X28.280 Y1.000 Z-3.6564 F3000
+G1 X28.300 Y1.000 Z-3.6655 F3000
+G1 X28.320 Y1.000 Z-3.6747 F3000
+G1 X28.340 Y1.000 Z-3.6839 F3000
+G1 X28.360 Y1.000 Z-3.6931 F3000
+G1 X28.380 Y1.000 Z-3.7023 F3000
+G1 X28.400 Y1.000 Z-3.7116 F3000
+G1 X28.420 Y1.000 Z-3.7209 F3000
+G1 X28.440 Y1.000 Z-3.7302 F3000
+G1 X28.460 Y1.000 Z-3.7396 F3000
+G1 X28.480 Y1.000 Z-3.7490 F3000
+G1 X28.500 Y1.000 Z-3.7584 F3000
+G1 X28.520 Y1.000 Z-3.7678 F3000
+G1 X28.540 Y1.000 Z-3.7773 F3000
+G1 X28.560 Y1.000 Z-3.7868 F3000
+G1 X28.580 Y1.000 Z-3.7963 F3000
+G1 X28.600 Y1.000 Z-3.8058 F3000
+G1 X28.620 Y1.000 Z-3.8154 F3000
+G1 X28.640 Y1.000 Z-3.8250 F3000
+G1 X28.660 Y1.000 Z-3.8346 F3000
+G1 X28.680 Y1.000 Z-3.8443 F3000
+G1 X28.700 Y1.000 Z-3.8540 F3000
+G1 X28.720 Y1.000 Z-3.8637 F3000
+G1 X28.740 Y1.000 Z-3.8734 F3000
+G1 X28.760 Y1.000 Z-3.8832 F3000
+G1 X28.780 Y1.000 Z-3.8930 F3000
+G1 X28.800 Y1.000 Z-3.9028 F3000
+G1 X28.820 Y1.000 Z-3.9126 F3000
+G1 X28.840 Y1.000 Z-3.9225 F3000
+G1 X28.860 Y1.000 Z-3.9324 F3000
+G1 X28.880 Y1.000 Z-3.9424 F3000
+G1 X28.900 Y1.000 Z-3.9523 F3000
+G1 X28.920 Y1.000 Z-3.9623 F3000
+G1 X28.940 Y1.000 Z-3.9723 F3000
+G1 X28.960 Y1.000 Z-3.9824 F3000
+G1 X28.980 Y1.000 Z-3.9924 F3000
+G1 X29.000 Y1.000 Z-4.0025 F3000
+G1 X29.020 Y1.000 Z-4.0127 F3000
+G1 X29.040 Y1.000 Z-4.0228 F3000
+G1 X29.060 Y1.000 Z-4.0330 F3000
+G1 X29.080 Y1.000 Z-4.0432 F3000
+G1 X29.100 Y1.000 Z-4.0535 F3000
+G1 X29.120 Y1.000 Z-4.0637 F3000
+G1 X29.140 Y1.000 Z-4.0740 F3000
+G1 X29.160 Y1.000 Z-4.0843 F3000
+G1 X29.180 Y1.000 Z-4.0947 F3000
+G1 X29.200 Y1.000 Z-4.1051 F3000
+G1 X29.220 Y1.000 Z-4.1155 F3000
+G1 X29.240 Y1.000 Z-4.1259 F3000
+G1 X29.260 Y1.000 Z-4.1364 F3000
+G1 X29.280 Y1.000 Z-4.1469 F3000
+G1 X29.300 Y1.000 Z-4.1574 F3000
+G1 X29.320 Y1.000 Z-4.1680 F3000
+G1 X29.340 Y1.000 Z-4.1786 F3000
+G1 X29.360 Y1.000 Z-4.1892 F3000
+G1 X29.380 Y1.000 Z-4.1998 F3000
+G1 X29.400 Y1.000 Z-4.2105 F3000
+G1 X29.420 Y1.000 Z-4.2212 F3000
+G1 X29.440 Y1.000 Z-4.2319 F3000
+G1 X29.460 Y1.000 Z-4.2427 F3000
+G1 X29.480 Y1.000 Z-4.2535 F3000
+G1 X29.500 Y1.000 Z-4.2643 F3000
+G1 X29.520 Y1.000 Z-4.2752 F3000
+G1 X29.540 Y1.000 Z-4.2861 F3000
+G1 X29.560 Y1.000 Z-4.2970 F3000
+G1 X29.580 Y1.000 Z-4.3079 F3000
+G1 X29.600 Y1.000 Z-4.3189 F3000
+G1 X29.620 Y1.000 Z-4.3299 F3000
+G1 X29.640 Y1.000 Z-4.3409 F3000
+G1 X29.660 Y1.000 Z-4.3520 F3000
+G1 X29.680 Y1.000 Z-4.3630 F3000
+G1 X29.700 Y1.000 Z-4.3742 F3000
+G1 X29.720 Y1.000 Z-4.3853 F3000
+G1 X29.740 Y1.000 Z-4.3965 F3000
+G1 X29.760 Y1.000 Z-4.4077 F3000
+G1 X29.780 Y1.000 Z-4.4189 F3000
+G1 X29.800 Y1.000 Z-4.4302 F3000
+G1 X29.820 Y1.000 Z-4.4415 F3000
+G1 X29.840 Y1.000 Z-4.4528 F3000
+G1 X29.860 Y1.000 Z-4.4642 F3000
+G1 X29.880 Y1.000 Z-4.4756 F3000
+G1 X29.900 Y1.000 Z-4.4870 F3000
+G1 X29.920 Y1.000 Z-4.4985 F3000
+G1 X29.940 Y1.000 Z-4.5099 F3000
+G1 X29.960 Y1.000 Z-4.5214 F3000
+G1 X29.980 Y1.000 Z-4.5330 F3000
+G1 X30.000 Y1.000 Z-4.5446 F3000
+G1 X30.020 Y1.000 Z-4.5562 F3000
+G1 X30.040 Y1.000 Z-4.5678 F3000
+G1 X30.060 Y1.000 Z-4.5795 F3000
+G1 X30.080 Y1.000 Z-4.5912 F3000
+G1 X30.100 Y1.000 Z-4.6029 F3000
+G1 X30.120 Y1.000 Z-4.6147 F3000
+G1 X30.140 Y1.000 Z-4.6265 F3000
+G1 X30.160 Y1.000 Z-4.6383 F3000
+G1 X30.180 Y1.000 Z-4.6501 F3000
+G1 X30.200 Y1.000 Z-4.6620 F3000
+G1 X30.220 Y1.000 Z-4.6739 F3000
+G1 X30.240 Y1.000 Z-4.6859 F3000
+G1 X30.260 Y1.000 Z-4.6979 F3000
+G1 X30.280 Y1.000 Z-4.7099 F3000
+G1 X30.300 Y1.000 Z-4.7219 F3000
+G1 X30.320 Y1.000 Z-4.7340 F3000
+G1 X30.340 Y1.000 Z-4.7461 F3000
+G1 X30.360 Y1.000 Z-4.7583 F3000
+G1 X30.380 Y1.000 Z-4.7704 F3000
+G1 X30.400 Y1.000 Z-4.7827 F3000
+G1 X30.420 Y1.000 Z-4.7949 F3000
+G1 X30.440 Y1.000 Z-4.8072 F3000
+G1 X30.460 Y1.000 Z-4.8195 F3000
+G1 X30.480 Y1.000 Z-4.8318 F3000
+G1 X30.500 Y1.000 Z-4.8442 F3000
+G1 X30.520 Y1.000 Z-4.8566 F3000
+G1 X30.540 Y1.000 Z-4.8690 F3000
+G1 X30.560 Y1.000 Z-4.8815 F3000
+G1 X30.580 Y1.000 Z-4.8940 F3000
+G1 X30.600 Y1.000 Z-4.9065 F3000
+G1 X30.620 Y1.000 Z-4.9191 F3000
+G1 X30.640 Y1.000 Z-4.9317 F3000
+G1 X30.660 Y1.000 Z-4.9443 F3000
+G1 X30.680 Y1.000 Z-4.9570 F3000
+G1 X30.700 Y1.000 Z-4.9697 F3000
+G1 X30.720 Y1.000 Z-4.9824 F3000
+G1 X30.740 Y1.000 Z-4.9952 F3000
+G1 X30.760 Y1.000 Z-5.0080 F3000
+G1 X30.780 Y1.000 Z-5.0208 F3000
+G1 X30.800 Y1.000 Z-5.0337 F3000
+G1 X30.820 Y1.000 Z-5.0466 F3000
+G1 X30.840 Y1.000 Z-5.0595 F3000
+G1 X30.860 Y1.000 Z-5.0725 F3000
+G1 X30.880 Y1.000 Z-5.0855 F3000
+G1 X30.900 Y1.000 Z-5.0985 F3000
+G1 X30.920 Y1.000 Z-5.1116 F3000
+G1 X30.940 Y1.000 Z-5.1247 F3000
+G1 X30.960 Y1.000 Z-5.1378 F3000
+G1 X30.980 Y1.000 Z-5.1510 F3000
+G1 X31.000 Y1.000 Z-5.1642 F3000
+G1 X31.020 Y1.000 Z-5.1774 F3000
+G1 X31.040 Y1.000 Z-5.1907 F3000
+G1 X31.060 Y1.000 Z-5.2040 F3000
+G1 X31.080 Y1.000 Z-5.2174 F3000
+G1 X31.100 Y1.000 Z-5.2308 F3000
+G1 X31.120 Y1.000 Z-5.2442 F3000
+G1 X31.140 Y1.000 Z-5.2576 F3000
+G1 X31.160 Y1.000 Z-5.2711 F3000
+G1 X31.180 Y1.000 Z-5.2846 F3000
+G1 X31.200 Y1.000 Z-5.2982 F3000
+G1 X31.220 Y1.000 Z-5.3118 F3000
+G1 X31.240 Y1.000 Z-5.3254 F3000
+G1 X31.260 Y1.000 Z-5.3391 F3000
+G1 X31.280 Y1.000 Z-5.3528 F3000
+G1 X31.300 Y1.000 Z-5.3665 F3000
+G1 X31.320 Y1.000 Z-5.3803 F3000
+G1 X31.340 Y1.000 Z-5.3941 F3000
+G1 X31.360 Y1.000 Z-5.4079 F3000
+G1 X31.380 Y1.000 Z-5.4218 F3000
+G1 X31.400 Y1.000 Z-5.4357 F3000
+G1 X31.420 Y1.000 Z-5.4497 F3000
+G1 X31.440 Y1.000 Z-5.4636 F3000
+G1 X31.460 Y1.000 Z-5.4777 F3000
+G1 X31.480 Y1.000 Z-5.4917 F3000
+G1 X31.500 Y1.000 Z-5.5058 F3000
+G1 X31.520 Y1.000 Z-5.5200 F3000
+G1 X31.540 Y1.000 Z-5.5341 F3000
+G1 X31.560 Y1.000 Z-5.5483 F3000
+G1 X31.580 Y1.000 Z-5.5626 F3000
+G1 X31.600 Y1.000 Z-5.5769 F3000
+G1 X31.620 Y1.000 Z-5.5912 F3000
+G1 X31.640 Y1.000 Z-5.6055 F3000
+G1 X31.660 Y1.000 Z-5.6199 F3000
+G1 X31.680 Y1.000 Z-5.6344 F3000
+G1 X31.700 Y1.000 Z-5.6488 F3000
+G1 X31.720 Y1.000 Z-5.6633 F3000
+G1 X31.740 Y1.000 Z-5.6779 F3000
+G1 X31.760 Y1.000 Z-5.6925 F3000
+G1 X31.780 Y1.000 Z-5.7071 F3000
+G1 X31.800 Y1.000 Z-5.7218 F3000
+G1 X31.820 Y1.000 Z-5.7365 F3000
+G1 X31.840 Y1.000 Z-5.7512 F3000
+G1 X31.860 Y1.000 Z-5.7660 F3000
+G1 X31.880 Y1.000 Z-5.7808 F3000
+G1 X31.900 Y1.000 Z-5.7956 F3000
+G1 X31.920 Y1.000 Z-5.8105 F3000
+G1 X31.940 Y1.000 Z-5.8254 F3000
+G1 X31.960 Y1.000 Z-5.8404 F3000
+G1 X31.980 Y1.000 Z-5.8554 F3000
+G1 X32.000 Y1.000 Z-5.8705 F3000
+G1 X32.020 Y1.000 Z-5.8856 F3000
+G1 X32.040 Y1.000 Z-5.9007 F3000
+G1 X32.060 Y1.000 Z-5.9158 F3000
+G1 X32.080 Y1.000 Z-5.9310 F3000
+G1 X32.100 Y1.000 Z-5.9463 F3000
+G1 X32.120 Y1.000 Z-5.9616 F3000
+G1 X32.140 Y1.000 Z-5.9769 F3000
+G1 X32.160 Y1.000 Z-5.9923 F3000
+G1 X32.180 Y1.000 Z-6.0077 F3000
+G1 X32.200 Y1.000 Z-6.0231 F3000
+G1 X32.220 Y1.000 Z-6.0386 F3000
+G1 X32.240 Y1.000 Z-6.0541 F3000
+G1 X32.260 Y1.000 Z-6.0697 F3000
+G1 X32.280 Y1.000 Z-6.0853 F3000
+G1 X32.300 Y1.000 Z-6.1010 F3000
+G1 X32.320 Y1.000 Z-6.1166 F3000
+G1 X32.340 Y1.000 Z-6.1324 F3000
+G1 X32.360 Y1.000 Z-6.1482 F3000
+G1 X32.380 Y1.000 Z-6.1640 F3000
+G1 X32.400 Y1.000 Z-6.1798 F3000
+G1 X32.420 Y1.000 Z-6.1957 F3000
+G1 X32.440 Y1.000 Z-6.2117 F3000
+G1 X32.460 Y1.000 Z-6.2276 F3000
+G1 X32.480 Y1.000 Z-6.2437 F3000
+G1 X32.500 Y1.000 Z-6.2597 F3000
+G1 X32.520 Y1.000 Z-6.2758 F3000
+G1 X32.540 Y1.000 Z-6.2920 F3000
+G1 X32.560 Y1.000 Z-6.3082 F3000
+G1 X32.580 Y1.000 Z-6.3244 F3000
+G1 X32.600 Y1.000 Z-6.3407 F3000
+G1 X32.620 Y1.000 Z-6.3570 F3000
+G1 X32.640 Y1.000 Z-6.3734 F3000
+G1 X32.660 Y1.000 Z-6.3898 F3000
+G1 X32.680 Y1.000 Z-6.4062 F3000
+G1 X32.700 Y1.000 Z-6.4227 F3000
+G1 X32.720 Y1.000 Z-6.4393 F3000
+G1 X32.740 Y1.000 Z-6.4559 F3000
+G1 X32.760 Y1.000 Z-6.4725 F3000
+G1 X32.780 Y1.000 Z-6.4892 F3000
+G1 X32.800 Y1.000 Z-6.5059 F3000
+G1 X32.820 Y1.000 Z-6.5226 F3000
+G1 X32.840 Y1.000 Z-6.5394 F3000
+G1 X32.860 Y1.000 Z-6.5563 F3000
+G1 X32.880 Y1.000 Z-6.5732 F3000
+G1 X32.900 Y1.000 Z-6.5901 F3000
+G1 X32.920 Y1.000 Z-6.6071 F3000
+G1 X32.940 Y1.000 Z-6.6242 F3000
+G1 X32.960 Y1.000 Z-6.6412 F3000
+G1 X32.980 Y1.000 Z-6.6583 F3000
+G1 X33.000 Y1.000 Z-6.6755 F3000
+G1 X33.020 Y1.000 Z-6.6927 F3000
+G1 X33.040 Y1.000 Z-6.7100 F3000
+G1 X33.060 Y1.000 Z-6.7273 F3000
+G1 X33.080 Y1.000 Z-6.7446 F3000
+G1 X33.100 Y1.000 Z-6.7620 F3000
+G1 X33.120 Y1.000 Z-6.7795 F3000
+G1 X33.140 Y1.000 Z-6.7970 F3000
+G1 X33.160 Y1.000 Z-6.8145 F3000
+G1 X33.180 Y1.000 Z-6.8321 F3000
+G1 X33.200 Y1.000 Z-6.8497 F3000
+G1 X33.220 Y1.000 Z-6.8674 F3000
+G1 X33.240 Y1.000 Z-6.8852 F3000
+G1 X33.260 Y1.000 Z-6.9029 F3000
+G1 X33.280 Y1.000 Z-6.9208 F3000
+G1 X33.300 Y1.000 Z-6.9386 F3000
+G1 X33.320 Y1.000 Z-6.9566 F3000
+G1 X33.340 Y1.000 Z-6.9745 F3000
+G1 X33.360 Y1.000 Z-6.9926 F3000
+G1 X33.380 Y1.000 Z-7.0106 F3000
+G1 X33.400 Y1.000 Z-7.0287 F3000
+G1 X33.420 Y1.000 Z-7.0469 F3000
+G1 X33.440 Y1.000 Z-7.0651 F3000
+G1 X33.460 Y1.000 Z-7.0834 F3000
+G1 X33.480 Y1.000 Z-7.1017 F3000
+G1 X33.500 Y1.000 Z-7.1201 F3000
+G1 X33.520 Y1.000 Z-7.1385 F3000
+G1 X33.540 Y1.000 Z-7.1570 F3000
+G1 X33.560 Y1.000 Z-7.1755 F3000
+G1 X33.580 Y1.000 Z-7.1941 F3000
+G1 X33.600 Y1.000 Z-7.2127 F3000
+G1 X33.620 Y1.000 Z-7.2313 F3000
+G1 X33.640 Y1.000 Z-7.2501 F3000
+G1 X33.660 Y1.000 Z-7.2688 F3000
+G1 X33.680 Y1.000 Z-7.2877 F3000
+G1 X33.700 Y1.000 Z-7.3066 F3000
+G1 X33.720 Y1.000 Z-7.3255 F3000
+G1 X33.740 Y1.000 Z-7.3445 F3000
+G1 X33.760 Y1.000 Z-7.3635 F3000
+G1 X33.780 Y1.000 Z-7.3826 F3000
+G1 X33.800 Y1.000 Z-7.4017 F3000
+G1 X33.820 Y1.000 Z-7.4209 F3000
+G1 X33.840 Y1.000 Z-7.4402 F3000
+G1 X33.860 Y1.000 Z-7.4595 F3000
+G1 X33.880 Y1.000 Z-7.4788 F3000
+G1 X33.900 Y1.000 Z-7.4983 F3000
+G1 X33.920 Y1.000 Z-7.5177 F3000
+G1 X33.940 Y1.000 Z-7.5372 F3000
+G1 X33.960 Y1.000 Z-7.5568 F3000
+G1 X33.980 Y1.000 Z-7.5764 F3000
+G1 X34.000 Y1.000 Z-7.5961 F3000
+G1 X34.020 Y1.000 Z-7.6159 F3000
+G1 X34.040 Y1.000 Z-7.6357 F3000
+G1 X34.060 Y1.000 Z-7.6555 F3000
+G1 X34.080 Y1.000 Z-7.6754 F3000
+G1 X34.100 Y1.000 Z-7.6954 F3000
+G1 X34.120 Y1.000 Z-7.7154 F3000
+G1 X34.140 Y1.000 Z-7.7355 F3000
+G1 X34.160 Y1.000 Z-7.7556 F3000
+G1 X34.180 Y1.000 Z-7.7758 F3000
+G1 X34.200 Y1.000 Z-7.7961 F3000
+G1 X34.220 Y1.000 Z-7.8164 F3000
+G1 X34.240 Y1.000 Z-7.8367 F3000
+G1 X34.260 Y1.000 Z-7.8572 F3000
+G1 X34.280 Y1.000 Z-7.8777 F3000
+G1 X34.300 Y1.000 Z-7.8982 F3000
+G1 X34.320 Y1.000 Z-7.9188 F3000
+G1 X34.340 Y1.000 Z-7.9395 F3000
+G1 X34.360 Y1.000 Z-7.9602 F3000
+G1 X34.380 Y1.000 Z-7.9810 F3000
+G1 X34.400 Y1.000 Z-8.0018 F3000
+G1 X34.420 Y1.000 Z-8.0227 F3000
+G1 X34.440 Y1.000 Z-8.0437 F3000
+G1 X34.460 Y1.000 Z-8.0647 F3000
+G1 X34.480 Y1.000 Z-8.0858 F3000
+G1 X34.500 Y1.000 Z-8.1069 F3000
+G1 X34.520 Y1.000 Z-8.1281 F3000
+G1 X34.540 Y1.000 Z-8.1494 F3000
+G1 X34.560 Y1.000 Z-8.1708 F3000
+G1 X34.580 Y1.000 Z-8.1921 F3000
+G1 X34.600 Y1.000 Z-8.2136 F3000
+G1 X34.620 Y1.000 Z-8.2351 F3000
+G1 X34.640 Y1.000 Z-8.2567 F3000
+G1 X34.660 Y1.000 Z-8.2784 F3000
+G1 X34.680 Y1.000 Z-8.3001 F3000
+G1 X34.700 Y1.000 Z-8.3219 F3000
+G1 X34.720 Y1.000 Z-8.3437 F3000
+G1 X34.740 Y1.000 Z-8.3656 F3000
+G1 X34.760 Y1.000 Z-8.3876 F3000
+G1 X34.780 Y1.000 Z-8.4096 F3000
+G1 X34.800 Y1.000 Z-8.4318 F3000
+G1 X34.820 Y1.000 Z-8.4539 F3000
+G1 X34.840 Y1.000 Z-8.4762 F3000
+G1 X34.860 Y1.000 Z-8.4985 F3000
+G1 X34.880 Y1.000 Z-8.5209 F3000
+G1 X34.900 Y1.000 Z-8.5433 F3000
+G1 X34.920 Y1.000 Z-8.5658 F3000
+G1 X34.940 Y1.000 Z-8.5884 F3000
+G1 X34.960 Y1.000 Z-8.6111 F3000
+G1 X34.980 Y1.000 Z-8.6338 F3000
+G1 X35.000 Y1.000 Z-8.6566 F3000
+G1 X35.020 Y1.000 Z-8.6794 F3000
+G1 X35.040 Y1.000 Z-8.7024 F3000
+G1 X35.060 Y1.000 Z-8.7254 F3000
+G1 X35.080 Y1.000 Z-8.7484 F3000
+G1 X35.100 Y1.000 Z-8.7716 F3000
+G1 X35.120 Y1.000 Z-8.7948 F3000
+G1 X35.140 Y1.000 Z-8.8181 F3000
+G1 X35.160 Y1.000 Z-8.8414 F3000
+G1 X35.180 Y1.000 Z-8.8649 F3000
+G1 X35.200 Y1.000 Z-8.8884 F3000
+G1 X35.220 Y1.000 Z-8.9120 F3000
+G1 X35.240 Y1.000 Z-8.9356 F3000
+G1 X35.260 Y1.000 Z-8.9593 F3000
+G1 X35.280 Y1.000 Z-8.9832 F3000
+G1 X35.300 Y1.000 Z-9.0070 F3000
+G1 X35.320 Y1.000 Z-9.0310 F3000
+G1 X35.340 Y1.000 Z-9.0550 F3000
+G1 X35.360 Y1.000 Z-9.0791 F3000
+G1 X35.380 Y1.000 Z-9.1033 F3000
+G1 X35.400 Y1.000 Z-9.1276 F3000
+G1 X35.420 Y1.000 Z-9.1519 F3000
+G1 X35.440 Y1.000 Z-9.1764 F3000
+G1 X35.460 Y1.000 Z-9.2009 F3000
+G1 X35.480 Y1.000 Z-9.2254 F3000
+G1 X35.500 Y1.000 Z-9.2501 F3000
+G1 X35.520 Y1.000 Z-9.2748 F3000
+G1 X35.540 Y1.000 Z-9.2997 F3000
+G1 X35.560 Y1.000 Z-9.3246 F3000
+G1 X35.580 Y1.000 Z-9.3496 F3000
+G1 X35.600 Y1.000 Z-9.3746 F3000
+G1 X35.620 Y1.000 Z-9.3998 F3000
+G1 X35.640 Y1.000 Z-9.4250 F3000
+G1 X35.660 Y1.000 Z-9.4503 F3000
+G1 X35.680 Y1.000 Z-9.4757 F3000
+G1 X35.700 Y1.000 Z-9.5012 F3000
+G1 X35.720 Y1.000 Z-9.5268 F3000
+G1 X35.740 Y1.000 Z-9.5525 F3000
+G1 X35.760 Y1.000 Z-9.5782 F3000
+G1 X35.780 Y1.000 Z-9.6040 F3000
+G1 X35.800 Y1.000 Z-9.6300 F3000
+G1 X35.820 Y1.000 Z-9.6560 F3000
+G1 X35.840 Y1.000 Z-9.6821 F3000
+G1 X35.860 Y1.000 Z-9.7083 F3000
+G1 X35.880 Y1.000 Z-9.7345 F3000
+G1 X35.900 Y1.000 Z-9.7609 F3000
+G1 X35.920 Y1.000 Z-9.7874 F3000
+G1 X35.940 Y1.000 Z-9.8139 F3000
+G1 X35.960 Y1.000 Z-9.8406 F3000
+G1 X35.980 Y1.000 Z-9.8673 F3000
+G1 X36.000 Y1.000 Z-9.8941 F3000
+G1 X36.020 Y1.000 Z-9.9210 F3000
+G1 X36.040 Y1.000 Z-9.9481 F3000
+G1 X36.060 Y1.000 Z-9.9752 F3000
+G1 X36.080 Y1.000 Z-10.0024 F3000
+G1 X36.100 Y1.000 Z-10.0297 F3000
+G1 X36.120 Y1.000 Z-10.0571 F3000
+G1 X36.140 Y1.000 Z-10.0846 F3000
+G1 X36.160 Y1.000 Z-10.1122 F3000
+G1 X36.180 Y1.000 Z-10.1399 F3000
+G1 X36.200 Y1.000 Z-10.1677 F3000
+G1 X36.220 Y1.000 Z-10.1956 F3000
+G1 X36.240 Y1.000 Z-10.2236 F3000
+G1 X36.260 Y1.000 Z-10.2517 F3000
+G1 X36.280 Y1.000 Z-10.2799 F3000
+G1 X36.300 Y1.000 Z-10.3083 F3000
+G1 X36.320 Y1.000 Z-10.3367 F3000
+G1 X36.340 Y1.000 Z-10.3652 F3000
+G1 X36.360 Y1.000 Z-10.3938 F3000
+G1 X36.380 Y1.000 Z-10.4226 F3000
+G1 X36.400 Y1.000 Z-10.4514 F3000
+G1 X36.420 Y1.000 Z-10.4804 F3000
+G1 X36.440 Y1.000 Z-10.5095 F3000
+G1 X36.460 Y1.000 Z-10.5386 F3000
+G1 X36.480 Y1.000 Z-10.5679 F3000
+G1 X36.500 Y1.000 Z-10.5973 F3000
+G1 X36.520 Y1.000 Z-10.6268 F3000
+G1 X36.540 Y1.000 Z-10.6565 F3000
+G1 X36.560 Y1.000 Z-10.6862 F3000
+G1 X36.580 Y1.000 Z-10.7161 F3000
+G1 X36.600 Y1.000 Z-10.7460 F3000
+G1 X36.620 Y1.000 Z-10.7761 F3000
+G1 X36.640 Y1.000 Z-10.8063 F3000
+G1 X36.660 Y1.000 Z-10.8367 F3000
+G1 X36.680 Y1.000 Z-10.8671 F3000
+G1 X36.700 Y1.000 Z-10.8977 F3000
+G1 X36.720 Y1.000 Z-10.9284 F3000
+G1 X36.740 Y1.000 Z-10.9592 F3000
+G1 X36.760 Y1.000 Z-10.9902 F3000
+G1 X36.780 Y1.000 Z-11.0212 F3000
+G1 X36.800 Y1.000 Z-11.0524 F3000
+G1 X36.820 Y1.000 Z-11.0838 F3000
+G1 X36.840 Y1.000 Z-11.1152 F3000
+G1 X36.860 Y1.000 Z-11.1468 F3000
+G1 X36.880 Y1.000 Z-11.1785 F3000
+G1 X36.900 Y1.000 Z-11.2104 F3000
+G1 X36.920 Y1.000 Z-11.2424 F3000
+G1 X36.940 Y1.000 Z-11.2745 F3000
+G1 X36.960 Y1.000 Z-11.3067 F3000
+G1 X36.980 Y1.000 Z-11.3391 F3000
+G1 X37.000 Y1.000 Z-11.3717 F3000
+G1 X37.020 Y1.000 Z-11.4043 F3000
+G1 X37.040 Y1.000 Z-11.4372 F3000
+G1 X37.060 Y1.000 Z-11.4701 F3000
+G1 X37.080 Y1.000 Z-11.5032 F3000
+G1 X37.100 Y1.000 Z-11.5365 F3000
+G1 X37.120 Y1.000 Z-11.5699 F3000
+G1 X37.140 Y1.000 Z-11.6034 F3000
+G1 X37.160 Y1.000 Z-11.6371 F3000
+G1 X37.180 Y1.000 Z-11.6710 F3000
+G1 X37.200 Y1.000 Z-11.7050 F3000
+G1 X37.220 Y1.000 Z-11.7391 F3000
+G1 X37.240 Y1.000 Z-11.7734 F3000
+G1 X37.260 Y1.000 Z-11.8079 F3000
+G1 X37.280 Y1.000 Z-11.8425 F3000
+G1 X37.300 Y1.000 Z-11.8773 F3000
+G1 X37.320 Y1.000 Z-11.9123 F3000
+G1 X37.340 Y1.000 Z-11.9474 F3000
+G1 X37.360 Y1.000 Z-11.9826 F3000
+G1 X37.380 Y1.000 Z-12.0181 F3000
+G1 X37.400 Y1.000 Z-12.0537 F3000
+G1 X37.420 Y1.000 Z-12.0895 F3000
+G1 X37.440 Y1.000 Z-12.1255 F3000
+G1 X37.460 Y1.000 Z-12.1616 F3000
+G1 X37.480 Y1.000 Z-12.1979 F3000
+G1 X37.500 Y1.000 Z-12.2344 F3000
+G1 X37.520 Y1.000 Z-12.2711 F3000
+G1 X37.540 Y1.000 Z-12.3080 F3000
+G1 X37.560 Y1.000 Z-12.3450 F3000
+G1 X37.580 Y1.000 Z-12.3823 F3000
+G1 X37.600 Y1.000 Z-12.4197 F3000
+G1 X37.620 Y1.000 Z-12.4573 F3000
+G1 X37.640 Y1.000 Z-12.4951 F3000
+G1 X37.660 Y1.000 Z-12.5332 F3000
+G1 X37.680 Y1.000 Z-12.5714 F3000
+G1 X37.700 Y1.000 Z-12.6098 F3000
+G1 X37.720 Y1.000 Z-12.6484 F3000
+G1 X37.740 Y1.000 Z-12.6872 F3000
+G1 X37.760 Y1.000 Z-12.7263 F3000
+G1 X37.780 Y1.000 Z-12.7655 F3000
+G1 X37.800 Y1.000 Z-12.8050 F3000
+G1 X37.820 Y1.000 Z-12.8447 F3000
+G1 X37.840 Y1.000 Z-12.8846 F3000
+G1 X37.860 Y1.000 Z-12.9247 F3000
+G1 X37.880 Y1.000 Z-12.9651 F3000
+G1 X37.900 Y1.000 Z-13.0057 F3000
+G1 X37.920 Y1.000 Z-13.0465 F3000
+G1 X37.940 Y1.000 Z-13.0876 F3000
+G1 X37.960 Y1.000 Z-13.1289 F3000
+G1 X37.980 Y1.000 Z-13.1704 F3000
+G1 X38.000 Y1.000 Z-13.2122 F3000
+G1 X38.020 Y1.000 Z-13.2543 F3000
+G1 X38.040 Y1.000 Z-13.2966 F3000
+G1 X38.060 Y1.000 Z-13.3391 F3000
+G1 X38.080 Y1.000 Z-13.3819 F3000
+G1 X38.100 Y1.000 Z-13.4250 F3000
+G1 X38.120 Y1.000 Z-13.4684 F3000
+G1 X38.140 Y1.000 Z-13.5120 F3000
+G1 X38.160 Y1.000 Z-13.5559 F3000
+G1 X38.180 Y1.000 Z-13.6001 F3000
+G1 X38.200 Y1.000 Z-13.6446 F3000
+G1 X38.220 Y1.000 Z-13.6894 F3000
+G1 X38.240 Y1.000 Z-13.7345 F3000
+G1 X38.260 Y1.000 Z-13.7799 F3000
+G1 X38.280 Y1.000 Z-13.8256 F3000
+G1 X38.300 Y1.000 Z-13.8716 F3000
+G1 X38.320 Y1.000 Z-13.9179 F3000
+G1 X38.340 Y1.000 Z-13.9645 F3000
+G1 X38.360 Y1.000 Z-14.0115 F3000
+G1 X38.380 Y1.000 Z-14.0588 F3000
+G1 X38.400 Y1.000 Z-14.1065 F3000
+G1 X38.420 Y1.000 Z-14.1545 F3000
+G1 X38.440 Y1.000 Z-14.2029 F3000
+G1 X38.460 Y1.000 Z-14.2516 F3000
+G1 X38.480 Y1.000 Z-14.3007 F3000
+G1 X38.500 Y1.000 Z-14.3502 F3000
+G1 X38.520 Y1.000 Z-14.4000 F3000
+G1 X38.540 Y1.000 Z-14.4503 F3000
+G1 X38.560 Y1.000 Z-14.5009 F3000
+G1 X38.580 Y1.000 Z-14.5520 F3000
+G1 X38.600 Y1.000 Z-14.6035 F3000
+G1 X38.620 Y1.000 Z-14.6554 F3000
+G1 X38.640 Y1.000 Z-14.7077 F3000
+G1 X38.660 Y1.000 Z-14.7605 F3000
+G1 X38.680 Y1.000 Z-14.8138 F3000
+G1 X38.700 Y1.000 Z-14.8675 F3000
+G1 X38.720 Y1.000 Z-14.9217 F3000
+G1 X38.740 Y1.000 Z-14.9763 F3000
+G1 X38.760 Y1.000 Z-15.0315 F3000
+G1 X38.780 Y1.000 Z-15.0872 F3000
+G1 X38.800 Y1.000 Z-15.1434 F3000
+G1 X38.820 Y1.000 Z-15.2002 F3000
+G1 X38.840 Y1.000 Z-15.2575 F3000
+G1 X38.860 Y1.000 Z-15.3154 F3000
+G1 X38.880 Y1.000 Z-15.3738 F3000
+G1 X38.900 Y1.000 Z-15.4329 F3000
+G1 X38.920 Y1.000 Z-15.4926 F3000
+G1 X38.940 Y1.000 Z-15.5529 F3000
+G1 X38.960 Y1.000 Z-15.6139 F3000
+G1 X38.980 Y1.000 Z-15.6755 F3000
+G1 X39.000 Y1.000 Z-15.7378 F3000
+G1 X39.020 Y1.000 Z-15.8009 F3000
+G1 X39.040 Y1.000 Z-15.8646 F3000
+G1 X39.060 Y1.000 Z-15.9292 F3000
+G1 X39.080 Y1.000 Z-15.9945 F3000
+G1 X39.100 Y1.000 Z-16.0607 F3000
+G1 X39.120 Y1.000 Z-16.1276 F3000
+G1 X39.140 Y1.000 Z-16.1955 F3000
+G1 X39.160 Y1.000 Z-16.2643 F3000
+G1 X39.180 Y1.000 Z-16.3340 F3000
+G1 X39.200 Y1.000 Z-16.4046 F3000
+G1 X39.220 Y1.000 Z-16.4763 F3000
+G1 X39.240 Y1.000 Z-16.5491 F3000
+G1 X39.260 Y1.000 Z-16.6229 F3000
+G1 X39.280 Y1.000 Z-16.6979 F3000
+G1 X39.300 Y1.000 Z-16.7741 F3000
+G1 X39.320 Y1.000 Z-16.8515 F3000
+G1 X39.340 Y1.000 Z-16.9303 F3000
+G1 X39.360 Y1.000 Z-17.0104 F3000
+G1 X39.380 Y1.000 Z-17.0920 F3000
+G1 X39.400 Y1.000 Z-17.1751 F3000
+G1 X39.420 Y1.000 Z-17.2598 F3000
+G1 X39.440 Y1.000 Z-17.3462 F3000
+G1 X39.460 Y1.000 Z-17.4344 F3000
+G1 X39.480 Y1.000 Z-17.5245 F3000
+G1 X39.500 Y1.000 Z-17.6167 F3000
+G1 X39.520 Y1.000 Z-17.7110 F3000
+G1 X39.540 Y1.000 Z-17.8077 F3000
+G1 X39.560 Y1.000 Z-17.9069 F3000
+G1 X39.580 Y1.000 Z-18.0087 F3000
+G1 X39.600 Y1.000 Z-18.1135 F3000
+G1 X39.620 Y1.000 Z-18.2215 F3000
+G1 X39.640 Y1.000 Z-18.3330 F3000
+G1 X39.660 Y1.000 Z-18.4482 F3000
+G1 X39.680 Y1.000 Z-18.5677 F3000
+G1 X39.700 Y1.000 Z-18.6919 F3000
+G1 X39.720 Y1.000 Z-18.8215 F3000
+G1 X39.740 Y1.000 Z-18.9570 F3000
+G1 X39.760 Y1.000 Z-19.0996 F3000
+G1 X39.780 Y1.000 Z-19.2502 F3000
+G1 X39.800 Y1.000 Z-19.4104 F3000
+G1 X39.820 Y1.000 Z-19.5824 F3000
+G1 X39.840 Y1.000 Z-19.7691 F3000
+G1 X39.860 Y1.000 Z-19.9751 F3000
+G1 X39.880 Y1.000 Z-20.2076 F3000
+G1 X39.900 Y1.000 Z-20.4809 F3000
+G1 X39.920 Y1.000 Z-20.8286 F3000
+G1 X39.940 Y1.000 Z-21.4174 F3000
+G1 X39.960 Y1.000 Z-21.8000 F3000
+G1 X39.980 Y1.000 Z-21.8000 F3000
+G1 X40.000 Y1.000 Z-21.8000 F3000
+G1 X40.000 Y1.500 Z-21.8000 F3000
+G1 X39.980 Y1.500 Z-21.8000 F3000
+G1 X39.960 Y1.500 Z-21.0264 F3000
+G1 X39.940 Y1.500 Z-20.6183 F3000
+G1 X39.920 Y1.500 Z-20.3189 F3000
+G1 X39.900 Y1.500 Z-20.0708 F3000
+G1 X39.880 Y1.500 Z-19.8543 F3000
+G1 X39.860 Y1.500 Z-19.6598 F3000
+G1 X39.840 Y1.500 Z-19.4817 F3000
+G1 X39.820 Y1.500 Z-19.3165 F3000
+G1 X39.800 Y1.500 Z-19.1618 F3000
+G1 X39.780 Y1.500 Z-19.0158 F3000
+G1 X39.760 Y1.500 Z-18.8773 F3000
+G1 X39.740 Y1.500 Z-18.7451 F3000
+G1 X39.720 Y1.500 Z-18.6186 F3000
+G1 X39.700 Y1.500 Z-18.4970 F3000
+G1 X39.680 Y1.500 Z-18.3798 F3000
+G1 X39.660 Y1.500 Z-18.2667 F3000
+G1 X39.640 Y1.500 Z-18.1571 F3000
+G1 X39.620 Y1.500 Z-18.0509 F3000
+G1 X39.600 Y1.500 Z-17.9477 F3000
+G1 X39.580 Y1.500 Z-17.8473 F3000
+G1 X39.560 Y1.500 Z-17.7495 F3000
+G1 X39.540 Y1.500 Z-17.6541 F3000
+G1 X39.520 Y1.500 Z-17.5609 F3000
+G1 X39.500 Y1.500 Z-17.4699 F3000
+G1 X39.480 Y1.500 Z-17.3808 F3000
+G1 X39.460 Y1.500 Z-17.2935 F3000
+G1 X39.440 Y1.500 Z-17.2080 F3000
+G1 X39.420 Y1.500 Z-17.1241 F3000
+G1 X39.400 Y1.500 Z-17.0418 F3000
+G1 X39.380 Y1.500 Z-16.9610 F3000
+G1 X39.360 Y1.500 Z-16.8816 F3000
+G1 X39.340 Y1.500 Z-16.8036 F3000
+G1 X39.320 Y1.500 Z-16.7268 F3000
+G1 X39.300 Y1.500 Z-16.6512 F3000
+G1 X39.280 Y1.500 Z-16.5768 F3000
+G1 X39.260 Y1.500 Z-16.5035 F3000
+G1 X39.240 Y1.500 Z-16.4314 F3000
+G1 X39.220 Y1.500 Z-16.3602 F3000
+G1 X39.200 Y1.500 Z-16.2900 F3000
+G1 X39.180 Y1.500 Z-16.2208 F3000
+G1 X39.160 Y1.500 Z-16.1525 F3000
+G1 X39.140 Y1.500 Z-16.0851 F3000
+G1 X39.120 Y1.500 Z-16.0185 F3000
+G1 X39.100 Y1.500 Z-15.9528 F3000
+G1 X39.080 Y1.500 Z-15.8878 F3000
+G1 X39.060 Y1.500 Z-15.8237 F3000
+G1 X39.040 Y1.500 Z-15.7603 F3000
+G1 X39.020 Y1.500 Z-15.6976 F3000
+G1 X39.000 Y1.500 Z-15.6356 F3000
+G1 X38.980 Y1.500 Z-15.5743 F3000
+G1 X38.960 Y1.500 Z-15.5136 F3000
+G1 X38.940 Y1.500 Z-15.4536 F3000
+G1 X38.920 Y1.500 Z-15.3943 F3000
+G1 X38.900 Y1.500 Z-15.3355 F3000
+G1 X38.880 Y1.500 Z-15.2773 F3000
+G1 X38.860 Y1.500 Z-15.2197 F3000
+G1 X38.840 Y1.500 Z-15.1627 F3000
+G1 X38.820 Y1.500 Z-15.1062 F3000
+G1 X38.800 Y1.500 Z-15.0502 F3000
+G1 X38.780 Y1.500 Z-14.9947 F3000
+G1 X38.760 Y1.500 Z-14.9398 F3000
+G1 X38.740 Y1.500 Z-14.8853 F3000
+G1 X38.720 Y1.500 Z-14.8314 F3000
+G1 X38.700 Y1.500 Z-14.7779 F3000
+G1 X38.680 Y1.500 Z-14.7249 F3000
+G1 X38.660 Y1.500 Z-14.6723 F3000
+G1 X38.640 Y1.500 Z-14.6201 F3000
+G1 X38.620 Y1.500 Z-14.5684 F3000
+G1 X38.600 Y1.500 Z-14.5171 F3000
+G1 X38.580 Y1.500 Z-14.4663 F3000
+G1 X38.560 Y1.500 Z-14.4158 F3000
+G1 X38.540 Y1.500 Z-14.3657 F3000
+G1 X38.520 Y1.500 Z-14.3160 F3000
+G1 X38.500 Y1.500 Z-14.2667 F3000
+G1 X38.480 Y1.500 Z-14.2178 F3000
+G1 X38.460 Y1.500 Z-14.1692 F3000
+G1 X38.440 Y1.500 Z-14.1210 F3000
+G1 X38.420 Y1.500 Z-14.0732 F3000
+G1 X38.400 Y1.500 Z-14.0257 F3000
+G1 X38.380 Y1.500 Z-13.9785 F3000
+G1 X38.360 Y1.500 Z-13.9317 F3000
+G1 X38.340 Y1.500 Z-13.8852 F3000
+G1 X38.320 Y1.500 Z-13.8390 F3000
+G1 X38.300 Y1.500 Z-13.7931 F3000
+G1 X38.280 Y1.500 Z-13.7476 F3000
+G1 X38.260 Y1.500 Z-13.7023 F3000
+G1 X38.240 Y1.500 Z-13.6574 F3000
+G1 X38.220 Y1.500 Z-13.6127 F3000
+G1 X38.200 Y1.500 Z-13.5684 F3000
+G1 X38.180 Y1.500 Z-13.5243 F3000
+G1 X38.160 Y1.500 Z-13.4805 F3000
+G1 X38.140 Y1.500 Z-13.4370 F3000
+G1 X38.120 Y1.500 Z-13.3937 F3000
+G1 X38.100 Y1.500 Z-13.3507 F3000
+G1 X38.080 Y1.500 Z-13.3080 F3000
+G1 X38.060 Y1.500 Z-13.2656 F3000
+G1 X38.040 Y1.500 Z-13.2234 F3000
+G1 X38.020 Y1.500 Z-13.1814 F3000
+G1 X38.000 Y1.500 Z-13.1397 F3000
+G1 X37.980 Y1.500 Z-13.0983 F3000
+G1 X37.960 Y1.500 Z-13.0571 F3000
+G1 X37.940 Y1.500 Z-13.0161 F3000
+G1 X37.920 Y1.500 Z-12.9754 F3000
+G1 X37.900 Y1.500 Z-12.9349 F3000
+G1 X37.880 Y1.500 Z-12.8946 F3000
+G1 X37.860 Y1.500 Z-12.8546 F3000
+G1 X37.840 Y1.500 Z-12.8148 F3000
+G1 X37.820 Y1.500 Z-12.7752 F3000
+G1 X37.800 Y1.500 Z-12.7358 F3000
+G1 X37.780 Y1.500 Z-12.6966 F3000
+G1 X37.760 Y1.500 Z-12.6577 F3000
+G1 X37.740 Y1.500 Z-12.6189 F3000
+G1 X37.720 Y1.500 Z-12.5804 F3000
+G1 X37.700 Y1.500 Z-12.5420 F3000
+G1 X37.680 Y1.500 Z-12.5039 F3000
+G1 X37.660 Y1.500 Z-12.4660 F3000
+G1 X37.640 Y1.500 Z-12.4282 F3000
+G1 X37.620 Y1.500 Z-12.3907 F3000
+G1 X37.600 Y1.500 Z-12.3533 F3000
+G1 X37.580 Y1.500 Z-12.3161 F3000
+G1 X37.560 Y1.500 Z-12.2792 F3000
+G1 X37.540 Y1.500 Z-12.2424 F3000
+G1 X37.520 Y1.500 Z-12.2058 F3000
+G1 X37.500 Y1.500 Z-12.1693 F3000
+G1 X37.480 Y1.500 Z-12.1331 F3000
+G1 X37.460 Y1.500 Z-12.0970 F3000
+G1 X37.440 Y1.500 Z-12.0611 F3000
+G1 X37.420 Y1.500 Z-12.0254 F3000
+G1 X37.400 Y1.500 Z-11.9898 F3000
+G1 X37.380 Y1.500 Z-11.9544 F3000
+G1 X37.360 Y1.500 Z-11.9192 F3000
+G1 X37.340 Y1.500 Z-11.8841 F3000
+G1 X37.320 Y1.500 Z-11.8492 F3000
+G1 X37.300 Y1.500 Z-11.8145 F3000
+G1 X37.280 Y1.500 Z-11.7799 F3000
+G1 X37.260 Y1.500 Z-11.7455 F3000
+G1 X37.240 Y1.500 Z-11.7113 F3000
+G1 X37.220 Y1.500 Z-11.6772 F3000
+G1 X37.200 Y1.500 Z-11.6432 F3000
+G1 X37.180 Y1.500 Z-11.6094 F3000
+G1 X37.160 Y1.500 Z-11.5758 F3000
+G1 X37.140 Y1.500 Z-11.5423 F3000
+G1 X37.120 Y1.500 Z-11.5090 F3000
+G1 X37.100 Y1.500 Z-11.4758 F3000
+G1 X37.080 Y1.500 Z-11.4427 F3000
+G1 X37.060 Y1.500 Z-11.4098 F3000
+G1 X37.040 Y1.500 Z-11.3770 F3000
+G1 X37.020 Y1.500 Z-11.3444 F3000
+G1 X37.000 Y1.500 Z-11.3119 F3000
+G1 X36.980 Y1.500 Z-11.2796 F3000
+G1 X36.960 Y1.500 Z-11.2474 F3000
+G1 X36.940 Y1.500 Z-11.2153 F3000
+G1 X36.920 Y1.500 Z-11.1833 F3000
+G1 X36.900 Y1.500 Z-11.1515 F3000
+G1 X36.880 Y1.500 Z-11.1199 F3000
+G1 X36.860 Y1.500 Z-11.0883 F3000
+G1 X36.840 Y1.500 Z-11.0569 F3000
+G1 X36.820 Y1.500 Z-11.0256 F3000
+G1 X36.800 Y1.500 Z-10.9944 F3000
+G1 X36.780 Y1.500 Z-10.9634 F3000
+G1 X36.760 Y1.500 Z-10.9325 F3000
+G1 X36.740 Y1.500 Z-10.9017 F3000
+G1 X36.720 Y1.500 Z-10.8711 F3000
+G1 X36.700 Y1.500 Z-10.8405 F3000
+G1 X36.680 Y1.500 Z-10.8101 F3000
+G1 X36.660 Y1.500 Z-10.7798 F3000
+G1 X36.640 Y1.500 Z-10.7496 F3000
+G1 X36.620 Y1.500 Z-10.7196 F3000
+G1 X36.600 Y1.500 Z-10.6896 F3000
+G1 X36.580 Y1.500 Z-10.6598 F3000
+G1 X36.560 Y1.500 Z-10.6301 F3000
+G1 X36.540 Y1.500 Z-10.6005 F3000
+G1 X36.520 Y1.500 Z-10.5710 F3000
+G1 X36.500 Y1.500 Z-10.5417 F3000
+G1 X36.480 Y1.500 Z-10.5124 F3000
+G1 X36.460 Y1.500 Z-10.4833 F3000
+G1 X36.440 Y1.500 Z-10.4542 F3000
+G1 X36.420 Y1.500 Z-10.4253 F3000
+G1 X36.400 Y1.500 Z-10.3965 F3000
+G1 X36.380 Y1.500 Z-10.3678 F3000
+G1 X36.360 Y1.500 Z-10.3392 F3000
+G1 X36.340 Y1.500 Z-10.3107 F3000
+G1 X36.320 Y1.500 Z-10.2823 F3000
+G1 X36.300 Y1.500 Z-10.2540 F3000
+G1 X36.280 Y1.500 Z-10.2258 F3000
+G1 X36.260 Y1.500 Z-10.1977 F3000
+G1 X36.240 Y1.500 Z-10.1698 F3000
+G1 X36.220 Y1.500 Z-10.1419 F3000
+G1 X36.200 Y1.500 Z-10.1141 F3000
+G1 X36.180 Y1.500 Z-10.0864 F3000
+G1 X36.160 Y1.500 Z-10.0589 F3000
+G1 X36.140 Y1.500 Z-10.0314 F3000
+G1 X36.120 Y1.500 Z-10.0040 F3000
+G1 X36.100 Y1.500 Z-9.9767 F3000
+G1 X36.080 Y1.500 Z-9.9495 F3000
+G1 X36.060 Y1.500 Z-9.9224 F3000
+G1 X36.040 Y1.500 Z-9.8954 F3000
+G1 X36.020 Y1.500 Z-9.8685 F3000
+G1 X36.000 Y1.500 Z-9.8417 F3000
+G1 X35.980 Y1.500 Z-9.8150 F3000
+G1 X35.960 Y1.500 Z-9.7884 F3000
+G1 X35.940 Y1.500 Z-9.7619 F3000
+G1 X35.920 Y1.500 Z-9.7354 F3000
+G1 X35.900 Y1.500 Z-9.7091 F3000
+G1 X35.880 Y1.500 Z-9.6828 F3000
+G1 X35.860 Y1.500 Z-9.6567 F3000
+G1 X35.840 Y1.500 Z-9.6306 F3000
+G1 X35.820 Y1.500 Z-9.6046 F3000
+G1 X35.800 Y1.500 Z-9.5787 F3000
+G1 X35.780 Y1.500 Z-9.5529 F3000
+G1 X35.760 Y1.500 Z-9.5272 F3000
+G1 X35.740 Y1.500 Z-9.5015 F3000
+G1 X35.720 Y1.500 Z-9.4760 F3000
+G1 X35.700 Y1.500 Z-9.4505 F3000
+G1 X35.680 Y1.500 Z-9.4251 F3000
+G1 X35.660 Y1.500 Z-9.3998 F3000
+G1 X35.640 Y1.500 Z-9.3746 F3000
+G1 X35.620 Y1.500 Z-9.3495 F3000
+G1 X35.600 Y1.500 Z-9.3244 F3000
+G1 X35.580 Y1.500 Z-9.2995 F3000
+G1 X35.560 Y1.500 Z-9.2746 F3000
+G1 X35.540 Y1.500 Z-9.2498 F3000
+G1 X35.520 Y1.500 Z-9.2250 F3000
+G1 X35.500 Y1.500 Z-9.2004 F3000
+G1 X35.480 Y1.500 Z-9.1758 F3000
+G1 X35.460 Y1.500 Z-9.1513 F3000
+G1 X35.440 Y1.500 Z-9.1269 F3000
+G1 X35.420 Y1.500 Z-9.1026 F3000
+G1 X35.400 Y1.500 Z-9.0784 F3000
+G1 X35.380 Y1.500 Z-9.0542 F3000
+G1 X35.360 Y1.500 Z-9.0301 F3000
+G1 X35.340 Y1.500 Z-9.0061 F3000
+G1 X35.320 Y1.500 Z-8.9821 F3000
+G1 X35.300 Y1.500 Z-8.9583 F3000
+G1 X35.280 Y1.500 Z-8.9345 F3000
+G1 X35.260 Y1.500 Z-8.9108 F3000
+G1 X35.240 Y1.500 Z-8.8871 F3000
+G1 X35.220 Y1.500 Z-8.8636 F3000
+G1 X35.200 Y1.500 Z-8.8401 F3000
+G1 X35.180 Y1.500 Z-8.8166 F3000
+G1 X35.160 Y1.500 Z-8.7933 F3000
+G1 X35.140 Y1.500 Z-8.7700 F3000
+G1 X35.120 Y1.500 Z-8.7468 F3000
+G1 X35.100 Y1.500 Z-8.7237 F3000
+G1 X35.080 Y1.500 Z-8.7006 F3000
+G1 X35.060 Y1.500 Z-8.6776 F3000
+G1 X35.040 Y1.500 Z-8.6547 F3000
+G1 X35.020 Y1.500 Z-8.6319 F3000
+G1 X35.000 Y1.500 Z-8.6091 F3000
+G1 X34.980 Y1.500 Z-8.5864 F3000
+G1 X34.960 Y1.500 Z-8.5637 F3000
+G1 X34.940 Y1.500 Z-8.5412 F3000
+G1 X34.920 Y1.500 Z-8.5187 F3000
+G1 X34.900 Y1.500 Z-8.4962 F3000
+G1 X34.880 Y1.500 Z-8.4739 F3000
+G1 X34.860 Y1.500 Z-8.4516 F3000
+G1 X34.840 Y1.500 Z-8.4293 F3000
+G1 X34.820 Y1.500 Z-8.4072 F3000
+G1 X34.800 Y1.500 Z-8.3851 F3000
+G1 X34.780 Y1.500 Z-8.3631 F3000
+G1 X34.760 Y1.500 Z-8.3411 F3000
+G1 X34.740 Y1.500 Z-8.3192 F3000
+G1 X34.720 Y1.500 Z-8.2973 F3000
+G1 X34.700 Y1.500 Z-8.2756 F3000
+G1 X34.680 Y1.500 Z-8.2539 F3000
+G1 X34.660 Y1.500 Z-8.2322 F3000
+G1 X34.640 Y1.500 Z-8.2107 F3000
+G1 X34.620 Y1.500 Z-8.1891 F3000
+G1 X34.600 Y1.500 Z-8.1677 F3000
+G1 X34.580 Y1.500 Z-8.1463 F3000
+G1 X34.560 Y1.500 Z-8.1250 F3000
+G1 X34.540 Y1.500 Z-8.1037 F3000
+G1 X34.520 Y1.500 Z-8.0825 F3000
+G1 X34.500 Y1.500 Z-8.0614 F3000
+G1 X34.480 Y1.500 Z-8.0403 F3000
+G1 X34.460 Y1.500 Z-8.0193 F3000
+G1 X34.440 Y1.500 Z-7.9983 F3000
+G1 X34.420 Y1.500 Z-7.9774 F3000
+G1 X34.400 Y1.500 Z-7.9566 F3000
+G1 X34.380 Y1.500 Z-7.9358 F3000
+G1 X34.360 Y1.500 Z-7.9151 F3000
+G1 X34.340 Y1.500 Z-7.8944 F3000
+G1 X34.320 Y1.500 Z-7.8739 F3000
+G1 X34.300 Y1.500 Z-7.8533 F3000
+G1 X34.280 Y1.500 Z-7.8328 F3000
+G1 X34.260 Y1.500 Z-7.8124 F3000
+G1 X34.240 Y1.500 Z-7.7921 F3000
+G1 X34.220 Y1.500 Z-7.7718 F3000
+G1 X34.200 Y1.500 Z-7.7515 F3000
+G1 X34.180 Y1.500 Z-7.7313 F3000
+G1 X34.160 Y1.500 Z-7.7112 F3000
+G1 X34.140 Y1.500 Z-7.6911 F3000
+G1 X34.120 Y1.500 Z-7.6711 F3000
+G1 X34.100 Y1.500 Z-7.6511 F3000
+G1 X34.080 Y1.500 Z-7.6312 F3000
+G1 X34.060 Y1.500 Z-7.6114 F3000
+G1 X34.040 Y1.500 Z-7.5916 F3000
+G1 X34.020 Y1.500 Z-7.5719 F3000
+G1 X34.000 Y1.500 Z-7.5522 F3000
+G1 X33.980 Y1.500 Z-7.5326 F3000
+G1 X33.960 Y1.500 Z-7.5130 F3000
+G1 X33.940 Y1.500 Z-7.4935 F3000
+G1 X33.920 Y1.500 Z-7.4740 F3000
+G1 X33.900 Y1.500 Z-7.4546 F3000
+G1 X33.880 Y1.500 Z-7.4353 F3000
+G1 X33.860 Y1.500 Z-7.4160 F3000
+G1 X33.840 Y1.500 Z-7.3967 F3000
+G1 X33.820 Y1.500 Z-7.3775 F3000
+G1 X33.800 Y1.500 Z-7.3584 F3000
+G1 X33.780 Y1.500 Z-7.3393 F3000
+G1 X33.760 Y1.500 Z-7.3203 F3000
+G1 X33.740 Y1.500 Z-7.3013 F3000
+G1 X33.720 Y1.500 Z-7.2824 F3000
+G1 X33.700 Y1.500 Z-7.2635 F3000
+G1 X33.680 Y1.500 Z-7.2447 F3000
+G1 X33.660 Y1.500 Z-7.2259 F3000
+G1 X33.640 Y1.500 Z-7.2072 F3000
+G1 X33.620 Y1.500 Z-7.1885 F3000
+G1 X33.600 Y1.500 Z-7.1699 F3000
+G1 X33.580 Y1.500 Z-7.1513 F3000
+G1 X33.560 Y1.500 Z-7.1328 F3000
+G1 X33.540 Y1.500 Z-7.1143 F3000
+G1 X33.520 Y1.500 Z-7.0959 F3000
+G1 X33.500 Y1.500 Z-7.0776 F3000
+G1 X33.480 Y1.500 Z-7.0593 F3000
+G1 X33.460 Y1.500 Z-7.0410 F3000
+G1 X33.440 Y1.500 Z-7.0228 F3000
+G1 X33.420 Y1.500 Z-7.0046 F3000
+G1 X33.400 Y1.500 Z-6.9865 F3000
+G1 X33.380 Y1.500 Z-6.9684 F3000
+G1 X33.360 Y1.500 Z-6.9504 F3000
+G1 X33.340 Y1.500 Z-6.9324 F3000
+G1 X33.320 Y1.500 Z-6.9145 F3000
+G1 X33.300 Y1.500 Z-6.8966 F3000
+G1 X33.280 Y1.500 Z-6.8788 F3000
+G1 X33.260 Y1.500 Z-6.8610 F3000
+G1 X33.240 Y1.500 Z-6.8433 F3000
+G1 X33.220 Y1.500 Z-6.8256 F3000
+G1 X33.200 Y1.500 Z-6.8080 F3000
+G1 X33.180 Y1.500 Z-6.7904 F3000
+G1 X33.160 Y1.500 Z-6.7729 F3000
+G1 X33.140 Y1.500 Z-6.7554 F3000
+G1 X33.120 Y1.500 Z-6.7379 F3000
+G1 X33.100 Y1.500 Z-6.7205 F3000
+G1 X33.080 Y1.500 Z-6.7032 F3000
+G1 X33.060 Y1.500 Z-6.6859 F3000
+G1 X33.040 Y1.500 Z-6.6686 F3000
+G1 X33.020 Y1.500 Z-6.6514 F3000
+G1 X33.000 Y1.500 Z-6.6342 F3000
+G1 X32.980 Y1.500 Z-6.6171 F3000
+G1 X32.960 Y1.500 Z-6.6001 F3000
+G1 X32.940 Y1.500 Z-6.5830 F3000
+G1 X32.920 Y1.500 Z-6.5660 F3000
+G1 X32.900 Y1.500 Z-6.5491 F3000
+G1 X32.880 Y1.500 Z-6.5322 F3000
+G1 X32.860 Y1.500 Z-6.5154 F3000
+G1 X32.840 Y1.500 Z-6.4985 F3000
+G1 X32.820 Y1.500 Z-6.4818 F3000
+G1 X32.800 Y1.500 Z-6.4651 F3000
+G1 X32.780 Y1.500 Z-6.4484 F3000
+G1 X32.760 Y1.500 Z-6.4318 F3000
+G1 X32.740 Y1.500 Z-6.4152 F3000
+G1 X32.720 Y1.500 Z-6.3986 F3000
+G1 X32.700 Y1.500 Z-6.3822 F3000
+G1 X32.680 Y1.500 Z-6.3657 F3000
+G1 X32.660 Y1.500 Z-6.3493 F3000
+G1 X32.640 Y1.500 Z-6.3329 F3000
+G1 X32.620 Y1.500 Z-6.3166 F3000
+G1 X32.600 Y1.500 Z-6.3003 F3000
+G1 X32.580 Y1.500 Z-6.2841 F3000
+G1 X32.560 Y1.500 Z-6.2679 F3000
+G1 X32.540 Y1.500 Z-6.2517 F3000
+G1 X32.520 Y1.500 Z-6.2356 F3000
+G1 X32.500 Y1.500 Z-6.2196 F3000
+G1 X32.480 Y1.500 Z-6.2035 F3000
+G1 X32.460 Y1.500 Z-6.1876 F3000
+G1 X32.440 Y1.500 Z-6.1716 F3000
+G1 X32.420 Y1.500 Z-6.1557 F3000
+G1 X32.400 Y1.500 Z-6.1399 F3000
+G1 X32.380 Y1.500 Z-6.1240 F3000
+G1 X32.360 Y1.500 Z-6.1083 F3000
+G1 X32.340 Y1.500 Z-6.0925 F3000
+G1 X32.320 Y1.500 Z-6.0768 F3000
+G1 X32.300 Y1.500 Z-6.0612 F3000
+G1 X32.280 Y1.500 Z-6.0456 F3000
+G1 X32.260 Y1.500 Z-6.0300 F3000
+G1 X32.240 Y1.500 Z-6.0145 F3000
+G1 X32.220 Y1.500 Z-5.9990 F3000
+G1 X32.200 Y1.500 Z-5.9836 F3000
+G1 X32.180 Y1.500 Z-5.9681 F3000
+G1 X32.160 Y1.500 Z-5.9528 F3000
+G1 X32.140 Y1.500 Z-5.9375 F3000
+G1 X32.120 Y1.500 Z-5.9222 F3000
+G1 X32.100 Y1.500 Z-5.9069 F3000
+G1 X32.080 Y1.500 Z-5.8917 F3000
+G1 X32.060 Y1.500 Z-5.8765 F3000
+G1 X32.040 Y1.500 Z-5.8614 F3000
+G1 X32.020 Y1.500 Z-5.8463 F3000
+G1 X32.000 Y1.500 Z-5.8313 F3000
+G1 X31.980 Y1.500 Z-5.8163 F3000
+G1 X31.960 Y1.500 Z-5.8013 F3000
+G1 X31.940 Y1.500 Z-5.7864 F3000
+G1 X31.920 Y1.500 Z-5.7715 F3000
+G1 X31.900 Y1.500 Z-5.7566 F3000
+G1 X31.880 Y1.500 Z-5.7418 F3000
+G1 X31.860 Y1.500 Z-5.7270 F3000
+G1 X31.840 Y1.500 Z-5.7123 F3000
+G1 X31.820 Y1.500 Z-5.6976 F3000
+G1 X31.800 Y1.500 Z-5.6829 F3000
+G1 X31.780 Y1.500 Z-5.6683 F3000
+G1 X31.760 Y1.500 Z-5.6537 F3000
+G1 X31.740 Y1.500 Z-5.6392 F3000
+G1 X31.720 Y1.500 Z-5.6247 F3000
+G1 X31.700 Y1.500 Z-5.6102 F3000
+G1 X31.680 Y1.500 Z-5.5958 F3000
+G1 X31.660 Y1.500 Z-5.5814 F3000
+G1 X31.640 Y1.500 Z-5.5670 F3000
+G1 X31.620 Y1.500 Z-5.5527 F3000
+G1 X31.600 Y1.500 Z-5.5384 F3000
+G1 X31.580 Y1.500 Z-5.5241 F3000
+G1 X31.560 Y1.500 Z-5.5099 F3000
+G1 X31.540 Y1.500 Z-5.4958 F3000
+G1 X31.520 Y1.500 Z-5.4816 F3000
+G1 X31.500 Y1.500 Z-5.4675 F3000
+G1 X31.480 Y1.500 Z-5.4535 F3000
+G1 X31.460 Y1.500 Z-5.4394 F3000
+G1 X31.440 Y1.500 Z-5.4254 F3000
+G1 X31.420 Y1.500 Z-5.4115 F3000
+G1 X31.400 Y1.500 Z-5.3976 F3000
+G1 X31.380 Y1.500 Z-5.3837 F3000
+G1 X31.360 Y1.500 Z-5.3698 F3000
+G1 X31.340 Y1.500 Z-5.3560 F3000
+G1 X31.320 Y1.500 Z-5.3422 F3000
+G1 X31.300 Y1.500 Z-5.3285 F3000
+G1 X31.280 Y1.500 Z-5.3148 F3000
+G1 X31.260 Y1.500 Z-5.3011 F3000
+G1 X31.240 Y1.500 Z-5.2875 F3000
+G1 X31.220 Y1.500 Z-5.2739 F3000
+G1 X31.200 Y1.500 Z-5.2604 F3000
+G1 X31.180 Y1.500 Z-5.2468 F3000
+G1 X31.160 Y1.500 Z-5.2333 F3000
+G1 X31.140 Y1.500 Z-5.2199 F3000
+G1 X31.120 Y1.500 Z-5.2065 F3000
+G1 X31.100 Y1.500 Z-5.1931 F3000
+G1 X31.080 Y1.500 Z-5.1797 F3000
+G1 X31.060 Y1.500 Z-5.1664 F3000
+G1 X31.040 Y1.500 Z-5.1531 F3000
+G1 X31.020 Y1.500 Z-5.1399 F3000
+G1 X31.000 Y1.500 Z-5.1267 F3000
+G1 X30.980 Y1.500 Z-5.1135 F3000
+G1 X30.960 Y1.500 Z-5.1003 F3000
+G1 X30.940 Y1.500 Z-5.0872 F3000
+G1 X30.920 Y1.500 Z-5.0742 F3000
+G1 X30.900 Y1.500 Z-5.0611 F3000
+G1 X30.880 Y1.500 Z-5.0481 F3000
+G1 X30.860 Y1.500 Z-5.0351 F3000
+G1 X30.840 Y1.500 Z-5.0222 F3000
+G1 X30.820 Y1.500 Z-5.0093 F3000
+G1 X30.800 Y1.500 Z-4.9964 F3000
+G1 X30.780 Y1.500 Z-4.9836 F3000
+G1 X30.760 Y1.500 Z-4.9708 F3000
+G1 X30.740 Y1.500 Z-4.9580 F3000
+G1 X30.720 Y1.500 Z-4.9453 F3000
+G1 X30.700 Y1.500 Z-4.9326 F3000
+G1 X30.680 Y1.500 Z-4.9199 F3000
+G1 X30.660 Y1.500 Z-4.9073 F3000
+G1 X30.640 Y1.500 Z-4.8947 F3000
+G1 X30.620 Y1.500 Z-4.8821 F3000
+G1 X30.600 Y1.500 Z-4.8696 F3000
+G1 X30.580 Y1.500 Z-4.8570 F3000
+G1 X30.560 Y1.500 Z-4.8446 F3000
+G1 X30.540 Y1.500 Z-4.8321 F3000
+G1 X30.520 Y1.500 Z-4.8197 F3000
+G1 X30.500 Y1.500 Z-4.8074 F3000
+G1 X30.480 Y1.500 Z-4.7950 F3000
+G1 X30.460 Y1.500 Z-4.7827 F3000
+G1 X30.440 Y1.500 Z-4.7704 F3000
+G1 X30.420 Y1.500 Z-4.7582 F3000
+G1 X30.400 Y1.500 Z-4.7460 F3000
+G1 X30.380 Y1.500 Z-4.7338 F3000
+G1 X30.360 Y1.500 Z-4.7216 F3000
+G1 X30.340 Y1.500 Z-4.7095 F3000
+G1 X30.320 Y1.500 Z-4.6974 F3000
+G1 X30.300 Y1.500 Z-4.6854 F3000
+G1 X30.280 Y1.500 Z-4.6734 F3000
+G1 X30.260 Y1.500 Z-4.6614 F3000
+G1 X30.240 Y1.500 Z-4.6494 F3000
+G1 X30.220 Y1.500 Z-4.6375 F3000
+G1 X30.200 Y1.500 Z-4.6256 F3000
+G1 X30.180 Y1.500 Z-4.6137 F3000
+G1 X30.160 Y1.500 Z-4.6019 F3000
+G1 X30.140 Y1.500 Z-4.5901 F3000
+G1 X30.120 Y1.500 Z-4.5783 F3000
+G1 X30.100 Y1.500 Z-4.5666 F3000
+G1 X30.080 Y1.500 Z-4.5549 F3000
+G1 X30.060 Y1.500 Z-4.5432 F3000
+G1 X30.040 Y1.500 Z-4.5316 F3000
+G1 X30.020 Y1.500 Z-4.5200 F3000
+G1 X30.000 Y1.500 Z-4.5084 F3000
+G1 X29.980 Y1.500 Z-4.4968 F3000
+G1 X29.960 Y1.500 Z-4.4853 F3000
+G1 X29.940 Y1.500 Z-4.4738 F3000
+G1 X29.920 Y1.500 Z-4.4624 F3000
+G1 X29.900 Y1.500 Z-4.4509 F3000
+G1 X29.880 Y1.500 Z-4.4395 F3000
+G1 X29.860 Y1.500 Z-4.4282 F3000
+G1 X29.840 Y1.500 Z-4.4168 F3000
+G1 X29.820 Y1.500 Z-4.4055 F3000
+G1 X29.800 Y1.500 Z-4.3943 F3000
+G1 X29.780 Y1.500 Z-4.3830 F3000
+G1 X29.760 Y1.500 Z-4.3718 F3000
+G1 X29.740 Y1.500 Z-4.3606 F3000
+G1 X29.720 Y1.500 Z-4.3495 F3000
+G1 X29.700 Y1.500 Z-4.3383 F3000
+G1 X29.680 Y1.500 Z-4.3272 F3000
+G1 X29.660 Y1.500 Z-4.3162 F3000
+G1 X29.640 Y1.500 Z-4.3051 F3000
+G1 X29.620 Y1.500 Z-4.2941 F3000
+G1 X29.600 Y1.500 Z-4.2832 F3000
+G1 X29.580 Y1.500 Z-4.2722 F3000
+G1 X29.560 Y1.500 Z-4.2613 F3000
+G1 X29.540 Y1.500 Z-4.2504 F3000
+G1 X29.520 Y1.500 Z-4.2395 F3000
+G1 X29.500 Y1.500 Z-4.2287 F3000
+G1 X29.480 Y1.500 Z-4.2179 F3000
+G1 X29.460 Y1.500 Z-4.2071 F3000
+G1 X29.440 Y1.500 Z-4.1964 F3000
+G1 X29.420 Y1.500 Z-4.1857 F3000
+G1 X29.400 Y1.500 Z-4.1750 F3000
+G1 X29.380 Y1.500 Z-4.1644 F3000
+G1 X29.360 Y1.500 Z-4.1537 F3000
+G1 X29.340 Y1.500 Z-4.1431 F3000
+G1 X29.320 Y1.500 Z-4.1326 F3000
+G1 X29.300 Y1.500 Z-4.1220 F3000
+G1 X29.280 Y1.500 Z-4.1115 F3000
+G1 X29.260 Y1.500 Z-4.1011 F3000
+G1 X29.240 Y1.500 Z-4.0906 F3000
+G1 X29.220 Y1.500 Z-4.0802 F3000
+G1 X29.200 Y1.500 Z-4.0698 F3000
+G1 X29.180 Y1.500 Z-4.0594 F3000
+G1 X29.160 Y1.500 Z-4.0491 F3000
+G1 X29.140 Y1.500 Z-4.0388 F3000
+G1 X29.120 Y1.500 Z-4.0285 F3000
+G1 X29.100 Y1.500 Z-4.0183 F3000
+G1 X29.080 Y1.500 Z-4.0080 F3000
+G1 X29.060 Y1.500 Z-3.9979 F3000
+G1 X29.040 Y1.500 Z-3.9877 F3000
+G1 X29.020 Y1.500 Z-3.9776 F3000
+G1 X29.000 Y1.500 Z-3.9674 F3000
+G1 X28.980 Y1.500 Z-3.9574 F3000
+G1 X28.960 Y1.500 Z-3.9473 F3000
+G1 X28.940 Y1.500 Z-3.9373 F3000
+G1 X28.920 Y1.500 Z-3.9273 F3000
+G1 X28.900 Y1.500 Z-3.9173 F3000
+G1 X28.880 Y1.500 Z-3.9074 F3000
+G1 X28.860 Y1.500 Z-3.8975 F3000
+G1 X28.840 Y1.500 Z-3.8876 F3000
+G1 X28.820 Y1.500 Z-3.8777 F3000
+G1 X28.800 Y1.500 Z-3.8679 F3000
+G1 X28.780 Y1.500 Z-3.8581 F3000
+G1 X28.760 Y1.500 Z-3.8483 F3000
+G1 X28.740 Y1.500 Z-3.8386 F3000
+G1 X28.720 Y1.500 Z-3.8289 F3000
+G1 X28.700 Y1.500 Z-3.8192 F3000
+G1 X28.680 Y1.500 Z-3.8095 F3000
+G1 X28.660 Y1.500 Z-3.7999 F3000
+G1 X28.640 Y1.500 Z-3.7903 F3000
+G1 X28.620 Y1.500 Z-3.7807 F3000
+G1 X28.600 Y1.500 Z-3.7711 F3000
+G1 X28.580 Y1.500 Z-3.7616 F3000
+G1 X28.560 Y1.500 Z-3.7521 F3000
+G1 X28.540 Y1.500 Z-3.7426 F3000
+G1 X28.520 Y1.500 Z-3.7332 F3000
+G1 X28.500 Y1.500 Z-3.7238 F3000
+G1 X28.480 Y1.500 Z-3.7144 F3000
+G1 X28.460 Y1.500 Z-3.7050 F3000
+G1 X28.440 Y1.500 Z-3.6957 F3000
+G1 X28.420 Y1.500 Z-3.6864 F3000
+G1 X28.400 Y1.500 Z-3.6771 F3000
+G1 X28.380 Y1.500 Z-3.6678 F3000
+G1 X28.360 Y1.500 Z-3.6586 F3000
+G1 X28.340 Y1.500 Z-3.6494 F3000
+G1 X28.320 Y1.500 Z-3.6402 F3000
+G1 X28.300 Y1.500 Z-3.6311 F3000
+G1 X28.280 Y1.500 Z-3.6219 F3000
+G1 X28.260 Y1.500 Z-3.6129 F3000
+G1 X28.240 Y1.500 Z-3.6038 F3000
+G1 X28.220 Y1.500 Z-3.5947 F3000
+G1 X28.200 Y1.500 Z-3.5857 F3000
+G1 X28.180 Y1.500 Z-3.5767 F3000
+G1 X28.160 Y1.500 Z-3.5678 F3000
+G1 X28.140 Y1.500 Z-3.5588 F3000
+G1 X28.120 Y1.500 Z-3.5499 F3000
+G1 X28.100 Y1.500 Z-3.5410 F3000
+G1 X28.080 Y1.500 Z-3.5322 F3000
+G1 X28.060 Y1.500 Z-3.5233 F3000
+G1 X28.040 Y1.500 Z-3.5145 F3000
+G1 X28.020 Y1.500 Z-3.5057 F3000
+G1 X28.000 Y1.500 Z-3.4970 F3000
+G1 X27.980 Y1.500 Z-3.4883 F3000
+G1 X27.960 Y1.500 Z-3.4796 F3000
+G1 X27.940 Y1.500 Z-3.4709 F3000
+G1 X27.920 Y1.500 Z-3.4622 F3000
+G1 X27.900 Y1.500 Z-3.4536 F3000
+G1 X27.880 Y1.500 Z-3.4450 F3000
+G1 X27.860 Y1.500 Z-3.4364 F3000
+G1 X27.840 Y1.500 Z-3.4279 F3000
+G1 X27.820 Y1.500 Z-3.4194 F3000
+G1 X27.800 Y1.500 Z-3.4109 F3000
+G1 X27.780 Y1.500 Z-3.4024 F3000
+G1 X27.760 Y1.500 Z-3.3940 F3000
+G1 X27.740 Y1.500 Z-3.3855 F3000
+G1 X27.720 Y1.500 Z-3.3771 F3000
+G1 X27.700 Y1.500 Z-3.3688 F3000
+G1 X27.680 Y1.500 Z-3.3604 F3000
+G1 X27.660 Y1.500 Z-3.3521 F3000
+G1 X27.640 Y1.500 Z-3.3438 F3000
+G1 X27.620 Y1.500 Z-3.3356 F3000
+G1 X27.600 Y1.500 Z-3.3273 F3000
+G1 X27.580 Y1.500 Z-3.3191 F3000
+G1 X27.560 Y1.500 Z-3.3109 F3000
+G1 X27.540 Y1.500 Z-3.3027 F3000
+G1 X27.520 Y1.500 Z-3.2946 F3000
+G1 X27.500 Y1.500 Z-3.2865 F3000
+G1 X27.480 Y1.500 Z-3.2784 F3000
+G1 X27.460 Y1.500 Z-3.2703 F3000
+G1 X27.440 Y1.500 Z-3.2623 F3000
+G1 X27.420 Y1.500 Z-3.2543 F3000
+G1 X27.400 Y1.500 Z-3.2463 F3000
+G1 X27.380 Y1.500 Z-3.2383 F3000
+G1 X27.360 Y1.500 Z-3.2304 F3000
+G1 X27.340 Y1.500 Z-3.2225 F3000
+G1 X27.320 Y1.500 Z-3.2146 F3000
+G1 X27.300 Y1.500 Z-3.2067 F3000
+G1 X27.280 Y1.500 Z-3.1989 F3000
+G1 X27.260 Y1.500 Z-3.1911 F3000
+G1 X27.240 Y1.500 Z-3.1833 F3000
+G1 X27.220 Y1.500 Z-3.1755 F3000
+G1 X27.200 Y1.500 Z-3.1678 F3000
+G1 X27.180 Y1.500 Z-3.1601 F3000
+G1 X27.160 Y1.500 Z-3.1524 F3000
+G1 X27.140 Y1.500 Z-3.1447 F3000
+G1 X27.120 Y1.500 Z-3.1371 F3000
+G1 X27.100 Y1.500 Z-3.1294 F3000
+G1 X27.080 Y1.500 Z-3.1218 F3000
+G1 X27.060 Y1.500 Z-3.1143 F3000
+G1 X27.040 Y1.500 Z-3.1067 F3000
+G1 X27.020 Y1.500 Z-3.0992 F3000
+G1 X27.000 Y1.500 Z-3.0917 F3000
+G1 X26.980 Y1.500 Z-3.0842 F3000
+G1 X26.960 Y1.500 Z-3.0768 F3000
+G1 X26.940 Y1.500 Z-3.0694 F3000
+G1 X26.920 Y1.500 Z-3.0620 F3000
+G1 X26.900 Y1.500 Z-3.0546 F3000
+G1 X26.880 Y1.500 Z-3.0473 F3000
+G1 X26.860 Y1.500 Z-3.0399 F3000
+G1 X26.840 Y1.500 Z-3.0326 F3000
+G1 X26.820 Y1.500 Z-3.0253 F3000
+G1 X26.800 Y1.500 Z-3.0181 F3000
+G1 X26.780 Y1.500 Z-3.0109 F3000
+G1 X26.760 Y1.500 Z-3.0037 F3000
+G1 X26.740 Y1.500 Z-2.9965 F3000
+G1 X26.720 Y1.500 Z-2.9893 F3000
+G1 X26.700 Y1.500 Z-2.9822 F3000
+G1 X26.680 Y1.500 Z-2.9751 F3000
+G1 X26.660 Y1.500 Z-2.9680 F3000
+G1 X26.640 Y1.500 Z-2.9609 F3000
+G1 X26.620 Y1.500 Z-2.9539 F3000
+G1 X26.600 Y1.500 Z-2.9469 F3000
+G1 X26.580 Y1.500 Z-2.9399 F3000
+G1 X26.560 Y1.500 Z-2.9329 F3000
+G1 X26.540 Y1.500 Z-2.9260 F3000
+G1 X26.520 Y1.500 Z-2.9191 F3000
+G1 X26.500 Y1.500 Z-2.9122 F3000
+G1 X26.480 Y1.500 Z-2.9053 F3000
+G1 X26.460 Y1.500 Z-2.8985 F3000
+G1 X26.440 Y1.500 Z-2.8916 F3000
+G1 X26.420 Y1.500 Z-2.8848 F3000
+G1 X26.400 Y1.500 Z-2.8781 F3000
+G1 X26.380 Y1.500 Z-2.8713 F3000
+G1 X26.360 Y1.500 Z-2.8646 F3000
+G1 X26.340 Y1.500 Z-2.8579 F3000
+G1 X26.320 Y1.500 Z-2.8512 F3000
+G1 X26.300 Y1.500 Z-2.8445 F3000
+G1 X26.280 Y1.500 Z-2.8379 F3000
+G1 X26.260 Y1.500 Z-2.8313 F3000
+G1 X26.240 Y1.500 Z-2.8247 F3000
+G1 X26.220 Y1.500 Z-2.8181 F3000
+G1 X26.200 Y1.500 Z-2.8116 F3000
+G1 X26.180 Y1.500 Z-2.8051 F3000
+G1 X26.160 Y1.500 Z-2.7986 F3000
+G1 X26.140 Y1.500 Z-2.7921 F3000
+G1 X26.120 Y1.500 Z-2.7856 F3000
+G1 X26.100 Y1.500 Z-2.7792 F3000
+G1 X26.080 Y1.500 Z-2.7728 F3000
+G1 X26.060 Y1.500 Z-2.7664 F3000
+G1 X26.040 Y1.500 Z-2.7601 F3000
+G1 X26.020 Y1.500 Z-2.7538 F3000
+G1 X26.000 Y1.500 Z-2.7474 F3000
+G1 X25.980 Y1.500 Z-2.7412 F3000
+G1 X25.960 Y1.500 Z-2.7349 F3000
+G1 X25.940 Y1.500 Z-2.7286 F3000
+G1 X25.920 Y1.500 Z-2.7224 F3000
+G1 X25.900 Y1.500 Z-2.7162 F3000
+G1 X25.880 Y1.500 Z-2.7101 F3000
+G1 X25.860 Y1.500 Z-2.7039 F3000
+G1 X25.840 Y1.500 Z-2.6978 F3000
+G1 X25.820 Y1.500 Z-2.6917 F3000
+G1 X25.800 Y1.500 Z-2.6856 F3000
+G1 X25.780 Y1.500 Z-2.6796 F3000
+G1 X25.760 Y1.500 Z-2.6735 F3000
+G1 X25.740 Y1.500 Z-2.6675 F3000
+G1 X25.720 Y1.500 Z-2.6615 F3000
+G1 X25.700 Y1.500 Z-2.6555 F3000
+G1 X25.680 Y1.500 Z-2.6496 F3000
+G1 X25.660 Y1.500 Z-2.6437 F3000
+G1 X25.640 Y1.500 Z-2.6378 F3000
+G1 X25.620 Y1.500 Z-2.6319 F3000
+G1 X25.600 Y1.500 Z-2.6261 F3000
+G1 X25.580 Y1.500 Z-2.6202 F3000
+G1 X25.560 Y1.500 Z-2.6144 F3000
+G1 X25.540 Y1.500 Z-2.6086 F3000
+G1 X25.520 Y1.500 Z-2.6029 F3000
+G1 X25.500 Y1.500 Z-2.5971 F3000
+G1 X25.480 Y1.500 Z-2.5914 F3000
+G1 X25.460 Y1.500 Z-2.5857 F3000
+G1 X25.440 Y1.500 Z-2.5801 F3000
+G1 X25.420 Y1.500 Z-2.5744 F3000
+G1 X25.400 Y1.500 Z-2.5688 F3000
+G1 X25.380 Y1.500 Z-2.5632 F3000
+G1 X25.360 Y1.500 Z-2.5576 F3000
+G1 X25.340 Y1.500 Z-2.5520 F3000
+G1 X25.320 Y1.500 Z-2.5465 F3000
+G1 X25.300 Y1.500 Z-2.5410 F3000
+G1 X25.280 Y1.500 Z-2.5355 F3000
+G1 X25.260 Y1.500 Z-2.5300 F3000
+G1 X25.240 Y1.500 Z-2.5246 F3000
+G1 X25.220 Y1.500 Z-2.5191 F3000
+G1 X25.200 Y1.500 Z-2.5137 F3000
+G1 X25.180 Y1.500 Z-2.5084 F3000
+G1 X25.160 Y1.500 Z-2.5030 F3000
+G1 X25.140 Y1.500 Z-2.4977 F3000
+G1 X25.120 Y1.500 Z-2.4923 F3000
+G1 X25.100 Y1.500 Z-2.4871 F3000
+G1 X25.080 Y1.500 Z-2.4818 F3000
+G1 X25.060 Y1.500 Z-2.4765 F3000
+G1 X25.040 Y1.500 Z-2.4713 F3000
+G1 X25.020 Y1.500 Z-2.4661 F3000
+G1 X25.000 Y1.500 Z-2.4609 F3000
+G1 X24.980 Y1.500 Z-2.4558 F3000
+G1 X24.960 Y1.500 Z-2.4506 F3000
+G1 X24.940 Y1.500 Z-2.4455 F3000
+G1 X24.920 Y1.500 Z-2.4404 F3000
+G1 X24.900 Y1.500 Z-2.4353 F3000
+G1 X24.880 Y1.500 Z-2.4303 F3000
+G1 X24.860 Y1.500 Z-2.4253 F3000
+G1 X24.840 Y1.500 Z-2.4203 F3000
+G1 X24.820 Y1.500 Z-2.4153 F3000
+G1 X24.800 Y1.500 Z-2.4103 F3000
+G1 X24.780 Y1.500 Z-2.4054 F3000
+G1 X24.760 Y1.500 Z-2.4005 F3000
+G1 X24.740 Y1.500 Z-2.3956 F3000
+G1 X24.720 Y1.500 Z-2.3907 F3000
+G1 X24.700 Y1.500 Z-2.3858 F3000
+G1 X24.680 Y1.500 Z-2.3810 F3000
+G1 X24.660 Y1.500 Z-2.3762 F3000
+G1 X24.640 Y1.500 Z-2.3714 F3000
+G1 X24.620 Y1.500 Z-2.3666 F3000
+G1 X24.600 Y1.500 Z-2.3619 F3000
+G1 X24.580 Y1.500 Z-2.3572 F3000
+G1 X24.560 Y1.500 Z-2.3525 F3000
+G1 X24.540 Y1.500 Z-2.3478 F3000
+G1 X24.520 Y1.500 Z-2.3431 F3000
+G1 X24.500 Y1.500 Z-2.3385 F3000
+G1 X24.480 Y1.500 Z-2.3339 F3000
+G1 X24.460 Y1.500 Z-2.3293 F3000
+G1 X24.440 Y1.500 Z-2.3247 F3000
+G1 X24.420 Y1.500 Z-2.3202 F3000
+G1 X24.400 Y1.500 Z-2.3156 F3000
+G1 X24.380 Y1.500 Z-2.3111 F3000
+G1 X24.360 Y1.500 Z-2.3067 F3000
+G1 X24.340 Y1.500 Z-2.3022 F3000
+G1 X24.320 Y1.500 Z-2.2978 F3000
+G1 X24.300 Y1.500 Z-2.2933 F3000
+G1 X24.280 Y1.500 Z-2.2889 F3000
+G1 X24.260 Y1.500 Z-2.2846 F3000
+G1 X24.240 Y1.500 Z-2.2802 F3000
+G1 X24.220 Y1.500 Z-2.2759 F3000
+G1 X24.200 Y1.500 Z-2.2716 F3000
+G1 X24.180 Y1.500 Z-2.2673 F3000
+G1 X24.160 Y1.500 Z-2.2630 F3000
+G1 X24.140 Y1.500 Z-2.2588 F3000
+G1 X24.120 Y1.500 Z-2.2545 F3000
+G1 X24.100 Y1.500 Z-2.2503 F3000
+G1 X24.080 Y1.500 Z-2.2461 F3000
+G1 X24.060 Y1.500 Z-2.2420 F3000
+G1 X24.040 Y1.500 Z-2.2378 F3000
+G1 X24.020 Y1.500 Z-2.2337 F3000
+G1 X24.000 Y1.500 Z-2.2296 F3000
+G1 X23.980 Y1.500 Z-2.2255 F3000
+G1 X23.960 Y1.500 Z-2.2215 F3000
+G1 X23.940 Y1.500 Z-2.2174 F3000
+G1 X23.920 Y1.500 Z-2.2134 F3000
+G1 X23.900 Y1.500 Z-2.2094 F3000
+G1 X23.880 Y1.500 Z-2.2055 F3000
+G1 X23.860 Y1.500 Z-2.2015 F3000
+G1 X23.840 Y1.500 Z-2.1976 F3000
+G1 X23.820 Y1.500 Z-2.1937 F3000
+G1 X23.800 Y1.500 Z-2.1898 F3000
+G1 X23.780 Y1.500 Z-2.1859 F3000
+G1 X23.760 Y1.500 Z-2.1821 F3000
+G1 X23.740 Y1.500 Z-2.1783 F3000
+G1 X23.720 Y1.500 Z-2.1745 F3000
+G1 X23.700 Y1.500 Z-2.1707 F3000
+G1 X23.680 Y1.500 Z-2.1669 F3000
+G1 X23.660 Y1.500 Z-2.1632 F3000
+G1 X23.640 Y1.500 Z-2.1595 F3000
+G1 X23.620 Y1.500 Z-2.1558 F3000
+G1 X23.600 Y1.500 Z-2.1521 F3000
+G1 X23.580 Y1.500 Z-2.1484 F3000
+G1 X23.560 Y1.500 Z-2.1448 F3000
+G1 X23.540 Y1.500 Z-2.1412 F3000
+G1 X23.520 Y1.500 Z-2.1376 F3000
+G1 X23.500 Y1.500 Z-2.1340 F3000
+G1 X23.480 Y1.500 Z-2.1305 F3000
+G1 X23.460 Y1.500 Z-2.1270 F3000
+G1 X23.440 Y1.500 Z-2.1235 F3000
+G1 X23.420 Y1.500 Z-2.1200 F3000
+G1 X23.400 Y1.500 Z-2.1165 F3000
+G1 X23.380 Y1.500 Z-2.1131 F3000
+G1 X23.360 Y1.500 Z-2.1096 F3000
+G1 X23.340 Y1.500 Z-2.1062 F3000
+G1 X23.320 Y1.500 Z-2.1029 F3000
+G1 X23.300 Y1.500 Z-2.0995 F3000
+G1 X23.280 Y1.500 Z-2.0962 F3000
+G1 X23.260 Y1.500 Z-2.0928 F3000
+G1 X23.240 Y1.500 Z-2.0895 F3000
+G1 X23.220 Y1.500 Z-2.0863 F3000
+G1 X23.200 Y1.500 Z-2.0830 F3000
+G1 X23.180 Y1.500 Z-2.0798 F3000
+G1 X23.160 Y1.500 Z-2.0766 F3000
+G1 X23.140 Y1.500 Z-2.0734 F3000
+G1 X23.120 Y1.500 Z-2.0702 F3000
+G1 X23.100 Y1.500 Z-2.0670 F3000
+G1 X23.080 Y1.500 Z-2.0639 F3000
+G1 X23.060 Y1.500 Z-2.0608 F3000
+G1 X23.040 Y1.500 Z-2.0577 F3000
+G1 X23.020 Y1.500 Z-2.0546 F3000
+G1 X23.000 Y1.500 Z-2.0516 F3000
+G1 X22.980 Y1.500 Z-2.0486 F3000
+G1 X22.960 Y1.500 Z-2.0455 F3000
+G1 X22.940 Y1.500 Z-2.0426 F3000
+G1 X22.920 Y1.500 Z-2.0396 F3000
+G1 X22.900 Y1.500 Z-2.0367 F3000
+G1 X22.880 Y1.500 Z-2.0337 F3000
+G1 X22.860 Y1.500 Z-2.0308 F3000
+G1 X22.840 Y1.500 Z-2.0279 F3000
+G1 X22.820 Y1.500 Z-2.0251 F3000
+G1 X22.800 Y1.500 Z-2.0222 F3000
+G1 X22.780 Y1.500 Z-2.0194 F3000
+G1 X22.760 Y1.500 Z-2.0166 F3000
+G1 X22.740 Y1.500 Z-2.0138 F3000
+G1 X22.720 Y1.500 Z-2.0111 F3000
+G1 X22.700 Y1.500 Z-2.0083 F3000
+G1 X22.680 Y1.500 Z-2.0056 F3000
+G1 X22.660 Y1.500 Z-2.0029 F3000
+G1 X22.640 Y1.500 Z-2.0002 F3000
+G1 X22.620 Y1.500 Z-1.9976 F3000
+G1 X22.600 Y1.500 Z-1.9950 F3000
+G1 X22.580 Y1.500 Z-1.9923 F3000
+G1 X22.560 Y1.500 Z-1.9897 F3000
+G1 X22.540 Y1.500 Z-1.9872 F3000
+G1 X22.520 Y1.500 Z-1.9846 F3000
+G1 X22.500 Y1.500 Z-1.9821 F3000
+G1 X22.480 Y1.500 Z-1.9796 F3000
+G1 X22.460 Y1.500 Z-1.9771 F3000
+G1 X22.440 Y1.500 Z-1.9746 F3000
+G1 X22.420 Y1.500 Z-1.9722 F3000
+G1 X22.400 Y1.500 Z-1.9697 F3000
+G1 X22.380 Y1.500 Z-1.9673 F3000
+G1 X22.360 Y1.500 Z-1.9649 F3000
+G1 X22.340 Y1.500 Z-1.9626 F3000
+G1 X22.320 Y1.500 Z-1.9602 F3000
+G1 X22.300 Y1.500 Z-1.9579 F3000
+G1 X22.280 Y1.500 Z-1.9556 F3000
+G1 X22.260 Y1.500 Z-1.9533 F3000
+G1 X22.240 Y1.500 Z-1.9510 F3000
+G1 X22.220 Y1.500 Z-1.9488 F3000
+G1 X22.200 Y1.500 Z-1.9465 F3000
+G1 X22.180 Y1.500 Z-1.9443 F3000
+G1 X22.160 Y1.500 Z-1.9421 F3000
+G1 X22.140 Y1.500 Z-1.9400 F3000
+G1 X22.120 Y1.500 Z-1.9378 F3000
+G1 X22.100 Y1.500 Z-1.9357 F3000
+G1 X22.080 Y1.500 Z-1.9336 F3000
+G1 X22.060 Y1.500 Z-1.9315 F3000
+G1 X22.040 Y1.500 Z-1.9295 F3000
+G1 X22.020 Y1.500 Z-1.9274 F3000
+G1 X22.000 Y1.500 Z-1.9254 F3000
+G1 X21.980 Y1.500 Z-1.9234 F3000
+G1 X21.960 Y1.500 Z-1.9214 F3000
+G1 X21.940 Y1.500 Z-1.9194 F3000
+G1 X21.920 Y1.500 Z-1.9175 F3000
+G1 X21.900 Y1.500 Z-1.9156 F3000
+G1 X21.880 Y1.500 Z-1.9137 F3000
+G1 X21.860 Y1.500 Z-1.9118 F3000
+G1 X21.840 Y1.500 Z-1.9099 F3000
+G1 X21.820 Y1.500 Z-1.9081 F3000
+G1 X21.800 Y1.500 Z-1.9063 F3000
+G1 X21.780 Y1.500 Z-1.9045 F3000
+G1 X21.760 Y1.500 Z-1.9027 F3000
+G1 X21.740 Y1.500 Z-1.9009 F3000
+G1 X21.720 Y1.500 Z-1.8992 F3000
+G1 X21.700 Y1.500 Z-1.8975 F3000
+G1 X21.680 Y1.500 Z-1.8958 F3000
+G1 X21.660 Y1.500 Z-1.8941 F3000
+G1 X21.640 Y1.500 Z-1.8925 F3000
+G1 X21.620 Y1.500 Z-1.8908 F3000
+G1 X21.600 Y1.500 Z-1.8892 F3000
+G1 X21.580 Y1.500 Z-1.8876 F3000
+G1 X21.560 Y1.500 Z-1.8860 F3000
+G1 X21.540 Y1.500 Z-1.8845 F3000
+G1 X21.520 Y1.500 Z-1.8829 F3000
+G1 X21.500 Y1.500 Z-1.8814 F3000
+G1 X21.480 Y1.500 Z-1.8799 F3000
+G1 X21.460 Y1.500 Z-1.8784 F3000
+G1 X21.440 Y1.500 Z-1.8770 F3000
+G1 X21.420 Y1.500 Z-1.8756 F3000
+G1 X21.400 Y1.500 Z-1.8741 F3000
+G1 X21.380 Y1.500 Z-1.8727 F3000
+G1 X21.360 Y1.500 Z-1.8714 F3000
+G1 X21.340 Y1.500 Z-1.8700 F3000
+G1 X21.320 Y1.500 Z-1.8687 F3000
+G1 X21.300 Y1.500 Z-1.8674 F3000
+G1 X21.280 Y1.500 Z-1.8661 F3000
+G1 X21.260 Y1.500 Z-1.8648 F3000
+G1 X21.240 Y1.500 Z-1.8635 F3000
+G1 X21.220 Y1.500 Z-1.8623 F3000
+G1 X21.200 Y1.500 Z-1.8611 F3000
+G1 X21.180 Y1.500 Z-1.8599 F3000
+G1 X21.160 Y1.500 Z-1.8587 F3000
+G1 X21.140 Y1.500 Z-1.8576 F3000
+G1 X21.120 Y1.500 Z-1.8564 F3000
+G1 X21.100 Y1.500 Z-1.8553 F3000
+G1 X21.080 Y1.500 Z-1.8542 F3000
+G1 X21.060 Y1.500 Z-1.8532 F3000
+G1 X21.040 Y1.500 Z-1.8521 F3000
+G1 X21.020 Y1.500 Z-1.8511 F3000
+G1 X21.000 Y1.500 Z-1.8501 F3000
+G1 X20.980 Y1.500 Z-1.8491 F3000
+G1 X20.960 Y1.500 Z-1.8481 F3000
+G1 X20.940 Y1.500 Z-1.8471 F3000
+G1 X20.920 Y1.500 Z-1.8462 F3000
+G1 X20.900 Y1.500 Z-1.8453 F3000
+G1 X20.880 Y1.500 Z-1.8444 F3000
+G1 X20.860 Y1.500 Z-1.8435 F3000
+G1 X20.840 Y1.500 Z-1.8427 F3000
+G1 X20.820 Y1.500 Z-1.8419 F3000
+G1 X20.800 Y1.500 Z-1.8410 F3000
+G1 X20.780 Y1.500 Z-1.8403 F3000
+G1 X20.760 Y1.500 Z-1.8395 F3000
+G1 X20.740 Y1.500 Z-1.8387 F3000
+G1 X20.720 Y1.500 Z-1.8380 F3000
+G1 X20.700 Y1.500 Z-1.8373 F3000
+G1 X20.680 Y1.500 Z-1.8366 F3000
+G1 X20.660 Y1.500 Z-1.8359 F3000
+G1 X20.640 Y1.500 Z-1.8353 F3000
+G1 X20.620 Y1.500 Z-1.8346 F3000
+G1 X20.600 Y1.500 Z-1.8340 F3000
+G1 X20.580 Y1.500 Z-1.8334 F3000
+G1 X20.560 Y1.500 Z-1.8329 F3000
+G1 X20.540 Y1.500 Z-1.8323 F3000
+G1 X20.520 Y1.500 Z-1.8318 F3000
+G1 X20.500 Y1.500 Z-1.8313 F3000
+G1 X20.480 Y1.500 Z-1.8308 F3000
+G1 X20.460 Y1.500 Z-1.8303 F3000
+G1 X20.440 Y1.500 Z-1.8299 F3000
+G1 X20.420 Y1.500 Z-1.8294 F3000
+G1 X20.400 Y1.500 Z-1.8290 F3000
+G1 X20.380 Y1.500 Z-1.8286 F3000
+G1 X20.360 Y1.500 Z-1.8283 F3000
+G1 X20.340 Y1.500 Z-1.8279 F3000
+G1 X20.320 Y1.500 Z-1.8276 F3000
+G1 X20.300 Y1.500 Z-1.8273 F3000
+G1 X20.280 Y1.500 Z-1.8270 F3000
+G1 X20.260 Y1.500 Z-1.8267 F3000
+G1 X20.240 Y1.500 Z-1.8265 F3000
+G1 X20.220 Y1.500 Z-1.8262 F3000
+G1 X20.200 Y1.500 Z-1.8260 F3000
+G1 X20.180 Y1.500 Z-1.8258 F3000
+G1 X20.160 Y1.500 Z-1.8257 F3000
+G1 X20.140 Y1.500 Z-1.8255 F3000
+G1 X20.120 Y1.500 Z-1.8254 F3000
+G1 X20.100 Y1.500 Z-1.8253 F3000
+G1 X20.080 Y1.500 Z-1.8252 F3000
+G1 X20.060 Y1.500 Z-1.8251 F3000
+G1 X20.040 Y1.500 Z-1.8251 F3000
+G1 X20.020 Y1.500 Z-1.8250 F3000
+G1 X20.000 Y1.500 Z-1.8250 F3000
+G1 X19.980 Y1.500 Z-1.8250 F3000
+G1 X19.960 Y1.500 Z-1.8251 F3000
+G1 X19.940 Y1.500 Z-1.8251 F3000
+G1 X19.920 Y1.500 Z-1.8252 F3000
+G1 X19.900 Y1.500 Z-1.8253 F3000
+G1 X19.880 Y1.500 Z-1.8254 F3000
+G1 X19.860 Y1.500 Z-1.8255 F3000
+G1 X19.840 Y1.500 Z-1.8257 F3000
+G1 X19.820 Y1.500 Z-1.8258 F3000
+G1 X19.800 Y1.500 Z-1.8260 F3000
+G1 X19.780 Y1.500 Z-1.8262 F3000
+G1 X19.760 Y1.500 Z-1.8265 F3000
+G1 X19.740 Y1.500 Z-1.8267 F3000
+G1 X19.720 Y1.500 Z-1.8270 F3000
+G1 X19.700 Y1.500 Z-1.8273 F3000
+G1 X19.680 Y1.500 Z-1.8276 F3000
+G1 X19.660 Y1.500 Z-1.8279 F3000
+G1 X19.640 Y1.500 Z-1.8283 F3000
+G1 X19.620 Y1.500 Z-1.8286 F3000
+G1 X19.600 Y1.500 Z-1.8290 F3000
+G1 X19.580 Y1.500 Z-1.8294 F3000
+G1 X19.560 Y1.500 Z-1.8299 F3000
+G1 X19.540 Y1.500 Z-1.8303 F3000
+G1 X19.520 Y1.500 Z-1.8308 F3000
+G1 X19.500 Y1.500 Z-1.8313 F3000
+G1 X19.480 Y1.500 Z-1.8318 F3000
+G1 X19.460 Y1.500 Z-1.8323 F3000
+G1 X19.440 Y1.500 Z-1.8329 F3000
+G1 X19.420 Y1.500 Z-1.8334 F3000
+G1 X19.400 Y1.500 Z-1.8340 F3000
+G1 X19.380 Y1.500 Z-1.8346 F3000
+G1 X19.360 Y1.500 Z-1.8353 F3000
+G1 X19.340 Y1.500 Z-1.8359 F3000
+G1 X19.320 Y1.500 Z-1.8366 F3000
+G1 X19.300 Y1.500 Z-1.8373 F3000
+G1 X19.280 Y1.500 Z-1.8380 F3000
+G1 X19.260 Y1.500 Z-1.8387 F3000
+G1 X19.240 Y1.500 Z-1.8395 F3000
+G1 X19.220 Y1.500 Z-1.8403 F3000
+G1 X19.200 Y1.500 Z-1.8410 F3000
+G1 X19.180 Y1.500 Z-1.8419 F3000
+G1 X19.160 Y1.500 Z-1.8427 F3000
+G1 X19.140 Y1.500 Z-1.8435 F3000
+G1 X19.120 Y1.500 Z-1.8444 F3000
+G1 X19.100 Y1.500 Z-1.8453 F3000
+G1 X19.080 Y1.500 Z-1.8462 F3000
+G1 X19.060 Y1.500 Z-1.8471 F3000
+G1 X19.040 Y1.500 Z-1.8481 F3000
+G1 X19.020 Y1.500 Z-1.8491 F3000
+G1 X19.000 Y1.500 Z-1.8501 F3000
+G1 X18.980 Y1.500 Z-1.8511 F3000
+G1 X18.960 Y1.500 Z-1.8521 F3000
+G1 X18.940 Y1.500 Z-1.8532 F3000
+G1 X18.920 Y1.500 Z-1.8542 F3000
+G1 X18.900 Y1.500 Z-1.8553 F3000
+G1 X18.880 Y1.500 Z-1.8564 F3000
+G1 X18.860 Y1.500 Z-1.8576 F3000
+G1 X18.840 Y1.500 Z-1.8587 F3000
+G1 X18.820 Y1.500 Z-1.8599 F3000
+G1 X18.800 Y1.500 Z-1.8611 F3000
+G1 X18.780 Y1.500 Z-1.8623 F3000
+G1 X18.760 Y1.500 Z-1.8635 F3000
+G1 X18.740 Y1.500 Z-1.8648 F3000
+G1 X18.720 Y1.500 Z-1.8661 F3000
+G1 X18.700 Y1.500 Z-1.8674 F3000
+G1 X18.680 Y1.500 Z-1.8687 F3000
+G1 X18.660 Y1.500 Z-1.8700 F3000
+G1 X18.640 Y1.500 Z-1.8714 F3000
+G1 X18.620 Y1.500 Z-1.8727 F3000
+G1 X18.600 Y1.500 Z-1.8741 F3000
+G1 X18.580 Y1.500 Z-1.8756 F3000
+G1 X18.560 Y1.500 Z-1.8770 F3000
+G1 X18.540 Y1.500 Z-1.8784 F3000
+G1 X18.520 Y1.500 Z-1.8799 F3000
+G1 X18.500 Y1.500 Z-1.8814 F3000
+G1 X18.480 Y1.500 Z-1.8829 F3000
+G1 X18.460 Y1.500 Z-1.8845 F3000
+G1 X18.440 Y1.500 Z-1.8860 F3000
+G1 X18.420 Y1.500 Z-1.8876 F3000
+G1 X18.400 Y1.500 Z-1.8892 F3000
+G1 X18.380 Y1.500 Z-1.8908 F3000
+G1 X18.360 Y1.500 Z-1.8925 F3000
+G1 X18.340 Y1.500 Z-1.8941 F3000
+G1 X18.320 Y1.500 Z-1.8958 F3000
+G1 X18.300 Y1.500 Z-1.8975 F3000
+G1 X18.280 Y1.500 Z-1.8992 F3000
+G1 X18.260 Y1.500 Z-1.9009 F3000
+G1 X18.240 Y1.500 Z-1.9027 F3000
+G1 X18.220 Y1.500 Z-1.9045 F3000
+G1 X18.200 Y1.500 Z-1.9063 F3000
+G1 X18.180 Y1.500 Z-1.9081 F3000
+G1 X18.160 Y1.500 Z-1.9099 F3000
+G1 X18.140 Y1.500 Z-1.9118 F3000
+G1 X18.120 Y1.500 Z-1.9137 F3000
+G1 X18.100 Y1.500 Z-1.9156 F3000
+G1 X18.080 Y1.500 Z-1.9175 F3000
+G1 X18.060 Y1.500 Z-1.9194 F3000
+G1 X18.040 Y1.500 Z-1.9214 F3000
+G1 X18.020 Y1.500 Z-1.9234 F3000
+G1 X18.000 Y1.500 Z-1.9254 F3000
+G1 X17.980 Y1.500 Z-1.9274 F3000
+G1 X17.960 Y1.500 Z-1.9295 F3000
+G1 X17.940 Y1.500 Z-1.9315 F3000
+G1 X17.920 Y1.500 Z-1.9336 F3000
+G1 X17.900 Y1.500 Z-1.9357 F3000
+G1 X17.880 Y1.500 Z-1.9378 F3000
+G1 X17.860 Y1.500 Z-1.9400 F3000
+G1 X17.840 Y1.500 Z-1.9421 F3000
+G1 X17.820 Y1.500 Z-1.9443 F3000
+G1 X17.800 Y1.500 Z-1.9465 F3000
+G1 X17.780 Y1.500 Z-1.9488 F3000
+G1 X17.760 Y1.500 Z-1.9510 F3000
+G1 X17.740 Y1.500 Z-1.9533 F3000
+G1 X17.720 Y1.500 Z-1.9556 F3000
+G1 X17.700 Y1.500 Z-1.9579 F3000
+G1 X17.680 Y1.500 Z-1.9602 F3000
+G1 X17.660 Y1.500 Z-1.9626 F3000
+G1 X17.640 Y1.500 Z-1.9649 F3000
+G1 X17.620 Y1.500 Z-1.9673 F3000
+G1 X17.600 Y1.500 Z-1.9697 F3000
+G1 X17.580 Y1.500 Z-1.9722 F3000
+G1 X17.560 Y1.500 Z-1.9746 F3000
+G1 X17.540 Y1.500 Z-1.9771 F3000
+G1 X17.520 Y1.500 Z-1.9796 F3000
+G1 X17.500 Y1.500 Z-1.9821 F3000
+G1 X17.480 Y1.500 Z-1.9846 F3000
+G1 X17.460 Y1.500 Z-1.9872 F3000
+G1 X17.440 Y1.500 Z-1.9897 F3000
+G1 X17.420 Y1.500 Z-1.9923 F3000
+G1 X17.400 Y1.500 Z-1.9950 F3000
+G1 X17.380 Y1.500 Z-1.9976 F3000
+G1 X17.360 Y1.500 Z-2.0002 F3000
+G1 X17.340 Y1.500 Z-2.0029 F3000
+G1 X17.320 Y1.500 Z-2.0056 F3000
+G1 X17.300 Y1.500 Z-2.0083 F3000
+G1 X17.280 Y1.500 Z-2.0111 F3000
+G1 X17.260 Y1.500 Z-2.0138 F3000
+G1 X17.240 Y1.500 Z-2.0166 F3000
+G1 X17.220 Y1.500 Z-2.0194 F3000
+G1 X17.200 Y1.500 Z-2.0222 F3000
+G1 X17.180 Y1.500 Z-2.0251 F3000
+G1 X17.160 Y1.500 Z-2.0279 F3000
+G1 X17.140 Y1.500 Z-2.0308 F3000
+G1 X17.120 Y1.500 Z-2.0337 F3000
+G1 X17.100 Y1.500 Z-2.0367 F3000
+G1 X17.080 Y1.500 Z-2.0396 F3000
+G1 X17.060 Y1.500 Z-2.0426 F3000
+G1 X17.040 Y1.500 Z-2.0455 F3000
+G1 X17.020 Y1.500 Z-2.0486 F3000
+G1 X17.000 Y1.500 Z-2.0516 F3000
+G1 X16.980 Y1.500 Z-2.0546 F3000
+G1 X16.960 Y1.500 Z-2.0577 F3000
+G1 X16.940 Y1.500 Z-2.0608 F3000
+G1 X16.920 Y1.500 Z-2.0639 F3000
+G1 X16.900 Y1.500 Z-2.0670 F3000
+G1 X16.880 Y1.500 Z-2.0702 F3000
+G1 X16.860 Y1.500 Z-2.0734 F3000
+G1 X16.840 Y1.500 Z-2.0766 F3000
+G1 X16.820 Y1.500 Z-2.0798 F3000
+G1 X16.800 Y1.500 Z-2.0830 F3000
+G1 X16.780 Y1.500 Z-2.0863 F3000
+G1 X16.760 Y1.500 Z-2.0895 F3000
+G1 X16.740 Y1.500 Z-2.0928 F3000
+G1 X16.720 Y1.500 Z-2.0962 F3000
+G1 X16.700 Y1.500 Z-2.0995 F3000
+G1 X16.680 Y1.500 Z-2.1029 F3000
+G1 X16.660 Y1.500 Z-2.1062 F3000
+G1 X16.640 Y1.500 Z-2.1096 F3000
+G1 X16.620 Y1.500 Z-2.1131 F3000
+G1 X16.600 Y1.500 Z-2.1165 F3000
+G1 X16.580 Y1.500 Z-2.1200 F3000
+G1 X16.560 Y1.500 Z-2.1235 F3000
+G1 X16.540 Y1.500 Z-2.1270 F3000
+G1 X16.520 Y1.500 Z-2.1305 F3000
+G1 X16.500 Y1.500 Z-2.1340 F3000
+G1 X16.480 Y1.500 Z-2.1376 F3000
+G1 X16.460 Y1.500 Z-2.1412 F3000
+G1 X16.440 Y1.500 Z-2.1448 F3000
+G1 X16.420 Y1.500 Z-2.1484 F3000
+G1 X16.400 Y1.500 Z-2.1521 F3000
+G1 X16.380 Y1.500 Z-2.1558 F3000
+G1 X16.360 Y1.500 Z-2.1595 F3000
+G1 X16.340 Y1.500 Z-2.1632 F3000
+G1 X16.320 Y1.500 Z-2.1669 F3000
+G1 X16.300 Y1.500 Z-2.1707 F3000
+G1 X16.280 Y1.500 Z-2.1745 F3000
+G1 X16.260 Y1.500 Z-2.1783 F3000
+G1 X16.240 Y1.500 Z-2.1821 F3000
+G1 X16.220 Y1.500 Z-2.1859 F3000
+G1 X16.200 Y1.500 Z-2.1898 F3000
+G1 X16.180 Y1.500 Z-2.1937 F3000
+G1 X16.160 Y1.500 Z-2.1976 F3000
+G1 X16.140 Y1.500 Z-2.2015 F3000
+G1 X16.120 Y1.500 Z-2.2055 F3000
+G1 X16.100 Y1.500 Z-2.2094 F3000
+G1 X16.080 Y1.500 Z-2.2134 F3000
+G1 X16.060 Y1.500 Z-2.2174 F3000
+G1 X16.040 Y1.500 Z-2.2215 F3000
+G1 X16.020 Y1.500 Z-2.2255 F3000
+G1 X16.000 Y1.500 Z-2.2296 F3000
+G1 X15.980 Y1.500 Z-2.2337 F3000
+G1 X15.960 Y1.500 Z-2.2378 F3000
+G1 X15.940 Y1.500 Z-2.2420 F3000
+G1 X15.920 Y1.500 Z-2.2461 F3000
+G1 X15.900 Y1.500 Z-2.2503 F3000
+G1 X15.880 Y1.500 Z-2.2545 F3000
+G1 X15.860 Y1.500 Z-2.2588 F3000
+G1 X15.840 Y1.500 Z-2.2630 F3000
+G1 X15.820 Y1.500 Z-2.2673 F3000
+G1 X15.800 Y1.500 Z-2.2716 F3000
+G1 X15.780 Y1.500 Z-2.2759 F3000
+G1 X15.760 Y1.500 Z-2.2802 F3000
+G1 X15.740 Y1.500 Z-2.2846 F3000
+G1 X15.720 Y1.500 Z-2.2889 F3000
+G1 X15.700 Y1.500 Z-2.2933 F3000
+G1 X15.680 Y1.500 Z-2.2978 F3000
+G1 X15.660 Y1.500 Z-2.3022 F3000
+G1 X15.640 Y1.500 Z-2.3067 F3000
+G1 X15.620 Y1.500 Z-2.3111 F3000
+G1 X15.600 Y1.500 Z-2.3156 F3000
+G1 X15.580 Y1.500 Z-2.3202 F3000
+G1 X15.560 Y1.500 Z-2.3247 F3000
+G1 X15.540 Y1.500 Z-2.3293 F3000
+G1 X15.520 Y1.500 Z-2.3339 F3000
+G1 X15.500 Y1.500 Z-2.3385 F3000
+G1 X15.480 Y1.500 Z-2.3431 F3000
+G1 X15.460 Y1.500 Z-2.3478 F3000
+G1 X15.440 Y1.500 Z-2.3525 F3000
+G1 X15.420 Y1.500 Z-2.3572 F3000
+G1 X15.400 Y1.500 Z-2.3619 F3000
+G1 X15.380 Y1.500 Z-2.3666 F3000
+G1 X15.360 Y1.500 Z-2.3714 F3000
+G1 X15.340 Y1.500 Z-2.3762 F3000
+G1 X15.320 Y1.500 Z-2.3810 F3000
+G1 X15.300 Y1.500 Z-2.3858 F3000
+G1 X15.280 Y1.500 Z-2.3907 F3000
+G1 X15.260 Y1.500 Z-2.3956 F3000
+G1 X15.240 Y1.500 Z-2.4005 F3000
+G1 X15.220 Y1.500 Z-2.4054 F3000
+G1 X15.200 Y1.500 Z-2.4103 F3000
+G1 X15.180 Y1.500 Z-2.4153 F3000
+G1 X15.160 Y1.500 Z-2.4203 F3000
+G1 X15.140 Y1.500 Z-2.4253 F3000
+G1 X15.120 Y1.500 Z-2.4303 F3000
+G1 X15.100 Y1.500 Z-2.4353 F3000
+G1 X15.080 Y1.500 Z-2.4404 F3000
+G1 X15.060 Y1.500 Z-2.4455 F3000
+G1 X15.040 Y1.500 Z-2.4506 F3000
+G1 X15.020 Y1.500 Z-2.4558 F3000
+G1 X15.000 Y1.500 Z-2.4609 F3000
+G1 X14.980 Y1.500 Z-2.4661 F3000
+G1 X14.960 Y1.500 Z-2.4713 F3000
+G1 X14.940 Y1.500 Z-2.4765 F3000
+G1 X14.920 Y1.500 Z-2.4818 F3000
+G1 X14.900 Y1.500 Z-2.4871 F3000
+G1 X14.880 Y1.500 Z-2.4923 F3000
+G1 X14.860 Y1.500 Z-2.4977 F3000
+G1 X14.840 Y1.500 Z-2.5030 F3000
+G1 X14.820 Y1.500 Z-2.5084 F3000
+G1 X14.800 Y1.500 Z-2.5137 F3000
+G1 X14.780 Y1.500 Z-2.5191 F3000
+G1 X14.760 Y1.500 Z-2.5246 F3000
+G1 X14.740 Y1.500 Z-2.5300 F3000
+G1 X14.720 Y1.500 Z-2.5355 F3000
+G1 X14.700 Y1.500 Z-2.5410 F3000
+G1 X14.680 Y1.500 Z-2.5465 F3000
+G1 X14.660 Y1.500 Z-2.5520 F3000
+G1 X14.640 Y1.500 Z-2.5576 F3000
+G1 X14.620 Y1.500 Z-2.5632 F3000
+G1 X14.600 Y1.500 Z-2.5688 F3000
+G1 X14.580 Y1.500 Z-2.5744 F3000
+G1 X14.560 Y1.500 Z-2.5801 F3000
+G1 X14.540 Y1.500 Z-2.5857 F3000
+G1 X14.520 Y1.500 Z-2.5914 F3000
+G1 X14.500 Y1.500 Z-2.5971 F3000
+G1 X14.480 Y1.500 Z-2.6029 F3000
+G1 X14.460 Y1.500 Z-2.6086 F3000
+G1 X14.440 Y1.500 Z-2.6144 F3000
+G1 X14.420 Y1.500 Z-2.6202 F3000
+G1 X14.400 Y1.500 Z-2.6261 F3000
+G1 X14.380 Y1.500 Z-2.6319 F3000
+G1 X14.360 Y1.500 Z-2.6378 F3000
+G1 X14.340 Y1.500 Z-2.6437 F3000
+G1 X14.320 Y1.500 Z-2.6496 F3000
+G1 X14.300 Y1.500 Z-2.6555 F3000
+G1 X14.280 Y1.500 Z-2.6615 F3000
+G1 X14.260 Y1.500 Z-2.6675 F3000
+G1 X14.240 Y1.500 Z-2.6735 F3000
+G1 X14.220 Y1.500 Z-2.6796 F3000
+G1 X14.200 Y1.500 Z-2.6856 F3000
+G1 X14.180 Y1.500 Z-2.6917 F3000
+G1 X14.160 Y1.500 Z-2.6978 F3000
+G1 X14.140 Y1.500 Z-2.7039 F3000
+G1 X14.120 Y1.500 Z-2.7101 F3000
+G1 X14.100 Y1.500 Z-2.7162 F3000
+G1 X14.080 Y1.500 Z-2.7224 F3000
+G1 X14.060 Y1.500 Z-2.7286 F3000
+G1 X14.040 Y1.500 Z-2.7349 F3000
+G1 X14.020 Y1.500 Z-2.7412 F3000
+G1 X14.000 Y1.500 Z-2.7474 F3000
+G1 X13.980 Y1.500 Z-2.7538 F3000
+G1 X13.960 Y1.500 Z-2.7601 F3000
+G1 X13.940 Y1.500 Z-2.7664 F3000
+G1 X13.920 Y1.500 Z-2.7728 F3000
+G1 X13.900 Y1.500 Z-2.7792 F3000
+G1 X13.880 Y1.500 Z-2.7856 F3000
+G1 X13.860 Y1.500 Z-2.7921 F3000
+G1 X13.840 Y1.500 Z-2.7986 F3000
+G1 X13.820 Y1.500 Z-2.8051 F3000
+G1 X13.800 Y1.500 Z-2.8116 F3000
+G1 X13.780 Y1.500 Z-2.8181 F3000
+G1 X13.760 Y1.500 Z-2.8247 F3000
+G1 X13.740 Y1.500 Z-2.8313 F3000
+G1 X13.720 Y1.500 Z-2.8379 F3000
+G1 X13.700 Y1.500 Z-2.8445 F3000
+G1 X13.680 Y1.500 Z-2.8512 F3000
+G1 X13.660 Y1.500 Z-2.8579 F3000
+G1 X13.640 Y1.500 Z-2.8646 F3000
+G1 X13.620 Y1.500 Z-2.8713 F3000
+G1 X13.600 Y1.500 Z-2.8781 F3000
+G1 X13.580 Y1.500 Z-2.8848 F3000
+G1 X13.560 Y1.500 Z-2.8916 F3000
+G1 X13.540 Y1.500 Z-2.8985 F3000
+G1 X13.520 Y1.500 Z-2.9053 F3000
+G1 X13.500 Y1.500 Z-2.9122 F3000
+G1 X13.480 Y1.500 Z-2.9191 F3000
+G1 X13.460 Y1.500 Z-2.9260 F3000
+G1 X13.440 Y1.500 Z-2.9329 F3000
+G1 X13.420 Y1.500 Z-2.9399 F3000
+G1 X13.400 Y1.500 Z-2.9469 F3000
+G1 X13.380 Y1.500 Z-2.9539 F3000
+G1 X13.360 Y1.500 Z-2.9609 F3000
+G1 X13.340 Y1.500 Z-2.9680 F3000
+G1 X13.320 Y1.500 Z-2.9751 F3000
+G1 X13.300 Y1.500 Z-2.9822 F3000
+G1 X13.280 Y1.500 Z-2.9893 F3000
+G1 X13.260 Y1.500 Z-2.9965 F3000
+G1 X13.240 Y1.500 Z-3.0037 F3000
+G1 X13.220 Y1.500 Z-3.0109 F3000
+G1 X13.200 Y1.500 Z-3.0181 F3000
+G1 X13.180 Y1.500 Z-3.0253 F3000
+G1 X13.160 Y1.500 Z-3.0326 F3000
+G1 X13.140 Y1.500 Z-3.0399 F3000
+G1 X13.120 Y1.500 Z-3.0473 F3000
+G1 X13.100 Y1.500 Z-3.0546 F3000
+G1 X13.080 Y1.500 Z-3.0620 F3000
+G1 X13.060 Y1.500 Z-3.0694 F3000
+G1 X13.040 Y1.500 Z-3.0768 F3000
+G1 X13.020 Y1.500 Z-3.0842 F3000
+G1 X13.000 Y1.500 Z-3.0917 F3000
+G1 X12.980 Y1.500 Z-3.0992 F3000
+G1 X12.960 Y1.500 Z-3.1067 F3000
+G1 X12.940 Y1.500 Z-3.1143 F3000
+G1 X12.920 Y1.500 Z-3.1218 F3000
+G1 X12.900 Y1.500 Z-3.1294 F3000
+G1 X12.880 Y1.500 Z-3.1371 F3000
+G1 X12.860 Y1.500 Z-3.1447 F3000
+G1 X12.840 Y1.500 Z-3.1524 F3000
+G1 X12.820 Y1.500 Z-3.1601 F3000
+G1 X12.800 Y1.500 Z-3.1678 F3000
+G1 X12.780 Y1.500 Z-3.1755 F3000
+G1 X12.760 Y1.500 Z-3.1833 F3000
+G1 X12.740 Y1.500 Z-3.1911 F3000
+G1 X12.720 Y1.500 Z-3.1989 F3000
+G1 X12.700 Y1.500 Z-3.2067 F3000
+G1 X12.680 Y1.500 Z-3.2146 F3000
+G1 X12.660 Y1.500 Z-3.2225 F3000
+G1 X12.640 Y1.500 Z-3.2304 F3000
+G1 X12.620 Y1.500 Z-3.2383 F3000
+G1 X12.600 Y1.500 Z-3.2463 F3000
+G1 X12.580 Y1.500 Z-3.2543 F3000
+G1 X12.560 Y1.500 Z-3.2623 F3000
+G1 X12.540 Y1.500 Z-3.2703 F3000
+G1 X12.520 Y1.500 Z-3.2784 F3000
+G1 X12.500 Y1.500 Z-3.2865 F3000
+G1 X12.480 Y1.500 Z-3.2946 F3000
+G1 X12.460 Y1.500 Z-3.3027 F3000
+G1 X12.440 Y1.500 Z-3.3109 F3000
+G1 X12.420 Y1.500 Z-3.3191 F3000
+G1 X12.400 Y1.500 Z-3.3273 F3000
+G1 X12.380 Y1.500 Z-3.3356 F3000
+G1 X12.360 Y1.500 Z-3.3438 F3000
+G1 X12.340 Y1.500 Z-3.3521 F3000
+G1 X12.320 Y1.500 Z-3.3604 F3000
+G1 X12.300 Y1.500 Z-3.3688 F3000
+G1 X12.280 Y1.500 Z-3.3771 F3000
+G1 X12.260 Y1.500 Z-3.3855 F3000
+G1 X12.240 Y1.500 Z-3.3940 F3000
+G1 X12.220 Y1.500 Z-3.4024 F3000
+G1 X12.200 Y1.500 Z-3.4109 F3000
+G1 X12.180 Y1.500 Z-3.4194 F3000
+G1 X12.160 Y1.500 Z-3.4279 F3000
+G1 X12.140 Y1.500 Z-3.4364 F3000
+G1 X12.120 Y1.500 Z-3.4450 F3000
+G1 X12.100 Y1.500 Z-3.4536 F3000
+G1 X12.080 Y1.500 Z-3.4622 F3000
+G1 X12.060 Y1.500 Z-3.4709 F3000
+G1 X12.040 Y1.500 Z-3.4796 F3000
+G1 X12.020 Y1.500 Z-3.4883 F3000
+G1 X12.000 Y1.500 Z-3.4970 F3000
+G1 X11.980 Y1.500 Z-3.5057 F3000
+G1 X11.960 Y1.500 Z-3.5145 F3000
+G1 X11.940 Y1.500 Z-3.5233 F3000
+G1 X11.920 Y1.500 Z-3.5322 F3000
+G1 X11.900 Y1.500 Z-3.5410 F3000
+G1 X11.880 Y1.500 Z-3.5499 F3000
+G1 X11.860 Y1.500 Z-3.5588 F3000
+G1 X11.840 Y1.500 Z-3.5678 F3000
+G1 X11.820 Y1.500 Z-3.5767 F3000
+G1 X11.800 Y1.500 Z-3.5857 F3000
+G1 X11.780 Y1.500 Z-3.5947 F3000
+G1 X11.760 Y1.500 Z-3.6038 F3000
+G1 X11.740 Y1.500 Z-3.6129 F3000
+G1 X11.720 Y1.500 Z-3.6219 F3000
+G1 X11.700 Y1.500 Z-3.6311 F3000
+G1 X11.680 Y1.500 Z-3.6402 F3000
+G1 X11.660 Y1.500 Z-3.6494 F3000
+G1 X11.640 Y1.500 Z-3.6586 F3000
+G1 X11.620 Y1.500 Z-3.6678 F3000
+G1 X11.600 Y1.500 Z-3.6771 F3000
+G1 X11.580 Y1.500 Z-3.6864 F3000
+G1 X11.560 Y1.500 Z-3.6957 F3000
+G1 X11.540 Y1.500 Z-3.7050 F3000
+G1 X11.520 Y1.500 Z-3.7144 F3000
+G1 X11.500 Y1.500 Z-3.7238 F3000
+G1 X11.480 Y1.500 Z-3.7332 F3000
+G1 X11.460 Y1.500 Z-3.7426 F3000
+G1 X11.440 Y1.500 Z-3.7521 F3000
+G1 X11.420 Y1.500 Z-3.7616 F3000
+G1 X11.400 Y1.500 Z-3.7711 F3000
+G1 X11.380 Y1.500 Z-3.7807 F3000
+G1 X11.360 Y1.500 Z-3.7903 F3000
+G1 X11.340 Y1.500 Z-3.7999 F3000
+G1 X11.320 Y1.500 Z-3.8095 F3000
+G1 X11.300 Y1.500 Z-3.8192 F3000
+G1 X11.280 Y1.500 Z-3.8289 F3000
+G1 X11.260 Y1.500 Z-3.8386 F3000
+G1 X11.240 Y1.500 Z-3.8483 F3000
+G1 X11.220 Y1.500 Z-3.8581 F3000
+G1 X11.200 Y1.500 Z-3.8679 F3000
+G1 X11.180 Y1.500 Z-3.8777 F3000
+G1 X11.160 Y1.500 Z-3.8876 F3000
+G1 X11.140 Y1.500 Z-3.8975 F3000
+G1 X11.120 Y1.500 Z-3.9074 F3000
+G1 X11.100 Y1.500 Z-3.9173 F3000
+G1 X11.080 Y1.500 Z-3.9273 F3000
+G1 X11.060 Y1.500 Z-3.9373 F3000
+G1 X11.040 Y1.500 Z-3.9473 F3000
+G1 X11.020 Y1.500 Z-3.9574 F3000
+G1 X11.000 Y1.500 Z-3.9674 F3000
+G1 X10.980 Y1.500 Z-3.9776 F3000
+G1 X10.960 Y1.500 Z-3.9877 F3000
+G1 X10.940 Y1.500 Z-3.9979 F3000
+G1 X10.920 Y1.500 Z-4.0080 F3000
+G1 X10.900 Y1.500 Z-4.0183 F3000
+G1 X10.880 Y1.500 Z-4.0285 F3000
+G1 X10.860 Y1.500 Z-4.0388 F3000
+G1 X10.840 Y1.500 Z-4.0491 F3000
+G1 X10.820 Y1.500 Z-4.0594 F3000
+G1 X10.800 Y1.500 Z-4.0698 F3000
+G1 X10.780 Y1.500 Z-4.0802 F3000
+G1 X10.760 Y1.500 Z-4.0906 F3000
+G1 X10.740 Y1.500 Z-4.1011 F3000
+G1 X10.720 Y1.500 Z-4.1115 F3000
+G1 X10.700 Y1.500 Z-4.1220 F3000
+G1 X10.680 Y1.500 Z-4.1326 F3000
+G1 X10.660 Y1.500 Z-4.1431 F3000
+G1 X10.640 Y1.500 Z-4.1537 F3000
+G1 X10.620 Y1.500 Z-4.1644 F3000
+G1 X10.600 Y1.500 Z-4.1750 F3000
+G1 X10.580 Y1.500 Z-4.1857 F3000
+G1 X10.560 Y1.500 Z-4.1964 F3000
+G1 X10.540 Y1.500 Z-4.2071 F3000
+G1 X10.520 Y1.500 Z-4.2179 F3000
+G1 X10.500 Y1.500 Z-4.2287 F3000
+G1 X10.480 Y1.500 Z-4.2395 F3000
+G1 X10.460 Y1.500 Z-4.2504 F3000
+G1 X10.440 Y1.500 Z-4.2613 F3000
+G1 X10.420 Y1.500 Z-4.2722 F3000
+G1 X10.400 Y1.500 Z-4.2832 F3000
+G1 X10.380 Y1.500 Z-4.2941 F3000
+G1 X10.360 Y1.500 Z-4.3051 F3000
+G1 X10.340 Y1.500 Z-4.3162 F3000
+G1 X10.320 Y1.500 Z-4.3272 F3000
+G1 X10.300 Y1.500 Z-4.3383 F3000
+G1 X10.280 Y1.500 Z-4.3495 F3000
+G1 X10.260 Y1.500 Z-4.3606 F3000
+G1 X10.240 Y1.500 Z-4.3718 F3000
+G1 X10.220 Y1.500 Z-4.3830 F3000
+G1 X10.200 Y1.500 Z-4.3943 F3000
+G1 X10.180 Y1.500 Z-4.4055 F3000
+G1 X10.160 Y1.500 Z-4.4168 F3000
+G1 X10.140 Y1.500 Z-4.4282 F3000
+G1 X10.120 Y1.500 Z-4.4395 F3000
+G1 X10.100 Y1.500 Z-4.4509 F3000
+G1 X10.080 Y1.500 Z-4.4624 F3000
+G1 X10.060 Y1.500 Z-4.4738 F3000
+G1 X10.040 Y1.500 Z-4.4853 F3000
+G1 X10.020 Y1.500 Z-4.4968 F3000
+G1 X10.000 Y1.500 Z-4.5084 F3000
+G1 X9.980 Y1.500 Z-4.5200 F3000
+G1 X9.960 Y1.500 Z-4.5316 F3000
+G1 X9.940 Y1.500 Z-4.5432 F3000
+G1 X9.920 Y1.500 Z-4.5549 F3000
+G1 X9.900 Y1.500 Z-4.5666 F3000
+G1 X9.880 Y1.500 Z-4.5783 F3000
+G1 X9.860 Y1.500 Z-4.5901 F3000
+G1 X9.840 Y1.500 Z-4.6019 F3000
+G1 X9.820 Y1.500 Z-4.6137 F3000
+G1 X9.800 Y1.500 Z-4.6256 F3000
+G1 X9.780 Y1.500 Z-4.6375 F3000
+G1 X9.760 Y1.500 Z-4.6494 F3000
+G1 X9.740 Y1.500 Z-4.6614 F3000
+G1 X9.720 Y1.500 Z-4.6734 F3000
+G1 X9.700 Y1.500 Z-4.6854 F3000
+G1 X9.680 Y1.500 Z-4.6974 F3000
+G1 X9.660 Y1.500 Z-4.7095 F3000
+G1 X9.640 Y1.500 Z-4.7216 F3000
+G1 X9.620 Y1.500 Z-4.7338 F3000
+G1 X9.600 Y1.500 Z-4.7460 F3000
+G1 X9.580 Y1.500 Z-4.7582 F3000
+G1 X9.560 Y1.500 Z-4.7704 F3000
+G1 X9.540 Y1.500 Z-4.7827 F3000
+G1 X9.520 Y1.500 Z-4.7950 F3000
+G1 X9.500 Y1.500 Z-4.8074 F3000
+G1 X9.480 Y1.500 Z-4.8197 F3000
+G1 X9.460 Y1.500 Z-4.8321 F3000
+G1 X9.440 Y1.500 Z-4.8446 F3000
+G1 X9.420 Y1.500 Z-4.8570 F3000
+G1 X9.400 Y1.500 Z-4.8696 F3000
+G1 X9.380 Y1.500 Z-4.8821 F3000
+G1 X9.360 Y1.500 Z-4.8947 F3000
+G1 X9.340 Y1.500 Z-4.9073 F3000
+G1 X9.320 Y1.500 Z-4.9199 F3000
+G1 X9.300 Y1.500 Z-4.9326 F3000
+G1 X9.280 Y1.500 Z-4.9453 F3000
+G1 X9.260 Y1.500 Z-4.9580 F3000
+G1 X9.240 Y1.500 Z-4.9708 F3000
+G1 X9.220 Y1.500 Z-4.9836 F3000
+G1 X9.200 Y1.500 Z-4.9964 F3000
+G1 X9.180 Y1.500 Z-5.0093 F3000
+G1 X9.160 Y1.500 Z-5.0222 F3000
+G1 X9.140 Y1.500 Z-5.0351 F3000
+G1 X9.120 Y1.500 Z-5.0481 F3000
+G1 X9.100 Y1.500 Z-5.0611 F3000
+G1 X9.080 Y1.500 Z-5.0742 F3000
+G1 X9.060 Y1.500 Z-5.0872 F3000
+G1 X9.040 Y1.500 Z-5.1003 F3000
+G1 X9.020 Y1.500 Z-5.1135 F3000
+G1 X9.000 Y1.500 Z-5.1267 F3000
+G1 X8.980 Y1.500 Z-5.1399 F3000
+G1 X8.960 Y1.500 Z-5.1531 F3000
+G1 X8.940 Y1.500 Z-5.1664 F3000
+G1 X8.920 Y1.500 Z-5.1797 F3000
+G1 X8.900 Y1.500 Z-5.1931 F3000
+G1 X8.880 Y1.500 Z-5.2065 F3000
+G1 X8.860 Y1.500 Z-5.2199 F3000
+G1 X8.840 Y1.500 Z-5.2333 F3000
+G1 X8.820 Y1.500 Z-5.2468 F3000
+G1 X8.800 Y1.500 Z-5.2604 F3000
+G1 X8.780 Y1.500 Z-5.2739 F3000
+G1 X8.760 Y1.500 Z-5.2875 F3000
+G1 X8.740 Y1.500 Z-5.3011 F3000
+G1 X8.720 Y1.500 Z-5.3148 F3000
+G1 X8.700 Y1.500 Z-5.3285 F3000
+G1 X8.680 Y1.500 Z-5.3422 F3000
+G1 X8.660 Y1.500 Z-5.3560 F3000
+G1 X8.640 Y1.500 Z-5.3698 F3000
+G1 X8.620 Y1.500 Z-5.3837 F3000
+G1 X8.600 Y1.500 Z-5.3976 F3000
+G1 X8.580 Y1.500 Z-5.4115 F3000
+G1 X8.560 Y1.500 Z-5.4254 F3000
+G1 X8.540 Y1.500 Z-5.4394 F3000
+G1 X8.520 Y1.500 Z-5.4535 F3000
+G1 X8.500 Y1.500 Z-5.4675 F3000
+G1 X8.480 Y1.500 Z-5.4816 F3000
+G1 X8.460 Y1.500 Z-5.4958 F3000
+G1 X8.440 Y1.500 Z-5.5099 F3000
+G1 X8.420 Y1.500 Z-5.5241 F3000
+G1 X8.400 Y1.500 Z-5.5384 F3000
+G1 X8.380 Y1.500 Z-5.5527 F3000
+G1 X8.360 Y1.500 Z-5.5670 F3000
+G1 X8.340 Y1.500 Z-5.5814 F3000
+G1 X8.320 Y1.500 Z-5.5958 F3000
+G1 X8.300 Y1.500 Z-5.6102 F3000
+G1 X8.280 Y1.500 Z-5.6247 F3000
+G1 X8.260 Y1.500 Z-5.6392 F3000
+G1 X8.240 Y1.500 Z-5.6537 F3000
+G1 X8.220 Y1.500 Z-5.6683 F3000
+G1 X8.200 Y1.500 Z-5.6829 F3000
+G1 X8.180 Y1.500 Z-5.6976 F3000
+G1 X8.160 Y1.500 Z-5.7123 F3000
+G1 X8.140 Y1.500 Z-5.7270 F3000
+G1 X8.120 Y1.500 Z-5.7418 F3000
+G1 X8.100 Y1.500 Z-5.7566 F3000
+G1 X8.080 Y1.500 Z-5.7715 F3000
+G1 X8.060 Y1.500 Z-5.7864 F3000
+G1 X8.040 Y1.500 Z-5.8013 F3000
+G1 X8.020 Y1.500 Z-5.8163 F3000
+G1 X8.000 Y1.500 Z-5.8313 F3000
+G1 X7.980 Y1.500 Z-5.8463 F3000
+G1 X7.960 Y1.500 Z-5.8614 F3000
+G1 X7.940 Y1.500 Z-5.8765 F3000
+G1 X7.920 Y1.500 Z-5.8917 F3000
+G1 X7.900 Y1.500 Z-5.9069 F3000
+G1 X7.880 Y1.500 Z-5.9222 F3000
+G1 X7.860 Y1.500 Z-5.9375 F3000
+G1 X7.840 Y1.500 Z-5.9528 F3000
+G1 X7.820 Y1.500 Z-5.9681 F3000
+G1 X7.800 Y1.500 Z-5.9836 F3000
+G1 X7.780 Y1.500 Z-5.9990 F3000
+G1 X7.760 Y1.500 Z-6.0145 F3000
+G1 X7.740 Y1.500 Z-6.0300 F3000
+G1 X7.720 Y1.500 Z-6.0456 F3000
+G1 X7.700 Y1.500 Z-6.0612 F3000
+G1 X7.680 Y1.500 Z-6.0768 F3000
+G1 X7.660 Y1.500 Z-6.0925 F3000
+G1 X7.640 Y1.500 Z-6.1083 F3000
+G1 X7.620 Y1.500 Z-6.1240 F3000
+G1 X7.600 Y1.500 Z-6.1399 F3000
+G1 X7.580 Y1.500 Z-6.1557 F3000
+G1 X7.560 Y1.500 Z-6.1716 F3000
+G1 X7.540 Y1.500 Z-6.1876 F3000
+G1 X7.520 Y1.500 Z-6.2035 F3000
+G1 X7.500 Y1.500 Z-6.2196 F3000
+G1 X7.480 Y1.500 Z-6.2356 F3000
+G1 X7.460 Y1.500 Z-6.2517 F3000
+G1 X7.440 Y1.500 Z-6.2679 F3000
+G1 X7.420 Y1.500 Z-6.2841 F3000
+G1 X7.400 Y1.500 Z-6.3003 F3000
+G1 X7.380 Y1.500 Z-6.3166 F3000
+G1 X7.360 Y1.500 Z-6.3329 F3000
+G1 X7.340 Y1.500 Z-6.3493 F3000
+G1 X7.320 Y1.500 Z-6.3657 F3000
+G1 X7.300 Y1.500 Z-6.3822 F3000
+G1 X7.280 Y1.500 Z-6.3986 F3000
+G1 X7.260 Y1.500 Z-6.4152 F3000
+G1 X7.240 Y1.500 Z-6.4318 F3000
+G1 X7.220 Y1.500 Z-6.4484 F3000
+G1 X7.200 Y1.500 Z-6.4651 F3000
+G1 X7.180 Y1.500 Z-6.4818 F3000
+G1 X7.160 Y1.500 Z-6.4985 F3000
+G1 X7.140 Y1.500 Z-6.5154 F3000
+G1 X7.120 Y1.500 Z-6.5322 F3000
+G1 X7.100 Y1.500 Z-6.5491 F3000
+G1 X7.080 Y1.500 Z-6.5660 F3000
+G1 X7.060 Y1.500 Z-6.5830 F3000
+G1 X7.040 Y1.500 Z-6.6001 F3000
+G1 X7.020 Y1.500 Z-6.6171 F3000
+G1 X7.000 Y1.500 Z-6.6342 F3000
+G1 X6.980 Y1.500 Z-6.6514 F3000
+G1 X6.960 Y1.500 Z-6.6686 F3000
+G1 X6.940 Y1.500 Z-6.6859 F3000
+G1 X6.920 Y1.500 Z-6.7032 F3000
+G1 X6.900 Y1.500 Z-6.7205 F3000
+G1 X6.880 Y1.500 Z-6.7379 F3000
+G1 X6.860 Y1.500 Z-6.7554 F3000
+G1 X6.840 Y1.500 Z-6.7729 F3000
+G1 X6.820 Y1.500 Z-6.7904 F3000
+G1 X6.800 Y1.500 Z-6.8080 F3000
+G1 X6.780 Y1.500 Z-6.8256 F3000
+G1 X6.760 Y1.500 Z-6.8433 F3000
+G1 X6.740 Y1.500 Z-6.8610 F3000
+G1 X6.720 Y1.500 Z-6.8788 F3000
+G1 X6.700 Y1.500 Z-6.8966 F3000
+G1 X6.680 Y1.500 Z-6.9145 F3000
+G1 X6.660 Y1.500 Z-6.9324 F3000
+G1 X6.640 Y1.500 Z-6.9504 F3000
+G1 X6.620 Y1.500 Z-6.9684 F3000
+G1 X6.600 Y1.500 Z-6.9865 F3000
+G1 X6.580 Y1.500 Z-7.0046 F3000
+G1 X6.560 Y1.500 Z-7.0228 F3000
+G1 X6.540 Y1.500 Z-7.0410 F3000
+G1 X6.520 Y1.500 Z-7.0593 F3000
+G1 X6.500 Y1.500 Z-7.0776 F3000
+G1 X6.480 Y1.500 Z-7.0959 F3000
+G1 X6.460 Y1.500 Z-7.1143 F3000
+G1 X6.440 Y1.500 Z-7.1328 F3000
+G1 X6.420 Y1.500 Z-7.1513 F3000
+G1 X6.400 Y1.500 Z-7.1699 F3000
+G1 X6.380 Y1.500 Z-7.1885 F3000
+G1 X6.360 Y1.500 Z-7.2072 F3000
+G1 X6.340 Y1.500 Z-7.2259 F3000
+G1 X6.320 Y1.500 Z-7.2447 F3000
+G1 X6.300 Y1.500 Z-7.2635 F3000
+G1 X6.280 Y1.500 Z-7.2824 F3000
+G1 X6.260 Y1.500 Z-7.3013 F3000
+G1 X6.240 Y1.500 Z-7.3203 F3000
+G1 X6.220 Y1.500 Z-7.3393 F3000
+G1 X6.200 Y1.500 Z-7.3584 F3000
+G1 X6.180 Y1.500 Z-7.3775 F3000
+G1 X6.160 Y1.500 Z-7.3967 F3000
+G1 X6.140 Y1.500 Z-7.4160 F3000
+G1 X6.120 Y1.500 Z-7.4353 F3000
+G1 X6.100 Y1.500 Z-7.4546 F3000
+G1 X6.080 Y1.500 Z-7.4740 F3000
+G1 X6.060 Y1.500 Z-7.4935 F3000
+G1 X6.040 Y1.500 Z-7.5130 F3000
+G1 X6.020 Y1.500 Z-7.5326 F3000
+G1 X6.000 Y1.500 Z-7.5522 F3000
+G1 X5.980 Y1.500 Z-7.5719 F3000
+G1 X5.960 Y1.500 Z-7.5916 F3000
+G1 X5.940 Y1.500 Z-7.6114 F3000
+G1 X5.920 Y1.500 Z-7.6312 F3000
+G1 X5.900 Y1.500 Z-7.6511 F3000
+G1 X5.880 Y1.500 Z-7.6711 F3000
+G1 X5.860 Y1.500 Z-7.6911 F3000
+G1 X5.840 Y1.500 Z-7.7112 F3000
+G1 X5.820 Y1.500 Z-7.7313 F3000
+G1 X5.800 Y1.500 Z-7.7515 F3000
+G1 X5.780 Y1.500 Z-7.7718 F3000
+G1 X5.760 Y1.500 Z-7.7921 F3000
+G1 X5.740 Y1.500 Z-7.8124 F3000
+G1 X5.720 Y1.500 Z-7.8328 F3000
+G1 X5.700 Y1.500 Z-7.8533 F3000
+G1 X5.680 Y1.500 Z-7.8739 F3000
+G1 X5.660 Y1.500 Z-7.8944 F3000
+G1 X5.640 Y1.500 Z-7.9151 F3000
+G1 X5.620 Y1.500 Z-7.9358 F3000
+G1 X5.600 Y1.500 Z-7.9566 F3000
+G1 X5.580 Y1.500 Z-7.9774 F3000
+G1 X5.560 Y1.500 Z-7.9983 F3000
+G1 X5.540 Y1.500 Z-8.0193 F3000
+G1 X5.520 Y1.500 Z-8.0403 F3000
+G1 X5.500 Y1.500 Z-8.0614 F3000
+G1 X5.480 Y1.500 Z-8.0825 F3000
+G1 X5.460 Y1.500 Z-8.1037 F3000
+G1 X5.440 Y1.500 Z-8.1250 F3000
+G1 X5.420 Y1.500 Z-8.1463 F3000
+G1 X5.400 Y1.500 Z-8.1677 F3000
+G1 X5.380 Y1.500 Z-8.1891 F3000
+G1 X5.360 Y1.500 Z-8.2107 F3000
+G1 X5.340 Y1.500 Z-8.2322 F3000
+G1 X5.320 Y1.500 Z-8.2539 F3000
+G1 X5.300 Y1.500 Z-8.2756 F3000
+G1 X5.280 Y1.500 Z-8.2973 F3000
+G1 X5.260 Y1.500 Z-8.3192 F3000
+G1 X5.240 Y1.500 Z-8.3411 F3000
+G1 X5.220 Y1.500 Z-8.3631 F3000
+G1 X5.200 Y1.500 Z-8.3851 F3000
+G1 X5.180 Y1.500 Z-8.4072 F3000
+G1 X5.160 Y1.500 Z-8.4293 F3000
+G1 X5.140 Y1.500 Z-8.4516 F3000
+G1 X5.120 Y1.500 Z-8.4739 F3000
+G1 X5.100 Y1.500 Z-8.4962 F3000
+G1 X5.080 Y1.500 Z-8.5187 F3000
+G1 X5.060 Y1.500 Z-8.5412 F3000
+G1 X5.040 Y1.500 Z-8.5637 F3000
+G1 X5.020 Y1.500 Z-8.5864 F3000
+G1 X5.000 Y1.500 Z-8.6091 F3000
+G1 X4.980 Y1.500 Z-8.6319 F3000
+G1 X4.960 Y1.500 Z-8.6547 F3000
+G1 X4.940 Y1.500 Z-8.6776 F3000
+G1 X4.920 Y1.500 Z-8.7006 F3000
+G1 X4.900 Y1.500 Z-8.7237 F3000
+G1 X4.880 Y1.500 Z-8.7468 F3000
+G1 X4.860 Y1.500 Z-8.7700 F3000
+G1 X4.840 Y1.500 Z-8.7933 F3000
+G1 X4.820 Y1.500 Z-8.8166 F3000
+G1 X4.800 Y1.500 Z-8.8401 F3000
+G1 X4.780 Y1.500 Z-8.8636 F3000
+G1 X4.760 Y1.500 Z-8.8871 F3000
+G1 X4.740 Y1.500 Z-8.9108 F3000
+G1 X4.720 Y1.500 Z-8.9345 F3000
+G1 X4.700 Y1.500 Z-8.9583 F3000
+G1 X4.680 Y1.500 Z-8.9821 F3000
+G1 X4.660 Y1.500 Z-9.0061 F3000
+G1 X4.640 Y1.500 Z-9.0301 F3000
+G1 X4.620 Y1.500 Z-9.0542 F3000
+G1 X4.600 Y1.500 Z-9.0784 F3000
+G1 X4.580 Y1.500 Z-9.1026 F3000
+G1 X4.560 Y1.500 Z-9.1269 F3000
+G1 X4.540 Y1.500 Z-9.1513 F3000
+G1 X4.520 Y1.500 Z-9.1758 F3000
+G1 X4.500 Y1.500 Z-9.2004 F3000
+G1 X4.480 Y1.500 Z-9.2250 F3000
+G1 X4.460 Y1.500 Z-9.2498 F3000
+G1 X4.440 Y1.500 Z-9.2746 F3000
+G1 X4.420 Y1.500 Z-9.2995 F3000
+G1 X4.400 Y1.500 Z-9.3244 F3000
+G1 X4.380 Y1.500 Z-9.3495 F3000
+G1 X4.360 Y1.500 Z-9.3746 F3000
+G1 X4.340 Y1.500 Z-9.3998 F3000
+G1 X4.320 Y1.500 Z-9.4251 F3000
+G1 X4.300 Y1.500 Z-9.4505 F3000
+G1 X4.280 Y1.500 Z-9.4760 F3000
+G1 X4.260 Y1.500 Z-9.5015 F3000
+G1 X4.240 Y1.500 Z-9.5272 F3000
+G1 X4.220 Y1.500 Z-9.5529 F3000
+G1 X4.200 Y1.500 Z-9.5787 F3000
+G1 X4.180 Y1.500 Z-9.6046 F3000
+G1 X4.160 Y1.500 Z-9.6306 F3000
+G1 X4.140 Y1.500 Z-9.6567 F3000
+G1 X4.120 Y1.500 Z-9.6828 F3000
+G1 X4.100 Y1.500 Z-9.7091 F3000
+G1 X4.080 Y1.500 Z-9.7354 F3000
+G1 X4.060 Y1.500 Z-9.7619 F3000
+G1 X4.040 Y1.500 Z-9.7884 F3000
+G1 X4.020 Y1.500 Z-9.8150 F3000
+G1 X4.000 Y1.500 Z-9.8417 F3000
+G1 X3.980 Y1.500 Z-9.8685 F3000
+G1 X3.960 Y1.500 Z-9.8954 F3000
+G1 X3.940 Y1.500 Z-9.9224 F3000
+G1 X3.920 Y1.500 Z-9.9495 F3000
+G1 X3.900 Y1.500 Z-9.9767 F3000
+G1 X3.880 Y1.500 Z-10.0040 F3000
+G1 X3.860 Y1.500 Z-10.0314 F3000
+G1 X3.840 Y1.500 Z-10.0589 F3000
+G1 X3.820 Y1.500 Z-10.0864 F3000
+G1 X3.800 Y1.500 Z-10.1141 F3000
+G1 X3.780 Y1.500 Z-10.1419 F3000
+G1 X3.760 Y1.500 Z-10.1698 F3000
+G1 X3.740 Y1.500 Z-10.1977 F3000
+G1 X3.720 Y1.500 Z-10.2258 F3000
+G1 X3.700 Y1.500 Z-10.2540 F3000
+G1 X3.680 Y1.500 Z-10.2823 F3000
+G1 X3.660 Y1.500 Z-10.3107 F3000
+G1 X3.640 Y1.500 Z-10.3392 F3000
+G1 X3.620 Y1.500 Z-10.3678 F3000
+G1 X3.600 Y1.500 Z-10.3965 F3000
+G1 X3.580 Y1.500 Z-10.4253 F3000
+G1 X3.560 Y1.500 Z-10.4542 F3000
+G1 X3.540 Y1.500 Z-10.4833 F3000
+G1 X3.520 Y1.500 Z-10.5124 F3000
+G1 X3.500 Y1.500 Z-10.5417 F3000
+G1 X3.480 Y1.500 Z-10.5710 F3000
+G1 X3.460 Y1.500 Z-10.6005 F3000
+G1 X3.440 Y1.500 Z-10.6301 F3000
+G1 X3.420 Y1.500 Z-10.6598 F3000
+G1 X3.400 Y1.500 Z-10.6896 F3000
+G1 X3.380 Y1.500 Z-10.7196 F3000
+G1 X3.360 Y1.500 Z-10.7496 F3000
+G1 X3.340 Y1.500 Z-10.7798 F3000
+G1 X3.320 Y1.500 Z-10.8101 F3000
+G1 X3.300 Y1.500 Z-10.8405 F3000
+G1 X3.280 Y1.500 Z-10.8711 F3000
+G1 X3.260 Y1.500 Z-10.9017 F3000
+G1 X3.240 Y1.500 Z-10.9325 F3000
+G1 X3.220 Y1.500 Z-10.9634 F3000
+G1 X3.200 Y1.500 Z-10.9944 F3000
+G1 X3.180 Y1.500 Z-11.0256 F3000
+G1 X3.160 Y1.500 Z-11.0569 F3000
+G1 X3.140 Y1.500 Z-11.0883 F3000
+G1 X3.120 Y1.500 Z-11.1199 F3000
+G1 X3.100 Y1.500 Z-11.1515 F3000
+G1 X3.080 Y1.500 Z-11.1833 F3000
+G1 X3.060 Y1.500 Z-11.2153 F3000
+G1 X3.040 Y1.500 Z-11.2474 F3000
+G1 X3.020 Y1.500 Z-11.2796 F3000
+G1 X3.000 Y1.500 Z-11.3119 F3000
+G1 X2.980 Y1.500 Z-11.3444 F3000
+G1 X2.960 Y1.500 Z-11.3770 F3000
+G1 X2.940 Y1.500 Z-11.4098 F3000
+G1 X2.920 Y1.500 Z-11.4427 F3000
+G1 X2.900 Y1.500 Z-11.4758 F3000
+G1 X2.880 Y1.500 Z-11.5090 F3000
+G1 X2.860 Y1.500 Z-11.5423 F3000
+G1 X2.840 Y1.500 Z-11.5758 F3000
+G1 X2.820 Y1.500 Z-11.6094 F3000
+G1 X2.800 Y1.500 Z-11.6432 F3000
+G1 X2.780 Y1.500 Z-11.6772 F3000
+G1 X2.760 Y1.500 Z-11.7113 F3000
+G1 X2.740 Y1.500 Z-11.7455 F3000
+G1 X2.720 Y1.500 Z-11.7799 F3000
+G1 X2.700 Y1.500 Z-11.8145 F3000
+G1 X2.680 Y1.500 Z-11.8492 F3000
+G1 X2.660 Y1.500 Z-11.8841 F3000
+G1 X2.640 Y1.500 Z-11.9192 F3000
+G1 X2.620 Y1.500 Z-11.9544 F3000
+G1 X2.600 Y1.500 Z-11.9898 F3000
+G1 X2.580 Y1.500 Z-12.0254 F3000
+G1 X2.560 Y1.500 Z-12.0611 F3000
+G1 X2.540 Y1.500 Z-12.0970 F3000
+G1 X2.520 Y1.500 Z-12.1331 F3000
+G1 X2.500 Y1.500 Z-12.1693 F3000
+G1 X2.480 Y1.500 Z-12.2058 F3000
+G1 X2.460 Y1.500 Z-12.2424 F3000
+G1 X2.440 Y1.500 Z-12.2792 F3000
+G1 X2.420 Y1.500 Z-12.3161 F3000
+G1 X2.400 Y1.500 Z-12.3533 F3000
+G1 X2.380 Y1.500 Z-12.3907 F3000
+G1 X2.360 Y1.500 Z-12.4282 F3000
+G1 X2.340 Y1.500 Z-12.4660 F3000
+G1 X2.320 Y1.500 Z-12.5039 F3000
+G1 X2.300 Y1.500 Z-12.5420 F3000
+G1 X2.280 Y1.500 Z-12.5804 F3000
+G1 X2.260 Y1.500 Z-12.6189 F3000
+G1 X2.240 Y1.500 Z-12.6577 F3000
+G1 X2.220 Y1.500 Z-12.6966 F3000
+G1 X2.200 Y1.500 Z-12.7358 F3000
+G1 X2.180 Y1.500 Z-12.7752 F3000
+G1 X2.160 Y1.500 Z-12.8148 F3000
+G1 X2.140 Y1.500 Z-12.8546 F3000
+G1 X2.120 Y1.500 Z-12.8946 F3000
+G1 X2.100 Y1.500 Z-12.9349 F3000
+G1 X2.080 Y1.500 Z-12.9754 F3000
+G1 X2.060 Y1.500 Z-13.0161 F3000
+G1 X2.040 Y1.500 Z-13.0571 F3000
+G1 X2.020 Y1.500 Z-13.0983 F3000
+G1 X2.000 Y1.500 Z-13.1397 F3000
+G1 X1.980 Y1.500 Z-13.1814 F3000
+G1 X1.960 Y1.500 Z-13.2234 F3000
+G1 X1.940 Y1.500 Z-13.2656 F3000
+G1 X1.920 Y1.500 Z-13.3080 F3000
+G1 X1.900 Y1.500 Z-13.3507 F3000
+G1 X1.880 Y1.500 Z-13.3937 F3000
+G1 X1.860 Y1.500 Z-13.4370 F3000
+G1 X1.840 Y1.500 Z-13.4805 F3000
+G1 X1.820 Y1.500 Z-13.5243 F3000
+G1 X1.800 Y1.500 Z-13.5684 F3000
+G1 X1.780 Y1.500 Z-13.6127 F3000
+G1 X1.760 Y1.500 Z-13.6574 F3000
+G1 X1.740 Y1.500 Z-13.7023 F3000
+G1 X1.720 Y1.500 Z-13.7476 F3000
+G1 X1.700 Y1.500 Z-13.7931 F3000
+G1 X1.680 Y1.500 Z-13.8390 F3000
+G1 X1.660 Y1.500 Z-13.8852 F3000
+G1 X1.640 Y1.500 Z-13.9317 F3000
+G1 X1.620 Y1.500 Z-13.9785 F3000
+G1 X1.600 Y1.500 Z-14.0257 F3000
+G1 X1.580 Y1.500 Z-14.0732 F3000
+G1 X1.560 Y1.500 Z-14.1210 F3000
+G1 X1.540 Y1.500 Z-14.1692 F3000
+G1 X1.520 Y1.500 Z-14.2178 F3000
+G1 X1.500 Y1.500 Z-14.2667 F3000
+G1 X1.480 Y1.500 Z-14.3160 F3000
+G1 X1.460 Y1.500 Z-14.3657 F3000
+G1 X1.440 Y1.500 Z-14.4158 F3000
+G1 X1.420 Y1.500 Z-14.4663 F3000
+G1 X1.400 Y1.500 Z-14.5171 F3000
+G1 X1.380 Y1.500 Z-14.5684 F3000
+G1 X1.360 Y1.500 Z-14.6201 F3000
+G1 X1.340 Y1.500 Z-14.6723 F3000
+G1 X1.320 Y1.500 Z-14.7249 F3000
+G1 X1.300 Y1.500 Z-14.7779 F3000
+G1 X1.280 Y1.500 Z-14.8314 F3000
+G1 X1.260 Y1.500 Z-14.8853 F3000
+G1 X1.240 Y1.500 Z-14.9398 F3000
+G1 X1.220 Y1.500 Z-14.9947 F3000
+G1 X1.200 Y1.500 Z-15.0502 F3000
+G1 X1.180 Y1.500 Z-15.1062 F3000
+G1 X1.160 Y1.500 Z-15.1627 F3000
+G1 X1.140 Y1.500 Z-15.2197 F3000
+G1 X1.120 Y1.500 Z-15.2773 F3000
+G1 X1.100 Y1.500 Z-15.3355 F3000
+G1 X1.080 Y1.500 Z-15.3943 F3000
+G1 X1.060 Y1.500 Z-15.4536 F3000
+G1 X1.040 Y1.500 Z-15.5136 F3000
+G1 X1.020 Y1.500 Z-15.5743 F3000
+G1 X1.000 Y1.500 Z-15.6356 F3000
+G1 X0.980 Y1.500 Z-15.6976 F3000
+G1 X0.960 Y1.500 Z-15.7603 F3000
+G1 X0.940 Y1.500 Z-15.8237 F3000
+G1 X0.920 Y1.500 Z-15.8878 F3000
+G1 X0.900 Y1.500 Z-15.9528 F3000
+G1 X0.880 Y1.500 Z-16.0185 F3000
+G1 X0.860 Y1.500 Z-16.0851 F3000
+G1 X0.840 Y1.500 Z-16.1525 F3000
+G1 X0.820 Y1.500 Z-16.2208 F3000
+G1 X0.800 Y1.500 Z-16.2900 F3000
+G1 X0.780 Y1.500 Z-16.3602 F3000
+G1 X0.760 Y1.500 Z-16.4314 F3000
+G1 X0.740 Y1.500 Z-16.5035 F3000
+G1 X0.720 Y1.500 Z-16.5768 F3000
+G1 X0.700 Y1.500 Z-16.6512 F3000
+G1 X0.680 Y1.500 Z-16.7268 F3000
+G1 X0.660 Y1.500 Z-16.8036 F3000
+G1 X0.640 Y1.500 Z-16.8816 F3000
+G1 X0.620 Y1.500 Z-16.9610 F3000
+G1 X0.600 Y1.500 Z-17.0418 F3000
+G1 X0.580 Y1.500 Z-17.1241 F3000
+G1 X0.560 Y1.500 Z-17.2080 F3000
+G1 X0.540 Y1.500 Z-17.2935 F3000
+G1 X0.520 Y1.500 Z-17.3808 F3000
+G1 X0.500 Y1.500 Z-17.4699 F3000
+G1 X0.480 Y1.500 Z-17.5609 F3000
+G1 X0.460 Y1.500 Z-17.6541 F3000
+G1 X0.440 Y1.500 Z-17.7495 F3000
+G1 X0.420 Y1.500 Z-17.8473 F3000
+G1 X0.400 Y1.500 Z-17.9477 F3000
+G1 X0.380 Y1.500 Z-18.0509 F3000
+G1 X0.360 Y1.500 Z-18.1571 F3000
+G1 X0.340 Y1.500 Z-18.2667 F3000
+G1 X0.320 Y1.500 Z-18.3798 F3000
+G1 X0.300 Y1.500 Z-18.4970 F3000
+G1 X0.280 Y1.500 Z-18.6186 F3000
+G1 X0.260 Y1.500 Z-18.7451 F3000
+G1 X0.240 Y1.500 Z-18.8773 F3000
+G1 X0.220 Y1.500 Z-19.0158 F3000
+G1 X0.200 Y1.500 Z-19.1618 F3000
+G1 X0.180 Y1.500 Z-19.3165 F3000
+G1 X0.160 Y1.500 Z-19.4817 F3000
+G1 X0.140 Y1.500 Z-19.6598 F3000
+G1 X0.120 Y1.500 Z-19.8543 F3000
+G1 X0.100 Y1.500 Z-20.0708 F3000
+G1 X0.080 Y1.500 Z-20.3189 F3000
+G1 X0.060 Y1.500 Z-20.6183 F3000
+G1 X0.040 Y1.500 Z-21.0264 F3000
+G1 X0.020 Y1.500 Z-21.8000 F3000
+G1 X0.000 Y1.500 Z-21.8000 F3000
+G1 X0.000 Y2.000 Z-21.8000 F3000
+G1 X0.020 Y2.000 Z-21.0586 F3000
+G1 X0.040 Y2.000 Z-20.6388 F3000
+G1 X0.060 Y2.000 Z-20.3349 F3000
+G1 X0.080 Y2.000 Z-20.0843 F3000
+G1 X0.100 Y2.000 Z-19.8661 F3000
+G1 X0.120 Y2.000 Z-19.6703 F3000
+G1 X0.140 Y2.000 Z-19.4912 F3000
+G1 X0.160 Y2.000 Z-19.3252 F3000
+G1 X0.180 Y2.000 Z-19.1699 F3000
+G1 X0.200 Y2.000 Z-19.0233 F3000
+G1 X0.220 Y2.000 Z-18.8842 F3000
+G1 X0.240 Y2.000 Z-18.7517 F3000
+G1 X0.260 Y2.000 Z-18.6247 F3000
+G1 X0.280 Y2.000 Z-18.5028 F3000
+G1 X0.300 Y2.000 Z-18.3853 F3000
+G1 X0.320 Y2.000 Z-18.2719 F3000
+G1 X0.340 Y2.000 Z-18.1621 F3000
+G1 X0.360 Y2.000 Z-18.0556 F3000
+G1 X0.380 Y2.000 Z-17.9522 F3000
+G1 X0.400 Y2.000 Z-17.8516 F3000
+G1 X0.420 Y2.000 Z-17.7536 F3000
+G1 X0.440 Y2.000 Z-17.6580 F3000
+G1 X0.460 Y2.000 Z-17.5646 F3000
+G1 X0.480 Y2.000 Z-17.4734 F3000
+G1 X0.500 Y2.000 Z-17.3841 F3000
+G1 X0.520 Y2.000 Z-17.2967 F3000
+G1 X0.540 Y2.000 Z-17.2111 F3000
+G1 X0.560 Y2.000 Z-17.1271 F3000
+G1 X0.580 Y2.000 Z-17.0446 F3000
+G1 X0.600 Y2.000 Z-16.9637 F3000
+G1 X0.620 Y2.000 Z-16.8841 F3000
+G1 X0.640 Y2.000 Z-16.8060 F3000
+G1 X0.660 Y2.000 Z-16.7291 F3000
+G1 X0.680 Y2.000 Z-16.6534 F3000
+G1 X0.700 Y2.000 Z-16.5789 F3000
+G1 X0.720 Y2.000 Z-16.5055 F3000
+G1 X0.740 Y2.000 Z-16.4332 F3000
+G1 X0.760 Y2.000 Z-16.3619 F3000
+G1 X0.780 Y2.000 Z-16.2917 F3000
+G1 X0.800 Y2.000 Z-16.2224 F3000
+G1 X0.820 Y2.000 Z-16.1540 F3000
+G1 X0.840 Y2.000 Z-16.0865 F3000
+G1 X0.860 Y2.000 Z-16.0198 F3000
+G1 X0.880 Y2.000 Z-15.9540 F3000
+G1 X0.900 Y2.000 Z-15.8890 F3000
+G1 X0.920 Y2.000 Z-15.8248 F3000
+G1 X0.940 Y2.000 Z-15.7613 F3000
+G1 X0.960 Y2.000 Z-15.6985 F3000
+G1 X0.980 Y2.000 Z-15.6364 F3000
+G1 X1.000 Y2.000 Z-15.5751 F3000
+G1 X1.020 Y2.000 Z-15.5143 F3000
+G1 X1.040 Y2.000 Z-15.4543 F3000
+G1 X1.060 Y2.000 Z-15.3948 F3000
+G1 X1.080 Y2.000 Z-15.3360 F3000
+G1 X1.100 Y2.000 Z-15.2777 F3000
+G1 X1.120 Y2.000 Z-15.2201 F3000
+G1 X1.140 Y2.000 Z-15.1630 F3000
+G1 X1.160 Y2.000 Z-15.1064 F3000
+G1 X1.180 Y2.000 Z-15.0504 F3000
+G1 X1.200 Y2.000 Z-14.9949 F3000
+G1 X1.220 Y2.000 Z-14.9399 F3000
+G1 X1.240 Y2.000 Z-14.8853 F3000
+G1 X1.260 Y2.000 Z-14.8313 F3000
+G1 X1.280 Y2.000 Z-14.7778 F3000
+G1 X1.300 Y2.000 Z-14.7247 F3000
+G1 X1.320 Y2.000 Z-14.6721 F3000
+G1 X1.340 Y2.000 Z-14.6199 F3000
+G1 X1.360 Y2.000 Z-14.5681 F3000
+G1 X1.380 Y2.000 Z-14.5168 F3000
+G1 X1.400 Y2.000 Z-14.4658 F3000
+G1 X1.420 Y2.000 Z-14.4153 F3000
+G1 X1.440 Y2.000 Z-14.3652 F3000
+G1 X1.460 Y2.000 Z-14.3155 F3000
+G1 X1.480 Y2.000 Z-14.2661 F3000
+G1 X1.500 Y2.000 Z-14.2171 F3000
+G1 X1.520 Y2.000 Z-14.1685 F3000
+G1 X1.540 Y2.000 Z-14.1203 F3000
+G1 X1.560 Y2.000 Z-14.0724 F3000
+G1 X1.580 Y2.000 Z-14.0248 F3000
+G1 X1.600 Y2.000 Z-13.9776 F3000
+G1 X1.620 Y2.000 Z-13.9307 F3000
+G1 X1.640 Y2.000 Z-13.8842 F3000
+G1 X1.660 Y2.000 Z-13.8379 F3000
+G1 X1.680 Y2.000 Z-13.7920 F3000
+G1 X1.700 Y2.000 Z-13.7464 F3000
+G1 X1.720 Y2.000 Z-13.7011 F3000
+G1 X1.740 Y2.000 Z-13.6561 F3000
+G1 X1.760 Y2.000 Z-13.6114 F3000
+G1 X1.780 Y2.000 Z-13.5670 F3000
+G1 X1.800 Y2.000 Z-13.5229 F3000
+G1 X1.820 Y2.000 Z-13.4791 F3000
+G1 X1.840 Y2.000 Z-13.4355 F3000
+G1 X1.860 Y2.000 Z-13.3922 F3000
+G1 X1.880 Y2.000 Z-13.3492 F3000
+G1 X1.900 Y2.000 Z-13.3065 F3000
+G1 X1.920 Y2.000 Z-13.2640 F3000
+G1 X1.940 Y2.000 Z-13.2217 F3000
+G1 X1.960 Y2.000 Z-13.1798 F3000
+G1 X1.980 Y2.000 Z-13.1380 F3000
+G1 X2.000 Y2.000 Z-13.0966 F3000
+G1 X2.020 Y2.000 Z-13.0553 F3000
+G1 X2.040 Y2.000 Z-13.0143 F3000
+G1 X2.060 Y2.000 Z-12.9735 F3000
+G1 X2.080 Y2.000 Z-12.9330 F3000
+G1 X2.100 Y2.000 Z-12.8927 F3000
+G1 X2.120 Y2.000 Z-12.8526 F3000
+G1 X2.140 Y2.000 Z-12.8128 F3000
+G1 X2.160 Y2.000 Z-12.7731 F3000
+G1 X2.180 Y2.000 Z-12.7337 F3000
+G1 X2.200 Y2.000 Z-12.6945 F3000
+G1 X2.220 Y2.000 Z-12.6555 F3000
+G1 X2.240 Y2.000 Z-12.6167 F3000
+G1 X2.260 Y2.000 Z-12.5782 F3000
+G1 X2.280 Y2.000 Z-12.5398 F3000
+G1 X2.300 Y2.000 Z-12.5016 F3000
+G1 X2.320 Y2.000 Z-12.4636 F3000
+G1 X2.340 Y2.000 Z-12.4259 F3000
+G1 X2.360 Y2.000 Z-12.3883 F3000
+G1 X2.380 Y2.000 Z-12.3509 F3000
+G1 X2.400 Y2.000 Z-12.3137 F3000
+G1 X2.420 Y2.000 Z-12.2767 F3000
+G1 X2.440 Y2.000 Z-12.2399 F3000
+G1 X2.460 Y2.000 Z-12.2032 F3000
+G1 X2.480 Y2.000 Z-12.1667 F3000
+G1 X2.500 Y2.000 Z-12.1305 F3000
+G1 X2.520 Y2.000 Z-12.0944 F3000
+G1 X2.540 Y2.000 Z-12.0584 F3000
+G1 X2.560 Y2.000 Z-12.0227 F3000
+G1 X2.580 Y2.000 Z-11.9871 F3000
+G1 X2.600 Y2.000 Z-11.9516 F3000
+G1 X2.620 Y2.000 Z-11.9164 F3000
+G1 X2.640 Y2.000 Z-11.8813 F3000
+G1 X2.660 Y2.000 Z-11.8464 F3000
+G1 X2.680 Y2.000 Z-11.8116 F3000
+G1 X2.700 Y2.000 Z-11.7770 F3000
+G1 X2.720 Y2.000 Z-11.7426 F3000
+G1 X2.740 Y2.000 Z-11.7083 F3000
+G1 X2.760 Y2.000 Z-11.6742 F3000
+G1 X2.780 Y2.000 Z-11.6402 F3000
+G1 X2.800 Y2.000 Z-11.6064 F3000
+G1 X2.820 Y2.000 Z-11.5727 F3000
+G1 X2.840 Y2.000 Z-11.5392 F3000
+G1 X2.860 Y2.000 Z-11.5058 F3000
+G1 X2.880 Y2.000 Z-11.4726 F3000
+G1 X2.900 Y2.000 Z-11.4395 F3000
+G1 X2.920 Y2.000 Z-11.4066 F3000
+G1 X2.940 Y2.000 Z-11.3738 F3000
+G1 X2.960 Y2.000 Z-11.3411 F3000
+G1 X2.980 Y2.000 Z-11.3086 F3000
+G1 X3.000 Y2.000 Z-11.2762 F3000
+G1 X3.020 Y2.000 Z-11.2440 F3000
+G1 X3.040 Y2.000 Z-11.2119 F3000
+G1 X3.060 Y2.000 Z-11.1799 F3000
+G1 X3.080 Y2.000 Z-11.1481 F3000
+G1 X3.100 Y2.000 Z-11.1164 F3000
+G1 X3.120 Y2.000 Z-11.0848 F3000
+G1 X3.140 Y2.000 Z-11.0534 F3000
+G1 X3.160 Y2.000 Z-11.0220 F3000
+G1 X3.180 Y2.000 Z-10.9909 F3000
+G1 X3.200 Y2.000 Z-10.9598 F3000
+G1 X3.220 Y2.000 Z-10.9289 F3000
+G1 X3.240 Y2.000 Z-10.8981 F3000
+G1 X3.260 Y2.000 Z-10.8674 F3000
+G1 X3.280 Y2.000 Z-10.8368 F3000
+G1 X3.300 Y2.000 Z-10.8064 F3000
+G1 X3.320 Y2.000 Z-10.7760 F3000
+G1 X3.340 Y2.000 Z-10.7458 F3000
+G1 X3.360 Y2.000 Z-10.7158 F3000
+G1 X3.380 Y2.000 Z-10.6858 F3000
+G1 X3.400 Y2.000 Z-10.6559 F3000
+G1 X3.420 Y2.000 Z-10.6262 F3000
+G1 X3.440 Y2.000 Z-10.5966 F3000
+G1 X3.460 Y2.000 Z-10.5671 F3000
+G1 X3.480 Y2.000 Z-10.5377 F3000
+G1 X3.500 Y2.000 Z-10.5084 F3000
+G1 X3.520 Y2.000 Z-10.4792 F3000
+G1 X3.540 Y2.000 Z-10.4502 F3000
+G1 X3.560 Y2.000 Z-10.4212 F3000
+G1 X3.580 Y2.000 Z-10.3924 F3000
+G1 X3.600 Y2.000 Z-10.3637 F3000
+G1 X3.620 Y2.000 Z-10.3350 F3000
+G1 X3.640 Y2.000 Z-10.3065 F3000
+G1 X3.660 Y2.000 Z-10.2781 F3000
+G1 X3.680 Y2.000 Z-10.2498 F3000
+G1 X3.700 Y2.000 Z-10.2216 F3000
+G1 X3.720 Y2.000 Z-10.1935 F3000
+G1 X3.740 Y2.000 Z-10.1655 F3000
+G1 X3.760 Y2.000 Z-10.1376 F3000
+G1 X3.780 Y2.000 Z-10.1098 F3000
+G1 X3.800 Y2.000 Z-10.0821 F3000
+G1 X3.820 Y2.000 Z-10.0545 F3000
+G1 X3.840 Y2.000 Z-10.0270 F3000
+G1 X3.860 Y2.000 Z-9.9996 F3000
+G1 X3.880 Y2.000 Z-9.9723 F3000
+G1 X3.900 Y2.000 Z-9.9450 F3000
+G1 X3.920 Y2.000 Z-9.9179 F3000
+G1 X3.940 Y2.000 Z-9.8909 F3000
+G1 X3.960 Y2.000 Z-9.8640 F3000
+G1 X3.980 Y2.000 Z-9.8372 F3000
+G1 X4.000 Y2.000 Z-9.8104 F3000
+G1 X4.020 Y2.000 Z-9.7838 F3000
+G1 X4.040 Y2.000 Z-9.7572 F3000
+G1 X4.060 Y2.000 Z-9.7308 F3000
+G1 X4.080 Y2.000 Z-9.7044 F3000
+G1 X4.100 Y2.000 Z-9.6781 F3000
+G1 X4.120 Y2.000 Z-9.6519 F3000
+G1 X4.140 Y2.000 Z-9.6258 F3000
+G1 X4.160 Y2.000 Z-9.5998 F3000
+G1 X4.180 Y2.000 Z-9.5739 F3000
+G1 X4.200 Y2.000 Z-9.5481 F3000
+G1 X4.220 Y2.000 Z-9.5223 F3000
+G1 X4.240 Y2.000 Z-9.4967 F3000
+G1 X4.260 Y2.000 Z-9.4711 F3000
+G1 X4.280 Y2.000 Z-9.4456 F3000
+G1 X4.300 Y2.000 Z-9.4202 F3000
+G1 X4.320 Y2.000 Z-9.3949 F3000
+G1 X4.340 Y2.000 Z-9.3696 F3000
+G1 X4.360 Y2.000 Z-9.3445 F3000
+G1 X4.380 Y2.000 Z-9.3194 F3000
+G1 X4.400 Y2.000 Z-9.2944 F3000
+G1 X4.420 Y2.000 Z-9.2695 F3000
+G1 X4.440 Y2.000 Z-9.2447 F3000
+G1 X4.460 Y2.000 Z-9.2199 F3000
+G1 X4.480 Y2.000 Z-9.1953 F3000
+G1 X4.500 Y2.000 Z-9.1707 F3000
+G1 X4.520 Y2.000 Z-9.1462 F3000
+G1 X4.540 Y2.000 Z-9.1217 F3000
+G1 X4.560 Y2.000 Z-9.0974 F3000
+G1 X4.580 Y2.000 Z-9.0731 F3000
+G1 X4.600 Y2.000 Z-9.0489 F3000
+G1 X4.620 Y2.000 Z-9.0248 F3000
+G1 X4.640 Y2.000 Z-9.0008 F3000
+G1 X4.660 Y2.000 Z-8.9768 F3000
+G1 X4.680 Y2.000 Z-8.9529 F3000
+G1 X4.700 Y2.000 Z-8.9291 F3000
+G1 X4.720 Y2.000 Z-8.9054 F3000
+G1 X4.740 Y2.000 Z-8.8817 F3000
+G1 X4.760 Y2.000 Z-8.8581 F3000
+G1 X4.780 Y2.000 Z-8.8346 F3000
+G1 X4.800 Y2.000 Z-8.8112 F3000
+G1 X4.820 Y2.000 Z-8.7878 F3000
+G1 X4.840 Y2.000 Z-8.7645 F3000
+G1 X4.860 Y2.000 Z-8.7413 F3000
+G1 X4.880 Y2.000 Z-8.7181 F3000
+G1 X4.900 Y2.000 Z-8.6950 F3000
+G1 X4.920 Y2.000 Z-8.6720 F3000
+G1 X4.940 Y2.000 Z-8.6491 F3000
+G1 X4.960 Y2.000 Z-8.6262 F3000
+G1 X4.980 Y2.000 Z-8.6034 F3000
+G1 X5.000 Y2.000 Z-8.5807 F3000
+G1 X5.020 Y2.000 Z-8.5580 F3000
+G1 X5.040 Y2.000 Z-8.5354 F3000
+G1 X5.060 Y2.000 Z-8.5129 F3000
+G1 X5.080 Y2.000 Z-8.4905 F3000
+G1 X5.100 Y2.000 Z-8.4681 F3000
+G1 X5.120 Y2.000 Z-8.4458 F3000
+G1 X5.140 Y2.000 Z-8.4235 F3000
+G1 X5.160 Y2.000 Z-8.4013 F3000
+G1 X5.180 Y2.000 Z-8.3792 F3000
+G1 X5.200 Y2.000 Z-8.3572 F3000
+G1 X5.220 Y2.000 Z-8.3352 F3000
+G1 X5.240 Y2.000 Z-8.3133 F3000
+G1 X5.260 Y2.000 Z-8.2914 F3000
+G1 X5.280 Y2.000 Z-8.2696 F3000
+G1 X5.300 Y2.000 Z-8.2479 F3000
+G1 X5.320 Y2.000 Z-8.2262 F3000
+G1 X5.340 Y2.000 Z-8.2046 F3000
+G1 X5.360 Y2.000 Z-8.1831 F3000
+G1 X5.380 Y2.000 Z-8.1616 F3000
+G1 X5.400 Y2.000 Z-8.1402 F3000
+G1 X5.420 Y2.000 Z-8.1189 F3000
+G1 X5.440 Y2.000 Z-8.0976 F3000
+G1 X5.460 Y2.000 Z-8.0764 F3000
+G1 X5.480 Y2.000 Z-8.0552 F3000
+G1 X5.500 Y2.000 Z-8.0341 F3000
+G1 X5.520 Y2.000 Z-8.0131 F3000
+G1 X5.540 Y2.000 Z-7.9921 F3000
+G1 X5.560 Y2.000 Z-7.9712 F3000
+G1 X5.580 Y2.000 Z-7.9503 F3000
+G1 X5.600 Y2.000 Z-7.9295 F3000
+G1 X5.620 Y2.000 Z-7.9088 F3000
+G1 X5.640 Y2.000 Z-7.8881 F3000
+G1 X5.660 Y2.000 Z-7.8675 F3000
+G1 X5.680 Y2.000 Z-7.8470 F3000
+G1 X5.700 Y2.000 Z-7.8265 F3000
+G1 X5.720 Y2.000 Z-7.8060 F3000
+G1 X5.740 Y2.000 Z-7.7856 F3000
+G1 X5.760 Y2.000 Z-7.7653 F3000
+G1 X5.780 Y2.000 Z-7.7451 F3000
+G1 X5.800 Y2.000 Z-7.7248 F3000
+G1 X5.820 Y2.000 Z-7.7047 F3000
+G1 X5.840 Y2.000 Z-7.6846 F3000
+G1 X5.860 Y2.000 Z-7.6646 F3000
+G1 X5.880 Y2.000 Z-7.6446 F3000
+G1 X5.900 Y2.000 Z-7.6247 F3000
+G1 X5.920 Y2.000 Z-7.6048 F3000
+G1 X5.940 Y2.000 Z-7.5850 F3000
+G1 X5.960 Y2.000 Z-7.5652 F3000
+G1 X5.980 Y2.000 Z-7.5455 F3000
+G1 X6.000 Y2.000 Z-7.5259 F3000
+G1 X6.020 Y2.000 Z-7.5063 F3000
+G1 X6.040 Y2.000 Z-7.4868 F3000
+G1 X6.060 Y2.000 Z-7.4673 F3000
+G1 X6.080 Y2.000 Z-7.4479 F3000
+G1 X6.100 Y2.000 Z-7.4285 F3000
+G1 X6.120 Y2.000 Z-7.4092 F3000
+G1 X6.140 Y2.000 Z-7.3899 F3000
+G1 X6.160 Y2.000 Z-7.3707 F3000
+G1 X6.180 Y2.000 Z-7.3516 F3000
+G1 X6.200 Y2.000 Z-7.3325 F3000
+G1 X6.220 Y2.000 Z-7.3134 F3000
+G1 X6.240 Y2.000 Z-7.2944 F3000
+G1 X6.260 Y2.000 Z-7.2755 F3000
+G1 X6.280 Y2.000 Z-7.2566 F3000
+G1 X6.300 Y2.000 Z-7.2377 F3000
+G1 X6.320 Y2.000 Z-7.2189 F3000
+G1 X6.340 Y2.000 Z-7.2002 F3000
+G1 X6.360 Y2.000 Z-7.1815 F3000
+G1 X6.380 Y2.000 Z-7.1629 F3000
+G1 X6.400 Y2.000 Z-7.1443 F3000
+G1 X6.420 Y2.000 Z-7.1258 F3000
+G1 X6.440 Y2.000 Z-7.1073 F3000
+G1 X6.460 Y2.000 Z-7.0888 F3000
+G1 X6.480 Y2.000 Z-7.0705 F3000
+G1 X6.500 Y2.000 Z-7.0521 F3000
+G1 X6.520 Y2.000 Z-7.0338 F3000
+G1 X6.540 Y2.000 Z-7.0156 F3000
+G1 X6.560 Y2.000 Z-6.9974 F3000
+G1 X6.580 Y2.000 Z-6.9793 F3000
+G1 X6.600 Y2.000 Z-6.9612 F3000
+G1 X6.620 Y2.000 Z-6.9432 F3000
+G1 X6.640 Y2.000 Z-6.9252 F3000
+G1 X6.660 Y2.000 Z-6.9072 F3000
+G1 X6.680 Y2.000 Z-6.8893 F3000
+G1 X6.700 Y2.000 Z-6.8715 F3000
+G1 X6.720 Y2.000 Z-6.8537 F3000
+G1 X6.740 Y2.000 Z-6.8360 F3000
+G1 X6.760 Y2.000 Z-6.8183 F3000
+G1 X6.780 Y2.000 Z-6.8006 F3000
+G1 X6.800 Y2.000 Z-6.7830 F3000
+G1 X6.820 Y2.000 Z-6.7655 F3000
+G1 X6.840 Y2.000 Z-6.7479 F3000
+G1 X6.860 Y2.000 Z-6.7305 F3000
+G1 X6.880 Y2.000 Z-6.7131 F3000
+G1 X6.900 Y2.000 Z-6.6957 F3000
+G1 X6.920 Y2.000 Z-6.6784 F3000
+G1 X6.940 Y2.000 Z-6.6611 F3000
+G1 X6.960 Y2.000 Z-6.6439 F3000
+G1 X6.980 Y2.000 Z-6.6267 F3000
+G1 X7.000 Y2.000 Z-6.6095 F3000
+G1 X7.020 Y2.000 Z-6.5924 F3000
+G1 X7.040 Y2.000 Z-6.5754 F3000
+G1 X7.060 Y2.000 Z-6.5584 F3000
+G1 X7.080 Y2.000 Z-6.5414 F3000
+G1 X7.100 Y2.000 Z-6.5245 F3000
+G1 X7.120 Y2.000 Z-6.5077 F3000
+G1 X7.140 Y2.000 Z-6.4908 F3000
+G1 X7.160 Y2.000 Z-6.4741 F3000
+G1 X7.180 Y2.000 Z-6.4573 F3000
+G1 X7.200 Y2.000 Z-6.4406 F3000
+G1 X7.220 Y2.000 Z-6.4240 F3000
+G1 X7.240 Y2.000 Z-6.4074 F3000
+G1 X7.260 Y2.000 Z-6.3908 F3000
+G1 X7.280 Y2.000 Z-6.3743 F3000
+G1 X7.300 Y2.000 Z-6.3578 F3000
+G1 X7.320 Y2.000 Z-6.3414 F3000
+G1 X7.340 Y2.000 Z-6.3250 F3000
+G1 X7.360 Y2.000 Z-6.3087 F3000
+G1 X7.380 Y2.000 Z-6.2924 F3000
+G1 X7.400 Y2.000 Z-6.2761 F3000
+G1 X7.420 Y2.000 Z-6.2599 F3000
+G1 X7.440 Y2.000 Z-6.2438 F3000
+G1 X7.460 Y2.000 Z-6.2276 F3000
+G1 X7.480 Y2.000 Z-6.2116 F3000
+G1 X7.500 Y2.000 Z-6.1955 F3000
+G1 X7.520 Y2.000 Z-6.1795 F3000
+G1 X7.540 Y2.000 Z-6.1636 F3000
+G1 X7.560 Y2.000 Z-6.1476 F3000
+G1 X7.580 Y2.000 Z-6.1318 F3000
+G1 X7.600 Y2.000 Z-6.1159 F3000
+G1 X7.620 Y2.000 Z-6.1001 F3000
+G1 X7.640 Y2.000 Z-6.0844 F3000
+G1 X7.660 Y2.000 Z-6.0687 F3000
+G1 X7.680 Y2.000 Z-6.0530 F3000
+G1 X7.700 Y2.000 Z-6.0374 F3000
+G1 X7.720 Y2.000 Z-6.0218 F3000
+G1 X7.740 Y2.000 Z-6.0063 F3000
+G1 X7.760 Y2.000 Z-5.9907 F3000
+G1 X7.780 Y2.000 Z-5.9753 F3000
+G1 X7.800 Y2.000 Z-5.9599 F3000
+G1 X7.820 Y2.000 Z-5.9445 F3000
+G1 X7.840 Y2.000 Z-5.9291 F3000
+G1 X7.860 Y2.000 Z-5.9138 F3000
+G1 X7.880 Y2.000 Z-5.8986 F3000
+G1 X7.900 Y2.000 Z-5.8833 F3000
+G1 X7.920 Y2.000 Z-5.8682 F3000
+G1 X7.940 Y2.000 Z-5.8530 F3000
+G1 X7.960 Y2.000 Z-5.8379 F3000
+G1 X7.980 Y2.000 Z-5.8228 F3000
+G1 X8.000 Y2.000 Z-5.8078 F3000
+G1 X8.020 Y2.000 Z-5.7928 F3000
+G1 X8.040 Y2.000 Z-5.7779 F3000
+G1 X8.060 Y2.000 Z-5.7630 F3000
+G1 X8.080 Y2.000 Z-5.7481 F3000
+G1 X8.100 Y2.000 Z-5.7333 F3000
+G1 X8.120 Y2.000 Z-5.7185 F3000
+G1 X8.140 Y2.000 Z-5.7037 F3000
+G1 X8.160 Y2.000 Z-5.6890 F3000
+G1 X8.180 Y2.000 Z-5.6743 F3000
+G1 X8.200 Y2.000 Z-5.6597 F3000
+G1 X8.220 Y2.000 Z-5.6451 F3000
+G1 X8.240 Y2.000 Z-5.6305 F3000
+G1 X8.260 Y2.000 Z-5.6160 F3000
+G1 X8.280 Y2.000 Z-5.6015 F3000
+G1 X8.300 Y2.000 Z-5.5870 F3000
+G1 X8.320 Y2.000 Z-5.5726 F3000
+G1 X8.340 Y2.000 Z-5.5583 F3000
+G1 X8.360 Y2.000 Z-5.5439 F3000
+G1 X8.380 Y2.000 Z-5.5296 F3000
+G1 X8.400 Y2.000 Z-5.5153 F3000
+G1 X8.420 Y2.000 Z-5.5011 F3000
+G1 X8.440 Y2.000 Z-5.4869 F3000
+G1 X8.460 Y2.000 Z-5.4728 F3000
+G1 X8.480 Y2.000 Z-5.4587 F3000
+G1 X8.500 Y2.000 Z-5.4446 F3000
+G1 X8.520 Y2.000 Z-5.4305 F3000
+G1 X8.540 Y2.000 Z-5.4165 F3000
+G1 X8.560 Y2.000 Z-5.4025 F3000
+G1 X8.580 Y2.000 Z-5.3886 F3000
+G1 X8.600 Y2.000 Z-5.3747 F3000
+G1 X8.620 Y2.000 Z-5.3609 F3000
+G1 X8.640 Y2.000 Z-5.3470 F3000
+G1 X8.660 Y2.000 Z-5.3332 F3000
+G1 X8.680 Y2.000 Z-5.3195 F3000
+G1 X8.700 Y2.000 Z-5.3058 F3000
+G1 X8.720 Y2.000 Z-5.2921 F3000
+G1 X8.740 Y2.000 Z-5.2784 F3000
+G1 X8.760 Y2.000 Z-5.2648 F3000
+G1 X8.780 Y2.000 Z-5.2512 F3000
+G1 X8.800 Y2.000 Z-5.2377 F3000
+G1 X8.820 Y2.000 Z-5.2242 F3000
+G1 X8.840 Y2.000 Z-5.2107 F3000
+G1 X8.860 Y2.000 Z-5.1973 F3000
+G1 X8.880 Y2.000 Z-5.1839 F3000
+G1 X8.900 Y2.000 Z-5.1705 F3000
+G1 X8.920 Y2.000 Z-5.1572 F3000
+G1 X8.940 Y2.000 Z-5.1439 F3000
+G1 X8.960 Y2.000 Z-5.1306 F3000
+G1 X8.980 Y2.000 Z-5.1174 F3000
+G1 X9.000 Y2.000 Z-5.1042 F3000
+G1 X9.020 Y2.000 Z-5.0910 F3000
+G1 X9.040 Y2.000 Z-5.0779 F3000
+G1 X9.060 Y2.000 Z-5.0648 F3000
+G1 X9.080 Y2.000 Z-5.0518 F3000
+G1 X9.100 Y2.000 Z-5.0387 F3000
+G1 X9.120 Y2.000 Z-5.0257 F3000
+G1 X9.140 Y2.000 Z-5.0128 F3000
+G1 X9.160 Y2.000 Z-4.9999 F3000
+G1 X9.180 Y2.000 Z-4.9870 F3000
+G1 X9.200 Y2.000 Z-4.9741 F3000
+G1 X9.220 Y2.000 Z-4.9613 F3000
+G1 X9.240 Y2.000 Z-4.9485 F3000
+G1 X9.260 Y2.000 Z-4.9358 F3000
+G1 X9.280 Y2.000 Z-4.9230 F3000
+G1 X9.300 Y2.000 Z-4.9104 F3000
+G1 X9.320 Y2.000 Z-4.8977 F3000
+G1 X9.340 Y2.000 Z-4.8851 F3000
+G1 X9.360 Y2.000 Z-4.8725 F3000
+G1 X9.380 Y2.000 Z-4.8599 F3000
+G1 X9.400 Y2.000 Z-4.8474 F3000
+G1 X9.420 Y2.000 Z-4.8349 F3000
+G1 X9.440 Y2.000 Z-4.8225 F3000
+G1 X9.460 Y2.000 Z-4.8101 F3000
+G1 X9.480 Y2.000 Z-4.7977 F3000
+G1 X9.500 Y2.000 Z-4.7853 F3000
+G1 X9.520 Y2.000 Z-4.7730 F3000
+G1 X9.540 Y2.000 Z-4.7607 F3000
+G1 X9.560 Y2.000 Z-4.7484 F3000
+G1 X9.580 Y2.000 Z-4.7362 F3000
+G1 X9.600 Y2.000 Z-4.7240 F3000
+G1 X9.620 Y2.000 Z-4.7118 F3000
+G1 X9.640 Y2.000 Z-4.6997 F3000
+G1 X9.660 Y2.000 Z-4.6876 F3000
+G1 X9.680 Y2.000 Z-4.6755 F3000
+G1 X9.700 Y2.000 Z-4.6635 F3000
+G1 X9.720 Y2.000 Z-4.6515 F3000
+G1 X9.740 Y2.000 Z-4.6395 F3000
+G1 X9.760 Y2.000 Z-4.6276 F3000
+G1 X9.780 Y2.000 Z-4.6157 F3000
+G1 X9.800 Y2.000 Z-4.6038 F3000
+G1 X9.820 Y2.000 Z-4.5919 F3000
+G1 X9.840 Y2.000 Z-4.5801 F3000
+G1 X9.860 Y2.000 Z-4.5683 F3000
+G1 X9.880 Y2.000 Z-4.5566 F3000
+G1 X9.900 Y2.000 Z-4.5449 F3000
+G1 X9.920 Y2.000 Z-4.5332 F3000
+G1 X9.940 Y2.000 Z-4.5215 F3000
+G1 X9.960 Y2.000 Z-4.5099 F3000
+G1 X9.980 Y2.000 Z-4.4983 F3000
+G1 X10.000 Y2.000 Z-4.4867 F3000
+G1 X10.020 Y2.000 Z-4.4752 F3000
+G1 X10.040 Y2.000 Z-4.4637 F3000
+G1 X10.060 Y2.000 Z-4.4522 F3000
+G1 X10.080 Y2.000 Z-4.4407 F3000
+G1 X10.100 Y2.000 Z-4.4293 F3000
+G1 X10.120 Y2.000 Z-4.4180 F3000
+G1 X10.140 Y2.000 Z-4.4066 F3000
+G1 X10.160 Y2.000 Z-4.3953 F3000
+G1 X10.180 Y2.000 Z-4.3840 F3000
+G1 X10.200 Y2.000 Z-4.3727 F3000
+G1 X10.220 Y2.000 Z-4.3615 F3000
+G1 X10.240 Y2.000 Z-4.3503 F3000
+G1 X10.260 Y2.000 Z-4.3391 F3000
+G1 X10.280 Y2.000 Z-4.3280 F3000
+G1 X10.300 Y2.000 Z-4.3169 F3000
+G1 X10.320 Y2.000 Z-4.3058 F3000
+G1 X10.340 Y2.000 Z-4.2947 F3000
+G1 X10.360 Y2.000 Z-4.2837 F3000
+G1 X10.380 Y2.000 Z-4.2727 F3000
+G1 X10.400 Y2.000 Z-4.2618 F3000
+G1 X10.420 Y2.000 Z-4.2508 F3000
+G1 X10.440 Y2.000 Z-4.2399 F3000
+G1 X10.460 Y2.000 Z-4.2290 F3000
+G1 X10.480 Y2.000 Z-4.2182 F3000
+G1 X10.500 Y2.000 Z-4.2074 F3000
+G1 X10.520 Y2.000 Z-4.1966 F3000
+G1 X10.540 Y2.000 Z-4.1858 F3000
+G1 X10.560 Y2.000 Z-4.1751 F3000
+G1 X10.580 Y2.000 Z-4.1644 F3000
+G1 X10.600 Y2.000 Z-4.1538 F3000
+G1 X10.620 Y2.000 Z-4.1431 F3000
+G1 X10.640 Y2.000 Z-4.1325 F3000
+G1 X10.660 Y2.000 Z-4.1219 F3000
+G1 X10.680 Y2.000 Z-4.1114 F3000
+G1 X10.700 Y2.000 Z-4.1008 F3000
+G1 X10.720 Y2.000 Z-4.0904 F3000
+G1 X10.740 Y2.000 Z-4.0799 F3000
+G1 X10.760 Y2.000 Z-4.0695 F3000
+G1 X10.780 Y2.000 Z-4.0590 F3000
+G1 X10.800 Y2.000 Z-4.0487 F3000
+G1 X10.820 Y2.000 Z-4.0383 F3000
+G1 X10.840 Y2.000 Z-4.0280 F3000
+G1 X10.860 Y2.000 Z-4.0177 F3000
+G1 X10.880 Y2.000 Z-4.0074 F3000
+G1 X10.900 Y2.000 Z-3.9972 F3000
+G1 X10.920 Y2.000 Z-3.9870 F3000
+G1 X10.940 Y2.000 Z-3.9768 F3000
+G1 X10.960 Y2.000 Z-3.9666 F3000
+G1 X10.980 Y2.000 Z-3.9565 F3000
+G1 X11.000 Y2.000 Z-3.9464 F3000
+G1 X11.020 Y2.000 Z-3.9364 F3000
+G1 X11.040 Y2.000 Z-3.9263 F3000
+G1 X11.060 Y2.000 Z-3.9163 F3000
+G1 X11.080 Y2.000 Z-3.9063 F3000
+G1 X11.100 Y2.000 Z-3.8964 F3000
+G1 X11.120 Y2.000 Z-3.8864 F3000
+G1 X11.140 Y2.000 Z-3.8765 F3000
+G1 X11.160 Y2.000 Z-3.8667 F3000
+G1 X11.180 Y2.000 Z-3.8568 F3000
+G1 X11.200 Y2.000 Z-3.8470 F3000
+G1 X11.220 Y2.000 Z-3.8372 F3000
+G1 X11.240 Y2.000 Z-3.8275 F3000
+G1 X11.260 Y2.000 Z-3.8177 F3000
+G1 X11.280 Y2.000 Z-3.8080 F3000
+G1 X11.300 Y2.000 Z-3.7983 F3000
+G1 X11.320 Y2.000 Z-3.7887 F3000
+G1 X11.340 Y2.000 Z-3.7791 F3000
+G1 X11.360 Y2.000 Z-3.7695 F3000
+G1 X11.380 Y2.000 Z-3.7599 F3000
+G1 X11.400 Y2.000 Z-3.7503 F3000
+G1 X11.420 Y2.000 Z-3.7408 F3000
+G1 X11.440 Y2.000 Z-3.7313 F3000
+G1 X11.460 Y2.000 Z-3.7219 F3000
+G1 X11.480 Y2.000 Z-3.7124 F3000
+G1 X11.500 Y2.000 Z-3.7030 F3000
+G1 X11.520 Y2.000 Z-3.6937 F3000
+G1 X11.540 Y2.000 Z-3.6843 F3000
+G1 X11.560 Y2.000 Z-3.6750 F3000
+G1 X11.580 Y2.000 Z-3.6657 F3000
+G1 X11.600 Y2.000 Z-3.6564 F3000
+G1 X11.620 Y2.000 Z-3.6472 F3000
+G1 X11.640 Y2.000 Z-3.6379 F3000
+G1 X11.660 Y2.000 Z-3.6287 F3000
+G1 X11.680 Y2.000 Z-3.6196 F3000
+G1 X11.700 Y2.000 Z-3.6104 F3000
+G1 X11.720 Y2.000 Z-3.6013 F3000
+G1 X11.740 Y2.000 Z-3.5922 F3000
+G1 X11.760 Y2.000 Z-3.5832 F3000
+G1 X11.780 Y2.000 Z-3.5742 F3000
+G1 X11.800 Y2.000 Z-3.5651 F3000
+G1 X11.820 Y2.000 Z-3.5562 F3000
+G1 X11.840 Y2.000 Z-3.5472 F3000
+G1 X11.860 Y2.000 Z-3.5383 F3000
+G1 X11.880 Y2.000 Z-3.5294 F3000
+G1 X11.900 Y2.000 Z-3.5205 F3000
+G1 X11.920 Y2.000 Z-3.5117 F3000
+G1 X11.940 Y2.000 Z-3.5028 F3000
+G1 X11.960 Y2.000 Z-3.4940 F3000
+G1 X11.980 Y2.000 Z-3.4853 F3000
+G1 X12.000 Y2.000 Z-3.4765 F3000
+G1 X12.020 Y2.000 Z-3.4678 F3000
+G1 X12.040 Y2.000 Z-3.4591 F3000
+G1 X12.060 Y2.000 Z-3.4504 F3000
+G1 X12.080 Y2.000 Z-3.4418 F3000
+G1 X12.100 Y2.000 Z-3.4332 F3000
+G1 X12.120 Y2.000 Z-3.4246 F3000
+G1 X12.140 Y2.000 Z-3.4160 F3000
+G1 X12.160 Y2.000 Z-3.4075 F3000
+G1 X12.180 Y2.000 Z-3.3990 F3000
+G1 X12.200 Y2.000 Z-3.3905 F3000
+G1 X12.220 Y2.000 Z-3.3820 F3000
+G1 X12.240 Y2.000 Z-3.3736 F3000
+G1 X12.260 Y2.000 Z-3.3652 F3000
+G1 X12.280 Y2.000 Z-3.3568 F3000
+G1 X12.300 Y2.000 Z-3.3484 F3000
+G1 X12.320 Y2.000 Z-3.3401 F3000
+G1 X12.340 Y2.000 Z-3.3318 F3000
+G1 X12.360 Y2.000 Z-3.3235 F3000
+G1 X12.380 Y2.000 Z-3.3153 F3000
+G1 X12.400 Y2.000 Z-3.3070 F3000
+G1 X12.420 Y2.000 Z-3.2988 F3000
+G1 X12.440 Y2.000 Z-3.2906 F3000
+G1 X12.460 Y2.000 Z-3.2825 F3000
+G1 X12.480 Y2.000 Z-3.2744 F3000
+G1 X12.500 Y2.000 Z-3.2662 F3000
+G1 X12.520 Y2.000 Z-3.2582 F3000
+G1 X12.540 Y2.000 Z-3.2501 F3000
+G1 X12.560 Y2.000 Z-3.2421 F3000
+G1 X12.580 Y2.000 Z-3.2341 F3000
+G1 X12.600 Y2.000 Z-3.2261 F3000
+G1 X12.620 Y2.000 Z-3.2181 F3000
+G1 X12.640 Y2.000 Z-3.2102 F3000
+G1 X12.660 Y2.000 Z-3.2023 F3000
+G1 X12.680 Y2.000 Z-3.1944 F3000
+G1 X12.700 Y2.000 Z-3.1866 F3000
+G1 X12.720 Y2.000 Z-3.1787 F3000
+G1 X12.740 Y2.000 Z-3.1709 F3000
+G1 X12.760 Y2.000 Z-3.1631 F3000
+G1 X12.780 Y2.000 Z-3.1554 F3000
+G1 X12.800 Y2.000 Z-3.1477 F3000
+G1 X12.820 Y2.000 Z-3.1399 F3000
+G1 X12.840 Y2.000 Z-3.1323 F3000
+G1 X12.860 Y2.000 Z-3.1246 F3000
+G1 X12.880 Y2.000 Z-3.1170 F3000
+G1 X12.900 Y2.000 Z-3.1094 F3000
+G1 X12.920 Y2.000 Z-3.1018 F3000
+G1 X12.940 Y2.000 Z-3.0942 F3000
+G1 X12.960 Y2.000 Z-3.0867 F3000
+G1 X12.980 Y2.000 Z-3.0792 F3000
+G1 X13.000 Y2.000 Z-3.0717 F3000
+G1 X13.020 Y2.000 Z-3.0642 F3000
+G1 X13.040 Y2.000 Z-3.0568 F3000
+G1 X13.060 Y2.000 Z-3.0494 F3000
+G1 X13.080 Y2.000 Z-3.0420 F3000
+G1 X13.100 Y2.000 Z-3.0346 F3000
+G1 X13.120 Y2.000 Z-3.0273 F3000
+G1 X13.140 Y2.000 Z-3.0199 F3000
+G1 X13.160 Y2.000 Z-3.0127 F3000
+G1 X13.180 Y2.000 Z-3.0054 F3000
+G1 X13.200 Y2.000 Z-2.9981 F3000
+G1 X13.220 Y2.000 Z-2.9909 F3000
+G1 X13.240 Y2.000 Z-2.9837 F3000
+G1 X13.260 Y2.000 Z-2.9765 F3000
+G1 X13.280 Y2.000 Z-2.9694 F3000
+G1 X13.300 Y2.000 Z-2.9623 F3000
+G1 X13.320 Y2.000 Z-2.9552 F3000
+G1 X13.340 Y2.000 Z-2.9481 F3000
+G1 X13.360 Y2.000 Z-2.9410 F3000
+G1 X13.380 Y2.000 Z-2.9340 F3000
+G1 X13.400 Y2.000 Z-2.9270 F3000
+G1 X13.420 Y2.000 Z-2.9200 F3000
+G1 X13.440 Y2.000 Z-2.9131 F3000
+G1 X13.460 Y2.000 Z-2.9061 F3000
+G1 X13.480 Y2.000 Z-2.8992 F3000
+G1 X13.500 Y2.000 Z-2.8923 F3000
+G1 X13.520 Y2.000 Z-2.8855 F3000
+G1 X13.540 Y2.000 Z-2.8786 F3000
+G1 X13.560 Y2.000 Z-2.8718 F3000
+G1 X13.580 Y2.000 Z-2.8650 F3000
+G1 X13.600 Y2.000 Z-2.8582 F3000
+G1 X13.620 Y2.000 Z-2.8515 F3000
+G1 X13.640 Y2.000 Z-2.8448 F3000
+G1 X13.660 Y2.000 Z-2.8381 F3000
+G1 X13.680 Y2.000 Z-2.8314 F3000
+G1 X13.700 Y2.000 Z-2.8248 F3000
+G1 X13.720 Y2.000 Z-2.8181 F3000
+G1 X13.740 Y2.000 Z-2.8115 F3000
+G1 X13.760 Y2.000 Z-2.8049 F3000
+G1 X13.780 Y2.000 Z-2.7984 F3000
+G1 X13.800 Y2.000 Z-2.7918 F3000
+G1 X13.820 Y2.000 Z-2.7853 F3000
+G1 X13.840 Y2.000 Z-2.7788 F3000
+G1 X13.860 Y2.000 Z-2.7724 F3000
+G1 X13.880 Y2.000 Z-2.7659 F3000
+G1 X13.900 Y2.000 Z-2.7595 F3000
+G1 X13.920 Y2.000 Z-2.7531 F3000
+G1 X13.940 Y2.000 Z-2.7467 F3000
+G1 X13.960 Y2.000 Z-2.7404 F3000
+G1 X13.980 Y2.000 Z-2.7341 F3000
+G1 X14.000 Y2.000 Z-2.7278 F3000
+G1 X14.020 Y2.000 Z-2.7215 F3000
+G1 X14.040 Y2.000 Z-2.7152 F3000
+G1 X14.060 Y2.000 Z-2.7090 F3000
+G1 X14.080 Y2.000 Z-2.7028 F3000
+G1 X14.100 Y2.000 Z-2.6966 F3000
+G1 X14.120 Y2.000 Z-2.6904 F3000
+G1 X14.140 Y2.000 Z-2.6843 F3000
+G1 X14.160 Y2.000 Z-2.6782 F3000
+G1 X14.180 Y2.000 Z-2.6721 F3000
+G1 X14.200 Y2.000 Z-2.6660 F3000
+G1 X14.220 Y2.000 Z-2.6599 F3000
+G1 X14.240 Y2.000 Z-2.6539 F3000
+G1 X14.260 Y2.000 Z-2.6479 F3000
+G1 X14.280 Y2.000 Z-2.6419 F3000
+G1 X14.300 Y2.000 Z-2.6360 F3000
+G1 X14.320 Y2.000 Z-2.6300 F3000
+G1 X14.340 Y2.000 Z-2.6241 F3000
+G1 X14.360 Y2.000 Z-2.6182 F3000
+G1 X14.380 Y2.000 Z-2.6124 F3000
+G1 X14.400 Y2.000 Z-2.6065 F3000
+G1 X14.420 Y2.000 Z-2.6007 F3000
+G1 X14.440 Y2.000 Z-2.5949 F3000
+G1 X14.460 Y2.000 Z-2.5891 F3000
+G1 X14.480 Y2.000 Z-2.5834 F3000
+G1 X14.500 Y2.000 Z-2.5776 F3000
+G1 X14.520 Y2.000 Z-2.5719 F3000
+G1 X14.540 Y2.000 Z-2.5662 F3000
+G1 X14.560 Y2.000 Z-2.5606 F3000
+G1 X14.580 Y2.000 Z-2.5549 F3000
+G1 X14.600 Y2.000 Z-2.5493 F3000
+G1 X14.620 Y2.000 Z-2.5437 F3000
+G1 X14.640 Y2.000 Z-2.5381 F3000
+G1 X14.660 Y2.000 Z-2.5326 F3000
+G1 X14.680 Y2.000 Z-2.5270 F3000
+G1 X14.700 Y2.000 Z-2.5215 F3000
+G1 X14.720 Y2.000 Z-2.5160 F3000
+G1 X14.740 Y2.000 Z-2.5106 F3000
+G1 X14.760 Y2.000 Z-2.5051 F3000
+G1 X14.780 Y2.000 Z-2.4997 F3000
+G1 X14.800 Y2.000 Z-2.4943 F3000
+G1 X14.820 Y2.000 Z-2.4889 F3000
+G1 X14.840 Y2.000 Z-2.4836 F3000
+G1 X14.860 Y2.000 Z-2.4782 F3000
+G1 X14.880 Y2.000 Z-2.4729 F3000
+G1 X14.900 Y2.000 Z-2.4676 F3000
+G1 X14.920 Y2.000 Z-2.4624 F3000
+G1 X14.940 Y2.000 Z-2.4571 F3000
+G1 X14.960 Y2.000 Z-2.4519 F3000
+G1 X14.980 Y2.000 Z-2.4467 F3000
+G1 X15.000 Y2.000 Z-2.4415 F3000
+G1 X15.020 Y2.000 Z-2.4364 F3000
+G1 X15.040 Y2.000 Z-2.4313 F3000
+G1 X15.060 Y2.000 Z-2.4261 F3000
+G1 X15.080 Y2.000 Z-2.4211 F3000
+G1 X15.100 Y2.000 Z-2.4160 F3000
+G1 X15.120 Y2.000 Z-2.4109 F3000
+G1 X15.140 Y2.000 Z-2.4059 F3000
+G1 X15.160 Y2.000 Z-2.4009 F3000
+G1 X15.180 Y2.000 Z-2.3959 F3000
+G1 X15.200 Y2.000 Z-2.3910 F3000
+G1 X15.220 Y2.000 Z-2.3860 F3000
+G1 X15.240 Y2.000 Z-2.3811 F3000
+G1 X15.260 Y2.000 Z-2.3762 F3000
+G1 X15.280 Y2.000 Z-2.3714 F3000
+G1 X15.300 Y2.000 Z-2.3665 F3000
+G1 X15.320 Y2.000 Z-2.3617 F3000
+G1 X15.340 Y2.000 Z-2.3569 F3000
+G1 X15.360 Y2.000 Z-2.3521 F3000
+G1 X15.380 Y2.000 Z-2.3473 F3000
+G1 X15.400 Y2.000 Z-2.3426 F3000
+G1 X15.420 Y2.000 Z-2.3379 F3000
+G1 X15.440 Y2.000 Z-2.3332 F3000
+G1 X15.460 Y2.000 Z-2.3285 F3000
+G1 X15.480 Y2.000 Z-2.3239 F3000
+G1 X15.500 Y2.000 Z-2.3192 F3000
+G1 X15.520 Y2.000 Z-2.3146 F3000
+G1 X15.540 Y2.000 Z-2.3100 F3000
+G1 X15.560 Y2.000 Z-2.3055 F3000
+G1 X15.580 Y2.000 Z-2.3009 F3000
+G1 X15.600 Y2.000 Z-2.2964 F3000
+G1 X15.620 Y2.000 Z-2.2919 F3000
+G1 X15.640 Y2.000 Z-2.2874 F3000
+G1 X15.660 Y2.000 Z-2.2830 F3000
+G1 X15.680 Y2.000 Z-2.2785 F3000
+G1 X15.700 Y2.000 Z-2.2741 F3000
+G1 X15.720 Y2.000 Z-2.2697 F3000
+G1 X15.740 Y2.000 Z-2.2654 F3000
+G1 X15.760 Y2.000 Z-2.2610 F3000
+G1 X15.780 Y2.000 Z-2.2567 F3000
+G1 X15.800 Y2.000 Z-2.2524 F3000
+G1 X15.820 Y2.000 Z-2.2481 F3000
+G1 X15.840 Y2.000 Z-2.2438 F3000
+G1 X15.860 Y2.000 Z-2.2396 F3000
+G1 X15.880 Y2.000 Z-2.2353 F3000
+G1 X15.900 Y2.000 Z-2.2311 F3000
+G1 X15.920 Y2.000 Z-2.2270 F3000
+G1 X15.940 Y2.000 Z-2.2228 F3000
+G1 X15.960 Y2.000 Z-2.2187 F3000
+G1 X15.980 Y2.000 Z-2.2146 F3000
+G1 X16.000 Y2.000 Z-2.2105 F3000
+G1 X16.020 Y2.000 Z-2.2064 F3000
+G1 X16.040 Y2.000 Z-2.2023 F3000
+G1 X16.060 Y2.000 Z-2.1983 F3000
+G1 X16.080 Y2.000 Z-2.1943 F3000
+G1 X16.100 Y2.000 Z-2.1903 F3000
+G1 X16.120 Y2.000 Z-2.1863 F3000
+G1 X16.140 Y2.000 Z-2.1824 F3000
+G1 X16.160 Y2.000 Z-2.1785 F3000
+G1 X16.180 Y2.000 Z-2.1746 F3000
+G1 X16.200 Y2.000 Z-2.1707 F3000
+G1 X16.220 Y2.000 Z-2.1668 F3000
+G1 X16.240 Y2.000 Z-2.1630 F3000
+G1 X16.260 Y2.000 Z-2.1592 F3000
+G1 X16.280 Y2.000 Z-2.1554 F3000
+G1 X16.300 Y2.000 Z-2.1516 F3000
+G1 X16.320 Y2.000 Z-2.1478 F3000
+G1 X16.340 Y2.000 Z-2.1441 F3000
+G1 X16.360 Y2.000 Z-2.1404 F3000
+G1 X16.380 Y2.000 Z-2.1367 F3000
+G1 X16.400 Y2.000 Z-2.1330 F3000
+G1 X16.420 Y2.000 Z-2.1294 F3000
+G1 X16.440 Y2.000 Z-2.1257 F3000
+G1 X16.460 Y2.000 Z-2.1221 F3000
+G1 X16.480 Y2.000 Z-2.1185 F3000
+G1 X16.500 Y2.000 Z-2.1150 F3000
+G1 X16.520 Y2.000 Z-2.1114 F3000
+G1 X16.540 Y2.000 Z-2.1079 F3000
+G1 X16.560 Y2.000 Z-2.1044 F3000
+G1 X16.580 Y2.000 Z-2.1009 F3000
+G1 X16.600 Y2.000 Z-2.0975 F3000
+G1 X16.620 Y2.000 Z-2.0940 F3000
+G1 X16.640 Y2.000 Z-2.0906 F3000
+G1 X16.660 Y2.000 Z-2.0872 F3000
+G1 X16.680 Y2.000 Z-2.0838 F3000
+G1 X16.700 Y2.000 Z-2.0805 F3000
+G1 X16.720 Y2.000 Z-2.0771 F3000
+G1 X16.740 Y2.000 Z-2.0738 F3000
+G1 X16.760 Y2.000 Z-2.0705 F3000
+G1 X16.780 Y2.000 Z-2.0672 F3000
+G1 X16.800 Y2.000 Z-2.0640 F3000
+G1 X16.820 Y2.000 Z-2.0608 F3000
+G1 X16.840 Y2.000 Z-2.0575 F3000
+G1 X16.860 Y2.000 Z-2.0544 F3000
+G1 X16.880 Y2.000 Z-2.0512 F3000
+G1 X16.900 Y2.000 Z-2.0480 F3000
+G1 X16.920 Y2.000 Z-2.0449 F3000
+G1 X16.940 Y2.000 Z-2.0418 F3000
+G1 X16.960 Y2.000 Z-2.0387 F3000
+G1 X16.980 Y2.000 Z-2.0356 F3000
+G1 X17.000 Y2.000 Z-2.0326 F3000
+G1 X17.020 Y2.000 Z-2.0296 F3000
+G1 X17.040 Y2.000 Z-2.0266 F3000
+G1 X17.060 Y2.000 Z-2.0236 F3000
+G1 X17.080 Y2.000 Z-2.0206 F3000
+G1 X17.100 Y2.000 Z-2.0177 F3000
+G1 X17.120 Y2.000 Z-2.0148 F3000
+G1 X17.140 Y2.000 Z-2.0119 F3000
+G1 X17.160 Y2.000 Z-2.0090 F3000
+G1 X17.180 Y2.000 Z-2.0061 F3000
+G1 X17.200 Y2.000 Z-2.0033 F3000
+G1 X17.220 Y2.000 Z-2.0005 F3000
+G1 X17.240 Y2.000 Z-1.9977 F3000
+G1 X17.260 Y2.000 Z-1.9949 F3000
+G1 X17.280 Y2.000 Z-1.9921 F3000
+G1 X17.300 Y2.000 Z-1.9894 F3000
+G1 X17.320 Y2.000 Z-1.9867 F3000
+G1 X17.340 Y2.000 Z-1.9840 F3000
+G1 X17.360 Y2.000 Z-1.9813 F3000
+G1 X17.380 Y2.000 Z-1.9787 F3000
+G1 X17.400 Y2.000 Z-1.9760 F3000
+G1 X17.420 Y2.000 Z-1.9734 F3000
+G1 X17.440 Y2.000 Z-1.9708 F3000
+G1 X17.460 Y2.000 Z-1.9682 F3000
+G1 X17.480 Y2.000 Z-1.9657 F3000
+G1 X17.500 Y2.000 Z-1.9632 F3000
+G1 X17.520 Y2.000 Z-1.9607 F3000
+G1 X17.540 Y2.000 Z-1.9582 F3000
+G1 X17.560 Y2.000 Z-1.9557 F3000
+G1 X17.580 Y2.000 Z-1.9532 F3000
+G1 X17.600 Y2.000 Z-1.9508 F3000
+G1 X17.620 Y2.000 Z-1.9484 F3000
+G1 X17.640 Y2.000 Z-1.9460 F3000
+G1 X17.660 Y2.000 Z-1.9437 F3000
+G1 X17.680 Y2.000 Z-1.9413 F3000
+G1 X17.700 Y2.000 Z-1.9390 F3000
+G1 X17.720 Y2.000 Z-1.9367 F3000
+G1 X17.740 Y2.000 Z-1.9344 F3000
+G1 X17.760 Y2.000 Z-1.9321 F3000
+G1 X17.780 Y2.000 Z-1.9299 F3000
+G1 X17.800 Y2.000 Z-1.9277 F3000
+G1 X17.820 Y2.000 Z-1.9255 F3000
+G1 X17.840 Y2.000 Z-1.9233 F3000
+G1 X17.860 Y2.000 Z-1.9211 F3000
+G1 X17.880 Y2.000 Z-1.9190 F3000
+G1 X17.900 Y2.000 Z-1.9168 F3000
+G1 X17.920 Y2.000 Z-1.9147 F3000
+G1 X17.940 Y2.000 Z-1.9127 F3000
+G1 X17.960 Y2.000 Z-1.9106 F3000
+G1 X17.980 Y2.000 Z-1.9086 F3000
+G1 X18.000 Y2.000 Z-1.9065 F3000
+G1 X18.020 Y2.000 Z-1.9045 F3000
+G1 X18.040 Y2.000 Z-1.9026 F3000
+G1 X18.060 Y2.000 Z-1.9006 F3000
+G1 X18.080 Y2.000 Z-1.8987 F3000
+G1 X18.100 Y2.000 Z-1.8967 F3000
+G1 X18.120 Y2.000 Z-1.8948 F3000
+G1 X18.140 Y2.000 Z-1.8930 F3000
+G1 X18.160 Y2.000 Z-1.8911 F3000
+G1 X18.180 Y2.000 Z-1.8893 F3000
+G1 X18.200 Y2.000 Z-1.8874 F3000
+G1 X18.220 Y2.000 Z-1.8856 F3000
+G1 X18.240 Y2.000 Z-1.8839 F3000
+G1 X18.260 Y2.000 Z-1.8821 F3000
+G1 X18.280 Y2.000 Z-1.8804 F3000
+G1 X18.300 Y2.000 Z-1.8787 F3000
+G1 X18.320 Y2.000 Z-1.8770 F3000
+G1 X18.340 Y2.000 Z-1.8753 F3000
+G1 X18.360 Y2.000 Z-1.8736 F3000
+G1 X18.380 Y2.000 Z-1.8720 F3000
+G1 X18.400 Y2.000 Z-1.8704 F3000
+G1 X18.420 Y2.000 Z-1.8688 F3000
+G1 X18.440 Y2.000 Z-1.8672 F3000
+G1 X18.460 Y2.000 Z-1.8656 F3000
+G1 X18.480 Y2.000 Z-1.8641 F3000
+G1 X18.500 Y2.000 Z-1.8626 F3000
+G1 X18.520 Y2.000 Z-1.8611 F3000
+G1 X18.540 Y2.000 Z-1.8596 F3000
+G1 X18.560 Y2.000 Z-1.8582 F3000
+G1 X18.580 Y2.000 Z-1.8567 F3000
+G1 X18.600 Y2.000 Z-1.8553 F3000
+G1 X18.620 Y2.000 Z-1.8539 F3000
+G1 X18.640 Y2.000 Z-1.8526 F3000
+G1 X18.660 Y2.000 Z-1.8512 F3000
+G1 X18.680 Y2.000 Z-1.8499 F3000
+G1 X18.700 Y2.000 Z-1.8486 F3000
+G1 X18.720 Y2.000 Z-1.8473 F3000
+G1 X18.740 Y2.000 Z-1.8460 F3000
+G1 X18.760 Y2.000 Z-1.8447 F3000
+G1 X18.780 Y2.000 Z-1.8435 F3000
+G1 X18.800 Y2.000 Z-1.8423 F3000
+G1 X18.820 Y2.000 Z-1.8411 F3000
+G1 X18.840 Y2.000 Z-1.8399 F3000
+G1 X18.860 Y2.000 Z-1.8388 F3000
+G1 X18.880 Y2.000 Z-1.8376 F3000
+G1 X18.900 Y2.000 Z-1.8365 F3000
+G1 X18.920 Y2.000 Z-1.8354 F3000
+G1 X18.940 Y2.000 Z-1.8344 F3000
+G1 X18.960 Y2.000 Z-1.8333 F3000
+G1 X18.980 Y2.000 Z-1.8323 F3000
+G1 X19.000 Y2.000 Z-1.8313 F3000
+G1 X19.020 Y2.000 Z-1.8303 F3000
+G1 X19.040 Y2.000 Z-1.8293 F3000
+G1 X19.060 Y2.000 Z-1.8284 F3000
+G1 X19.080 Y2.000 Z-1.8274 F3000
+G1 X19.100 Y2.000 Z-1.8265 F3000
+G1 X19.120 Y2.000 Z-1.8256 F3000
+G1 X19.140 Y2.000 Z-1.8248 F3000
+G1 X19.160 Y2.000 Z-1.8239 F3000
+G1 X19.180 Y2.000 Z-1.8231 F3000
+G1 X19.200 Y2.000 Z-1.8223 F3000
+G1 X19.220 Y2.000 Z-1.8215 F3000
+G1 X19.240 Y2.000 Z-1.8207 F3000
+G1 X19.260 Y2.000 Z-1.8199 F3000
+G1 X19.280 Y2.000 Z-1.8192 F3000
+G1 X19.300 Y2.000 Z-1.8185 F3000
+G1 X19.320 Y2.000 Z-1.8178 F3000
+G1 X19.340 Y2.000 Z-1.8171 F3000
+G1 X19.360 Y2.000 Z-1.8165 F3000
+G1 X19.380 Y2.000 Z-1.8159 F3000
+G1 X19.400 Y2.000 Z-1.8153 F3000
+G1 X19.420 Y2.000 Z-1.8147 F3000
+G1 X19.440 Y2.000 Z-1.8141 F3000
+G1 X19.460 Y2.000 Z-1.8135 F3000
+G1 X19.480 Y2.000 Z-1.8130 F3000
+G1 X19.500 Y2.000 Z-1.8125 F3000
+G1 X19.520 Y2.000 Z-1.8120 F3000
+G1 X19.540 Y2.000 Z-1.8115 F3000
+G1 X19.560 Y2.000 Z-1.8111 F3000
+G1 X19.580 Y2.000 Z-1.8107 F3000
+G1 X19.600 Y2.000 Z-1.8103 F3000
+G1 X19.620 Y2.000 Z-1.8099 F3000
+G1 X19.640 Y2.000 Z-1.8095 F3000
+G1 X19.660 Y2.000 Z-1.8091 F3000
+G1 X19.680 Y2.000 Z-1.8088 F3000
+G1 X19.700 Y2.000 Z-1.8085 F3000
+G1 X19.720 Y2.000 Z-1.8082 F3000
+G1 X19.740 Y2.000 Z-1.8079 F3000
+G1 X19.760 Y2.000 Z-1.8077 F3000
+G1 X19.780 Y2.000 Z-1.8075 F3000
+G1 X19.800 Y2.000 Z-1.8073 F3000
+G1 X19.820 Y2.000 Z-1.8071 F3000
+G1 X19.840 Y2.000 Z-1.8069 F3000
+G1 X19.860 Y2.000 Z-1.8067 F3000
+G1 X19.880 Y2.000 Z-1.8066 F3000
+G1 X19.900 Y2.000 Z-1.8065 F3000
+G1 X19.920 Y2.000 Z-1.8064 F3000
+G1 X19.940 Y2.000 Z-1.8063 F3000
+G1 X19.960 Y2.000 Z-1.8063 F3000
+G1 X19.980 Y2.000 Z-1.8063 F3000
+G1 X20.000 Y2.000 Z-1.8063 F3000
+G1 X20.020 Y2.000 Z-1.8063 F3000
+G1 X20.040 Y2.000 Z-1.8063 F3000
+G1 X20.060 Y2.000 Z-1.8063 F3000
+G1 X20.080 Y2.000 Z-1.8064 F3000
+G1 X20.100 Y2.000 Z-1.8065 F3000
+G1 X20.120 Y2.000 Z-1.8066 F3000
+G1 X20.140 Y2.000 Z-1.8067 F3000
+G1 X20.160 Y2.000 Z-1.8069 F3000
+G1 X20.180 Y2.000 Z-1.8071 F3000
+G1 X20.200 Y2.000 Z-1.8073 F3000
+G1 X20.220 Y2.000 Z-1.8075 F3000
+G1 X20.240 Y2.000 Z-1.8077 F3000
+G1 X20.260 Y2.000 Z-1.8079 F3000
+G1 X20.280 Y2.000 Z-1.8082 F3000
+G1 X20.300 Y2.000 Z-1.8085 F3000
+G1 X20.320 Y2.000 Z-1.8088 F3000
+G1 X20.340 Y2.000 Z-1.8091 F3000
+G1 X20.360 Y2.000 Z-1.8095 F3000
+G1 X20.380 Y2.000 Z-1.8099 F3000
+G1 X20.400 Y2.000 Z-1.8103 F3000
+G1 X20.420 Y2.000 Z-1.8107 F3000
+G1 X20.440 Y2.000 Z-1.8111 F3000
+G1 X20.460 Y2.000 Z-1.8115 F3000
+G1 X20.480 Y2.000 Z-1.8120 F3000
+G1 X20.500 Y2.000 Z-1.8125 F3000
+G1 X20.520 Y2.000 Z-1.8130 F3000
+G1 X20.540 Y2.000 Z-1.8135 F3000
+G1 X20.560 Y2.000 Z-1.8141 F3000
+G1 X20.580 Y2.000 Z-1.8147 F3000
+G1 X20.600 Y2.000 Z-1.8153 F3000
+G1 X20.620 Y2.000 Z-1.8159 F3000
+G1 X20.640 Y2.000 Z-1.8165 F3000
+G1 X20.660 Y2.000 Z-1.8171 F3000
+G1 X20.680 Y2.000 Z-1.8178 F3000
+G1 X20.700 Y2.000 Z-1.8185 F3000
+G1 X20.720 Y2.000 Z-1.8192 F3000
+G1 X20.740 Y2.000 Z-1.8199 F3000
+G1 X20.760 Y2.000 Z-1.8207 F3000
+G1 X20.780 Y2.000 Z-1.8215 F3000
+G1 X20.800 Y2.000 Z-1.8223 F3000
+G1 X20.820 Y2.000 Z-1.8231 F3000
+G1 X20.840 Y2.000 Z-1.8239 F3000
+G1 X20.860 Y2.000 Z-1.8248 F3000
+G1 X20.880 Y2.000 Z-1.8256 F3000
+G1 X20.900 Y2.000 Z-1.8265 F3000
+G1 X20.920 Y2.000 Z-1.8274 F3000
+G1 X20.940 Y2.000 Z-1.8284 F3000
+G1 X20.960 Y2.000 Z-1.8293 F3000
+G1 X20.980 Y2.000 Z-1.8303 F3000
+G1 X21.000 Y2.000 Z-1.8313 F3000
+G1 X21.020 Y2.000 Z-1.8323 F3000
+G1 X21.040 Y2.000 Z-1.8333 F3000
+G1 X21.060 Y2.000 Z-1.8344 F3000
+G1 X21.080 Y2.000 Z-1.8354 F3000
+G1 X21.100 Y2.000 Z-1.8365 F3000
+G1 X21.120 Y2.000 Z-1.8376 F3000
+G1 X21.140 Y2.000 Z-1.8388 F3000
+G1 X21.160 Y2.000 Z-1.8399 F3000
+G1 X21.180 Y2.000 Z-1.8411 F3000
+G1 X21.200 Y2.000 Z-1.8423 F3000
+G1 X21.220 Y2.000 Z-1.8435 F3000
+G1 X21.240 Y2.000 Z-1.8447 F3000
+G1 X21.260 Y2.000 Z-1.8460 F3000
+G1 X21.280 Y2.000 Z-1.8473 F3000
+G1 X21.300 Y2.000 Z-1.8486 F3000
+G1 X21.320 Y2.000 Z-1.8499 F3000
+G1 X21.340 Y2.000 Z-1.8512 F3000
+G1 X21.360 Y2.000 Z-1.8526 F3000
+G1 X21.380 Y2.000 Z-1.8539 F3000
+G1 X21.400 Y2.000 Z-1.8553 F3000
+G1 X21.420 Y2.000 Z-1.8567 F3000
+G1 X21.440 Y2.000 Z-1.8582 F3000
+G1 X21.460 Y2.000 Z-1.8596 F3000
+G1 X21.480 Y2.000 Z-1.8611 F3000
+G1 X21.500 Y2.000 Z-1.8626 F3000
+G1 X21.520 Y2.000 Z-1.8641 F3000
+G1 X21.540 Y2.000 Z-1.8656 F3000
+G1 X21.560 Y2.000 Z-1.8672 F3000
+G1 X21.580 Y2.000 Z-1.8688 F3000
+G1 X21.600 Y2.000 Z-1.8704 F3000
+G1 X21.620 Y2.000 Z-1.8720 F3000
+G1 X21.640 Y2.000 Z-1.8736 F3000
+G1 X21.660 Y2.000 Z-1.8753 F3000
+G1 X21.680 Y2.000 Z-1.8770 F3000
+G1 X21.700 Y2.000 Z-1.8787 F3000
+G1 X21.720 Y2.000 Z-1.8804 F3000
+G1 X21.740 Y2.000 Z-1.8821 F3000
+G1 X21.760 Y2.000 Z-1.8839 F3000
+G1 X21.780 Y2.000 Z-1.8856 F3000
+G1 X21.800 Y2.000 Z-1.8874 F3000
+G1 X21.820 Y2.000 Z-1.8893 F3000
+G1 X21.840 Y2.000 Z-1.8911 F3000
+G1 X21.860 Y2.000 Z-1.8930 F3000
+G1 X21.880 Y2.000 Z-1.8948 F3000
+G1 X21.900 Y2.000 Z-1.8967 F3000
+G1 X21.920 Y2.000 Z-1.8987 F3000
+G1 X21.940 Y2.000 Z-1.9006 F3000
+G1 X21.960 Y2.000 Z-1.9026 F3000
+G1 X21.980 Y2.000 Z-1.9045 F3000
+G1 X22.000 Y2.000 Z-1.9065 F3000
+G1 X22.020 Y2.000 Z-1.9086 F3000
+G1 X22.040 Y2.000 Z-1.9106 F3000
+G1 X22.060 Y2.000 Z-1.9127 F3000
+G1 X22.080 Y2.000 Z-1.9147 F3000
+G1 X22.100 Y2.000 Z-1.9168 F3000
+G1 X22.120 Y2.000 Z-1.9190 F3000
+G1 X22.140 Y2.000 Z-1.9211 F3000
+G1 X22.160 Y2.000 Z-1.9233 F3000
+G1 X22.180 Y2.000 Z-1.9255 F3000
+G1 X22.200 Y2.000 Z-1.9277 F3000
+G1 X22.220 Y2.000 Z-1.9299 F3000
+G1 X22.240 Y2.000 Z-1.9321 F3000
+G1 X22.260 Y2.000 Z-1.9344 F3000
+G1 X22.280 Y2.000 Z-1.9367 F3000
+G1 X22.300 Y2.000 Z-1.9390 F3000
+G1 X22.320 Y2.000 Z-1.9413 F3000
+G1 X22.340 Y2.000 Z-1.9437 F3000
+G1 X22.360 Y2.000 Z-1.9460 F3000
+G1 X22.380 Y2.000 Z-1.9484 F3000
+G1 X22.400 Y2.000 Z-1.9508 F3000
+G1 X22.420 Y2.000 Z-1.9532 F3000
+G1 X22.440 Y2.000 Z-1.9557 F3000
+G1 X22.460 Y2.000 Z-1.9582 F3000
+G1 X22.480 Y2.000 Z-1.9607 F3000
+G1 X22.500 Y2.000 Z-1.9632 F3000
+G1 X22.520 Y2.000 Z-1.9657 F3000
+G1 X22.540 Y2.000 Z-1.9682 F3000
+G1 X22.560 Y2.000 Z-1.9708 F3000
+G1 X22.580 Y2.000 Z-1.9734 F3000
+G1 X22.600 Y2.000 Z-1.9760 F3000
+G1 X22.620 Y2.000 Z-1.9787 F3000
+G1 X22.640 Y2.000 Z-1.9813 F3000
+G1 X22.660 Y2.000 Z-1.9840 F3000
+G1 X22.680 Y2.000 Z-1.9867 F3000
+G1 X22.700 Y2.000 Z-1.9894 F3000
+G1 X22.720 Y2.000 Z-1.9921 F3000
+G1 X22.740 Y2.000 Z-1.9949 F3000
+G1 X22.760 Y2.000 Z-1.9977 F3000
+G1 X22.780 Y2.000 Z-2.0005 F3000
+G1 X22.800 Y2.000 Z-2.0033 F3000
+G1 X22.820 Y2.000 Z-2.0061 F3000
+G1 X22.840 Y2.000 Z-2.0090 F3000
+G1 X22.860 Y2.000 Z-2.0119 F3000
+G1 X22.880 Y2.000 Z-2.0148 F3000
+G1 X22.900 Y2.000 Z-2.0177 F3000
+G1 X22.920 Y2.000 Z-2.0206 F3000
+G1 X22.940 Y2.000 Z-2.0236 F3000
+G1 X22.960 Y2.000 Z-2.0266 F3000
+G1 X22.980 Y2.000 Z-2.0296 F3000
+G1 X23.000 Y2.000 Z-2.0326 F3000
+G1 X23.020 Y2.000 Z-2.0356 F3000
+G1 X23.040 Y2.000 Z-2.0387 F3000
+G1 X23.060 Y2.000 Z-2.0418 F3000
+G1 X23.080 Y2.000 Z-2.0449 F3000
+G1 X23.100 Y2.000 Z-2.0480 F3000
+G1 X23.120 Y2.000 Z-2.0512 F3000
+G1 X23.140 Y2.000 Z-2.0544 F3000
+G1 X23.160 Y2.000 Z-2.0575 F3000
+G1 X23.180 Y2.000 Z-2.0608 F3000
+G1 X23.200 Y2.000 Z-2.0640 F3000
+G1 X23.220 Y2.000 Z-2.0672 F3000
+G1 X23.240 Y2.000 Z-2.0705 F3000
+G1 X23.260 Y2.000 Z-2.0738 F3000
+G1 X23.280 Y2.000 Z-2.0771 F3000
+G1 X23.300 Y2.000 Z-2.0805 F3000
+G1 X23.320 Y2.000 Z-2.0838 F3000
+G1 X23.340 Y2.000 Z-2.0872 F3000
+G1 X23.360 Y2.000 Z-2.0906 F3000
+G1 X23.380 Y2.000 Z-2.0940 F3000
+G1 X23.400 Y2.000 Z-2.0975 F3000
+G1 X23.420 Y2.000 Z-2.1009 F3000
+G1 X23.440 Y2.000 Z-2.1044 F3000
+G1 X23.460 Y2.000 Z-2.1079 F3000
+G1 X23.480 Y2.000 Z-2.1114 F3000
+G1 X23.500 Y2.000 Z-2.1150 F3000
+G1 X23.520 Y2.000 Z-2.1185 F3000
+G1 X23.540 Y2.000 Z-2.1221 F3000
+G1 X23.560 Y2.000 Z-2.1257 F3000
+G1 X23.580 Y2.000 Z-2.1294 F3000
+G1 X23.600 Y2.000 Z-2.1330 F3000
+G1 X23.620 Y2.000 Z-2.1367 F3000
+G1 X23.640 Y2.000 Z-2.1404 F3000
+G1 X23.660 Y2.000 Z-2.1441 F3000
+G1 X23.680 Y2.000 Z-2.1478 F3000
+G1 X23.700 Y2.000 Z-2.1516 F3000
+G1 X23.720 Y2.000 Z-2.1554 F3000
+G1 X23.740 Y2.000 Z-2.1592 F3000
+G1 X23.760 Y2.000 Z-2.1630 F3000
+G1 X23.780 Y2.000 Z-2.1668 F3000
+G1 X23.800 Y2.000 Z-2.1707 F3000
+G1 X23.820 Y2.000 Z-2.1746 F3000
+G1 X23.840 Y2.000 Z-2.1785 F3000
+G1 X23.860 Y2.000 Z-2.1824 F3000
+G1 X23.880 Y2.000 Z-2.1863 F3000
+G1 X23.900 Y2.000 Z-2.1903 F3000
+G1 X23.920 Y2.000 Z-2.1943 F3000
+G1 X23.940 Y2.000 Z-2.1983 F3000
+G1 X23.960 Y2.000 Z-2.2023 F3000
+G1 X23.980 Y2.000 Z-2.2064 F3000
+G1 X24.000 Y2.000 Z-2.2105 F3000
+G1 X24.020 Y2.000 Z-2.2146 F3000
+G1 X24.040 Y2.000 Z-2.2187 F3000
+G1 X24.060 Y2.000 Z-2.2228 F3000
+G1 X24.080 Y2.000 Z-2.2270 F3000
+G1 X24.100 Y2.000 Z-2.2311 F3000
+G1 X24.120 Y2.000 Z-2.2353 F3000
+G1 X24.140 Y2.000 Z-2.2396 F3000
+G1 X24.160 Y2.000 Z-2.2438 F3000
+G1 X24.180 Y2.000 Z-2.2481 F3000
+G1 X24.200 Y2.000 Z-2.2524 F3000
+G1 X24.220 Y2.000 Z-2.2567 F3000
+G1 X24.240 Y2.000 Z-2.2610 F3000
+G1 X24.260 Y2.000 Z-2.2654 F3000
+G1 X24.280 Y2.000 Z-2.2697 F3000
+G1 X24.300 Y2.000 Z-2.2741 F3000
+G1 X24.320 Y2.000 Z-2.2785 F3000
+G1 X24.340 Y2.000 Z-2.2830 F3000
+G1 X24.360 Y2.000 Z-2.2874 F3000
+G1 X24.380 Y2.000 Z-2.2919 F3000
+G1 X24.400 Y2.000 Z-2.2964 F3000
+G1 X24.420 Y2.000 Z-2.3009 F3000
+G1 X24.440 Y2.000 Z-2.3055 F3000
+G1 X24.460 Y2.000 Z-2.3100 F3000
+G1 X24.480 Y2.000 Z-2.3146 F3000
+G1 X24.500 Y2.000 Z-2.3192 F3000
+G1 X24.520 Y2.000 Z-2.3239 F3000
+G1 X24.540 Y2.000 Z-2.3285 F3000
+G1 X24.560 Y2.000 Z-2.3332 F3000
+G1 X24.580 Y2.000 Z-2.3379 F3000
+G1 X24.600 Y2.000 Z-2.3426 F3000
+G1 X24.620 Y2.000 Z-2.3473 F3000
+G1 X24.640 Y2.000 Z-2.3521 F3000
+G1 X24.660 Y2.000 Z-2.3569 F3000
+G1 X24.680 Y2.000 Z-2.3617 F3000
+G1 X24.700 Y2.000 Z-2.3665 F3000
+G1 X24.720 Y2.000 Z-2.3714 F3000
+G1 X24.740 Y2.000 Z-2.3762 F3000
+G1 X24.760 Y2.000 Z-2.3811 F3000
+G1 X24.780 Y2.000 Z-2.3860 F3000
+G1 X24.800 Y2.000 Z-2.3910 F3000
+G1 X24.820 Y2.000 Z-2.3959 F3000
+G1 X24.840 Y2.000 Z-2.4009 F3000
+G1 X24.860 Y2.000 Z-2.4059 F3000
+G1 X24.880 Y2.000 Z-2.4109 F3000
+G1 X24.900 Y2.000 Z-2.4160 F3000
+G1 X24.920 Y2.000 Z-2.4211 F3000
+G1 X24.940 Y2.000 Z-2.4261 F3000
+G1 X24.960 Y2.000 Z-2.4313 F3000
+G1 X24.980 Y2.000 Z-2.4364 F3000
+G1 X25.000 Y2.000 Z-2.4415 F3000
+G1 X25.020 Y2.000 Z-2.4467 F3000
+G1 X25.040 Y2.000 Z-2.4519 F3000
+G1 X25.060 Y2.000 Z-2.4571 F3000
+G1 X25.080 Y2.000 Z-2.4624 F3000
+G1 X25.100 Y2.000 Z-2.4676 F3000
+G1 X25.120 Y2.000 Z-2.4729 F3000
+G1 X25.140 Y2.000 Z-2.4782 F3000
+G1 X25.160 Y2.000 Z-2.4836 F3000
+G1 X25.180 Y2.000 Z-2.4889 F3000
+G1 X25.200 Y2.000 Z-2.4943 F3000
+G1 X25.220 Y2.000 Z-2.4997 F3000
+G1 X25.240 Y2.000 Z-2.5051 F3000
+G1 X25.260 Y2.000 Z-2.5106 F3000
+G1 X25.280 Y2.000 Z-2.5160 F3000
+G1 X25.300 Y2.000 Z-2.5215 F3000
+G1 X25.320 Y2.000 Z-2.5270 F3000
+G1 X25.340 Y2.000 Z-2.5326 F3000
+G1 X25.360 Y2.000 Z-2.5381 F3000
+G1 X25.380 Y2.000 Z-2.5437 F3000
+G1 X25.400 Y2.000 Z-2.5493 F3000
+G1 X25.420 Y2.000 Z-2.5549 F3000
+G1 X25.440 Y2.000 Z-2.5606 F3000
+G1 X25.460 Y2.000 Z-2.5662 F3000
+G1 X25.480 Y2.000 Z-2.5719 F3000
+G1 X25.500 Y2.000 Z-2.5776 F3000
+G1 X25.520 Y2.000 Z-2.5834 F3000
+G1 X25.540 Y2.000 Z-2.5891 F3000
+G1 X25.560 Y2.000 Z-2.5949 F3000
+G1 X25.580 Y2.000 Z-2.6007 F3000
+G1 X25.600 Y2.000 Z-2.6065 F3000
+G1 X25.620 Y2.000 Z-2.6124 F3000
+G1 X25.640 Y2.000 Z-2.6182 F3000
+G1 X25.660 Y2.000 Z-2.6241 F3000
+G1 X25.680 Y2.000 Z-2.6300 F3000
+G1 X25.700 Y2.000 Z-2.6360 F3000
+G1 X25.720 Y2.000 Z-2.6419 F3000
+G1 X25.740 Y2.000 Z-2.6479 F3000
+G1 X25.760 Y2.000 Z-2.6539 F3000
+G1 X25.780 Y2.000 Z-2.6599 F3000
+G1 X25.800 Y2.000 Z-2.6660 F3000
+G1 X25.820 Y2.000 Z-2.6721 F3000
+G1 X25.840 Y2.000 Z-2.6782 F3000
+G1 X25.860 Y2.000 Z-2.6843 F3000
+G1 X25.880 Y2.000 Z-2.6904 F3000
+G1 X25.900 Y2.000 Z-2.6966 F3000
+G1 X25.920 Y2.000 Z-2.7028 F3000
+G1 X25.940 Y2.000 Z-2.7090 F3000
+G1 X25.960 Y2.000 Z-2.7152 F3000
+G1 X25.980 Y2.000 Z-2.7215 F3000
+G1 X26.000 Y2.000 Z-2.7278 F3000
+G1 X26.020 Y2.000 Z-2.7341 F3000
+G1 X26.040 Y2.000 Z-2.7404 F3000
+G1 X26.060 Y2.000 Z-2.7467 F3000
+G1 X26.080 Y2.000 Z-2.7531 F3000
+G1 X26.100 Y2.000 Z-2.7595 F3000
+G1 X26.120 Y2.000 Z-2.7659 F3000
+G1 X26.140 Y2.000 Z-2.7724 F3000
+G1 X26.160 Y2.000 Z-2.7788 F3000
+G1 X26.180 Y2.000 Z-2.7853 F3000
+G1 X26.200 Y2.000 Z-2.7918 F3000
+G1 X26.220 Y2.000 Z-2.7984 F3000
+G1 X26.240 Y2.000 Z-2.8049 F3000
+G1 X26.260 Y2.000 Z-2.8115 F3000
+G1 X26.280 Y2.000 Z-2.8181 F3000
+G1 X26.300 Y2.000 Z-2.8248 F3000
+G1 X26.320 Y2.000 Z-2.8314 F3000
+G1 X26.340 Y2.000 Z-2.8381 F3000
+G1 X26.360 Y2.000 Z-2.8448 F3000
+G1 X26.380 Y2.000 Z-2.8515 F3000
+G1 X26.400 Y2.000 Z-2.8582 F3000
+G1 X26.420 Y2.000 Z-2.8650 F3000
+G1 X26.440 Y2.000 Z-2.8718 F3000
+G1 X26.460 Y2.000 Z-2.8786 F3000
+G1 X26.480 Y2.000 Z-2.8855 F3000
+G1 X26.500 Y2.000 Z-2.8923 F3000
+G1 X26.520 Y2.000 Z-2.8992 F3000
+G1 X26.540 Y2.000 Z-2.9061 F3000
+G1 X26.560 Y2.000 Z-2.9131 F3000
+G1 X26.580 Y2.000 Z-2.9200 F3000
+G1 X26.600 Y2.000 Z-2.9270 F3000
+G1 X26.620 Y2.000 Z-2.9340 F3000
+G1 X26.640 Y2.000 Z-2.9410 F3000
+G1 X26.660 Y2.000 Z-2.9481 F3000
+G1 X26.680 Y2.000 Z-2.9552 F3000
+G1 X26.700 Y2.000 Z-2.9623 F3000
+G1 X26.720 Y2.000 Z-2.9694 F3000
+G1 X26.740 Y2.000 Z-2.9765 F3000
+G1 X26.760 Y2.000 Z-2.9837 F3000
+G1 X26.780 Y2.000 Z-2.9909 F3000
+G1 X26.800 Y2.000 Z-2.9981 F3000
+G1 X26.820 Y2.000 Z-3.0054 F3000
+G1 X26.840 Y2.000 Z-3.0127 F3000
+G1 X26.860 Y2.000 Z-3.0199 F3000
+G1 X26.880 Y2.000 Z-3.0273 F3000
+G1 X26.900 Y2.000 Z-3.0346 F3000
+G1 X26.920 Y2.000 Z-3.0420 F3000
+G1 X26.940 Y2.000 Z-3.0494 F3000
+G1 X26.960 Y2.000 Z-3.0568 F3000
+G1 X26.980 Y2.000 Z-3.0642 F3000
+G1 X27.000 Y2.000 Z-3.0717 F3000
+G1 X27.020 Y2.000 Z-3.0792 F3000
+G1 X27.040 Y2.000 Z-3.0867 F3000
+G1 X27.060 Y2.000 Z-3.0942 F3000
+G1 X27.080 Y2.000 Z-3.1018 F3000
+G1 X27.100 Y2.000 Z-3.1094 F3000
+G1 X27.120 Y2.000 Z-3.1170 F3000
+G1 X27.140 Y2.000 Z-3.1246 F3000
+G1 X27.160 Y2.000 Z-3.1323 F3000
+G1 X27.180 Y2.000 Z-3.1399 F3000
+G1 X27.200 Y2.000 Z-3.1477 F3000
+G1 X27.220 Y2.000 Z-3.1554 F3000
+G1 X27.240 Y2.000 Z-3.1631 F3000
+G1 X27.260 Y2.000 Z-3.1709 F3000
+G1 X27.280 Y2.000 Z-3.1787 F3000
+G1 X27.300 Y2.000 Z-3.1866 F3000
+G1 X27.320 Y2.000 Z-3.1944 F3000
+G1 X27.340 Y2.000 Z-3.2023 F3000
+G1 X27.360 Y2.000 Z-3.2102 F3000
+G1 X27.380 Y2.000 Z-3.2181 F3000
+G1 X27.400 Y2.000 Z-3.2261 F3000
+G1 X27.420 Y2.000 Z-3.2341 F3000
+G1 X27.440 Y2.000 Z-3.2421 F3000
+G1 X27.460 Y2.000 Z-3.2501 F3000
+G1 X27.480 Y2.000 Z-3.2582 F3000
+G1 X27.500 Y2.000 Z-3.2662 F3000
+G1 X27.520 Y2.000 Z-3.2744 F3000
+G1 X27.540 Y2.000 Z-3.2825 F3000
+G1 X27.560 Y2.000 Z-3.2906 F3000
+G1 X27.580 Y2.000 Z-3.2988 F3000
+G1 X27.600 Y2.000 Z-3.3070 F3000
+G1 X27.620 Y2.000 Z-3.3153 F3000
+G1 X27.640 Y2.000 Z-3.3235 F3000
+G1 X27.660 Y2.000 Z-3.3318 F3000
+G1 X27.680 Y2.000 Z-3.3401 F3000
+G1 X27.700 Y2.000 Z-3.3484 F3000
+G1 X27.720 Y2.000 Z-3.3568 F3000
+G1 X27.740 Y2.000 Z-3.3652 F3000
+G1 X27.760 Y2.000 Z-3.3736 F3000
+G1 X27.780 Y2.000 Z-3.3820 F3000
+G1 X27.800 Y2.000 Z-3.3905 F3000
+G1 X27.820 Y2.000 Z-3.3990 F3000
+G1 X27.840 Y2.000 Z-3.4075 F3000
+G1 X27.860 Y2.000 Z-3.4160 F3000
+G1 X27.880 Y2.000 Z-3.4246 F3000
+G1 X27.900 Y2.000 Z-3.4332 F3000
+G1 X27.920 Y2.000 Z-3.4418 F3000
+G1 X27.940 Y2.000 Z-3.4504 F3000
+G1 X27.960 Y2.000 Z-3.4591 F3000
+G1 X27.980 Y2.000 Z-3.4678 F3000
+G1 X28.000 Y2.000 Z-3.4765 F3000
+G1 X28.020 Y2.000 Z-3.4853 F3000
+G1 X28.040 Y2.000 Z-3.4940 F3000
+G1 X28.060 Y2.000 Z-3.5028 F3000
+G1 X28.080 Y2.000 Z-3.5117 F3000
+G1 X28.100 Y2.000 Z-3.5205 F3000
+G1 X28.120 Y2.000 Z-3.5294 F3000
+G1 X28.140 Y2.000 Z-3.5383 F3000
+G1 X28.160 Y2.000 Z-3.5472 F3000
+G1 X28.180 Y2.000 Z-3.5562 F3000
+G1 X28.200 Y2.000 Z-3.5651 F3000
+G1 X28.220 Y2.000 Z-3.5742 F3000
+G1 X28.240 Y2.000 Z-3.5832 F3000
+G1 X28.260 Y2.000 Z-3.5922 F3000
+G1 X28.280 Y2.000 Z-3.6013 F3000
+G1 X28.300 Y2.000 Z-3.6104 F3000
+G1 X28.320 Y2.000 Z-3.6196 F3000
+G1 X28.340 Y2.000 Z-3.6287 F3000
+G1 X28.360 Y2.000 Z-3.6379 F3000
+G1 X28.380 Y2.000 Z-3.6472 F3000
+G1 X28.400 Y2.000 Z-3.6564 F3000
+G1 X28.420 Y2.000 Z-3.6657 F3000
+G1 X28.440 Y2.000 Z-3.6750 F3000
+G1 X28.460 Y2.000 Z-3.6843 F3000
+G1 X28.480 Y2.000 Z-3.6937 F3000
+G1 X28.500 Y2.000 Z-3.7030 F3000
+G1 X28.520 Y2.000 Z-3.7124 F3000
+G1 X28.540 Y2.000 Z-3.7219 F3000
+G1 X28.560 Y2.000 Z-3.7313 F3000
+G1 X28.580 Y2.000 Z-3.7408 F3000
+G1 X28.600 Y2.000 Z-3.7503 F3000
+G1 X28.620 Y2.000 Z-3.7599 F3000
+G1 X28.640 Y2.000 Z-3.7695 F3000
+G1 X28.660 Y2.000 Z-3.7791 F3000
+G1 X28.680 Y2.000 Z-3.7887 F3000
+G1 X28.700 Y2.000 Z-3.7983 F3000
+G1 X28.720 Y2.000 Z-3.8080 F3000
+G1 X28.740 Y2.000 Z-3.8177 F3000
+G1 X28.760 Y2.000 Z-3.8275 F3000
+G1 X28.780 Y2.000 Z-3.8372 F3000
+G1 X28.800 Y2.000 Z-3.8470 F3000
+G1 X28.820 Y2.000 Z-3.8568 F3000
+G1 X28.840 Y2.000 Z-3.8667 F3000
+G1 X28.860 Y2.000 Z-3.8765 F3000
+G1 X28.880 Y2.000 Z-3.8864 F3000
+G1 X28.900 Y2.000 Z-3.8964 F3000
+G1 X28.920 Y2.000 Z-3.9063 F3000
+G1 X28.940 Y2.000 Z-3.9163 F3000
+G1 X28.960 Y2.000 Z-3.9263 F3000
+G1 X28.980 Y2.000 Z-3.9364 F3000
+G1 X29.000 Y2.000 Z-3.9464 F3000
+G1 X29.020 Y2.000 Z-3.9565 F3000
+G1 X29.040 Y2.000 Z-3.9666 F3000
+G1 X29.060 Y2.000 Z-3.9768 F3000
+G1 X29.080 Y2.000 Z-3.9870 F3000
+G1 X29.100 Y2.000 Z-3.9972 F3000
+G1 X29.120 Y2.000 Z-4.0074 F3000
+G1 X29.140 Y2.000 Z-4.0177 F3000
+G1 X29.160 Y2.000 Z-4.0280 F3000
+G1 X29.180 Y2.000 Z-4.0383 F3000
+G1 X29.200 Y2.000 Z-4.0487 F3000
+G1 X29.220 Y2.000 Z-4.0590 F3000
+G1 X29.240 Y2.000 Z-4.0695 F3000
+G1 X29.260 Y2.000 Z-4.0799 F3000
+G1 X29.280 Y2.000 Z-4.0904 F3000
+G1 X29.300 Y2.000 Z-4.1008 F3000
+G1 X29.320 Y2.000 Z-4.1114 F3000
+G1 X29.340 Y2.000 Z-4.1219 F3000
+G1 X29.360 Y2.000 Z-4.1325 F3000
+G1 X29.380 Y2.000 Z-4.1431 F3000
+G1 X29.400 Y2.000 Z-4.1538 F3000
+G1 X29.420 Y2.000 Z-4.1644 F3000
+G1 X29.440 Y2.000 Z-4.1751 F3000
+G1 X29.460 Y2.000 Z-4.1858 F3000
+G1 X29.480 Y2.000 Z-4.1966 F3000
+G1 X29.500 Y2.000 Z-4.2074 F3000
+G1 X29.520 Y2.000 Z-4.2182 F3000
+G1 X29.540 Y2.000 Z-4.2290 F3000
+G1 X29.560 Y2.000 Z-4.2399 F3000
+G1 X29.580 Y2.000 Z-4.2508 F3000
+G1 X29.600 Y2.000 Z-4.2618 F3000
+G1 X29.620 Y2.000 Z-4.2727 F3000
+G1 X29.640 Y2.000 Z-4.2837 F3000
+G1 X29.660 Y2.000 Z-4.2947 F3000
+G1 X29.680 Y2.000 Z-4.3058 F3000
+G1 X29.700 Y2.000 Z-4.3169 F3000
+G1 X29.720 Y2.000 Z-4.3280 F3000
+G1 X29.740 Y2.000 Z-4.3391 F3000
+G1 X29.760 Y2.000 Z-4.3503 F3000
+G1 X29.780 Y2.000 Z-4.3615 F3000
+G1 X29.800 Y2.000 Z-4.3727 F3000
+G1 X29.820 Y2.000 Z-4.3840 F3000
+G1 X29.840 Y2.000 Z-4.3953 F3000
+G1 X29.860 Y2.000 Z-4.4066 F3000
+G1 X29.880 Y2.000 Z-4.4180 F3000
+G1 X29.900 Y2.000 Z-4.4293 F3000
+G1 X29.920 Y2.000 Z-4.4407 F3000
+G1 X29.940 Y2.000 Z-4.4522 F3000
+G1 X29.960 Y2.000 Z-4.4637 F3000
+G1 X29.980 Y2.000 Z-4.4752 F3000
+G1 X30.000 Y2.000 Z-4.4867 F3000
+G1 X30.020 Y2.000 Z-4.4983 F3000
+G1 X30.040 Y2.000 Z-4.5099 F3000
+G1 X30.060 Y2.000 Z-4.5215 F3000
+G1 X30.080 Y2.000 Z-4.5332 F3000
+G1 X30.100 Y2.000 Z-4.5449 F3000
+G1 X30.120 Y2.000 Z-4.5566 F3000
+G1 X30.140 Y2.000 Z-4.5683 F3000
+G1 X30.160 Y2.000 Z-4.5801 F3000
+G1 X30.180 Y2.000 Z-4.5919 F3000
+G1 X30.200 Y2.000 Z-4.6038 F3000
+G1 X30.220 Y2.000 Z-4.6157 F3000
+G1 X30.240 Y2.000 Z-4.6276 F3000
+G1 X30.260 Y2.000 Z-4.6395 F3000
+G1 X30.280 Y2.000 Z-4.6515 F3000
+G1 X30.300 Y2.000 Z-4.6635 F3000
+G1 X30.320 Y2.000 Z-4.6755 F3000
+G1 X30.340 Y2.000 Z-4.6876 F3000
+G1 X30.360 Y2.000 Z-4.6997 F3000
+G1 X30.380 Y2.000 Z-4.7118 F3000
+G1 X30.400 Y2.000 Z-4.7240 F3000
+G1 X30.420 Y2.000 Z-4.7362 F3000
+G1 X30.440 Y2.000 Z-4.7484 F3000
+G1 X30.460 Y2.000 Z-4.7607 F3000
+G1 X30.480 Y2.000 Z-4.7730 F3000
+G1 X30.500 Y2.000 Z-4.7853 F3000
+G1 X30.520 Y2.000 Z-4.7977 F3000
+G1 X30.540 Y2.000 Z-4.8101 F3000
+G1 X30.560 Y2.000 Z-4.8225 F3000
+G1 X30.580 Y2.000 Z-4.8349 F3000
+G1 X30.600 Y2.000 Z-4.8474 F3000
+G1 X30.620 Y2.000 Z-4.8599 F3000
+G1 X30.640 Y2.000 Z-4.8725 F3000
+G1 X30.660 Y2.000 Z-4.8851 F3000
+G1 X30.680 Y2.000 Z-4.8977 F3000
+G1 X30.700 Y2.000 Z-4.9104 F3000
+G1 X30.720 Y2.000 Z-4.9230 F3000
+G1 X30.740 Y2.000 Z-4.9358 F3000
+G1 X30.760 Y2.000 Z-4.9485 F3000
+G1 X30.780 Y2.000 Z-4.9613 F3000
+G1 X30.800 Y2.000 Z-4.9741 F3000
+G1 X30.820 Y2.000 Z-4.9870 F3000
+G1 X30.840 Y2.000 Z-4.9999 F3000
+G1 X30.860 Y2.000 Z-5.0128 F3000
+G1 X30.880 Y2.000 Z-5.0257 F3000
+G1 X30.900 Y2.000 Z-5.0387 F3000
+G1 X30.920 Y2.000 Z-5.0518 F3000
+G1 X30.940 Y2.000 Z-5.0648 F3000
+G1 X30.960 Y2.000 Z-5.0779 F3000
+G1 X30.980 Y2.000 Z-5.0910 F3000
+G1 X31.000 Y2.000 Z-5.1042 F3000
+G1 X31.020 Y2.000 Z-5.1174 F3000
+G1 X31.040 Y2.000 Z-5.1306 F3000
+G1 X31.060 Y2.000 Z-5.1439 F3000
+G1 X31.080 Y2.000 Z-5.1572 F3000
+G1 X31.100 Y2.000 Z-5.1705 F3000
+G1 X31.120 Y2.000 Z-5.1839 F3000
+G1 X31.140 Y2.000 Z-5.1973 F3000
+G1 X31.160 Y2.000 Z-5.2107 F3000
+G1 X31.180 Y2.000 Z-5.2242 F3000
+G1 X31.200 Y2.000 Z-5.2377 F3000
+G1 X31.220 Y2.000 Z-5.2512 F3000
+G1 X31.240 Y2.000 Z-5.2648 F3000
+G1 X31.260 Y2.000 Z-5.2784 F3000
+G1 X31.280 Y2.000 Z-5.2921 F3000
+G1 X31.300 Y2.000 Z-5.3058 F3000
+G1 X31.320 Y2.000 Z-5.3195 F3000
+G1 X31.340 Y2.000 Z-5.3332 F3000
+G1 X31.360 Y2.000 Z-5.3470 F3000
+G1 X31.380 Y2.000 Z-5.3609 F3000
+G1 X31.400 Y2.000 Z-5.3747 F3000
+G1 X31.420 Y2.000 Z-5.3886 F3000
+G1 X31.440 Y2.000 Z-5.4025 F3000
+G1 X31.460 Y2.000 Z-5.4165 F3000
+G1 X31.480 Y2.000 Z-5.4305 F3000
+G1 X31.500 Y2.000 Z-5.4446 F3000
+G1 X31.520 Y2.000 Z-5.4587 F3000
+G1 X31.540 Y2.000 Z-5.4728 F3000
+G1 X31.560 Y2.000 Z-5.4869 F3000
+G1 X31.580 Y2.000 Z-5.5011 F3000
+G1 X31.600 Y2.000 Z-5.5153 F3000
+G1 X31.620 Y2.000 Z-5.5296 F3000
+G1 X31.640 Y2.000 Z-5.5439 F3000
+G1 X31.660 Y2.000 Z-5.5583 F3000
+G1 X31.680 Y2.000 Z-5.5726 F3000
+G1 X31.700 Y2.000 Z-5.5870 F3000
+G1 X31.720 Y2.000 Z-5.6015 F3000
+G1 X31.740 Y2.000 Z-5.6160 F3000
+G1 X31.760 Y2.000 Z-5.6305 F3000
+G1 X31.780 Y2.000 Z-5.6451 F3000
+G1 X31.800 Y2.000 Z-5.6597 F3000
+G1 X31.820 Y2.000 Z-5.6743 F3000
+G1 X31.840 Y2.000 Z-5.6890 F3000
+G1 X31.860 Y2.000 Z-5.7037 F3000
+G1 X31.880 Y2.000 Z-5.7185 F3000
+G1 X31.900 Y2.000 Z-5.7333 F3000
+G1 X31.920 Y2.000 Z-5.7481 F3000
+G1 X31.940 Y2.000 Z-5.7630 F3000
+G1 X31.960 Y2.000 Z-5.7779 F3000
+G1 X31.980 Y2.000 Z-5.7928 F3000
+G1 X32.000 Y2.000 Z-5.8078 F3000
+G1 X32.020 Y2.000 Z-5.8228 F3000
+G1 X32.040 Y2.000 Z-5.8379 F3000
+G1 X32.060 Y2.000 Z-5.8530 F3000
+G1 X32.080 Y2.000 Z-5.8682 F3000
+G1 X32.100 Y2.000 Z-5.8833 F3000
+G1 X32.120 Y2.000 Z-5.8986 F3000
+G1 X32.140 Y2.000 Z-5.9138 F3000
+G1 X32.160 Y2.000 Z-5.9291 F3000
+G1 X32.180 Y2.000 Z-5.9445 F3000
+G1 X32.200 Y2.000 Z-5.9599 F3000
+G1 X32.220 Y2.000 Z-5.9753 F3000
+G1 X32.240 Y2.000 Z-5.9907 F3000
+G1 X32.260 Y2.000 Z-6.0063 F3000
+G1 X32.280 Y2.000 Z-6.0218 F3000
+G1 X32.300 Y2.000 Z-6.0374 F3000
+G1 X32.320 Y2.000 Z-6.0530 F3000
+G1 X32.340 Y2.000 Z-6.0687 F3000
+G1 X32.360 Y2.000 Z-6.0844 F3000
+G1 X32.380 Y2.000 Z-6.1001 F3000
+G1 X32.400 Y2.000 Z-6.1159 F3000
+G1 X32.420 Y2.000 Z-6.1318 F3000
+G1 X32.440 Y2.000 Z-6.1476 F3000
+G1 X32.460 Y2.000 Z-6.1636 F3000
+G1 X32.480 Y2.000 Z-6.1795 F3000
+G1 X32.500 Y2.000 Z-6.1955 F3000
+G1 X32.520 Y2.000 Z-6.2116 F3000
+G1 X32.540 Y2.000 Z-6.2276 F3000
+G1 X32.560 Y2.000 Z-6.2438 F3000
+G1 X32.580 Y2.000 Z-6.2599 F3000
+G1 X32.600 Y2.000 Z-6.2761 F3000
+G1 X32.620 Y2.000 Z-6.2924 F3000
+G1 X32.640 Y2.000 Z-6.3087 F3000
+G1 X32.660 Y2.000 Z-6.3250 F3000
+G1 X32.680 Y2.000 Z-6.3414 F3000
+G1 X32.700 Y2.000 Z-6.3578 F3000
+G1 X32.720 Y2.000 Z-6.3743 F3000
+G1 X32.740 Y2.000 Z-6.3908 F3000
+G1 X32.760 Y2.000 Z-6.4074 F3000
+G1 X32.780 Y2.000 Z-6.4240 F3000
+G1 X32.800 Y2.000 Z-6.4406 F3000
+G1 X32.820 Y2.000 Z-6.4573 F3000
+G1 X32.840 Y2.000 Z-6.4741 F3000
+G1 X32.860 Y2.000 Z-6.4908 F3000
+G1 X32.880 Y2.000 Z-6.5077 F3000
+G1 X32.900 Y2.000 Z-6.5245 F3000
+G1 X32.920 Y2.000 Z-6.5414 F3000
+G1 X32.940 Y2.000 Z-6.5584 F3000
+G1 X32.960 Y2.000 Z-6.5754 F3000
+G1 X32.980 Y2.000 Z-6.5924 F3000
+G1 X33.000 Y2.000 Z-6.6095 F3000
+G1 X33.020 Y2.000 Z-6.6267 F3000
+G1 X33.040 Y2.000 Z-6.6439 F3000
+G1 X33.060 Y2.000 Z-6.6611 F3000
+G1 X33.080 Y2.000 Z-6.6784 F3000
+G1 X33.100 Y2.000 Z-6.6957 F3000
+G1 X33.120 Y2.000 Z-6.7131 F3000
+G1 X33.140 Y2.000 Z-6.7305 F3000
+G1 X33.160 Y2.000 Z-6.7479 F3000
+G1 X33.180 Y2.000 Z-6.7655 F3000
+G1 X33.200 Y2.000 Z-6.7830 F3000
+G1 X33.220 Y2.000 Z-6.8006 F3000
+G1 X33.240 Y2.000 Z-6.8183 F3000
+G1 X33.260 Y2.000 Z-6.8360 F3000
+G1 X33.280 Y2.000 Z-6.8537 F3000
+G1 X33.300 Y2.000 Z-6.8715 F3000
+G1 X33.320 Y2.000 Z-6.8893 F3000
+G1 X33.340 Y2.000 Z-6.9072 F3000
+G1 X33.360 Y2.000 Z-6.9252 F3000
+G1 X33.380 Y2.000 Z-6.9432 F3000
+G1 X33.400 Y2.000 Z-6.9612 F3000
+G1 X33.420 Y2.000 Z-6.9793 F3000
+G1 X33.440 Y2.000 Z-6.9974 F3000
+G1 X33.460 Y2.000 Z-7.0156 F3000
+G1 X33.480 Y2.000 Z-7.0338 F3000
+G1 X33.500 Y2.000 Z-7.0521 F3000
+G1 X33.520 Y2.000 Z-7.0705 F3000
+G1 X33.540 Y2.000 Z-7.0888 F3000
+G1 X33.560 Y2.000 Z-7.1073 F3000
+G1 X33.580 Y2.000 Z-7.1258 F3000
+G1 X33.600 Y2.000 Z-7.1443 F3000
+G1 X33.620 Y2.000 Z-7.1629 F3000
+G1 X33.640 Y2.000 Z-7.1815 F3000
+G1 X33.660 Y2.000 Z-7.2002 F3000
+G1 X33.680 Y2.000 Z-7.2189 F3000
+G1 X33.700 Y2.000 Z-7.2377 F3000
+G1 X33.720 Y2.000 Z-7.2566 F3000
+G1 X33.740 Y2.000 Z-7.2755 F3000
+G1 X33.760 Y2.000 Z-7.2944 F3000
+G1 X33.780 Y2.000 Z-7.3134 F3000
+G1 X33.800 Y2.000 Z-7.3325 F3000
+G1 X33.820 Y2.000 Z-7.3516 F3000
+G1 X33.840 Y2.000 Z-7.3707 F3000
+G1 X33.860 Y2.000 Z-7.3899 F3000
+G1 X33.880 Y2.000 Z-7.4092 F3000
+G1 X33.900 Y2.000 Z-7.4285 F3000
+G1 X33.920 Y2.000 Z-7.4479 F3000
+G1 X33.940 Y2.000 Z-7.4673 F3000
+G1 X33.960 Y2.000 Z-7.4868 F3000
+G1 X33.980 Y2.000 Z-7.5063 F3000
+G1 X34.000 Y2.000 Z-7.5259 F3000
+G1 X34.020 Y2.000 Z-7.5455 F3000
+G1 X34.040 Y2.000 Z-7.5652 F3000
+G1 X34.060 Y2.000 Z-7.5850 F3000
+G1 X34.080 Y2.000 Z-7.6048 F3000
+G1 X34.100 Y2.000 Z-7.6247 F3000
+G1 X34.120 Y2.000 Z-7.6446 F3000
+G1 X34.140 Y2.000 Z-7.6646 F3000
+G1 X34.160 Y2.000 Z-7.6846 F3000
+G1 X34.180 Y2.000 Z-7.7047 F3000
+G1 X34.200 Y2.000 Z-7.7248 F3000
+G1 X34.220 Y2.000 Z-7.7451 F3000
+G1 X34.240 Y2.000 Z-7.7653 F3000
+G1 X34.260 Y2.000 Z-7.7856 F3000
+G1 X34.280 Y2.000 Z-7.8060 F3000
+G1 X34.300 Y2.000 Z-7.8265 F3000
+G1 X34.320 Y2.000 Z-7.8470 F3000
+G1 X34.340 Y2.000 Z-7.8675 F3000
+G1 X34.360 Y2.000 Z-7.8881 F3000
+G1 X34.380 Y2.000 Z-7.9088 F3000
+G1 X34.400 Y2.000 Z-7.9295 F3000
+G1 X34.420 Y2.000 Z-7.9503 F3000
+G1 X34.440 Y2.000 Z-7.9712 F3000
+G1 X34.460 Y2.000 Z-7.9921 F3000
+G1 X34.480 Y2.000 Z-8.0131 F3000
+G1 X34.500 Y2.000 Z-8.0341 F3000
+G1 X34.520 Y2.000 Z-8.0552 F3000
+G1 X34.540 Y2.000 Z-8.0764 F3000
+G1 X34.560 Y2.000 Z-8.0976 F3000
+G1 X34.580 Y2.000 Z-8.1189 F3000
+G1 X34.600 Y2.000 Z-8.1402 F3000
+G1 X34.620 Y2.000 Z-8.1616 F3000
+G1 X34.640 Y2.000 Z-8.1831 F3000
+G1 X34.660 Y2.000 Z-8.2046 F3000
+G1 X34.680 Y2.000 Z-8.2262 F3000
+G1 X34.700 Y2.000 Z-8.2479 F3000
+G1 X34.720 Y2.000 Z-8.2696 F3000
+G1 X34.740 Y2.000 Z-8.2914 F3000
+G1 X34.760 Y2.000 Z-8.3133 F3000
+G1 X34.780 Y2.000 Z-8.3352 F3000
+G1 X34.800 Y2.000 Z-8.3572 F3000
+G1 X34.820 Y2.000 Z-8.3792 F3000
+G1 X34.840 Y2.000 Z-8.4013 F3000
+G1 X34.860 Y2.000 Z-8.4235 F3000
+G1 X34.880 Y2.000 Z-8.4458 F3000
+G1 X34.900 Y2.000 Z-8.4681 F3000
+G1 X34.920 Y2.000 Z-8.4905 F3000
+G1 X34.940 Y2.000 Z-8.5129 F3000
+G1 X34.960 Y2.000 Z-8.5354 F3000
+G1 X34.980 Y2.000 Z-8.5580 F3000
+G1 X35.000 Y2.000 Z-8.5807 F3000
+G1 X35.020 Y2.000 Z-8.6034 F3000
+G1 X35.040 Y2.000 Z-8.6262 F3000
+G1 X35.060 Y2.000 Z-8.6491 F3000
+G1 X35.080 Y2.000 Z-8.6720 F3000
+G1 X35.100 Y2.000 Z-8.6950 F3000
+G1 X35.120 Y2.000 Z-8.7181 F3000
+G1 X35.140 Y2.000 Z-8.7413 F3000
+G1 X35.160 Y2.000 Z-8.7645 F3000
+G1 X35.180 Y2.000 Z-8.7878 F3000
+G1 X35.200 Y2.000 Z-8.8112 F3000
+G1 X35.220 Y2.000 Z-8.8346 F3000
+G1 X35.240 Y2.000 Z-8.8581 F3000
+G1 X35.260 Y2.000 Z-8.8817 F3000
+G1 X35.280 Y2.000 Z-8.9054 F3000
+G1 X35.300 Y2.000 Z-8.9291 F3000
+G1 X35.320 Y2.000 Z-8.9529 F3000
+G1 X35.340 Y2.000 Z-8.9768 F3000
+G1 X35.360 Y2.000 Z-9.0008 F3000
+G1 X35.380 Y2.000 Z-9.0248 F3000
+G1 X35.400 Y2.000 Z-9.0489 F3000
+G1 X35.420 Y2.000 Z-9.0731 F3000
+G1 X35.440 Y2.000 Z-9.0974 F3000
+G1 X35.460 Y2.000 Z-9.1217 F3000
+G1 X35.480 Y2.000 Z-9.1462 F3000
+G1 X35.500 Y2.000 Z-9.1707 F3000
+G1 X35.520 Y2.000 Z-9.1953 F3000
+G1 X35.540 Y2.000 Z-9.2199 F3000
+G1 X35.560 Y2.000 Z-9.2447 F3000
+G1 X35.580 Y2.000 Z-9.2695 F3000
+G1 X35.600 Y2.000 Z-9.2944 F3000
+G1 X35.620 Y2.000 Z-9.3194 F3000
+G1 X35.640 Y2.000 Z-9.3445 F3000
+G1 X35.660 Y2.000 Z-9.3696 F3000
+G1 X35.680 Y2.000 Z-9.3949 F3000
+G1 X35.700 Y2.000 Z-9.4202 F3000
+G1 X35.720 Y2.000 Z-9.4456 F3000
+G1 X35.740 Y2.000 Z-9.4711 F3000
+G1 X35.760 Y2.000 Z-9.4967 F3000
+G1 X35.780 Y2.000 Z-9.5223 F3000
+G1 X35.800 Y2.000 Z-9.5481 F3000
+G1 X35.820 Y2.000 Z-9.5739 F3000
+G1 X35.840 Y2.000 Z-9.5998 F3000
+G1 X35.860 Y2.000 Z-9.6258 F3000
+G1 X35.880 Y2.000 Z-9.6519 F3000
+G1 X35.900 Y2.000 Z-9.6781 F3000
+G1 X35.920 Y2.000 Z-9.7044 F3000
+G1 X35.940 Y2.000 Z-9.7308 F3000
+G1 X35.960 Y2.000 Z-9.7572 F3000
+G1 X35.980 Y2.000 Z-9.7838 F3000
+G1 X36.000 Y2.000 Z-9.8104 F3000
+G1 X36.020 Y2.000 Z-9.8372 F3000
+G1 X36.040 Y2.000 Z-9.8640 F3000
+G1 X36.060 Y2.000 Z-9.8909 F3000
+G1 X36.080 Y2.000 Z-9.9179 F3000
+G1 X36.100 Y2.000 Z-9.9450 F3000
+G1 X36.120 Y2.000 Z-9.9723 F3000
+G1 X36.140 Y2.000 Z-9.9996 F3000
+G1 X36.160 Y2.000 Z-10.0270 F3000
+G1 X36.180 Y2.000 Z-10.0545 F3000
+G1 X36.200 Y2.000 Z-10.0821 F3000
+G1 X36.220 Y2.000 Z-10.1098 F3000
+G1 X36.240 Y2.000 Z-10.1376 F3000
+G1 X36.260 Y2.000 Z-10.1655 F3000
+G1 X36.280 Y2.000 Z-10.1935 F3000
+G1 X36.300 Y2.000 Z-10.2216 F3000
+G1 X36.320 Y2.000 Z-10.2498 F3000
+G1 X36.340 Y2.000 Z-10.2781 F3000
+G1 X36.360 Y2.000 Z-10.3065 F3000
+G1 X36.380 Y2.000 Z-10.3350 F3000
+G1 X36.400 Y2.000 Z-10.3637 F3000
+G1 X36.420 Y2.000 Z-10.3924 F3000
+G1 X36.440 Y2.000 Z-10.4212 F3000
+G1 X36.460 Y2.000 Z-10.4502 F3000
+G1 X36.480 Y2.000 Z-10.4792 F3000
+G1 X36.500 Y2.000 Z-10.5084 F3000
+G1 X36.520 Y2.000 Z-10.5377 F3000
+G1 X36.540 Y2.000 Z-10.5671 F3000
+G1 X36.560 Y2.000 Z-10.5966 F3000
+G1 X36.580 Y2.000 Z-10.6262 F3000
+G1 X36.600 Y2.000 Z-10.6559 F3000
+G1 X36.620 Y2.000 Z-10.6858 F3000
+G1 X36.640 Y2.000 Z-10.7158 F3000
+G1 X36.660 Y2.000 Z-10.7458 F3000
+G1 X36.680 Y2.000 Z-10.7760 F3000
+G1 X36.700 Y2.000 Z-10.8064 F3000
+G1 X36.720 Y2.000 Z-10.8368 F3000
+G1 X36.740 Y2.000 Z-10.8674 F3000
+G1 X36.760 Y2.000 Z-10.8981 F3000
+G1 X36.780 Y2.000 Z-10.9289 F3000
+G1 X36.800 Y2.000 Z-10.9598 F3000
+G1 X36.820 Y2.000 Z-10.9909 F3000
+G1 X36.840 Y2.000 Z-11.0220 F3000
+G1 X36.860 Y2.000 Z-11.0534 F3000
+G1 X36.880 Y2.000 Z-11.0848 F3000
+G1 X36.900 Y2.000 Z-11.1164 F3000
+G1 X36.920 Y2.000 Z-11.1481 F3000
+G1 X36.940 Y2.000 Z-11.1799 F3000
+G1 X36.960 Y2.000 Z-11.2119 F3000
+G1 X36.980 Y2.000 Z-11.2440 F3000
+G1 X37.000 Y2.000 Z-11.2762 F3000
+G1 X37.020 Y2.000 Z-11.3086 F3000
+G1 X37.040 Y2.000 Z-11.3411 F3000
+G1 X37.060 Y2.000 Z-11.3738 F3000
+G1 X37.080 Y2.000 Z-11.4066 F3000
+G1 X37.100 Y2.000 Z-11.4395 F3000
+G1 X37.120 Y2.000 Z-11.4726 F3000
+G1 X37.140 Y2.000 Z-11.5058 F3000
+G1 X37.160 Y2.000 Z-11.5392 F3000
+G1 X37.180 Y2.000 Z-11.5727 F3000
+G1 X37.200 Y2.000 Z-11.6064 F3000
+G1 X37.220 Y2.000 Z-11.6402 F3000
+G1 X37.240 Y2.000 Z-11.6742 F3000
+G1 X37.260 Y2.000 Z-11.7083 F3000
+G1 X37.280 Y2.000 Z-11.7426 F3000
+G1 X37.300 Y2.000 Z-11.7770 F3000
+G1 X37.320 Y2.000 Z-11.8116 F3000
+G1 X37.340 Y2.000 Z-11.8464 F3000
+G1 X37.360 Y2.000 Z-11.8813 F3000
+G1 X37.380 Y2.000 Z-11.9164 F3000
+G1 X37.400 Y2.000 Z-11.9516 F3000
+G1 X37.420 Y2.000 Z-11.9871 F3000
+G1 X37.440 Y2.000 Z-12.0227 F3000
+G1 X37.460 Y2.000 Z-12.0584 F3000
+G1 X37.480 Y2.000 Z-12.0944 F3000
+G1 X37.500 Y2.000 Z-12.1305 F3000
+G1 X37.520 Y2.000 Z-12.1667 F3000
+G1 X37.540 Y2.000 Z-12.2032 F3000
+G1 X37.560 Y2.000 Z-12.2399 F3000
+G1 X37.580 Y2.000 Z-12.2767 F3000
+G1 X37.600 Y2.000 Z-12.3137 F3000
+G1 X37.620 Y2.000 Z-12.3509 F3000
+G1 X37.640 Y2.000 Z-12.3883 F3000
+G1 X37.660 Y2.000 Z-12.4259 F3000
+G1 X37.680 Y2.000 Z-12.4636 F3000
+G1 X37.700 Y2.000 Z-12.5016 F3000
+G1 X37.720 Y2.000 Z-12.5398 F3000
+G1 X37.740 Y2.000 Z-12.5782 F3000
+G1 X37.760 Y2.000 Z-12.6167 F3000
+G1 X37.780 Y2.000 Z-12.6555 F3000
+G1 X37.800 Y2.000 Z-12.6945 F3000
+G1 X37.820 Y2.000 Z-12.7337 F3000
+G1 X37.840 Y2.000 Z-12.7731 F3000
+G1 X37.860 Y2.000 Z-12.8128 F3000
+G1 X37.880 Y2.000 Z-12.8526 F3000
+G1 X37.900 Y2.000 Z-12.8927 F3000
+G1 X37.920 Y2.000 Z-12.9330 F3000
+G1 X37.940 Y2.000 Z-12.9735 F3000
+G1 X37.960 Y2.000 Z-13.0143 F3000
+G1 X37.980 Y2.000 Z-13.0553 F3000
+G1 X38.000 Y2.000 Z-13.0966 F3000
+G1 X38.020 Y2.000 Z-13.1380 F3000
+G1 X38.040 Y2.000 Z-13.1798 F3000
+G1 X38.060 Y2.000 Z-13.2217 F3000
+G1 X38.080 Y2.000 Z-13.2640 F3000
+G1 X38.100 Y2.000 Z-13.3065 F3000
+G1 X38.120 Y2.000 Z-13.3492 F3000
+G1 X38.140 Y2.000 Z-13.3922 F3000
+G1 X38.160 Y2.000 Z-13.4355 F3000
+G1 X38.180 Y2.000 Z-13.4791 F3000
+G1 X38.200 Y2.000 Z-13.5229 F3000
+G1 X38.220 Y2.000 Z-13.5670 F3000
+G1 X38.240 Y2.000 Z-13.6114 F3000
+G1 X38.260 Y2.000 Z-13.6561 F3000
+G1 X38.280 Y2.000 Z-13.7011 F3000
+G1 X38.300 Y2.000 Z-13.7464 F3000
+G1 X38.320 Y2.000 Z-13.7920 F3000
+G1 X38.340 Y2.000 Z-13.8379 F3000
+G1 X38.360 Y2.000 Z-13.8842 F3000
+G1 X38.380 Y2.000 Z-13.9307 F3000
+G1 X38.400 Y2.000 Z-13.9776 F3000
+G1 X38.420 Y2.000 Z-14.0248 F3000
+G1 X38.440 Y2.000 Z-14.0724 F3000
+G1 X38.460 Y2.000 Z-14.1203 F3000
+G1 X38.480 Y2.000 Z-14.1685 F3000
+G1 X38.500 Y2.000 Z-14.2171 F3000
+G1 X38.520 Y2.000 Z-14.2661 F3000
+G1 X38.540 Y2.000 Z-14.3155 F3000
+G1 X38.560 Y2.000 Z-14.3652 F3000
+G1 X38.580 Y2.000 Z-14.4153 F3000
+G1 X38.600 Y2.000 Z-14.4658 F3000
+G1 X38.620 Y2.000 Z-14.5168 F3000
+G1 X38.640 Y2.000 Z-14.5681 F3000
+G1 X38.660 Y2.000 Z-14.6199 F3000
+G1 X38.680 Y2.000 Z-14.6721 F3000
+G1 X38.700 Y2.000 Z-14.7247 F3000
+G1 X38.720 Y2.000 Z-14.7778 F3000
+G1 X38.740 Y2.000 Z-14.8313 F3000
+G1 X38.760 Y2.000 Z-14.8853 F3000
+G1 X38.780 Y2.000 Z-14.9399 F3000
+G1 X38.800 Y2.000 Z-14.9949 F3000
+G1 X38.820 Y2.000 Z-15.0504 F3000
+G1 X38.840 Y2.000 Z-15.1064 F3000
+G1 X38.860 Y2.000 Z-15.1630 F3000
+G1 X38.880 Y2.000 Z-15.2201 F3000
+G1 X38.900 Y2.000 Z-15.2777 F3000
+G1 X38.920 Y2.000 Z-15.3360 F3000
+G1 X38.940 Y2.000 Z-15.3948 F3000
+G1 X38.960 Y2.000 Z-15.4543 F3000
+G1 X38.980 Y2.000 Z-15.5143 F3000
+G1 X39.000 Y2.000 Z-15.5751 F3000
+G1 X39.020 Y2.000 Z-15.6364 F3000
+G1 X39.040 Y2.000 Z-15.6985 F3000
+G1 X39.060 Y2.000 Z-15.7613 F3000
+G1 X39.080 Y2.000 Z-15.8248 F3000
+G1 X39.100 Y2.000 Z-15.8890 F3000
+G1 X39.120 Y2.000 Z-15.9540 F3000
+G1 X39.140 Y2.000 Z-16.0198 F3000
+G1 X39.160 Y2.000 Z-16.0865 F3000
+G1 X39.180 Y2.000 Z-16.1540 F3000
+G1 X39.200 Y2.000 Z-16.2224 F3000
+G1 X39.220 Y2.000 Z-16.2917 F3000
+G1 X39.240 Y2.000 Z-16.3619 F3000
+G1 X39.260 Y2.000 Z-16.4332 F3000
+G1 X39.280 Y2.000 Z-16.5055 F3000
+G1 X39.300 Y2.000 Z-16.5789 F3000
+G1 X39.320 Y2.000 Z-16.6534 F3000
+G1 X39.340 Y2.000 Z-16.7291 F3000
+G1 X39.360 Y2.000 Z-16.8060 F3000
+G1 X39.380 Y2.000 Z-16.8841 F3000
+G1 X39.400 Y2.000 Z-16.9637 F3000
+G1 X39.420 Y2.000 Z-17.0446 F3000
+G1 X39.440 Y2.000 Z-17.1271 F3000
+G1 X39.460 Y2.000 Z-17.2111 F3000
+G1 X39.480 Y2.000 Z-17.2967 F3000
+G1 X39.500 Y2.000 Z-17.3841 F3000
+G1 X39.520 Y2.000 Z-17.4734 F3000
+G1 X39.540 Y2.000 Z-17.5646 F3000
+G1 X39.560 Y2.000 Z-17.6580 F3000
+G1 X39.580 Y2.000 Z-17.7536 F3000
+G1 X39.600 Y2.000 Z-17.8516 F3000
+G1 X39.620 Y2.000 Z-17.9522 F3000
+G1 X39.640 Y2.000 Z-18.0556 F3000
+G1 X39.660 Y2.000 Z-18.1621 F3000
+G1 X39.680 Y2.000 Z-18.2719 F3000
+G1 X39.700 Y2.000 Z-18.3853 F3000
+G1 X39.720 Y2.000 Z-18.5028 F3000
+G1 X39.740 Y2.000 Z-18.6247 F3000
+G1 X39.760 Y2.000 Z-18.7517 F3000
+G1 X39.780 Y2.000 Z-18.8842 F3000
+G1 X39.800 Y2.000 Z-19.0233 F3000
+G1 X39.820 Y2.000 Z-19.1699 F3000
+G1 X39.840 Y2.000 Z-19.3252 F3000
+G1 X39.860 Y2.000 Z-19.4912 F3000
+G1 X39.880 Y2.000 Z-19.6703 F3000
+G1 X39.900 Y2.000 Z-19.8661 F3000
+G1 X39.920 Y2.000 Z-20.0843 F3000
+G1 X39.940 Y2.000 Z-20.3349 F3000
+G1 X39.960 Y2.000 Z-20.6388 F3000
+G1 X39.980 Y2.000 Z-21.0586 F3000
+G1 X40.000 Y2.000 Z-21.8000 F3000
+G1 X40.000 Y2.500 Z-21.8000 F3000
+G1 X39.980 Y2.500 Z-20.9058 F3000
+G1 X39.960 Y2.500 Z-20.5357 F3000
+G1 X39.940 Y2.500 Z-20.2520 F3000
+G1 X39.920 Y2.500 Z-20.0129 F3000
+G1 X39.900 Y2.500 Z-19.8025 F3000
+G1 X39.880 Y2.500 Z-19.6124 F3000
+G1 X39.860 Y2.500 Z-19.4377 F3000
+G1 X39.840 Y2.500 Z-19.2752 F3000
+G1 X39.820 Y2.500 Z-19.1228 F3000
+G1 X39.800 Y2.500 Z-18.9787 F3000
+G1 X39.780 Y2.500 Z-18.8417 F3000
+G1 X39.760 Y2.500 Z-18.7109 F3000
+G1 X39.740 Y2.500 Z-18.5856 F3000
+G1 X39.720 Y2.500 Z-18.4651 F3000
+G1 X39.700 Y2.500 Z-18.3489 F3000
+G1 X39.680 Y2.500 Z-18.2366 F3000
+G1 X39.660 Y2.500 Z-18.1279 F3000
+G1 X39.640 Y2.500 Z-18.0224 F3000
+G1 X39.620 Y2.500 Z-17.9198 F3000
+G1 X39.600 Y2.500 Z-17.8201 F3000
+G1 X39.580 Y2.500 Z-17.7228 F3000
+G1 X39.560 Y2.500 Z-17.6279 F3000
+G1 X39.540 Y2.500 Z-17.5352 F3000
+G1 X39.520 Y2.500 Z-17.4446 F3000
+G1 X39.500 Y2.500 Z-17.3559 F3000
+G1 X39.480 Y2.500 Z-17.2690 F3000
+G1 X39.460 Y2.500 Z-17.1839 F3000
+G1 X39.440 Y2.500 Z-17.1004 F3000
+G1 X39.420 Y2.500 Z-17.0184 F3000
+G1 X39.400 Y2.500 Z-16.9379 F3000
+G1 X39.380 Y2.500 Z-16.8588 F3000
+G1 X39.360 Y2.500 Z-16.7810 F3000
+G1 X39.340 Y2.500 Z-16.7045 F3000
+G1 X39.320 Y2.500 Z-16.6292 F3000
+G1 X39.300 Y2.500 Z-16.5550 F3000
+G1 X39.280 Y2.500 Z-16.4820 F3000
+G1 X39.260 Y2.500 Z-16.4100 F3000
+G1 X39.240 Y2.500 Z-16.3390 F3000
+G1 X39.220 Y2.500 Z-16.2690 F3000
+G1 X39.200 Y2.500 Z-16.2000 F3000
+G1 X39.180 Y2.500 Z-16.1319 F3000
+G1 X39.160 Y2.500 Z-16.0646 F3000
+G1 X39.140 Y2.500 Z-15.9982 F3000
+G1 X39.120 Y2.500 Z-15.9327 F3000
+G1 X39.100 Y2.500 Z-15.8679 F3000
+G1 X39.080 Y2.500 Z-15.8039 F3000
+G1 X39.060 Y2.500 Z-15.7406 F3000
+G1 X39.040 Y2.500 Z-15.6780 F3000
+G1 X39.020 Y2.500 Z-15.6162 F3000
+G1 X39.000 Y2.500 Z-15.5550 F3000
+G1 X38.980 Y2.500 Z-15.4945 F3000
+G1 X38.960 Y2.500 Z-15.4346 F3000
+G1 X38.940 Y2.500 Z-15.3753 F3000
+G1 X38.920 Y2.500 Z-15.3167 F3000
+G1 X38.900 Y2.500 Z-15.2586 F3000
+G1 X38.880 Y2.500 Z-15.2011 F3000
+G1 X38.860 Y2.500 Z-15.1441 F3000
+G1 X38.840 Y2.500 Z-15.0877 F3000
+G1 X38.820 Y2.500 Z-15.0319 F3000
+G1 X38.800 Y2.500 Z-14.9765 F3000
+G1 X38.780 Y2.500 Z-14.9217 F3000
+G1 X38.760 Y2.500 Z-14.8673 F3000
+G1 X38.740 Y2.500 Z-14.8134 F3000
+G1 X38.720 Y2.500 Z-14.7600 F3000
+G1 X38.700 Y2.500 Z-14.7070 F3000
+G1 X38.680 Y2.500 Z-14.6545 F3000
+G1 X38.660 Y2.500 Z-14.6025 F3000
+G1 X38.640 Y2.500 Z-14.5508 F3000
+G1 X38.620 Y2.500 Z-14.4996 F3000
+G1 X38.600 Y2.500 Z-14.4488 F3000
+G1 X38.580 Y2.500 Z-14.3984 F3000
+G1 X38.560 Y2.500 Z-14.3484 F3000
+G1 X38.540 Y2.500 Z-14.2988 F3000
+G1 X38.520 Y2.500 Z-14.2495 F3000
+G1 X38.500 Y2.500 Z-14.2007 F3000
+G1 X38.480 Y2.500 Z-14.1522 F3000
+G1 X38.460 Y2.500 Z-14.1040 F3000
+G1 X38.440 Y2.500 Z-14.0562 F3000
+G1 X38.420 Y2.500 Z-14.0087 F3000
+G1 X38.400 Y2.500 Z-13.9616 F3000
+G1 X38.380 Y2.500 Z-13.9148 F3000
+G1 X38.360 Y2.500 Z-13.8684 F3000
+G1 X38.340 Y2.500 Z-13.8223 F3000
+G1 X38.320 Y2.500 Z-13.7764 F3000
+G1 X38.300 Y2.500 Z-13.7309 F3000
+G1 X38.280 Y2.500 Z-13.6857 F3000
+G1 X38.260 Y2.500 Z-13.6408 F3000
+G1 X38.240 Y2.500 Z-13.5962 F3000
+G1 X38.220 Y2.500 Z-13.5519 F3000
+G1 X38.200 Y2.500 Z-13.5078 F3000
+G1 X38.180 Y2.500 Z-13.4641 F3000
+G1 X38.160 Y2.500 Z-13.4206 F3000
+G1 X38.140 Y2.500 Z-13.3774 F3000
+G1 X38.120 Y2.500 Z-13.3344 F3000
+G1 X38.100 Y2.500 Z-13.2918 F3000
+G1 X38.080 Y2.500 Z-13.2494 F3000
+G1 X38.060 Y2.500 Z-13.2072 F3000
+G1 X38.040 Y2.500 Z-13.1653 F3000
+G1 X38.020 Y2.500 Z-13.1236 F3000
+G1 X38.000 Y2.500 Z-13.0822 F3000
+G1 X37.980 Y2.500 Z-13.0410 F3000
+G1 X37.960 Y2.500 Z-13.0001 F3000
+G1 X37.940 Y2.500 Z-12.9594 F3000
+G1 X37.920 Y2.500 Z-12.9189 F3000
+G1 X37.900 Y2.500 Z-12.8787 F3000
+G1 X37.880 Y2.500 Z-12.8387 F3000
+G1 X37.860 Y2.500 Z-12.7989 F3000
+G1 X37.840 Y2.500 Z-12.7593 F3000
+G1 X37.820 Y2.500 Z-12.7199 F3000
+G1 X37.800 Y2.500 Z-12.6808 F3000
+G1 X37.780 Y2.500 Z-12.6419 F3000
+G1 X37.760 Y2.500 Z-12.6031 F3000
+G1 X37.740 Y2.500 Z-12.5646 F3000
+G1 X37.720 Y2.500 Z-12.5263 F3000
+G1 X37.700 Y2.500 Z-12.4882 F3000
+G1 X37.680 Y2.500 Z-12.4503 F3000
+G1 X37.660 Y2.500 Z-12.4125 F3000
+G1 X37.640 Y2.500 Z-12.3750 F3000
+G1 X37.620 Y2.500 Z-12.3377 F3000
+G1 X37.600 Y2.500 Z-12.3005 F3000
+G1 X37.580 Y2.500 Z-12.2636 F3000
+G1 X37.560 Y2.500 Z-12.2268 F3000
+G1 X37.540 Y2.500 Z-12.1902 F3000
+G1 X37.520 Y2.500 Z-12.1538 F3000
+G1 X37.500 Y2.500 Z-12.1175 F3000
+G1 X37.480 Y2.500 Z-12.0815 F3000
+G1 X37.460 Y2.500 Z-12.0456 F3000
+G1 X37.440 Y2.500 Z-12.0099 F3000
+G1 X37.420 Y2.500 Z-11.9743 F3000
+G1 X37.400 Y2.500 Z-11.9390 F3000
+G1 X37.380 Y2.500 Z-11.9038 F3000
+G1 X37.360 Y2.500 Z-11.8687 F3000
+G1 X37.340 Y2.500 Z-11.8338 F3000
+G1 X37.320 Y2.500 Z-11.7991 F3000
+G1 X37.300 Y2.500 Z-11.7646 F3000
+G1 X37.280 Y2.500 Z-11.7302 F3000
+G1 X37.260 Y2.500 Z-11.6959 F3000
+G1 X37.240 Y2.500 Z-11.6618 F3000
+G1 X37.220 Y2.500 Z-11.6279 F3000
+G1 X37.200 Y2.500 Z-11.5941 F3000
+G1 X37.180 Y2.500 Z-11.5605 F3000
+G1 X37.160 Y2.500 Z-11.5270 F3000
+G1 X37.140 Y2.500 Z-11.4937 F3000
+G1 X37.120 Y2.500 Z-11.4605 F3000
+G1 X37.100 Y2.500 Z-11.4274 F3000
+G1 X37.080 Y2.500 Z-11.3945 F3000
+G1 X37.060 Y2.500 Z-11.3618 F3000
+G1 X37.040 Y2.500 Z-11.3292 F3000
+G1 X37.020 Y2.500 Z-11.2967 F3000
+G1 X37.000 Y2.500 Z-11.2643 F3000
+G1 X36.980 Y2.500 Z-11.2321 F3000
+G1 X36.960 Y2.500 Z-11.2001 F3000
+G1 X36.940 Y2.500 Z-11.1681 F3000
+G1 X36.920 Y2.500 Z-11.1363 F3000
+G1 X36.900 Y2.500 Z-11.1047 F3000
+G1 X36.880 Y2.500 Z-11.0731 F3000
+G1 X36.860 Y2.500 Z-11.0417 F3000
+G1 X36.840 Y2.500 Z-11.0104 F3000
+G1 X36.820 Y2.500 Z-10.9793 F3000
+G1 X36.800 Y2.500 Z-10.9483 F3000
+G1 X36.780 Y2.500 Z-10.9174 F3000
+G1 X36.760 Y2.500 Z-10.8866 F3000
+G1 X36.740 Y2.500 Z-10.8559 F3000
+G1 X36.720 Y2.500 Z-10.8254 F3000
+G1 X36.700 Y2.500 Z-10.7950 F3000
+G1 X36.680 Y2.500 Z-10.7647 F3000
+G1 X36.660 Y2.500 Z-10.7345 F3000
+G1 X36.640 Y2.500 Z-10.7045 F3000
+G1 X36.620 Y2.500 Z-10.6746 F3000
+G1 X36.600 Y2.500 Z-10.6447 F3000
+G1 X36.580 Y2.500 Z-10.6150 F3000
+G1 X36.560 Y2.500 Z-10.5854 F3000
+G1 X36.540 Y2.500 Z-10.5560 F3000
+G1 X36.520 Y2.500 Z-10.5266 F3000
+G1 X36.500 Y2.500 Z-10.4973 F3000
+G1 X36.480 Y2.500 Z-10.4682 F3000
+G1 X36.460 Y2.500 Z-10.4392 F3000
+G1 X36.440 Y2.500 Z-10.4103 F3000
+G1 X36.420 Y2.500 Z-10.3814 F3000
+G1 X36.400 Y2.500 Z-10.3527 F3000
+G1 X36.380 Y2.500 Z-10.3241 F3000
+G1 X36.360 Y2.500 Z-10.2956 F3000
+G1 X36.340 Y2.500 Z-10.2672 F3000
+G1 X36.320 Y2.500 Z-10.2390 F3000
+G1 X36.300 Y2.500 Z-10.2108 F3000
+G1 X36.280 Y2.500 Z-10.1827 F3000
+G1 X36.260 Y2.500 Z-10.1547 F3000
+G1 X36.240 Y2.500 Z-10.1269 F3000
+G1 X36.220 Y2.500 Z-10.0991 F3000
+G1 X36.200 Y2.500 Z-10.0714 F3000
+G1 X36.180 Y2.500 Z-10.0438 F3000
+G1 X36.160 Y2.500 Z-10.0164 F3000
+G1 X36.140 Y2.500 Z-9.9890 F3000
+G1 X36.120 Y2.500 Z-9.9617 F3000
+G1 X36.100 Y2.500 Z-9.9345 F3000
+G1 X36.080 Y2.500 Z-9.9074 F3000
+G1 X36.060 Y2.500 Z-9.8804 F3000
+G1 X36.040 Y2.500 Z-9.8535 F3000
+G1 X36.020 Y2.500 Z-9.8267 F3000
+G1 X36.000 Y2.500 Z-9.8000 F3000
+G1 X35.980 Y2.500 Z-9.7734 F3000
+G1 X35.960 Y2.500 Z-9.7469 F3000
+G1 X35.940 Y2.500 Z-9.7204 F3000
+G1 X35.920 Y2.500 Z-9.6941 F3000
+G1 X35.900 Y2.500 Z-9.6678 F3000
+G1 X35.880 Y2.500 Z-9.6416 F3000
+G1 X35.860 Y2.500 Z-9.6156 F3000
+G1 X35.840 Y2.500 Z-9.5896 F3000
+G1 X35.820 Y2.500 Z-9.5637 F3000
+G1 X35.800 Y2.500 Z-9.5379 F3000
+G1 X35.780 Y2.500 Z-9.5121 F3000
+G1 X35.760 Y2.500 Z-9.4865 F3000
+G1 X35.740 Y2.500 Z-9.4609 F3000
+G1 X35.720 Y2.500 Z-9.4355 F3000
+G1 X35.700 Y2.500 Z-9.4101 F3000
+G1 X35.680 Y2.500 Z-9.3848 F3000
+G1 X35.660 Y2.500 Z-9.3596 F3000
+G1 X35.640 Y2.500 Z-9.3344 F3000
+G1 X35.620 Y2.500 Z-9.3094 F3000
+G1 X35.600 Y2.500 Z-9.2844 F3000
+G1 X35.580 Y2.500 Z-9.2595 F3000
+G1 X35.560 Y2.500 Z-9.2347 F3000
+G1 X35.540 Y2.500 Z-9.2100 F3000
+G1 X35.520 Y2.500 Z-9.1853 F3000
+G1 X35.500 Y2.500 Z-9.1608 F3000
+G1 X35.480 Y2.500 Z-9.1363 F3000
+G1 X35.460 Y2.500 Z-9.1119 F3000
+G1 X35.440 Y2.500 Z-9.0875 F3000
+G1 X35.420 Y2.500 Z-9.0633 F3000
+G1 X35.400 Y2.500 Z-9.0391 F3000
+G1 X35.380 Y2.500 Z-9.0150 F3000
+G1 X35.360 Y2.500 Z-8.9910 F3000
+G1 X35.340 Y2.500 Z-8.9671 F3000
+G1 X35.320 Y2.500 Z-8.9432 F3000
+G1 X35.300 Y2.500 Z-8.9194 F3000
+G1 X35.280 Y2.500 Z-8.8957 F3000
+G1 X35.260 Y2.500 Z-8.8720 F3000
+G1 X35.240 Y2.500 Z-8.8485 F3000
+G1 X35.220 Y2.500 Z-8.8250 F3000
+G1 X35.200 Y2.500 Z-8.8015 F3000
+G1 X35.180 Y2.500 Z-8.7782 F3000
+G1 X35.160 Y2.500 Z-8.7549 F3000
+G1 X35.140 Y2.500 Z-8.7317 F3000
+G1 X35.120 Y2.500 Z-8.7086 F3000
+G1 X35.100 Y2.500 Z-8.6855 F3000
+G1 X35.080 Y2.500 Z-8.6625 F3000
+G1 X35.060 Y2.500 Z-8.6396 F3000
+G1 X35.040 Y2.500 Z-8.6167 F3000
+G1 X35.020 Y2.500 Z-8.5940 F3000
+G1 X35.000 Y2.500 Z-8.5712 F3000
+G1 X34.980 Y2.500 Z-8.5486 F3000
+G1 X34.960 Y2.500 Z-8.5260 F3000
+G1 X34.940 Y2.500 Z-8.5035 F3000
+G1 X34.920 Y2.500 Z-8.4811 F3000
+G1 X34.900 Y2.500 Z-8.4587 F3000
+G1 X34.880 Y2.500 Z-8.4364 F3000
+G1 X34.860 Y2.500 Z-8.4142 F3000
+G1 X34.840 Y2.500 Z-8.3920 F3000
+G1 X34.820 Y2.500 Z-8.3699 F3000
+G1 X34.800 Y2.500 Z-8.3479 F3000
+G1 X34.780 Y2.500 Z-8.3259 F3000
+G1 X34.760 Y2.500 Z-8.3040 F3000
+G1 X34.740 Y2.500 Z-8.2821 F3000
+G1 X34.720 Y2.500 Z-8.2604 F3000
+G1 X34.700 Y2.500 Z-8.2387 F3000
+G1 X34.680 Y2.500 Z-8.2170 F3000
+G1 X34.660 Y2.500 Z-8.1954 F3000
+G1 X34.640 Y2.500 Z-8.1739 F3000
+G1 X34.620 Y2.500 Z-8.1525 F3000
+G1 X34.600 Y2.500 Z-8.1311 F3000
+G1 X34.580 Y2.500 Z-8.1097 F3000
+G1 X34.560 Y2.500 Z-8.0885 F3000
+G1 X34.540 Y2.500 Z-8.0673 F3000
+G1 X34.520 Y2.500 Z-8.0461 F3000
+G1 X34.500 Y2.500 Z-8.0250 F3000
+G1 X34.480 Y2.500 Z-8.0040 F3000
+G1 X34.460 Y2.500 Z-7.9830 F3000
+G1 X34.440 Y2.500 Z-7.9621 F3000
+G1 X34.420 Y2.500 Z-7.9413 F3000
+G1 X34.400 Y2.500 Z-7.9205 F3000
+G1 X34.380 Y2.500 Z-7.8998 F3000
+G1 X34.360 Y2.500 Z-7.8791 F3000
+G1 X34.340 Y2.500 Z-7.8585 F3000
+G1 X34.320 Y2.500 Z-7.8380 F3000
+G1 X34.300 Y2.500 Z-7.8175 F3000
+G1 X34.280 Y2.500 Z-7.7971 F3000
+G1 X34.260 Y2.500 Z-7.7767 F3000
+G1 X34.240 Y2.500 Z-7.7564 F3000
+G1 X34.220 Y2.500 Z-7.7362 F3000
+G1 X34.200 Y2.500 Z-7.7160 F3000
+G1 X34.180 Y2.500 Z-7.6958 F3000
+G1 X34.160 Y2.500 Z-7.6758 F3000
+G1 X34.140 Y2.500 Z-7.6557 F3000
+G1 X34.120 Y2.500 Z-7.6358 F3000
+G1 X34.100 Y2.500 Z-7.6159 F3000
+G1 X34.080 Y2.500 Z-7.5960 F3000
+G1 X34.060 Y2.500 Z-7.5762 F3000
+G1 X34.040 Y2.500 Z-7.5565 F3000
+G1 X34.020 Y2.500 Z-7.5368 F3000
+G1 X34.000 Y2.500 Z-7.5171 F3000
+G1 X33.980 Y2.500 Z-7.4976 F3000
+G1 X33.960 Y2.500 Z-7.4780 F3000
+G1 X33.940 Y2.500 Z-7.4586 F3000
+G1 X33.920 Y2.500 Z-7.4392 F3000
+G1 X33.900 Y2.500 Z-7.4198 F3000
+G1 X33.880 Y2.500 Z-7.4005 F3000
+G1 X33.860 Y2.500 Z-7.3812 F3000
+G1 X33.840 Y2.500 Z-7.3621 F3000
+G1 X33.820 Y2.500 Z-7.3429 F3000
+G1 X33.800 Y2.500 Z-7.3238 F3000
+G1 X33.780 Y2.500 Z-7.3048 F3000
+G1 X33.760 Y2.500 Z-7.2858 F3000
+G1 X33.740 Y2.500 Z-7.2669 F3000
+G1 X33.720 Y2.500 Z-7.2480 F3000
+G1 X33.700 Y2.500 Z-7.2291 F3000
+G1 X33.680 Y2.500 Z-7.2104 F3000
+G1 X33.660 Y2.500 Z-7.1916 F3000
+G1 X33.640 Y2.500 Z-7.1730 F3000
+G1 X33.620 Y2.500 Z-7.1543 F3000
+G1 X33.600 Y2.500 Z-7.1358 F3000
+G1 X33.580 Y2.500 Z-7.1172 F3000
+G1 X33.560 Y2.500 Z-7.0988 F3000
+G1 X33.540 Y2.500 Z-7.0803 F3000
+G1 X33.520 Y2.500 Z-7.0620 F3000
+G1 X33.500 Y2.500 Z-7.0436 F3000
+G1 X33.480 Y2.500 Z-7.0254 F3000
+G1 X33.460 Y2.500 Z-7.0072 F3000
+G1 X33.440 Y2.500 Z-6.9890 F3000
+G1 X33.420 Y2.500 Z-6.9709 F3000
+G1 X33.400 Y2.500 Z-6.9528 F3000
+G1 X33.380 Y2.500 Z-6.9348 F3000
+G1 X33.360 Y2.500 Z-6.9168 F3000
+G1 X33.340 Y2.500 Z-6.8988 F3000
+G1 X33.320 Y2.500 Z-6.8810 F3000
+G1 X33.300 Y2.500 Z-6.8631 F3000
+G1 X33.280 Y2.500 Z-6.8453 F3000
+G1 X33.260 Y2.500 Z-6.8276 F3000
+G1 X33.240 Y2.500 Z-6.8099 F3000
+G1 X33.220 Y2.500 Z-6.7923 F3000
+G1 X33.200 Y2.500 Z-6.7747 F3000
+G1 X33.180 Y2.500 Z-6.7571 F3000
+G1 X33.160 Y2.500 Z-6.7396 F3000
+G1 X33.140 Y2.500 Z-6.7222 F3000
+G1 X33.120 Y2.500 Z-6.7048 F3000
+G1 X33.100 Y2.500 Z-6.6874 F3000
+G1 X33.080 Y2.500 Z-6.6701 F3000
+G1 X33.060 Y2.500 Z-6.6528 F3000
+G1 X33.040 Y2.500 Z-6.6356 F3000
+G1 X33.020 Y2.500 Z-6.6184 F3000
+G1 X33.000 Y2.500 Z-6.6013 F3000
+G1 X32.980 Y2.500 Z-6.5842 F3000
+G1 X32.960 Y2.500 Z-6.5672 F3000
+G1 X32.940 Y2.500 Z-6.5502 F3000
+G1 X32.920 Y2.500 Z-6.5333 F3000
+G1 X32.900 Y2.500 Z-6.5163 F3000
+G1 X32.880 Y2.500 Z-6.4995 F3000
+G1 X32.860 Y2.500 Z-6.4827 F3000
+G1 X32.840 Y2.500 Z-6.4659 F3000
+G1 X32.820 Y2.500 Z-6.4492 F3000
+G1 X32.800 Y2.500 Z-6.4325 F3000
+G1 X32.780 Y2.500 Z-6.4159 F3000
+G1 X32.760 Y2.500 Z-6.3993 F3000
+G1 X32.740 Y2.500 Z-6.3827 F3000
+G1 X32.720 Y2.500 Z-6.3662 F3000
+G1 X32.700 Y2.500 Z-6.3498 F3000
+G1 X32.680 Y2.500 Z-6.3333 F3000
+G1 X32.660 Y2.500 Z-6.3170 F3000
+G1 X32.640 Y2.500 Z-6.3006 F3000
+G1 X32.620 Y2.500 Z-6.2843 F3000
+G1 X32.600 Y2.500 Z-6.2681 F3000
+G1 X32.580 Y2.500 Z-6.2519 F3000
+G1 X32.560 Y2.500 Z-6.2357 F3000
+G1 X32.540 Y2.500 Z-6.2196 F3000
+G1 X32.520 Y2.500 Z-6.2035 F3000
+G1 X32.500 Y2.500 Z-6.1875 F3000
+G1 X32.480 Y2.500 Z-6.1715 F3000
+G1 X32.460 Y2.500 Z-6.1556 F3000
+G1 X32.440 Y2.500 Z-6.1397 F3000
+G1 X32.420 Y2.500 Z-6.1238 F3000
+G1 X32.400 Y2.500 Z-6.1080 F3000
+G1 X32.380 Y2.500 Z-6.0922 F3000
+G1 X32.360 Y2.500 Z-6.0764 F3000
+G1 X32.340 Y2.500 Z-6.0607 F3000
+G1 X32.320 Y2.500 Z-6.0451 F3000
+G1 X32.300 Y2.500 Z-6.0295 F3000
+G1 X32.280 Y2.500 Z-6.0139 F3000
+G1 X32.260 Y2.500 Z-5.9983 F3000
+G1 X32.240 Y2.500 Z-5.9828 F3000
+G1 X32.220 Y2.500 Z-5.9674 F3000
+G1 X32.200 Y2.500 Z-5.9520 F3000
+G1 X32.180 Y2.500 Z-5.9366 F3000
+G1 X32.160 Y2.500 Z-5.9213 F3000
+G1 X32.140 Y2.500 Z-5.9060 F3000
+G1 X32.120 Y2.500 Z-5.8907 F3000
+G1 X32.100 Y2.500 Z-5.8755 F3000
+G1 X32.080 Y2.500 Z-5.8603 F3000
+G1 X32.060 Y2.500 Z-5.8452 F3000
+G1 X32.040 Y2.500 Z-5.8301 F3000
+G1 X32.020 Y2.500 Z-5.8150 F3000
+G1 X32.000 Y2.500 Z-5.8000 F3000
+G1 X31.980 Y2.500 Z-5.7850 F3000
+G1 X31.960 Y2.500 Z-5.7701 F3000
+G1 X31.940 Y2.500 Z-5.7552 F3000
+G1 X31.920 Y2.500 Z-5.7403 F3000
+G1 X31.900 Y2.500 Z-5.7255 F3000
+G1 X31.880 Y2.500 Z-5.7107 F3000
+G1 X31.860 Y2.500 Z-5.6960 F3000
+G1 X31.840 Y2.500 Z-5.6812 F3000
+G1 X31.820 Y2.500 Z-5.6666 F3000
+G1 X31.800 Y2.500 Z-5.6519 F3000
+G1 X31.780 Y2.500 Z-5.6373 F3000
+G1 X31.760 Y2.500 Z-5.6228 F3000
+G1 X31.740 Y2.500 Z-5.6083 F3000
+G1 X31.720 Y2.500 Z-5.5938 F3000
+G1 X31.700 Y2.500 Z-5.5793 F3000
+G1 X31.680 Y2.500 Z-5.5649 F3000
+G1 X31.660 Y2.500 Z-5.5506 F3000
+G1 X31.640 Y2.500 Z-5.5362 F3000
+G1 X31.620 Y2.500 Z-5.5219 F3000
+G1 X31.600 Y2.500 Z-5.5077 F3000
+G1 X31.580 Y2.500 Z-5.4934 F3000
+G1 X31.560 Y2.500 Z-5.4793 F3000
+G1 X31.540 Y2.500 Z-5.4651 F3000
+G1 X31.520 Y2.500 Z-5.4510 F3000
+G1 X31.500 Y2.500 Z-5.4369 F3000
+G1 X31.480 Y2.500 Z-5.4229 F3000
+G1 X31.460 Y2.500 Z-5.4089 F3000
+G1 X31.440 Y2.500 Z-5.3949 F3000
+G1 X31.420 Y2.500 Z-5.3810 F3000
+G1 X31.400 Y2.500 Z-5.3671 F3000
+G1 X31.380 Y2.500 Z-5.3532 F3000
+G1 X31.360 Y2.500 Z-5.3394 F3000
+G1 X31.340 Y2.500 Z-5.3256 F3000
+G1 X31.320 Y2.500 Z-5.3119 F3000
+G1 X31.300 Y2.500 Z-5.2982 F3000
+G1 X31.280 Y2.500 Z-5.2845 F3000
+G1 X31.260 Y2.500 Z-5.2709 F3000
+G1 X31.240 Y2.500 Z-5.2573 F3000
+G1 X31.220 Y2.500 Z-5.2437 F3000
+G1 X31.200 Y2.500 Z-5.2301 F3000
+G1 X31.180 Y2.500 Z-5.2166 F3000
+G1 X31.160 Y2.500 Z-5.2032 F3000
+G1 X31.140 Y2.500 Z-5.1898 F3000
+G1 X31.120 Y2.500 Z-5.1764 F3000
+G1 X31.100 Y2.500 Z-5.1630 F3000
+G1 X31.080 Y2.500 Z-5.1497 F3000
+G1 X31.060 Y2.500 Z-5.1364 F3000
+G1 X31.040 Y2.500 Z-5.1231 F3000
+G1 X31.020 Y2.500 Z-5.1099 F3000
+G1 X31.000 Y2.500 Z-5.0967 F3000
+G1 X30.980 Y2.500 Z-5.0836 F3000
+G1 X30.960 Y2.500 Z-5.0704 F3000
+G1 X30.940 Y2.500 Z-5.0573 F3000
+G1 X30.920 Y2.500 Z-5.0443 F3000
+G1 X30.900 Y2.500 Z-5.0313 F3000
+G1 X30.880 Y2.500 Z-5.0183 F3000
+G1 X30.860 Y2.500 Z-5.0053 F3000
+G1 X30.840 Y2.500 Z-4.9924 F3000
+G1 X30.820 Y2.500 Z-4.9795 F3000
+G1 X30.800 Y2.500 Z-4.9667 F3000
+G1 X30.780 Y2.500 Z-4.9539 F3000
+G1 X30.760 Y2.500 Z-4.9411 F3000
+G1 X30.740 Y2.500 Z-4.9284 F3000
+G1 X30.720 Y2.500 Z-4.9156 F3000
+G1 X30.700 Y2.500 Z-4.9030 F3000
+G1 X30.680 Y2.500 Z-4.8903 F3000
+G1 X30.660 Y2.500 Z-4.8777 F3000
+G1 X30.640 Y2.500 Z-4.8651 F3000
+G1 X30.620 Y2.500 Z-4.8526 F3000
+G1 X30.600 Y2.500 Z-4.8400 F3000
+G1 X30.580 Y2.500 Z-4.8276 F3000
+G1 X30.560 Y2.500 Z-4.8151 F3000
+G1 X30.540 Y2.500 Z-4.8027 F3000
+G1 X30.520 Y2.500 Z-4.7903 F3000
+G1 X30.500 Y2.500 Z-4.7780 F3000
+G1 X30.480 Y2.500 Z-4.7656 F3000
+G1 X30.460 Y2.500 Z-4.7533 F3000
+G1 X30.440 Y2.500 Z-4.7411 F3000
+G1 X30.420 Y2.500 Z-4.7289 F3000
+G1 X30.400 Y2.500 Z-4.7167 F3000
+G1 X30.380 Y2.500 Z-4.7045 F3000
+G1 X30.360 Y2.500 Z-4.6924 F3000
+G1 X30.340 Y2.500 Z-4.6803 F3000
+G1 X30.320 Y2.500 Z-4.6682 F3000
+G1 X30.300 Y2.500 Z-4.6562 F3000
+G1 X30.280 Y2.500 Z-4.6442 F3000
+G1 X30.260 Y2.500 Z-4.6322 F3000
+G1 X30.240 Y2.500 Z-4.6203 F3000
+G1 X30.220 Y2.500 Z-4.6084 F3000
+G1 X30.200 Y2.500 Z-4.5965 F3000
+G1 X30.180 Y2.500 Z-4.5847 F3000
+G1 X30.160 Y2.500 Z-4.5729 F3000
+G1 X30.140 Y2.500 Z-4.5611 F3000
+G1 X30.120 Y2.500 Z-4.5493 F3000
+G1 X30.100 Y2.500 Z-4.5376 F3000
+G1 X30.080 Y2.500 Z-4.5259 F3000
+G1 X30.060 Y2.500 Z-4.5143 F3000
+G1 X30.040 Y2.500 Z-4.5026 F3000
+G1 X30.020 Y2.500 Z-4.4911 F3000
+G1 X30.000 Y2.500 Z-4.4795 F3000
+G1 X29.980 Y2.500 Z-4.4680 F3000
+G1 X29.960 Y2.500 Z-4.4565 F3000
+G1 X29.940 Y2.500 Z-4.4450 F3000
+G1 X29.920 Y2.500 Z-4.4335 F3000
+G1 X29.900 Y2.500 Z-4.4221 F3000
+G1 X29.880 Y2.500 Z-4.4108 F3000
+G1 X29.860 Y2.500 Z-4.3994 F3000
+G1 X29.840 Y2.500 Z-4.3881 F3000
+G1 X29.820 Y2.500 Z-4.3768 F3000
+G1 X29.800 Y2.500 Z-4.3656 F3000
+G1 X29.780 Y2.500 Z-4.3543 F3000
+G1 X29.760 Y2.500 Z-4.3431 F3000
+G1 X29.740 Y2.500 Z-4.3320 F3000
+G1 X29.720 Y2.500 Z-4.3208 F3000
+G1 X29.700 Y2.500 Z-4.3097 F3000
+G1 X29.680 Y2.500 Z-4.2986 F3000
+G1 X29.660 Y2.500 Z-4.2876 F3000
+G1 X29.640 Y2.500 Z-4.2766 F3000
+G1 X29.620 Y2.500 Z-4.2656 F3000
+G1 X29.600 Y2.500 Z-4.2546 F3000
+G1 X29.580 Y2.500 Z-4.2437 F3000
+G1 X29.560 Y2.500 Z-4.2328 F3000
+G1 X29.540 Y2.500 Z-4.2219 F3000
+G1 X29.520 Y2.500 Z-4.2111 F3000
+G1 X29.500 Y2.500 Z-4.2003 F3000
+G1 X29.480 Y2.500 Z-4.1895 F3000
+G1 X29.460 Y2.500 Z-4.1788 F3000
+G1 X29.440 Y2.500 Z-4.1680 F3000
+G1 X29.420 Y2.500 Z-4.1573 F3000
+G1 X29.400 Y2.500 Z-4.1467 F3000
+G1 X29.380 Y2.500 Z-4.1360 F3000
+G1 X29.360 Y2.500 Z-4.1254 F3000
+G1 X29.340 Y2.500 Z-4.1149 F3000
+G1 X29.320 Y2.500 Z-4.1043 F3000
+G1 X29.300 Y2.500 Z-4.0938 F3000
+G1 X29.280 Y2.500 Z-4.0833 F3000
+G1 X29.260 Y2.500 Z-4.0728 F3000
+G1 X29.240 Y2.500 Z-4.0624 F3000
+G1 X29.220 Y2.500 Z-4.0520 F3000
+G1 X29.200 Y2.500 Z-4.0416 F3000
+G1 X29.180 Y2.500 Z-4.0313 F3000
+G1 X29.160 Y2.500 Z-4.0210 F3000
+G1 X29.140 Y2.500 Z-4.0107 F3000
+G1 X29.120 Y2.500 Z-4.0004 F3000
+G1 X29.100 Y2.500 Z-3.9902 F3000
+G1 X29.080 Y2.500 Z-3.9800 F3000
+G1 X29.060 Y2.500 Z-3.9698 F3000
+G1 X29.040 Y2.500 Z-3.9596 F3000
+G1 X29.020 Y2.500 Z-3.9495 F3000
+G1 X29.000 Y2.500 Z-3.9394 F3000
+G1 X28.980 Y2.500 Z-3.9294 F3000
+G1 X28.960 Y2.500 Z-3.9193 F3000
+G1 X28.940 Y2.500 Z-3.9093 F3000
+G1 X28.920 Y2.500 Z-3.8993 F3000
+G1 X28.900 Y2.500 Z-3.8894 F3000
+G1 X28.880 Y2.500 Z-3.8795 F3000
+G1 X28.860 Y2.500 Z-3.8696 F3000
+G1 X28.840 Y2.500 Z-3.8597 F3000
+G1 X28.820 Y2.500 Z-3.8499 F3000
+G1 X28.800 Y2.500 Z-3.8400 F3000
+G1 X28.780 Y2.500 Z-3.8303 F3000
+G1 X28.760 Y2.500 Z-3.8205 F3000
+G1 X28.740 Y2.500 Z-3.8108 F3000
+G1 X28.720 Y2.500 Z-3.8011 F3000
+G1 X28.700 Y2.500 Z-3.7914 F3000
+G1 X28.680 Y2.500 Z-3.7817 F3000
+G1 X28.660 Y2.500 Z-3.7721 F3000
+G1 X28.640 Y2.500 Z-3.7625 F3000
+G1 X28.620 Y2.500 Z-3.7530 F3000
+G1 X28.600 Y2.500 Z-3.7434 F3000
+G1 X28.580 Y2.500 Z-3.7339 F3000
+G1 X28.560 Y2.500 Z-3.7244 F3000
+G1 X28.540 Y2.500 Z-3.7150 F3000
+G1 X28.520 Y2.500 Z-3.7055 F3000
+G1 X28.500 Y2.500 Z-3.6961 F3000
+G1 X28.480 Y2.500 Z-3.6868 F3000
+G1 X28.460 Y2.500 Z-3.6774 F3000
+G1 X28.440 Y2.500 Z-3.6681 F3000
+G1 X28.420 Y2.500 Z-3.6588 F3000
+G1 X28.400 Y2.500 Z-3.6495 F3000
+G1 X28.380 Y2.500 Z-3.6403 F3000
+G1 X28.360 Y2.500 Z-3.6311 F3000
+G1 X28.340 Y2.500 Z-3.6219 F3000
+G1 X28.320 Y2.500 Z-3.6127 F3000
+G1 X28.300 Y2.500 Z-3.6036 F3000
+G1 X28.280 Y2.500 Z-3.5945 F3000
+G1 X28.260 Y2.500 Z-3.5854 F3000
+G1 X28.240 Y2.500 Z-3.5763 F3000
+G1 X28.220 Y2.500 Z-3.5673 F3000
+G1 X28.200 Y2.500 Z-3.5583 F3000
+G1 X28.180 Y2.500 Z-3.5493 F3000
+G1 X28.160 Y2.500 Z-3.5404 F3000
+G1 X28.140 Y2.500 Z-3.5314 F3000
+G1 X28.120 Y2.500 Z-3.5225 F3000
+G1 X28.100 Y2.500 Z-3.5137 F3000
+G1 X28.080 Y2.500 Z-3.5048 F3000
+G1 X28.060 Y2.500 Z-3.4960 F3000
+G1 X28.040 Y2.500 Z-3.4872 F3000
+G1 X28.020 Y2.500 Z-3.4784 F3000
+G1 X28.000 Y2.500 Z-3.4697 F3000
+G1 X27.980 Y2.500 Z-3.4610 F3000
+G1 X27.960 Y2.500 Z-3.4523 F3000
+G1 X27.940 Y2.500 Z-3.4436 F3000
+G1 X27.920 Y2.500 Z-3.4350 F3000
+G1 X27.900 Y2.500 Z-3.4264 F3000
+G1 X27.880 Y2.500 Z-3.4178 F3000
+G1 X27.860 Y2.500 Z-3.4092 F3000
+G1 X27.840 Y2.500 Z-3.4007 F3000
+G1 X27.820 Y2.500 Z-3.3922 F3000
+G1 X27.800 Y2.500 Z-3.3837 F3000
+G1 X27.780 Y2.500 Z-3.3752 F3000
+G1 X27.760 Y2.500 Z-3.3668 F3000
+G1 X27.740 Y2.500 Z-3.3584 F3000
+G1 X27.720 Y2.500 Z-3.3500 F3000
+G1 X27.700 Y2.500 Z-3.3417 F3000
+G1 X27.680 Y2.500 Z-3.3333 F3000
+G1 X27.660 Y2.500 Z-3.3250 F3000
+G1 X27.640 Y2.500 Z-3.3168 F3000
+G1 X27.620 Y2.500 Z-3.3085 F3000
+G1 X27.600 Y2.500 Z-3.3003 F3000
+G1 X27.580 Y2.500 Z-3.2921 F3000
+G1 X27.560 Y2.500 Z-3.2839 F3000
+G1 X27.540 Y2.500 Z-3.2757 F3000
+G1 X27.520 Y2.500 Z-3.2676 F3000
+G1 X27.500 Y2.500 Z-3.2595 F3000
+G1 X27.480 Y2.500 Z-3.2514 F3000
+G1 X27.460 Y2.500 Z-3.2434 F3000
+G1 X27.440 Y2.500 Z-3.2353 F3000
+G1 X27.420 Y2.500 Z-3.2273 F3000
+G1 X27.400 Y2.500 Z-3.2194 F3000
+G1 X27.380 Y2.500 Z-3.2114 F3000
+G1 X27.360 Y2.500 Z-3.2035 F3000
+G1 X27.340 Y2.500 Z-3.1956 F3000
+G1 X27.320 Y2.500 Z-3.1877 F3000
+G1 X27.300 Y2.500 Z-3.1798 F3000
+G1 X27.280 Y2.500 Z-3.1720 F3000
+G1 X27.260 Y2.500 Z-3.1642 F3000
+G1 X27.240 Y2.500 Z-3.1564 F3000
+G1 X27.220 Y2.500 Z-3.1487 F3000
+G1 X27.200 Y2.500 Z-3.1410 F3000
+G1 X27.180 Y2.500 Z-3.1332 F3000
+G1 X27.160 Y2.500 Z-3.1256 F3000
+G1 X27.140 Y2.500 Z-3.1179 F3000
+G1 X27.120 Y2.500 Z-3.1103 F3000
+G1 X27.100 Y2.500 Z-3.1027 F3000
+G1 X27.080 Y2.500 Z-3.0951 F3000
+G1 X27.060 Y2.500 Z-3.0875 F3000
+G1 X27.040 Y2.500 Z-3.0800 F3000
+G1 X27.020 Y2.500 Z-3.0725 F3000
+G1 X27.000 Y2.500 Z-3.0650 F3000
+G1 X26.980 Y2.500 Z-3.0575 F3000
+G1 X26.960 Y2.500 Z-3.0501 F3000
+G1 X26.940 Y2.500 Z-3.0427 F3000
+G1 X26.920 Y2.500 Z-3.0353 F3000
+G1 X26.900 Y2.500 Z-3.0279 F3000
+G1 X26.880 Y2.500 Z-3.0206 F3000
+G1 X26.860 Y2.500 Z-3.0133 F3000
+G1 X26.840 Y2.500 Z-3.0060 F3000
+G1 X26.820 Y2.500 Z-2.9987 F3000
+G1 X26.800 Y2.500 Z-2.9915 F3000
+G1 X26.780 Y2.500 Z-2.9843 F3000
+G1 X26.760 Y2.500 Z-2.9771 F3000
+G1 X26.740 Y2.500 Z-2.9699 F3000
+G1 X26.720 Y2.500 Z-2.9628 F3000
+G1 X26.700 Y2.500 Z-2.9556 F3000
+G1 X26.680 Y2.500 Z-2.9485 F3000
+G1 X26.660 Y2.500 Z-2.9415 F3000
+G1 X26.640 Y2.500 Z-2.9344 F3000
+G1 X26.620 Y2.500 Z-2.9274 F3000
+G1 X26.600 Y2.500 Z-2.9204 F3000
+G1 X26.580 Y2.500 Z-2.9134 F3000
+G1 X26.560 Y2.500 Z-2.9064 F3000
+G1 X26.540 Y2.500 Z-2.8995 F3000
+G1 X26.520 Y2.500 Z-2.8926 F3000
+G1 X26.500 Y2.500 Z-2.8857 F3000
+G1 X26.480 Y2.500 Z-2.8789 F3000
+G1 X26.460 Y2.500 Z-2.8720 F3000
+G1 X26.440 Y2.500 Z-2.8652 F3000
+G1 X26.420 Y2.500 Z-2.8584 F3000
+G1 X26.400 Y2.500 Z-2.8516 F3000
+G1 X26.380 Y2.500 Z-2.8449 F3000
+G1 X26.360 Y2.500 Z-2.8382 F3000
+G1 X26.340 Y2.500 Z-2.8315 F3000
+G1 X26.320 Y2.500 Z-2.8248 F3000
+G1 X26.300 Y2.500 Z-2.8182 F3000
+G1 X26.280 Y2.500 Z-2.8115 F3000
+G1 X26.260 Y2.500 Z-2.8049 F3000
+G1 X26.240 Y2.500 Z-2.7984 F3000
+G1 X26.220 Y2.500 Z-2.7918 F3000
+G1 X26.200 Y2.500 Z-2.7853 F3000
+G1 X26.180 Y2.500 Z-2.7788 F3000
+G1 X26.160 Y2.500 Z-2.7723 F3000
+G1 X26.140 Y2.500 Z-2.7658 F3000
+G1 X26.120 Y2.500 Z-2.7594 F3000
+G1 X26.100 Y2.500 Z-2.7530 F3000
+G1 X26.080 Y2.500 Z-2.7466 F3000
+G1 X26.060 Y2.500 Z-2.7402 F3000
+G1 X26.040 Y2.500 Z-2.7338 F3000
+G1 X26.020 Y2.500 Z-2.7275 F3000
+G1 X26.000 Y2.500 Z-2.7212 F3000
+G1 X25.980 Y2.500 Z-2.7149 F3000
+G1 X25.960 Y2.500 Z-2.7087 F3000
+G1 X25.940 Y2.500 Z-2.7025 F3000
+G1 X25.920 Y2.500 Z-2.6962 F3000
+G1 X25.900 Y2.500 Z-2.6901 F3000
+G1 X25.880 Y2.500 Z-2.6839 F3000
+G1 X25.860 Y2.500 Z-2.6778 F3000
+G1 X25.840 Y2.500 Z-2.6716 F3000
+G1 X25.820 Y2.500 Z-2.6655 F3000
+G1 X25.800 Y2.500 Z-2.6595 F3000
+G1 X25.780 Y2.500 Z-2.6534 F3000
+G1 X25.760 Y2.500 Z-2.6474 F3000
+G1 X25.740 Y2.500 Z-2.6414 F3000
+G1 X25.720 Y2.500 Z-2.6354 F3000
+G1 X25.700 Y2.500 Z-2.6294 F3000
+G1 X25.680 Y2.500 Z-2.6235 F3000
+G1 X25.660 Y2.500 Z-2.6176 F3000
+G1 X25.640 Y2.500 Z-2.6117 F3000
+G1 X25.620 Y2.500 Z-2.6058 F3000
+G1 X25.600 Y2.500 Z-2.6000 F3000
+G1 X25.580 Y2.500 Z-2.5942 F3000
+G1 X25.560 Y2.500 Z-2.5884 F3000
+G1 X25.540 Y2.500 Z-2.5826 F3000
+G1 X25.520 Y2.500 Z-2.5768 F3000
+G1 X25.500 Y2.500 Z-2.5711 F3000
+G1 X25.480 Y2.500 Z-2.5654 F3000
+G1 X25.460 Y2.500 Z-2.5597 F3000
+G1 X25.440 Y2.500 Z-2.5541 F3000
+G1 X25.420 Y2.500 Z-2.5484 F3000
+G1 X25.400 Y2.500 Z-2.5428 F3000
+G1 X25.380 Y2.500 Z-2.5372 F3000
+G1 X25.360 Y2.500 Z-2.5316 F3000
+G1 X25.340 Y2.500 Z-2.5261 F3000
+G1 X25.320 Y2.500 Z-2.5205 F3000
+G1 X25.300 Y2.500 Z-2.5150 F3000
+G1 X25.280 Y2.500 Z-2.5095 F3000
+G1 X25.260 Y2.500 Z-2.5041 F3000
+G1 X25.240 Y2.500 Z-2.4986 F3000
+G1 X25.220 Y2.500 Z-2.4932 F3000
+G1 X25.200 Y2.500 Z-2.4878 F3000
+G1 X25.180 Y2.500 Z-2.4825 F3000
+G1 X25.160 Y2.500 Z-2.4771 F3000
+G1 X25.140 Y2.500 Z-2.4718 F3000
+G1 X25.120 Y2.500 Z-2.4665 F3000
+G1 X25.100 Y2.500 Z-2.4612 F3000
+G1 X25.080 Y2.500 Z-2.4559 F3000
+G1 X25.060 Y2.500 Z-2.4507 F3000
+G1 X25.040 Y2.500 Z-2.4455 F3000
+G1 X25.020 Y2.500 Z-2.4403 F3000
+G1 X25.000 Y2.500 Z-2.4351 F3000
+G1 X24.980 Y2.500 Z-2.4299 F3000
+G1 X24.960 Y2.500 Z-2.4248 F3000
+G1 X24.940 Y2.500 Z-2.4197 F3000
+G1 X24.920 Y2.500 Z-2.4146 F3000
+G1 X24.900 Y2.500 Z-2.4095 F3000
+G1 X24.880 Y2.500 Z-2.4045 F3000
+G1 X24.860 Y2.500 Z-2.3995 F3000
+G1 X24.840 Y2.500 Z-2.3945 F3000
+G1 X24.820 Y2.500 Z-2.3895 F3000
+G1 X24.800 Y2.500 Z-2.3845 F3000
+G1 X24.780 Y2.500 Z-2.3796 F3000
+G1 X24.760 Y2.500 Z-2.3747 F3000
+G1 X24.740 Y2.500 Z-2.3698 F3000
+G1 X24.720 Y2.500 Z-2.3649 F3000
+G1 X24.700 Y2.500 Z-2.3601 F3000
+G1 X24.680 Y2.500 Z-2.3553 F3000
+G1 X24.660 Y2.500 Z-2.3505 F3000
+G1 X24.640 Y2.500 Z-2.3457 F3000
+G1 X24.620 Y2.500 Z-2.3409 F3000
+G1 X24.600 Y2.500 Z-2.3362 F3000
+G1 X24.580 Y2.500 Z-2.3315 F3000
+G1 X24.560 Y2.500 Z-2.3268 F3000
+G1 X24.540 Y2.500 Z-2.3221 F3000
+G1 X24.520 Y2.500 Z-2.3175 F3000
+G1 X24.500 Y2.500 Z-2.3128 F3000
+G1 X24.480 Y2.500 Z-2.3082 F3000
+G1 X24.460 Y2.500 Z-2.3036 F3000
+G1 X24.440 Y2.500 Z-2.2991 F3000
+G1 X24.420 Y2.500 Z-2.2945 F3000
+G1 X24.400 Y2.500 Z-2.2900 F3000
+G1 X24.380 Y2.500 Z-2.2855 F3000
+G1 X24.360 Y2.500 Z-2.2810 F3000
+G1 X24.340 Y2.500 Z-2.2766 F3000
+G1 X24.320 Y2.500 Z-2.2721 F3000
+G1 X24.300 Y2.500 Z-2.2677 F3000
+G1 X24.280 Y2.500 Z-2.2633 F3000
+G1 X24.260 Y2.500 Z-2.2590 F3000
+G1 X24.240 Y2.500 Z-2.2546 F3000
+G1 X24.220 Y2.500 Z-2.2503 F3000
+G1 X24.200 Y2.500 Z-2.2460 F3000
+G1 X24.180 Y2.500 Z-2.2417 F3000
+G1 X24.160 Y2.500 Z-2.2374 F3000
+G1 X24.140 Y2.500 Z-2.2332 F3000
+G1 X24.120 Y2.500 Z-2.2290 F3000
+G1 X24.100 Y2.500 Z-2.2248 F3000
+G1 X24.080 Y2.500 Z-2.2206 F3000
+G1 X24.060 Y2.500 Z-2.2164 F3000
+G1 X24.040 Y2.500 Z-2.2123 F3000
+G1 X24.020 Y2.500 Z-2.2082 F3000
+G1 X24.000 Y2.500 Z-2.2041 F3000
+G1 X23.980 Y2.500 Z-2.2000 F3000
+G1 X23.960 Y2.500 Z-2.1960 F3000
+G1 X23.940 Y2.500 Z-2.1919 F3000
+G1 X23.920 Y2.500 Z-2.1879 F3000
+G1 X23.900 Y2.500 Z-2.1839 F3000
+G1 X23.880 Y2.500 Z-2.1800 F3000
+G1 X23.860 Y2.500 Z-2.1760 F3000
+G1 X23.840 Y2.500 Z-2.1721 F3000
+G1 X23.820 Y2.500 Z-2.1682 F3000
+G1 X23.800 Y2.500 Z-2.1643 F3000
+G1 X23.780 Y2.500 Z-2.1605 F3000
+G1 X23.760 Y2.500 Z-2.1566 F3000
+G1 X23.740 Y2.500 Z-2.1528 F3000
+G1 X23.720 Y2.500 Z-2.1490 F3000
+G1 X23.700 Y2.500 Z-2.1452 F3000
+G1 X23.680 Y2.500 Z-2.1415 F3000
+G1 X23.660 Y2.500 Z-2.1377 F3000
+G1 X23.640 Y2.500 Z-2.1340 F3000
+G1 X23.620 Y2.500 Z-2.1303 F3000
+G1 X23.600 Y2.500 Z-2.1267 F3000
+G1 X23.580 Y2.500 Z-2.1230 F3000
+G1 X23.560 Y2.500 Z-2.1194 F3000
+G1 X23.540 Y2.500 Z-2.1158 F3000
+G1 X23.520 Y2.500 Z-2.1122 F3000
+G1 X23.500 Y2.500 Z-2.1086 F3000
+G1 X23.480 Y2.500 Z-2.1051 F3000
+G1 X23.460 Y2.500 Z-2.1016 F3000
+G1 X23.440 Y2.500 Z-2.0981 F3000
+G1 X23.420 Y2.500 Z-2.0946 F3000
+G1 X23.400 Y2.500 Z-2.0911 F3000
+G1 X23.380 Y2.500 Z-2.0877 F3000
+G1 X23.360 Y2.500 Z-2.0843 F3000
+G1 X23.340 Y2.500 Z-2.0809 F3000
+G1 X23.320 Y2.500 Z-2.0775 F3000
+G1 X23.300 Y2.500 Z-2.0741 F3000
+G1 X23.280 Y2.500 Z-2.0708 F3000
+G1 X23.260 Y2.500 Z-2.0675 F3000
+G1 X23.240 Y2.500 Z-2.0642 F3000
+G1 X23.220 Y2.500 Z-2.0609 F3000
+G1 X23.200 Y2.500 Z-2.0577 F3000
+G1 X23.180 Y2.500 Z-2.0544 F3000
+G1 X23.160 Y2.500 Z-2.0512 F3000
+G1 X23.140 Y2.500 Z-2.0480 F3000
+G1 X23.120 Y2.500 Z-2.0449 F3000
+G1 X23.100 Y2.500 Z-2.0417 F3000
+G1 X23.080 Y2.500 Z-2.0386 F3000
+G1 X23.060 Y2.500 Z-2.0355 F3000
+G1 X23.040 Y2.500 Z-2.0324 F3000
+G1 X23.020 Y2.500 Z-2.0293 F3000
+G1 X23.000 Y2.500 Z-2.0263 F3000
+G1 X22.980 Y2.500 Z-2.0233 F3000
+G1 X22.960 Y2.500 Z-2.0203 F3000
+G1 X22.940 Y2.500 Z-2.0173 F3000
+G1 X22.920 Y2.500 Z-2.0143 F3000
+G1 X22.900 Y2.500 Z-2.0114 F3000
+G1 X22.880 Y2.500 Z-2.0084 F3000
+G1 X22.860 Y2.500 Z-2.0055 F3000
+G1 X22.840 Y2.500 Z-2.0027 F3000
+G1 X22.820 Y2.500 Z-1.9998 F3000
+G1 X22.800 Y2.500 Z-1.9970 F3000
+G1 X22.780 Y2.500 Z-1.9942 F3000
+G1 X22.760 Y2.500 Z-1.9914 F3000
+G1 X22.740 Y2.500 Z-1.9886 F3000
+G1 X22.720 Y2.500 Z-1.9858 F3000
+G1 X22.700 Y2.500 Z-1.9831 F3000
+G1 X22.680 Y2.500 Z-1.9804 F3000
+G1 X22.660 Y2.500 Z-1.9777 F3000
+G1 X22.640 Y2.500 Z-1.9750 F3000
+G1 X22.620 Y2.500 Z-1.9724 F3000
+G1 X22.600 Y2.500 Z-1.9697 F3000
+G1 X22.580 Y2.500 Z-1.9671 F3000
+G1 X22.560 Y2.500 Z-1.9645 F3000
+G1 X22.540 Y2.500 Z-1.9619 F3000
+G1 X22.520 Y2.500 Z-1.9594 F3000
+G1 X22.500 Y2.500 Z-1.9569 F3000
+G1 X22.480 Y2.500 Z-1.9544 F3000
+G1 X22.460 Y2.500 Z-1.9519 F3000
+G1 X22.440 Y2.500 Z-1.9494 F3000
+G1 X22.420 Y2.500 Z-1.9469 F3000
+G1 X22.400 Y2.500 Z-1.9445 F3000
+G1 X22.380 Y2.500 Z-1.9421 F3000
+G1 X22.360 Y2.500 Z-1.9397 F3000
+G1 X22.340 Y2.500 Z-1.9374 F3000
+G1 X22.320 Y2.500 Z-1.9350 F3000
+G1 X22.300 Y2.500 Z-1.9327 F3000
+G1 X22.280 Y2.500 Z-1.9304 F3000
+G1 X22.260 Y2.500 Z-1.9281 F3000
+G1 X22.240 Y2.500 Z-1.9258 F3000
+G1 X22.220 Y2.500 Z-1.9236 F3000
+G1 X22.200 Y2.500 Z-1.9214 F3000
+G1 X22.180 Y2.500 Z-1.9192 F3000
+G1 X22.160 Y2.500 Z-1.9170 F3000
+G1 X22.140 Y2.500 Z-1.9148 F3000
+G1 X22.120 Y2.500 Z-1.9127 F3000
+G1 X22.100 Y2.500 Z-1.9106 F3000
+G1 X22.080 Y2.500 Z-1.9085 F3000
+G1 X22.060 Y2.500 Z-1.9064 F3000
+G1 X22.040 Y2.500 Z-1.9043 F3000
+G1 X22.020 Y2.500 Z-1.9023 F3000
+G1 X22.000 Y2.500 Z-1.9003 F3000
+G1 X21.980 Y2.500 Z-1.8983 F3000
+G1 X21.960 Y2.500 Z-1.8963 F3000
+G1 X21.940 Y2.500 Z-1.8943 F3000
+G1 X21.920 Y2.500 Z-1.8924 F3000
+G1 X21.900 Y2.500 Z-1.8905 F3000
+G1 X21.880 Y2.500 Z-1.8886 F3000
+G1 X21.860 Y2.500 Z-1.8867 F3000
+G1 X21.840 Y2.500 Z-1.8848 F3000
+G1 X21.820 Y2.500 Z-1.8830 F3000
+G1 X21.800 Y2.500 Z-1.8812 F3000
+G1 X21.780 Y2.500 Z-1.8794 F3000
+G1 X21.760 Y2.500 Z-1.8776 F3000
+G1 X21.740 Y2.500 Z-1.8758 F3000
+G1 X21.720 Y2.500 Z-1.8741 F3000
+G1 X21.700 Y2.500 Z-1.8724 F3000
+G1 X21.680 Y2.500 Z-1.8707 F3000
+G1 X21.660 Y2.500 Z-1.8690 F3000
+G1 X21.640 Y2.500 Z-1.8674 F3000
+G1 X21.620 Y2.500 Z-1.8657 F3000
+G1 X21.600 Y2.500 Z-1.8641 F3000
+G1 X21.580 Y2.500 Z-1.8625 F3000
+G1 X21.560 Y2.500 Z-1.8609 F3000
+G1 X21.540 Y2.500 Z-1.8594 F3000
+G1 X21.520 Y2.500 Z-1.8578 F3000
+G1 X21.500 Y2.500 Z-1.8563 F3000
+G1 X21.480 Y2.500 Z-1.8548 F3000
+G1 X21.460 Y2.500 Z-1.8534 F3000
+G1 X21.440 Y2.500 Z-1.8519 F3000
+G1 X21.420 Y2.500 Z-1.8505 F3000
+G1 X21.400 Y2.500 Z-1.8491 F3000
+G1 X21.380 Y2.500 Z-1.8477 F3000
+G1 X21.360 Y2.500 Z-1.8463 F3000
+G1 X21.340 Y2.500 Z-1.8449 F3000
+G1 X21.320 Y2.500 Z-1.8436 F3000
+G1 X21.300 Y2.500 Z-1.8423 F3000
+G1 X21.280 Y2.500 Z-1.8410 F3000
+G1 X21.260 Y2.500 Z-1.8397 F3000
+G1 X21.240 Y2.500 Z-1.8385 F3000
+G1 X21.220 Y2.500 Z-1.8372 F3000
+G1 X21.200 Y2.500 Z-1.8360 F3000
+G1 X21.180 Y2.500 Z-1.8348 F3000
+G1 X21.160 Y2.500 Z-1.8337 F3000
+G1 X21.140 Y2.500 Z-1.8325 F3000
+G1 X21.120 Y2.500 Z-1.8314 F3000
+G1 X21.100 Y2.500 Z-1.8303 F3000
+G1 X21.080 Y2.500 Z-1.8292 F3000
+G1 X21.060 Y2.500 Z-1.8281 F3000
+G1 X21.040 Y2.500 Z-1.8271 F3000
+G1 X21.020 Y2.500 Z-1.8260 F3000
+G1 X21.000 Y2.500 Z-1.8250 F3000
+G1 X20.980 Y2.500 Z-1.8240 F3000
+G1 X20.960 Y2.500 Z-1.8231 F3000
+G1 X20.940 Y2.500 Z-1.8221 F3000
+G1 X20.920 Y2.500 Z-1.8212 F3000
+G1 X20.900 Y2.500 Z-1.8203 F3000
+G1 X20.880 Y2.500 Z-1.8194 F3000
+G1 X20.860 Y2.500 Z-1.8185 F3000
+G1 X20.840 Y2.500 Z-1.8176 F3000
+G1 X20.820 Y2.500 Z-1.8168 F3000
+G1 X20.800 Y2.500 Z-1.8160 F3000
+G1 X20.780 Y2.500 Z-1.8152 F3000
+G1 X20.760 Y2.500 Z-1.8144 F3000
+G1 X20.740 Y2.500 Z-1.8137 F3000
+G1 X20.720 Y2.500 Z-1.8130 F3000
+G1 X20.700 Y2.500 Z-1.8123 F3000
+G1 X20.680 Y2.500 Z-1.8116 F3000
+G1 X20.660 Y2.500 Z-1.8109 F3000
+G1 X20.640 Y2.500 Z-1.8102 F3000
+G1 X20.620 Y2.500 Z-1.8096 F3000
+G1 X20.600 Y2.500 Z-1.8090 F3000
+G1 X20.580 Y2.500 Z-1.8084 F3000
+G1 X20.560 Y2.500 Z-1.8078 F3000
+G1 X20.540 Y2.500 Z-1.8073 F3000
+G1 X20.520 Y2.500 Z-1.8068 F3000
+G1 X20.500 Y2.500 Z-1.8063 F3000
+G1 X20.480 Y2.500 Z-1.8058 F3000
+G1 X20.460 Y2.500 Z-1.8053 F3000
+G1 X20.440 Y2.500 Z-1.8048 F3000
+G1 X20.420 Y2.500 Z-1.8044 F3000
+G1 X20.400 Y2.500 Z-1.8040 F3000
+G1 X20.380 Y2.500 Z-1.8036 F3000
+G1 X20.360 Y2.500 Z-1.8032 F3000
+G1 X20.340 Y2.500 Z-1.8029 F3000
+G1 X20.320 Y2.500 Z-1.8026 F3000
+G1 X20.300 Y2.500 Z-1.8023 F3000
+G1 X20.280 Y2.500 Z-1.8020 F3000
+G1 X20.260 Y2.500 Z-1.8017 F3000
+G1 X20.240 Y2.500 Z-1.8014 F3000
+G1 X20.220 Y2.500 Z-1.8012 F3000
+G1 X20.200 Y2.500 Z-1.8010 F3000
+G1 X20.180 Y2.500 Z-1.8008 F3000
+G1 X20.160 Y2.500 Z-1.8006 F3000
+G1 X20.140 Y2.500 Z-1.8005 F3000
+G1 X20.120 Y2.500 Z-1.8004 F3000
+G1 X20.100 Y2.500 Z-1.8003 F3000
+G1 X20.080 Y2.500 Z-1.8002 F3000
+G1 X20.060 Y2.500 Z-1.8001 F3000
+G1 X20.040 Y2.500 Z-1.8000 F3000
+G1 X20.020 Y2.500 Z-1.8000 F3000
+G1 X20.000 Y2.500 Z-1.8000 F3000
+G1 X19.980 Y2.500 Z-1.8000 F3000
+G1 X19.960 Y2.500 Z-1.8000 F3000
+G1 X19.940 Y2.500 Z-1.8001 F3000
+G1 X19.920 Y2.500 Z-1.8002 F3000
+G1 X19.900 Y2.500 Z-1.8003 F3000
+G1 X19.880 Y2.500 Z-1.8004 F3000
+G1 X19.860 Y2.500 Z-1.8005 F3000
+G1 X19.840 Y2.500 Z-1.8006 F3000
+G1 X19.820 Y2.500 Z-1.8008 F3000
+G1 X19.800 Y2.500 Z-1.8010 F3000
+G1 X19.780 Y2.500 Z-1.8012 F3000
+G1 X19.760 Y2.500 Z-1.8014 F3000
+G1 X19.740 Y2.500 Z-1.8017 F3000
+G1 X19.720 Y2.500 Z-1.8020 F3000
+G1 X19.700 Y2.500 Z-1.8023 F3000
+G1 X19.680 Y2.500 Z-1.8026 F3000
+G1 X19.660 Y2.500 Z-1.8029 F3000
+G1 X19.640 Y2.500 Z-1.8032 F3000
+G1 X19.620 Y2.500 Z-1.8036 F3000
+G1 X19.600 Y2.500 Z-1.8040 F3000
+G1 X19.580 Y2.500 Z-1.8044 F3000
+G1 X19.560 Y2.500 Z-1.8048 F3000
+G1 X19.540 Y2.500 Z-1.8053 F3000
+G1 X19.520 Y2.500 Z-1.8058 F3000
+G1 X19.500 Y2.500 Z-1.8063 F3000
+G1 X19.480 Y2.500 Z-1.8068 F3000
+G1 X19.460 Y2.500 Z-1.8073 F3000
+G1 X19.440 Y2.500 Z-1.8078 F3000
+G1 X19.420 Y2.500 Z-1.8084 F3000
+G1 X19.400 Y2.500 Z-1.8090 F3000
+G1 X19.380 Y2.500 Z-1.8096 F3000
+G1 X19.360 Y2.500 Z-1.8102 F3000
+G1 X19.340 Y2.500 Z-1.8109 F3000
+G1 X19.320 Y2.500 Z-1.8116 F3000
+G1 X19.300 Y2.500 Z-1.8123 F3000
+G1 X19.280 Y2.500 Z-1.8130 F3000
+G1 X19.260 Y2.500 Z-1.8137 F3000
+G1 X19.240 Y2.500 Z-1.8144 F3000
+G1 X19.220 Y2.500 Z-1.8152 F3000
+G1 X19.200 Y2.500 Z-1.8160 F3000
+G1 X19.180 Y2.500 Z-1.8168 F3000
+G1 X19.160 Y2.500 Z-1.8176 F3000
+G1 X19.140 Y2.500 Z-1.8185 F3000
+G1 X19.120 Y2.500 Z-1.8194 F3000
+G1 X19.100 Y2.500 Z-1.8203 F3000
+G1 X19.080 Y2.500 Z-1.8212 F3000
+G1 X19.060 Y2.500 Z-1.8221 F3000
+G1 X19.040 Y2.500 Z-1.8231 F3000
+G1 X19.020 Y2.500 Z-1.8240 F3000
+G1 X19.000 Y2.500 Z-1.8250 F3000
+G1 X18.980 Y2.500 Z-1.8260 F3000
+G1 X18.960 Y2.500 Z-1.8271 F3000
+G1 X18.940 Y2.500 Z-1.8281 F3000
+G1 X18.920 Y2.500 Z-1.8292 F3000
+G1 X18.900 Y2.500 Z-1.8303 F3000
+G1 X18.880 Y2.500 Z-1.8314 F3000
+G1 X18.860 Y2.500 Z-1.8325 F3000
+G1 X18.840 Y2.500 Z-1.8337 F3000
+G1 X18.820 Y2.500 Z-1.8348 F3000
+G1 X18.800 Y2.500 Z-1.8360 F3000
+G1 X18.780 Y2.500 Z-1.8372 F3000
+G1 X18.760 Y2.500 Z-1.8385 F3000
+G1 X18.740 Y2.500 Z-1.8397 F3000
+G1 X18.720 Y2.500 Z-1.8410 F3000
+G1 X18.700 Y2.500 Z-1.8423 F3000
+G1 X18.680 Y2.500 Z-1.8436 F3000
+G1 X18.660 Y2.500 Z-1.8449 F3000
+G1 X18.640 Y2.500 Z-1.8463 F3000
+G1 X18.620 Y2.500 Z-1.8477 F3000
+G1 X18.600 Y2.500 Z-1.8491 F3000
+G1 X18.580 Y2.500 Z-1.8505 F3000
+G1 X18.560 Y2.500 Z-1.8519 F3000
+G1 X18.540 Y2.500 Z-1.8534 F3000
+G1 X18.520 Y2.500 Z-1.8548 F3000
+G1 X18.500 Y2.500 Z-1.8563 F3000
+G1 X18.480 Y2.500 Z-1.8578 F3000
+G1 X18.460 Y2.500 Z-1.8594 F3000
+G1 X18.440 Y2.500 Z-1.8609 F3000
+G1 X18.420 Y2.500 Z-1.8625 F3000
+G1 X18.400 Y2.500 Z-1.8641 F3000
+G1 X18.380 Y2.500 Z-1.8657 F3000
+G1 X18.360 Y2.500 Z-1.8674 F3000
+G1 X18.340 Y2.500 Z-1.8690 F3000
+G1 X18.320 Y2.500 Z-1.8707 F3000
+G1 X18.300 Y2.500 Z-1.8724 F3000
+G1 X18.280 Y2.500 Z-1.8741 F3000
+G1 X18.260 Y2.500 Z-1.8758 F3000
+G1 X18.240 Y2.500 Z-1.8776 F3000
+G1 X18.220 Y2.500 Z-1.8794 F3000
+G1 X18.200 Y2.500 Z-1.8812 F3000
+G1 X18.180 Y2.500 Z-1.8830 F3000
+G1 X18.160 Y2.500 Z-1.8848 F3000
+G1 X18.140 Y2.500 Z-1.8867 F3000
+G1 X18.120 Y2.500 Z-1.8886 F3000
+G1 X18.100 Y2.500 Z-1.8905 F3000
+G1 X18.080 Y2.500 Z-1.8924 F3000
+G1 X18.060 Y2.500 Z-1.8943 F3000
+G1 X18.040 Y2.500 Z-1.8963 F3000
+G1 X18.020 Y2.500 Z-1.8983 F3000
+G1 X18.000 Y2.500 Z-1.9003 F3000
+G1 X17.980 Y2.500 Z-1.9023 F3000
+G1 X17.960 Y2.500 Z-1.9043 F3000
+G1 X17.940 Y2.500 Z-1.9064 F3000
+G1 X17.920 Y2.500 Z-1.9085 F3000
+G1 X17.900 Y2.500 Z-1.9106 F3000
+G1 X17.880 Y2.500 Z-1.9127 F3000
+G1 X17.860 Y2.500 Z-1.9148 F3000
+G1 X17.840 Y2.500 Z-1.9170 F3000
+G1 X17.820 Y2.500 Z-1.9192 F3000
+G1 X17.800 Y2.500 Z-1.9214 F3000
+G1 X17.780 Y2.500 Z-1.9236 F3000
+G1 X17.760 Y2.500 Z-1.9258 F3000
+G1 X17.740 Y2.500 Z-1.9281 F3000
+G1 X17.720 Y2.500 Z-1.9304 F3000
+G1 X17.700 Y2.500 Z-1.9327 F3000
+G1 X17.680 Y2.500 Z-1.9350 F3000
+G1 X17.660 Y2.500 Z-1.9374 F3000
+G1 X17.640 Y2.500 Z-1.9397 F3000
+G1 X17.620 Y2.500 Z-1.9421 F3000
+G1 X17.600 Y2.500 Z-1.9445 F3000
+G1 X17.580 Y2.500 Z-1.9469 F3000
+G1 X17.560 Y2.500 Z-1.9494 F3000
+G1 X17.540 Y2.500 Z-1.9519 F3000
+G1 X17.520 Y2.500 Z-1.9544 F3000
+G1 X17.500 Y2.500 Z-1.9569 F3000
+G1 X17.480 Y2.500 Z-1.9594 F3000
+G1 X17.460 Y2.500 Z-1.9619 F3000
+G1 X17.440 Y2.500 Z-1.9645 F3000
+G1 X17.420 Y2.500 Z-1.9671 F3000
+G1 X17.400 Y2.500 Z-1.9697 F3000
+G1 X17.380 Y2.500 Z-1.9724 F3000
+G1 X17.360 Y2.500 Z-1.9750 F3000
+G1 X17.340 Y2.500 Z-1.9777 F3000
+G1 X17.320 Y2.500 Z-1.9804 F3000
+G1 X17.300 Y2.500 Z-1.9831 F3000
+G1 X17.280 Y2.500 Z-1.9858 F3000
+G1 X17.260 Y2.500 Z-1.9886 F3000
+G1 X17.240 Y2.500 Z-1.9914 F3000
+G1 X17.220 Y2.500 Z-1.9942 F3000
+G1 X17.200 Y2.500 Z-1.9970 F3000
+G1 X17.180 Y2.500 Z-1.9998 F3000
+G1 X17.160 Y2.500 Z-2.0027 F3000
+G1 X17.140 Y2.500 Z-2.0055 F3000
+G1 X17.120 Y2.500 Z-2.0084 F3000
+G1 X17.100 Y2.500 Z-2.0114 F3000
+G1 X17.080 Y2.500 Z-2.0143 F3000
+G1 X17.060 Y2.500 Z-2.0173 F3000
+G1 X17.040 Y2.500 Z-2.0203 F3000
+G1 X17.020 Y2.500 Z-2.0233 F3000
+G1 X17.000 Y2.500 Z-2.0263 F3000
+G1 X16.980 Y2.500 Z-2.0293 F3000
+G1 X16.960 Y2.500 Z-2.0324 F3000
+G1 X16.940 Y2.500 Z-2.0355 F3000
+G1 X16.920 Y2.500 Z-2.0386 F3000
+G1 X16.900 Y2.500 Z-2.0417 F3000
+G1 X16.880 Y2.500 Z-2.0449 F3000
+G1 X16.860 Y2.500 Z-2.0480 F3000
+G1 X16.840 Y2.500 Z-2.0512 F3000
+G1 X16.820 Y2.500 Z-2.0544 F3000
+G1 X16.800 Y2.500 Z-2.0577 F3000
+G1 X16.780 Y2.500 Z-2.0609 F3000
+G1 X16.760 Y2.500 Z-2.0642 F3000
+G1 X16.740 Y2.500 Z-2.0675 F3000
+G1 X16.720 Y2.500 Z-2.0708 F3000
+G1 X16.700 Y2.500 Z-2.0741 F3000
+G1 X16.680 Y2.500 Z-2.0775 F3000
+G1 X16.660 Y2.500 Z-2.0809 F3000
+G1 X16.640 Y2.500 Z-2.0843 F3000
+G1 X16.620 Y2.500 Z-2.0877 F3000
+G1 X16.600 Y2.500 Z-2.0911 F3000
+G1 X16.580 Y2.500 Z-2.0946 F3000
+G1 X16.560 Y2.500 Z-2.0981 F3000
+G1 X16.540 Y2.500 Z-2.1016 F3000
+G1 X16.520 Y2.500 Z-2.1051 F3000
+G1 X16.500 Y2.500 Z-2.1086 F3000
+G1 X16.480 Y2.500 Z-2.1122 F3000
+G1 X16.460 Y2.500 Z-2.1158 F3000
+G1 X16.440 Y2.500 Z-2.1194 F3000
+G1 X16.420 Y2.500 Z-2.1230 F3000
+G1 X16.400 Y2.500 Z-2.1267 F3000
+G1 X16.380 Y2.500 Z-2.1303 F3000
+G1 X16.360 Y2.500 Z-2.1340 F3000
+G1 X16.340 Y2.500 Z-2.1377 F3000
+G1 X16.320 Y2.500 Z-2.1415 F3000
+G1 X16.300 Y2.500 Z-2.1452 F3000
+G1 X16.280 Y2.500 Z-2.1490 F3000
+G1 X16.260 Y2.500 Z-2.1528 F3000
+G1 X16.240 Y2.500 Z-2.1566 F3000
+G1 X16.220 Y2.500 Z-2.1605 F3000
+G1 X16.200 Y2.500 Z-2.1643 F3000
+G1 X16.180 Y2.500 Z-2.1682 F3000
+G1 X16.160 Y2.500 Z-2.1721 F3000
+G1 X16.140 Y2.500 Z-2.1760 F3000
+G1 X16.120 Y2.500 Z-2.1800 F3000
+G1 X16.100 Y2.500 Z-2.1839 F3000
+G1 X16.080 Y2.500 Z-2.1879 F3000
+G1 X16.060 Y2.500 Z-2.1919 F3000
+G1 X16.040 Y2.500 Z-2.1960 F3000
+G1 X16.020 Y2.500 Z-2.2000 F3000
+G1 X16.000 Y2.500 Z-2.2041 F3000
+G1 X15.980 Y2.500 Z-2.2082 F3000
+G1 X15.960 Y2.500 Z-2.2123 F3000
+G1 X15.940 Y2.500 Z-2.2164 F3000
+G1 X15.920 Y2.500 Z-2.2206 F3000
+G1 X15.900 Y2.500 Z-2.2248 F3000
+G1 X15.880 Y2.500 Z-2.2290 F3000
+G1 X15.860 Y2.500 Z-2.2332 F3000
+G1 X15.840 Y2.500 Z-2.2374 F3000
+G1 X15.820 Y2.500 Z-2.2417 F3000
+G1 X15.800 Y2.500 Z-2.2460 F3000
+G1 X15.780 Y2.500 Z-2.2503 F3000
+G1 X15.760 Y2.500 Z-2.2546 F3000
+G1 X15.740 Y2.500 Z-2.2590 F3000
+G1 X15.720 Y2.500 Z-2.2633 F3000
+G1 X15.700 Y2.500 Z-2.2677 F3000
+G1 X15.680 Y2.500 Z-2.2721 F3000
+G1 X15.660 Y2.500 Z-2.2766 F3000
+G1 X15.640 Y2.500 Z-2.2810 F3000
+G1 X15.620 Y2.500 Z-2.2855 F3000
+G1 X15.600 Y2.500 Z-2.2900 F3000
+G1 X15.580 Y2.500 Z-2.2945 F3000
+G1 X15.560 Y2.500 Z-2.2991 F3000
+G1 X15.540 Y2.500 Z-2.3036 F3000
+G1 X15.520 Y2.500 Z-2.3082 F3000
+G1 X15.500 Y2.500 Z-2.3128 F3000
+G1 X15.480 Y2.500 Z-2.3175 F3000
+G1 X15.460 Y2.500 Z-2.3221 F3000
+G1 X15.440 Y2.500 Z-2.3268 F3000
+G1 X15.420 Y2.500 Z-2.3315 F3000
+G1 X15.400 Y2.500 Z-2.3362 F3000
+G1 X15.380 Y2.500 Z-2.3409 F3000
+G1 X15.360 Y2.500 Z-2.3457 F3000
+G1 X15.340 Y2.500 Z-2.3505 F3000
+G1 X15.320 Y2.500 Z-2.3553 F3000
+G1 X15.300 Y2.500 Z-2.3601 F3000
+G1 X15.280 Y2.500 Z-2.3649 F3000
+G1 X15.260 Y2.500 Z-2.3698 F3000
+G1 X15.240 Y2.500 Z-2.3747 F3000
+G1 X15.220 Y2.500 Z-2.3796 F3000
+G1 X15.200 Y2.500 Z-2.3845 F3000
+G1 X15.180 Y2.500 Z-2.3895 F3000
+G1 X15.160 Y2.500 Z-2.3945 F3000
+G1 X15.140 Y2.500 Z-2.3995 F3000
+G1 X15.120 Y2.500 Z-2.4045 F3000
+G1 X15.100 Y2.500 Z-2.4095 F3000
+G1 X15.080 Y2.500 Z-2.4146 F3000
+G1 X15.060 Y2.500 Z-2.4197 F3000
+G1 X15.040 Y2.500 Z-2.4248 F3000
+G1 X15.020 Y2.500 Z-2.4299 F3000
+G1 X15.000 Y2.500 Z-2.4351 F3000
+G1 X14.980 Y2.500 Z-2.4403 F3000
+G1 X14.960 Y2.500 Z-2.4455 F3000
+G1 X14.940 Y2.500 Z-2.4507 F3000
+G1 X14.920 Y2.500 Z-2.4559 F3000
+G1 X14.900 Y2.500 Z-2.4612 F3000
+G1 X14.880 Y2.500 Z-2.4665 F3000
+G1 X14.860 Y2.500 Z-2.4718 F3000
+G1 X14.840 Y2.500 Z-2.4771 F3000
+G1 X14.820 Y2.500 Z-2.4825 F3000
+G1 X14.800 Y2.500 Z-2.4878 F3000
+G1 X14.780 Y2.500 Z-2.4932 F3000
+G1 X14.760 Y2.500 Z-2.4986 F3000
+G1 X14.740 Y2.500 Z-2.5041 F3000
+G1 X14.720 Y2.500 Z-2.5095 F3000
+G1 X14.700 Y2.500 Z-2.5150 F3000
+G1 X14.680 Y2.500 Z-2.5205 F3000
+G1 X14.660 Y2.500 Z-2.5261 F3000
+G1 X14.640 Y2.500 Z-2.5316 F3000
+G1 X14.620 Y2.500 Z-2.5372 F3000
+G1 X14.600 Y2.500 Z-2.5428 F3000
+G1 X14.580 Y2.500 Z-2.5484 F3000
+G1 X14.560 Y2.500 Z-2.5541 F3000
+G1 X14.540 Y2.500 Z-2.5597 F3000
+G1 X14.520 Y2.500 Z-2.5654 F3000
+G1 X14.500 Y2.500 Z-2.5711 F3000
+G1 X14.480 Y2.500 Z-2.5768 F3000
+G1 X14.460 Y2.500 Z-2.5826 F3000
+G1 X14.440 Y2.500 Z-2.5884 F3000
+G1 X14.420 Y2.500 Z-2.5942 F3000
+G1 X14.400 Y2.500 Z-2.6000 F3000
+G1 X14.380 Y2.500 Z-2.6058 F3000
+G1 X14.360 Y2.500 Z-2.6117 F3000
+G1 X14.340 Y2.500 Z-2.6176 F3000
+G1 X14.320 Y2.500 Z-2.6235 F3000
+G1 X14.300 Y2.500 Z-2.6294 F3000
+G1 X14.280 Y2.500 Z-2.6354 F3000
+G1 X14.260 Y2.500 Z-2.6414 F3000
+G1 X14.240 Y2.500 Z-2.6474 F3000
+G1 X14.220 Y2.500 Z-2.6534 F3000
+G1 X14.200 Y2.500 Z-2.6595 F3000
+G1 X14.180 Y2.500 Z-2.6655 F3000
+G1 X14.160 Y2.500 Z-2.6716 F3000
+G1 X14.140 Y2.500 Z-2.6778 F3000
+G1 X14.120 Y2.500 Z-2.6839 F3000
+G1 X14.100 Y2.500 Z-2.6901 F3000
+G1 X14.080 Y2.500 Z-2.6962 F3000
+G1 X14.060 Y2.500 Z-2.7025 F3000
+G1 X14.040 Y2.500 Z-2.7087 F3000
+G1 X14.020 Y2.500 Z-2.7149 F3000
+G1 X14.000 Y2.500 Z-2.7212 F3000
+G1 X13.980 Y2.500 Z-2.7275 F3000
+G1 X13.960 Y2.500 Z-2.7338 F3000
+G1 X13.940 Y2.500 Z-2.7402 F3000
+G1 X13.920 Y2.500 Z-2.7466 F3000
+G1 X13.900 Y2.500 Z-2.7530 F3000
+G1 X13.880 Y2.500 Z-2.7594 F3000
+G1 X13.860 Y2.500 Z-2.7658 F3000
+G1 X13.840 Y2.500 Z-2.7723 F3000
+G1 X13.820 Y2.500 Z-2.7788 F3000
+G1 X13.800 Y2.500 Z-2.7853 F3000
+G1 X13.780 Y2.500 Z-2.7918 F3000
+G1 X13.760 Y2.500 Z-2.7984 F3000
+G1 X13.740 Y2.500 Z-2.8049 F3000
+G1 X13.720 Y2.500 Z-2.8115 F3000
+G1 X13.700 Y2.500 Z-2.8182 F3000
+G1 X13.680 Y2.500 Z-2.8248 F3000
+G1 X13.660 Y2.500 Z-2.8315 F3000
+G1 X13.640 Y2.500 Z-2.8382 F3000
+G1 X13.620 Y2.500 Z-2.8449 F3000
+G1 X13.600 Y2.500 Z-2.8516 F3000
+G1 X13.580 Y2.500 Z-2.8584 F3000
+G1 X13.560 Y2.500 Z-2.8652 F3000
+G1 X13.540 Y2.500 Z-2.8720 F3000
+G1 X13.520 Y2.500 Z-2.8789 F3000
+G1 X13.500 Y2.500 Z-2.8857 F3000
+G1 X13.480 Y2.500 Z-2.8926 F3000
+G1 X13.460 Y2.500 Z-2.8995 F3000
+G1 X13.440 Y2.500 Z-2.9064 F3000
+G1 X13.420 Y2.500 Z-2.9134 F3000
+G1 X13.400 Y2.500 Z-2.9204 F3000
+G1 X13.380 Y2.500 Z-2.9274 F3000
+G1 X13.360 Y2.500 Z-2.9344 F3000
+G1 X13.340 Y2.500 Z-2.9415 F3000
+G1 X13.320 Y2.500 Z-2.9485 F3000
+G1 X13.300 Y2.500 Z-2.9556 F3000
+G1 X13.280 Y2.500 Z-2.9628 F3000
+G1 X13.260 Y2.500 Z-2.9699 F3000
+G1 X13.240 Y2.500 Z-2.9771 F3000
+G1 X13.220 Y2.500 Z-2.9843 F3000
+G1 X13.200 Y2.500 Z-2.9915 F3000
+G1 X13.180 Y2.500 Z-2.9987 F3000
+G1 X13.160 Y2.500 Z-3.0060 F3000
+G1 X13.140 Y2.500 Z-3.0133 F3000
+G1 X13.120 Y2.500 Z-3.0206 F3000
+G1 X13.100 Y2.500 Z-3.0279 F3000
+G1 X13.080 Y2.500 Z-3.0353 F3000
+G1 X13.060 Y2.500 Z-3.0427 F3000
+G1 X13.040 Y2.500 Z-3.0501 F3000
+G1 X13.020 Y2.500 Z-3.0575 F3000
+G1 X13.000 Y2.500 Z-3.0650 F3000
+G1 X12.980 Y2.500 Z-3.0725 F3000
+G1 X12.960 Y2.500 Z-3.0800 F3000
+G1 X12.940 Y2.500 Z-3.0875 F3000
+G1 X12.920 Y2.500 Z-3.0951 F3000
+G1 X12.900 Y2.500 Z-3.1027 F3000
+G1 X12.880 Y2.500 Z-3.1103 F3000
+G1 X12.860 Y2.500 Z-3.1179 F3000
+G1 X12.840 Y2.500 Z-3.1256 F3000
+G1 X12.820 Y2.500 Z-3.1332 F3000
+G1 X12.800 Y2.500 Z-3.1410 F3000
+G1 X12.780 Y2.500 Z-3.1487 F3000
+G1 X12.760 Y2.500 Z-3.1564 F3000
+G1 X12.740 Y2.500 Z-3.1642 F3000
+G1 X12.720 Y2.500 Z-3.1720 F3000
+G1 X12.700 Y2.500 Z-3.1798 F3000
+G1 X12.680 Y2.500 Z-3.1877 F3000
+G1 X12.660 Y2.500 Z-3.1956 F3000
+G1 X12.640 Y2.500 Z-3.2035 F3000
+G1 X12.620 Y2.500 Z-3.2114 F3000
+G1 X12.600 Y2.500 Z-3.2194 F3000
+G1 X12.580 Y2.500 Z-3.2273 F3000
+G1 X12.560 Y2.500 Z-3.2353 F3000
+G1 X12.540 Y2.500 Z-3.2434 F3000
+G1 X12.520 Y2.500 Z-3.2514 F3000
+G1 X12.500 Y2.500 Z-3.2595 F3000
+G1 X12.480 Y2.500 Z-3.2676 F3000
+G1 X12.460 Y2.500 Z-3.2757 F3000
+G1 X12.440 Y2.500 Z-3.2839 F3000
+G1 X12.420 Y2.500 Z-3.2921 F3000
+G1 X12.400 Y2.500 Z-3.3003 F3000
+G1 X12.380 Y2.500 Z-3.3085 F3000
+G1 X12.360 Y2.500 Z-3.3168 F3000
+G1 X12.340 Y2.500 Z-3.3250 F3000
+G1 X12.320 Y2.500 Z-3.3333 F3000
+G1 X12.300 Y2.500 Z-3.3417 F3000
+G1 X12.280 Y2.500 Z-3.3500 F3000
+G1 X12.260 Y2.500 Z-3.3584 F3000
+G1 X12.240 Y2.500 Z-3.3668 F3000
+G1 X12.220 Y2.500 Z-3.3752 F3000
+G1 X12.200 Y2.500 Z-3.3837 F3000
+G1 X12.180 Y2.500 Z-3.3922 F3000
+G1 X12.160 Y2.500 Z-3.4007 F3000
+G1 X12.140 Y2.500 Z-3.4092 F3000
+G1 X12.120 Y2.500 Z-3.4178 F3000
+G1 X12.100 Y2.500 Z-3.4264 F3000
+G1 X12.080 Y2.500 Z-3.4350 F3000
+G1 X12.060 Y2.500 Z-3.4436 F3000
+G1 X12.040 Y2.500 Z-3.4523 F3000
+G1 X12.020 Y2.500 Z-3.4610 F3000
+G1 X12.000 Y2.500 Z-3.4697 F3000
+G1 X11.980 Y2.500 Z-3.4784 F3000
+G1 X11.960 Y2.500 Z-3.4872 F3000
+G1 X11.940 Y2.500 Z-3.4960 F3000
+G1 X11.920 Y2.500 Z-3.5048 F3000
+G1 X11.900 Y2.500 Z-3.5137 F3000
+G1 X11.880 Y2.500 Z-3.5225 F3000
+G1 X11.860 Y2.500 Z-3.5314 F3000
+G1 X11.840 Y2.500 Z-3.5404 F3000
+G1 X11.820 Y2.500 Z-3.5493 F3000
+G1 X11.800 Y2.500 Z-3.5583 F3000
+G1 X11.780 Y2.500 Z-3.5673 F3000
+G1 X11.760 Y2.500 Z-3.5763 F3000
+G1 X11.740 Y2.500 Z-3.5854 F3000
+G1 X11.720 Y2.500 Z-3.5945 F3000
+G1 X11.700 Y2.500 Z-3.6036 F3000
+G1 X11.680 Y2.500 Z-3.6127 F3000
+G1 X11.660 Y2.500 Z-3.6219 F3000
+G1 X11.640 Y2.500 Z-3.6311 F3000
+G1 X11.620 Y2.500 Z-3.6403 F3000
+G1 X11.600 Y2.500 Z-3.6495 F3000
+G1 X11.580 Y2.500 Z-3.6588 F3000
+G1 X11.560 Y2.500 Z-3.6681 F3000
+G1 X11.540 Y2.500 Z-3.6774 F3000
+G1 X11.520 Y2.500 Z-3.6868 F3000
+G1 X11.500 Y2.500 Z-3.6961 F3000
+G1 X11.480 Y2.500 Z-3.7055 F3000
+G1 X11.460 Y2.500 Z-3.7150 F3000
+G1 X11.440 Y2.500 Z-3.7244 F3000
+G1 X11.420 Y2.500 Z-3.7339 F3000
+G1 X11.400 Y2.500 Z-3.7434 F3000
+G1 X11.380 Y2.500 Z-3.7530 F3000
+G1 X11.360 Y2.500 Z-3.7625 F3000
+G1 X11.340 Y2.500 Z-3.7721 F3000
+G1 X11.320 Y2.500 Z-3.7817 F3000
+G1 X11.300 Y2.500 Z-3.7914 F3000
+G1 X11.280 Y2.500 Z-3.8011 F3000
+G1 X11.260 Y2.500 Z-3.8108 F3000
+G1 X11.240 Y2.500 Z-3.8205 F3000
+G1 X11.220 Y2.500 Z-3.8303 F3000
+G1 X11.200 Y2.500 Z-3.8400 F3000
+G1 X11.180 Y2.500 Z-3.8499 F3000
+G1 X11.160 Y2.500 Z-3.8597 F3000
+G1 X11.140 Y2.500 Z-3.8696 F3000
+G1 X11.120 Y2.500 Z-3.8795 F3000
+G1 X11.100 Y2.500 Z-3.8894 F3000
+G1 X11.080 Y2.500 Z-3.8993 F3000
+G1 X11.060 Y2.500 Z-3.9093 F3000
+G1 X11.040 Y2.500 Z-3.9193 F3000
+G1 X11.020 Y2.500 Z-3.9294 F3000
+G1 X11.000 Y2.500 Z-3.9394 F3000
+G1 X10.980 Y2.500 Z-3.9495 F3000
+G1 X10.960 Y2.500 Z-3.9596 F3000
+G1 X10.940 Y2.500 Z-3.9698 F3000
+G1 X10.920 Y2.500 Z-3.9800 F3000
+G1 X10.900 Y2.500 Z-3.9902 F3000
+G1 X10.880 Y2.500 Z-4.0004 F3000
+G1 X10.860 Y2.500 Z-4.0107 F3000
+G1 X10.840 Y2.500 Z-4.0210 F3000
+G1 X10.820 Y2.500 Z-4.0313 F3000
+G1 X10.800 Y2.500 Z-4.0416 F3000
+G1 X10.780 Y2.500 Z-4.0520 F3000
+G1 X10.760 Y2.500 Z-4.0624 F3000
+G1 X10.740 Y2.500 Z-4.0728 F3000
+G1 X10.720 Y2.500 Z-4.0833 F3000
+G1 X10.700 Y2.500 Z-4.0938 F3000
+G1 X10.680 Y2.500 Z-4.1043 F3000
+G1 X10.660 Y2.500 Z-4.1149 F3000
+G1 X10.640 Y2.500 Z-4.1254 F3000
+G1 X10.620 Y2.500 Z-4.1360 F3000
+G1 X10.600 Y2.500 Z-4.1467 F3000
+G1 X10.580 Y2.500 Z-4.1573 F3000
+G1 X10.560 Y2.500 Z-4.1680 F3000
+G1 X10.540 Y2.500 Z-4.1788 F3000
+G1 X10.520 Y2.500 Z-4.1895 F3000
+G1 X10.500 Y2.500 Z-4.2003 F3000
+G1 X10.480 Y2.500 Z-4.2111 F3000
+G1 X10.460 Y2.500 Z-4.2219 F3000
+G1 X10.440 Y2.500 Z-4.2328 F3000
+G1 X10.420 Y2.500 Z-4.2437 F3000
+G1 X10.400 Y2.500 Z-4.2546 F3000
+G1 X10.380 Y2.500 Z-4.2656 F3000
+G1 X10.360 Y2.500 Z-4.2766 F3000
+G1 X10.340 Y2.500 Z-4.2876 F3000
+G1 X10.320 Y2.500 Z-4.2986 F3000
+G1 X10.300 Y2.500 Z-4.3097 F3000
+G1 X10.280 Y2.500 Z-4.3208 F3000
+G1 X10.260 Y2.500 Z-4.3320 F3000
+G1 X10.240 Y2.500 Z-4.3431 F3000
+G1 X10.220 Y2.500 Z-4.3543 F3000
+G1 X10.200 Y2.500 Z-4.3656 F3000
+G1 X10.180 Y2.500 Z-4.3768 F3000
+G1 X10.160 Y2.500 Z-4.3881 F3000
+G1 X10.140 Y2.500 Z-4.3994 F3000
+G1 X10.120 Y2.500 Z-4.4108 F3000
+G1 X10.100 Y2.500 Z-4.4221 F3000
+G1 X10.080 Y2.500 Z-4.4335 F3000
+G1 X10.060 Y2.500 Z-4.4450 F3000
+G1 X10.040 Y2.500 Z-4.4565 F3000
+G1 X10.020 Y2.500 Z-4.4680 F3000
+G1 X10.000 Y2.500 Z-4.4795 F3000
+G1 X9.980 Y2.500 Z-4.4911 F3000
+G1 X9.960 Y2.500 Z-4.5026 F3000
+G1 X9.940 Y2.500 Z-4.5143 F3000
+G1 X9.920 Y2.500 Z-4.5259 F3000
+G1 X9.900 Y2.500 Z-4.5376 F3000
+G1 X9.880 Y2.500 Z-4.5493 F3000
+G1 X9.860 Y2.500 Z-4.5611 F3000
+G1 X9.840 Y2.500 Z-4.5729 F3000
+G1 X9.820 Y2.500 Z-4.5847 F3000
+G1 X9.800 Y2.500 Z-4.5965 F3000
+G1 X9.780 Y2.500 Z-4.6084 F3000
+G1 X9.760 Y2.500 Z-4.6203 F3000
+G1 X9.740 Y2.500 Z-4.6322 F3000
+G1 X9.720 Y2.500 Z-4.6442 F3000
+G1 X9.700 Y2.500 Z-4.6562 F3000
+G1 X9.680 Y2.500 Z-4.6682 F3000
+G1 X9.660 Y2.500 Z-4.6803 F3000
+G1 X9.640 Y2.500 Z-4.6924 F3000
+G1 X9.620 Y2.500 Z-4.7045 F3000
+G1 X9.600 Y2.500 Z-4.7167 F3000
+G1 X9.580 Y2.500 Z-4.7289 F3000
+G1 X9.560 Y2.500 Z-4.7411 F3000
+G1 X9.540 Y2.500 Z-4.7533 F3000
+G1 X9.520 Y2.500 Z-4.7656 F3000
+G1 X9.500 Y2.500 Z-4.7780 F3000
+G1 X9.480 Y2.500 Z-4.7903 F3000
+G1 X9.460 Y2.500 Z-4.8027 F3000
+G1 X9.440 Y2.500 Z-4.8151 F3000
+G1 X9.420 Y2.500 Z-4.8276 F3000
+G1 X9.400 Y2.500 Z-4.8400 F3000
+G1 X9.380 Y2.500 Z-4.8526 F3000
+G1 X9.360 Y2.500 Z-4.8651 F3000
+G1 X9.340 Y2.500 Z-4.8777 F3000
+G1 X9.320 Y2.500 Z-4.8903 F3000
+G1 X9.300 Y2.500 Z-4.9030 F3000
+G1 X9.280 Y2.500 Z-4.9156 F3000
+G1 X9.260 Y2.500 Z-4.9284 F3000
+G1 X9.240 Y2.500 Z-4.9411 F3000
+G1 X9.220 Y2.500 Z-4.9539 F3000
+G1 X9.200 Y2.500 Z-4.9667 F3000
+G1 X9.180 Y2.500 Z-4.9795 F3000
+G1 X9.160 Y2.500 Z-4.9924 F3000
+G1 X9.140 Y2.500 Z-5.0053 F3000
+G1 X9.120 Y2.500 Z-5.0183 F3000
+G1 X9.100 Y2.500 Z-5.0313 F3000
+G1 X9.080 Y2.500 Z-5.0443 F3000
+G1 X9.060 Y2.500 Z-5.0573 F3000
+G1 X9.040 Y2.500 Z-5.0704 F3000
+G1 X9.020 Y2.500 Z-5.0836 F3000
+G1 X9.000 Y2.500 Z-5.0967 F3000
+G1 X8.980 Y2.500 Z-5.1099 F3000
+G1 X8.960 Y2.500 Z-5.1231 F3000
+G1 X8.940 Y2.500 Z-5.1364 F3000
+G1 X8.920 Y2.500 Z-5.1497 F3000
+G1 X8.900 Y2.500 Z-5.1630 F3000
+G1 X8.880 Y2.500 Z-5.1764 F3000
+G1 X8.860 Y2.500 Z-5.1898 F3000
+G1 X8.840 Y2.500 Z-5.2032 F3000
+G1 X8.820 Y2.500 Z-5.2166 F3000
+G1 X8.800 Y2.500 Z-5.2301 F3000
+G1 X8.780 Y2.500 Z-5.2437 F3000
+G1 X8.760 Y2.500 Z-5.2573 F3000
+G1 X8.740 Y2.500 Z-5.2709 F3000
+G1 X8.720 Y2.500 Z-5.2845 F3000
+G1 X8.700 Y2.500 Z-5.2982 F3000
+G1 X8.680 Y2.500 Z-5.3119 F3000
+G1 X8.660 Y2.500 Z-5.3256 F3000
+G1 X8.640 Y2.500 Z-5.3394 F3000
+G1 X8.620 Y2.500 Z-5.3532 F3000
+G1 X8.600 Y2.500 Z-5.3671 F3000
+G1 X8.580 Y2.500 Z-5.3810 F3000
+G1 X8.560 Y2.500 Z-5.3949 F3000
+G1 X8.540 Y2.500 Z-5.4089 F3000
+G1 X8.520 Y2.500 Z-5.4229 F3000
+G1 X8.500 Y2.500 Z-5.4369 F3000
+G1 X8.480 Y2.500 Z-5.4510 F3000
+G1 X8.460 Y2.500 Z-5.4651 F3000
+G1 X8.440 Y2.500 Z-5.4793 F3000
+G1 X8.420 Y2.500 Z-5.4934 F3000
+G1 X8.400 Y2.500 Z-5.5077 F3000
+G1 X8.380 Y2.500 Z-5.5219 F3000
+G1 X8.360 Y2.500 Z-5.5362 F3000
+G1 X8.340 Y2.500 Z-5.5506 F3000
+G1 X8.320 Y2.500 Z-5.5649 F3000
+G1 X8.300 Y2.500 Z-5.5793 F3000
+G1 X8.280 Y2.500 Z-5.5938 F3000
+G1 X8.260 Y2.500 Z-5.6083 F3000
+G1 X8.240 Y2.500 Z-5.6228 F3000
+G1 X8.220 Y2.500 Z-5.6373 F3000
+G1 X8.200 Y2.500 Z-5.6519 F3000
+G1 X8.180 Y2.500 Z-5.6666 F3000
+G1 X8.160 Y2.500 Z-5.6812 F3000
+G1 X8.140 Y2.500 Z-5.6960 F3000
+G1 X8.120 Y2.500 Z-5.7107 F3000
+G1 X8.100 Y2.500 Z-5.7255 F3000
+G1 X8.080 Y2.500 Z-5.7403 F3000
+G1 X8.060 Y2.500 Z-5.7552 F3000
+G1 X8.040 Y2.500 Z-5.7701 F3000
+G1 X8.020 Y2.500 Z-5.7850 F3000
+G1 X8.000 Y2.500 Z-5.8000 F3000
+G1 X7.980 Y2.500 Z-5.8150 F3000
+G1 X7.960 Y2.500 Z-5.8301 F3000
+G1 X7.940 Y2.500 Z-5.8452 F3000
+G1 X7.920 Y2.500 Z-5.8603 F3000
+G1 X7.900 Y2.500 Z-5.8755 F3000
+G1 X7.880 Y2.500 Z-5.8907 F3000
+G1 X7.860 Y2.500 Z-5.9060 F3000
+G1 X7.840 Y2.500 Z-5.9213 F3000
+G1 X7.820 Y2.500 Z-5.9366 F3000
+G1 X7.800 Y2.500 Z-5.9520 F3000
+G1 X7.780 Y2.500 Z-5.9674 F3000
+G1 X7.760 Y2.500 Z-5.9828 F3000
+G1 X7.740 Y2.500 Z-5.9983 F3000
+G1 X7.720 Y2.500 Z-6.0139 F3000
+G1 X7.700 Y2.500 Z-6.0295 F3000
+G1 X7.680 Y2.500 Z-6.0451 F3000
+G1 X7.660 Y2.500 Z-6.0607 F3000
+G1 X7.640 Y2.500 Z-6.0764 F3000
+G1 X7.620 Y2.500 Z-6.0922 F3000
+G1 X7.600 Y2.500 Z-6.1080 F3000
+G1 X7.580 Y2.500 Z-6.1238 F3000
+G1 X7.560 Y2.500 Z-6.1397 F3000
+G1 X7.540 Y2.500 Z-6.1556 F3000
+G1 X7.520 Y2.500 Z-6.1715 F3000
+G1 X7.500 Y2.500 Z-6.1875 F3000
+G1 X7.480 Y2.500 Z-6.2035 F3000
+G1 X7.460 Y2.500 Z-6.2196 F3000
+G1 X7.440 Y2.500 Z-6.2357 F3000
+G1 X7.420 Y2.500 Z-6.2519 F3000
+G1 X7.400 Y2.500 Z-6.2681 F3000
+G1 X7.380 Y2.500 Z-6.2843 F3000
+G1 X7.360 Y2.500 Z-6.3006 F3000
+G1 X7.340 Y2.500 Z-6.3170 F3000
+G1 X7.320 Y2.500 Z-6.3333 F3000
+G1 X7.300 Y2.500 Z-6.3498 F3000
+G1 X7.280 Y2.500 Z-6.3662 F3000
+G1 X7.260 Y2.500 Z-6.3827 F3000
+G1 X7.240 Y2.500 Z-6.3993 F3000
+G1 X7.220 Y2.500 Z-6.4159 F3000
+G1 X7.200 Y2.500 Z-6.4325 F3000
+G1 X7.180 Y2.500 Z-6.4492 F3000
+G1 X7.160 Y2.500 Z-6.4659 F3000
+G1 X7.140 Y2.500 Z-6.4827 F3000
+G1 X7.120 Y2.500 Z-6.4995 F3000
+G1 X7.100 Y2.500 Z-6.5163 F3000
+G1 X7.080 Y2.500 Z-6.5333 F3000
+G1 X7.060 Y2.500 Z-6.5502 F3000
+G1 X7.040 Y2.500 Z-6.5672 F3000
+G1 X7.020 Y2.500 Z-6.5842 F3000
+G1 X7.000 Y2.500 Z-6.6013 F3000
+G1 X6.980 Y2.500 Z-6.6184 F3000
+G1 X6.960 Y2.500 Z-6.6356 F3000
+G1 X6.940 Y2.500 Z-6.6528 F3000
+G1 X6.920 Y2.500 Z-6.6701 F3000
+G1 X6.900 Y2.500 Z-6.6874 F3000
+G1 X6.880 Y2.500 Z-6.7048 F3000
+G1 X6.860 Y2.500 Z-6.7222 F3000
+G1 X6.840 Y2.500 Z-6.7396 F3000
+G1 X6.820 Y2.500 Z-6.7571 F3000
+G1 X6.800 Y2.500 Z-6.7747 F3000
+G1 X6.780 Y2.500 Z-6.7923 F3000
+G1 X6.760 Y2.500 Z-6.8099 F3000
+G1 X6.740 Y2.500 Z-6.8276 F3000
+G1 X6.720 Y2.500 Z-6.8453 F3000
+G1 X6.700 Y2.500 Z-6.8631 F3000
+G1 X6.680 Y2.500 Z-6.8810 F3000
+G1 X6.660 Y2.500 Z-6.8988 F3000
+G1 X6.640 Y2.500 Z-6.9168 F3000
+G1 X6.620 Y2.500 Z-6.9348 F3000
+G1 X6.600 Y2.500 Z-6.9528 F3000
+G1 X6.580 Y2.500 Z-6.9709 F3000
+G1 X6.560 Y2.500 Z-6.9890 F3000
+G1 X6.540 Y2.500 Z-7.0072 F3000
+G1 X6.520 Y2.500 Z-7.0254 F3000
+G1 X6.500 Y2.500 Z-7.0436 F3000
+G1 X6.480 Y2.500 Z-7.0620 F3000
+G1 X6.460 Y2.500 Z-7.0803 F3000
+G1 X6.440 Y2.500 Z-7.0988 F3000
+G1 X6.420 Y2.500 Z-7.1172 F3000
+G1 X6.400 Y2.500 Z-7.1358 F3000
+G1 X6.380 Y2.500 Z-7.1543 F3000
+G1 X6.360 Y2.500 Z-7.1730 F3000
+G1 X6.340 Y2.500 Z-7.1916 F3000
+G1 X6.320 Y2.500 Z-7.2104 F3000
+G1 X6.300 Y2.500 Z-7.2291 F3000
+G1 X6.280 Y2.500 Z-7.2480 F3000
+G1 X6.260 Y2.500 Z-7.2669 F3000
+G1 X6.240 Y2.500 Z-7.2858 F3000
+G1 X6.220 Y2.500 Z-7.3048 F3000
+G1 X6.200 Y2.500 Z-7.3238 F3000
+G1 X6.180 Y2.500 Z-7.3429 F3000
+G1 X6.160 Y2.500 Z-7.3621 F3000
+G1 X6.140 Y2.500 Z-7.3812 F3000
+G1 X6.120 Y2.500 Z-7.4005 F3000
+G1 X6.100 Y2.500 Z-7.4198 F3000
+G1 X6.080 Y2.500 Z-7.4392 F3000
+G1 X6.060 Y2.500 Z-7.4586 F3000
+G1 X6.040 Y2.500 Z-7.4780 F3000
+G1 X6.020 Y2.500 Z-7.4976 F3000
+G1 X6.000 Y2.500 Z-7.5171 F3000
+G1 X5.980 Y2.500 Z-7.5368 F3000
+G1 X5.960 Y2.500 Z-7.5565 F3000
+G1 X5.940 Y2.500 Z-7.5762 F3000
+G1 X5.920 Y2.500 Z-7.5960 F3000
+G1 X5.900 Y2.500 Z-7.6159 F3000
+G1 X5.880 Y2.500 Z-7.6358 F3000
+G1 X5.860 Y2.500 Z-7.6557 F3000
+G1 X5.840 Y2.500 Z-7.6758 F3000
+G1 X5.820 Y2.500 Z-7.6958 F3000
+G1 X5.800 Y2.500 Z-7.7160 F3000
+G1 X5.780 Y2.500 Z-7.7362 F3000
+G1 X5.760 Y2.500 Z-7.7564 F3000
+G1 X5.740 Y2.500 Z-7.7767 F3000
+G1 X5.720 Y2.500 Z-7.7971 F3000
+G1 X5.700 Y2.500 Z-7.8175 F3000
+G1 X5.680 Y2.500 Z-7.8380 F3000
+G1 X5.660 Y2.500 Z-7.8585 F3000
+G1 X5.640 Y2.500 Z-7.8791 F3000
+G1 X5.620 Y2.500 Z-7.8998 F3000
+G1 X5.600 Y2.500 Z-7.9205 F3000
+G1 X5.580 Y2.500 Z-7.9413 F3000
+G1 X5.560 Y2.500 Z-7.9621 F3000
+G1 X5.540 Y2.500 Z-7.9830 F3000
+G1 X5.520 Y2.500 Z-8.0040 F3000
+G1 X5.500 Y2.500 Z-8.0250 F3000
+G1 X5.480 Y2.500 Z-8.0461 F3000
+G1 X5.460 Y2.500 Z-8.0673 F3000
+G1 X5.440 Y2.500 Z-8.0885 F3000
+G1 X5.420 Y2.500 Z-8.1097 F3000
+G1 X5.400 Y2.500 Z-8.1311 F3000
+G1 X5.380 Y2.500 Z-8.1525 F3000
+G1 X5.360 Y2.500 Z-8.1739 F3000
+G1 X5.340 Y2.500 Z-8.1954 F3000
+G1 X5.320 Y2.500 Z-8.2170 F3000
+G1 X5.300 Y2.500 Z-8.2387 F3000
+G1 X5.280 Y2.500 Z-8.2604 F3000
+G1 X5.260 Y2.500 Z-8.2821 F3000
+G1 X5.240 Y2.500 Z-8.3040 F3000
+G1 X5.220 Y2.500 Z-8.3259 F3000
+G1 X5.200 Y2.500 Z-8.3479 F3000
+G1 X5.180 Y2.500 Z-8.3699 F3000
+G1 X5.160 Y2.500 Z-8.3920 F3000
+G1 X5.140 Y2.500 Z-8.4142 F3000
+G1 X5.120 Y2.500 Z-8.4364 F3000
+G1 X5.100 Y2.500 Z-8.4587 F3000
+G1 X5.080 Y2.500 Z-8.4811 F3000
+G1 X5.060 Y2.500 Z-8.5035 F3000
+G1 X5.040 Y2.500 Z-8.5260 F3000
+G1 X5.020 Y2.500 Z-8.5486 F3000
+G1 X5.000 Y2.500 Z-8.5712 F3000
+G1 X4.980 Y2.500 Z-8.5940 F3000
+G1 X4.960 Y2.500 Z-8.6167 F3000
+G1 X4.940 Y2.500 Z-8.6396 F3000
+G1 X4.920 Y2.500 Z-8.6625 F3000
+G1 X4.900 Y2.500 Z-8.6855 F3000
+G1 X4.880 Y2.500 Z-8.7086 F3000
+G1 X4.860 Y2.500 Z-8.7317 F3000
+G1 X4.840 Y2.500 Z-8.7549 F3000
+G1 X4.820 Y2.500 Z-8.7782 F3000
+G1 X4.800 Y2.500 Z-8.8015 F3000
+G1 X4.780 Y2.500 Z-8.8250 F3000
+G1 X4.760 Y2.500 Z-8.8485 F3000
+G1 X4.740 Y2.500 Z-8.8720 F3000
+G1 X4.720 Y2.500 Z-8.8957 F3000
+G1 X4.700 Y2.500 Z-8.9194 F3000
+G1 X4.680 Y2.500 Z-8.9432 F3000
+G1 X4.660 Y2.500 Z-8.9671 F3000
+G1 X4.640 Y2.500 Z-8.9910 F3000
+G1 X4.620 Y2.500 Z-9.0150 F3000
+G1 X4.600 Y2.500 Z-9.0391 F3000
+G1 X4.580 Y2.500 Z-9.0633 F3000
+G1 X4.560 Y2.500 Z-9.0875 F3000
+G1 X4.540 Y2.500 Z-9.1119 F3000
+G1 X4.520 Y2.500 Z-9.1363 F3000
+G1 X4.500 Y2.500 Z-9.1608 F3000
+G1 X4.480 Y2.500 Z-9.1853 F3000
+G1 X4.460 Y2.500 Z-9.2100 F3000
+G1 X4.440 Y2.500 Z-9.2347 F3000
+G1 X4.420 Y2.500 Z-9.2595 F3000
+G1 X4.400 Y2.500 Z-9.2844 F3000
+G1 X4.380 Y2.500 Z-9.3094 F3000
+G1 X4.360 Y2.500 Z-9.3344 F3000
+G1 X4.340 Y2.500 Z-9.3596 F3000
+G1 X4.320 Y2.500 Z-9.3848 F3000
+G1 X4.300 Y2.500 Z-9.4101 F3000
+G1 X4.280 Y2.500 Z-9.4355 F3000
+G1 X4.260 Y2.500 Z-9.4609 F3000
+G1 X4.240 Y2.500 Z-9.4865 F3000
+G1 X4.220 Y2.500 Z-9.5121 F3000
+G1 X4.200 Y2.500 Z-9.5379 F3000
+G1 X4.180 Y2.500 Z-9.5637 F3000
+G1 X4.160 Y2.500 Z-9.5896 F3000
+G1 X4.140 Y2.500 Z-9.6156 F3000
+G1 X4.120 Y2.500 Z-9.6416 F3000
+G1 X4.100 Y2.500 Z-9.6678 F3000
+G1 X4.080 Y2.500 Z-9.6941 F3000
+G1 X4.060 Y2.500 Z-9.7204 F3000
+G1 X4.040 Y2.500 Z-9.7469 F3000
+G1 X4.020 Y2.500 Z-9.7734 F3000
+G1 X4.000 Y2.500 Z-9.8000 F3000
+G1 X3.980 Y2.500 Z-9.8267 F3000
+G1 X3.960 Y2.500 Z-9.8535 F3000
+G1 X3.940 Y2.500 Z-9.8804 F3000
+G1 X3.920 Y2.500 Z-9.9074 F3000
+G1 X3.900 Y2.500 Z-9.9345 F3000
+G1 X3.880 Y2.500 Z-9.9617 F3000
+G1 X3.860 Y2.500 Z-9.9890 F3000
+G1 X3.840 Y2.500 Z-10.0164 F3000
+G1 X3.820 Y2.500 Z-10.0438 F3000
+G1 X3.800 Y2.500 Z-10.0714 F3000
+G1 X3.780 Y2.500 Z-10.0991 F3000
+G1 X3.760 Y2.500 Z-10.1269 F3000
+G1 X3.740 Y2.500 Z-10.1547 F3000
+G1 X3.720 Y2.500 Z-10.1827 F3000
+G1 X3.700 Y2.500 Z-10.2108 F3000
+G1 X3.680 Y2.500 Z-10.2390 F3000
+G1 X3.660 Y2.500 Z-10.2672 F3000
+G1 X3.640 Y2.500 Z-10.2956 F3000
+G1 X3.620 Y2.500 Z-10.3241 F3000
+G1 X3.600 Y2.500 Z-10.3527 F3000
+G1 X3.580 Y2.500 Z-10.3814 F3000
+G1 X3.560 Y2.500 Z-10.4103 F3000
+G1 X3.540 Y2.500 Z-10.4392 F3000
+G1 X3.520 Y2.500 Z-10.4682 F3000
+G1 X3.500 Y2.500 Z-10.4973 F3000
+G1 X3.480 Y2.500 Z-10.5266 F3000
+G1 X3.460 Y2.500 Z-10.5560 F3000
+G1 X3.440 Y2.500 Z-10.5854 F3000
+G1 X3.420 Y2.500 Z-10.6150 F3000
+G1 X3.400 Y2.500 Z-10.6447 F3000
+G1 X3.380 Y2.500 Z-10.6746 F3000
+G1 X3.360 Y2.500 Z-10.7045 F3000
+G1 X3.340 Y2.500 Z-10.7345 F3000
+G1 X3.320 Y2.500 Z-10.7647 F3000
+G1 X3.300 Y2.500 Z-10.7950 F3000
+G1 X3.280 Y2.500 Z-10.8254 F3000
+G1 X3.260 Y2.500 Z-10.8559 F3000
+G1 X3.240 Y2.500 Z-10.8866 F3000
+G1 X3.220 Y2.500 Z-10.9174 F3000
+G1 X3.200 Y2.500 Z-10.9483 F3000
+G1 X3.180 Y2.500 Z-10.9793 F3000
+G1 X3.160 Y2.500 Z-11.0104 F3000
+G1 X3.140 Y2.500 Z-11.0417 F3000
+G1 X3.120 Y2.500 Z-11.0731 F3000
+G1 X3.100 Y2.500 Z-11.1047 F3000
+G1 X3.080 Y2.500 Z-11.1363 F3000
+G1 X3.060 Y2.500 Z-11.1681 F3000
+G1 X3.040 Y2.500 Z-11.2001 F3000
+G1 X3.020 Y2.500 Z-11.2321 F3000
+G1 X3.000 Y2.500 Z-11.2643 F3000
+G1 X2.980 Y2.500 Z-11.2967 F3000
+G1 X2.960 Y2.500 Z-11.3292 F3000
+G1 X2.940 Y2.500 Z-11.3618 F3000
+G1 X2.920 Y2.500 Z-11.3945 F3000
+G1 X2.900 Y2.500 Z-11.4274 F3000
+G1 X2.880 Y2.500 Z-11.4605 F3000
+G1 X2.860 Y2.500 Z-11.4937 F3000
+G1 X2.840 Y2.500 Z-11.5270 F3000
+G1 X2.820 Y2.500 Z-11.5605 F3000
+G1 X2.800 Y2.500 Z-11.5941 F3000
+G1 X2.780 Y2.500 Z-11.6279 F3000
+G1 X2.760 Y2.500 Z-11.6618 F3000
+G1 X2.740 Y2.500 Z-11.6959 F3000
+G1 X2.720 Y2.500 Z-11.7302 F3000
+G1 X2.700 Y2.500 Z-11.7646 F3000
+G1 X2.680 Y2.500 Z-11.7991 F3000
+G1 X2.660 Y2.500 Z-11.8338 F3000
+G1 X2.640 Y2.500 Z-11.8687 F3000
+G1 X2.620 Y2.500 Z-11.9038 F3000
+G1 X2.600 Y2.500 Z-11.9390 F3000
+G1 X2.580 Y2.500 Z-11.9743 F3000
+G1 X2.560 Y2.500 Z-12.0099 F3000
+G1 X2.540 Y2.500 Z-12.0456 F3000
+G1 X2.520 Y2.500 Z-12.0815 F3000
+G1 X2.500 Y2.500 Z-12.1175 F3000
+G1 X2.480 Y2.500 Z-12.1538 F3000
+G1 X2.460 Y2.500 Z-12.1902 F3000
+G1 X2.440 Y2.500 Z-12.2268 F3000
+G1 X2.420 Y2.500 Z-12.2636 F3000
+G1 X2.400 Y2.500 Z-12.3005 F3000
+G1 X2.380 Y2.500 Z-12.3377 F3000
+G1 X2.360 Y2.500 Z-12.3750 F3000
+G1 X2.340 Y2.500 Z-12.4125 F3000
+G1 X2.320 Y2.500 Z-12.4503 F3000
+G1 X2.300 Y2.500 Z-12.4882 F3000
+G1 X2.280 Y2.500 Z-12.5263 F3000
+G1 X2.260 Y2.500 Z-12.5646 F3000
+G1 X2.240 Y2.500 Z-12.6031 F3000
+G1 X2.220 Y2.500 Z-12.6419 F3000
+G1 X2.200 Y2.500 Z-12.6808 F3000
+G1 X2.180 Y2.500 Z-12.7199 F3000
+G1 X2.160 Y2.500 Z-12.7593 F3000
+G1 X2.140 Y2.500 Z-12.7989 F3000
+G1 X2.120 Y2.500 Z-12.8387 F3000
+G1 X2.100 Y2.500 Z-12.8787 F3000
+G1 X2.080 Y2.500 Z-12.9189 F3000
+G1 X2.060 Y2.500 Z-12.9594 F3000
+G1 X2.040 Y2.500 Z-13.0001 F3000
+G1 X2.020 Y2.500 Z-13.0410 F3000
+G1 X2.000 Y2.500 Z-13.0822 F3000
+G1 X1.980 Y2.500 Z-13.1236 F3000
+G1 X1.960 Y2.500 Z-13.1653 F3000
+G1 X1.940 Y2.500 Z-13.2072 F3000
+G1 X1.920 Y2.500 Z-13.2494 F3000
+G1 X1.900 Y2.500 Z-13.2918 F3000
+G1 X1.880 Y2.500 Z-13.3344 F3000
+G1 X1.860 Y2.500 Z-13.3774 F3000
+G1 X1.840 Y2.500 Z-13.4206 F3000
+G1 X1.820 Y2.500 Z-13.4641 F3000
+G1 X1.800 Y2.500 Z-13.5078 F3000
+G1 X1.780 Y2.500 Z-13.5519 F3000
+G1 X1.760 Y2.500 Z-13.5962 F3000
+G1 X1.740 Y2.500 Z-13.6408 F3000
+G1 X1.720 Y2.500 Z-13.6857 F3000
+G1 X1.700 Y2.500 Z-13.7309 F3000
+G1 X1.680 Y2.500 Z-13.7764 F3000
+G1 X1.660 Y2.500 Z-13.8223 F3000
+G1 X1.640 Y2.500 Z-13.8684 F3000
+G1 X1.620 Y2.500 Z-13.9148 F3000
+G1 X1.600 Y2.500 Z-13.9616 F3000
+G1 X1.580 Y2.500 Z-14.0087 F3000
+G1 X1.560 Y2.500 Z-14.0562 F3000
+G1 X1.540 Y2.500 Z-14.1040 F3000
+G1 X1.520 Y2.500 Z-14.1522 F3000
+G1 X1.500 Y2.500 Z-14.2007 F3000
+G1 X1.480 Y2.500 Z-14.2495 F3000
+G1 X1.460 Y2.500 Z-14.2988 F3000
+G1 X1.440 Y2.500 Z-14.3484 F3000
+G1 X1.420 Y2.500 Z-14.3984 F3000
+G1 X1.400 Y2.500 Z-14.4488 F3000
+G1 X1.380 Y2.500 Z-14.4996 F3000
+G1 X1.360 Y2.500 Z-14.5508 F3000
+G1 X1.340 Y2.500 Z-14.6025 F3000
+G1 X1.320 Y2.500 Z-14.6545 F3000
+G1 X1.300 Y2.500 Z-14.7070 F3000
+G1 X1.280 Y2.500 Z-14.7600 F3000
+G1 X1.260 Y2.500 Z-14.8134 F3000
+G1 X1.240 Y2.500 Z-14.8673 F3000
+G1 X1.220 Y2.500 Z-14.9217 F3000
+G1 X1.200 Y2.500 Z-14.9765 F3000
+G1 X1.180 Y2.500 Z-15.0319 F3000
+G1 X1.160 Y2.500 Z-15.0877 F3000
+G1 X1.140 Y2.500 Z-15.1441 F3000
+G1 X1.120 Y2.500 Z-15.2011 F3000
+G1 X1.100 Y2.500 Z-15.2586 F3000
+G1 X1.080 Y2.500 Z-15.3167 F3000
+G1 X1.060 Y2.500 Z-15.3753 F3000
+G1 X1.040 Y2.500 Z-15.4346 F3000
+G1 X1.020 Y2.500 Z-15.4945 F3000
+G1 X1.000 Y2.500 Z-15.5550 F3000
+G1 X0.980 Y2.500 Z-15.6162 F3000
+G1 X0.960 Y2.500 Z-15.6780 F3000
+G1 X0.940 Y2.500 Z-15.7406 F3000
+G1 X0.920 Y2.500 Z-15.8039 F3000
+G1 X0.900 Y2.500 Z-15.8679 F3000
+G1 X0.880 Y2.500 Z-15.9327 F3000
+G1 X0.860 Y2.500 Z-15.9982 F3000
+G1 X0.840 Y2.500 Z-16.0646 F3000
+G1 X0.820 Y2.500 Z-16.1319 F3000
+G1 X0.800 Y2.500 Z-16.2000 F3000
+G1 X0.780 Y2.500 Z-16.2690 F3000
+G1 X0.760 Y2.500 Z-16.3390 F3000
+G1 X0.740 Y2.500 Z-16.4100 F3000
+G1 X0.720 Y2.500 Z-16.4820 F3000
+G1 X0.700 Y2.500 Z-16.5550 F3000
+G1 X0.680 Y2.500 Z-16.6292 F3000
+G1 X0.660 Y2.500 Z-16.7045 F3000
+G1 X0.640 Y2.500 Z-16.7810 F3000
+G1 X0.620 Y2.500 Z-16.8588 F3000
+G1 X0.600 Y2.500 Z-16.9379 F3000
+G1 X0.580 Y2.500 Z-17.0184 F3000
+G1 X0.560 Y2.500 Z-17.1004 F3000
+G1 X0.540 Y2.500 Z-17.1839 F3000
+G1 X0.520 Y2.500 Z-17.2690 F3000
+G1 X0.500 Y2.500 Z-17.3559 F3000
+G1 X0.480 Y2.500 Z-17.4446 F3000
+G1 X0.460 Y2.500 Z-17.5352 F3000
+G1 X0.440 Y2.500 Z-17.6279 F3000
+G1 X0.420 Y2.500 Z-17.7228 F3000
+G1 X0.400 Y2.500 Z-17.8201 F3000
+G1 X0.380 Y2.500 Z-17.9198 F3000
+G1 X0.360 Y2.500 Z-18.0224 F3000
+G1 X0.340 Y2.500 Z-18.1279 F3000
+G1 X0.320 Y2.500 Z-18.2366 F3000
+G1 X0.300 Y2.500 Z-18.3489 F3000
+G1 X0.280 Y2.500 Z-18.4651 F3000
+G1 X0.260 Y2.500 Z-18.5856 F3000
+G1 X0.240 Y2.500 Z-18.7109 F3000
+G1 X0.220 Y2.500 Z-18.8417 F3000
+G1 X0.200 Y2.500 Z-18.9787 F3000
+G1 X0.180 Y2.500 Z-19.1228 F3000
+G1 X0.160 Y2.500 Z-19.2752 F3000
+G1 X0.140 Y2.500 Z-19.4377 F3000
+G1 X0.120 Y2.500 Z-19.6124 F3000
+G1 X0.100 Y2.500 Z-19.8025 F3000
+G1 X0.080 Y2.500 Z-20.0129 F3000
+G1 X0.060 Y2.500 Z-20.2520 F3000
+G1 X0.040 Y2.500 Z-20.5357 F3000
+G1 X0.020 Y2.500 Z-20.9058 F3000
+G1 X0.000 Y2.500 Z-21.8000 F3000
+G1 X0.000 Y3.000 Z-21.8000 F3000
+G1 X0.020 Y3.000 Z-21.0586 F3000
+G1 X0.040 Y3.000 Z-20.6388 F3000
+G1 X0.060 Y3.000 Z-20.3349 F3000
+G1 X0.080 Y3.000 Z-20.0843 F3000
+G1 X0.100 Y3.000 Z-19.8661 F3000
+G1 X0.120 Y3.000 Z-19.6703 F3000
+G1 X0.140 Y3.000 Z-19.4912 F3000
+G1 X0.160 Y3.000 Z-19.3252 F3000
+G1 X0.180 Y3.000 Z-19.1699 F3000
+G1 X0.200 Y3.000 Z-19.0233 F3000
+G1 X0.220 Y3.000 Z-18.8842 F3000
+G1 X0.240 Y3.000 Z-18.7517 F3000
+G1 X0.260 Y3.000 Z-18.6247 F3000
+G1 X0.280 Y3.000 Z-18.5028 F3000
+G1 X0.300 Y3.000 Z-18.3853 F3000
+G1 X0.320 Y3.000 Z-18.2719 F3000
+G1 X0.340 Y3.000 Z-18.1621 F3000
+G1 X0.360 Y3.000 Z-18.0556 F3000
+G1 X0.380 Y3.000 Z-17.9522 F3000
+G1 X0.400 Y3.000 Z-17.8516 F3000
+G1 X0.420 Y3.000 Z-17.7536 F3000
+G1 X0.440 Y3.000 Z-17.6580 F3000
+G1 X0.460 Y3.000 Z-17.5646 F3000
+G1 X0.480 Y3.000 Z-17.4734 F3000
+G1 X0.500 Y3.000 Z-17.3841 F3000
+G1 X0.520 Y3.000 Z-17.2967 F3000
+G1 X0.540 Y3.000 Z-17.2111 F3000
+G1 X0.560 Y3.000 Z-17.1271 F3000
+G1 X0.580 Y3.000 Z-17.0446 F3000
+G1 X0.600 Y3.000 Z-16.9637 F3000
+G1 X0.620 Y3.000 Z-16.8841 F3000
+G1 X0.640 Y3.000 Z-16.8060 F3000
+G1 X0.660 Y3.000 Z-16.7291 F3000
+G1 X0.680 Y3.000 Z-16.6534 F3000
+G1 X0.700 Y3.000 Z-16.5789 F3000
+G1 X0.720 Y3.000 Z-16.5055 F3000
+G1 X0.740 Y3.000 Z-16.4332 F3000
+G1 X0.760 Y3.000 Z-16.3619 F3000
+G1 X0.780 Y3.000 Z-16.2917 F3000
+G1 X0.800 Y3.000 Z-16.2224 F3000
+G1 X0.820 Y3.000 Z-16.1540 F3000
+G1 X0.840 Y3.000 Z-16.0865 F3000
+G1 X0.860 Y3.000 Z-16.0198 F3000
+G1 X0.880 Y3.000 Z-15.9540 F3000
+G1 X0.900 Y3.000 Z-15.8890 F3000
+G1 X0.920 Y3.000 Z-15.8248 F3000
+G1 X0.940 Y3.000 Z-15.7613 F3000
+G1 X0.960 Y3.000 Z-15.6985 F3000
+G1 X0.980 Y3.000 Z-15.6364 F3000
+G1 X1.000 Y3.000 Z-15.5751 F3000
+G1 X1.020 Y3.000 Z-15.5143 F3000
+G1 X1.040 Y3.000 Z-15.4543 F3000
+G1 X1.060 Y3.000 Z-15.3948 F3000
+G1 X1.080 Y3.000 Z-15.3360 F3000
+G1 X1.100 Y3.000 Z-15.2777 F3000
+G1 X1.120 Y3.000 Z-15.2201 F3000
+G1 X1.140 Y3.000 Z-15.1630 F3000
+G1 X1.160 Y3.000 Z-15.1064 F3000
+G1 X1.180 Y3.000 Z-15.0504 F3000
+G1 X1.200 Y3.000 Z-14.9949 F3000
+G1 X1.220 Y3.000 Z-14.9399 F3000
+G1 X1.240 Y3.000 Z-14.8853 F3000
+G1 X1.260 Y3.000 Z-14.8313 F3000
+G1 X1.280 Y3.000 Z-14.7778 F3000
+G1 X1.300 Y3.000 Z-14.7247 F3000
+G1 X1.320 Y3.000 Z-14.6721 F3000
+G1 X1.340 Y3.000 Z-14.6199 F3000
+G1 X1.360 Y3.000 Z-14.5681 F3000
+G1 X1.380 Y3.000 Z-14.5168 F3000
+G1 X1.400 Y3.000 Z-14.4658 F3000
+G1 X1.420 Y3.000 Z-14.4153 F3000
+G1 X1.440 Y3.000 Z-14.3652 F3000
+G1 X1.460 Y3.000 Z-14.3155 F3000
+G1 X1.480 Y3.000 Z-14.2661 F3000
+G1 X1.500 Y3.000 Z-14.2171 F3000
+G1 X1.520 Y3.000 Z-14.1685 F3000
+G1 X1.540 Y3.000 Z-14.1203 F3000
+G1 X1.560 Y3.000 Z-14.0724 F3000
+G1 X1.580 Y3.000 Z-14.0248 F3000
+G1 X1.600 Y3.000 Z-13.9776 F3000
+G1 X1.620 Y3.000 Z-13.9307 F3000
+G1 X1.640 Y3.000 Z-13.8842 F3000
+G1 X1.660 Y3.000 Z-13.8379 F3000
+G1 X1.680 Y3.000 Z-13.7920 F3000
+G1 X1.700 Y3.000 Z-13.7464 F3000
+G1 X1.720 Y3.000 Z-13.7011 F3000
+G1 X1.740 Y3.000 Z-13.6561 F3000
+G1 X1.760 Y3.000 Z-13.6114 F3000
+G1 X1.780 Y3.000 Z-13.5670 F3000
+G1 X1.800 Y3.000 Z-13.5229 F3000
+G1 X1.820 Y3.000 Z-13.4791 F3000
+G1 X1.840 Y3.000 Z-13.4355 F3000
+G1 X1.860 Y3.000 Z-13.3922 F3000
+G1 X1.880 Y3.000 Z-13.3492 F3000
+G1 X1.900 Y3.000 Z-13.3065 F3000
+G1 X1.920 Y3.000 Z-13.2640 F3000
+G1 X1.940 Y3.000 Z-13.2217 F3000
+G1 X1.960 Y3.000 Z-13.1798 F3000
+G1 X1.980 Y3.000 Z-13.1380 F3000
+G1 X2.000 Y3.000 Z-13.0966 F3000
+G1 X2.020 Y3.000 Z-13.0553 F3000
+G1 X2.040 Y3.000 Z-13.0143 F3000
+G1 X2.060 Y3.000 Z-12.9735 F3000
+G1 X2.080 Y3.000 Z-12.9330 F3000
+G1 X2.100 Y3.000 Z-12.8927 F3000
+G1 X2.120 Y3.000 Z-12.8526 F3000
+G1 X2.140 Y3.000 Z-12.8128 F3000
+G1 X2.160 Y3.000 Z-12.7731 F3000
+G1 X2.180 Y3.000 Z-12.7337 F3000
+G1 X2.200 Y3.000 Z-12.6945 F3000
+G1 X2.220 Y3.000 Z-12.6555 F3000
+G1 X2.240 Y3.000 Z-12.6167 F3000
+G1 X2.260 Y3.000 Z-12.5782 F3000
+G1 X2.280 Y3.000 Z-12.5398 F3000
+G1 X2.300 Y3.000 Z-12.5016 F3000
+G1 X2.320 Y3.000 Z-12.4636 F3000
+G1 X2.340 Y3.000 Z-12.4259 F3000
+G1 X2.360 Y3.000 Z-12.3883 F3000
+G1 X2.380 Y3.000 Z-12.3509 F3000
+G1 X2.400 Y3.000 Z-12.3137 F3000
+G1 X2.420 Y3.000 Z-12.2767 F3000
+G1 X2.440 Y3.000 Z-12.2399 F3000
+G1 X2.460 Y3.000 Z-12.2032 F3000
+G1 X2.480 Y3.000 Z-12.1667 F3000
+G1 X2.500 Y3.000 Z-12.1305 F3000
+G1 X2.520 Y3.000 Z-12.0944 F3000
+G1 X2.540 Y3.000 Z-12.0584 F3000
+G1 X2.560 Y3.000 Z-12.0227 F3000
+G1 X2.580 Y3.000 Z-11.9871 F3000
+G1 X2.600 Y3.000 Z-11.9516 F3000
+G1 X2.620 Y3.000 Z-11.9164 F3000
+G1 X2.640 Y3.000 Z-11.8813 F3000
+G1 X2.660 Y3.000 Z-11.8464 F3000
+G1 X2.680 Y3.000 Z-11.8116 F3000
+G1 X2.700 Y3.000 Z-11.7770 F3000
+G1 X2.720 Y3.000 Z-11.7426 F3000
+G1 X2.740 Y3.000 Z-11.7083 F3000
+G1 X2.760 Y3.000 Z-11.6742 F3000
+G1 X2.780 Y3.000 Z-11.6402 F3000
+G1 X2.800 Y3.000 Z-11.6064 F3000
+G1 X2.820 Y3.000 Z-11.5727 F3000
+G1 X2.840 Y3.000 Z-11.5392 F3000
+G1 X2.860 Y3.000 Z-11.5058 F3000
+G1 X2.880 Y3.000 Z-11.4726 F3000
+G1 X2.900 Y3.000 Z-11.4395 F3000
+G1 X2.920 Y3.000 Z-11.4066 F3000
+G1 X2.940 Y3.000 Z-11.3738 F3000
+G1 X2.960 Y3.000 Z-11.3411 F3000
+G1 X2.980 Y3.000 Z-11.3086 F3000
+G1 X3.000 Y3.000 Z-11.2762 F3000
+G1 X3.020 Y3.000 Z-11.2440 F3000
+G1 X3.040 Y3.000 Z-11.2119 F3000
+G1 X3.060 Y3.000 Z-11.1799 F3000
+G1 X3.080 Y3.000 Z-11.1481 F3000
+G1 X3.100 Y3.000 Z-11.1164 F3000
+G1 X3.120 Y3.000 Z-11.0848 F3000
+G1 X3.140 Y3.000 Z-11.0534 F3000
+G1 X3.160 Y3.000 Z-11.0220 F3000
+G1 X3.180 Y3.000 Z-10.9909 F3000
+G1 X3.200 Y3.000 Z-10.9598 F3000
+G1 X3.220 Y3.000 Z-10.9289 F3000
+G1 X3.240 Y3.000 Z-10.8981 F3000
+G1 X3.260 Y3.000 Z-10.8674 F3000
+G1 X3.280 Y3.000 Z-10.8368 F3000
+G1 X3.300 Y3.000 Z-10.8064 F3000
+G1 X3.320 Y3.000 Z-10.7760 F3000
+G1 X3.340 Y3.000 Z-10.7458 F3000
+G1 X3.360 Y3.000 Z-10.7158 F3000
+G1 X3.380 Y3.000 Z-10.6858 F3000
+G1 X3.400 Y3.000 Z-10.6559 F3000
+G1 X3.420 Y3.000 Z-10.6262 F3000
+G1 X3.440 Y3.000 Z-10.5966 F3000
+G1 X3.460 Y3.000 Z-10.5671 F3000
+G1 X3.480 Y3.000 Z-10.5377 F3000
+G1 X3.500 Y3.000 Z-10.5084 F3000
+G1 X3.520 Y3.000 Z-10.4792 F3000
+G1 X3.540 Y3.000 Z-10.4502 F3000
+G1 X3.560 Y3.000 Z-10.4212 F3000
+G1 X3.580 Y3.000 Z-10.3924 F3000
+G1 X3.600 Y3.000 Z-10.3637 F3000
+G1 X3.620 Y3.000 Z-10.3350 F3000
+G1 X3.640 Y3.000 Z-10.3065 F3000
+G1 X3.660 Y3.000 Z-10.2781 F3000
+G1 X3.680 Y3.000 Z-10.2498 F3000
+G1 X3.700 Y3.000 Z-10.2216 F3000
+G1 X3.720 Y3.000 Z-10.1935 F3000
+G1 X3.740 Y3.000 Z-10.1655 F3000
+G1 X3.760 Y3.000 Z-10.1376 F3000
+G1 X3.780 Y3.000 Z-10.1098 F3000
+G1 X3.800 Y3.000 Z-10.0821 F3000
+G1 X3.820 Y3.000 Z-10.0545 F3000
+G1 X3.840 Y3.000 Z-10.0270 F3000
+G1 X3.860 Y3.000 Z-9.9996 F3000
+G1 X3.880 Y3.000 Z-9.9723 F3000
+G1 X3.900 Y3.000 Z-9.9450 F3000
+G1 X3.920 Y3.000 Z-9.9179 F3000
+G1 X3.940 Y3.000 Z-9.8909 F3000
+G1 X3.960 Y3.000 Z-9.8640 F3000
+G1 X3.980 Y3.000 Z-9.8372 F3000
+G1 X4.000 Y3.000 Z-9.8104 F3000
+G1 X4.020 Y3.000 Z-9.7838 F3000
+G1 X4.040 Y3.000 Z-9.7572 F3000
+G1 X4.060 Y3.000 Z-9.7308 F3000
+G1 X4.080 Y3.000 Z-9.7044 F3000
+G1 X4.100 Y3.000 Z-9.6781 F3000
+G1 X4.120 Y3.000 Z-9.6519 F3000
+G1 X4.140 Y3.000 Z-9.6258 F3000
+G1 X4.160 Y3.000 Z-9.5998 F3000
+G1 X4.180 Y3.000 Z-9.5739 F3000
+G1 X4.200 Y3.000 Z-9.5481 F3000
+G1 X4.220 Y3.000 Z-9.5223 F3000
+G1 X4.240 Y3.000 Z-9.4967 F3000
+G1 X4.260 Y3.000 Z-9.4711 F3000
+G1 X4.280 Y3.000 Z-9.4456 F3000
+G1 X4.300 Y3.000 Z-9.4202 F3000
+G1 X4.320 Y3.000 Z-9.3949 F3000
+G1 X4.340 Y3.000 Z-9.3696 F3000
+G1 X4.360 Y3.000 Z-9.3445 F3000
+G1 X4.380 Y3.000 Z-9.3194 F3000
+G1 X4.400 Y3.000 Z-9.2944 F3000
+G1 X4.420 Y3.000 Z-9.2695 F3000
+G1 X4.440 Y3.000 Z-9.2447 F3000
+G1 X4.460 Y3.000 Z-9.2199 F3000
+G1 X4.480 Y3.000 Z-9.1953 F3000
+G1 X4.500 Y3.000 Z-9.1707 F3000
+G1 X4.520 Y3.000 Z-9.1462 F3000
+G1 X4.540 Y3.000 Z-9.1217 F3000
+G1 X4.560 Y3.000 Z-9.0974 F3000
+G1 X4.580 Y3.000 Z-9.0731 F3000
+G1 X4.600 Y3.000 Z-9.0489 F3000
+G1 X4.620 Y3.000 Z-9.0248 F3000
+G1 X4.640 Y3.000 Z-9.0008 F3000
+G1 X4.660 Y3.000 Z-8.9768 F3000
+G1 X4.680 Y3.000 Z-8.9529 F3000
+G1 X4.700 Y3.000 Z-8.9291 F3000
+G1 X4.720 Y3.000 Z-8.9054 F3000
+G1 X4.740 Y3.000 Z-8.8817 F3000
+G1 X4.760 Y3.000 Z-8.8581 F3000
+G1 X4.780 Y3.000 Z-8.8346 F3000
+G1 X4.800 Y3.000 Z-8.8112 F3000
+G1 X4.820 Y3.000 Z-8.7878 F3000
+G1 X4.840 Y3.000 Z-8.7645 F3000
+G1 X4.860 Y3.000 Z-8.7413 F3000
+G1 X4.880 Y3.000 Z-8.7181 F3000
+G1 X4.900 Y3.000 Z-8.6950 F3000
+G1 X4.920 Y3.000 Z-8.6720 F3000
+G1 X4.940 Y3.000 Z-8.6491 F3000
+G1 X4.960 Y3.000 Z-8.6262 F3000
+G1 X4.980 Y3.000 Z-8.6034 F3000
+G1 X5.000 Y3.000 Z-8.5807 F3000
+G1 X5.020 Y3.000 Z-8.5580 F3000
+G1 X5.040 Y3.000 Z-8.5354 F3000
+G1 X5.060 Y3.000 Z-8.5129 F3000
+G1 X5.080 Y3.000 Z-8.4905 F3000
+G1 X5.100 Y3.000 Z-8.4681 F3000
+G1 X5.120 Y3.000 Z-8.4458 F3000
+G1 X5.140 Y3.000 Z-8.4235 F3000
+G1 X5.160 Y3.000 Z-8.4013 F3000
+G1 X5.180 Y3.000 Z-8.3792 F3000
+G1 X5.200 Y3.000 Z-8.3572 F3000
+G1 X5.220 Y3.000 Z-8.3352 F3000
+G1 X5.240 Y3.000 Z-8.3133 F3000
+G1 X5.260 Y3.000 Z-8.2914 F3000
+G1 X5.280 Y3.000 Z-8.2696 F3000
+G1 X5.300 Y3.000 Z-8.2479 F3000
+G1 X5.320 Y3.000 Z-8.2262 F3000
+G1 X5.340 Y3.000 Z-8.2046 F3000
+G1 X5.360 Y3.000 Z-8.1831 F3000
+G1 X5.380 Y3.000 Z-8.1616 F3000
+G1 X5.400 Y3.000 Z-8.1402 F3000
+G1 X5.420 Y3.000 Z-8.1189 F3000
+G1 X5.440 Y3.000 Z-8.0976 F3000
+G1 X5.460 Y3.000 Z-8.0764 F3000
+G1 X5.480 Y3.000 Z-8.0552 F3000
+G1 X5.500 Y3.000 Z-8.0341 F3000
+G1 X5.520 Y3.000 Z-8.0131 F3000
+G1 X5.540 Y3.000 Z-7.9921 F3000
+G1 X5.560 Y3.000 Z-7.9712 F3000
+G1 X5.580 Y3.000 Z-7.9503 F3000
+G1 X5.600 Y3.000 Z-7.9295 F3000
+G1 X5.620 Y3.000 Z-7.9088 F3000
+G1 X5.640 Y3.000 Z-7.8881 F3000
+G1 X5.660 Y3.000 Z-7.8675 F3000
+G1 X5.680 Y3.000 Z-7.8470 F3000
+G1 X5.700 Y3.000 Z-7.8265 F3000
+G1 X5.720 Y3.000 Z-7.8060 F3000
+G1 X5.740 Y3.000 Z-7.7856 F3000
+G1 X5.760 Y3.000 Z-7.7653 F3000
+G1 X5.780 Y3.000 Z-7.7451 F3000
+G1 X5.800 Y3.000 Z-7.7248 F3000
+G1 X5.820 Y3.000 Z-7.7047 F3000
+G1 X5.840 Y3.000 Z-7.6846 F3000
+G1 X5.860 Y3.000 Z-7.6646 F3000
+G1 X5.880 Y3.000 Z-7.6446 F3000
+G1 X5.900 Y3.000 Z-7.6247 F3000
+G1 X5.920 Y3.000 Z-7.6048 F3000
+G1 X5.940 Y3.000 Z-7.5850 F3000
+G1 X5.960 Y3.000 Z-7.5652 F3000
+G1 X5.980 Y3.000 Z-7.5455 F3000
+G1 X6.000 Y3.000 Z-7.5259 F3000
+G1 X6.020 Y3.000 Z-7.5063 F3000
+G1 X6.040 Y3.000 Z-7.4868 F3000
+G1 X6.060 Y3.000 Z-7.4673 F3000
+G1 X6.080 Y3.000 Z-7.4479 F3000
+G1 X6.100 Y3.000 Z-7.4285 F3000
+G1 X6.120 Y3.000 Z-7.4092 F3000
+G1 X6.140 Y3.000 Z-7.3899 F3000
+G1 X6.160 Y3.000 Z-7.3707 F3000
+G1 X6.180 Y3.000 Z-7.3516 F3000
+G1 X6.200 Y3.000 Z-7.3325 F3000
+G1 X6.220 Y3.000 Z-7.3134 F3000
+G1 X6.240 Y3.000 Z-7.2944 F3000
+G1 X6.260 Y3.000 Z-7.2755 F3000
+G1 X6.280 Y3.000 Z-7.2566 F3000
+G1 X6.300 Y3.000 Z-7.2377 F3000
+G1 X6.320 Y3.000 Z-7.2189 F3000
+G1 X6.340 Y3.000 Z-7.2002 F3000
+G1 X6.360 Y3.000 Z-7.1815 F3000
+G1 X6.380 Y3.000 Z-7.1629 F3000
+G1 X6.400 Y3.000 Z-7.1443 F3000
+G1 X6.420 Y3.000 Z-7.1258 F3000
+G1 X6.440 Y3.000 Z-7.1073 F3000
+G1 X6.460 Y3.000 Z-7.0888 F3000
+G1 X6.480 Y3.000 Z-7.0705 F3000
+G1 X6.500 Y3.000 Z-7.0521 F3000
+G1 X6.520 Y3.000 Z-7.0338 F3000
+G1 X6.540 Y3.000 Z-7.0156 F3000
+G1 X6.560 Y3.000 Z-6.9974 F3000
+G1 X6.580 Y3.000 Z-6.9793 F3000
+G1 X6.600 Y3.000 Z-6.9612 F3000
+G1 X6.620 Y3.000 Z-6.9432 F3000
+G1 X6.640 Y3.000 Z-6.9252 F3000
+G1 X6.660 Y3.000 Z-6.9072 F3000
+G1 X6.680 Y3.000 Z-6.8893 F3000
+G1 X6.700 Y3.000 Z-6.8715 F3000
+G1 X6.720 Y3.000 Z-6.8537 F3000
+G1 X6.740 Y3.000 Z-6.8360 F3000
+G1 X6.760 Y3.000 Z-6.8183 F3000
+G1 X6.780 Y3.000 Z-6.8006 F3000
+G1 X6.800 Y3.000 Z-6.7830 F3000
+G1 X6.820 Y3.000 Z-6.7655 F3000
+G1 X6.840 Y3.000 Z-6.7479 F3000
+G1 X6.860 Y3.000 Z-6.7305 F3000
+G1 X6.880 Y3.000 Z-6.7131 F3000
+G1 X6.900 Y3.000 Z-6.6957 F3000
+G1 X6.920 Y3.000 Z-6.6784 F3000
+G1 X6.940 Y3.000 Z-6.6611 F3000
+G1 X6.960 Y3.000 Z-6.6439 F3000
+G1 X6.980 Y3.000 Z-6.6267 F3000
+G1 X7.000 Y3.000 Z-6.6095 F3000
+G1 X7.020 Y3.000 Z-6.5924 F3000
+G1 X7.040 Y3.000 Z-6.5754 F3000
+G1 X7.060 Y3.000 Z-6.5584 F3000
+G1 X7.080 Y3.000 Z-6.5414 F3000
+G1 X7.100 Y3.000 Z-6.5245 F3000
+G1 X7.120 Y3.000 Z-6.5077 F3000
+G1 X7.140 Y3.000 Z-6.4908 F3000
+G1 X7.160 Y3.000 Z-6.4741 F3000
+G1 X7.180 Y3.000 Z-6.4573 F3000
+G1 X7.200 Y3.000 Z-6.4406 F3000
+G1 X7.220 Y3.000 Z-6.4240 F3000
+G1 X7.240 Y3.000 Z-6.4074 F3000
+G1 X7.260 Y3.000 Z-6.3908 F3000
+G1 X7.280 Y3.000 Z-6.3743 F3000
+G1 X7.300 Y3.000 Z-6.3578 F3000
+G1 X7.320 Y3.000 Z-6.3414 F3000
+G1 X7.340 Y3.000 Z-6.3250 F3000
+G1 X7.360 Y3.000 Z-6.3087 F3000
+G1 X7.380 Y3.000 Z-6.2924 F3000
+G1 X7.400 Y3.000 Z-6.2761 F3000
+G1 X7.420 Y3.000 Z-6.2599 F3000
+G1 X7.440 Y3.000 Z-6.2438 F3000
+G1 X7.460 Y3.000 Z-6.2276 F3000
+G1 X7.480 Y3.000 Z-6.2116 F3000
+G1 X7.500 Y3.000 Z-6.1955 F3000
+G1 X7.520 Y3.000 Z-6.1795 F3000
+G1 X7.540 Y3.000 Z-6.1636 F3000
+G1 X7.560 Y3.000 Z-6.1476 F3000
+G1 X7.580 Y3.000 Z-6.1318 F3000
+G1 X7.600 Y3.000 Z-6.1159 F3000
+G1 X7.620 Y3.000 Z-6.1001 F3000
+G1 X7.640 Y3.000 Z-6.0844 F3000
+G1 X7.660 Y3.000 Z-6.0687 F3000
+G1 X7.680 Y3.000 Z-6.0530 F3000
+G1 X7.700 Y3.000 Z-6.0374 F3000
+G1 X7.720 Y3.000 Z-6.0218 F3000
+G1 X7.740 Y3.000 Z-6.0063 F3000
+G1 X7.760 Y3.000 Z-5.9907 F3000
+G1 X7.780 Y3.000 Z-5.9753 F3000
+G1 X7.800 Y3.000 Z-5.9599 F3000
+G1 X7.820 Y3.000 Z-5.9445 F3000
+G1 X7.840 Y3.000 Z-5.9291 F3000
+G1 X7.860 Y3.000 Z-5.9138 F3000
+G1 X7.880 Y3.000 Z-5.8986 F3000
+G1 X7.900 Y3.000 Z-5.8833 F3000
+G1 X7.920 Y3.000 Z-5.8682 F3000
+G1 X7.940 Y3.000 Z-5.8530 F3000
+G1 X7.960 Y3.000 Z-5.8379 F3000
+G1 X7.980 Y3.000 Z-5.8228 F3000
+G1 X8.000 Y3.000 Z-5.8078 F3000
+G1 X8.020 Y3.000 Z-5.7928 F3000
+G1 X8.040 Y3.000 Z-5.7779 F3000
+G1 X8.060 Y3.000 Z-5.7630 F3000
+G1 X8.080 Y3.000 Z-5.7481 F3000
+G1 X8.100 Y3.000 Z-5.7333 F3000
+G1 X8.120 Y3.000 Z-5.7185 F3000
+G1 X8.140 Y3.000 Z-5.7037 F3000
+G1 X8.160 Y3.000 Z-5.6890 F3000
+G1 X8.180 Y3.000 Z-5.6743 F3000
+G1 X8.200 Y3.000 Z-5.6597 F3000
+G1 X8.220 Y3.000 Z-5.6451 F3000
+G1 X8.240 Y3.000 Z-5.6305 F3000
+G1 X8.260 Y3.000 Z-5.6160 F3000
+G1 X8.280 Y3.000 Z-5.6015 F3000
+G1 X8.300 Y3.000 Z-5.5870 F3000
+G1 X8.320 Y3.000 Z-5.5726 F3000
+G1 X8.340 Y3.000 Z-5.5583 F3000
+G1 X8.360 Y3.000 Z-5.5439 F3000
+G1 X8.380 Y3.000 Z-5.5296 F3000
+G1 X8.400 Y3.000 Z-5.5153 F3000
+G1 X8.420 Y3.000 Z-5.5011 F3000
+G1 X8.440 Y3.000 Z-5.4869 F3000
+G1 X8.460 Y3.000 Z-5.4728 F3000
+G1 X8.480 Y3.000 Z-5.4587 F3000
+G1 X8.500 Y3.000 Z-5.4446 F3000
+G1 X8.520 Y3.000 Z-5.4305 F3000
+G1 X8.540 Y3.000 Z-5.4165 F3000
+G1 X8.560 Y3.000 Z-5.4025 F3000
+G1 X8.580 Y3.000 Z-5.3886 F3000
+G1 X8.600 Y3.000 Z-5.3747 F3000
+G1 X8.620 Y3.000 Z-5.3609 F3000
+G1 X8.640 Y3.000 Z-5.3470 F3000
+G1 X8.660 Y3.000 Z-5.3332 F3000
+G1 X8.680 Y3.000 Z-5.3195 F3000
+G1 X8.700 Y3.000 Z-5.3058 F3000
+G1 X8.720 Y3.000 Z-5.2921 F3000
+G1 X8.740 Y3.000 Z-5.2784 F3000
+G1 X8.760 Y3.000 Z-5.2648 F3000
+G1 X8.780 Y3.000 Z-5.2512 F3000
+G1 X8.800 Y3.000 Z-5.2377 F3000
+G1 X8.820 Y3.000 Z-5.2242 F3000
+G1 X8.840 Y3.000 Z-5.2107 F3000
+G1 X8.860 Y3.000 Z-5.1973 F3000
+G1 X8.880 Y3.000 Z-5.1839 F3000
+G1 X8.900 Y3.000 Z-5.1705 F3000
+G1 X8.920 Y3.000 Z-5.1572 F3000
+G1 X8.940 Y3.000 Z-5.1439 F3000
+G1 X8.960 Y3.000 Z-5.1306 F3000
+G1 X8.980 Y3.000 Z-5.1174 F3000
+G1 X9.000 Y3.000 Z-5.1042 F3000
+G1 X9.020 Y3.000 Z-5.0910 F3000
+G1 X9.040 Y3.000 Z-5.0779 F3000
+G1 X9.060 Y3.000 Z-5.0648 F3000
+G1 X9.080 Y3.000 Z-5.0518 F3000
+G1 X9.100 Y3.000 Z-5.0387 F3000
+G1 X9.120 Y3.000 Z-5.0257 F3000
+G1 X9.140 Y3.000 Z-5.0128 F3000
+G1 X9.160 Y3.000 Z-4.9999 F3000
+G1 X9.180 Y3.000 Z-4.9870 F3000
+G1 X9.200 Y3.000 Z-4.9741 F3000
+G1 X9.220 Y3.000 Z-4.9613 F3000
+G1 X9.240 Y3.000 Z-4.9485 F3000
+G1 X9.260 Y3.000 Z-4.9358 F3000
+G1 X9.280 Y3.000 Z-4.9230 F3000
+G1 X9.300 Y3.000 Z-4.9104 F3000
+G1 X9.320 Y3.000 Z-4.8977 F3000
+G1 X9.340 Y3.000 Z-4.8851 F3000
+G1 X9.360 Y3.000 Z-4.8725 F3000
+G1 X9.380 Y3.000 Z-4.8599 F3000
+G1 X9.400 Y3.000 Z-4.8474 F3000
+G1 X9.420 Y3.000 Z-4.8349 F3000
+G1 X9.440 Y3.000 Z-4.8225 F3000
+G1 X9.460 Y3.000 Z-4.8101 F3000
+G1 X9.480 Y3.000 Z-4.7977 F3000
+G1 X9.500 Y3.000 Z-4.7853 F3000
+G1 X9.520 Y3.000 Z-4.7730 F3000
+G1 X9.540 Y3.000 Z-4.7607 F3000
+G1 X9.560 Y3.000 Z-4.7484 F3000
+G1 X9.580 Y3.000 Z-4.7362 F3000
+G1 X9.600 Y3.000 Z-4.7240 F3000
+G1 X9.620 Y3.000 Z-4.7118 F3000
+G1 X9.640 Y3.000 Z-4.6997 F3000
+G1 X9.660 Y3.000 Z-4.6876 F3000
+G1 X9.680 Y3.000 Z-4.6755 F3000
+G1 X9.700 Y3.000 Z-4.6635 F3000
+G1 X9.720 Y3.000 Z-4.6515 F3000
+G1 X9.740 Y3.000 Z-4.6395 F3000
+G1 X9.760 Y3.000 Z-4.6276 F3000
+G1 X9.780 Y3.000 Z-4.6157 F3000
+G1 X9.800 Y3.000 Z-4.6038 F3000
+G1 X9.820 Y3.000 Z-4.5919 F3000
+G1 X9.840 Y3.000 Z-4.5801 F3000
+G1 X9.860 Y3.000 Z-4.5683 F3000
+G1 X9.880 Y3.000 Z-4.5566 F3000
+G1 X9.900 Y3.000 Z-4.5449 F3000
+G1 X9.920 Y3.000 Z-4.5332 F3000
+G1 X9.940 Y3.000 Z-4.5215 F3000
+G1 X9.960 Y3.000 Z-4.5099 F3000
+G1 X9.980 Y3.000 Z-4.4983 F3000
+G1 X10.000 Y3.000 Z-4.4867 F3000
+G1 X10.020 Y3.000 Z-4.4752 F3000
+G1 X10.040 Y3.000 Z-4.4637 F3000
+G1 X10.060 Y3.000 Z-4.4522 F3000
+G1 X10.080 Y3.000 Z-4.4407 F3000
+G1 X10.100 Y3.000 Z-4.4293 F3000
+G1 X10.120 Y3.000 Z-4.4180 F3000
+G1 X10.140 Y3.000 Z-4.4066 F3000
+G1 X10.160 Y3.000 Z-4.3953 F3000
+G1 X10.180 Y3.000 Z-4.3840 F3000
+G1 X10.200 Y3.000 Z-4.3727 F3000
+G1 X10.220 Y3.000 Z-4.3615 F3000
+G1 X10.240 Y3.000 Z-4.3503 F3000
+G1 X10.260 Y3.000 Z-4.3391 F3000
+G1 X10.280 Y3.000 Z-4.3280 F3000
+G1 X10.300 Y3.000 Z-4.3169 F3000
+G1 X10.320 Y3.000 Z-4.3058 F3000
+G1 X10.340 Y3.000 Z-4.2947 F3000
+G1 X10.360 Y3.000 Z-4.2837 F3000
+G1 X10.380 Y3.000 Z-4.2727 F3000
+G1 X10.400 Y3.000 Z-4.2618 F3000
+G1 X10.420 Y3.000 Z-4.2508 F3000
+G1 X10.440 Y3.000 Z-4.2399 F3000
+G1 X10.460 Y3.000 Z-4.2290 F3000
+G1 X10.480 Y3.000 Z-4.2182 F3000
+G1 X10.500 Y3.000 Z-4.2074 F3000
+G1 X10.520 Y3.000 Z-4.1966 F3000
+G1 X10.540 Y3.000 Z-4.1858 F3000
+G1 X10.560 Y3.000 Z-4.1751 F3000
+G1 X10.580 Y3.000 Z-4.1644 F3000
+G1 X10.600 Y3.000 Z-4.1538 F3000
+G1 X10.620 Y3.000 Z-4.1431 F3000
+G1 X10.640 Y3.000 Z-4.1325 F3000
+G1 X10.660 Y3.000 Z-4.1219 F3000
+G1 X10.680 Y3.000 Z-4.1114 F3000
+G1 X10.700 Y3.000 Z-4.1008 F3000
+G1 X10.720 Y3.000 Z-4.0904 F3000
+G1 X10.740 Y3.000 Z-4.0799 F3000
+G1 X10.760 Y3.000 Z-4.0695 F3000
+G1 X10.780 Y3.000 Z-4.0590 F3000
+G1 X10.800 Y3.000 Z-4.0487 F3000
+G1 X10.820 Y3.000 Z-4.0383 F3000
+G1 X10.840 Y3.000 Z-4.0280 F3000
+G1 X10.860 Y3.000 Z-4.0177 F3000
+G1 X10.880 Y3.000 Z-4.0074 F3000
+G1 X10.900 Y3.000 Z-3.9972 F3000
+G1 X10.920 Y3.000 Z-3.9870 F3000
+G1 X10.940 Y3.000 Z-3.9768 F3000
+G1 X10.960 Y3.000 Z-3.9666 F3000
+G1 X10.980 Y3.000 Z-3.9565 F3000
+G1 X11.000 Y3.000 Z-3.9464 F3000
+G1 X11.020 Y3.000 Z-3.9364 F3000
+G1 X11.040 Y3.000 Z-3.9263 F3000
+G1 X11.060 Y3.000 Z-3.9163 F3000
+G1 X11.080 Y3.000 Z-3.9063 F3000
+G1 X11.100 Y3.000 Z-3.8964 F3000
+G1 X11.120 Y3.000 Z-3.8864 F3000
+G1 X11.140 Y3.000 Z-3.8765 F3000
+G1 X11.160 Y3.000 Z-3.8667 F3000
+G1 X11.180 Y3.000 Z-3.8568 F3000
+G1 X11.200 Y3.000 Z-3.8470 F3000
+G1 X11.220 Y3.000 Z-3.8372 F3000
+G1 X11.240 Y3.000 Z-3.8275 F3000
+G1 X11.260 Y3.000 Z-3.8177 F3000
+G1 X11.280 Y3.000 Z-3.8080 F3000
+G1 X11.300 Y3.000 Z-3.7983 F3000
+G1 X11.320 Y3.000 Z-3.7887 F3000
+G1 X11.340 Y3.000 Z-3.7791 F3000
+G1 X11.360 Y3.000 Z-3.7695 F3000
+G1 X11.380 Y3.000 Z-3.7599 F3000
+G1 X11.400 Y3.000 Z-3.7503 F3000
+G1 X11.420 Y3.000 Z-3.7408 F3000
+G1 X11.440 Y3.000 Z-3.7313 F3000
+G1 X11.460 Y3.000 Z-3.7219 F3000
+G1 X11.480 Y3.000 Z-3.7124 F3000
+G1 X11.500 Y3.000 Z-3.7030 F3000
+G1 X11.520 Y3.000 Z-3.6937 F3000
+G1 X11.540 Y3.000 Z-3.6843 F3000
+G1 X11.560 Y3.000 Z-3.6750 F3000
+G1 X11.580 Y3.000 Z-3.6657 F3000
+G1 X11.600 Y3.000 Z-3.6564 F3000
+G1 X11.620 Y3.000 Z-3.6472 F3000
+G1 X11.640 Y3.000 Z-3.6379 F3000
+G1 X11.660 Y3.000 Z-3.6287 F3000
+G1 X11.680 Y3.000 Z-3.6196 F3000
+G1 X11.700 Y3.000 Z-3.6104 F3000
+G1 X11.720 Y3.000 Z-3.6013 F3000
+G1 X11.740 Y3.000 Z-3.5922 F3000
+G1 X11.760 Y3.000 Z-3.5832 F3000
+G1 X11.780 Y3.000 Z-3.5742 F3000
+G1 X11.800 Y3.000 Z-3.5651 F3000
+G1 X11.820 Y3.000 Z-3.5562 F3000
+G1 X11.840 Y3.000 Z-3.5472 F3000
+G1 X11.860 Y3.000 Z-3.5383 F3000
+G1 X11.880 Y3.000 Z-3.5294 F3000
+G1 X11.900 Y3.000 Z-3.5205 F3000
+G1 X11.920 Y3.000 Z-3.5117 F3000
+G1 X11.940 Y3.000 Z-3.5028 F3000
+G1 X11.960 Y3.000 Z-3.4940 F3000
+G1 X11.980 Y3.000 Z-3.4853 F3000
+G1 X12.000 Y3.000 Z-3.4765 F3000
+G1 X12.020 Y3.000 Z-3.4678 F3000
+G1 X12.040 Y3.000 Z-3.4591 F3000
+G1 X12.060 Y3.000 Z-3.4504 F3000
+G1 X12.080 Y3.000 Z-3.4418 F3000
+G1 X12.100 Y3.000 Z-3.4332 F3000
+G1 X12.120 Y3.000 Z-3.4246 F3000
+G1 X12.140 Y3.000 Z-3.4160 F3000
+G1 X12.160 Y3.000 Z-3.4075 F3000
+G1 X12.180 Y3.000 Z-3.3990 F3000
+G1 X12.200 Y3.000 Z-3.3905 F3000
+G1 X12.220 Y3.000 Z-3.3820 F3000
+G1 X12.240 Y3.000 Z-3.3736 F3000
+G1 X12.260 Y3.000 Z-3.3652 F3000
+G1 X12.280 Y3.000 Z-3.3568 F3000
+G1 X12.300 Y3.000 Z-3.3484 F3000
+G1 X12.320 Y3.000 Z-3.3401 F3000
+G1 X12.340 Y3.000 Z-3.3318 F3000
+G1 X12.360 Y3.000 Z-3.3235 F3000
+G1 X12.380 Y3.000 Z-3.3153 F3000
+G1 X12.400 Y3.000 Z-3.3070 F3000
+G1 X12.420 Y3.000 Z-3.2988 F3000
+G1 X12.440 Y3.000 Z-3.2906 F3000
+G1 X12.460 Y3.000 Z-3.2825 F3000
+G1 X12.480 Y3.000 Z-3.2744 F3000
+G1 X12.500 Y3.000 Z-3.2662 F3000
+G1 X12.520 Y3.000 Z-3.2582 F3000
+G1 X12.540 Y3.000 Z-3.2501 F3000
+G1 X12.560 Y3.000 Z-3.2421 F3000
+G1 X12.580 Y3.000 Z-3.2341 F3000
+G1 X12.600 Y3.000 Z-3.2261 F3000
+G1 X12.620 Y3.000 Z-3.2181 F3000
+G1 X12.640 Y3.000 Z-3.2102 F3000
+G1 X12.660 Y3.000 Z-3.2023 F3000
+G1 X12.680 Y3.000 Z-3.1944 F3000
+G1 X12.700 Y3.000 Z-3.1866 F3000
+G1 X12.720 Y3.000 Z-3.1787 F3000
+G1 X12.740 Y3.000 Z-3.1709 F3000
+G1 X12.760 Y3.000 Z-3.1631 F3000
+G1 X12.780 Y3.000 Z-3.1554 F3000
+G1 X12.800 Y3.000 Z-3.1477 F3000
+G1 X12.820 Y3.000 Z-3.1399 F3000
+G1 X12.840 Y3.000 Z-3.1323 F3000
+G1 X12.860 Y3.000 Z-3.1246 F3000
+G1 X12.880 Y3.000 Z-3.1170 F3000
+G1 X12.900 Y3.000 Z-3.1094 F3000
+G1 X12.920 Y3.000 Z-3.1018 F3000
+G1 X12.940 Y3.000 Z-3.0942 F3000
+G1 X12.960 Y3.000 Z-3.0867 F3000
+G1 X12.980 Y3.000 Z-3.0792 F3000
+G1 X13.000 Y3.000 Z-3.0717 F3000
+G1 X13.020 Y3.000 Z-3.0642 F3000
+G1 X13.040 Y3.000 Z-3.0568 F3000
+G1 X13.060 Y3.000 Z-3.0494 F3000
+G1 X13.080 Y3.000 Z-3.0420 F3000
+G1 X13.100 Y3.000 Z-3.0346 F3000
+G1 X13.120 Y3.000 Z-3.0273 F3000
+G1 X13.140 Y3.000 Z-3.0199 F3000
+G1 X13.160 Y3.000 Z-3.0127 F3000
+G1 X13.180 Y3.000 Z-3.0054 F3000
+G1 X13.200 Y3.000 Z-2.9981 F3000
+G1 X13.220 Y3.000 Z-2.9909 F3000
+G1 X13.240 Y3.000 Z-2.9837 F3000
+G1 X13.260 Y3.000 Z-2.9765 F3000
+G1 X13.280 Y3.000 Z-2.9694 F3000
+G1 X13.300 Y3.000 Z-2.9623 F3000
+G1 X13.320 Y3.000 Z-2.9552 F3000
+G1 X13.340 Y3.000 Z-2.9481 F3000
+G1 X13.360 Y3.000 Z-2.9410 F3000
+G1 X13.380 Y3.000 Z-2.9340 F3000
+G1 X13.400 Y3.000 Z-2.9270 F3000
+G1 X13.420 Y3.000 Z-2.9200 F3000
+G1 X13.440 Y3.000 Z-2.9131 F3000
+G1 X13.460 Y3.000 Z-2.9061 F3000
+G1 X13.480 Y3.000 Z-2.8992 F3000
+G1 X13.500 Y3.000 Z-2.8923 F3000
+G1 X13.520 Y3.000 Z-2.8855 F3000
+G1 X13.540 Y3.000 Z-2.8786 F3000
+G1 X13.560 Y3.000 Z-2.8718 F3000
+G1 X13.580 Y3.000 Z-2.8650 F3000
+G1 X13.600 Y3.000 Z-2.8582 F3000
+G1 X13.620 Y3.000 Z-2.8515 F3000
+G1 X13.640 Y3.000 Z-2.8448 F3000
+G1 X13.660 Y3.000 Z-2.8381 F3000
+G1 X13.680 Y3.000 Z-2.8314 F3000
+G1 X13.700 Y3.000 Z-2.8248 F3000
+G1 X13.720 Y3.000 Z-2.8181 F3000
+G1 X13.740 Y3.000 Z-2.8115 F3000
+G1 X13.760 Y3.000 Z-2.8049 F3000
+G1 X13.780 Y3.000 Z-2.7984 F3000
+G1 X13.800 Y3.000 Z-2.7918 F3000
+G1 X13.820 Y3.000 Z-2.7853 F3000
+G1 X13.840 Y3.000 Z-2.7788 F3000
+G1 X13.860 Y3.000 Z-2.7724 F3000
+G1 X13.880 Y3.000 Z-2.7659 F3000
+G1 X13.900 Y3.000 Z-2.7595 F3000
+G1 X13.920 Y3.000 Z-2.7531 F3000
+G1 X13.940 Y3.000 Z-2.7467 F3000
+G1 X13.960 Y3.000 Z-2.7404 F3000
+G1 X13.980 Y3.000 Z-2.7341 F3000
+G1 X14.000 Y3.000 Z-2.7278 F3000
+G1 X14.020 Y3.000 Z-2.7215 F3000
+G1 X14.040 Y3.000 Z-2.7152 F3000
+G1 X14.060 Y3.000 Z-2.7090 F3000
+G1 X14.080 Y3.000 Z-2.7028 F3000
+G1 X14.100 Y3.000 Z-2.6966 F3000
+G1 X14.120 Y3.000 Z-2.6904 F3000
+G1 X14.140 Y3.000 Z-2.6843 F3000
+G1 X14.160 Y3.000 Z-2.6782 F3000
+G1 X14.180 Y3.000 Z-2.6721 F3000
+G1 X14.200 Y3.000 Z-2.6660 F3000
+G1 X14.220 Y3.000 Z-2.6599 F3000
+G1 X14.240 Y3.000 Z-2.6539 F3000
+G1 X14.260 Y3.000 Z-2.6479 F3000
+G1 X14.280 Y3.000 Z-2.6419 F3000
+G1 X14.300 Y3.000 Z-2.6360 F3000
+G1 X14.320 Y3.000 Z-2.6300 F3000
+G1 X14.340 Y3.000 Z-2.6241 F3000
+G1 X14.360 Y3.000 Z-2.6182 F3000
+G1 X14.380 Y3.000 Z-2.6124 F3000
+G1 X14.400 Y3.000 Z-2.6065 F3000
+G1 X14.420 Y3.000 Z-2.6007 F3000
+G1 X14.440 Y3.000 Z-2.5949 F3000
+G1 X14.460 Y3.000 Z-2.5891 F3000
+G1 X14.480 Y3.000 Z-2.5834 F3000
+G1 X14.500 Y3.000 Z-2.5776 F3000
+G1 X14.520 Y3.000 Z-2.5719 F3000
+G1 X14.540 Y3.000 Z-2.5662 F3000
+G1 X14.560 Y3.000 Z-2.5606 F3000
+G1 X14.580 Y3.000 Z-2.5549 F3000
+G1 X14.600 Y3.000 Z-2.5493 F3000
+G1 X14.620 Y3.000 Z-2.5437 F3000
+G1 X14.640 Y3.000 Z-2.5381 F3000
+G1 X14.660 Y3.000 Z-2.5326 F3000
+G1 X14.680 Y3.000 Z-2.5270 F3000
+G1 X14.700 Y3.000 Z-2.5215 F3000
+G1 X14.720 Y3.000 Z-2.5160 F3000
+G1 X14.740 Y3.000 Z-2.5106 F3000
+G1 X14.760 Y3.000 Z-2.5051 F3000
+G1 X14.780 Y3.000 Z-2.4997 F3000
+G1 X14.800 Y3.000 Z-2.4943 F3000
+G1 X14.820 Y3.000 Z-2.4889 F3000
+G1 X14.840 Y3.000 Z-2.4836 F3000
+G1 X14.860 Y3.000 Z-2.4782 F3000
+G1 X14.880 Y3.000 Z-2.4729 F3000
+G1 X14.900 Y3.000 Z-2.4676 F3000
+G1 X14.920 Y3.000 Z-2.4624 F3000
+G1 X14.940 Y3.000 Z-2.4571 F3000
+G1 X14.960 Y3.000 Z-2.4519 F3000
+G1 X14.980 Y3.000 Z-2.4467 F3000
+G1 X15.000 Y3.000 Z-2.4415 F3000
+G1 X15.020 Y3.000 Z-2.4364 F3000
+G1 X15.040 Y3.000 Z-2.4313 F3000
+G1 X15.060 Y3.000 Z-2.4261 F3000
+G1 X15.080 Y3.000 Z-2.4211 F3000
+G1 X15.100 Y3.000 Z-2.4160 F3000
+G1 X15.120 Y3.000 Z-2.4109 F3000
+G1 X15.140 Y3.000 Z-2.4059 F3000
+G1 X15.160 Y3.000 Z-2.4009 F3000
+G1 X15.180 Y3.000 Z-2.3959 F3000
+G1 X15.200 Y3.000 Z-2.3910 F3000
+G1 X15.220 Y3.000 Z-2.3860 F3000
+G1 X15.240 Y3.000 Z-2.3811 F3000
+G1 X15.260 Y3.000 Z-2.3762 F3000
+G1 X15.280 Y3.000 Z-2.3714 F3000
+G1 X15.300 Y3.000 Z-2.3665 F3000
+G1 X15.320 Y3.000 Z-2.3617 F3000
+G1 X15.340 Y3.000 Z-2.3569 F3000
+G1 X15.360 Y3.000 Z-2.3521 F3000
+G1 X15.380 Y3.000 Z-2.3473 F3000
+G1 X15.400 Y3.000 Z-2.3426 F3000
+G1 X15.420 Y3.000 Z-2.3379 F3000
+G1 X15.440 Y3.000 Z-2.3332 F3000
+G1 X15.460 Y3.000 Z-2.3285 F3000
+G1 X15.480 Y3.000 Z-2.3239 F3000
+G1 X15.500 Y3.000 Z-2.3192 F3000
+G1 X15.520 Y3.000 Z-2.3146 F3000
+G1 X15.540 Y3.000 Z-2.3100 F3000
+G1 X15.560 Y3.000 Z-2.3055 F3000
+G1 X15.580 Y3.000 Z-2.3009 F3000
+G1 X15.600 Y3.000 Z-2.2964 F3000
+G1 X15.620 Y3.000 Z-2.2919 F3000
+G1 X15.640 Y3.000 Z-2.2874 F3000
+G1 X15.660 Y3.000 Z-2.2830 F3000
+G1 X15.680 Y3.000 Z-2.2785 F3000
+G1 X15.700 Y3.000 Z-2.2741 F3000
+G1 X15.720 Y3.000 Z-2.2697 F3000
+G1 X15.740 Y3.000 Z-2.2654 F3000
+G1 X15.760 Y3.000 Z-2.2610 F3000
+G1 X15.780 Y3.000 Z-2.2567 F3000
+G1 X15.800 Y3.000 Z-2.2524 F3000
+G1 X15.820 Y3.000 Z-2.2481 F3000
+G1 X15.840 Y3.000 Z-2.2438 F3000
+G1 X15.860 Y3.000 Z-2.2396 F3000
+G1 X15.880 Y3.000 Z-2.2353 F3000
+G1 X15.900 Y3.000 Z-2.2311 F3000
+G1 X15.920 Y3.000 Z-2.2270 F3000
+G1 X15.940 Y3.000 Z-2.2228 F3000
+G1 X15.960 Y3.000 Z-2.2187 F3000
+G1 X15.980 Y3.000 Z-2.2146 F3000
+G1 X16.000 Y3.000 Z-2.2105 F3000
+G1 X16.020 Y3.000 Z-2.2064 F3000
+G1 X16.040 Y3.000 Z-2.2023 F3000
+G1 X16.060 Y3.000 Z-2.1983 F3000
+G1 X16.080 Y3.000 Z-2.1943 F3000
+G1 X16.100 Y3.000 Z-2.1903 F3000
+G1 X16.120 Y3.000 Z-2.1863 F3000
+G1 X16.140 Y3.000 Z-2.1824 F3000
+G1 X16.160 Y3.000 Z-2.1785 F3000
+G1 X16.180 Y3.000 Z-2.1746 F3000
+G1 X16.200 Y3.000 Z-2.1707 F3000
+G1 X16.220 Y3.000 Z-2.1668 F3000
+G1 X16.240 Y3.000 Z-2.1630 F3000
+G1 X16.260 Y3.000 Z-2.1592 F3000
+G1 X16.280 Y3.000 Z-2.1554 F3000
+G1 X16.300 Y3.000 Z-2.1516 F3000
+G1 X16.320 Y3.000 Z-2.1478 F3000
+G1 X16.340 Y3.000 Z-2.1441 F3000
+G1 X16.360 Y3.000 Z-2.1404 F3000
+G1 X16.380 Y3.000 Z-2.1367 F3000
+G1 X16.400 Y3.000 Z-2.1330 F3000
+G1 X16.420 Y3.000 Z-2.1294 F3000
+G1 X16.440 Y3.000 Z-2.1257 F3000
+G1 X16.460 Y3.000 Z-2.1221 F3000
+G1 X16.480 Y3.000 Z-2.1185 F3000
+G1 X16.500 Y3.000 Z-2.1150 F3000
+G1 X16.520 Y3.000 Z-2.1114 F3000
+G1 X16.540 Y3.000 Z-2.1079 F3000
+G1 X16.560 Y3.000 Z-2.1044 F3000
+G1 X16.580 Y3.000 Z-2.1009 F3000
+G1 X16.600 Y3.000 Z-2.0975 F3000
+G1 X16.620 Y3.000 Z-2.0940 F3000
+G1 X16.640 Y3.000 Z-2.0906 F3000
+G1 X16.660 Y3.000 Z-2.0872 F3000
+G1 X16.680 Y3.000 Z-2.0838 F3000
+G1 X16.700 Y3.000 Z-2.0805 F3000
+G1 X16.720 Y3.000 Z-2.0771 F3000
+G1 X16.740 Y3.000 Z-2.0738 F3000
+G1 X16.760 Y3.000 Z-2.0705 F3000
+G1 X16.780 Y3.000 Z-2.0672 F3000
+G1 X16.800 Y3.000 Z-2.0640 F3000
+G1 X16.820 Y3.000 Z-2.0608 F3000
+G1 X16.840 Y3.000 Z-2.0575 F3000
+G1 X16.860 Y3.000 Z-2.0544 F3000
+G1 X16.880 Y3.000 Z-2.0512 F3000
+G1 X16.900 Y3.000 Z-2.0480 F3000
+G1 X16.920 Y3.000 Z-2.0449 F3000
+G1 X16.940 Y3.000 Z-2.0418 F3000
+G1 X16.960 Y3.000 Z-2.0387 F3000
+G1 X16.980 Y3.000 Z-2.0356 F3000
+G1 X17.000 Y3.000 Z-2.0326 F3000
+G1 X17.020 Y3.000 Z-2.0296 F3000
+G1 X17.040 Y3.000 Z-2.0266 F3000
+G1 X17.060 Y3.000 Z-2.0236 F3000
+G1 X17.080 Y3.000 Z-2.0206 F3000
+G1 X17.100 Y3.000 Z-2.0177 F3000
+G1 X17.120 Y3.000 Z-2.0148 F3000
+G1 X17.140 Y3.000 Z-2.0119 F3000
+G1 X17.160 Y3.000 Z-2.0090 F3000
+G1 X17.180 Y3.000 Z-2.0061 F3000
+G1 X17.200 Y3.000 Z-2.0033 F3000
+G1 X17.220 Y3.000 Z-2.0005 F3000
+G1 X17.240 Y3.000 Z-1.9977 F3000
+G1 X17.260 Y3.000 Z-1.9949 F3000
+G1 X17.280 Y3.000 Z-1.9921 F3000
+G1 X17.300 Y3.000 Z-1.9894 F3000
+G1 X17.320 Y3.000 Z-1.9867 F3000
+G1 X17.340 Y3.000 Z-1.9840 F3000
+G1 X17.360 Y3.000 Z-1.9813 F3000
+G1 X17.380 Y3.000 Z-1.9787 F3000
+G1 X17.400 Y3.000 Z-1.9760 F3000
+G1 X17.420 Y3.000 Z-1.9734 F3000
+G1 X17.440 Y3.000 Z-1.9708 F3000
+G1 X17.460 Y3.000 Z-1.9682 F3000
+G1 X17.480 Y3.000 Z-1.9657 F3000
+G1 X17.500 Y3.000 Z-1.9632 F3000
+G1 X17.520 Y3.000 Z-1.9607 F3000
+G1 X17.540 Y3.000 Z-1.9582 F3000
+G1 X17.560 Y3.000 Z-1.9557 F3000
+G1 X17.580 Y3.000 Z-1.9532 F3000
+G1 X17.600 Y3.000 Z-1.9508 F3000
+G1 X17.620 Y3.000 Z-1.9484 F3000
+G1 X17.640 Y3.000 Z-1.9460 F3000
+G1 X17.660 Y3.000 Z-1.9437 F3000
+G1 X17.680 Y3.000 Z-1.9413 F3000
+G1 X17.700 Y3.000 Z-1.9390 F3000
+G1 X17.720 Y3.000 Z-1.9367 F3000
+G1 X17.740 Y3.000 Z-1.9344 F3000
+G1 X17.760 Y3.000 Z-1.9321 F3000
+G1 X17.780 Y3.000 Z-1.9299 F3000
+G1 X17.800 Y3.000 Z-1.9277 F3000
+G1 X17.820 Y3.000 Z-1.9255 F3000
+G1 X17.840 Y3.000 Z-1.9233 F3000
+G1 X17.860 Y3.000 Z-1.9211 F3000
+G1 X17.880 Y3.000 Z-1.9190 F3000
+G1 X17.900 Y3.000 Z-1.9168 F3000
+G1 X17.920 Y3.000 Z-1.9147 F3000
+G1 X17.940 Y3.000 Z-1.9127 F3000
+G1 X17.960 Y3.000 Z-1.9106 F3000
+G1 X17.980 Y3.000 Z-1.9086 F3000
+G1 X18.000 Y3.000 Z-1.9065 F3000
+G1 X18.020 Y3.000 Z-1.9045 F3000
+G1 X18.040 Y3.000 Z-1.9026 F3000
+G1 X18.060 Y3.000 Z-1.9006 F3000
+G1 X18.080 Y3.000 Z-1.8987 F3000
+G1 X18.100 Y3.000 Z-1.8967 F3000
+G1 X18.120 Y3.000 Z-1.8948 F3000
+G1 X18.140 Y3.000 Z-1.8930 F3000
+G1 X18.160 Y3.000 Z-1.8911 F3000
+G1 X18.180 Y3.000 Z-1.8893 F3000
+G1 X18.200 Y3.000 Z-1.8874 F3000
+G1 X18.220 Y3.000 Z-1.8856 F3000
+G1 X18.240 Y3.000 Z-1.8839 F3000
+G1 X18.260 Y3.000 Z-1.8821 F3000
+G1 X18.280 Y3.000 Z-1.8804 F3000
+G1 X18.300 Y3.000 Z-1.8787 F3000
+G1 X18.320 Y3.000 Z-1.8770 F3000
+G1 X18.340 Y3.000 Z-1.8753 F3000
+G1 X18.360 Y3.000 Z-1.8736 F3000
+G1 X18.380 Y3.000 Z-1.8720 F3000
+G1 X18.400 Y3.000 Z-1.8704 F3000
+G1 X18.420 Y3.000 Z-1.8688 F3000
+G1 X18.440 Y3.000 Z-1.8672 F3000
+G1 X18.460 Y3.000 Z-1.8656 F3000
+G1 X18.480 Y3.000 Z-1.8641 F3000
+G1 X18.500 Y3.000 Z-1.8626 F3000
+G1 X18.520 Y3.000 Z-1.8611 F3000
+G1 X18.540 Y3.000 Z-1.8596 F3000
+G1 X18.560 Y3.000 Z-1.8582 F3000
+G1 X18.580 Y3.000 Z-1.8567 F3000
+G1 X18.600 Y3.000 Z-1.8553 F3000
+G1 X18.620 Y3.000 Z-1.8539 F3000
+G1 X18.640 Y3.000 Z-1.8526 F3000
+G1 X18.660 Y3.000 Z-1.8512 F3000
+G1 X18.680 Y3.000 Z-1.8499 F3000
+G1 X18.700 Y3.000 Z-1.8486 F3000
+G1 X18.720 Y3.000 Z-1.8473 F3000
+G1 X18.740 Y3.000 Z-1.8460 F3000
+G1 X18.760 Y3.000 Z-1.8447 F3000
+G1 X18.780 Y3.000 Z-1.8435 F3000
+G1 X18.800 Y3.000 Z-1.8423 F3000
+G1 X18.820 Y3.000 Z-1.8411 F3000
+G1 X18.840 Y3.000 Z-1.8399 F3000
+G1 X18.860 Y3.000 Z-1.8388 F3000
+G1 X18.880 Y3.000 Z-1.8376 F3000
+G1 X18.900 Y3.000 Z-1.8365 F3000
+G1 X18.920 Y3.000 Z-1.8354 F3000
+G1 X18.940 Y3.000 Z-1.8344 F3000
+G1 X18.960 Y3.000 Z-1.8333 F3000
+G1 X18.980 Y3.000 Z-1.8323 F3000
+G1 X19.000 Y3.000 Z-1.8313 F3000
+G1 X19.020 Y3.000 Z-1.8303 F3000
+G1 X19.040 Y3.000 Z-1.8293 F3000
+G1 X19.060 Y3.000 Z-1.8284 F3000
+G1 X19.080 Y3.000 Z-1.8274 F3000
+G1 X19.100 Y3.000 Z-1.8265 F3000
+G1 X19.120 Y3.000 Z-1.8256 F3000
+G1 X19.140 Y3.000 Z-1.8248 F3000
+G1 X19.160 Y3.000 Z-1.8239 F3000
+G1 X19.180 Y3.000 Z-1.8231 F3000
+G1 X19.200 Y3.000 Z-1.8223 F3000
+G1 X19.220 Y3.000 Z-1.8215 F3000
+G1 X19.240 Y3.000 Z-1.8207 F3000
+G1 X19.260 Y3.000 Z-1.8199 F3000
+G1 X19.280 Y3.000 Z-1.8192 F3000
+G1 X19.300 Y3.000 Z-1.8185 F3000
+G1 X19.320 Y3.000 Z-1.8178 F3000
+G1 X19.340 Y3.000 Z-1.8171 F3000
+G1 X19.360 Y3.000 Z-1.8165 F3000
+G1 X19.380 Y3.000 Z-1.8159 F3000
+G1 X19.400 Y3.000 Z-1.8153 F3000
+G1 X19.420 Y3.000 Z-1.8147 F3000
+G1 X19.440 Y3.000 Z-1.8141 F3000
+G1 X19.460 Y3.000 Z-1.8135 F3000
+G1 X19.480 Y3.000 Z-1.8130 F3000
+G1 X19.500 Y3.000 Z-1.8125 F3000
+G1 X19.520 Y3.000 Z-1.8120 F3000
+G1 X19.540 Y3.000 Z-1.8115 F3000
+G1 X19.560 Y3.000 Z-1.8111 F3000
+G1 X19.580 Y3.000 Z-1.8107 F3000
+G1 X19.600 Y3.000 Z-1.8103 F3000
+G1 X19.620 Y3.000 Z-1.8099 F3000
+G1 X19.640 Y3.000 Z-1.8095 F3000
+G1 X19.660 Y3.000 Z-1.8091 F3000
+G1 X19.680 Y3.000 Z-1.8088 F3000
+G1 X19.700 Y3.000 Z-1.8085 F3000
+G1 X19.720 Y3.000 Z-1.8082 F3000
+G1 X19.740 Y3.000 Z-1.8079 F3000
+G1 X19.760 Y3.000 Z-1.8077 F3000
+G1 X19.780 Y3.000 Z-1.8075 F3000
+G1 X19.800 Y3.000 Z-1.8073 F3000
+G1 X19.820 Y3.000 Z-1.8071 F3000
+G1 X19.840 Y3.000 Z-1.8069 F3000
+G1 X19.860 Y3.000 Z-1.8067 F3000
+G1 X19.880 Y3.000 Z-1.8066 F3000
+G1 X19.900 Y3.000 Z-1.8065 F3000
+G1 X19.920 Y3.000 Z-1.8064 F3000
+G1 X19.940 Y3.000 Z-1.8063 F3000
+G1 X19.960 Y3.000 Z-1.8063 F3000
+G1 X19.980 Y3.000 Z-1.8063 F3000
+G1 X20.000 Y3.000 Z-1.8063 F3000
+G1 X20.020 Y3.000 Z-1.8063 F3000
+G1 X20.040 Y3.000 Z-1.8063 F3000
+G1 X20.060 Y3.000 Z-1.8063 F3000
+G1 X20.080 Y3.000 Z-1.8064 F3000
+G1 X20.100 Y3.000 Z-1.8065 F3000
+G1 X20.120 Y3.000 Z-1.8066 F3000
+G1 X20.140 Y3.000 Z-1.8067 F3000
+G1 X20.160 Y3.000 Z-1.8069 F3000
+G1 X20.180 Y3.000 Z-1.8071 F3000
+G1 X20.200 Y3.000 Z-1.8073 F3000
+G1 X20.220 Y3.000 Z-1.8075 F3000
+G1 X20.240 Y3.000 Z-1.8077 F3000
+G1 X20.260 Y3.000 Z-1.8079 F3000
+G1 X20.280 Y3.000 Z-1.8082 F3000
+G1 X20.300 Y3.000 Z-1.8085 F3000
+G1 X20.320 Y3.000 Z-1.8088 F3000
+G1 X20.340 Y3.000 Z-1.8091 F3000
+G1 X20.360 Y3.000 Z-1.8095 F3000
+G1 X20.380 Y3.000 Z-1.8099 F3000
+G1 X20.400 Y3.000 Z-1.8103 F3000
+G1 X20.420 Y3.000 Z-1.8107 F3000
+G1 X20.440 Y3.000 Z-1.8111 F3000
+G1 X20.460 Y3.000 Z-1.8115 F3000
+G1 X20.480 Y3.000 Z-1.8120 F3000
+G1 X20.500 Y3.000 Z-1.8125 F3000
+G1 X20.520 Y3.000 Z-1.8130 F3000
+G1 X20.540 Y3.000 Z-1.8135 F3000
+G1 X20.560 Y3.000 Z-1.8141 F3000
+G1 X20.580 Y3.000 Z-1.8147 F3000
+G1 X20.600 Y3.000 Z-1.8153 F3000
+G1 X20.620 Y3.000 Z-1.8159 F3000
+G1 X20.640 Y3.000 Z-1.8165 F3000
+G1 X20.660 Y3.000 Z-1.8171 F3000
+G1 X20.680 Y3.000 Z-1.8178 F3000
+G1 X20.700 Y3.000 Z-1.8185 F3000
+G1 X20.720 Y3.000 Z-1.8192 F3000
+G1 X20.740 Y3.000 Z-1.8199 F3000
+G1 X20.760 Y3.000 Z-1.8207 F3000
+G1 X20.780 Y3.000 Z-1.8215 F3000
+G1 X20.800 Y3.000 Z-1.8223 F3000
+G1 X20.820 Y3.000 Z-1.8231 F3000
+G1 X20.840 Y3.000 Z-1.8239 F3000
+G1 X20.860 Y3.000 Z-1.8248 F3000
+G1 X20.880 Y3.000 Z-1.8256 F3000
+G1 X20.900 Y3.000 Z-1.8265 F3000
+G1 X20.920 Y3.000 Z-1.8274 F3000
+G1 X20.940 Y3.000 Z-1.8284 F3000
+G1 X20.960 Y3.000 Z-1.8293 F3000
+G1 X20.980 Y3.000 Z-1.8303 F3000
+G1 X21.000 Y3.000 Z-1.8313 F3000
+G1 X21.020 Y3.000 Z-1.8323 F3000
+G1 X21.040 Y3.000 Z-1.8333 F3000
+G1 X21.060 Y3.000 Z-1.8344 F3000
+G1 X21.080 Y3.000 Z-1.8354 F3000
+G1 X21.100 Y3.000 Z-1.8365 F3000
+G1 X21.120 Y3.000 Z-1.8376 F3000
+G1 X21.140 Y3.000 Z-1.8388 F3000
+G1 X21.160 Y3.000 Z-1.8399 F3000
+G1 X21.180 Y3.000 Z-1.8411 F3000
+G1 X21.200 Y3.000 Z-1.8423 F3000
+G1 X21.220 Y3.000 Z-1.8435 F3000
+G1 X21.240 Y3.000 Z-1.8447 F3000
+G1 X21.260 Y3.000 Z-1.8460 F3000
+G1 X21.280 Y3.000 Z-1.8473 F3000
+G1 X21.300 Y3.000 Z-1.8486 F3000
+G1 X21.320 Y3.000 Z-1.8499 F3000
+G1 X21.340 Y3.000 Z-1.8512 F3000
+G1 X21.360 Y3.000 Z-1.8526 F3000
+G1 X21.380 Y3.000 Z-1.8539 F3000
+G1 X21.400 Y3.000 Z-1.8553 F3000
+G1 X21.420 Y3.000 Z-1.8567 F3000
+G1 X21.440 Y3.000 Z-1.8582 F3000
+G1 X21.460 Y3.000 Z-1.8596 F3000
+G1 X21.480 Y3.000 Z-1.8611 F3000
+G1 X21.500 Y3.000 Z-1.8626 F3000
+G1 X21.520 Y3.000 Z-1.8641 F3000
+G1 X21.540 Y3.000 Z-1.8656 F3000
+G1 X21.560 Y3.000 Z-1.8672 F3000
+G1 X21.580 Y3.000 Z-1.8688 F3000
+G1 X21.600 Y3.000 Z-1.8704 F3000
+G1 X21.620 Y3.000 Z-1.8720 F3000
+G1 X21.640 Y3.000 Z-1.8736 F3000
+G1 X21.660 Y3.000 Z-1.8753 F3000
+G1 X21.680 Y3.000 Z-1.8770 F3000
+G1 X21.700 Y3.000 Z-1.8787 F3000
+G1 X21.720 Y3.000 Z-1.8804 F3000
+G1 X21.740 Y3.000 Z-1.8821 F3000
+G1 X21.760 Y3.000 Z-1.8839 F3000
+G1 X21.780 Y3.000 Z-1.8856 F3000
+G1 X21.800 Y3.000 Z-1.8874 F3000
+G1 X21.820 Y3.000 Z-1.8893 F3000
+G1 X21.840 Y3.000 Z-1.8911 F3000
+G1 X21.860 Y3.000 Z-1.8930 F3000
+G1 X21.880 Y3.000 Z-1.8948 F3000
+G1 X21.900 Y3.000 Z-1.8967 F3000
+G1 X21.920 Y3.000 Z-1.8987 F3000
+G1 X21.940 Y3.000 Z-1.9006 F3000
+G1 X21.960 Y3.000 Z-1.9026 F3000
+G1 X21.980 Y3.000 Z-1.9045 F3000
+G1 X22.000 Y3.000 Z-1.9065 F3000
+G1 X22.020 Y3.000 Z-1.9086 F3000
+G1 X22.040 Y3.000 Z-1.9106 F3000
+G1 X22.060 Y3.000 Z-1.9127 F3000
+G1 X22.080 Y3.000 Z-1.9147 F3000
+G1 X22.100 Y3.000 Z-1.9168 F3000
+G1 X22.120 Y3.000 Z-1.9190 F3000
+G1 X22.140 Y3.000 Z-1.9211 F3000
+G1 X22.160 Y3.000 Z-1.9233 F3000
+G1 X22.180 Y3.000 Z-1.9255 F3000
+G1 X22.200 Y3.000 Z-1.9277 F3000
+G1 X22.220 Y3.000 Z-1.9299 F3000
+G1 X22.240 Y3.000 Z-1.9321 F3000
+G1 X22.260 Y3.000 Z-1.9344 F3000
+G1 X22.280 Y3.000 Z-1.9367 F3000
+G1 X22.300 Y3.000 Z-1.9390 F3000
+G1 X22.320 Y3.000 Z-1.9413 F3000
+G1 X22.340 Y3.000 Z-1.9437 F3000
+G1 X22.360 Y3.000 Z-1.9460 F3000
+G1 X22.380 Y3.000 Z-1.9484 F3000
+G1 X22.400 Y3.000 Z-1.9508 F3000
+G1 X22.420 Y3.000 Z-1.9532 F3000
+G1 X22.440 Y3.000 Z-1.9557 F3000
+G1 X22.460 Y3.000 Z-1.9582 F3000
+G1 X22.480 Y3.000 Z-1.9607 F3000
+G1 X22.500 Y3.000 Z-1.9632 F3000
+G1 X22.520 Y3.000 Z-1.9657 F3000
+G1 X22.540 Y3.000 Z-1.9682 F3000
+G1 X22.560 Y3.000 Z-1.9708 F3000
+G1 X22.580 Y3.000 Z-1.9734 F3000
+G1 X22.600 Y3.000 Z-1.9760 F3000
+G1 X22.620 Y3.000 Z-1.9787 F3000
+G1 X22.640 Y3.000 Z-1.9813 F3000
+G1 X22.660 Y3.000 Z-1.9840 F3000
+G1 X22.680 Y3.000 Z-1.9867 F3000
+G1 X22.700 Y3.000 Z-1.9894 F3000
+G1 X22.720 Y3.000 Z-1.9921 F3000
+G1 X22.740 Y3.000 Z-1.9949 F3000
+G1 X22.760 Y3.000 Z-1.9977 F3000
+G1 X22.780 Y3.000 Z-2.0005 F3000
+G1 X22.800 Y3.000 Z-2.0033 F3000
+G1 X22.820 Y3.000 Z-2.0061 F3000
+G1 X22.840 Y3.000 Z-2.0090 F3000
+G1 X22.860 Y3.000 Z-2.0119 F3000
+G1 X22.880 Y3.000 Z-2.0148 F3000
+G1 X22.900 Y3.000 Z-2.0177 F3000
+G1 X22.920 Y3.000 Z-2.0206 F3000
+G1 X22.940 Y3.000 Z-2.0236 F3000
+G1 X22.960 Y3.000 Z-2.0266 F3000
+G1 X22.980 Y3.000 Z-2.0296 F3000
+G1 X23.000 Y3.000 Z-2.0326 F3000
+G1 X23.020 Y3.000 Z-2.0356 F3000
+G1 X23.040 Y3.000 Z-2.0387 F3000
+G1 X23.060 Y3.000 Z-2.0418 F3000
+G1 X23.080 Y3.000 Z-2.0449 F3000
+G1 X23.100 Y3.000 Z-2.0480 F3000
+G1 X23.120 Y3.000 Z-2.0512 F3000
+G1 X23.140 Y3.000 Z-2.0544 F3000
+G1 X23.160 Y3.000 Z-2.0575 F3000
+G1 X23.180 Y3.000 Z-2.0608 F3000
+G1 X23.200 Y3.000 Z-2.0640 F3000
+G1 X23.220 Y3.000 Z-2.0672 F3000
+G1 X23.240 Y3.000 Z-2.0705 F3000
+G1 X23.260 Y3.000 Z-2.0738 F3000
+G1 X23.280 Y3.000 Z-2.0771 F3000
+G1 X23.300 Y3.000 Z-2.0805 F3000
+G1 X23.320 Y3.000 Z-2.0838 F3000
+G1 X23.340 Y3.000 Z-2.0872 F3000
+G1 X23.360 Y3.000 Z-2.0906 F3000
+G1 X23.380 Y3.000 Z-2.0940 F3000
+G1 X23.400 Y3.000 Z-2.0975 F3000
+G1 X23.420 Y3.000 Z-2.1009 F3000
+G1 X23.440 Y3.000 Z-2.1044 F3000
+G1 X23.460 Y3.000 Z-2.1079 F3000
+G1 X23.480 Y3.000 Z-2.1114 F3000
+G1 X23.500 Y3.000 Z-2.1150 F3000
+G1 X23.520 Y3.000 Z-2.1185 F3000
+G1 X23.540 Y3.000 Z-2.1221 F3000
+G1 X23.560 Y3.000 Z-2.1257 F3000
+G1 X23.580 Y3.000 Z-2.1294 F3000
+G1 X23.600 Y3.000 Z-2.1330 F3000
+G1 X23.620 Y3.000 Z-2.1367 F3000
+G1 X23.640 Y3.000 Z-2.1404 F3000
+G1 X23.660 Y3.000 Z-2.1441 F3000
+G1 X23.680 Y3.000 Z-2.1478 F3000
+G1 X23.700 Y3.000 Z-2.1516 F3000
+G1 X23.720 Y3.000 Z-2.1554 F3000
+G1 X23.740 Y3.000 Z-2.1592 F3000
+G1 X23.760 Y3.000 Z-2.1630 F3000
+G1 X23.780 Y3.000 Z-2.1668 F3000
+G1 X23.800 Y3.000 Z-2.1707 F3000
+G1 X23.820 Y3.000 Z-2.1746 F3000
+G1 X23.840 Y3.000 Z-2.1785 F3000
+G1 X23.860 Y3.000 Z-2.1824 F3000
+G1 X23.880 Y3.000 Z-2.1863 F3000
+G1 X23.900 Y3.000 Z-2.1903 F3000
+G1 X23.920 Y3.000 Z-2.1943 F3000
+G1 X23.940 Y3.000 Z-2.1983 F3000
+G1 X23.960 Y3.000 Z-2.2023 F3000
+G1 X23.980 Y3.000 Z-2.2064 F3000
+G1 X24.000 Y3.000 Z-2.2105 F3000
+G1 X24.020 Y3.000 Z-2.2146 F3000
+G1 X24.040 Y3.000 Z-2.2187 F3000
+G1 X24.060 Y3.000 Z-2.2228 F3000
+G1 X24.080 Y3.000 Z-2.2270 F3000
+G1 X24.100 Y3.000 Z-2.2311 F3000
+G1 X24.120 Y3.000 Z-2.2353 F3000
+G1 X24.140 Y3.000 Z-2.2396 F3000
+G1 X24.160 Y3.000 Z-2.2438 F3000
+G1 X24.180 Y3.000 Z-2.2481 F3000
+G1 X24.200 Y3.000 Z-2.2524 F3000
+G1 X24.220 Y3.000 Z-2.2567 F3000
+G1 X24.240 Y3.000 Z-2.2610 F3000
+G1 X24.260 Y3.000 Z-2.2654 F3000
+G1 X24.280 Y3.000 Z-2.2697 F3000
+G1 X24.300 Y3.000 Z-2.2741 F3000
+G1 X24.320 Y3.000 Z-2.2785 F3000
+G1 X24.340 Y3.000 Z-2.2830 F3000
+G1 X24.360 Y3.000 Z-2.2874 F3000
+G1 X24.380 Y3.000 Z-2.2919 F3000
+G1 X24.400 Y3.000 Z-2.2964 F3000
+G1 X24.420 Y3.000 Z-2.3009 F3000
+G1 X24.440 Y3.000 Z-2.3055 F3000
+G1 X24.460 Y3.000 Z-2.3100 F3000
+G1 X24.480 Y3.000 Z-2.3146 F3000
+G1 X24.500 Y3.000 Z-2.3192 F3000
+G1 X24.520 Y3.000 Z-2.3239 F3000
+G1 X24.540 Y3.000 Z-2.3285 F3000
+G1 X24.560 Y3.000 Z-2.3332 F3000
+G1 X24.580 Y3.000 Z-2.3379 F3000
+G1 X24.600 Y3.000 Z-2.3426 F3000
+G1 X24.620 Y3.000 Z-2.3473 F3000
+G1 X24.640 Y3.000 Z-2.3521 F3000
+G1 X24.660 Y3.000 Z-2.3569 F3000
+G1 X24.680 Y3.000 Z-2.3617 F3000
+G1 X24.700 Y3.000 Z-2.3665 F3000
+G1 X24.720 Y3.000 Z-2.3714 F3000
+G1 X24.740 Y3.000 Z-2.3762 F3000
+G1 X24.760 Y3.000 Z-2.3811 F3000
+G1 X24.780 Y3.000 Z-2.3860 F3000
+G1 X24.800 Y3.000 Z-2.3910 F3000
+G1 X24.820 Y3.000 Z-2.3959 F3000
+G1 X24.840 Y3.000 Z-2.4009 F3000
+G1 X24.860 Y3.000 Z-2.4059 F3000
+G1 X24.880 Y3.000 Z-2.4109 F3000
+G1 X24.900 Y3.000 Z-2.4160 F3000
+G1 X24.920 Y3.000 Z-2.4211 F3000
+G1 X24.940 Y3.000 Z-2.4261 F3000
+G1 X24.960 Y3.000 Z-2.4313 F3000
+G1 X24.980 Y3.000 Z-2.4364 F3000
+G1 X25.000 Y3.000 Z-2.4415 F3000
+G1 X25.020 Y3.000 Z-2.4467 F3000
+G1 X25.040 Y3.000 Z-2.4519 F3000
+G1 X25.060 Y3.000 Z-2.4571 F3000
+G1 X25.080 Y3.000 Z-2.4624 F3000
+G1 X25.100 Y3.000 Z-2.4676 F3000
+G1 X25.120 Y3.000 Z-2.4729 F3000
+G1 X25.140 Y3.000 Z-2.4782 F3000
+G1 X25.160 Y3.000 Z-2.4836 F3000
+G1 X25.180 Y3.000 Z-2.4889 F3000
+G1 X25.200 Y3.000 Z-2.4943 F3000
+G1 X25.220 Y3.000 Z-2.4997 F3000
+G1 X25.240 Y3.000 Z-2.5051 F3000
+G1 X25.260 Y3.000 Z-2.5106 F3000
+G1 X25.280 Y3.000 Z-2.5160 F3000
+G1 X25.300 Y3.000 Z-2.5215 F3000
+G1 X25.320 Y3.000 Z-2.5270 F3000
+G1 X25.340 Y3.000 Z-2.5326 F3000
+G1 X25.360 Y3.000 Z-2.5381 F3000
+G1 X25.380 Y3.000 Z-2.5437 F3000
+G1 X25.400 Y3.000 Z-2.5493 F3000
+G1 X25.420 Y3.000 Z-2.5549 F3000
+G1 X25.440 Y3.000 Z-2.5606 F3000
+G1 X25.460 Y3.000 Z-2.5662 F3000
+G1 X25.480 Y3.000 Z-2.5719 F3000
+G1 X25.500 Y3.000 Z-2.5776 F3000
+G1 X25.520 Y3.000 Z-2.5834 F3000
+G1 X25.540 Y3.000 Z-2.5891 F3000
+G1 X25.560 Y3.000 Z-2.5949 F3000
+G1 X25.580 Y3.000 Z-2.6007 F3000
+G1 X25.600 Y3.000 Z-2.6065 F3000
+G1 X25.620 Y3.000 Z-2.6124 F3000
+G1 X25.640 Y3.000 Z-2.6182 F3000
+G1 X25.660 Y3.000 Z-2.6241 F3000
+G1 X25.680 Y3.000 Z-2.6300 F3000
+G1 X25.700 Y3.000 Z-2.6360 F3000
+G1 X25.720 Y3.000 Z-2.6419 F3000
+G1 X25.740 Y3.000 Z-2.6479 F3000
+G1 X25.760 Y3.000 Z-2.6539 F3000
+G1 X25.780 Y3.000 Z-2.6599 F3000
+G1 X25.800 Y3.000 Z-2.6660 F3000
+G1 X25.820 Y3.000 Z-2.6721 F3000
+G1 X25.840 Y3.000 Z-2.6782 F3000
+G1 X25.860 Y3.000 Z-2.6843 F3000
+G1 X25.880 Y3.000 Z-2.6904 F3000
+G1 X25.900 Y3.000 Z-2.6966 F3000
+G1 X25.920 Y3.000 Z-2.7028 F3000
+G1 X25.940 Y3.000 Z-2.7090 F3000
+G1 X25.960 Y3.000 Z-2.7152 F3000
+G1 X25.980 Y3.000 Z-2.7215 F3000
+G1 X26.000 Y3.000 Z-2.7278 F3000
+G1 X26.020 Y3.000 Z-2.7341 F3000
+G1 X26.040 Y3.000 Z-2.7404 F3000
+G1 X26.060 Y3.000 Z-2.7467 F3000
+G1 X26.080 Y3.000 Z-2.7531 F3000
+G1 X26.100 Y3.000 Z-2.7595 F3000
+G1 X26.120 Y3.000 Z-2.7659 F3000
+G1 X26.140 Y3.000 Z-2.7724 F3000
+G1 X26.160 Y3.000 Z-2.7788 F3000
+G1 X26.180 Y3.000 Z-2.7853 F3000
+G1 X26.200 Y3.000 Z-2.7918 F3000
+G1 X26.220 Y3.000 Z-2.7984 F3000
+G1 X26.240 Y3.000 Z-2.8049 F3000
+G1 X26.260 Y3.000 Z-2.8115 F3000
+G1 X26.280 Y3.000 Z-2.8181 F3000
+G1 X26.300 Y3.000 Z-2.8248 F3000
+G1 X26.320 Y3.000 Z-2.8314 F3000
+G1 X26.340 Y3.000 Z-2.8381 F3000
+G1 X26.360 Y3.000 Z-2.8448 F3000
+G1 X26.380 Y3.000 Z-2.8515 F3000
+G1 X26.400 Y3.000 Z-2.8582 F3000
+G1 X26.420 Y3.000 Z-2.8650 F3000
+G1 X26.440 Y3.000 Z-2.8718 F3000
+G1 X26.460 Y3.000 Z-2.8786 F3000
+G1 X26.480 Y3.000 Z-2.8855 F3000
+G1 X26.500 Y3.000 Z-2.8923 F3000
+G1 X26.520 Y3.000 Z-2.8992 F3000
+G1 X26.540 Y3.000 Z-2.9061 F3000
+G1 X26.560 Y3.000 Z-2.9131 F3000
+G1 X26.580 Y3.000 Z-2.9200 F3000
+G1 X26.600 Y3.000 Z-2.9270 F3000
+G1 X26.620 Y3.000 Z-2.9340 F3000
+G1 X26.640 Y3.000 Z-2.9410 F3000
+G1 X26.660 Y3.000 Z-2.9481 F3000
+G1 X26.680 Y3.000 Z-2.9552 F3000
+G1 X26.700 Y3.000 Z-2.9623 F3000
+G1 X26.720 Y3.000 Z-2.9694 F3000
+G1 X26.740 Y3.000 Z-2.9765 F3000
+G1 X26.760 Y3.000 Z-2.9837 F3000
+G1 X26.780 Y3.000 Z-2.9909 F3000
+G1 X26.800 Y3.000 Z-2.9981 F3000
+G1 X26.820 Y3.000 Z-3.0054 F3000
+G1 X26.840 Y3.000 Z-3.0127 F3000
+G1 X26.860 Y3.000 Z-3.0199 F3000
+G1 X26.880 Y3.000 Z-3.0273 F3000
+G1 X26.900 Y3.000 Z-3.0346 F3000
+G1 X26.920 Y3.000 Z-3.0420 F3000
+G1 X26.940 Y3.000 Z-3.0494 F3000
+G1 X26.960 Y3.000 Z-3.0568 F3000
+G1 X26.980 Y3.000 Z-3.0642 F3000
+G1 X27.000 Y3.000 Z-3.0717 F3000
+G1 X27.020 Y3.000 Z-3.0792 F3000
+G1 X27.040 Y3.000 Z-3.0867 F3000
+G1 X27.060 Y3.000 Z-3.0942 F3000
+G1 X27.080 Y3.000 Z-3.1018 F3000
+G1 X27.100 Y3.000 Z-3.1094 F3000
+G1 X27.120 Y3.000 Z-3.1170 F3000
+G1 X27.140 Y3.000 Z-3.1246 F3000
+G1 X27.160 Y3.000 Z-3.1323 F3000
+G1 X27.180 Y3.000 Z-3.1399 F3000
+G1 X27.200 Y3.000 Z-3.1477 F3000
+G1 X27.220 Y3.000 Z-3.1554 F3000
+G1 X27.240 Y3.000 Z-3.1631 F3000
+G1 X27.260 Y3.000 Z-3.1709 F3000
+G1 X27.280 Y3.000 Z-3.1787 F3000
+G1 X27.300 Y3.000 Z-3.1866 F3000
+G1 X27.320 Y3.000 Z-3.1944 F3000
+G1 X27.340 Y3.000 Z-3.2023 F3000
+G1 X27.360 Y3.000 Z-3.2102 F3000
+G1 X27.380 Y3.000 Z-3.2181 F3000
+G1 X27.400 Y3.000 Z-3.2261 F3000
+G1 X27.420 Y3.000 Z-3.2341 F3000
+G1 X27.440 Y3.000 Z-3.2421 F3000
+G1 X27.460 Y3.000 Z-3.2501 F3000
+G1 X27.480 Y3.000 Z-3.2582 F3000
+G1 X27.500 Y3.000 Z-3.2662 F3000
+G1 X27.520 Y3.000 Z-3.2744 F3000
+G1 X27.540 Y3.000 Z-3.2825 F3000
+G1 X27.560 Y3.000 Z-3.2906 F3000
+G1 X27.580 Y3.000 Z-3.2988 F3000
+G1 X27.600 Y3.000 Z-3.3070 F3000
+G1 X27.620 Y3.000 Z-3.3153 F3000
+G1 X27.640 Y3.000 Z-3.3235 F3000
+G1 X27.660 Y3.000 Z-3.3318 F3000
+G1 X27.680 Y3.000 Z-3.3401 F3000
+G1 X27.700 Y3.000 Z-3.3484 F3000
+G1 X27.720 Y3.000 Z-3.3568 F3000
+G1 X27.740 Y3.000 Z-3.3652 F3000
+G1 X27.760 Y3.000 Z-3.3736 F3000
+G1 X27.780 Y3.000 Z-3.3820 F3000
+G1 X27.800 Y3.000 Z-3.3905 F3000
+G1 X27.820 Y3.000 Z-3.3990 F3000
+G1 X27.840 Y3.000 Z-3.4075 F3000
+G1 X27.860 Y3.000 Z-3.4160 F3000
+G1 X27.880 Y3.000 Z-3.4246 F3000
+G1 X27.900 Y3.000 Z-3.4332 F3000
+G1 X27.920 Y3.000 Z-3.4418 F3000
+G1 X27.940 Y3.000 Z-3.4504 F3000
+G1 X27.960 Y3.000 Z-3.4591 F3000
+G1 X27.980 Y3.000 Z-3.4678 F3000
+G1 X28.000 Y3.000 Z-3.4765 F3000
+G1 X28.020 Y3.000 Z-3.4853 F3000
+G1 X28.040 Y3.000 Z-3.4940 F3000
+G1 X28.060 Y3.000 Z-3.5028 F3000
+G1 X28.080 Y3.000 Z-3.5117 F3000
+G1 X28.100 Y3.000 Z-3.5205 F3000
+G1 X28.120 Y3.000 Z-3.5294 F3000
+G1 X28.140 Y3.000 Z-3.5383 F3000
+G1 X28.160 Y3.000 Z-3.5472 F3000
+G1 X28.180 Y3.000 Z-3.5562 F3000
+G1 X28.200 Y3.000 Z-3.5651 F3000
+G1 X28.220 Y3.000 Z-3.5742 F3000
+G1 X28.240 Y3.000 Z-3.5832 F3000
+G1 X28.260 Y3.000 Z-3.5922 F3000
+G1 X28.280 Y3.000 Z-3.6013 F3000
+G1 X28.300 Y3.000 Z-3.6104 F3000
+G1 X28.320 Y3.000 Z-3.6196 F3000
+G1 X28.340 Y3.000 Z-3.6287 F3000
+G1 X28.360 Y3.000 Z-3.6379 F3000
+G1 X28.380 Y3.000 Z-3.6472 F3000
+G1 X28.400 Y3.000 Z-3.6564 F3000
+G1 X28.420 Y3.000 Z-3.6657 F3000
+G1 X28.440 Y3.000 Z-3.6750 F3000
+G1 X28.460 Y3.000 Z-3.6843 F3000
+G1 X28.480 Y3.000 Z-3.6937 F3000
+G1 X28.500 Y3.000 Z-3.7030 F3000
+G1 X28.520 Y3.000 Z-3.7124 F3000
+G1 X28.540 Y3.000 Z-3.7219 F3000
+G1 X28.560 Y3.000 Z-3.7313 F3000
+G1 X28.580 Y3.000 Z-3.7408 F3000
+G1 X28.600 Y3.000 Z-3.7503 F3000
+G1 X28.620 Y3.000 Z-3.7599 F3000
+G1 X28.640 Y3.000 Z-3.7695 F3000
+G1 X28.660 Y3.000 Z-3.7791 F3000
+G1 X28.680 Y3.000 Z-3.7887 F3000
+G1 X28.700 Y3.000 Z-3.7983 F3000
+G1 X28.720 Y3.000 Z-3.8080 F3000
+G1 X28.740 Y3.000 Z-3.8177 F3000
+G1 X28.760 Y3.000 Z-3.8275 F3000
+G1 X28.780 Y3.000 Z-3.8372 F3000
+G1 X28.800 Y3.000 Z-3.8470 F3000
+G1 X28.820 Y3.000 Z-3.8568 F3000
+G1 X28.840 Y3.000 Z-3.8667 F3000
+G1 X28.860 Y3.000 Z-3.8765 F3000
+G1 X28.880 Y3.000 Z-3.8864 F3000
+G1 X28.900 Y3.000 Z-3.8964 F3000
+G1 X28.920 Y3.000 Z-3.9063 F3000
+G1 X28.940 Y3.000 Z-3.9163 F3000
+G1 X28.960 Y3.000 Z-3.9263 F3000
+G1 X28.980 Y3.000 Z-3.9364 F3000
+G1 X29.000 Y3.000 Z-3.9464 F3000
+G1 X29.020 Y3.000 Z-3.9565 F3000
+G1 X29.040 Y3.000 Z-3.9666 F3000
+G1 X29.060 Y3.000 Z-3.9768 F3000
+G1 X29.080 Y3.000 Z-3.9870 F3000
+G1 X29.100 Y3.000 Z-3.9972 F3000
+G1 X29.120 Y3.000 Z-4.0074 F3000
+G1 X29.140 Y3.000 Z-4.0177 F3000
+G1 X29.160 Y3.000 Z-4.0280 F3000
+G1 X29.180 Y3.000 Z-4.0383 F3000
+G1 X29.200 Y3.000 Z-4.0487 F3000
+G1 X29.220 Y3.000 Z-4.0590 F3000
+G1 X29.240 Y3.000 Z-4.0695 F3000
+G1 X29.260 Y3.000 Z-4.0799 F3000
+G1 X29.280 Y3.000 Z-4.0904 F3000
+G1 X29.300 Y3.000 Z-4.1008 F3000
+G1 X29.320 Y3.000 Z-4.1114 F3000
+G1 X29.340 Y3.000 Z-4.1219 F3000
+G1 X29.360 Y3.000 Z-4.1325 F3000
+G1 X29.380 Y3.000 Z-4.1431 F3000
+G1 X29.400 Y3.000 Z-4.1538 F3000
+G1 X29.420 Y3.000 Z-4.1644 F3000
+G1 X29.440 Y3.000 Z-4.1751 F3000
+G1 X29.460 Y3.000 Z-4.1858 F3000
+G1 X29.480 Y3.000 Z-4.1966 F3000
+G1 X29.500 Y3.000 Z-4.2074 F3000
+G1 X29.520 Y3.000 Z-4.2182 F3000
+G1 X29.540 Y3.000 Z-4.2290 F3000
+G1 X29.560 Y3.000 Z-4.2399 F3000
+G1 X29.580 Y3.000 Z-4.2508 F3000
+G1 X29.600 Y3.000 Z-4.2618 F3000
+G1 X29.620 Y3.000 Z-4.2727 F3000
+G1 X29.640 Y3.000 Z-4.2837 F3000
+G1 X29.660 Y3.000 Z-4.2947 F3000
+G1 X29.680 Y3.000 Z-4.3058 F3000
+G1 X29.700 Y3.000 Z-4.3169 F3000
+G1 X29.720 Y3.000 Z-4.3280 F3000
+G1 X29.740 Y3.000 Z-4.3391 F3000
+G1 X29.760 Y3.000 Z-4.3503 F3000
+G1 X29.780 Y3.000 Z-4.3615 F3000
+G1 X29.800 Y3.000 Z-4.3727 F3000
+G1 X29.820 Y3.000 Z-4.3840 F3000
+G1 X29.840 Y3.000 Z-4.3953 F3000
+G1 X29.860 Y3.000 Z-4.4066 F3000
+G1 X29.880 Y3.000 Z-4.4180 F3000
+G1 X29.900 Y3.000 Z-4.4293 F3000
+G1 X29.920 Y3.000 Z-4.4407 F3000
+G1 X29.940 Y3.000 Z-4.4522 F3000
+G1 X29.960 Y3.000 Z-4.4637 F3000
+G1 X29.980 Y3.000 Z-4.4752 F3000
+G1 X30.000 Y3.000 Z-4.4867 F3000
+G1 X30.020 Y3.000 Z-4.4983 F3000
+G1 X30.040 Y3.000 Z-4.5099 F3000
+G1 X30.060 Y3.000 Z-4.5215 F3000
+G1 X30.080 Y3.000 Z-4.5332 F3000
+G1 X30.100 Y3.000 Z-4.5449 F3000
+G1 X30.120 Y3.000 Z-4.5566 F3000
+G1 X30.140 Y3.000 Z-4.5683 F3000
+G1 X30.160 Y3.000 Z-4.5801 F3000
+G1 X30.180 Y3.000 Z-4.5919 F3000
+G1 X30.200 Y3.000 Z-4.6038 F3000
+G1 X30.220 Y3.000 Z-4.6157 F3000
+G1 X30.240 Y3.000 Z-4.6276 F3000
+G1 X30.260 Y3.000 Z-4.6395 F3000
+G1 X30.280 Y3.000 Z-4.6515 F3000
+G1 X30.300 Y3.000 Z-4.6635 F3000
+G1 X30.320 Y3.000 Z-4.6755 F3000
+G1 X30.340 Y3.000 Z-4.6876 F3000
+G1 X30.360 Y3.000 Z-4.6997 F3000
+G1 X30.380 Y3.000 Z-4.7118 F3000
+G1 X30.400 Y3.000 Z-4.7240 F3000
+G1 X30.420 Y3.000 Z-4.7362 F3000
+G1 X30.440 Y3.000 Z-4.7484 F3000
+G1 X30.460 Y3.000 Z-4.7607 F3000
+G1 X30.480 Y3.000 Z-4.7730 F3000
+G1 X30.500 Y3.000 Z-4.7853 F3000
+G1 X30.520 Y3.000 Z-4.7977 F3000
+G1 X30.540 Y3.000 Z-4.8101 F3000
+G1 X30.560 Y3.000 Z-4.8225 F3000
+G1 X30.580 Y3.000 Z-4.8349 F3000
+G1 X30.600 Y3.000 Z-4.8474 F3000
+G1 X30.620 Y3.000 Z-4.8599 F3000
+G1 X30.640 Y3.000 Z-4.8725 F3000
+G1 X30.660 Y3.000 Z-4.8851 F3000
+G1 X30.680 Y3.000 Z-4.8977 F3000
+G1 X30.700 Y3.000 Z-4.9104 F3000
+G1 X30.720 Y3.000 Z-4.9230 F3000
+G1 X30.740 Y3.000 Z-4.9358 F3000
+G1 X30.760 Y3.000 Z-4.9485 F3000
+G1 X30.780 Y3.000 Z-4.9613 F3000
+G1 X30.800 Y3.000 Z-4.9741 F3000
+G1 X30.820 Y3.000 Z-4.9870 F3000
+G1 X30.840 Y3.000 Z-4.9999 F3000
+G1 X30.860 Y3.000 Z-5.0128 F3000
+G1 X30.880 Y3.000 Z-5.0257 F3000
+G1 X30.900 Y3.000 Z-5.0387 F3000
+G1 X30.920 Y3.000 Z-5.0518 F3000
+G1 X30.940 Y3.000 Z-5.0648 F3000
+G1 X30.960 Y3.000 Z-5.0779 F3000
+G1 X30.980 Y3.000 Z-5.0910 F3000
+G1 X31.000 Y3.000 Z-5.1042 F3000
+G1 X31.020 Y3.000 Z-5.1174 F3000
+G1 X31.040 Y3.000 Z-5.1306 F3000
+G1 X31.060 Y3.000 Z-5.1439 F3000
+G1 X31.080 Y3.000 Z-5.1572 F3000
+G1 X31.100 Y3.000 Z-5.1705 F3000
+G1 X31.120 Y3.000 Z-5.1839 F3000
+G1 X31.140 Y3.000 Z-5.1973 F3000
+G1 X31.160 Y3.000 Z-5.2107 F3000
+G1 X31.180 Y3.000 Z-5.2242 F3000
+G1 X31.200 Y3.000 Z-5.2377 F3000
+G1 X31.220 Y3.000 Z-5.2512 F3000
+G1 X31.240 Y3.000 Z-5.2648 F3000
+G1 X31.260 Y3.000 Z-5.2784 F3000
+G1 X31.280 Y3.000 Z-5.2921 F3000
+G1 X31.300 Y3.000 Z-5.3058 F3000
+G1 X31.320 Y3.000 Z-5.3195 F3000
+G1 X31.340 Y3.000 Z-5.3332 F3000
+G1 X31.360 Y3.000 Z-5.3470 F3000
+G1 X31.380 Y3.000 Z-5.3609 F3000
+G1 X31.400 Y3.000 Z-5.3747 F3000
+G1 X31.420 Y3.000 Z-5.3886 F3000
+G1 X31.440 Y3.000 Z-5.4025 F3000
+G1 X31.460 Y3.000 Z-5.4165 F3000
+G1 X31.480 Y3.000 Z-5.4305 F3000
+G1 X31.500 Y3.000 Z-5.4446 F3000
+G1 X31.520 Y3.000 Z-5.4587 F3000
+G1 X31.540 Y3.000 Z-5.4728 F3000
+G1 X31.560 Y3.000 Z-5.4869 F3000
+G1 X31.580 Y3.000 Z-5.5011 F3000
+G1 X31.600 Y3.000 Z-5.5153 F3000
+G1 X31.620 Y3.000 Z-5.5296 F3000
+G1 X31.640 Y3.000 Z-5.5439 F3000
+G1 X31.660 Y3.000 Z-5.5583 F3000
+G1 X31.680 Y3.000 Z-5.5726 F3000
+G1 X31.700 Y3.000 Z-5.5870 F3000
+G1 X31.720 Y3.000 Z-5.6015 F3000
+G1 X31.740 Y3.000 Z-5.6160 F3000
+G1 X31.760 Y3.000 Z-5.6305 F3000
+G1 X31.780 Y3.000 Z-5.6451 F3000
+G1 X31.800 Y3.000 Z-5.6597 F3000
+G1 X31.820 Y3.000 Z-5.6743 F3000
+G1 X31.840 Y3.000 Z-5.6890 F3000
+G1 X31.860 Y3.000 Z-5.7037 F3000
+G1 X31.880 Y3.000 Z-5.7185 F3000
+G1 X31.900 Y3.000 Z-5.7333 F3000
+G1 X31.920 Y3.000 Z-5.7481 F3000
+G1 X31.940 Y3.000 Z-5.7630 F3000
+G1 X31.960 Y3.000 Z-5.7779 F3000
+G1 X31.980 Y3.000 Z-5.7928 F3000
+G1 X32.000 Y3.000 Z-5.8078 F3000
+G1 X32.020 Y3.000 Z-5.8228 F3000
+G1 X32.040 Y3.000 Z-5.8379 F3000
+G1 X32.060 Y3.000 Z-5.8530 F3000
+G1 X32.080 Y3.000 Z-5.8682 F3000
+G1 X32.100 Y3.000 Z-5.8833 F3000
+G1 X32.120 Y3.000 Z-5.8986 F3000
+G1 X32.140 Y3.000 Z-5.9138 F3000
+G1 X32.160 Y3.000 Z-5.9291 F3000
+G1 X32.180 Y3.000 Z-5.9445 F3000
+G1 X32.200 Y3.000 Z-5.9599 F3000
+G1 X32.220 Y3.000 Z-5.9753 F3000
+G1 X32.240 Y3.000 Z-5.9907 F3000
+G1 X32.260 Y3.000 Z-6.0063 F3000
+G1 X32.280 Y3.000 Z-6.0218 F3000
+G1 X32.300 Y3.000 Z-6.0374 F3000
+G1 X32.320 Y3.000 Z-6.0530 F3000
+G1 X32.340 Y3.000 Z-6.0687 F3000
+G1 X32.360 Y3.000 Z-6.0844 F3000
+G1 X32.380 Y3.000 Z-6.1001 F3000
+G1 X32.400 Y3.000 Z-6.1159 F3000
+G1 X32.420 Y3.000 Z-6.1318 F3000
+G1 X32.440 Y3.000 Z-6.1476 F3000
+G1 X32.460 Y3.000 Z-6.1636 F3000
+G1 X32.480 Y3.000 Z-6.1795 F3000
+G1 X32.500 Y3.000 Z-6.1955 F3000
+G1 X32.520 Y3.000 Z-6.2116 F3000
+G1 X32.540 Y3.000 Z-6.2276 F3000
+G1 X32.560 Y3.000 Z-6.2438 F3000
+G1 X32.580 Y3.000 Z-6.2599 F3000
+G1 X32.600 Y3.000 Z-6.2761 F3000
+G1 X32.620 Y3.000 Z-6.2924 F3000
+G1 X32.640 Y3.000 Z-6.3087 F3000
+G1 X32.660 Y3.000 Z-6.3250 F3000
+G1 X32.680 Y3.000 Z-6.3414 F3000
+G1 X32.700 Y3.000 Z-6.3578 F3000
+G1 X32.720 Y3.000 Z-6.3743 F3000
+G1 X32.740 Y3.000 Z-6.3908 F3000
+G1 X32.760 Y3.000 Z-6.4074 F3000
+G1 X32.780 Y3.000 Z-6.4240 F3000
+G1 X32.800 Y3.000 Z-6.4406 F3000
+G1 X32.820 Y3.000 Z-6.4573 F3000
+G1 X32.840 Y3.000 Z-6.4741 F3000
+G1 X32.860 Y3.000 Z-6.4908 F3000
+G1 X32.880 Y3.000 Z-6.5077 F3000
+G1 X32.900 Y3.000 Z-6.5245 F3000
+G1 X32.920 Y3.000 Z-6.5414 F3000
+G1 X32.940 Y3.000 Z-6.5584 F3000
+G1 X32.960 Y3.000 Z-6.5754 F3000
+G1 X32.980 Y3.000 Z-6.5924 F3000
+G1 X33.000 Y3.000 Z-6.6095 F3000
+G1 X33.020 Y3.000 Z-6.6267 F3000
+G1 X33.040 Y3.000 Z-6.6439 F3000
+G1 X33.060 Y3.000 Z-6.6611 F3000
+G1 X33.080 Y3.000 Z-6.6784 F3000
+G1 X33.100 Y3.000 Z-6.6957 F3000
+G1 X33.120 Y3.000 Z-6.7131 F3000
+G1 X33.140 Y3.000 Z-6.7305 F3000
+G1 X33.160 Y3.000 Z-6.7479 F3000
+G1 X33.180 Y3.000 Z-6.7655 F3000
+G1 X33.200 Y3.000 Z-6.7830 F3000
+G1 X33.220 Y3.000 Z-6.8006 F3000
+G1 X33.240 Y3.000 Z-6.8183 F3000
+G1 X33.260 Y3.000 Z-6.8360 F3000
+G1 X33.280 Y3.000 Z-6.8537 F3000
+G1 X33.300 Y3.000 Z-6.8715 F3000
+G1 X33.320 Y3.000 Z-6.8893 F3000
+G1 X33.340 Y3.000 Z-6.9072 F3000
+G1 X33.360 Y3.000 Z-6.9252 F3000
+G1 X33.380 Y3.000 Z-6.9432 F3000
+G1 X33.400 Y3.000 Z-6.9612 F3000
+G1 X33.420 Y3.000 Z-6.9793 F3000
+G1 X33.440 Y3.000 Z-6.9974 F3000
+G1 X33.460 Y3.000 Z-7.0156 F3000
+G1 X33.480 Y3.000 Z-7.0338 F3000
+G1 X33.500 Y3.000 Z-7.0521 F3000
+G1 X33.520 Y3.000 Z-7.0705 F3000
+G1 X33.540 Y3.000 Z-7.0888 F3000
+G1 X33.560 Y3.000 Z-7.1073 F3000
+G1 X33.580 Y3.000 Z-7.1258 F3000
+G1 X33.600 Y3.000 Z-7.1443 F3000
+G1 X33.620 Y3.000 Z-7.1629 F3000
+G1 X33.640 Y3.000 Z-7.1815 F3000
+G1 X33.660 Y3.000 Z-7.2002 F3000
+G1 X33.680 Y3.000 Z-7.2189 F3000
+G1 X33.700 Y3.000 Z-7.2377 F3000
+G1 X33.720 Y3.000 Z-7.2566 F3000
+G1 X33.740 Y3.000 Z-7.2755 F3000
+G1 X33.760 Y3.000 Z-7.2944 F3000
+G1 X33.780 Y3.000 Z-7.3134 F3000
+G1 X33.800 Y3.000 Z-7.3325 F3000
+G1 X33.820 Y3.000 Z-7.3516 F3000
+G1 X33.840 Y3.000 Z-7.3707 F3000
+G1 X33.860 Y3.000 Z-7.3899 F3000
+G1 X33.880 Y3.000 Z-7.4092 F3000
+G1 X33.900 Y3.000 Z-7.4285 F3000
+G1 X33.920 Y3.000 Z-7.4479 F3000
+G1 X33.940 Y3.000 Z-7.4673 F3000
+G1 X33.960 Y3.000 Z-7.4868 F3000
+G1 X33.980 Y3.000 Z-7.5063 F3000
+G1 X34.000 Y3.000 Z-7.5259 F3000
+G1 X34.020 Y3.000 Z-7.5455 F3000
+G1 X34.040 Y3.000 Z-7.5652 F3000
+G1 X34.060 Y3.000 Z-7.5850 F3000
+G1 X34.080 Y3.000 Z-7.6048 F3000
+G1 X34.100 Y3.000 Z-7.6247 F3000
+G1 X34.120 Y3.000 Z-7.6446 F3000
+G1 X34.140 Y3.000 Z-7.6646 F3000
+G1 X34.160 Y3.000 Z-7.6846 F3000
+G1 X34.180 Y3.000 Z-7.7047 F3000
+G1 X34.200 Y3.000 Z-7.7248 F3000
+G1 X34.220 Y3.000 Z-7.7451 F3000
+G1 X34.240 Y3.000 Z-7.7653 F3000
+G1 X34.260 Y3.000 Z-7.7856 F3000
+G1 X34.280 Y3.000 Z-7.8060 F3000
+G1 X34.300 Y3.000 Z-7.8265 F3000
+G1 X34.320 Y3.000 Z-7.8470 F3000
+G1 X34.340 Y3.000 Z-7.8675 F3000
+G1 X34.360 Y3.000 Z-7.8881 F3000
+G1 X34.380 Y3.000 Z-7.9088 F3000
+G1 X34.400 Y3.000 Z-7.9295 F3000
+G1 X34.420 Y3.000 Z-7.9503 F3000
+G1 X34.440 Y3.000 Z-7.9712 F3000
+G1 X34.460 Y3.000 Z-7.9921 F3000
+G1 X34.480 Y3.000 Z-8.0131 F3000
+G1 X34.500 Y3.000 Z-8.0341 F3000
+G1 X34.520 Y3.000 Z-8.0552 F3000
+G1 X34.540 Y3.000 Z-8.0764 F3000
+G1 X34.560 Y3.000 Z-8.0976 F3000
+G1 X34.580 Y3.000 Z-8.1189 F3000
+G1 X34.600 Y3.000 Z-8.1402 F3000
+G1 X34.620 Y3.000 Z-8.1616 F3000
+G1 X34.640 Y3.000 Z-8.1831 F3000
+G1 X34.660 Y3.000 Z-8.2046 F3000
+G1 X34.680 Y3.000 Z-8.2262 F3000
+G1 X34.700 Y3.000 Z-8.2479 F3000
+G1 X34.720 Y3.000 Z-8.2696 F3000
+G1 X34.740 Y3.000 Z-8.2914 F3000
+G1 X34.760 Y3.000 Z-8.3133 F3000
+G1 X34.780 Y3.000 Z-8.3352 F3000
+G1 X34.800 Y3.000 Z-8.3572 F3000
+G1 X34.820 Y3.000 Z-8.3792 F3000
+G1 X34.840 Y3.000 Z-8.4013 F3000
+G1 X34.860 Y3.000 Z-8.4235 F3000
+G1 X34.880 Y3.000 Z-8.4458 F3000
+G1 X34.900 Y3.000 Z-8.4681 F3000
+G1 X34.920 Y3.000 Z-8.4905 F3000
+G1 X34.940 Y3.000 Z-8.5129 F3000
+G1 X34.960 Y3.000 Z-8.5354 F3000
+G1 X34.980 Y3.000 Z-8.5580 F3000
+G1 X35.000 Y3.000 Z-8.5807 F3000
+G1 X35.020 Y3.000 Z-8.6034 F3000
+G1 X35.040 Y3.000 Z-8.6262 F3000
+G1 X35.060 Y3.000 Z-8.6491 F3000
+G1 X35.080 Y3.000 Z-8.6720 F3000
+G1 X35.100 Y3.000 Z-8.6950 F3000
+G1 X35.120 Y3.000 Z-8.7181 F3000
+G1 X35.140 Y3.000 Z-8.7413 F3000
+G1 X35.160 Y3.000 Z-8.7645 F3000
+G1 X35.180 Y3.000 Z-8.7878 F3000
+G1 X35.200 Y3.000 Z-8.8112 F3000
+G1 X35.220 Y3.000 Z-8.8346 F3000
+G1 X35.240 Y3.000 Z-8.8581 F3000
+G1 X35.260 Y3.000 Z-8.8817 F3000
+G1 X35.280 Y3.000 Z-8.9054 F3000
+G1 X35.300 Y3.000 Z-8.9291 F3000
+G1 X35.320 Y3.000 Z-8.9529 F3000
+G1 X35.340 Y3.000 Z-8.9768 F3000
+G1 X35.360 Y3.000 Z-9.0008 F3000
+G1 X35.380 Y3.000 Z-9.0248 F3000
+G1 X35.400 Y3.000 Z-9.0489 F3000
+G1 X35.420 Y3.000 Z-9.0731 F3000
+G1 X35.440 Y3.000 Z-9.0974 F3000
+G1 X35.460 Y3.000 Z-9.1217 F3000
+G1 X35.480 Y3.000 Z-9.1462 F3000
+G1 X35.500 Y3.000 Z-9.1707 F3000
+G1 X35.520 Y3.000 Z-9.1953 F3000
+G1 X35.540 Y3.000 Z-9.2199 F3000
+G1 X35.560 Y3.000 Z-9.2447 F3000
+G1 X35.580 Y3.000 Z-9.2695 F3000
+G1 X35.600 Y3.000 Z-9.2944 F3000
+G1 X35.620 Y3.000 Z-9.3194 F3000
+G1 X35.640 Y3.000 Z-9.3445 F3000
+G1 X35.660 Y3.000 Z-9.3696 F3000
+G1 X35.680 Y3.000 Z-9.3949 F3000
+G1 X35.700 Y3.000 Z-9.4202 F3000
+G1 X35.720 Y3.000 Z-9.4456 F3000
+G1 X35.740 Y3.000 Z-9.4711 F3000
+G1 X35.760 Y3.000 Z-9.4967 F3000
+G1 X35.780 Y3.000 Z-9.5223 F3000
+G1 X35.800 Y3.000 Z-9.5481 F3000
+G1 X35.820 Y3.000 Z-9.5739 F3000
+G1 X35.840 Y3.000 Z-9.5998 F3000
+G1 X35.860 Y3.000 Z-9.6258 F3000
+G1 X35.880 Y3.000 Z-9.6519 F3000
+G1 X35.900 Y3.000 Z-9.6781 F3000
+G1 X35.920 Y3.000 Z-9.7044 F3000
+G1 X35.940 Y3.000 Z-9.7308 F3000
+G1 X35.960 Y3.000 Z-9.7572 F3000
+G1 X35.980 Y3.000 Z-9.7838 F3000
+G1 X36.000 Y3.000 Z-9.8104 F3000
+G1 X36.020 Y3.000 Z-9.8372 F3000
+G1 X36.040 Y3.000 Z-9.8640 F3000
+G1 X36.060 Y3.000 Z-9.8909 F3000
+G1 X36.080 Y3.000 Z-9.9179 F3000
+G1 X36.100 Y3.000 Z-9.9450 F3000
+G1 X36.120 Y3.000 Z-9.9723 F3000
+G1 X36.140 Y3.000 Z-9.9996 F3000
+G1 X36.160 Y3.000 Z-10.0270 F3000
+G1 X36.180 Y3.000 Z-10.0545 F3000
+G1 X36.200 Y3.000 Z-10.0821 F3000
+G1 X36.220 Y3.000 Z-10.1098 F3000
+G1 X36.240 Y3.000 Z-10.1376 F3000
+G1 X36.260 Y3.000 Z-10.1655 F3000
+G1 X36.280 Y3.000 Z-10.1935 F3000
+G1 X36.300 Y3.000 Z-10.2216 F3000
+G1 X36.320 Y3.000 Z-10.2498 F3000
+G1 X36.340 Y3.000 Z-10.2781 F3000
+G1 X36.360 Y3.000 Z-10.3065 F3000
+G1 X36.380 Y3.000 Z-10.3350 F3000
+G1 X36.400 Y3.000 Z-10.3637 F3000
+G1 X36.420 Y3.000 Z-10.3924 F3000
+G1 X36.440 Y3.000 Z-10.4212 F3000
+G1 X36.460 Y3.000 Z-10.4502 F3000
+G1 X36.480 Y3.000 Z-10.4792 F3000
+G1 X36.500 Y3.000 Z-10.5084 F3000
+G1 X36.520 Y3.000 Z-10.5377 F3000
+G1 X36.540 Y3.000 Z-10.5671 F3000
+G1 X36.560 Y3.000 Z-10.5966 F3000
+G1 X36.580 Y3.000 Z-10.6262 F3000
+G1 X36.600 Y3.000 Z-10.6559 F3000
+G1 X36.620 Y3.000 Z-10.6858 F3000
+G1 X36.640 Y3.000 Z-10.7158 F3000
+G1 X36.660 Y3.000 Z-10.7458 F3000
+G1 X36.680 Y3.000 Z-10.7760 F3000
+G1 X36.700 Y3.000 Z-10.8064 F3000
+G1 X36.720 Y3.000 Z-10.8368 F3000
+G1 X36.740 Y3.000 Z-10.8674 F3000
+G1 X36.760 Y3.000 Z-10.8981 F3000
+G1 X36.780 Y3.000 Z-10.9289 F3000
+G1 X36.800 Y3.000 Z-10.9598 F3000
+G1 X36.820 Y3.000 Z-10.9909 F3000
+G1 X36.840 Y3.000 Z-11.0220 F3000
+G1 X36.860 Y3.000 Z-11.0534 F3000
+G1 X36.880 Y3.000 Z-11.0848 F3000
+G1 X36.900 Y3.000 Z-11.1164 F3000
+G1 X36.920 Y3.000 Z-11.1481 F3000
+G1 X36.940 Y3.000 Z-11.1799 F3000
+G1 X36.960 Y3.000 Z-11.2119 F3000
+G1 X36.980 Y3.000 Z-11.2440 F3000
+G1 X37.000 Y3.000 Z-11.2762 F3000
+G1 X37.020 Y3.000 Z-11.3086 F3000
+G1 X37.040 Y3.000 Z-11.3411 F3000
+G1 X37.060 Y3.000 Z-11.3738 F3000
+G1 X37.080 Y3.000 Z-11.4066 F3000
+G1 X37.100 Y3.000 Z-11.4395 F3000
+G1 X37.120 Y3.000 Z-11.4726 F3000
+G1 X37.140 Y3.000 Z-11.5058 F3000
+G1 X37.160 Y3.000 Z-11.5392 F3000
+G1 X37.180 Y3.000 Z-11.5727 F3000
+G1 X37.200 Y3.000 Z-11.6064 F3000
+G1 X37.220 Y3.000 Z-11.6402 F3000
+G1 X37.240 Y3.000 Z-11.6742 F3000
+G1 X37.260 Y3.000 Z-11.7083 F3000
+G1 X37.280 Y3.000 Z-11.7426 F3000
+G1 X37.300 Y3.000 Z-11.7770 F3000
+G1 X37.320 Y3.000 Z-11.8116 F3000
+G1 X37.340 Y3.000 Z-11.8464 F3000
+G1 X37.360 Y3.000 Z-11.8813 F3000
+G1 X37.380 Y3.000 Z-11.9164 F3000
+G1 X37.400 Y3.000 Z-11.9516 F3000
+G1 X37.420 Y3.000 Z-11.9871 F3000
+G1 X37.440 Y3.000 Z-12.0227 F3000
+G1 X37.460 Y3.000 Z-12.0584 F3000
+G1 X37.480 Y3.000 Z-12.0944 F3000
+G1 X37.500 Y3.000 Z-12.1305 F3000
+G1 X37.520 Y3.000 Z-12.1667 F3000
+G1 X37.540 Y3.000 Z-12.2032 F3000
+G1 X37.560 Y3.000 Z-12.2399 F3000
+G1 X37.580 Y3.000 Z-12.2767 F3000
+G1 X37.600 Y3.000 Z-12.3137 F3000
+G1 X37.620 Y3.000 Z-12.3509 F3000
+G1 X37.640 Y3.000 Z-12.3883 F3000
+G1 X37.660 Y3.000 Z-12.4259 F3000
+G1 X37.680 Y3.000 Z-12.4636 F3000
+G1 X37.700 Y3.000 Z-12.5016 F3000
+G1 X37.720 Y3.000 Z-12.5398 F3000
+G1 X37.740 Y3.000 Z-12.5782 F3000
+G1 X37.760 Y3.000 Z-12.6167 F3000
+G1 X37.780 Y3.000 Z-12.6555 F3000
+G1 X37.800 Y3.000 Z-12.6945 F3000
+G1 X37.820 Y3.000 Z-12.7337 F3000
+G1 X37.840 Y3.000 Z-12.7731 F3000
+G1 X37.860 Y3.000 Z-12.8128 F3000
+G1 X37.880 Y3.000 Z-12.8526 F3000
+G1 X37.900 Y3.000 Z-12.8927 F3000
+G1 X37.920 Y3.000 Z-12.9330 F3000
+G1 X37.940 Y3.000 Z-12.9735 F3000
+G1 X37.960 Y3.000 Z-13.0143 F3000
+G1 X37.980 Y3.000 Z-13.0553 F3000
+G1 X38.000 Y3.000 Z-13.0966 F3000
+G1 X38.020 Y3.000 Z-13.1380 F3000
+G1 X38.040 Y3.000 Z-13.1798 F3000
+G1 X38.060 Y3.000 Z-13.2217 F3000
+G1 X38.080 Y3.000 Z-13.2640 F3000
+G1 X38.100 Y3.000 Z-13.3065 F3000
+G1 X38.120 Y3.000 Z-13.3492 F3000
+G1 X38.140 Y3.000 Z-13.3922 F3000
+G1 X38.160 Y3.000 Z-13.4355 F3000
+G1 X38.180 Y3.000 Z-13.4791 F3000
+G1 X38.200 Y3.000 Z-13.5229 F3000
+G1 X38.220 Y3.000 Z-13.5670 F3000
+G1 X38.240 Y3.000 Z-13.6114 F3000
+G1 X38.260 Y3.000 Z-13.6561 F3000
+G1 X38.280 Y3.000 Z-13.7011 F3000
+G1 X38.300 Y3.000 Z-13.7464 F3000
+G1 X38.320 Y3.000 Z-13.7920 F3000
+G1 X38.340 Y3.000 Z-13.8379 F3000
+G1 X38.360 Y3.000 Z-13.8842 F3000
+G1 X38.380 Y3.000 Z-13.9307 F3000
+G1 X38.400 Y3.000 Z-13.9776 F3000
+G1 X38.420 Y3.000 Z-14.0248 F3000
+G1 X38.440 Y3.000 Z-14.0724 F3000
+G1 X38.460 Y3.000 Z-14.1203 F3000
+G1 X38.480 Y3.000 Z-14.1685 F3000
+G1 X38.500 Y3.000 Z-14.2171 F3000
+G1 X38.520 Y3.000 Z-14.2661 F3000
+G1 X38.540 Y3.000 Z-14.3155 F3000
+G1 X38.560 Y3.000 Z-14.3652 F3000
+G1 X38.580 Y3.000 Z-14.4153 F3000
+G1 X38.600 Y3.000 Z-14.4658 F3000
+G1 X38.620 Y3.000 Z-14.5168 F3000
+G1 X38.640 Y3.000 Z-14.5681 F3000
+G1 X38.660 Y3.000 Z-14.6199 F3000
+G1 X38.680 Y3.000 Z-14.6721 F3000
+G1 X38.700 Y3.000 Z-14.7247 F3000
+G1 X38.720 Y3.000 Z-14.7778 F3000
+G1 X38.740 Y3.000 Z-14.8313 F3000
+G1 X38.760 Y3.000 Z-14.8853 F3000
+G1 X38.780 Y3.000 Z-14.9399 F3000
+G1 X38.800 Y3.000 Z-14.9949 F3000
+G1 X38.820 Y3.000 Z-15.0504 F3000
+G1 X38.840 Y3.000 Z-15.1064 F3000
+G1 X38.860 Y3.000 Z-15.1630 F3000
+G1 X38.880 Y3.000 Z-15.2201 F3000
+G1 X38.900 Y3.000 Z-15.2777 F3000
+G1 X38.920 Y3.000 Z-15.3360 F3000
+G1 X38.940 Y3.000 Z-15.3948 F3000
+G1 X38.960 Y3.000 Z-15.4543 F3000
+G1 X38.980 Y3.000 Z-15.5143 F3000
+G1 X39.000 Y3.000 Z-15.5751 F3000
+G1 X39.020 Y3.000 Z-15.6364 F3000
+G1 X39.040 Y3.000 Z-15.6985 F3000
+G1 X39.060 Y3.000 Z-15.7613 F3000
+G1 X39.080 Y3.000 Z-15.8248 F3000
+G1 X39.100 Y3.000 Z-15.8890 F3000
+G1 X39.120 Y3.000 Z-15.9540 F3000
+G1 X39.140 Y3.000 Z-16.0198 F3000
+G1 X39.160 Y3.000 Z-16.0865 F3000
+G1 X39.180 Y3.000 Z-16.1540 F3000
+G1 X39.200 Y3.000 Z-16.2224 F3000
+G1 X39.220 Y3.000 Z-16.2917 F3000
+G1 X39.240 Y3.000 Z-16.3619 F3000
+G1 X39.260 Y3.000 Z-16.4332 F3000
+G1 X39.280 Y3.000 Z-16.5055 F3000
+G1 X39.300 Y3.000 Z-16.5789 F3000
+G1 X39.320 Y3.000 Z-16.6534 F3000
+G1 X39.340 Y3.000 Z-16.7291 F3000
+G1 X39.360 Y3.000 Z-16.8060 F3000
+G1 X39.380 Y3.000 Z-16.8841 F3000
+G1 X39.400 Y3.000 Z-16.9637 F3000
+G1 X39.420 Y3.000 Z-17.0446 F3000
+G1 X39.440 Y3.000 Z-17.1271 F3000
+G1 X39.460 Y3.000 Z-17.2111 F3000
+G1 X39.480 Y3.000 Z-17.2967 F3000
+G1 X39.500 Y3.000 Z-17.3841 F3000
+G1 X39.520 Y3.000 Z-17.4734 F3000
+G1 X39.540 Y3.000 Z-17.5646 F3000
+G1 X39.560 Y3.000 Z-17.6580 F3000
+G1 X39.580 Y3.000 Z-17.7536 F3000
+G1 X39.600 Y3.000 Z-17.8516 F3000
+G1 X39.620 Y3.000 Z-17.9522 F3000
+G1 X39.640 Y3.000 Z-18.0556 F3000
+G1 X39.660 Y3.000 Z-18.1621 F3000
+G1 X39.680 Y3.000 Z-18.2719 F3000
+G1 X39.700 Y3.000 Z-18.3853 F3000
+G1 X39.720 Y3.000 Z-18.5028 F3000
+G1 X39.740 Y3.000 Z-18.6247 F3000
+G1 X39.760 Y3.000 Z-18.7517 F3000
+G1 X39.780 Y3.000 Z-18.8842 F3000
+G1 X39.800 Y3.000 Z-19.0233 F3000
+G1 X39.820 Y3.000 Z-19.1699 F3000
+G1 X39.840 Y3.000 Z-19.3252 F3000
+G1 X39.860 Y3.000 Z-19.4912 F3000
+G1 X39.880 Y3.000 Z-19.6703 F3000
+G1 X39.900 Y3.000 Z-19.8661 F3000
+G1 X39.920 Y3.000 Z-20.0843 F3000
+G1 X39.940 Y3.000 Z-20.3349 F3000
+G1 X39.960 Y3.000 Z-20.6388 F3000
+G1 X39.980 Y3.000 Z-21.0586 F3000
+G1 X40.000 Y3.000 Z-21.8000 F3000
+G1 X40.000 Y3.500 Z-21.8000 F3000
+G1 X39.980 Y3.500 Z-21.8000 F3000
+G1 X39.960 Y3.500 Z-21.0264 F3000
+G1 X39.940 Y3.500 Z-20.6183 F3000
+G1 X39.920 Y3.500 Z-20.3189 F3000
+G1 X39.900 Y3.500 Z-20.0708 F3000
+G1 X39.880 Y3.500 Z-19.8543 F3000
+G1 X39.860 Y3.500 Z-19.6598 F3000
+G1 X39.840 Y3.500 Z-19.4817 F3000
+G1 X39.820 Y3.500 Z-19.3165 F3000
+G1 X39.800 Y3.500 Z-19.1618 F3000
+G1 X39.780 Y3.500 Z-19.0158 F3000
+G1 X39.760 Y3.500 Z-18.8773 F3000
+G1 X39.740 Y3.500 Z-18.7451 F3000
+G1 X39.720 Y3.500 Z-18.6186 F3000
+G1 X39.700 Y3.500 Z-18.4970 F3000
+G1 X39.680 Y3.500 Z-18.3798 F3000
+G1 X39.660 Y3.500 Z-18.2667 F3000
+G1 X39.640 Y3.500 Z-18.1571 F3000
+G1 X39.620 Y3.500 Z-18.0509 F3000
+G1 X39.600 Y3.500 Z-17.9477 F3000
+G1 X39.580 Y3.500 Z-17.8473 F3000
+G1 X39.560 Y3.500 Z-17.7495 F3000
+G1 X39.540 Y3.500 Z-17.6541 F3000
+G1 X39.520 Y3.500 Z-17.5609 F3000
+G1 X39.500 Y3.500 Z-17.4699 F3000
+G1 X39.480 Y3.500 Z-17.3808 F3000
+G1 X39.460 Y3.500 Z-17.2935 F3000
+G1 X39.440 Y3.500 Z-17.2080 F3000
+G1 X39.420 Y3.500 Z-17.1241 F3000
+G1 X39.400 Y3.500 Z-17.0418 F3000
+G1 X39.380 Y3.500 Z-16.9610 F3000
+G1 X39.360 Y3.500 Z-16.8816 F3000
+G1 X39.340 Y3.500 Z-16.8036 F3000
+G1 X39.320 Y3.500 Z-16.7268 F3000
+G1 X39.300 Y3.500 Z-16.6512 F3000
+G1 X39.280 Y3.500 Z-16.5768 F3000
+G1 X39.260 Y3.500 Z-16.5035 F3000
+G1 X39.240 Y3.500 Z-16.4314 F3000
+G1 X39.220 Y3.500 Z-16.3602 F3000
+G1 X39.200 Y3.500 Z-16.2900 F3000
+G1 X39.180 Y3.500 Z-16.2208 F3000
+G1 X39.160 Y3.500 Z-16.1525 F3000
+G1 X39.140 Y3.500 Z-16.0851 F3000
+G1 X39.120 Y3.500 Z-16.0185 F3000
+G1 X39.100 Y3.500 Z-15.9528 F3000
+G1 X39.080 Y3.500 Z-15.8878 F3000
+G1 X39.060 Y3.500 Z-15.8237 F3000
+G1 X39.040 Y3.500 Z-15.7603 F3000
+G1 X39.020 Y3.500 Z-15.6976 F3000
+G1 X39.000 Y3.500 Z-15.6356 F3000
+G1 X38.980 Y3.500 Z-15.5743 F3000
+G1 X38.960 Y3.500 Z-15.5136 F3000
+G1 X38.940 Y3.500 Z-15.4536 F3000
+G1 X38.920 Y3.500 Z-15.3943 F3000
+G1 X38.900 Y3.500 Z-15.3355 F3000
+G1 X38.880 Y3.500 Z-15.2773 F3000
+G1 X38.860 Y3.500 Z-15.2197 F3000
+G1 X38.840 Y3.500 Z-15.1627 F3000
+G1 X38.820 Y3.500 Z-15.1062 F3000
+G1 X38.800 Y3.500 Z-15.0502 F3000
+G1 X38.780 Y3.500 Z-14.9947 F3000
+G1 X38.760 Y3.500 Z-14.9398 F3000
+G1 X38.740 Y3.500 Z-14.8853 F3000
+G1 X38.720 Y3.500 Z-14.8314 F3000
+G1 X38.700 Y3.500 Z-14.7779 F3000
+G1 X38.680 Y3.500 Z-14.7249 F3000
+G1 X38.660 Y3.500 Z-14.6723 F3000
+G1 X38.640 Y3.500 Z-14.6201 F3000
+G1 X38.620 Y3.500 Z-14.5684 F3000
+G1 X38.600 Y3.500 Z-14.5171 F3000
+G1 X38.580 Y3.500 Z-14.4663 F3000
+G1 X38.560 Y3.500 Z-14.4158 F3000
+G1 X38.540 Y3.500 Z-14.3657 F3000
+G1 X38.520 Y3.500 Z-14.3160 F3000
+G1 X38.500 Y3.500 Z-14.2667 F3000
+G1 X38.480 Y3.500 Z-14.2178 F3000
+G1 X38.460 Y3.500 Z-14.1692 F3000
+G1 X38.440 Y3.500 Z-14.1210 F3000
+G1 X38.420 Y3.500 Z-14.0732 F3000
+G1 X38.400 Y3.500 Z-14.0257 F3000
+G1 X38.380 Y3.500 Z-13.9785 F3000
+G1 X38.360 Y3.500 Z-13.9317 F3000
+G1 X38.340 Y3.500 Z-13.8852 F3000
+G1 X38.320 Y3.500 Z-13.8390 F3000
+G1 X38.300 Y3.500 Z-13.7931 F3000
+G1 X38.280 Y3.500 Z-13.7476 F3000
+G1 X38.260 Y3.500 Z-13.7023 F3000
+G1 X38.240 Y3.500 Z-13.6574 F3000
+G1 X38.220 Y3.500 Z-13.6127 F3000
+G1 X38.200 Y3.500 Z-13.5684 F3000
+G1 X38.180 Y3.500 Z-13.5243 F3000
+G1 X38.160 Y3.500 Z-13.4805 F3000
+G1 X38.140 Y3.500 Z-13.4370 F3000
+G1 X38.120 Y3.500 Z-13.3937 F3000
+G1 X38.100 Y3.500 Z-13.3507 F3000
+G1 X38.080 Y3.500 Z-13.3080 F3000
+G1 X38.060 Y3.500 Z-13.2656 F3000
+G1 X38.040 Y3.500 Z-13.2234 F3000
+G1 X38.020 Y3.500 Z-13.1814 F3000
+G1 X38.000 Y3.500 Z-13.1397 F3000
+G1 X37.980 Y3.500 Z-13.0983 F3000
+G1 X37.960 Y3.500 Z-13.0571 F3000
+G1 X37.940 Y3.500 Z-13.0161 F3000
+G1 X37.920 Y3.500 Z-12.9754 F3000
+G1 X37.900 Y3.500 Z-12.9349 F3000
+G1 X37.880 Y3.500 Z-12.8946 F3000
+G1 X37.860 Y3.500 Z-12.8546 F3000
+G1 X37.840 Y3.500 Z-12.8148 F3000
+G1 X37.820 Y3.500 Z-12.7752 F3000
+G1 X37.800 Y3.500 Z-12.7358 F3000
+G1 X37.780 Y3.500 Z-12.6966 F3000
+G1 X37.760 Y3.500 Z-12.6577 F3000
+G1 X37.740 Y3.500 Z-12.6189 F3000
+G1 X37.720 Y3.500 Z-12.5804 F3000
+G1 X37.700 Y3.500 Z-12.5420 F3000
+G1 X37.680 Y3.500 Z-12.5039 F3000
+G1 X37.660 Y3.500 Z-12.4660 F3000
+G1 X37.640 Y3.500 Z-12.4282 F3000
+G1 X37.620 Y3.500 Z-12.3907 F3000
+G1 X37.600 Y3.500 Z-12.3533 F3000
+G1 X37.580 Y3.500 Z-12.3161 F3000
+G1 X37.560 Y3.500 Z-12.2792 F3000
+G1 X37.540 Y3.500 Z-12.2424 F3000
+G1 X37.520 Y3.500 Z-12.2058 F3000
+G1 X37.500 Y3.500 Z-12.1693 F3000
+G1 X37.480 Y3.500 Z-12.1331 F3000
+G1 X37.460 Y3.500 Z-12.0970 F3000
+G1 X37.440 Y3.500 Z-12.0611 F3000
+G1 X37.420 Y3.500 Z-12.0254 F3000
+G1 X37.400 Y3.500 Z-11.9898 F3000
+G1 X37.380 Y3.500 Z-11.9544 F3000
+G1 X37.360 Y3.500 Z-11.9192 F3000
+G1 X37.340 Y3.500 Z-11.8841 F3000
+G1 X37.320 Y3.500 Z-11.8492 F3000
+G1 X37.300 Y3.500 Z-11.8145 F3000
+G1 X37.280 Y3.500 Z-11.7799 F3000
+G1 X37.260 Y3.500 Z-11.7455 F3000
+G1 X37.240 Y3.500 Z-11.7113 F3000
+G1 X37.220 Y3.500 Z-11.6772 F3000
+G1 X37.200 Y3.500 Z-11.6432 F3000
+G1 X37.180 Y3.500 Z-11.6094 F3000
+G1 X37.160 Y3.500 Z-11.5758 F3000
+G1 X37.140 Y3.500 Z-11.5423 F3000
+G1 X37.120 Y3.500 Z-11.5090 F3000
+G1 X37.100 Y3.500 Z-11.4758 F3000
+G1 X37.080 Y3.500 Z-11.4427 F3000
+G1 X37.060 Y3.500 Z-11.4098 F3000
+G1 X37.040 Y3.500 Z-11.3770 F3000
+G1 X37.020 Y3.500 Z-11.3444 F3000
+G1 X37.000 Y3.500 Z-11.3119 F3000
+G1 X36.980 Y3.500 Z-11.2796 F3000
+G1 X36.960 Y3.500 Z-11.2474 F3000
+G1 X36.940 Y3.500 Z-11.2153 F3000
+G1 X36.920 Y3.500 Z-11.1833 F3000
+G1 X36.900 Y3.500 Z-11.1515 F3000
+G1 X36.880 Y3.500 Z-11.1199 F3000
+G1 X36.860 Y3.500 Z-11.0883 F3000
+G1 X36.840 Y3.500 Z-11.0569 F3000
+G1 X36.820 Y3.500 Z-11.0256 F3000
+G1 X36.800 Y3.500 Z-10.9944 F3000
+G1 X36.780 Y3.500 Z-10.9634 F3000
+G1 X36.760 Y3.500 Z-10.9325 F3000
+G1 X36.740 Y3.500 Z-10.9017 F3000
+G1 X36.720 Y3.500 Z-10.8711 F3000
+G1 X36.700 Y3.500 Z-10.8405 F3000
+G1 X36.680 Y3.500 Z-10.8101 F3000
+G1 X36.660 Y3.500 Z-10.7798 F3000
+G1 X36.640 Y3.500 Z-10.7496 F3000
+G1 X36.620 Y3.500 Z-10.7196 F3000
+G1 X36.600 Y3.500 Z-10.6896 F3000
+G1 X36.580 Y3.500 Z-10.6598 F3000
+G1 X36.560 Y3.500 Z-10.6301 F3000
+G1 X36.540 Y3.500 Z-10.6005 F3000
+G1 X36.520 Y3.500 Z-10.5710 F3000
+G1 X36.500 Y3.500 Z-10.5417 F3000
+G1 X36.480 Y3.500 Z-10.5124 F3000
+G1 X36.460 Y3.500 Z-10.4833 F3000
+G1 X36.440 Y3.500 Z-10.4542 F3000
+G1 X36.420 Y3.500 Z-10.4253 F3000
+G1 X36.400 Y3.500 Z-10.3965 F3000
+G1 X36.380 Y3.500 Z-10.3678 F3000
+G1 X36.360 Y3.500 Z-10.3392 F3000
+G1 X36.340 Y3.500 Z-10.3107 F3000
+G1 X36.320 Y3.500 Z-10.2823 F3000
+G1 X36.300 Y3.500 Z-10.2540 F3000
+G1 X36.280 Y3.500 Z-10.2258 F3000
+G1 X36.260 Y3.500 Z-10.1977 F3000
+G1 X36.240 Y3.500 Z-10.1698 F3000
+G1 X36.220 Y3.500 Z-10.1419 F3000
+G1 X36.200 Y3.500 Z-10.1141 F3000
+G1 X36.180 Y3.500 Z-10.0864 F3000
+G1 X36.160 Y3.500 Z-10.0589 F3000
+G1 X36.140 Y3.500 Z-10.0314 F3000
+G1 X36.120 Y3.500 Z-10.0040 F3000
+G1 X36.100 Y3.500 Z-9.9767 F3000
+G1 X36.080 Y3.500 Z-9.9495 F3000
+G1 X36.060 Y3.500 Z-9.9224 F3000
+G1 X36.040 Y3.500 Z-9.8954 F3000
+G1 X36.020 Y3.500 Z-9.8685 F3000
+G1 X36.000 Y3.500 Z-9.8417 F3000
+G1 X35.980 Y3.500 Z-9.8150 F3000
+G1 X35.960 Y3.500 Z-9.7884 F3000
+G1 X35.940 Y3.500 Z-9.7619 F3000
+G1 X35.920 Y3.500 Z-9.7354 F3000
+G1 X35.900 Y3.500 Z-9.7091 F3000
+G1 X35.880 Y3.500 Z-9.6828 F3000
+G1 X35.860 Y3.500 Z-9.6567 F3000
+G1 X35.840 Y3.500 Z-9.6306 F3000
+G1 X35.820 Y3.500 Z-9.6046 F3000
+G1 X35.800 Y3.500 Z-9.5787 F3000
+G1 X35.780 Y3.500 Z-9.5529 F3000
+G1 X35.760 Y3.500 Z-9.5272 F3000
+G1 X35.740 Y3.500 Z-9.5015 F3000
+G1 X35.720 Y3.500 Z-9.4760 F3000
+G1 X35.700 Y3.500 Z-9.4505 F3000
+G1 X35.680 Y3.500 Z-9.4251 F3000
+G1 X35.660 Y3.500 Z-9.3998 F3000
+G1 X35.640 Y3.500 Z-9.3746 F3000
+G1 X35.620 Y3.500 Z-9.3495 F3000
+G1 X35.600 Y3.500 Z-9.3244 F3000
+G1 X35.580 Y3.500 Z-9.2995 F3000
+G1 X35.560 Y3.500 Z-9.2746 F3000
+G1 X35.540 Y3.500 Z-9.2498 F3000
+G1 X35.520 Y3.500 Z-9.2250 F3000
+G1 X35.500 Y3.500 Z-9.2004 F3000
+G1 X35.480 Y3.500 Z-9.1758 F3000
+G1 X35.460 Y3.500 Z-9.1513 F3000
+G1 X35.440 Y3.500 Z-9.1269 F3000
+G1 X35.420 Y3.500 Z-9.1026 F3000
+G1 X35.400 Y3.500 Z-9.0784 F3000
+G1 X35.380 Y3.500 Z-9.0542 F3000
+G1 X35.360 Y3.500 Z-9.0301 F3000
+G1 X35.340 Y3.500 Z-9.0061 F3000
+G1 X35.320 Y3.500 Z-8.9821 F3000
+G1 X35.300 Y3.500 Z-8.9583 F3000
+G1 X35.280 Y3.500 Z-8.9345 F3000
+G1 X35.260 Y3.500 Z-8.9108 F3000
+G1 X35.240 Y3.500 Z-8.8871 F3000
+G1 X35.220 Y3.500 Z-8.8636 F3000
+G1 X35.200 Y3.500 Z-8.8401 F3000
+G1 X35.180 Y3.500 Z-8.8166 F3000
+G1 X35.160 Y3.500 Z-8.7933 F3000
+G1 X35.140 Y3.500 Z-8.7700 F3000
+G1 X35.120 Y3.500 Z-8.7468 F3000
+G1 X35.100 Y3.500 Z-8.7237 F3000
+G1 X35.080 Y3.500 Z-8.7006 F3000
+G1 X35.060 Y3.500 Z-8.6776 F3000
+G1 X35.040 Y3.500 Z-8.6547 F3000
+G1 X35.020 Y3.500 Z-8.6319 F3000
+G1 X35.000 Y3.500 Z-8.6091 F3000
+G1 X34.980 Y3.500 Z-8.5864 F3000
+G1 X34.960 Y3.500 Z-8.5637 F3000
+G1 X34.940 Y3.500 Z-8.5412 F3000
+G1 X34.920 Y3.500 Z-8.5187 F3000
+G1 X34.900 Y3.500 Z-8.4962 F3000
+G1 X34.880 Y3.500 Z-8.4739 F3000
+G1 X34.860 Y3.500 Z-8.4516 F3000
+G1 X34.840 Y3.500 Z-8.4293 F3000
+G1 X34.820 Y3.500 Z-8.4072 F3000
+G1 X34.800 Y3.500 Z-8.3851 F3000
+G1 X34.780 Y3.500 Z-8.3631 F3000
+G1 X34.760 Y3.500 Z-8.3411 F3000
+G1 X34.740 Y3.500 Z-8.3192 F3000
+G1 X34.720 Y3.500 Z-8.2973 F3000
+G1 X34.700 Y3.500 Z-8.2756 F3000
+G1 X34.680 Y3.500 Z-8.2539 F3000
+G1 X34.660 Y3.500 Z-8.2322 F3000
+G1 X34.640 Y3.500 Z-8.2107 F3000
+G1 X34.620 Y3.500 Z-8.1891 F3000
+G1 X34.600 Y3.500 Z-8.1677 F3000
+G1 X34.580 Y3.500 Z-8.1463 F3000
+G1 X34.560 Y3.500 Z-8.1250 F3000
+G1 X34.540 Y3.500 Z-8.1037 F3000
+G1 X34.520 Y3.500 Z-8.0825 F3000
+G1 X34.500 Y3.500 Z-8.0614 F3000
+G1 X34.480 Y3.500 Z-8.0403 F3000
+G1 X34.460 Y3.500 Z-8.0193 F3000
+G1 X34.440 Y3.500 Z-7.9983 F3000
+G1 X34.420 Y3.500 Z-7.9774 F3000
+G1 X34.400 Y3.500 Z-7.9566 F3000
+G1 X34.380 Y3.500 Z-7.9358 F3000
+G1 X34.360 Y3.500 Z-7.9151 F3000
+G1 X34.340 Y3.500 Z-7.8944 F3000
+G1 X34.320 Y3.500 Z-7.8739 F3000
+G1 X34.300 Y3.500 Z-7.8533 F3000
+G1 X34.280 Y3.500 Z-7.8328 F3000
+G1 X34.260 Y3.500 Z-7.8124 F3000
+G1 X34.240 Y3.500 Z-7.7921 F3000
+G1 X34.220 Y3.500 Z-7.7718 F3000
+G1 X34.200 Y3.500 Z-7.7515 F3000
+G1 X34.180 Y3.500 Z-7.7313 F3000
+G1 X34.160 Y3.500 Z-7.7112 F3000
+G1 X34.140 Y3.500 Z-7.6911 F3000
+G1 X34.120 Y3.500 Z-7.6711 F3000
+G1 X34.100 Y3.500 Z-7.6511 F3000
+G1 X34.080 Y3.500 Z-7.6312 F3000
+G1 X34.060 Y3.500 Z-7.6114 F3000
+G1 X34.040 Y3.500 Z-7.5916 F3000
+G1 X34.020 Y3.500 Z-7.5719 F3000
+G1 X34.000 Y3.500 Z-7.5522 F3000
+G1 X33.980 Y3.500 Z-7.5326 F3000
+G1 X33.960 Y3.500 Z-7.5130 F3000
+G1 X33.940 Y3.500 Z-7.4935 F3000
+G1 X33.920 Y3.500 Z-7.4740 F3000
+G1 X33.900 Y3.500 Z-7.4546 F3000
+G1 X33.880 Y3.500 Z-7.4353 F3000
+G1 X33.860 Y3.500 Z-7.4160 F3000
+G1 X33.840 Y3.500 Z-7.3967 F3000
+G1 X33.820 Y3.500 Z-7.3775 F3000
+G1 X33.800 Y3.500 Z-7.3584 F3000
+G1 X33.780 Y3.500 Z-7.3393 F3000
+G1 X33.760 Y3.500 Z-7.3203 F3000
+G1 X33.740 Y3.500 Z-7.3013 F3000
+G1 X33.720 Y3.500 Z-7.2824 F3000
+G1 X33.700 Y3.500 Z-7.2635 F3000
+G1 X33.680 Y3.500 Z-7.2447 F3000
+G1 X33.660 Y3.500 Z-7.2259 F3000
+G1 X33.640 Y3.500 Z-7.2072 F3000
+G1 X33.620 Y3.500 Z-7.1885 F3000
+G1 X33.600 Y3.500 Z-7.1699 F3000
+G1 X33.580 Y3.500 Z-7.1513 F3000
+G1 X33.560 Y3.500 Z-7.1328 F3000
+G1 X33.540 Y3.500 Z-7.1143 F3000
+G1 X33.520 Y3.500 Z-7.0959 F3000
+G1 X33.500 Y3.500 Z-7.0776 F3000
+G1 X33.480 Y3.500 Z-7.0593 F3000
+G1 X33.460 Y3.500 Z-7.0410 F3000
+G1 X33.440 Y3.500 Z-7.0228 F3000
+G1 X33.420 Y3.500 Z-7.0046 F3000
+G1 X33.400 Y3.500 Z-6.9865 F3000
+G1 X33.380 Y3.500 Z-6.9684 F3000
+G1 X33.360 Y3.500 Z-6.9504 F3000
+G1 X33.340 Y3.500 Z-6.9324 F3000
+G1 X33.320 Y3.500 Z-6.9145 F3000
+G1 X33.300 Y3.500 Z-6.8966 F3000
+G1 X33.280 Y3.500 Z-6.8788 F3000
+G1 X33.260 Y3.500 Z-6.8610 F3000
+G1 X33.240 Y3.500 Z-6.8433 F3000
+G1 X33.220 Y3.500 Z-6.8256 F3000
+G1 X33.200 Y3.500 Z-6.8080 F3000
+G1 X33.180 Y3.500 Z-6.7904 F3000
+G1 X33.160 Y3.500 Z-6.7729 F3000
+G1 X33.140 Y3.500 Z-6.7554 F3000
+G1 X33.120 Y3.500 Z-6.7379 F3000
+G1 X33.100 Y3.500 Z-6.7205 F3000
+G1 X33.080 Y3.500 Z-6.7032 F3000
+G1 X33.060 Y3.500 Z-6.6859 F3000
+G1 X33.040 Y3.500 Z-6.6686 F3000
+G1 X33.020 Y3.500 Z-6.6514 F3000
+G1 X33.000 Y3.500 Z-6.6342 F3000
+G1 X32.980 Y3.500 Z-6.6171 F3000
+G1 X32.960 Y3.500 Z-6.6001 F3000
+G1 X32.940 Y3.500 Z-6.5830 F3000
+G1 X32.920 Y3.500 Z-6.5660 F3000
+G1 X32.900 Y3.500 Z-6.5491 F3000
+G1 X32.880 Y3.500 Z-6.5322 F3000
+G1 X32.860 Y3.500 Z-6.5154 F3000
+G1 X32.840 Y3.500 Z-6.4985 F3000
+G1 X32.820 Y3.500 Z-6.4818 F3000
+G1 X32.800 Y3.500 Z-6.4651 F3000
+G1 X32.780 Y3.500 Z-6.4484 F3000
+G1 X32.760 Y3.500 Z-6.4318 F3000
+G1 X32.740 Y3.500 Z-6.4152 F3000
+G1 X32.720 Y3.500 Z-6.3986 F3000
+G1 X32.700 Y3.500 Z-6.3822 F3000
+G1 X32.680 Y3.500 Z-6.3657 F3000
+G1 X32.660 Y3.500 Z-6.3493 F3000
+G1 X32.640 Y3.500 Z-6.3329 F3000
+G1 X32.620 Y3.500 Z-6.3166 F3000
+G1 X32.600 Y3.500 Z-6.3003 F3000
+G1 X32.580 Y3.500 Z-6.2841 F3000
+G1 X32.560 Y3.500 Z-6.2679 F3000
+G1 X32.540 Y3.500 Z-6.2517 F3000
+G1 X32.520 Y3.500 Z-6.2356 F3000
+G1 X32.500 Y3.500 Z-6.2196 F3000
+G1 X32.480 Y3.500 Z-6.2035 F3000
+G1 X32.460 Y3.500 Z-6.1876 F3000
+G1 X32.440 Y3.500 Z-6.1716 F3000
+G1 X32.420 Y3.500 Z-6.1557 F3000
+G1 X32.400 Y3.500 Z-6.1399 F3000
+G1 X32.380 Y3.500 Z-6.1240 F3000
+G1 X32.360 Y3.500 Z-6.1083 F3000
+G1 X32.340 Y3.500 Z-6.0925 F3000
+G1 X32.320 Y3.500 Z-6.0768 F3000
+G1 X32.300 Y3.500 Z-6.0612 F3000
+G1 X32.280 Y3.500 Z-6.0456 F3000
+G1 X32.260 Y3.500 Z-6.0300 F3000
+G1 X32.240 Y3.500 Z-6.0145 F3000
+G1 X32.220 Y3.500 Z-5.9990 F3000
+G1 X32.200 Y3.500 Z-5.9836 F3000
+G1 X32.180 Y3.500 Z-5.9681 F3000
+G1 X32.160 Y3.500 Z-5.9528 F3000
+G1 X32.140 Y3.500 Z-5.9375 F3000
+G1 X32.120 Y3.500 Z-5.9222 F3000
+G1 X32.100 Y3.500 Z-5.9069 F3000
+G1 X32.080 Y3.500 Z-5.8917 F3000
+G1 X32.060 Y3.500 Z-5.8765 F3000
+G1 X32.040 Y3.500 Z-5.8614 F3000
+G1 X32.020 Y3.500 Z-5.8463 F3000
+G1 X32.000 Y3.500 Z-5.8313 F3000
+G1 X31.980 Y3.500 Z-5.8163 F3000
+G1 X31.960 Y3.500 Z-5.8013 F3000
+G1 X31.940 Y3.500 Z-5.7864 F3000
+G1 X31.920 Y3.500 Z-5.7715 F3000
+G1 X31.900 Y3.500 Z-5.7566 F3000
+G1 X31.880 Y3.500 Z-5.7418 F3000
+G1 X31.860 Y3.500 Z-5.7270 F3000
+G1 X31.840 Y3.500 Z-5.7123 F3000
+G1 X31.820 Y3.500 Z-5.6976 F3000
+G1 X31.800 Y3.500 Z-5.6829 F3000
+G1 X31.780 Y3.500 Z-5.6683 F3000
+G1 X31.760 Y3.500 Z-5.6537 F3000
+G1 X31.740 Y3.500 Z-5.6392 F3000
+G1 X31.720 Y3.500 Z-5.6247 F3000
+G1 X31.700 Y3.500 Z-5.6102 F3000
+G1 X31.680 Y3.500 Z-5.5958 F3000
+G1 X31.660 Y3.500 Z-5.5814 F3000
+G1 X31.640 Y3.500 Z-5.5670 F3000
+G1 X31.620 Y3.500 Z-5.5527 F3000
+G1 X31.600 Y3.500 Z-5.5384 F3000
+G1 X31.580 Y3.500 Z-5.5241 F3000
+G1 X31.560 Y3.500 Z-5.5099 F3000
+G1 X31.540 Y3.500 Z-5.4958 F3000
+G1 X31.520 Y3.500 Z-5.4816 F3000
+G1 X31.500 Y3.500 Z-5.4675 F3000
+G1 X31.480 Y3.500 Z-5.4535 F3000
+G1 X31.460 Y3.500 Z-5.4394 F3000
+G1 X31.440 Y3.500 Z-5.4254 F3000
+G1 X31.420 Y3.500 Z-5.4115 F3000
+G1 X31.400 Y3.500 Z-5.3976 F3000
+G1 X31.380 Y3.500 Z-5.3837 F3000
+G1 X31.360 Y3.500 Z-5.3698 F3000
+G1 X31.340 Y3.500 Z-5.3560 F3000
+G1 X31.320 Y3.500 Z-5.3422 F3000
+G1 X31.300 Y3.500 Z-5.3285 F3000
+G1 X31.280 Y3.500 Z-5.3148 F3000
+G1 X31.260 Y3.500 Z-5.3011 F3000
+G1 X31.240 Y3.500 Z-5.2875 F3000
+G1 X31.220 Y3.500 Z-5.2739 F3000
+G1 X31.200 Y3.500 Z-5.2604 F3000
+G1 X31.180 Y3.500 Z-5.2468 F3000
+G1 X31.160 Y3.500 Z-5.2333 F3000
+G1 X31.140 Y3.500 Z-5.2199 F3000
+G1 X31.120 Y3.500 Z-5.2065 F3000
+G1 X31.100 Y3.500 Z-5.1931 F3000
+G1 X31.080 Y3.500 Z-5.1797 F3000
+G1 X31.060 Y3.500 Z-5.1664 F3000
+G1 X31.040 Y3.500 Z-5.1531 F3000
+G1 X31.020 Y3.500 Z-5.1399 F3000
+G1 X31.000 Y3.500 Z-5.1267 F3000
+G1 X30.980 Y3.500 Z-5.1135 F3000
+G1 X30.960 Y3.500 Z-5.1003 F3000
+G1 X30.940 Y3.500 Z-5.0872 F3000
+G1 X30.920 Y3.500 Z-5.0742 F3000
+G1 X30.900 Y3.500 Z-5.0611 F3000
+G1 X30.880 Y3.500 Z-5.0481 F3000
+G1 X30.860 Y3.500 Z-5.0351 F3000
+G1 X30.840 Y3.500 Z-5.0222 F3000
+G1 X30.820 Y3.500 Z-5.0093 F3000
+G1 X30.800 Y3.500 Z-4.9964 F3000
+G1 X30.780 Y3.500 Z-4.9836 F3000
+G1 X30.760 Y3.500 Z-4.9708 F3000
+G1 X30.740 Y3.500 Z-4.9580 F3000
+G1 X30.720 Y3.500 Z-4.9453 F3000
+G1 X30.700 Y3.500 Z-4.9326 F3000
+G1 X30.680 Y3.500 Z-4.9199 F3000
+G1 X30.660 Y3.500 Z-4.9073 F3000
+G1 X30.640 Y3.500 Z-4.8947 F3000
+G1 X30.620 Y3.500 Z-4.8821 F3000
+G1 X30.600 Y3.500 Z-4.8696 F3000
+G1 X30.580 Y3.500 Z-4.8570 F3000
+G1 X30.560 Y3.500 Z-4.8446 F3000
+G1 X30.540 Y3.500 Z-4.8321 F3000
+G1 X30.520 Y3.500 Z-4.8197 F3000
+G1 X30.500 Y3.500 Z-4.8074 F3000
+G1 X30.480 Y3.500 Z-4.7950 F3000
+G1 X30.460 Y3.500 Z-4.7827 F3000
+G1 X30.440 Y3.500 Z-4.7704 F3000
+G1 X30.420 Y3.500 Z-4.7582 F3000
+G1 X30.400 Y3.500 Z-4.7460 F3000
+G1 X30.380 Y3.500 Z-4.7338 F3000
+G1 X30.360 Y3.500 Z-4.7216 F3000
+G1 X30.340 Y3.500 Z-4.7095 F3000
+G1 X30.320 Y3.500 Z-4.6974 F3000
+G1 X30.300 Y3.500 Z-4.6854 F3000
+G1 X30.280 Y3.500 Z-4.6734 F3000
+G1 X30.260 Y3.500 Z-4.6614 F3000
+G1 X30.240 Y3.500 Z-4.6494 F3000
+G1 X30.220 Y3.500 Z-4.6375 F3000
+G1 X30.200 Y3.500 Z-4.6256 F3000
+G1 X30.180 Y3.500 Z-4.6137 F3000
+G1 X30.160 Y3.500 Z-4.6019 F3000
+G1 X30.140 Y3.500 Z-4.5901 F3000
+G1 X30.120 Y3.500 Z-4.5783 F3000
+G1 X30.100 Y3.500 Z-4.5666 F3000
+G1 X30.080 Y3.500 Z-4.5549 F3000
+G1 X30.060 Y3.500 Z-4.5432 F3000
+G1 X30.040 Y3.500 Z-4.5316 F3000
+G1 X30.020 Y3.500 Z-4.5200 F3000
+G1 X30.000 Y3.500 Z-4.5084 F3000
+G1 X29.980 Y3.500 Z-4.4968 F3000
+G1 X29.960 Y3.500 Z-4.4853 F3000
+G1 X29.940 Y3.500 Z-4.4738 F3000
+G1 X29.920 Y3.500 Z-4.4624 F3000
+G1 X29.900 Y3.500 Z-4.4509 F3000
+G1 X29.880 Y3.500 Z-4.4395 F3000
+G1 X29.860 Y3.500 Z-4.4282 F3000
+G1 X29.840 Y3.500 Z-4.4168 F3000
+G1 X29.820 Y3.500 Z-4.4055 F3000
+G1 X29.800 Y3.500 Z-4.3943 F3000
+G1 X29.780 Y3.500 Z-4.3830 F3000
+G1 X29.760 Y3.500 Z-4.3718 F3000
+G1 X29.740 Y3.500 Z-4.3606 F3000
+G1 X29.720 Y3.500 Z-4.3495 F3000
+G1 X29.700 Y3.500 Z-4.3383 F3000
+G1 X29.680 Y3.500 Z-4.3272 F3000
+G1 X29.660 Y3.500 Z-4.3162 F3000
+G1 X29.640 Y3.500 Z-4.3051 F3000
+G1 X29.620 Y3.500 Z-4.2941 F3000
+G1 X29.600 Y3.500 Z-4.2832 F3000
+G1 X29.580 Y3.500 Z-4.2722 F3000
+G1 X29.560 Y3.500 Z-4.2613 F3000
+G1 X29.540 Y3.500 Z-4.2504 F3000
+G1 X29.520 Y3.500 Z-4.2395 F3000
+G1 X29.500 Y3.500 Z-4.2287 F3000
+G1 X29.480 Y3.500 Z-4.2179 F3000
+G1 X29.460 Y3.500 Z-4.2071 F3000
+G1 X29.440 Y3.500 Z-4.1964 F3000
+G1 X29.420 Y3.500 Z-4.1857 F3000
+G1 X29.400 Y3.500 Z-4.1750 F3000
+G1 X29.380 Y3.500 Z-4.1644 F3000
+G1 X29.360 Y3.500 Z-4.1537 F3000
+G1 X29.340 Y3.500 Z-4.1431 F3000
+G1 X29.320 Y3.500 Z-4.1326 F3000
+G1 X29.300 Y3.500 Z-4.1220 F3000
+G1 X29.280 Y3.500 Z-4.1115 F3000
+G1 X29.260 Y3.500 Z-4.1011 F3000
+G1 X29.240 Y3.500 Z-4.0906 F3000
+G1 X29.220 Y3.500 Z-4.0802 F3000
+G1 X29.200 Y3.500 Z-4.0698 F3000
+G1 X29.180 Y3.500 Z-4.0594 F3000
+G1 X29.160 Y3.500 Z-4.0491 F3000
+G1 X29.140 Y3.500 Z-4.0388 F3000
+G1 X29.120 Y3.500 Z-4.0285 F3000
+G1 X29.100 Y3.500 Z-4.0183 F3000
+G1 X29.080 Y3.500 Z-4.0080 F3000
+G1 X29.060 Y3.500 Z-3.9979 F3000
+G1 X29.040 Y3.500 Z-3.9877 F3000
+G1 X29.020 Y3.500 Z-3.9776 F3000
+G1 X29.000 Y3.500 Z-3.9674 F3000
+G1 X28.980 Y3.500 Z-3.9574 F3000
+G1 X28.960 Y3.500 Z-3.9473 F3000
+G1 X28.940 Y3.500 Z-3.9373 F3000
+G1 X28.920 Y3.500 Z-3.9273 F3000
+G1 X28.900 Y3.500 Z-3.9173 F3000
+G1 X28.880 Y3.500 Z-3.9074 F3000
+G1 X28.860 Y3.500 Z-3.8975 F3000
+G1 X28.840 Y3.500 Z-3.8876 F3000
+G1 X28.820 Y3.500 Z-3.8777 F3000
+G1 X28.800 Y3.500 Z-3.8679 F3000
+G1 X28.780 Y3.500 Z-3.8581 F3000
+G1 X28.760 Y3.500 Z-3.8483 F3000
+G1 X28.740 Y3.500 Z-3.8386 F3000
+G1 X28.720 Y3.500 Z-3.8289 F3000
+G1 X28.700 Y3.500 Z-3.8192 F3000
+G1 X28.680 Y3.500 Z-3.8095 F3000
+G1 X28.660 Y3.500 Z-3.7999 F3000
+G1 X28.640 Y3.500 Z-3.7903 F3000
+G1 X28.620 Y3.500 Z-3.7807 F3000
+G1 X28.600 Y3.500 Z-3.7711 F3000
+G1 X28.580 Y3.500 Z-3.7616 F3000
+G1 X28.560 Y3.500 Z-3.7521 F3000
+G1 X28.540 Y3.500 Z-3.7426 F3000
+G1 X28.520 Y3.500 Z-3.7332 F3000
+G1 X28.500 Y3.500 Z-3.7238 F3000
+G1 X28.480 Y3.500 Z-3.7144 F3000
+G1 X28.460 Y3.500 Z-3.7050 F3000
+G1 X28.440 Y3.500 Z-3.6957 F3000
+G1 X28.420 Y3.500 Z-3.6864 F3000
+G1 X28.400 Y3.500 Z-3.6771 F3000
+G1 X28.380 Y3.500 Z-3.6678 F3000
+G1 X28.360 Y3.500 Z-3.6586 F3000
+G1 X28.340 Y3.500 Z-3.6494 F3000
+G1 X28.320 Y3.500 Z-3.6402 F3000
+G1 X28.300 Y3.500 Z-3.6311 F3000
+G1 X28.280 Y3.500 Z-3.6219 F3000
+G1 X28.260 Y3.500 Z-3.6129 F3000
+G1 X28.240 Y3.500 Z-3.6038 F3000
+G1 X28.220 Y3.500 Z-3.5947 F3000
+G1 X28.200 Y3.500 Z-3.5857 F3000
+G1 X28.180 Y3.500 Z-3.5767 F3000
+G1 X28.160 Y3.500 Z-3.5678 F3000
+G1 X28.140 Y3.500 Z-3.5588 F3000
+G1 X28.120 Y3.500 Z-3.5499 F3000
+G1 X28.100 Y3.500 Z-3.5410 F3000
+G1 X28.080 Y3.500 Z-3.5322 F3000
+G1 X28.060 Y3.500 Z-3.5233 F3000
+G1 X28.040 Y3.500 Z-3.5145 F3000
+G1 X28.020 Y3.500 Z-3.5057 F3000
+G1 X28.000 Y3.500 Z-3.4970 F3000
+G1 X27.980 Y3.500 Z-3.4883 F3000
+G1 X27.960 Y3.500 Z-3.4796 F3000
+G1 X27.940 Y3.500 Z-3.4709 F3000
+G1 X27.920 Y3.500 Z-3.4622 F3000
+G1 X27.900 Y3.500 Z-3.4536 F3000
+G1 X27.880 Y3.500 Z-3.4450 F3000
+G1 X27.860 Y3.500 Z-3.4364 F3000
+G1 X27.840 Y3.500 Z-3.4279 F3000
+G1 X27.820 Y3.500 Z-3.4194 F3000
+G1 X27.800 Y3.500 Z-3.4109 F3000
+G1 X27.780 Y3.500 Z-3.4024 F3000
+G1 X27.760 Y3.500 Z-3.3940 F3000
+G1 X27.740 Y3.500 Z-3.3855 F3000
+G1 X27.720 Y3.500 Z-3.3771 F3000
+G1 X27.700 Y3.500 Z-3.3688 F3000
+G1 X27.680 Y3.500 Z-3.3604 F3000
+G1 X27.660 Y3.500 Z-3.3521 F3000
+G1 X27.640 Y3.500 Z-3.3438 F3000
+G1 X27.620 Y3.500 Z-3.3356 F3000
+G1 X27.600 Y3.500 Z-3.3273 F3000
+G1 X27.580 Y3.500 Z-3.3191 F3000
+G1 X27.560 Y3.500 Z-3.3109 F3000
+G1 X27.540 Y3.500 Z-3.3027 F3000
+G1 X27.520 Y3.500 Z-3.2946 F3000
+G1 X27.500 Y3.500 Z-3.2865 F3000
+G1 X27.480 Y3.500 Z-3.2784 F3000
+G1 X27.460 Y3.500 Z-3.2703 F3000
+G1 X27.440 Y3.500 Z-3.2623 F3000
+G1 X27.420 Y3.500 Z-3.2543 F3000
+G1 X27.400 Y3.500 Z-3.2463 F3000
+G1 X27.380 Y3.500 Z-3.2383 F3000
+G1 X27.360 Y3.500 Z-3.2304 F3000
+G1 X27.340 Y3.500 Z-3.2225 F3000
+G1 X27.320 Y3.500 Z-3.2146 F3000
+G1 X27.300 Y3.500 Z-3.2067 F3000
+G1 X27.280 Y3.500 Z-3.1989 F3000
+G1 X27.260 Y3.500 Z-3.1911 F3000
+G1 X27.240 Y3.500 Z-3.1833 F3000
+G1 X27.220 Y3.500 Z-3.1755 F3000
+G1 X27.200 Y3.500 Z-3.1678 F3000
+G1 X27.180 Y3.500 Z-3.1601 F3000
+G1 X27.160 Y3.500 Z-3.1524 F3000
+G1 X27.140 Y3.500 Z-3.1447 F3000
+G1 X27.120 Y3.500 Z-3.1371 F3000
+G1 X27.100 Y3.500 Z-3.1294 F3000
+G1 X27.080 Y3.500 Z-3.1218 F3000
+G1 X27.060 Y3.500 Z-3.1143 F3000
+G1 X27.040 Y3.500 Z-3.1067 F3000
+G1 X27.020 Y3.500 Z-3.0992 F3000
+G1 X27.000 Y3.500 Z-3.0917 F3000
+G1 X26.980 Y3.500 Z-3.0842 F3000
+G1 X26.960 Y3.500 Z-3.0768 F3000
+G1 X26.940 Y3.500 Z-3.0694 F3000
+G1 X26.920 Y3.500 Z-3.0620 F3000
+G1 X26.900 Y3.500 Z-3.0546 F3000
+G1 X26.880 Y3.500 Z-3.0473 F3000
+G1 X26.860 Y3.500 Z-3.0399 F3000
+G1 X26.840 Y3.500 Z-3.0326 F3000
+G1 X26.820 Y3.500 Z-3.0253 F3000
+G1 X26.800 Y3.500 Z-3.0181 F3000
+G1 X26.780 Y3.500 Z-3.0109 F3000
+G1 X26.760 Y3.500 Z-3.0037 F3000
+G1 X26.740 Y3.500 Z-2.9965 F3000
+G1 X26.720 Y3.500 Z-2.9893 F3000
+G1 X26.700 Y3.500 Z-2.9822 F3000
+G1 X26.680 Y3.500 Z-2.9751 F3000
+G1 X26.660 Y3.500 Z-2.9680 F3000
+G1 X26.640 Y3.500 Z-2.9609 F3000
+G1 X26.620 Y3.500 Z-2.9539 F3000
+G1 X26.600 Y3.500 Z-2.9469 F3000
+G1 X26.580 Y3.500 Z-2.9399 F3000
+G1 X26.560 Y3.500 Z-2.9329 F3000
+G1 X26.540 Y3.500 Z-2.9260 F3000
+G1 X26.520 Y3.500 Z-2.9191 F3000
+G1 X26.500 Y3.500 Z-2.9122 F3000
+G1 X26.480 Y3.500 Z-2.9053 F3000
+G1 X26.460 Y3.500 Z-2.8985 F3000
+G1 X26.440 Y3.500 Z-2.8916 F3000
+G1 X26.420 Y3.500 Z-2.8848 F3000
+G1 X26.400 Y3.500 Z-2.8781 F3000
+G1 X26.380 Y3.500 Z-2.8713 F3000
+G1 X26.360 Y3.500 Z-2.8646 F3000
+G1 X26.340 Y3.500 Z-2.8579 F3000
+G1 X26.320 Y3.500 Z-2.8512 F3000
+G1 X26.300 Y3.500 Z-2.8445 F3000
+G1 X26.280 Y3.500 Z-2.8379 F3000
+G1 X26.260 Y3.500 Z-2.8313 F3000
+G1 X26.240 Y3.500 Z-2.8247 F3000
+G1 X26.220 Y3.500 Z-2.8181 F3000
+G1 X26.200 Y3.500 Z-2.8116 F3000
+G1 X26.180 Y3.500 Z-2.8051 F3000
+G1 X26.160 Y3.500 Z-2.7986 F3000
+G1 X26.140 Y3.500 Z-2.7921 F3000
+G1 X26.120 Y3.500 Z-2.7856 F3000
+G1 X26.100 Y3.500 Z-2.7792 F3000
+G1 X26.080 Y3.500 Z-2.7728 F3000
+G1 X26.060 Y3.500 Z-2.7664 F3000
+G1 X26.040 Y3.500 Z-2.7601 F3000
+G1 X26.020 Y3.500 Z-2.7538 F3000
+G1 X26.000 Y3.500 Z-2.7474 F3000
+G1 X25.980 Y3.500 Z-2.7412 F3000
+G1 X25.960 Y3.500 Z-2.7349 F3000
+G1 X25.940 Y3.500 Z-2.7286 F3000
+G1 X25.920 Y3.500 Z-2.7224 F3000
+G1 X25.900 Y3.500 Z-2.7162 F3000
+G1 X25.880 Y3.500 Z-2.7101 F3000
+G1 X25.860 Y3.500 Z-2.7039 F3000
+G1 X25.840 Y3.500 Z-2.6978 F3000
+G1 X25.820 Y3.500 Z-2.6917 F3000
+G1 X25.800 Y3.500 Z-2.6856 F3000
+G1 X25.780 Y3.500 Z-2.6796 F3000
+G1 X25.760 Y3.500 Z-2.6735 F3000
+G1 X25.740 Y3.500 Z-2.6675 F3000
+G1 X25.720 Y3.500 Z-2.6615 F3000
+G1 X25.700 Y3.500 Z-2.6555 F3000
+G1 X25.680 Y3.500 Z-2.6496 F3000
+G1 X25.660 Y3.500 Z-2.6437 F3000
+G1 X25.640 Y3.500 Z-2.6378 F3000
+G1 X25.620 Y3.500 Z-2.6319 F3000
+G1 X25.600 Y3.500 Z-2.6261 F3000
+G1 X25.580 Y3.500 Z-2.6202 F3000
+G1 X25.560 Y3.500 Z-2.6144 F3000
+G1 X25.540 Y3.500 Z-2.6086 F3000
+G1 X25.520 Y3.500 Z-2.6029 F3000
+G1 X25.500 Y3.500 Z-2.5971 F3000
+G1 X25.480 Y3.500 Z-2.5914 F3000
+G1 X25.460 Y3.500 Z-2.5857 F3000
+G1 X25.440 Y3.500 Z-2.5801 F3000
+G1 X25.420 Y3.500 Z-2.5744 F3000
+G1 X25.400 Y3.500 Z-2.5688 F3000
+G1 X25.380 Y3.500 Z-2.5632 F3000
+G1 X25.360 Y3.500 Z-2.5576 F3000
+G1 X25.340 Y3.500 Z-2.5520 F3000
+G1 X25.320 Y3.500 Z-2.5465 F3000
+G1 X25.300 Y3.500 Z-2.5410 F3000
+G1 X25.280 Y3.500 Z-2.5355 F3000
+G1 X25.260 Y3.500 Z-2.5300 F3000
+G1 X25.240 Y3.500 Z-2.5246 F3000
+G1 X25.220 Y3.500 Z-2.5191 F3000
+G1 X25.200 Y3.500 Z-2.5137 F3000
+G1 X25.180 Y3.500 Z-2.5084 F3000
+G1 X25.160 Y3.500 Z-2.5030 F3000
+G1 X25.140 Y3.500 Z-2.4977 F3000
+G1 X25.120 Y3.500 Z-2.4923 F3000
+G1 X25.100 Y3.500 Z-2.4871 F3000
+G1 X25.080 Y3.500 Z-2.4818 F3000
+G1 X25.060 Y3.500 Z-2.4765 F3000
+G1 X25.040 Y3.500 Z-2.4713 F3000
+G1 X25.020 Y3.500 Z-2.4661 F3000
+G1 X25.000 Y3.500 Z-2.4609 F3000
+G1 X24.980 Y3.500 Z-2.4558 F3000
+G1 X24.960 Y3.500 Z-2.4506 F3000
+G1 X24.940 Y3.500 Z-2.4455 F3000
+G1 X24.920 Y3.500 Z-2.4404 F3000
+G1 X24.900 Y3.500 Z-2.4353 F3000
+G1 X24.880 Y3.500 Z-2.4303 F3000
+G1 X24.860 Y3.500 Z-2.4253 F3000
+G1 X24.840 Y3.500 Z-2.4203 F3000
+G1 X24.820 Y3.500 Z-2.4153 F3000
+G1 X24.800 Y3.500 Z-2.4103 F3000
+G1 X24.780 Y3.500 Z-2.4054 F3000
+G1 X24.760 Y3.500 Z-2.4005 F3000
+G1 X24.740 Y3.500 Z-2.3956 F3000
+G1 X24.720 Y3.500 Z-2.3907 F3000
+G1 X24.700 Y3.500 Z-2.3858 F3000
+G1 X24.680 Y3.500 Z-2.3810 F3000
+G1 X24.660 Y3.500 Z-2.3762 F3000
+G1 X24.640 Y3.500 Z-2.3714 F3000
+G1 X24.620 Y3.500 Z-2.3666 F3000
+G1 X24.600 Y3.500 Z-2.3619 F3000
+G1 X24.580 Y3.500 Z-2.3572 F3000
+G1 X24.560 Y3.500 Z-2.3525 F3000
+G1 X24.540 Y3.500 Z-2.3478 F3000
+G1 X24.520 Y3.500 Z-2.3431 F3000
+G1 X24.500 Y3.500 Z-2.3385 F3000
+G1 X24.480 Y3.500 Z-2.3339 F3000
+G1 X24.460 Y3.500 Z-2.3293 F3000
+G1 X24.440 Y3.500 Z-2.3247 F3000
+G1 X24.420 Y3.500 Z-2.3202 F3000
+G1 X24.400 Y3.500 Z-2.3156 F3000
+G1 X24.380 Y3.500 Z-2.3111 F3000
+G1 X24.360 Y3.500 Z-2.3067 F3000
+G1 X24.340 Y3.500 Z-2.3022 F3000
+G1 X24.320 Y3.500 Z-2.2978 F3000
+G1 X24.300 Y3.500 Z-2.2933 F3000
+G1 X24.280 Y3.500 Z-2.2889 F3000
+G1 X24.260 Y3.500 Z-2.2846 F3000
+G1 X24.240 Y3.500 Z-2.2802 F3000
+G1 X24.220 Y3.500 Z-2.2759 F3000
+G1 X24.200 Y3.500 Z-2.2716 F3000
+G1 X24.180 Y3.500 Z-2.2673 F3000
+G1 X24.160 Y3.500 Z-2.2630 F3000
+G1 X24.140 Y3.500 Z-2.2588 F3000
+G1 X24.120 Y3.500 Z-2.2545 F3000
+G1 X24.100 Y3.500 Z-2.2503 F3000
+G1 X24.080 Y3.500 Z-2.2461 F3000
+G1 X24.060 Y3.500 Z-2.2420 F3000
+G1 X24.040 Y3.500 Z-2.2378 F3000
+G1 X24.020 Y3.500 Z-2.2337 F3000
+G1 X24.000 Y3.500 Z-2.2296 F3000
+G1 X23.980 Y3.500 Z-2.2255 F3000
+G1 X23.960 Y3.500 Z-2.2215 F3000
+G1 X23.940 Y3.500 Z-2.2174 F3000
+G1 X23.920 Y3.500 Z-2.2134 F3000
+G1 X23.900 Y3.500 Z-2.2094 F3000
+G1 X23.880 Y3.500 Z-2.2055 F3000
+G1 X23.860 Y3.500 Z-2.2015 F3000
+G1 X23.840 Y3.500 Z-2.1976 F3000
+G1 X23.820 Y3.500 Z-2.1937 F3000
+G1 X23.800 Y3.500 Z-2.1898 F3000
+G1 X23.780 Y3.500 Z-2.1859 F3000
+G1 X23.760 Y3.500 Z-2.1821 F3000
+G1 X23.740 Y3.500 Z-2.1783 F3000
+G1 X23.720 Y3.500 Z-2.1745 F3000
+G1 X23.700 Y3.500 Z-2.1707 F3000
+G1 X23.680 Y3.500 Z-2.1669 F3000
+G1 X23.660 Y3.500 Z-2.1632 F3000
+G1 X23.640 Y3.500 Z-2.1595 F3000
+G1 X23.620 Y3.500 Z-2.1558 F3000
+G1 X23.600 Y3.500 Z-2.1521 F3000
+G1 X23.580 Y3.500 Z-2.1484 F3000
+G1 X23.560 Y3.500 Z-2.1448 F3000
+G1 X23.540 Y3.500 Z-2.1412 F3000
+G1 X23.520 Y3.500 Z-2.1376 F3000
+G1 X23.500 Y3.500 Z-2.1340 F3000
+G1 X23.480 Y3.500 Z-2.1305 F3000
+G1 X23.460 Y3.500 Z-2.1270 F3000
+G1 X23.440 Y3.500 Z-2.1235 F3000
+G1 X23.420 Y3.500 Z-2.1200 F3000
+G1 X23.400 Y3.500 Z-2.1165 F3000
+G1 X23.380 Y3.500 Z-2.1131 F3000
+G1 X23.360 Y3.500 Z-2.1096 F3000
+G1 X23.340 Y3.500 Z-2.1062 F3000
+G1 X23.320 Y3.500 Z-2.1029 F3000
+G1 X23.300 Y3.500 Z-2.0995 F3000
+G1 X23.280 Y3.500 Z-2.0962 F3000
+G1 X23.260 Y3.500 Z-2.0928 F3000
+G1 X23.240 Y3.500 Z-2.0895 F3000
+G1 X23.220 Y3.500 Z-2.0863 F3000
+G1 X23.200 Y3.500 Z-2.0830 F3000
+G1 X23.180 Y3.500 Z-2.0798 F3000
+G1 X23.160 Y3.500 Z-2.0766 F3000
+G1 X23.140 Y3.500 Z-2.0734 F3000
+G1 X23.120 Y3.500 Z-2.0702 F3000
+G1 X23.100 Y3.500 Z-2.0670 F3000
+G1 X23.080 Y3.500 Z-2.0639 F3000
+G1 X23.060 Y3.500 Z-2.0608 F3000
+G1 X23.040 Y3.500 Z-2.0577 F3000
+G1 X23.020 Y3.500 Z-2.0546 F3000
+G1 X23.000 Y3.500 Z-2.0516 F3000
+G1 X22.980 Y3.500 Z-2.0486 F3000
+G1 X22.960 Y3.500 Z-2.0455 F3000
+G1 X22.940 Y3.500 Z-2.0426 F3000
+G1 X22.920 Y3.500 Z-2.0396 F3000
+G1 X22.900 Y3.500 Z-2.0367 F3000
+G1 X22.880 Y3.500 Z-2.0337 F3000
+G1 X22.860 Y3.500 Z-2.0308 F3000
+G1 X22.840 Y3.500 Z-2.0279 F3000
+G1 X22.820 Y3.500 Z-2.0251 F3000
+G1 X22.800 Y3.500 Z-2.0222 F3000
+G1 X22.780 Y3.500 Z-2.0194 F3000
+G1 X22.760 Y3.500 Z-2.0166 F3000
+G1 X22.740 Y3.500 Z-2.0138 F3000
+G1 X22.720 Y3.500 Z-2.0111 F3000
+G1 X22.700 Y3.500 Z-2.0083 F3000
+G1 X22.680 Y3.500 Z-2.0056 F3000
+G1 X22.660 Y3.500 Z-2.0029 F3000
+G1 X22.640 Y3.500 Z-2.0002 F3000
+G1 X22.620 Y3.500 Z-1.9976 F3000
+G1 X22.600 Y3.500 Z-1.9950 F3000
+G1 X22.580 Y3.500 Z-1.9923 F3000
+G1 X22.560 Y3.500 Z-1.9897 F3000
+G1 X22.540 Y3.500 Z-1.9872 F3000
+G1 X22.520 Y3.500 Z-1.9846 F3000
+G1 X22.500 Y3.500 Z-1.9821 F3000
+G1 X22.480 Y3.500 Z-1.9796 F3000
+G1 X22.460 Y3.500 Z-1.9771 F3000
+G1 X22.440 Y3.500 Z-1.9746 F3000
+G1 X22.420 Y3.500 Z-1.9722 F3000
+G1 X22.400 Y3.500 Z-1.9697 F3000
+G1 X22.380 Y3.500 Z-1.9673 F3000
+G1 X22.360 Y3.500 Z-1.9649 F3000
+G1 X22.340 Y3.500 Z-1.9626 F3000
+G1 X22.320 Y3.500 Z-1.9602 F3000
+G1 X22.300 Y3.500 Z-1.9579 F3000
+G1 X22.280 Y3.500 Z-1.9556 F3000
+G1 X22.260 Y3.500 Z-1.9533 F3000
+G1 X22.240 Y3.500 Z-1.9510 F3000
+G1 X22.220 Y3.500 Z-1.9488 F3000
+G1 X22.200 Y3.500 Z-1.9465 F3000
+G1 X22.180 Y3.500 Z-1.9443 F3000
+G1 X22.160 Y3.500 Z-1.9421 F3000
+G1 X22.140 Y3.500 Z-1.9400 F3000
+G1 X22.120 Y3.500 Z-1.9378 F3000
+G1 X22.100 Y3.500 Z-1.9357 F3000
+G1 X22.080 Y3.500 Z-1.9336 F3000
+G1 X22.060 Y3.500 Z-1.9315 F3000
+G1 X22.040 Y3.500 Z-1.9295 F3000
+G1 X22.020 Y3.500 Z-1.9274 F3000
+G1 X22.000 Y3.500 Z-1.9254 F3000
+G1 X21.980 Y3.500 Z-1.9234 F3000
+G1 X21.960 Y3.500 Z-1.9214 F3000
+G1 X21.940 Y3.500 Z-1.9194 F3000
+G1 X21.920 Y3.500 Z-1.9175 F3000
+G1 X21.900 Y3.500 Z-1.9156 F3000
+G1 X21.880 Y3.500 Z-1.9137 F3000
+G1 X21.860 Y3.500 Z-1.9118 F3000
+G1 X21.840 Y3.500 Z-1.9099 F3000
+G1 X21.820 Y3.500 Z-1.9081 F3000
+G1 X21.800 Y3.500 Z-1.9063 F3000
+G1 X21.780 Y3.500 Z-1.9045 F3000
+G1 X21.760 Y3.500 Z-1.9027 F3000
+G1 X21.740 Y3.500 Z-1.9009 F3000
+G1 X21.720 Y3.500 Z-1.8992 F3000
+G1 X21.700 Y3.500 Z-1.8975 F3000
+G1 X21.680 Y3.500 Z-1.8958 F3000
+G1 X21.660 Y3.500 Z-1.8941 F3000
+G1 X21.640 Y3.500 Z-1.8925 F3000
+G1 X21.620 Y3.500 Z-1.8908 F3000
+G1 X21.600 Y3.500 Z-1.8892 F3000
+G1 X21.580 Y3.500 Z-1.8876 F3000
+G1 X21.560 Y3.500 Z-1.8860 F3000
+G1 X21.540 Y3.500 Z-1.8845 F3000
+G1 X21.520 Y3.500 Z-1.8829 F3000
+G1 X21.500 Y3.500 Z-1.8814 F3000
+G1 X21.480 Y3.500 Z-1.8799 F3000
+G1 X21.460 Y3.500 Z-1.8784 F3000
+G1 X21.440 Y3.500 Z-1.8770 F3000
+G1 X21.420 Y3.500 Z-1.8756 F3000
+G1 X21.400 Y3.500 Z-1.8741 F3000
+G1 X21.380 Y3.500 Z-1.8727 F3000
+G1 X21.360 Y3.500 Z-1.8714 F3000
+G1 X21.340 Y3.500 Z-1.8700 F3000
+G1 X21.320 Y3.500 Z-1.8687 F3000
+G1 X21.300 Y3.500 Z-1.8674 F3000
+G1 X21.280 Y3.500 Z-1.8661 F3000
+G1 X21.260 Y3.500 Z-1.8648 F3000
+G1 X21.240 Y3.500 Z-1.8635 F3000
+G1 X21.220 Y3.500 Z-1.8623 F3000
+G1 X21.200 Y3.500 Z-1.8611 F3000
+G1 X21.180 Y3.500 Z-1.8599 F3000
+G1 X21.160 Y3.500 Z-1.8587 F3000
+G1 X21.140 Y3.500 Z-1.8576 F3000
+G1 X21.120 Y3.500 Z-1.8564 F3000
+G1 X21.100 Y3.500 Z-1.8553 F3000
+G1 X21.080 Y3.500 Z-1.8542 F3000
+G1 X21.060 Y3.500 Z-1.8532 F3000
+G1 X21.040 Y3.500 Z-1.8521 F3000
+G1 X21.020 Y3.500 Z-1.8511 F3000
+G1 X21.000 Y3.500 Z-1.8501 F3000
+G1 X20.980 Y3.500 Z-1.8491 F3000
+G1 X20.960 Y3.500 Z-1.8481 F3000
+G1 X20.940 Y3.500 Z-1.8471 F3000
+G1 X20.920 Y3.500 Z-1.8462 F3000
+G1 X20.900 Y3.500 Z-1.8453 F3000
+G1 X20.880 Y3.500 Z-1.8444 F3000
+G1 X20.860 Y3.500 Z-1.8435 F3000
+G1 X20.840 Y3.500 Z-1.8427 F3000
+G1 X20.820 Y3.500 Z-1.8419 F3000
+G1 X20.800 Y3.500 Z-1.8410 F3000
+G1 X20.780 Y3.500 Z-1.8403 F3000
+G1 X20.760 Y3.500 Z-1.8395 F3000
+G1 X20.740 Y3.500 Z-1.8387 F3000
+G1 X20.720 Y3.500 Z-1.8380 F3000
+G1 X20.700 Y3.500 Z-1.8373 F3000
+G1 X20.680 Y3.500 Z-1.8366 F3000
+G1 X20.660 Y3.500 Z-1.8359 F3000
+G1 X20.640 Y3.500 Z-1.8353 F3000
+G1 X20.620 Y3.500 Z-1.8346 F3000
+G1 X20.600 Y3.500 Z-1.8340 F3000
+G1 X20.580 Y3.500 Z-1.8334 F3000
+G1 X20.560 Y3.500 Z-1.8329 F3000
+G1 X20.540 Y3.500 Z-1.8323 F3000
+G1 X20.520 Y3.500 Z-1.8318 F3000
+G1 X20.500 Y3.500 Z-1.8313 F3000
+G1 X20.480 Y3.500 Z-1.8308 F3000
+G1 X20.460 Y3.500 Z-1.8303 F3000
+G1 X20.440 Y3.500 Z-1.8299 F3000
+G1 X20.420 Y3.500 Z-1.8294 F3000
+G1 X20.400 Y3.500 Z-1.8290 F3000
+G1 X20.380 Y3.500 Z-1.8286 F3000
+G1 X20.360 Y3.500 Z-1.8283 F3000
+G1 X20.340 Y3.500 Z-1.8279 F3000
+G1 X20.320 Y3.500 Z-1.8276 F3000
+G1 X20.300 Y3.500 Z-1.8273 F3000
+G1 X20.280 Y3.500 Z-1.8270 F3000
+G1 X20.260 Y3.500 Z-1.8267 F3000
+G1 X20.240 Y3.500 Z-1.8265 F3000
+G1 X20.220 Y3.500 Z-1.8262 F3000
+G1 X20.200 Y3.500 Z-1.8260 F3000
+G1 X20.180 Y3.500 Z-1.8258 F3000
+G1 X20.160 Y3.500 Z-1.8257 F3000
+G1 X20.140 Y3.500 Z-1.8255 F3000
+G1 X20.120 Y3.500 Z-1.8254 F3000
+G1 X20.100 Y3.500 Z-1.8253 F3000
+G1 X20.080 Y3.500 Z-1.8252 F3000
+G1 X20.060 Y3.500 Z-1.8251 F3000
+G1 X20.040 Y3.500 Z-1.8251 F3000
+G1 X20.020 Y3.500 Z-1.8250 F3000
+G1 X20.000 Y3.500 Z-1.8250 F3000
+G1 X19.980 Y3.500 Z-1.8250 F3000
+G1 X19.960 Y3.500 Z-1.8251 F3000
+G1 X19.940 Y3.500 Z-1.8251 F3000
+G1 X19.920 Y3.500 Z-1.8252 F3000
+G1 X19.900 Y3.500 Z-1.8253 F3000
+G1 X19.880 Y3.500 Z-1.8254 F3000
+G1 X19.860 Y3.500 Z-1.8255 F3000
+G1 X19.840 Y3.500 Z-1.8257 F3000
+G1 X19.820 Y3.500 Z-1.8258 F3000
+G1 X19.800 Y3.500 Z-1.8260 F3000
+G1 X19.780 Y3.500 Z-1.8262 F3000
+G1 X19.760 Y3.500 Z-1.8265 F3000
+G1 X19.740 Y3.500 Z-1.8267 F3000
+G1 X19.720 Y3.500 Z-1.8270 F3000
+G1 X19.700 Y3.500 Z-1.8273 F3000
+G1 X19.680 Y3.500 Z-1.8276 F3000
+G1 X19.660 Y3.500 Z-1.8279 F3000
+G1 X19.640 Y3.500 Z-1.8283 F3000
+G1 X19.620 Y3.500 Z-1.8286 F3000
+G1 X19.600 Y3.500 Z-1.8290 F3000
+G1 X19.580 Y3.500 Z-1.8294 F3000
+G1 X19.560 Y3.500 Z-1.8299 F3000
+G1 X19.540 Y3.500 Z-1.8303 F3000
+G1 X19.520 Y3.500 Z-1.8308 F3000
+G1 X19.500 Y3.500 Z-1.8313 F3000
+G1 X19.480 Y3.500 Z-1.8318 F3000
+G1 X19.460 Y3.500 Z-1.8323 F3000
+G1 X19.440 Y3.500 Z-1.8329 F3000
+G1 X19.420 Y3.500 Z-1.8334 F3000
+G1 X19.400 Y3.500 Z-1.8340 F3000
+G1 X19.380 Y3.500 Z-1.8346 F3000
+G1 X19.360 Y3.500 Z-1.8353 F3000
+G1 X19.340 Y3.500 Z-1.8359 F3000
+G1 X19.320 Y3.500 Z-1.8366 F3000
+G1 X19.300 Y3.500 Z-1.8373 F3000
+G1 X19.280 Y3.500 Z-1.8380 F3000
+G1 X19.260 Y3.500 Z-1.8387 F3000
+G1 X19.240 Y3.500 Z-1.8395 F3000
+G1 X19.220 Y3.500 Z-1.8403 F3000
+G1 X19.200 Y3.500 Z-1.8410 F3000
+G1 X19.180 Y3.500 Z-1.8419 F3000
+G1 X19.160 Y3.500 Z-1.8427 F3000
+G1 X19.140 Y3.500 Z-1.8435 F3000
+G1 X19.120 Y3.500 Z-1.8444 F3000
+G1 X19.100 Y3.500 Z-1.8453 F3000
+G1 X19.080 Y3.500 Z-1.8462 F3000
+G1 X19.060 Y3.500 Z-1.8471 F3000
+G1 X19.040 Y3.500 Z-1.8481 F3000
+G1 X19.020 Y3.500 Z-1.8491 F3000
+G1 X19.000 Y3.500 Z-1.8501 F3000
+G1 X18.980 Y3.500 Z-1.8511 F3000
+G1 X18.960 Y3.500 Z-1.8521 F3000
+G1 X18.940 Y3.500 Z-1.8532 F3000
+G1 X18.920 Y3.500 Z-1.8542 F3000
+G1 X18.900 Y3.500 Z-1.8553 F3000
+G1 X18.880 Y3.500 Z-1.8564 F3000
+G1 X18.860 Y3.500 Z-1.8576 F3000
+G1 X18.840 Y3.500 Z-1.8587 F3000
+G1 X18.820 Y3.500 Z-1.8599 F3000
+G1 X18.800 Y3.500 Z-1.8611 F3000
+G1 X18.780 Y3.500 Z-1.8623 F3000
+G1 X18.760 Y3.500 Z-1.8635 F3000
+G1 X18.740 Y3.500 Z-1.8648 F3000
+G1 X18.720 Y3.500 Z-1.8661 F3000
+G1 X18.700 Y3.500 Z-1.8674 F3000
+G1 X18.680 Y3.500 Z-1.8687 F3000
+G1 X18.660 Y3.500 Z-1.8700 F3000
+G1 X18.640 Y3.500 Z-1.8714 F3000
+G1 X18.620 Y3.500 Z-1.8727 F3000
+G1 X18.600 Y3.500 Z-1.8741 F3000
+G1 X18.580 Y3.500 Z-1.8756 F3000
+G1 X18.560 Y3.500 Z-1.8770 F3000
+G1 X18.540 Y3.500 Z-1.8784 F3000
+G1 X18.520 Y3.500 Z-1.8799 F3000
+G1 X18.500 Y3.500 Z-1.8814 F3000
+G1 X18.480 Y3.500 Z-1.8829 F3000
+G1 X18.460 Y3.500 Z-1.8845 F3000
+G1 X18.440 Y3.500 Z-1.8860 F3000
+G1 X18.420 Y3.500 Z-1.8876 F3000
+G1 X18.400 Y3.500 Z-1.8892 F3000
+G1 X18.380 Y3.500 Z-1.8908 F3000
+G1 X18.360 Y3.500 Z-1.8925 F3000
+G1 X18.340 Y3.500 Z-1.8941 F3000
+G1 X18.320 Y3.500 Z-1.8958 F3000
+G1 X18.300 Y3.500 Z-1.8975 F3000
+G1 X18.280 Y3.500 Z-1.8992 F3000
+G1 X18.260 Y3.500 Z-1.9009 F3000
+G1 X18.240 Y3.500 Z-1.9027 F3000
+G1 X18.220 Y3.500 Z-1.9045 F3000
+G1 X18.200 Y3.500 Z-1.9063 F3000
+G1 X18.180 Y3.500 Z-1.9081 F3000
+G1 X18.160 Y3.500 Z-1.9099 F3000
+G1 X18.140 Y3.500 Z-1.9118 F3000
+G1 X18.120 Y3.500 Z-1.9137 F3000
+G1 X18.100 Y3.500 Z-1.9156 F3000
+G1 X18.080 Y3.500 Z-1.9175 F3000
+G1 X18.060 Y3.500 Z-1.9194 F3000
+G1 X18.040 Y3.500 Z-1.9214 F3000
+G1 X18.020 Y3.500 Z-1.9234 F3000
+G1 X18.000 Y3.500 Z-1.9254 F3000
+G1 X17.980 Y3.500 Z-1.9274 F3000
+G1 X17.960 Y3.500 Z-1.9295 F3000
+G1 X17.940 Y3.500 Z-1.9315 F3000
+G1 X17.920 Y3.500 Z-1.9336 F3000
+G1 X17.900 Y3.500 Z-1.9357 F3000
+G1 X17.880 Y3.500 Z-1.9378 F3000
+G1 X17.860 Y3.500 Z-1.9400 F3000
+G1 X17.840 Y3.500 Z-1.9421 F3000
+G1 X17.820 Y3.500 Z-1.9443 F3000
+G1 X17.800 Y3.500 Z-1.9465 F3000
+G1 X17.780 Y3.500 Z-1.9488 F3000
+G1 X17.760 Y3.500 Z-1.9510 F3000
+G1 X17.740 Y3.500 Z-1.9533 F3000
+G1 X17.720 Y3.500 Z-1.9556 F3000
+G1 X17.700 Y3.500 Z-1.9579 F3000
+G1 X17.680 Y3.500 Z-1.9602 F3000
+G1 X17.660 Y3.500 Z-1.9626 F3000
+G1 X17.640 Y3.500 Z-1.9649 F3000
+G1 X17.620 Y3.500 Z-1.9673 F3000
+G1 X17.600 Y3.500 Z-1.9697 F3000
+G1 X17.580 Y3.500 Z-1.9722 F3000
+G1 X17.560 Y3.500 Z-1.9746 F3000
+G1 X17.540 Y3.500 Z-1.9771 F3000
+G1 X17.520 Y3.500 Z-1.9796 F3000
+G1 X17.500 Y3.500 Z-1.9821 F3000
+G1 X17.480 Y3.500 Z-1.9846 F3000
+G1 X17.460 Y3.500 Z-1.9872 F3000
+G1 X17.440 Y3.500 Z-1.9897 F3000
+G1 X17.420 Y3.500 Z-1.9923 F3000
+G1 X17.400 Y3.500 Z-1.9950 F3000
+G1 X17.380 Y3.500 Z-1.9976 F3000
+G1 X17.360 Y3.500 Z-2.0002 F3000
+G1 X17.340 Y3.500 Z-2.0029 F3000
+G1 X17.320 Y3.500 Z-2.0056 F3000
+G1 X17.300 Y3.500 Z-2.0083 F3000
+G1 X17.280 Y3.500 Z-2.0111 F3000
+G1 X17.260 Y3.500 Z-2.0138 F3000
+G1 X17.240 Y3.500 Z-2.0166 F3000
+G1 X17.220 Y3.500 Z-2.0194 F3000
+G1 X17.200 Y3.500 Z-2.0222 F3000
+G1 X17.180 Y3.500 Z-2.0251 F3000
+G1 X17.160 Y3.500 Z-2.0279 F3000
+G1 X17.140 Y3.500 Z-2.0308 F3000
+G1 X17.120 Y3.500 Z-2.0337 F3000
+G1 X17.100 Y3.500 Z-2.0367 F3000
+G1 X17.080 Y3.500 Z-2.0396 F3000
+G1 X17.060 Y3.500 Z-2.0426 F3000
+G1 X17.040 Y3.500 Z-2.0455 F3000
+G1 X17.020 Y3.500 Z-2.0486 F3000
+G1 X17.000 Y3.500 Z-2.0516 F3000
+G1 X16.980 Y3.500 Z-2.0546 F3000
+G1 X16.960 Y3.500 Z-2.0577 F3000
+G1 X16.940 Y3.500 Z-2.0608 F3000
+G1 X16.920 Y3.500 Z-2.0639 F3000
+G1 X16.900 Y3.500 Z-2.0670 F3000
+G1 X16.880 Y3.500 Z-2.0702 F3000
+G1 X16.860 Y3.500 Z-2.0734 F3000
+G1 X16.840 Y3.500 Z-2.0766 F3000
+G1 X16.820 Y3.500 Z-2.0798 F3000
+G1 X16.800 Y3.500 Z-2.0830 F3000
+G1 X16.780 Y3.500 Z-2.0863 F3000
+G1 X16.760 Y3.500 Z-2.0895 F3000
+G1 X16.740 Y3.500 Z-2.0928 F3000
+G1 X16.720 Y3.500 Z-2.0962 F3000
+G1 X16.700 Y3.500 Z-2.0995 F3000
+G1 X16.680 Y3.500 Z-2.1029 F3000
+G1 X16.660 Y3.500 Z-2.1062 F3000
+G1 X16.640 Y3.500 Z-2.1096 F3000
+G1 X16.620 Y3.500 Z-2.1131 F3000
+G1 X16.600 Y3.500 Z-2.1165 F3000
+G1 X16.580 Y3.500 Z-2.1200 F3000
+G1 X16.560 Y3.500 Z-2.1235 F3000
+G1 X16.540 Y3.500 Z-2.1270 F3000
+G1 X16.520 Y3.500 Z-2.1305 F3000
+G1 X16.500 Y3.500 Z-2.1340 F3000
+G1 X16.480 Y3.500 Z-2.1376 F3000
+G1 X16.460 Y3.500 Z-2.1412 F3000
+G1 X16.440 Y3.500 Z-2.1448 F3000
+G1 X16.420 Y3.500 Z-2.1484 F3000
+G1 X16.400 Y3.500 Z-2.1521 F3000
+G1 X16.380 Y3.500 Z-2.1558 F3000
+G1 X16.360 Y3.500 Z-2.1595 F3000
+G1 X16.340 Y3.500 Z-2.1632 F3000
+G1 X16.320 Y3.500 Z-2.1669 F3000
+G1 X16.300 Y3.500 Z-2.1707 F3000
+G1 X16.280 Y3.500 Z-2.1745 F3000
+G1 X16.260 Y3.500 Z-2.1783 F3000
+G1 X16.240 Y3.500 Z-2.1821 F3000
+G1 X16.220 Y3.500 Z-2.1859 F3000
+G1 X16.200 Y3.500 Z-2.1898 F3000
+G1 X16.180 Y3.500 Z-2.1937 F3000
+G1 X16.160 Y3.500 Z-2.1976 F3000
+G1 X16.140 Y3.500 Z-2.2015 F3000
+G1 X16.120 Y3.500 Z-2.2055 F3000
+G1 X16.100 Y3.500 Z-2.2094 F3000
+G1 X16.080 Y3.500 Z-2.2134 F3000
+G1 X16.060 Y3.500 Z-2.2174 F3000
+G1 X16.040 Y3.500 Z-2.2215 F3000
+G1 X16.020 Y3.500 Z-2.2255 F3000
+G1 X16.000 Y3.500 Z-2.2296 F3000
+G1 X15.980 Y3.500 Z-2.2337 F3000
+G1 X15.960 Y3.500 Z-2.2378 F3000
+G1 X15.940 Y3.500 Z-2.2420 F3000
+G1 X15.920 Y3.500 Z-2.2461 F3000
+G1 X15.900 Y3.500 Z-2.2503 F3000
+G1 X15.880 Y3.500 Z-2.2545 F3000
+G1 X15.860 Y3.500 Z-2.2588 F3000
+G1 X15.840 Y3.500 Z-2.2630 F3000
+G1 X15.820 Y3.500 Z-2.2673 F3000
+G1 X15.800 Y3.500 Z-2.2716 F3000
+G1 X15.780 Y3.500 Z-2.2759 F3000
+G1 X15.760 Y3.500 Z-2.2802 F3000
+G1 X15.740 Y3.500 Z-2.2846 F3000
+G1 X15.720 Y3.500 Z-2.2889 F3000
+G1 X15.700 Y3.500 Z-2.2933 F3000
+G1 X15.680 Y3.500 Z-2.2978 F3000
+G1 X15.660 Y3.500 Z-2.3022 F3000
+G1 X15.640 Y3.500 Z-2.3067 F3000
+G1 X15.620 Y3.500 Z-2.3111 F3000
+G1 X15.600 Y3.500 Z-2.3156 F3000
+G1 X15.580 Y3.500 Z-2.3202 F3000
+G1 X15.560 Y3.500 Z-2.3247 F3000
+G1 X15.540 Y3.500 Z-2.3293 F3000
+G1 X15.520 Y3.500 Z-2.3339 F3000
+G1 X15.500 Y3.500 Z-2.3385 F3000
+G1 X15.480 Y3.500 Z-2.3431 F3000
+G1 X15.460 Y3.500 Z-2.3478 F3000
+G1 X15.440 Y3.500 Z-2.3525 F3000
+G1 X15.420 Y3.500 Z-2.3572 F3000
+G1 X15.400 Y3.500 Z-2.3619 F3000
+G1 X15.380 Y3.500 Z-2.3666 F3000
+G1 X15.360 Y3.500 Z-2.3714 F3000
+G1 X15.340 Y3.500 Z-2.3762 F3000
+G1 X15.320 Y3.500 Z-2.3810 F3000
+G1 X15.300 Y3.500 Z-2.3858 F3000
+G1 X15.280 Y3.500 Z-2.3907 F3000
+G1 X15.260 Y3.500 Z-2.3956 F3000
+G1 X15.240 Y3.500 Z-2.4005 F3000
+G1 X15.220 Y3.500 Z-2.4054 F3000
+G1 X15.200 Y3.500 Z-2.4103 F3000
+G1 X15.180 Y3.500 Z-2.4153 F3000
+G1 X15.160 Y3.500 Z-2.4203 F3000
+G1 X15.140 Y3.500 Z-2.4253 F3000
+G1 X15.120 Y3.500 Z-2.4303 F3000
+G1 X15.100 Y3.500 Z-2.4353 F3000
+G1 X15.080 Y3.500 Z-2.4404 F3000
+G1 X15.060 Y3.500 Z-2.4455 F3000
+G1 X15.040 Y3.500 Z-2.4506 F3000
+G1 X15.020 Y3.500 Z-2.4558 F3000
+G1 X15.000 Y3.500 Z-2.4609 F3000
+G1 X14.980 Y3.500 Z-2.4661 F3000
+G1 X14.960 Y3.500 Z-2.4713 F3000
+G1 X14.940 Y3.500 Z-2.4765 F3000
+G1 X14.920 Y3.500 Z-2.4818 F3000
+G1 X14.900 Y3.500 Z-2.4871 F3000
+G1 X14.880 Y3.500 Z-2.4923 F3000
+G1 X14.860 Y3.500 Z-2.4977 F3000
+G1 X14.840 Y3.500 Z-2.5030 F3000
+G1 X14.820 Y3.500 Z-2.5084 F3000
+G1 X14.800 Y3.500 Z-2.5137 F3000
+G1 X14.780 Y3.500 Z-2.5191 F3000
+G1 X14.760 Y3.500 Z-2.5246 F3000
+G1 X14.740 Y3.500 Z-2.5300 F3000
+G1 X14.720 Y3.500 Z-2.5355 F3000
+G1 X14.700 Y3.500 Z-2.5410 F3000
+G1 X14.680 Y3.500 Z-2.5465 F3000
+G1 X14.660 Y3.500 Z-2.5520 F3000
+G1 X14.640 Y3.500 Z-2.5576 F3000
+G1 X14.620 Y3.500 Z-2.5632 F3000
+G1 X14.600 Y3.500 Z-2.5688 F3000
+G1 X14.580 Y3.500 Z-2.5744 F3000
+G1 X14.560 Y3.500 Z-2.5801 F3000
+G1 X14.540 Y3.500 Z-2.5857 F3000
+G1 X14.520 Y3.500 Z-2.5914 F3000
+G1 X14.500 Y3.500 Z-2.5971 F3000
+G1 X14.480 Y3.500 Z-2.6029 F3000
+G1 X14.460 Y3.500 Z-2.6086 F3000
+G1 X14.440 Y3.500 Z-2.6144 F3000
+G1 X14.420 Y3.500 Z-2.6202 F3000
+G1 X14.400 Y3.500 Z-2.6261 F3000
+G1 X14.380 Y3.500 Z-2.6319 F3000
+G1 X14.360 Y3.500 Z-2.6378 F3000
+G1 X14.340 Y3.500 Z-2.6437 F3000
+G1 X14.320 Y3.500 Z-2.6496 F3000
+G1 X14.300 Y3.500 Z-2.6555 F3000
+G1 X14.280 Y3.500 Z-2.6615 F3000
+G1 X14.260 Y3.500 Z-2.6675 F3000
+G1 X14.240 Y3.500 Z-2.6735 F3000
+G1 X14.220 Y3.500 Z-2.6796 F3000
+G1 X14.200 Y3.500 Z-2.6856 F3000
+G1 X14.180 Y3.500 Z-2.6917 F3000
+G1 X14.160 Y3.500 Z-2.6978 F3000
+G1 X14.140 Y3.500 Z-2.7039 F3000
+G1 X14.120 Y3.500 Z-2.7101 F3000
+G1 X14.100 Y3.500 Z-2.7162 F3000
+G1 X14.080 Y3.500 Z-2.7224 F3000
+G1 X14.060 Y3.500 Z-2.7286 F3000
+G1 X14.040 Y3.500 Z-2.7349 F3000
+G1 X14.020 Y3.500 Z-2.7412 F3000
+G1 X14.000 Y3.500 Z-2.7474 F3000
+G1 X13.980 Y3.500 Z-2.7538 F3000
+G1 X13.960 Y3.500 Z-2.7601 F3000
+G1 X13.940 Y3.500 Z-2.7664 F3000
+G1 X13.920 Y3.500 Z-2.7728 F3000
+G1 X13.900 Y3.500 Z-2.7792 F3000
+G1 X13.880 Y3.500 Z-2.7856 F3000
+G1 X13.860 Y3.500 Z-2.7921 F3000
+G1 X13.840 Y3.500 Z-2.7986 F3000
+G1 X13.820 Y3.500 Z-2.8051 F3000
+G1 X13.800 Y3.500 Z-2.8116 F3000
+G1 X13.780 Y3.500 Z-2.8181 F3000
+G1 X13.760 Y3.500 Z-2.8247 F3000
+G1 X13.740 Y3.500 Z-2.8313 F3000
+G1 X13.720 Y3.500 Z-2.8379 F3000
+G1 X13.700 Y3.500 Z-2.8445 F3000
+G1 X13.680 Y3.500 Z-2.8512 F3000
+G1 X13.660 Y3.500 Z-2.8579 F3000
+G1 X13.640 Y3.500 Z-2.8646 F3000
+G1 X13.620 Y3.500 Z-2.8713 F3000
+G1 X13.600 Y3.500 Z-2.8781 F3000
+G1 X13.580 Y3.500 Z-2.8848 F3000
+G1 X13.560 Y3.500 Z-2.8916 F3000
+G1 X13.540 Y3.500 Z-2.8985 F3000
+G1 X13.520 Y3.500 Z-2.9053 F3000
+G1 X13.500 Y3.500 Z-2.9122 F3000
+G1 X13.480 Y3.500 Z-2.9191 F3000
+G1 X13.460 Y3.500 Z-2.9260 F3000
+G1 X13.440 Y3.500 Z-2.9329 F3000
+G1 X13.420 Y3.500 Z-2.9399 F3000
+G1 X13.400 Y3.500 Z-2.9469 F3000
+G1 X13.380 Y3.500 Z-2.9539 F3000
+G1 X13.360 Y3.500 Z-2.9609 F3000
+G1 X13.340 Y3.500 Z-2.9680 F3000
+G1 X13.320 Y3.500 Z-2.9751 F3000
+G1 X13.300 Y3.500 Z-2.9822 F3000
+G1 X13.280 Y3.500 Z-2.9893 F3000
+G1 X13.260 Y3.500 Z-2.9965 F3000
+G1 X13.240 Y3.500 Z-3.0037 F3000
+G1 X13.220 Y3.500 Z-3.0109 F3000
+G1 X13.200 Y3.500 Z-3.0181 F3000
+G1 X13.180 Y3.500 Z-3.0253 F3000
+G1 X13.160 Y3.500 Z-3.0326 F3000
+G1 X13.140 Y3.500 Z-3.0399 F3000
+G1 X13.120 Y3.500 Z-3.0473 F3000
+G1 X13.100 Y3.500 Z-3.0546 F3000
+G1 X13.080 Y3.500 Z-3.0620 F3000
+G1 X13.060 Y3.500 Z-3.0694 F3000
+G1 X13.040 Y3.500 Z-3.0768 F3000
+G1 X13.020 Y3.500 Z-3.0842 F3000
+G1 X13.000 Y3.500 Z-3.0917 F3000
+G1 X12.980 Y3.500 Z-3.0992 F3000
+G1 X12.960 Y3.500 Z-3.1067 F3000
+G1 X12.940 Y3.500 Z-3.1143 F3000
+G1 X12.920 Y3.500 Z-3.1218 F3000
+G1 X12.900 Y3.500 Z-3.1294 F3000
+G1 X12.880 Y3.500 Z-3.1371 F3000
+G1 X12.860 Y3.500 Z-3.1447 F3000
+G1 X12.840 Y3.500 Z-3.1524 F3000
+G1 X12.820 Y3.500 Z-3.1601 F3000
+G1 X12.800 Y3.500 Z-3.1678 F3000
+G1 X12.780 Y3.500 Z-3.1755 F3000
+G1 X12.760 Y3.500 Z-3.1833 F3000
+G1 X12.740 Y3.500 Z-3.1911 F3000
+G1 X12.720 Y3.500 Z-3.1989 F3000
+G1 X12.700 Y3.500 Z-3.2067 F3000
+G1 X12.680 Y3.500 Z-3.2146 F3000
+G1 X12.660 Y3.500 Z-3.2225 F3000
+G1 X12.640 Y3.500 Z-3.2304 F3000
+G1 X12.620 Y3.500 Z-3.2383 F3000
+G1 X12.600 Y3.500 Z-3.2463 F3000
+G1 X12.580 Y3.500 Z-3.2543 F3000
+G1 X12.560 Y3.500 Z-3.2623 F3000
+G1 X12.540 Y3.500 Z-3.2703 F3000
+G1 X12.520 Y3.500 Z-3.2784 F3000
+G1 X12.500 Y3.500 Z-3.2865 F3000
+G1 X12.480 Y3.500 Z-3.2946 F3000
+G1 X12.460 Y3.500 Z-3.3027 F3000
+G1 X12.440 Y3.500 Z-3.3109 F3000
+G1 X12.420 Y3.500 Z-3.3191 F3000
+G1 X12.400 Y3.500 Z-3.3273 F3000
+G1 X12.380 Y3.500 Z-3.3356 F3000
+G1 X12.360 Y3.500 Z-3.3438 F3000
+G1 X12.340 Y3.500 Z-3.3521 F3000
+G1 X12.320 Y3.500 Z-3.3604 F3000
+G1 X12.300 Y3.500 Z-3.3688 F3000
+G1 X12.280 Y3.500 Z-3.3771 F3000
+G1 X12.260 Y3.500 Z-3.3855 F3000
+G1 X12.240 Y3.500 Z-3.3940 F3000
+G1 X12.220 Y3.500 Z-3.4024 F3000
+G1 X12.200 Y3.500 Z-3.4109 F3000
+G1 X12.180 Y3.500 Z-3.4194 F3000
+G1 X12.160 Y3.500 Z-3.4279 F3000
+G1 X12.140 Y3.500 Z-3.4364 F3000
+G1 X12.120 Y3.500 Z-3.4450 F3000
+G1 X12.100 Y3.500 Z-3.4536 F3000
+G1 X12.080 Y3.500 Z-3.4622 F3000
+G1 X12.060 Y3.500 Z-3.4709 F3000
+G1 X12.040 Y3.500 Z-3.4796 F3000
+G1 X12.020 Y3.500 Z-3.4883 F3000
+G1 X12.000 Y3.500 Z-3.4970 F3000
+G1 X11.980 Y3.500 Z-3.5057 F3000
+G1 X11.960 Y3.500 Z-3.5145 F3000
+G1 X11.940 Y3.500 Z-3.5233 F3000
+G1 X11.920 Y3.500 Z-3.5322 F3000
+G1 X11.900 Y3.500 Z-3.5410 F3000
+G1 X11.880 Y3.500 Z-3.5499 F3000
+G1 X11.860 Y3.500 Z-3.5588 F3000
+G1 X11.840 Y3.500 Z-3.5678 F3000
+G1 X11.820 Y3.500 Z-3.5767 F3000
+G1 X11.800 Y3.500 Z-3.5857 F3000
+G1 X11.780 Y3.500 Z-3.5947 F3000
+G1 X11.760 Y3.500 Z-3.6038 F3000
+G1 X11.740 Y3.500 Z-3.6129 F3000
+G1 X11.720 Y3.500 Z-3.6219 F3000
+G1 X11.700 Y3.500 Z-3.6311 F3000
+G1 X11.680 Y3.500 Z-3.6402 F3000
+G1 X11.660 Y3.500 Z-3.6494 F3000
+G1 X11.640 Y3.500 Z-3.6586 F3000
+G1 X11.620 Y3.500 Z-3.6678 F3000
+G1 X11.600 Y3.500 Z-3.6771 F3000
+G1 X11.580 Y3.500 Z-3.6864 F3000
+G1 X11.560 Y3.500 Z-3.6957 F3000
+G1 X11.540 Y3.500 Z-3.7050 F3000
+G1 X11.520 Y3.500 Z-3.7144 F3000
+G1 X11.500 Y3.500 Z-3.7238 F3000
+G1 X11.480 Y3.500 Z-3.7332 F3000
+G1 X11.460 Y3.500 Z-3.7426 F3000
+G1 X11.440 Y3.500 Z-3.7521 F3000
+G1 X11.420 Y3.500 Z-3.7616 F3000
+G1 X11.400 Y3.500 Z-3.7711 F3000
+G1 X11.380 Y3.500 Z-3.7807 F3000
+G1 X11.360 Y3.500 Z-3.7903 F3000
+G1 X11.340 Y3.500 Z-3.7999 F3000
+G1 X11.320 Y3.500 Z-3.8095 F3000
+G1 X11.300 Y3.500 Z-3.8192 F3000
+G1 X11.280 Y3.500 Z-3.8289 F3000
+G1 X11.260 Y3.500 Z-3.8386 F3000
+G1 X11.240 Y3.500 Z-3.8483 F3000
+G1 X11.220 Y3.500 Z-3.8581 F3000
+G1 X11.200 Y3.500 Z-3.8679 F3000
+G1 X11.180 Y3.500 Z-3.8777 F3000
+G1 X11.160 Y3.500 Z-3.8876 F3000
+G1 X11.140 Y3.500 Z-3.8975 F3000
+G1 X11.120 Y3.500 Z-3.9074 F3000
+G1 X11.100 Y3.500 Z-3.9173 F3000
+G1 X11.080 Y3.500 Z-3.9273 F3000
+G1 X11.060 Y3.500 Z-3.9373 F3000
+G1 X11.040 Y3.500 Z-3.9473 F3000
+G1 X11.020 Y3.500 Z-3.9574 F3000
+G1 X11.000 Y3.500 Z-3.9674 F3000
+G1 X10.980 Y3.500 Z-3.9776 F3000
+G1 X10.960 Y3.500 Z-3.9877 F3000
+G1 X10.940 Y3.500 Z-3.9979 F3000
+G1 X10.920 Y3.500 Z-4.0080 F3000
+G1 X10.900 Y3.500 Z-4.0183 F3000
+G1 X10.880 Y3.500 Z-4.0285 F3000
+G1 X10.860 Y3.500 Z-4.0388 F3000
+G1 X10.840 Y3.500 Z-4.0491 F3000
+G1 X10.820 Y3.500 Z-4.0594 F3000
+G1 X10.800 Y3.500 Z-4.0698 F3000
+G1 X10.780 Y3.500 Z-4.0802 F3000
+G1 X10.760 Y3.500 Z-4.0906 F3000
+G1 X10.740 Y3.500 Z-4.1011 F3000
+G1 X10.720 Y3.500 Z-4.1115 F3000
+G1 X10.700 Y3.500 Z-4.1220 F3000
+G1 X10.680 Y3.500 Z-4.1326 F3000
+G1 X10.660 Y3.500 Z-4.1431 F3000
+G1 X10.640 Y3.500 Z-4.1537 F3000
+G1 X10.620 Y3.500 Z-4.1644 F3000
+G1 X10.600 Y3.500 Z-4.1750 F3000
+G1 X10.580 Y3.500 Z-4.1857 F3000
+G1 X10.560 Y3.500 Z-4.1964 F3000
+G1 X10.540 Y3.500 Z-4.2071 F3000
+G1 X10.520 Y3.500 Z-4.2179 F3000
+G1 X10.500 Y3.500 Z-4.2287 F3000
+G1 X10.480 Y3.500 Z-4.2395 F3000
+G1 X10.460 Y3.500 Z-4.2504 F3000
+G1 X10.440 Y3.500 Z-4.2613 F3000
+G1 X10.420 Y3.500 Z-4.2722 F3000
+G1 X10.400 Y3.500 Z-4.2832 F3000
+G1 X10.380 Y3.500 Z-4.2941 F3000
+G1 X10.360 Y3.500 Z-4.3051 F3000
+G1 X10.340 Y3.500 Z-4.3162 F3000
+G1 X10.320 Y3.500 Z-4.3272 F3000
+G1 X10.300 Y3.500 Z-4.3383 F3000
+G1 X10.280 Y3.500 Z-4.3495 F3000
+G1 X10.260 Y3.500 Z-4.3606 F3000
+G1 X10.240 Y3.500 Z-4.3718 F3000
+G1 X10.220 Y3.500 Z-4.3830 F3000
+G1 X10.200 Y3.500 Z-4.3943 F3000
+G1 X10.180 Y3.500 Z-4.4055 F3000
+G1 X10.160 Y3.500 Z-4.4168 F3000
+G1 X10.140 Y3.500 Z-4.4282 F3000
+G1 X10.120 Y3.500 Z-4.4395 F3000
+G1 X10.100 Y3.500 Z-4.4509 F3000
+G1 X10.080 Y3.500 Z-4.4624 F3000
+G1 X10.060 Y3.500 Z-4.4738 F3000
+G1 X10.040 Y3.500 Z-4.4853 F3000
+G1 X10.020 Y3.500 Z-4.4968 F3000
+G1 X10.000 Y3.500 Z-4.5084 F3000
+G1 X9.980 Y3.500 Z-4.5200 F3000
+G1 X9.960 Y3.500 Z-4.5316 F3000
+G1 X9.940 Y3.500 Z-4.5432 F3000
+G1 X9.920 Y3.500 Z-4.5549 F3000
+G1 X9.900 Y3.500 Z-4.5666 F3000
+G1 X9.880 Y3.500 Z-4.5783 F3000
+G1 X9.860 Y3.500 Z-4.5901 F3000
+G1 X9.840 Y3.500 Z-4.6019 F3000
+G1 X9.820 Y3.500 Z-4.6137 F3000
+G1 X9.800 Y3.500 Z-4.6256 F3000
+G1 X9.780 Y3.500 Z-4.6375 F3000
+G1 X9.760 Y3.500 Z-4.6494 F3000
+G1 X9.740 Y3.500 Z-4.6614 F3000
+G1 X9.720 Y3.500 Z-4.6734 F3000
+G1 X9.700 Y3.500 Z-4.6854 F3000
+G1 X9.680 Y3.500 Z-4.6974 F3000
+G1 X9.660 Y3.500 Z-4.7095 F3000
+G1 X9.640 Y3.500 Z-4.7216 F3000
+G1 X9.620 Y3.500 Z-4.7338 F3000
+G1 X9.600 Y3.500 Z-4.7460 F3000
+G1 X9.580 Y3.500 Z-4.7582 F3000
+G1 X9.560 Y3.500 Z-4.7704 F3000
+G1 X9.540 Y3.500 Z-4.7827 F3000
+G1 X9.520 Y3.500 Z-4.7950 F3000
+G1 X9.500 Y3.500 Z-4.8074 F3000
+G1 X9.480 Y3.500 Z-4.8197 F3000
+G1 X9.460 Y3.500 Z-4.8321 F3000
+G1 X9.440 Y3.500 Z-4.8446 F3000
+G1 X9.420 Y3.500 Z-4.8570 F3000
+G1 X9.400 Y3.500 Z-4.8696 F3000
+G1 X9.380 Y3.500 Z-4.8821 F3000
+G1 X9.360 Y3.500 Z-4.8947 F3000
+G1 X9.340 Y3.500 Z-4.9073 F3000
+G1 X9.320 Y3.500 Z-4.9199 F3000
+G1 X9.300 Y3.500 Z-4.9326 F3000
+G1 X9.280 Y3.500 Z-4.9453 F3000
+G1 X9.260 Y3.500 Z-4.9580 F3000
+G1 X9.240 Y3.500 Z-4.9708 F3000
+G1 X9.220 Y3.500 Z-4.9836 F3000
+G1 X9.200 Y3.500 Z-4.9964 F3000
+G1 X9.180 Y3.500 Z-5.0093 F3000
+G1 X9.160 Y3.500 Z-5.0222 F3000
+G1 X9.140 Y3.500 Z-5.0351 F3000
+G1 X9.120 Y3.500 Z-5.0481 F3000
+G1 X9.100 Y3.500 Z-5.0611 F3000
+G1 X9.080 Y3.500 Z-5.0742 F3000
+G1 X9.060 Y3.500 Z-5.0872 F3000
+G1 X9.040 Y3.500 Z-5.1003 F3000
+G1 X9.020 Y3.500 Z-5.1135 F3000
+G1 X9.000 Y3.500 Z-5.1267 F3000
+G1 X8.980 Y3.500 Z-5.1399 F3000
+G1 X8.960 Y3.500 Z-5.1531 F3000
+G1 X8.940 Y3.500 Z-5.1664 F3000
+G1 X8.920 Y3.500 Z-5.1797 F3000
+G1 X8.900 Y3.500 Z-5.1931 F3000
+G1 X8.880 Y3.500 Z-5.2065 F3000
+G1 X8.860 Y3.500 Z-5.2199 F3000
+G1 X8.840 Y3.500 Z-5.2333 F3000
+G1 X8.820 Y3.500 Z-5.2468 F3000
+G1 X8.800 Y3.500 Z-5.2604 F3000
+G1 X8.780 Y3.500 Z-5.2739 F3000
+G1 X8.760 Y3.500 Z-5.2875 F3000
+G1 X8.740 Y3.500 Z-5.3011 F3000
+G1 X8.720 Y3.500 Z-5.3148 F3000
+G1 X8.700 Y3.500 Z-5.3285 F3000
+G1 X8.680 Y3.500 Z-5.3422 F3000
+G1 X8.660 Y3.500 Z-5.3560 F3000
+G1 X8.640 Y3.500 Z-5.3698 F3000
+G1 X8.620 Y3.500 Z-5.3837 F3000
+G1 X8.600 Y3.500 Z-5.3976 F3000
+G1 X8.580 Y3.500 Z-5.4115 F3000
+G1 X8.560 Y3.500 Z-5.4254 F3000
+G1 X8.540 Y3.500 Z-5.4394 F3000
+G1 X8.520 Y3.500 Z-5.4535 F3000
+G1 X8.500 Y3.500 Z-5.4675 F3000
+G1 X8.480 Y3.500 Z-5.4816 F3000
+G1 X8.460 Y3.500 Z-5.4958 F3000
+G1 X8.440 Y3.500 Z-5.5099 F3000
+G1 X8.420 Y3.500 Z-5.5241 F3000
+G1 X8.400 Y3.500 Z-5.5384 F3000
+G1 X8.380 Y3.500 Z-5.5527 F3000
+G1 X8.360 Y3.500 Z-5.5670 F3000
+G1 X8.340 Y3.500 Z-5.5814 F3000
+G1 X8.320 Y3.500 Z-5.5958 F3000
+G1 X8.300 Y3.500 Z-5.6102 F3000
+G1 X8.280 Y3.500 Z-5.6247 F3000
+G1 X8.260 Y3.500 Z-5.6392 F3000
+G1 X8.240 Y3.500 Z-5.6537 F3000
+G1 X8.220 Y3.500 Z-5.6683 F3000
+G1 X8.200 Y3.500 Z-5.6829 F3000
+G1 X8.180 Y3.500 Z-5.6976 F3000
+G1 X8.160 Y3.500 Z-5.7123 F3000
+G1 X8.140 Y3.500 Z-5.7270 F3000
+G1 X8.120 Y3.500 Z-5.7418 F3000
+G1 X8.100 Y3.500 Z-5.7566 F3000
+G1 X8.080 Y3.500 Z-5.7715 F3000
+G1 X8.060 Y3.500 Z-5.7864 F3000
+G1 X8.040 Y3.500 Z-5.8013 F3000
+G1 X8.020 Y3.500 Z-5.8163 F3000
+G1 X8.000 Y3.500 Z-5.8313 F3000
+G1 X7.980 Y3.500 Z-5.8463 F3000
+G1 X7.960 Y3.500 Z-5.8614 F3000
+G1 X7.940 Y3.500 Z-5.8765 F3000
+G1 X7.920 Y3.500 Z-5.8917 F3000
+G1 X7.900 Y3.500 Z-5.9069 F3000
+G1 X7.880 Y3.500 Z-5.9222 F3000
+G1 X7.860 Y3.500 Z-5.9375 F3000
+G1 X7.840 Y3.500 Z-5.9528 F3000
+G1 X7.820 Y3.500 Z-5.9681 F3000
+G1 X7.800 Y3.500 Z-5.9836 F3000
+G1 X7.780 Y3.500 Z-5.9990 F3000
+G1 X7.760 Y3.500 Z-6.0145 F3000
+G1 X7.740 Y3.500 Z-6.0300 F3000
+G1 X7.720 Y3.500 Z-6.0456 F3000
+G1 X7.700 Y3.500 Z-6.0612 F3000
+G1 X7.680 Y3.500 Z-6.0768 F3000
+G1 X7.660 Y3.500 Z-6.0925 F3000
+G1 X7.640 Y3.500 Z-6.1083 F3000
+G1 X7.620 Y3.500 Z-6.1240 F3000
+G1 X7.600 Y3.500 Z-6.1399 F3000
+G1 X7.580 Y3.500 Z-6.1557 F3000
+G1 X7.560 Y3.500 Z-6.1716 F3000
+G1 X7.540 Y3.500 Z-6.1876 F3000
+G1 X7.520 Y3.500 Z-6.2035 F3000
+G1 X7.500 Y3.500 Z-6.2196 F3000
+G1 X7.480 Y3.500 Z-6.2356 F3000
+G1 X7.460 Y3.500 Z-6.2517 F3000
+G1 X7.440 Y3.500 Z-6.2679 F3000
+G1 X7.420 Y3.500 Z-6.2841 F3000
+G1 X7.400 Y3.500 Z-6.3003 F3000
+G1 X7.380 Y3.500 Z-6.3166 F3000
+G1 X7.360 Y3.500 Z-6.3329 F3000
+G1 X7.340 Y3.500 Z-6.3493 F3000
+G1 X7.320 Y3.500 Z-6.3657 F3000
+G1 X7.300 Y3.500 Z-6.3822 F3000
+G1 X7.280 Y3.500 Z-6.3986 F3000
+G1 X7.260 Y3.500 Z-6.4152 F3000
+G1 X7.240 Y3.500 Z-6.4318 F3000
+G1 X7.220 Y3.500 Z-6.4484 F3000
+G1 X7.200 Y3.500 Z-6.4651 F3000
+G1 X7.180 Y3.500 Z-6.4818 F3000
+G1 X7.160 Y3.500 Z-6.4985 F3000
+G1 X7.140 Y3.500 Z-6.5154 F3000
+G1 X7.120 Y3.500 Z-6.5322 F3000
+G1 X7.100 Y3.500 Z-6.5491 F3000
+G1 X7.080 Y3.500 Z-6.5660 F3000
+G1 X7.060 Y3.500 Z-6.5830 F3000
+G1 X7.040 Y3.500 Z-6.6001 F3000
+G1 X7.020 Y3.500 Z-6.6171 F3000
+G1 X7.000 Y3.500 Z-6.6342 F3000
+G1 X6.980 Y3.500 Z-6.6514 F3000
+G1 X6.960 Y3.500 Z-6.6686 F3000
+G1 X6.940 Y3.500 Z-6.6859 F3000
+G1 X6.920 Y3.500 Z-6.7032 F3000
+G1 X6.900 Y3.500 Z-6.7205 F3000
+G1 X6.880 Y3.500 Z-6.7379 F3000
+G1 X6.860 Y3.500 Z-6.7554 F3000
+G1 X6.840 Y3.500 Z-6.7729 F3000
+G1 X6.820 Y3.500 Z-6.7904 F3000
+G1 X6.800 Y3.500 Z-6.8080 F3000
+G1 X6.780 Y3.500 Z-6.8256 F3000
+G1 X6.760 Y3.500 Z-6.8433 F3000
+G1 X6.740 Y3.500 Z-6.8610 F3000
+G1 X6.720 Y3.500 Z-6.8788 F3000
+G1 X6.700 Y3.500 Z-6.8966 F3000
+G1 X6.680 Y3.500 Z-6.9145 F3000
+G1 X6.660 Y3.500 Z-6.9324 F3000
+G1 X6.640 Y3.500 Z-6.9504 F3000
+G1 X6.620 Y3.500 Z-6.9684 F3000
+G1 X6.600 Y3.500 Z-6.9865 F3000
+G1 X6.580 Y3.500 Z-7.0046 F3000
+G1 X6.560 Y3.500 Z-7.0228 F3000
+G1 X6.540 Y3.500 Z-7.0410 F3000
+G1 X6.520 Y3.500 Z-7.0593 F3000
+G1 X6.500 Y3.500 Z-7.0776 F3000
+G1 X6.480 Y3.500 Z-7.0959 F3000
+G1 X6.460 Y3.500 Z-7.1143 F3000
+G1 X6.440 Y3.500 Z-7.1328 F3000
+G1 X6.420 Y3.500 Z-7.1513 F3000
+G1 X6.400 Y3.500 Z-7.1699 F3000
+G1 X6.380 Y3.500 Z-7.1885 F3000
+G1 X6.360 Y3.500 Z-7.2072 F3000
+G1 X6.340 Y3.500 Z-7.2259 F3000
+G1 X6.320 Y3.500 Z-7.2447 F3000
+G1 X6.300 Y3.500 Z-7.2635 F3000
+G1 X6.280 Y3.500 Z-7.2824 F3000
+G1 X6.260 Y3.500 Z-7.3013 F3000
+G1 X6.240 Y3.500 Z-7.3203 F3000
+G1 X6.220 Y3.500 Z-7.3393 F3000
+G1 X6.200 Y3.500 Z-7.3584 F3000
+G1 X6.180 Y3.500 Z-7.3775 F3000
+G1 X6.160 Y3.500 Z-7.3967 F3000
+G1 X6.140 Y3.500 Z-7.4160 F3000
+G1 X6.120 Y3.500 Z-7.4353 F3000
+G1 X6.100 Y3.500 Z-7.4546 F3000
+G1 X6.080 Y3.500 Z-7.4740 F3000
+G1 X6.060 Y3.500 Z-7.4935 F3000
+G1 X6.040 Y3.500 Z-7.5130 F3000
+G1 X6.020 Y3.500 Z-7.5326 F3000
+G1 X6.000 Y3.500 Z-7.5522 F3000
+G1 X5.980 Y3.500 Z-7.5719 F3000
+G1 X5.960 Y3.500 Z-7.5916 F3000
+G1 X5.940 Y3.500 Z-7.6114 F3000
+G1 X5.920 Y3.500 Z-7.6312 F3000
+G1 X5.900 Y3.500 Z-7.6511 F3000
+G1 X5.880 Y3.500 Z-7.6711 F3000
+G1 X5.860 Y3.500 Z-7.6911 F3000
+G1 X5.840 Y3.500 Z-7.7112 F3000
+G1 X5.820 Y3.500 Z-7.7313 F3000
+G1 X5.800 Y3.500 Z-7.7515 F3000
+G1 X5.780 Y3.500 Z-7.7718 F3000
+G1 X5.760 Y3.500 Z-7.7921 F3000
+G1 X5.740 Y3.500 Z-7.8124 F3000
+G1 X5.720 Y3.500 Z-7.8328 F3000
+G1 X5.700 Y3.500 Z-7.8533 F3000
+G1 X5.680 Y3.500 Z-7.8739 F3000
+G1 X5.660 Y3.500 Z-7.8944 F3000
+G1 X5.640 Y3.500 Z-7.9151 F3000
+G1 X5.620 Y3.500 Z-7.9358 F3000
+G1 X5.600 Y3.500 Z-7.9566 F3000
+G1 X5.580 Y3.500 Z-7.9774 F3000
+G1 X5.560 Y3.500 Z-7.9983 F3000
+G1 X5.540 Y3.500 Z-8.0193 F3000
+G1 X5.520 Y3.500 Z-8.0403 F3000
+G1 X5.500 Y3.500 Z-8.0614 F3000
+G1 X5.480 Y3.500 Z-8.0825 F3000
+G1 X5.460 Y3.500 Z-8.1037 F3000
+G1 X5.440 Y3.500 Z-8.1250 F3000
+G1 X5.420 Y3.500 Z-8.1463 F3000
+G1 X5.400 Y3.500 Z-8.1677 F3000
+G1 X5.380 Y3.500 Z-8.1891 F3000
+G1 X5.360 Y3.500 Z-8.2107 F3000
+G1 X5.340 Y3.500 Z-8.2322 F3000
+G1 X5.320 Y3.500 Z-8.2539 F3000
+G1 X5.300 Y3.500 Z-8.2756 F3000
+G1 X5.280 Y3.500 Z-8.2973 F3000
+G1 X5.260 Y3.500 Z-8.3192 F3000
+G1 X5.240 Y3.500 Z-8.3411 F3000
+G1 X5.220 Y3.500 Z-8.3631 F3000
+G1 X5.200 Y3.500 Z-8.3851 F3000
+G1 X5.180 Y3.500 Z-8.4072 F3000
+G1 X5.160 Y3.500 Z-8.4293 F3000
+G1 X5.140 Y3.500 Z-8.4516 F3000
+G1 X5.120 Y3.500 Z-8.4739 F3000
+G1 X5.100 Y3.500 Z-8.4962 F3000
+G1 X5.080 Y3.500 Z-8.5187 F3000
+G1 X5.060 Y3.500 Z-8.5412 F3000
+G1 X5.040 Y3.500 Z-8.5637 F3000
+G1 X5.020 Y3.500 Z-8.5864 F3000
+G1 X5.000 Y3.500 Z-8.6091 F3000
+G1 X4.980 Y3.500 Z-8.6319 F3000
+G1 X4.960 Y3.500 Z-8.6547 F3000
+G1 X4.940 Y3.500 Z-8.6776 F3000
+G1 X4.920 Y3.500 Z-8.7006 F3000
+G1 X4.900 Y3.500 Z-8.7237 F3000
+G1 X4.880 Y3.500 Z-8.7468 F3000
+G1 X4.860 Y3.500 Z-8.7700 F3000
+G1 X4.840 Y3.500 Z-8.7933 F3000
+G1 X4.820 Y3.500 Z-8.8166 F3000
+G1 X4.800 Y3.500 Z-8.8401 F3000
+G1 X4.780 Y3.500 Z-8.8636 F3000
+G1 X4.760 Y3.500 Z-8.8871 F3000
+G1 X4.740 Y3.500 Z-8.9108 F3000
+G1 X4.720 Y3.500 Z-8.9345 F3000
+G1 X4.700 Y3.500 Z-8.9583 F3000
+G1 X4.680 Y3.500 Z-8.9821 F3000
+G1 X4.660 Y3.500 Z-9.0061 F3000
+G1 X4.640 Y3.500 Z-9.0301 F3000
+G1 X4.620 Y3.500 Z-9.0542 F3000
+G1 X4.600 Y3.500 Z-9.0784 F3000
+G1 X4.580 Y3.500 Z-9.1026 F3000
+G1 X4.560 Y3.500 Z-9.1269 F3000
+G1 X4.540 Y3.500 Z-9.1513 F3000
+G1 X4.520 Y3.500 Z-9.1758 F3000
+G1 X4.500 Y3.500 Z-9.2004 F3000
+G1 X4.480 Y3.500 Z-9.2250 F3000
+G1 X4.460 Y3.500 Z-9.2498 F3000
+G1 X4.440 Y3.500 Z-9.2746 F3000
+G1 X4.420 Y3.500 Z-9.2995 F3000
+G1 X4.400 Y3.500 Z-9.3244 F3000
+G1 X4.380 Y3.500 Z-9.3495 F3000
+G1 X4.360 Y3.500 Z-9.3746 F3000
+G1 X4.340 Y3.500 Z-9.3998 F3000
+G1 X4.320 Y3.500 Z-9.4251 F3000
+G1 X4.300 Y3.500 Z-9.4505 F3000
+G1 X4.280 Y3.500 Z-9.4760 F3000
+G1 X4.260 Y3.500 Z-9.5015 F3000
+G1 X4.240 Y3.500 Z-9.5272 F3000
+G1 X4.220 Y3.500 Z-9.5529 F3000
+G1 X4.200 Y3.500 Z-9.5787 F3000
+G1 X4.180 Y3.500 Z-9.6046 F3000
+G1 X4.160 Y3.500 Z-9.6306 F3000
+G1 X4.140 Y3.500 Z-9.6567 F3000
+G1 X4.120 Y3.500 Z-9.6828 F3000
+G1 X4.100 Y3.500 Z-9.7091 F3000
+G1 X4.080 Y3.500 Z-9.7354 F3000
+G1 X4.060 Y3.500 Z-9.7619 F3000
+G1 X4.040 Y3.500 Z-9.7884 F3000
+G1 X4.020 Y3.500 Z-9.8150 F3000
+G1 X4.000 Y3.500 Z-9.8417 F3000
+G1 X3.980 Y3.500 Z-9.8685 F3000
+G1 X3.960 Y3.500 Z-9.8954 F3000
+G1 X3.940 Y3.500 Z-9.9224 F3000
+G1 X3.920 Y3.500 Z-9.9495 F3000
+G1 X3.900 Y3.500 Z-9.9767 F3000
+G1 X3.880 Y3.500 Z-10.0040 F3000
+G1 X3.860 Y3.500 Z-10.0314 F3000
+G1 X3.840 Y3.500 Z-10.0589 F3000
+G1 X3.820 Y3.500 Z-10.0864 F3000
+G1 X3.800 Y3.500 Z-10.1141 F3000
+G1 X3.780 Y3.500 Z-10.1419 F3000
+G1 X3.760 Y3.500 Z-10.1698 F3000
+G1 X3.740 Y3.500 Z-10.1977 F3000
+G1 X3.720 Y3.500 Z-10.2258 F3000
+G1 X3.700 Y3.500 Z-10.2540 F3000
+G1 X3.680 Y3.500 Z-10.2823 F3000
+G1 X3.660 Y3.500 Z-10.3107 F3000
+G1 X3.640 Y3.500 Z-10.3392 F3000
+G1 X3.620 Y3.500 Z-10.3678 F3000
+G1 X3.600 Y3.500 Z-10.3965 F3000
+G1 X3.580 Y3.500 Z-10.4253 F3000
+G1 X3.560 Y3.500 Z-10.4542 F3000
+G1 X3.540 Y3.500 Z-10.4833 F3000
+G1 X3.520 Y3.500 Z-10.5124 F3000
+G1 X3.500 Y3.500 Z-10.5417 F3000
+G1 X3.480 Y3.500 Z-10.5710 F3000
+G1 X3.460 Y3.500 Z-10.6005 F3000
+G1 X3.440 Y3.500 Z-10.6301 F3000
+G1 X3.420 Y3.500 Z-10.6598 F3000
+G1 X3.400 Y3.500 Z-10.6896 F3000
+G1 X3.380 Y3.500 Z-10.7196 F3000
+G1 X3.360 Y3.500 Z-10.7496 F3000
+G1 X3.340 Y3.500 Z-10.7798 F3000
+G1 X3.320 Y3.500 Z-10.8101 F3000
+G1 X3.300 Y3.500 Z-10.8405 F3000
+G1 X3.280 Y3.500 Z-10.8711 F3000
+G1 X3.260 Y3.500 Z-10.9017 F3000
+G1 X3.240 Y3.500 Z-10.9325 F3000
+G1 X3.220 Y3.500 Z-10.9634 F3000
+G1 X3.200 Y3.500 Z-10.9944 F3000
+G1 X3.180 Y3.500 Z-11.0256 F3000
+G1 X3.160 Y3.500 Z-11.0569 F3000
+G1 X3.140 Y3.500 Z-11.0883 F3000
+G1 X3.120 Y3.500 Z-11.1199 F3000
+G1 X3.100 Y3.500 Z-11.1515 F3000
+G1 X3.080 Y3.500 Z-11.1833 F3000
+G1 X3.060 Y3.500 Z-11.2153 F3000
+G1 X3.040 Y3.500 Z-11.2474 F3000
+G1 X3.020 Y3.500 Z-11.2796 F3000
+G1 X3.000 Y3.500 Z-11.3119 F3000
+G1 X2.980 Y3.500 Z-11.3444 F3000
+G1 X2.960 Y3.500 Z-11.3770 F3000
+G1 X2.940 Y3.500 Z-11.4098 F3000
+G1 X2.920 Y3.500 Z-11.4427 F3000
+G1 X2.900 Y3.500 Z-11.4758 F3000
+G1 X2.880 Y3.500 Z-11.5090 F3000
+G1 X2.860 Y3.500 Z-11.5423 F3000
+G1 X2.840 Y3.500 Z-11.5758 F3000
+G1 X2.820 Y3.500 Z-11.6094 F3000
+G1 X2.800 Y3.500 Z-11.6432 F3000
+G1 X2.780 Y3.500 Z-11.6772 F3000
+G1 X2.760 Y3.500 Z-11.7113 F3000
+G1 X2.740 Y3.500 Z-11.7455 F3000
+G1 X2.720 Y3.500 Z-11.7799 F3000
+G1 X2.700 Y3.500 Z-11.8145 F3000
+G1 X2.680 Y3.500 Z-11.8492 F3000
+G1 X2.660 Y3.500 Z-11.8841 F3000
+G1 X2.640 Y3.500 Z-11.9192 F3000
+G1 X2.620 Y3.500 Z-11.9544 F3000
+G1 X2.600 Y3.500 Z-11.9898 F3000
+G1 X2.580 Y3.500 Z-12.0254 F3000
+G1 X2.560 Y3.500 Z-12.0611 F3000
+G1 X2.540 Y3.500 Z-12.0970 F3000
+G1 X2.520 Y3.500 Z-12.1331 F3000
+G1 X2.500 Y3.500 Z-12.1693 F3000
+G1 X2.480 Y3.500 Z-12.2058 F3000
+G1 X2.460 Y3.500 Z-12.2424 F3000
+G1 X2.440 Y3.500 Z-12.2792 F3000
+G1 X2.420 Y3.500 Z-12.3161 F3000
+G1 X2.400 Y3.500 Z-12.3533 F3000
+G1 X2.380 Y3.500 Z-12.3907 F3000
+G1 X2.360 Y3.500 Z-12.4282 F3000
+G1 X2.340 Y3.500 Z-12.4660 F3000
+G1 X2.320 Y3.500 Z-12.5039 F3000
+G1 X2.300 Y3.500 Z-12.5420 F3000
+G1 X2.280 Y3.500 Z-12.5804 F3000
+G1 X2.260 Y3.500 Z-12.6189 F3000
+G1 X2.240 Y3.500 Z-12.6577 F3000
+G1 X2.220 Y3.500 Z-12.6966 F3000
+G1 X2.200 Y3.500 Z-12.7358 F3000
+G1 X2.180 Y3.500 Z-12.7752 F3000
+G1 X2.160 Y3.500 Z-12.8148 F3000
+G1 X2.140 Y3.500 Z-12.8546 F3000
+G1 X2.120 Y3.500 Z-12.8946 F3000
+G1 X2.100 Y3.500 Z-12.9349 F3000
+G1 X2.080 Y3.500 Z-12.9754 F3000
+G1 X2.060 Y3.500 Z-13.0161 F3000
+G1 X2.040 Y3.500 Z-13.0571 F3000
+G1 X2.020 Y3.500 Z-13.0983 F3000
+G1 X2.000 Y3.500 Z-13.1397 F3000
+G1 X1.980 Y3.500 Z-13.1814 F3000
+G1 X1.960 Y3.500 Z-13.2234 F3000
+G1 X1.940 Y3.500 Z-13.2656 F3000
+G1 X1.920 Y3.500 Z-13.3080 F3000
+G1 X1.900 Y3.500 Z-13.3507 F3000
+G1 X1.880 Y3.500 Z-13.3937 F3000
+G1 X1.860 Y3.500 Z-13.4370 F3000
+G1 X1.840 Y3.500 Z-13.4805 F3000
+G1 X1.820 Y3.500 Z-13.5243 F3000
+G1 X1.800 Y3.500 Z-13.5684 F3000
+G1 X1.780 Y3.500 Z-13.6127 F3000
+G1 X1.760 Y3.500 Z-13.6574 F3000
+G1 X1.740 Y3.500 Z-13.7023 F3000
+G1 X1.720 Y3.500 Z-13.7476 F3000
+G1 X1.700 Y3.500 Z-13.7931 F3000
+G1 X1.680 Y3.500 Z-13.8390 F3000
+G1 X1.660 Y3.500 Z-13.8852 F3000
+G1 X1.640 Y3.500 Z-13.9317 F3000
+G1 X1.620 Y3.500 Z-13.9785 F3000
+G1 X1.600 Y3.500 Z-14.0257 F3000
+G1 X1.580 Y3.500 Z-14.0732 F3000
+G1 X1.560 Y3.500 Z-14.1210 F3000
+G1 X1.540 Y3.500 Z-14.1692 F3000
+G1 X1.520 Y3.500 Z-14.2178 F3000
+G1 X1.500 Y3.500 Z-14.2667 F3000
+G1 X1.480 Y3.500 Z-14.3160 F3000
+G1 X1.460 Y3.500 Z-14.3657 F3000
+G1 X1.440 Y3.500 Z-14.4158 F3000
+G1 X1.420 Y3.500 Z-14.4663 F3000
+G1 X1.400 Y3.500 Z-14.5171 F3000
+G1 X1.380 Y3.500 Z-14.5684 F3000
+G1 X1.360 Y3.500 Z-14.6201 F3000
+G1 X1.340 Y3.500 Z-14.6723 F3000
+G1 X1.320 Y3.500 Z-14.7249 F3000
+G1 X1.300 Y3.500 Z-14.7779 F3000
+G1 X1.280 Y3.500 Z-14.8314 F3000
+G1 X1.260 Y3.500 Z-14.8853 F3000
+G1 X1.240 Y3.500 Z-14.9398 F3000
+G1 X1.220 Y3.500 Z-14.9947 F3000
+G1 X1.200 Y3.500 Z-15.0502 F3000
+G1 X1.180 Y3.500 Z-15.1062 F3000
+G1 X1.160 Y3.500 Z-15.1627 F3000
+G1 X1.140 Y3.500 Z-15.2197 F3000
+G1 X1.120 Y3.500 Z-15.2773 F3000
+G1 X1.100 Y3.500 Z-15.3355 F3000
+G1 X1.080 Y3.500 Z-15.3943 F3000
+G1 X1.060 Y3.500 Z-15.4536 F3000
+G1 X1.040 Y3.500 Z-15.5136 F3000
+G1 X1.020 Y3.500 Z-15.5743 F3000
+G1 X1.000 Y3.500 Z-15.6356 F3000
+G1 X0.980 Y3.500 Z-15.6976 F3000
+G1 X0.960 Y3.500 Z-15.7603 F3000
+G1 X0.940 Y3.500 Z-15.8237 F3000
+G1 X0.920 Y3.500 Z-15.8878 F3000
+G1 X0.900 Y3.500 Z-15.9528 F3000
+G1 X0.880 Y3.500 Z-16.0185 F3000
+G1 X0.860 Y3.500 Z-16.0851 F3000
+G1 X0.840 Y3.500 Z-16.1525 F3000
+G1 X0.820 Y3.500 Z-16.2208 F3000
+G1 X0.800 Y3.500 Z-16.2900 F3000
+G1 X0.780 Y3.500 Z-16.3602 F3000
+G1 X0.760 Y3.500 Z-16.4314 F3000
+G1 X0.740 Y3.500 Z-16.5035 F3000
+G1 X0.720 Y3.500 Z-16.5768 F3000
+G1 X0.700 Y3.500 Z-16.6512 F3000
+G1 X0.680 Y3.500 Z-16.7268 F3000
+G1 X0.660 Y3.500 Z-16.8036 F3000
+G1 X0.640 Y3.500 Z-16.8816 F3000
+G1 X0.620 Y3.500 Z-16.9610 F3000
+G1 X0.600 Y3.500 Z-17.0418 F3000
+G1 X0.580 Y3.500 Z-17.1241 F3000
+G1 X0.560 Y3.500 Z-17.2080 F3000
+G1 X0.540 Y3.500 Z-17.2935 F3000
+G1 X0.520 Y3.500 Z-17.3808 F3000
+G1 X0.500 Y3.500 Z-17.4699 F3000
+G1 X0.480 Y3.500 Z-17.5609 F3000
+G1 X0.460 Y3.500 Z-17.6541 F3000
+G1 X0.440 Y3.500 Z-17.7495 F3000
+G1 X0.420 Y3.500 Z-17.8473 F3000
+G1 X0.400 Y3.500 Z-17.9477 F3000
+G1 X0.380 Y3.500 Z-18.0509 F3000
+G1 X0.360 Y3.500 Z-18.1571 F3000
+G1 X0.340 Y3.500 Z-18.2667 F3000
+G1 X0.320 Y3.500 Z-18.3798 F3000
+G1 X0.300 Y3.500 Z-18.4970 F3000
+G1 X0.280 Y3.500 Z-18.6186 F3000
+G1 X0.260 Y3.500 Z-18.7451 F3000
+G1 X0.240 Y3.500 Z-18.8773 F3000
+G1 X0.220 Y3.500 Z-19.0158 F3000
+G1 X0.200 Y3.500 Z-19.1618 F3000
+G1 X0.180 Y3.500 Z-19.3165 F3000
+G1 X0.160 Y3.500 Z-19.4817 F3000
+G1 X0.140 Y3.500 Z-19.6598 F3000
+G1 X0.120 Y3.500 Z-19.8543 F3000
+G1 X0.100 Y3.500 Z-20.0708 F3000
+G1 X0.080 Y3.500 Z-20.3189 F3000
+G1 X0.060 Y3.500 Z-20.6183 F3000
+G1 X0.040 Y3.500 Z-21.0264 F3000
+G1 X0.020 Y3.500 Z-21.8000 F3000
+G1 X0.000 Y3.500 Z-21.8000 F3000
+G1 X0.000 Y4.000 Z-21.8000 F3000
+G1 X0.020 Y4.000 Z-21.8000 F3000
+G1 X0.040 Y4.000 Z-21.8000 F3000
+G1 X0.060 Y4.000 Z-21.4174 F3000
+G1 X0.080 Y4.000 Z-20.8286 F3000
+G1 X0.100 Y4.000 Z-20.4809 F3000
+G1 X0.120 Y4.000 Z-20.2076 F3000
+G1 X0.140 Y4.000 Z-19.9751 F3000
+G1 X0.160 Y4.000 Z-19.7691 F3000
+G1 X0.180 Y4.000 Z-19.5824 F3000
+G1 X0.200 Y4.000 Z-19.4104 F3000
+G1 X0.220 Y4.000 Z-19.2502 F3000
+G1 X0.240 Y4.000 Z-19.0996 F3000
+G1 X0.260 Y4.000 Z-18.9570 F3000
+G1 X0.280 Y4.000 Z-18.8215 F3000
+G1 X0.300 Y4.000 Z-18.6919 F3000
+G1 X0.320 Y4.000 Z-18.5677 F3000
+G1 X0.340 Y4.000 Z-18.4482 F3000
+G1 X0.360 Y4.000 Z-18.3330 F3000
+G1 X0.380 Y4.000 Z-18.2215 F3000
+G1 X0.400 Y4.000 Z-18.1135 F3000
+G1 X0.420 Y4.000 Z-18.0087 F3000
+G1 X0.440 Y4.000 Z-17.9069 F3000
+G1 X0.460 Y4.000 Z-17.8077 F3000
+G1 X0.480 Y4.000 Z-17.7110 F3000
+G1 X0.500 Y4.000 Z-17.6167 F3000
+G1 X0.520 Y4.000 Z-17.5245 F3000
+G1 X0.540 Y4.000 Z-17.4344 F3000
+G1 X0.560 Y4.000 Z-17.3462 F3000
+G1 X0.580 Y4.000 Z-17.2598 F3000
+G1 X0.600 Y4.000 Z-17.1751 F3000
+G1 X0.620 Y4.000 Z-17.0920 F3000
+G1 X0.640 Y4.000 Z-17.0104 F3000
+G1 X0.660 Y4.000 Z-16.9303 F3000
+G1 X0.680 Y4.000 Z-16.8515 F3000
+G1 X0.700 Y4.000 Z-16.7741 F3000
+G1 X0.720 Y4.000 Z-16.6979 F3000
+G1 X0.740 Y4.000 Z-16.6229 F3000
+G1 X0.760 Y4.000 Z-16.5491 F3000
+G1 X0.780 Y4.000 Z-16.4763 F3000
+G1 X0.800 Y4.000 Z-16.4046 F3000
+G1 X0.820 Y4.000 Z-16.3340 F3000
+G1 X0.840 Y4.000 Z-16.2643 F3000
+G1 X0.860 Y4.000 Z-16.1955 F3000
+G1 X0.880 Y4.000 Z-16.1276 F3000
+G1 X0.900 Y4.000 Z-16.0607 F3000
+G1 X0.920 Y4.000 Z-15.9945 F3000
+G1 X0.940 Y4.000 Z-15.9292 F3000
+G1 X0.960 Y4.000 Z-15.8646 F3000
+G1 X0.980 Y4.000 Z-15.8009 F3000
+G1 X1.000 Y4.000 Z-15.7378 F3000
+G1 X1.020 Y4.000 Z-15.6755 F3000
+G1 X1.040 Y4.000 Z-15.6139 F3000
+G1 X1.060 Y4.000 Z-15.5529 F3000
+G1 X1.080 Y4.000 Z-15.4926 F3000
+G1 X1.100 Y4.000 Z-15.4329 F3000
+G1 X1.120 Y4.000 Z-15.3738 F3000
+G1 X1.140 Y4.000 Z-15.3154 F3000
+G1 X1.160 Y4.000 Z-15.2575 F3000
+G1 X1.180 Y4.000 Z-15.2002 F3000
+G1 X1.200 Y4.000 Z-15.1434 F3000
+G1 X1.220 Y4.000 Z-15.0872 F3000
+G1 X1.240 Y4.000 Z-15.0315 F3000
+G1 X1.260 Y4.000 Z-14.9763 F3000
+G1 X1.280 Y4.000 Z-14.9217 F3000
+G1 X1.300 Y4.000 Z-14.8675 F3000
+G1 X1.320 Y4.000 Z-14.8138 F3000
+G1 X1.340 Y4.000 Z-14.7605 F3000
+G1 X1.360 Y4.000 Z-14.7077 F3000
+G1 X1.380 Y4.000 Z-14.6554 F3000
+G1 X1.400 Y4.000 Z-14.6035 F3000
+G1 X1.420 Y4.000 Z-14.5520 F3000
+G1 X1.440 Y4.000 Z-14.5009 F3000
+G1 X1.460 Y4.000 Z-14.4503 F3000
+G1 X1.480 Y4.000 Z-14.4000 F3000
+G1 X1.500 Y4.000 Z-14.3502 F3000
+G1 X1.520 Y4.000 Z-14.3007 F3000
+G1 X1.540 Y4.000 Z-14.2516 F3000
+G1 X1.560 Y4.000 Z-14.2029 F3000
+G1 X1.580 Y4.000 Z-14.1545 F3000
+G1 X1.600 Y4.000 Z-14.1065 F3000
+G1 X1.620 Y4.000 Z-14.0588 F3000
+G1 X1.640 Y4.000 Z-14.0115 F3000
+G1 X1.660 Y4.000 Z-13.9645 F3000
+G1 X1.680 Y4.000 Z-13.9179 F3000
+G1 X1.700 Y4.000 Z-13.8716 F3000
+G1 X1.720 Y4.000 Z-13.8256 F3000
+G1 X1.740 Y4.000 Z-13.7799 F3000
+G1 X1.760 Y4.000 Z-13.7345 F3000
+G1 X1.780 Y4.000 Z-13.6894 F3000
+G1 X1.800 Y4.000 Z-13.6446 F3000
+G1 X1.820 Y4.000 Z-13.6001 F3000
+G1 X1.840 Y4.000 Z-13.5559 F3000
+G1 X1.860 Y4.000 Z-13.5120 F3000
+G1 X1.880 Y4.000 Z-13.4684 F3000
+G1 X1.900 Y4.000 Z-13.4250 F3000
+G1 X1.920 Y4.000 Z-13.3819 F3000
+G1 X1.940 Y4.000 Z-13.3391 F3000
+G1 X1.960 Y4.000 Z-13.2966 F3000
+G1 X1.980 Y4.000 Z-13.2543 F3000
+G1 X2.000 Y4.000 Z-13.2122 F3000
+G1 X2.020 Y4.000 Z-13.1704 F3000
+G1 X2.040 Y4.000 Z-13.1289 F3000
+G1 X2.060 Y4.000 Z-13.0876 F3000
+G1 X2.080 Y4.000 Z-13.0465 F3000
+G1 X2.100 Y4.000 Z-13.0057 F3000
+G1 X2.120 Y4.000 Z-12.9651 F3000
+G1 X2.140 Y4.000 Z-12.9247 F3000
+G1 X2.160 Y4.000 Z-12.8846 F3000
+G1 X2.180 Y4.000 Z-12.8447 F3000
+G1 X2.200 Y4.000 Z-12.8050 F3000
+G1 X2.220 Y4.000 Z-12.7655 F3000
+G1 X2.240 Y4.000 Z-12.7263 F3000
+G1 X2.260 Y4.000 Z-12.6872 F3000
+G1 X2.280 Y4.000 Z-12.6484 F3000
+G1 X2.300 Y4.000 Z-12.6098 F3000
+G1 X2.320 Y4.000 Z-12.5714 F3000
+G1 X2.340 Y4.000 Z-12.5332 F3000
+G1 X2.360 Y4.000 Z-12.4951 F3000
+G1 X2.380 Y4.000 Z-12.4573 F3000
+G1 X2.400 Y4.000 Z-12.4197 F3000
+G1 X2.420 Y4.000 Z-12.3823 F3000
+G1 X2.440 Y4.000 Z-12.3450 F3000
+G1 X2.460 Y4.000 Z-12.3080 F3000
+G1 X2.480 Y4.000 Z-12.2711 F3000
+G1 X2.500 Y4.000 Z-12.2344 F3000
+G1 X2.520 Y4.000 Z-12.1979 F3000
+G1 X2.540 Y4.000 Z-12.1616 F3000
+G1 X2.560 Y4.000 Z-12.1255 F3000
+G1 X2.580 Y4.000 Z-12.0895 F3000
+G1 X2.600 Y4.000 Z-12.0537 F3000
+G1 X2.620 Y4.000 Z-12.0181 F3000
+G1 X2.640 Y4.000 Z-11.9826 F3000
+G1 X2.660 Y4.000 Z-11.9474 F3000
+G1 X2.680 Y4.000 Z-11.9123 F3000
+G1 X2.700 Y4.000 Z-11.8773 F3000
+G1 X2.720 Y4.000 Z-11.8425 F3000
+G1 X2.740 Y4.000 Z-11.8079 F3000
+G1 X2.760 Y4.000 Z-11.7734 F3000
+G1 X2.780 Y4.000 Z-11.7391 F3000
+G1 X2.800 Y4.000 Z-11.7050 F3000
+G1 X2.820 Y4.000 Z-11.6710 F3000
+G1 X2.840 Y4.000 Z-11.6371 F3000
+G1 X2.860 Y4.000 Z-11.6034 F3000
+G1 X2.880 Y4.000 Z-11.5699 F3000
+G1 X2.900 Y4.000 Z-11.5365 F3000
+G1 X2.920 Y4.000 Z-11.5032 F3000
+G1 X2.940 Y4.000 Z-11.4701 F3000
+G1 X2.960 Y4.000 Z-11.4372 F3000
+G1 X2.980 Y4.000 Z-11.4043 F3000
+G1 X3.000 Y4.000 Z-11.3717 F3000
+G1 X3.020 Y4.000 Z-11.3391 F3000
+G1 X3.040 Y4.000 Z-11.3067 F3000
+G1 X3.060 Y4.000 Z-11.2745 F3000
+G1 X3.080 Y4.000 Z-11.2424 F3000
+G1 X3.100 Y4.000 Z-11.2104 F3000
+G1 X3.120 Y4.000 Z-11.1785 F3000
+G1 X3.140 Y4.000 Z-11.1468 F3000
+G1 X3.160 Y4.000 Z-11.1152 F3000
+G1 X3.180 Y4.000 Z-11.0838 F3000
+G1 X3.200 Y4.000 Z-11.0524 F3000
+G1 X3.220 Y4.000 Z-11.0212 F3000
+G1 X3.240 Y4.000 Z-10.9902 F3000
+G1 X3.260 Y4.000 Z-10.9592 F3000
+G1 X3.280 Y4.000 Z-10.9284 F3000
+G1 X3.300 Y4.000 Z-10.8977 F3000
+G1 X3.320 Y4.000 Z-10.8671 F3000
+G1 X3.340 Y4.000 Z-10.8367 F3000
+G1 X3.360 Y4.000 Z-10.8063 F3000
+G1 X3.380 Y4.000 Z-10.7761 F3000
+G1 X3.400 Y4.000 Z-10.7460 F3000
+G1 X3.420 Y4.000 Z-10.7161 F3000
+G1 X3.440 Y4.000 Z-10.6862 F3000
+G1 X3.460 Y4.000 Z-10.6565 F3000
+G1 X3.480 Y4.000 Z-10.6268 F3000
+G1 X3.500 Y4.000 Z-10.5973 F3000
+G1 X3.520 Y4.000 Z-10.5679 F3000
+G1 X3.540 Y4.000 Z-10.5386 F3000
+G1 X3.560 Y4.000 Z-10.5095 F3000
+G1 X3.580 Y4.000 Z-10.4804 F3000
+G1 X3.600 Y4.000 Z-10.4514 F3000
+G1 X3.620 Y4.000 Z-10.4226 F3000
+G1 X3.640 Y4.000 Z-10.3938 F3000
+G1 X3.660 Y4.000 Z-10.3652 F3000
+G1 X3.680 Y4.000 Z-10.3367 F3000
+G1 X3.700 Y4.000 Z-10.3083 F3000
+G1 X3.720 Y4.000 Z-10.2799 F3000
+G1 X3.740 Y4.000 Z-10.2517 F3000
+G1 X3.760 Y4.000 Z-10.2236 F3000
+G1 X3.780 Y4.000 Z-10.1956 F3000
+G1 X3.800 Y4.000 Z-10.1677 F3000
+G1 X3.820 Y4.000 Z-10.1399 F3000
+G1 X3.840 Y4.000 Z-10.1122 F3000
+G1 X3.860 Y4.000 Z-10.0846 F3000
+G1 X3.880 Y4.000 Z-10.0571 F3000
+G1 X3.900 Y4.000 Z-10.0297 F3000
+G1 X3.920 Y4.000 Z-10.0024 F3000
+G1 X3.940 Y4.000 Z-9.9752 F3000
+G1 X3.960 Y4.000 Z-9.9481 F3000
+G1 X3.980 Y4.000 Z-9.9210 F3000
+G1 X4.000 Y4.000 Z-9.8941 F3000
+G1 X4.020 Y4.000 Z-9.8673 F3000
+G1 X4.040 Y4.000 Z-9.8406 F3000
+G1 X4.060 Y4.000 Z-9.8139 F3000
+G1 X4.080 Y4.000 Z-9.7874 F3000
+G1 X4.100 Y4.000 Z-9.7609 F3000
+G1 X4.120 Y4.000 Z-9.7345 F3000
+G1 X4.140 Y4.000 Z-9.7083 F3000
+G1 X4.160 Y4.000 Z-9.6821 F3000
+G1 X4.180 Y4.000 Z-9.6560 F3000
+G1 X4.200 Y4.000 Z-9.6300 F3000
+G1 X4.220 Y4.000 Z-9.6040 F3000
+G1 X4.240 Y4.000 Z-9.5782 F3000
+G1 X4.260 Y4.000 Z-9.5525 F3000
+G1 X4.280 Y4.000 Z-9.5268 F3000
+G1 X4.300 Y4.000 Z-9.5012 F3000
+G1 X4.320 Y4.000 Z-9.4757 F3000
+G1 X4.340 Y4.000 Z-9.4503 F3000
+G1 X4.360 Y4.000 Z-9.4250 F3000
+G1 X4.380 Y4.000 Z-9.3998 F3000
+G1 X4.400 Y4.000 Z-9.3746 F3000
+G1 X4.420 Y4.000 Z-9.3496 F3000
+G1 X4.440 Y4.000 Z-9.3246 F3000
+G1 X4.460 Y4.000 Z-9.2997 F3000
+G1 X4.480 Y4.000 Z-9.2748 F3000
+G1 X4.500 Y4.000 Z-9.2501 F3000
+G1 X4.520 Y4.000 Z-9.2254 F3000
+G1 X4.540 Y4.000 Z-9.2009 F3000
+G1 X4.560 Y4.000 Z-9.1764 F3000
+G1 X4.580 Y4.000 Z-9.1519 F3000
+G1 X4.600 Y4.000 Z-9.1276 F3000
+G1 X4.620 Y4.000 Z-9.1033 F3000
+G1 X4.640 Y4.000 Z-9.0791 F3000
+G1 X4.660 Y4.000 Z-9.0550 F3000
+G1 X4.680 Y4.000 Z-9.0310 F3000
+G1 X4.700 Y4.000 Z-9.0070 F3000
+G1 X4.720 Y4.000 Z-8.9832 F3000
+G1 X4.740 Y4.000 Z-8.9593 F3000
+G1 X4.760 Y4.000 Z-8.9356 F3000
+G1 X4.780 Y4.000 Z-8.9120 F3000
+G1 X4.800 Y4.000 Z-8.8884 F3000
+G1 X4.820 Y4.000 Z-8.8649 F3000
+G1 X4.840 Y4.000 Z-8.8414 F3000
+G1 X4.860 Y4.000 Z-8.8181 F3000
+G1 X4.880 Y4.000 Z-8.7948 F3000
+G1 X4.900 Y4.000 Z-8.7716 F3000
+G1 X4.920 Y4.000 Z-8.7484 F3000
+G1 X4.940 Y4.000 Z-8.7254 F3000
+G1 X4.960 Y4.000 Z-8.7024 F3000
+G1 X4.980 Y4.000 Z-8.6794 F3000
+G1 X5.000 Y4.000 Z-8.6566 F3000
+G1 X5.020 Y4.000 Z-8.6338 F3000
+G1 X5.040 Y4.000 Z-8.6111 F3000
+G1 X5.060 Y4.000 Z-8.5884 F3000
+G1 X5.080 Y4.000 Z-8.5658 F3000
+G1 X5.100 Y4.000 Z-8.5433 F3000
+G1 X5.120 Y4.000 Z-8.5209 F3000
+G1 X5.140 Y4.000 Z-8.4985 F3000
+G1 X5.160 Y4.000 Z-8.4762 F3000
+G1 X5.180 Y4.000 Z-8.4539 F3000
+G1 X5.200 Y4.000 Z-8.4318 F3000
+G1 X5.220 Y4.000 Z-8.4096 F3000
+G1 X5.240 Y4.000 Z-8.3876 F3000
+G1 X5.260 Y4.000 Z-8.3656 F3000
+G1 X5.280 Y4.000 Z-8.3437 F3000
+G1 X5.300 Y4.000 Z-8.3219 F3000
+G1 X5.320 Y4.000 Z-8.3001 F3000
+G1 X5.340 Y4.000 Z-8.2784 F3000
+G1 X5.360 Y4.000 Z-8.2567 F3000
+G1 X5.380 Y4.000 Z-8.2351 F3000
+G1 X5.400 Y4.000 Z-8.2136 F3000
+G1 X5.420 Y4.000 Z-8.1921 F3000
+G1 X5.440 Y4.000 Z-8.1708 F3000
+G1 X5.460 Y4.000 Z-8.1494 F3000
+G1 X5.480 Y4.000 Z-8.1281 F3000
+G1 X5.500 Y4.000 Z-8.1069 F3000
+G1 X5.520 Y4.000 Z-8.0858 F3000
+G1 X5.540 Y4.000 Z-8.0647 F3000
+G1 X5.560 Y4.000 Z-8.0437 F3000
+G1 X5.580 Y4.000 Z-8.0227 F3000
+G1 X5.600 Y4.000 Z-8.0018 F3000
+G1 X5.620 Y4.000 Z-7.9810 F3000
+G1 X5.640 Y4.000 Z-7.9602 F3000
+G1 X5.660 Y4.000 Z-7.9395 F3000
+G1 X5.680 Y4.000 Z-7.9188 F3000
+G1 X5.700 Y4.000 Z-7.8982 F3000
+G1 X5.720 Y4.000 Z-7.8777 F3000
+G1 X5.740 Y4.000 Z-7.8572 F3000
+G1 X5.760 Y4.000 Z-7.8367 F3000
+G1 X5.780 Y4.000 Z-7.8164 F3000
+G1 X5.800 Y4.000 Z-7.7961 F3000
+G1 X5.820 Y4.000 Z-7.7758 F3000
+G1 X5.840 Y4.000 Z-7.7556 F3000
+G1 X5.860 Y4.000 Z-7.7355 F3000
+G1 X5.880 Y4.000 Z-7.7154 F3000
+G1 X5.900 Y4.000 Z-7.6954 F3000
+G1 X5.920 Y4.000 Z-7.6754 F3000
+G1 X5.940 Y4.000 Z-7.6555 F3000
+G1 X5.960 Y4.000 Z-7.6357 F3000
+G1 X5.980 Y4.000 Z-7.6159 F3000
+G1 X6.000 Y4.000 Z-7.5961 F3000
+G1 X6.020 Y4.000 Z-7.5764 F3000
+G1 X6.040 Y4.000 Z-7.5568 F3000
+G1 X6.060 Y4.000 Z-7.5372 F3000
+G1 X6.080 Y4.000 Z-7.5177 F3000
+G1 X6.100 Y4.000 Z-7.4983 F3000
+G1 X6.120 Y4.000 Z-7.4788 F3000
+G1 X6.140 Y4.000 Z-7.4595 F3000
+G1 X6.160 Y4.000 Z-7.4402 F3000
+G1 X6.180 Y4.000 Z-7.4209 F3000
+G1 X6.200 Y4.000 Z-7.4017 F3000
+G1 X6.220 Y4.000 Z-7.3826 F3000
+G1 X6.240 Y4.000 Z-7.3635 F3000
+G1 X6.260 Y4.000 Z-7.3445 F3000
+G1 X6.280 Y4.000 Z-7.3255 F3000
+G1 X6.300 Y4.000 Z-7.3066 F3000
+G1 X6.320 Y4.000 Z-7.2877 F3000
+G1 X6.340 Y4.000 Z-7.2688 F3000
+G1 X6.360 Y4.000 Z-7.2501 F3000
+G1 X6.380 Y4.000 Z-7.2313 F3000
+G1 X6.400 Y4.000 Z-7.2127 F3000
+G1 X6.420 Y4.000 Z-7.1941 F3000
+G1 X6.440 Y4.000 Z-7.1755 F3000
+G1 X6.460 Y4.000 Z-7.1570 F3000
+G1 X6.480 Y4.000 Z-7.1385 F3000
+G1 X6.500 Y4.000 Z-7.1201 F3000
+G1 X6.520 Y4.000 Z-7.1017 F3000
+G1 X6.540 Y4.000 Z-7.0834 F3000
+G1 X6.560 Y4.000 Z-7.0651 F3000
+G1 X6.580 Y4.000 Z-7.0469 F3000
+G1 X6.600 Y4.000 Z-7.0287 F3000
+G1 X6.620 Y4.000 Z-7.0106 F3000
+G1 X6.640 Y4.000 Z-6.9926 F3000
+G1 X6.660 Y4.000 Z-6.9745 F3000
+G1 X6.680 Y4.000 Z-6.9566 F3000
+G1 X6.700 Y4.000 Z-6.9386 F3000
+G1 X6.720 Y4.000 Z-6.9208 F3000
+G1 X6.740 Y4.000 Z-6.9029 F3000
+G1 X6.760 Y4.000 Z-6.8852 F3000
+G1 X6.780 Y4.000 Z-6.8674 F3000
+G1 X6.800 Y4.000 Z-6.8497 F3000
+G1 X6.820 Y4.000 Z-6.8321 F3000
+G1 X6.840 Y4.000 Z-6.8145 F3000
+G1 X6.860 Y4.000 Z-6.7970 F3000
+G1 X6.880 Y4.000 Z-6.7795 F3000
+G1 X6.900 Y4.000 Z-6.7620 F3000
+G1 X6.920 Y4.000 Z-6.7446 F3000
+G1 X6.940 Y4.000 Z-6.7273 F3000
+G1 X6.960 Y4.000 Z-6.7100 F3000
+G1 X6.980 Y4.000 Z-6.6927 F3000
+G1 X7.000 Y4.000 Z-6.6755 F3000
+G1 X7.020 Y4.000 Z-6.6583 F3000
+G1 X7.040 Y4.000 Z-6.6412 F3000
+G1 X7.060 Y4.000 Z-6.6242 F3000
+G1 X7.080 Y4.000 Z-6.6071 F3000
+G1 X7.100 Y4.000 Z-6.5901 F3000
+G1 X7.120 Y4.000 Z-6.5732 F3000
+G1 X7.140 Y4.000 Z-6.5563 F3000
+G1 X7.160 Y4.000 Z-6.5394 F3000
+G1 X7.180 Y4.000 Z-6.5226 F3000
+G1 X7.200 Y4.000 Z-6.5059 F3000
+G1 X7.220 Y4.000 Z-6.4892 F3000
+G1 X7.240 Y4.000 Z-6.4725 F3000
+G1 X7.260 Y4.000 Z-6.4559 F3000
+G1 X7.280 Y4.000 Z-6.4393 F3000
+G1 X7.300 Y4.000 Z-6.4227 F3000
+G1 X7.320 Y4.000 Z-6.4062 F3000
+G1 X7.340 Y4.000 Z-6.3898 F3000
+G1 X7.360 Y4.000 Z-6.3734 F3000
+G1 X7.380 Y4.000 Z-6.3570 F3000
+G1 X7.400 Y4.000 Z-6.3407 F3000
+G1 X7.420 Y4.000 Z-6.3244 F3000
+G1 X7.440 Y4.000 Z-6.3082 F3000
+G1 X7.460 Y4.000 Z-6.2920 F3000
+G1 X7.480 Y4.000 Z-6.2758 F3000
+G1 X7.500 Y4.000 Z-6.2597 F3000
+G1 X7.520 Y4.000 Z-6.2437 F3000
+G1 X7.540 Y4.000 Z-6.2276 F3000
+G1 X7.560 Y4.000 Z-6.2117 F3000
+G1 X7.580 Y4.000 Z-6.1957 F3000
+G1 X7.600 Y4.000 Z-6.1798 F3000
+G1 X7.620 Y4.000 Z-6.1640 F3000
+G1 X7.640 Y4.000 Z-6.1482 F3000
+G1 X7.660 Y4.000 Z-6.1324 F3000
+G1 X7.680 Y4.000 Z-6.1166 F3000
+G1 X7.700 Y4.000 Z-6.1010 F3000
+G1 X7.720 Y4.000 Z-6.0853 F3000
+G1 X7.740 Y4.000 Z-6.0697 F3000
+G1 X7.760 Y4.000 Z-6.0541 F3000
+G1 X7.780 Y4.000 Z-6.0386 F3000
+G1 X7.800 Y4.000 Z-6.0231 F3000
+G1 X7.820 Y4.000 Z-6.0077 F3000
+G1 X7.840 Y4.000 Z-5.9923 F3000
+G1 X7.860 Y4.000 Z-5.9769 F3000
+G1 X7.880 Y4.000 Z-5.9616 F3000
+G1 X7.900 Y4.000 Z-5.9463 F3000
+G1 X7.920 Y4.000 Z-5.9310 F3000
+G1 X7.940 Y4.000 Z-5.9158 F3000
+G1 X7.960 Y4.000 Z-5.9007 F3000
+G1 X7.980 Y4.000 Z-5.8856 F3000
+G1 X8.000 Y4.000 Z-5.8705 F3000
+G1 X8.020 Y4.000 Z-5.8554 F3000
+G1 X8.040 Y4.000 Z-5.8404 F3000
+G1 X8.060 Y4.000 Z-5.8254 F3000
+G1 X8.080 Y4.000 Z-5.8105 F3000
+G1 X8.100 Y4.000 Z-5.7956 F3000
+G1 X8.120 Y4.000 Z-5.7808 F3000
+G1 X8.140 Y4.000 Z-5.7660 F3000
+G1 X8.160 Y4.000 Z-5.7512 F3000
+G1 X8.180 Y4.000 Z-5.7365 F3000
+G1 X8.200 Y4.000 Z-5.7218 F3000
+G1 X8.220 Y4.000 Z-5.7071 F3000
+G1 X8.240 Y4.000 Z-5.6925 F3000
+G1 X8.260 Y4.000 Z-5.6779 F3000
+G1 X8.280 Y4.000 Z-5.6633 F3000
+G1 X8.300 Y4.000 Z-5.6488 F3000
+G1 X8.320 Y4.000 Z-5.6344 F3000
+G1 X8.340 Y4.000 Z-5.6199 F3000
+G1 X8.360 Y4.000 Z-5.6055 F3000
+G1 X8.380 Y4.000 Z-5.5912 F3000
+G1 X8.400 Y4.000 Z-5.5769 F3000
+G1 X8.420 Y4.000 Z-5.5626 F3000
+G1 X8.440 Y4.000 Z-5.5483 F3000
+G1 X8.460 Y4.000 Z-5.5341 F3000
+G1 X8.480 Y4.000 Z-5.5200 F3000
+G1 X8.500 Y4.000 Z-5.5058 F3000
+G1 X8.520 Y4.000 Z-5.4917 F3000
+G1 X8.540 Y4.000 Z-5.4777 F3000
+G1 X8.560 Y4.000 Z-5.4636 F3000
+G1 X8.580 Y4.000 Z-5.4497 F3000
+G1 X8.600 Y4.000 Z-5.4357 F3000
+G1 X8.620 Y4.000 Z-5.4218 F3000
+G1 X8.640 Y4.000 Z-5.4079 F3000
+G1 X8.660 Y4.000 Z-5.3941 F3000
+G1 X8.680 Y4.000 Z-5.3803 F3000
+G1 X8.700 Y4.000 Z-5.3665 F3000
+G1 X8.720 Y4.000 Z-5.3528 F3000
+G1 X8.740 Y4.000 Z-5.3391 F3000
+G1 X8.760 Y4.000 Z-5.3254 F3000
+G1 X8.780 Y4.000 Z-5.3118 F3000
+G1 X8.800 Y4.000 Z-5.2982 F3000
+G1 X8.820 Y4.000 Z-5.2846 F3000
+G1 X8.840 Y4.000 Z-5.2711 F3000
+G1 X8.860 Y4.000 Z-5.2576 F3000
+G1 X8.880 Y4.000 Z-5.2442 F3000
+G1 X8.900 Y4.000 Z-5.2308 F3000
+G1 X8.920 Y4.000 Z-5.2174 F3000
+G1 X8.940 Y4.000 Z-5.2040 F3000
+G1 X8.960 Y4.000 Z-5.1907 F3000
+G1 X8.980 Y4.000 Z-5.1774 F3000
+G1 X9.000 Y4.000 Z-5.1642 F3000
+G1 X9.020 Y4.000 Z-5.1510 F3000
+G1 X9.040 Y4.000 Z-5.1378 F3000
+G1 X9.060 Y4.000 Z-5.1247 F3000
+G1 X9.080 Y4.000 Z-5.1116 F3000
+G1 X9.100 Y4.000 Z-5.0985 F3000
+G1 X9.120 Y4.000 Z-5.0855 F3000
+G1 X9.140 Y4.000 Z-5.0725 F3000
+G1 X9.160 Y4.000 Z-5.0595 F3000
+G1 X9.180 Y4.000 Z-5.0466 F3000
+G1 X9.200 Y4.000 Z-5.0337 F3000
+G1 X9.220 Y4.000 Z-5.0208 F3000
+G1 X9.240 Y4.000 Z-5.0080 F3000
+G1 X9.260 Y4.000 Z-4.9952 F3000
+G1 X9.280 Y4.000 Z-4.9824 F3000
+G1 X9.300 Y4.000 Z-4.9697 F3000
+G1 X9.320 Y4.000 Z-4.9570 F3000
+G1 X9.340 Y4.000 Z-4.9443 F3000
+G1 X9.360 Y4.000 Z-4.9317 F3000
+G1 X9.380 Y4.000 Z-4.9191 F3000
+G1 X9.400 Y4.000 Z-4.9065 F3000
+G1 X9.420 Y4.000 Z-4.8940 F3000
+G1 X9.440 Y4.000 Z-4.8815 F3000
+G1 X9.460 Y4.000 Z-4.8690 F3000
+G1 X9.480 Y4.000 Z-4.8566 F3000
+G1 X9.500 Y4.000 Z-4.8442 F3000
+G1 X9.520 Y4.000 Z-4.8318 F3000
+G1 X9.540 Y4.000 Z-4.8195 F3000
+G1 X9.560 Y4.000 Z-4.8072 F3000
+G1 X9.580 Y4.000 Z-4.7949 F3000
+G1 X9.600 Y4.000 Z-4.7827 F3000
+G1 X9.620 Y4.000 Z-4.7704 F3000
+G1 X9.640 Y4.000 Z-4.7583 F3000
+G1 X9.660 Y4.000 Z-4.7461 F3000
+G1 X9.680 Y4.000 Z-4.7340 F3000
+G1 X9.700 Y4.000 Z-4.7219 F3000
+G1 X9.720 Y4.000 Z-4.7099 F3000
+G1 X9.740 Y4.000 Z-4.6979 F3000
+G1 X9.760 Y4.000 Z-4.6859 F3000
+G1 X9.780 Y4.000 Z-4.6739 F3000
+G1 X9.800 Y4.000 Z-4.6620 F3000
+G1 X9.820 Y4.000 Z-4.6501 F3000
+G1 X9.840 Y4.000 Z-4.6383 F3000
+G1 X9.860 Y4.000 Z-4.6265 F3000
+G1 X9.880 Y4.000 Z-4.6147 F3000
+G1 X9.900 Y4.000 Z-4.6029 F3000
+G1 X9.920 Y4.000 Z-4.5912 F3000
+G1 X9.940 Y4.000 Z-4.5795 F3000
+G1 X9.960 Y4.000 Z-4.5678 F3000
+G1 X9.980 Y4.000 Z-4.5562 F3000
+G1 X10.000 Y4.000 Z-4.5446 F3000
+G1 X10.020 Y4.000 Z-4.5330 F3000
+G1 X10.040 Y4.000 Z-4.5214 F3000
+G1 X10.060 Y4.000 Z-4.5099 F3000
+G1 X10.080 Y4.000 Z-4.4985 F3000
+G1 X10.100 Y4.000 Z-4.4870 F3000
+G1 X10.120 Y4.000 Z-4.4756 F3000
+G1 X10.140 Y4.000 Z-4.4642 F3000
+G1 X10.160 Y4.000 Z-4.4528 F3000
+G1 X10.180 Y4.000 Z-4.4415 F3000
+G1 X10.200 Y4.000 Z-4.4302 F3000
+G1 X10.220 Y4.000 Z-4.4189 F3000
+G1 X10.240 Y4.000 Z-4.4077 F3000
+G1 X10.260 Y4.000 Z-4.3965 F3000
+G1 X10.280 Y4.000 Z-4.3853 F3000
+G1 X10.300 Y4.000 Z-4.3742 F3000
+G1 X10.320 Y4.000 Z-4.3630 F3000
+G1 X10.340 Y4.000 Z-4.3520 F3000
+G1 X10.360 Y4.000 Z-4.3409 F3000
+G1 X10.380 Y4.000 Z-4.3299 F3000
+G1 X10.400 Y4.000 Z-4.3189 F3000
+G1 X10.420 Y4.000 Z-4.3079 F3000
+G1 X10.440 Y4.000 Z-4.2970 F3000
+G1 X10.460 Y4.000 Z-4.2861 F3000
+G1 X10.480 Y4.000 Z-4.2752 F3000
+G1 X10.500 Y4.000 Z-4.2643 F3000
+G1 X10.520 Y4.000 Z-4.2535 F3000
+G1 X10.540 Y4.000 Z-4.2427 F3000
+G1 X10.560 Y4.000 Z-4.2319 F3000
+G1 X10.580 Y4.000 Z-4.2212 F3000
+G1 X10.600 Y4.000 Z-4.2105 F3000
+G1 X10.620 Y4.000 Z-4.1998 F3000
+G1 X10.640 Y4.000 Z-4.1892 F3000
+G1 X10.660 Y4.000 Z-4.1786 F3000
+G1 X10.680 Y4.000 Z-4.1680 F3000
+G1 X10.700 Y4.000 Z-4.1574 F3000
+G1 X10.720 Y4.000 Z-4.1469 F3000
+G1 X10.740 Y4.000 Z-4.1364 F3000
+G1 X10.760 Y4.000 Z-4.1259 F3000
+G1 X10.780 Y4.000 Z-4.1155 F3000
+G1 X10.800 Y4.000 Z-4.1051 F3000
+G1 X10.820 Y4.000 Z-4.0947 F3000
+G1 X10.840 Y4.000 Z-4.0843 F3000
+G1 X10.860 Y4.000 Z-4.0740 F3000
+G1 X10.880 Y4.000 Z-4.0637 F3000
+G1 X10.900 Y4.000 Z-4.0535 F3000
+G1 X10.920 Y4.000 Z-4.0432 F3000
+G1 X10.940 Y4.000 Z-4.0330 F3000
+G1 X10.960 Y4.000 Z-4.0228 F3000
+G1 X10.980 Y4.000 Z-4.0127 F3000
+G1 X11.000 Y4.000 Z-4.0025 F3000
+G1 X11.020 Y4.000 Z-3.9924 F3000
+G1 X11.040 Y4.000 Z-3.9824 F3000
+G1 X11.060 Y4.000 Z-3.9723 F3000
+G1 X11.080 Y4.000 Z-3.9623 F3000
+G1 X11.100 Y4.000 Z-3.9523 F3000
+G1 X11.120 Y4.000 Z-3.9424 F3000
+G1 X11.140 Y4.000 Z-3.9324 F3000
+G1 X11.160 Y4.000 Z-3.9225 F3000
+G1 X11.180 Y4.000 Z-3.9126 F3000
+G1 X11.200 Y4.000 Z-3.9028 F3000
+G1 X11.220 Y4.000 Z-3.8930 F3000
+G1 X11.240 Y4.000 Z-3.8832 F3000
+G1 X11.260 Y4.000 Z-3.8734 F3000
+G1 X11.280 Y4.000 Z-3.8637 F3000
+G1 X11.300 Y4.000 Z-3.8540 F3000
+G1 X11.320 Y4.000 Z-3.8443 F3000
+G1 X11.340 Y4.000 Z-3.8346 F3000
+G1 X11.360 Y4.000 Z-3.8250 F3000
+G1 X11.380 Y4.000 Z-3.8154 F3000
+G1 X11.400 Y4.000 Z-3.8058 F3000
+G1 X11.420 Y4.000 Z-3.7963 F3000
+G1 X11.440 Y4.000 Z-3.7868 F3000
+G1 X11.460 Y4.000 Z-3.7773 F3000
+G1 X11.480 Y4.000 Z-3.7678 F3000
+G1 X11.500 Y4.000 Z-3.7584 F3000
+G1 X11.520 Y4.000 Z-3.7490 F3000
+G1 X11.540 Y4.000 Z-3.7396 F3000
+G1 X11.560 Y4.000 Z-3.7302 F3000
+G1 X11.580 Y4.000 Z-3.7209 F3000
+G1 X11.600 Y4.000 Z-3.7116 F3000
+G1 X11.620 Y4.000 Z-3.7023 F3000
+G1 X11.640 Y4.000 Z-3.6931 F3000
+G1 X11.660 Y4.000 Z-3.6839 F3000
+G1 X11.680 Y4.000 Z-3.6747 F3000
+G1 X11.700 Y4.000 Z-3.6655 F3000
+G1 X11.720 Y4.000 Z-3.6564 F3000
+G1 X11.740 Y4.000 Z-3.6472 F3000
+G1 X11.760 Y4.000 Z-3.6382 F3000
+G1 X11.780 Y4.000 Z-3.6291 F3000
+G1 X11.800 Y4.000 Z-3.6201 F3000
+G1 X11.820 Y4.000 Z-3.6111 F3000
+G1 X11.840 Y4.000 Z-3.6021 F3000
+G1 X11.860 Y4.000 Z-3.5931 F3000
+G1 X11.880 Y4.000 Z-3.5842 F3000
+G1 X11.900 Y4.000 Z-3.5753 F3000
+G1 X11.920 Y4.000 Z-3.5664 F3000
+G1 X11.940 Y4.000 Z-3.5576 F3000
+G1 X11.960 Y4.000 Z-3.5487 F3000
+G1 X11.980 Y4.000 Z-3.5399 F3000
+G1 X12.000 Y4.000 Z-3.5312 F3000
+G1 X12.020 Y4.000 Z-3.5224 F3000
+G1 X12.040 Y4.000 Z-3.5137 F3000
+G1 X12.060 Y4.000 Z-3.5050 F3000
+G1 X12.080 Y4.000 Z-3.4964 F3000
+G1 X12.100 Y4.000 Z-3.4877 F3000
+G1 X12.120 Y4.000 Z-3.4791 F3000
+G1 X12.140 Y4.000 Z-3.4705 F3000
+G1 X12.160 Y4.000 Z-3.4619 F3000
+G1 X12.180 Y4.000 Z-3.4534 F3000
+G1 X12.200 Y4.000 Z-3.4449 F3000
+G1 X12.220 Y4.000 Z-3.4364 F3000
+G1 X12.240 Y4.000 Z-3.4279 F3000
+G1 X12.260 Y4.000 Z-3.4195 F3000
+G1 X12.280 Y4.000 Z-3.4111 F3000
+G1 X12.300 Y4.000 Z-3.4027 F3000
+G1 X12.320 Y4.000 Z-3.3944 F3000
+G1 X12.340 Y4.000 Z-3.3860 F3000
+G1 X12.360 Y4.000 Z-3.3777 F3000
+G1 X12.380 Y4.000 Z-3.3694 F3000
+G1 X12.400 Y4.000 Z-3.3612 F3000
+G1 X12.420 Y4.000 Z-3.3530 F3000
+G1 X12.440 Y4.000 Z-3.3447 F3000
+G1 X12.460 Y4.000 Z-3.3366 F3000
+G1 X12.480 Y4.000 Z-3.3284 F3000
+G1 X12.500 Y4.000 Z-3.3203 F3000
+G1 X12.520 Y4.000 Z-3.3122 F3000
+G1 X12.540 Y4.000 Z-3.3041 F3000
+G1 X12.560 Y4.000 Z-3.2960 F3000
+G1 X12.580 Y4.000 Z-3.2880 F3000
+G1 X12.600 Y4.000 Z-3.2800 F3000
+G1 X12.620 Y4.000 Z-3.2720 F3000
+G1 X12.640 Y4.000 Z-3.2641 F3000
+G1 X12.660 Y4.000 Z-3.2561 F3000
+G1 X12.680 Y4.000 Z-3.2482 F3000
+G1 X12.700 Y4.000 Z-3.2404 F3000
+G1 X12.720 Y4.000 Z-3.2325 F3000
+G1 X12.740 Y4.000 Z-3.2247 F3000
+G1 X12.760 Y4.000 Z-3.2169 F3000
+G1 X12.780 Y4.000 Z-3.2091 F3000
+G1 X12.800 Y4.000 Z-3.2013 F3000
+G1 X12.820 Y4.000 Z-3.1936 F3000
+G1 X12.840 Y4.000 Z-3.1859 F3000
+G1 X12.860 Y4.000 Z-3.1782 F3000
+G1 X12.880 Y4.000 Z-3.1706 F3000
+G1 X12.900 Y4.000 Z-3.1629 F3000
+G1 X12.920 Y4.000 Z-3.1553 F3000
+G1 X12.940 Y4.000 Z-3.1478 F3000
+G1 X12.960 Y4.000 Z-3.1402 F3000
+G1 X12.980 Y4.000 Z-3.1327 F3000
+G1 X13.000 Y4.000 Z-3.1252 F3000
+G1 X13.020 Y4.000 Z-3.1177 F3000
+G1 X13.040 Y4.000 Z-3.1102 F3000
+G1 X13.060 Y4.000 Z-3.1028 F3000
+G1 X13.080 Y4.000 Z-3.0954 F3000
+G1 X13.100 Y4.000 Z-3.0880 F3000
+G1 X13.120 Y4.000 Z-3.0806 F3000
+G1 X13.140 Y4.000 Z-3.0733 F3000
+G1 X13.160 Y4.000 Z-3.0660 F3000
+G1 X13.180 Y4.000 Z-3.0587 F3000
+G1 X13.200 Y4.000 Z-3.0514 F3000
+G1 X13.220 Y4.000 Z-3.0442 F3000
+G1 X13.240 Y4.000 Z-3.0369 F3000
+G1 X13.260 Y4.000 Z-3.0297 F3000
+G1 X13.280 Y4.000 Z-3.0226 F3000
+G1 X13.300 Y4.000 Z-3.0154 F3000
+G1 X13.320 Y4.000 Z-3.0083 F3000
+G1 X13.340 Y4.000 Z-3.0012 F3000
+G1 X13.360 Y4.000 Z-2.9941 F3000
+G1 X13.380 Y4.000 Z-2.9871 F3000
+G1 X13.400 Y4.000 Z-2.9801 F3000
+G1 X13.420 Y4.000 Z-2.9731 F3000
+G1 X13.440 Y4.000 Z-2.9661 F3000
+G1 X13.460 Y4.000 Z-2.9591 F3000
+G1 X13.480 Y4.000 Z-2.9522 F3000
+G1 X13.500 Y4.000 Z-2.9453 F3000
+G1 X13.520 Y4.000 Z-2.9384 F3000
+G1 X13.540 Y4.000 Z-2.9316 F3000
+G1 X13.560 Y4.000 Z-2.9247 F3000
+G1 X13.580 Y4.000 Z-2.9179 F3000
+G1 X13.600 Y4.000 Z-2.9111 F3000
+G1 X13.620 Y4.000 Z-2.9043 F3000
+G1 X13.640 Y4.000 Z-2.8976 F3000
+G1 X13.660 Y4.000 Z-2.8909 F3000
+G1 X13.680 Y4.000 Z-2.8842 F3000
+G1 X13.700 Y4.000 Z-2.8775 F3000
+G1 X13.720 Y4.000 Z-2.8709 F3000
+G1 X13.740 Y4.000 Z-2.8643 F3000
+G1 X13.760 Y4.000 Z-2.8577 F3000
+G1 X13.780 Y4.000 Z-2.8511 F3000
+G1 X13.800 Y4.000 Z-2.8445 F3000
+G1 X13.820 Y4.000 Z-2.8380 F3000
+G1 X13.840 Y4.000 Z-2.8315 F3000
+G1 X13.860 Y4.000 Z-2.8250 F3000
+G1 X13.880 Y4.000 Z-2.8185 F3000
+G1 X13.900 Y4.000 Z-2.8121 F3000
+G1 X13.920 Y4.000 Z-2.8057 F3000
+G1 X13.940 Y4.000 Z-2.7993 F3000
+G1 X13.960 Y4.000 Z-2.7929 F3000
+G1 X13.980 Y4.000 Z-2.7866 F3000
+G1 X14.000 Y4.000 Z-2.7803 F3000
+G1 X14.020 Y4.000 Z-2.7740 F3000
+G1 X14.040 Y4.000 Z-2.7677 F3000
+G1 X14.060 Y4.000 Z-2.7614 F3000
+G1 X14.080 Y4.000 Z-2.7552 F3000
+G1 X14.100 Y4.000 Z-2.7490 F3000
+G1 X14.120 Y4.000 Z-2.7428 F3000
+G1 X14.140 Y4.000 Z-2.7367 F3000
+G1 X14.160 Y4.000 Z-2.7305 F3000
+G1 X14.180 Y4.000 Z-2.7244 F3000
+G1 X14.200 Y4.000 Z-2.7183 F3000
+G1 X14.220 Y4.000 Z-2.7123 F3000
+G1 X14.240 Y4.000 Z-2.7062 F3000
+G1 X14.260 Y4.000 Z-2.7002 F3000
+G1 X14.280 Y4.000 Z-2.6942 F3000
+G1 X14.300 Y4.000 Z-2.6882 F3000
+G1 X14.320 Y4.000 Z-2.6823 F3000
+G1 X14.340 Y4.000 Z-2.6763 F3000
+G1 X14.360 Y4.000 Z-2.6704 F3000
+G1 X14.380 Y4.000 Z-2.6645 F3000
+G1 X14.400 Y4.000 Z-2.6587 F3000
+G1 X14.420 Y4.000 Z-2.6528 F3000
+G1 X14.440 Y4.000 Z-2.6470 F3000
+G1 X14.460 Y4.000 Z-2.6412 F3000
+G1 X14.480 Y4.000 Z-2.6355 F3000
+G1 X14.500 Y4.000 Z-2.6297 F3000
+G1 X14.520 Y4.000 Z-2.6240 F3000
+G1 X14.540 Y4.000 Z-2.6183 F3000
+G1 X14.560 Y4.000 Z-2.6126 F3000
+G1 X14.580 Y4.000 Z-2.6069 F3000
+G1 X14.600 Y4.000 Z-2.6013 F3000
+G1 X14.620 Y4.000 Z-2.5957 F3000
+G1 X14.640 Y4.000 Z-2.5901 F3000
+G1 X14.660 Y4.000 Z-2.5845 F3000
+G1 X14.680 Y4.000 Z-2.5790 F3000
+G1 X14.700 Y4.000 Z-2.5735 F3000
+G1 X14.720 Y4.000 Z-2.5680 F3000
+G1 X14.740 Y4.000 Z-2.5625 F3000
+G1 X14.760 Y4.000 Z-2.5570 F3000
+G1 X14.780 Y4.000 Z-2.5516 F3000
+G1 X14.800 Y4.000 Z-2.5462 F3000
+G1 X14.820 Y4.000 Z-2.5408 F3000
+G1 X14.840 Y4.000 Z-2.5354 F3000
+G1 X14.860 Y4.000 Z-2.5301 F3000
+G1 X14.880 Y4.000 Z-2.5247 F3000
+G1 X14.900 Y4.000 Z-2.5194 F3000
+G1 X14.920 Y4.000 Z-2.5142 F3000
+G1 X14.940 Y4.000 Z-2.5089 F3000
+G1 X14.960 Y4.000 Z-2.5037 F3000
+G1 X14.980 Y4.000 Z-2.4985 F3000
+G1 X15.000 Y4.000 Z-2.4933 F3000
+G1 X15.020 Y4.000 Z-2.4881 F3000
+G1 X15.040 Y4.000 Z-2.4830 F3000
+G1 X15.060 Y4.000 Z-2.4778 F3000
+G1 X15.080 Y4.000 Z-2.4727 F3000
+G1 X15.100 Y4.000 Z-2.4676 F3000
+G1 X15.120 Y4.000 Z-2.4626 F3000
+G1 X15.140 Y4.000 Z-2.4575 F3000
+G1 X15.160 Y4.000 Z-2.4525 F3000
+G1 X15.180 Y4.000 Z-2.4475 F3000
+G1 X15.200 Y4.000 Z-2.4426 F3000
+G1 X15.220 Y4.000 Z-2.4376 F3000
+G1 X15.240 Y4.000 Z-2.4327 F3000
+G1 X15.260 Y4.000 Z-2.4278 F3000
+G1 X15.280 Y4.000 Z-2.4229 F3000
+G1 X15.300 Y4.000 Z-2.4180 F3000
+G1 X15.320 Y4.000 Z-2.4132 F3000
+G1 X15.340 Y4.000 Z-2.4084 F3000
+G1 X15.360 Y4.000 Z-2.4036 F3000
+G1 X15.380 Y4.000 Z-2.3988 F3000
+G1 X15.400 Y4.000 Z-2.3941 F3000
+G1 X15.420 Y4.000 Z-2.3893 F3000
+G1 X15.440 Y4.000 Z-2.3846 F3000
+G1 X15.460 Y4.000 Z-2.3799 F3000
+G1 X15.480 Y4.000 Z-2.3753 F3000
+G1 X15.500 Y4.000 Z-2.3706 F3000
+G1 X15.520 Y4.000 Z-2.3660 F3000
+G1 X15.540 Y4.000 Z-2.3614 F3000
+G1 X15.560 Y4.000 Z-2.3568 F3000
+G1 X15.580 Y4.000 Z-2.3523 F3000
+G1 X15.600 Y4.000 Z-2.3478 F3000
+G1 X15.620 Y4.000 Z-2.3432 F3000
+G1 X15.640 Y4.000 Z-2.3387 F3000
+G1 X15.660 Y4.000 Z-2.3343 F3000
+G1 X15.680 Y4.000 Z-2.3298 F3000
+G1 X15.700 Y4.000 Z-2.3254 F3000
+G1 X15.720 Y4.000 Z-2.3210 F3000
+G1 X15.740 Y4.000 Z-2.3166 F3000
+G1 X15.760 Y4.000 Z-2.3123 F3000
+G1 X15.780 Y4.000 Z-2.3079 F3000
+G1 X15.800 Y4.000 Z-2.3036 F3000
+G1 X15.820 Y4.000 Z-2.2993 F3000
+G1 X15.840 Y4.000 Z-2.2950 F3000
+G1 X15.860 Y4.000 Z-2.2908 F3000
+G1 X15.880 Y4.000 Z-2.2865 F3000
+G1 X15.900 Y4.000 Z-2.2823 F3000
+G1 X15.920 Y4.000 Z-2.2781 F3000
+G1 X15.940 Y4.000 Z-2.2740 F3000
+G1 X15.960 Y4.000 Z-2.2698 F3000
+G1 X15.980 Y4.000 Z-2.2657 F3000
+G1 X16.000 Y4.000 Z-2.2616 F3000
+G1 X16.020 Y4.000 Z-2.2575 F3000
+G1 X16.040 Y4.000 Z-2.2534 F3000
+G1 X16.060 Y4.000 Z-2.2494 F3000
+G1 X16.080 Y4.000 Z-2.2454 F3000
+G1 X16.100 Y4.000 Z-2.2414 F3000
+G1 X16.120 Y4.000 Z-2.2374 F3000
+G1 X16.140 Y4.000 Z-2.2334 F3000
+G1 X16.160 Y4.000 Z-2.2295 F3000
+G1 X16.180 Y4.000 Z-2.2256 F3000
+G1 X16.200 Y4.000 Z-2.2217 F3000
+G1 X16.220 Y4.000 Z-2.2178 F3000
+G1 X16.240 Y4.000 Z-2.2140 F3000
+G1 X16.260 Y4.000 Z-2.2101 F3000
+G1 X16.280 Y4.000 Z-2.2063 F3000
+G1 X16.300 Y4.000 Z-2.2026 F3000
+G1 X16.320 Y4.000 Z-2.1988 F3000
+G1 X16.340 Y4.000 Z-2.1950 F3000
+G1 X16.360 Y4.000 Z-2.1913 F3000
+G1 X16.380 Y4.000 Z-2.1876 F3000
+G1 X16.400 Y4.000 Z-2.1839 F3000
+G1 X16.420 Y4.000 Z-2.1803 F3000
+G1 X16.440 Y4.000 Z-2.1766 F3000
+G1 X16.460 Y4.000 Z-2.1730 F3000
+G1 X16.480 Y4.000 Z-2.1694 F3000
+G1 X16.500 Y4.000 Z-2.1658 F3000
+G1 X16.520 Y4.000 Z-2.1623 F3000
+G1 X16.540 Y4.000 Z-2.1588 F3000
+G1 X16.560 Y4.000 Z-2.1552 F3000
+G1 X16.580 Y4.000 Z-2.1518 F3000
+G1 X16.600 Y4.000 Z-2.1483 F3000
+G1 X16.620 Y4.000 Z-2.1448 F3000
+G1 X16.640 Y4.000 Z-2.1414 F3000
+G1 X16.660 Y4.000 Z-2.1380 F3000
+G1 X16.680 Y4.000 Z-2.1346 F3000
+G1 X16.700 Y4.000 Z-2.1312 F3000
+G1 X16.720 Y4.000 Z-2.1279 F3000
+G1 X16.740 Y4.000 Z-2.1246 F3000
+G1 X16.760 Y4.000 Z-2.1213 F3000
+G1 X16.780 Y4.000 Z-2.1180 F3000
+G1 X16.800 Y4.000 Z-2.1147 F3000
+G1 X16.820 Y4.000 Z-2.1115 F3000
+G1 X16.840 Y4.000 Z-2.1083 F3000
+G1 X16.860 Y4.000 Z-2.1051 F3000
+G1 X16.880 Y4.000 Z-2.1019 F3000
+G1 X16.900 Y4.000 Z-2.0987 F3000
+G1 X16.920 Y4.000 Z-2.0956 F3000
+G1 X16.940 Y4.000 Z-2.0925 F3000
+G1 X16.960 Y4.000 Z-2.0894 F3000
+G1 X16.980 Y4.000 Z-2.0863 F3000
+G1 X17.000 Y4.000 Z-2.0833 F3000
+G1 X17.020 Y4.000 Z-2.0802 F3000
+G1 X17.040 Y4.000 Z-2.0772 F3000
+G1 X17.060 Y4.000 Z-2.0742 F3000
+G1 X17.080 Y4.000 Z-2.0712 F3000
+G1 X17.100 Y4.000 Z-2.0683 F3000
+G1 X17.120 Y4.000 Z-2.0654 F3000
+G1 X17.140 Y4.000 Z-2.0625 F3000
+G1 X17.160 Y4.000 Z-2.0596 F3000
+G1 X17.180 Y4.000 Z-2.0567 F3000
+G1 X17.200 Y4.000 Z-2.0539 F3000
+G1 X17.220 Y4.000 Z-2.0510 F3000
+G1 X17.240 Y4.000 Z-2.0482 F3000
+G1 X17.260 Y4.000 Z-2.0454 F3000
+G1 X17.280 Y4.000 Z-2.0427 F3000
+G1 X17.300 Y4.000 Z-2.0399 F3000
+G1 X17.320 Y4.000 Z-2.0372 F3000
+G1 X17.340 Y4.000 Z-2.0345 F3000
+G1 X17.360 Y4.000 Z-2.0318 F3000
+G1 X17.380 Y4.000 Z-2.0292 F3000
+G1 X17.400 Y4.000 Z-2.0265 F3000
+G1 X17.420 Y4.000 Z-2.0239 F3000
+G1 X17.440 Y4.000 Z-2.0213 F3000
+G1 X17.460 Y4.000 Z-2.0187 F3000
+G1 X17.480 Y4.000 Z-2.0162 F3000
+G1 X17.500 Y4.000 Z-2.0136 F3000
+G1 X17.520 Y4.000 Z-2.0111 F3000
+G1 X17.540 Y4.000 Z-2.0086 F3000
+G1 X17.560 Y4.000 Z-2.0062 F3000
+G1 X17.580 Y4.000 Z-2.0037 F3000
+G1 X17.600 Y4.000 Z-2.0013 F3000
+G1 X17.620 Y4.000 Z-1.9988 F3000
+G1 X17.640 Y4.000 Z-1.9965 F3000
+G1 X17.660 Y4.000 Z-1.9941 F3000
+G1 X17.680 Y4.000 Z-1.9917 F3000
+G1 X17.700 Y4.000 Z-1.9894 F3000
+G1 X17.720 Y4.000 Z-1.9871 F3000
+G1 X17.740 Y4.000 Z-1.9848 F3000
+G1 X17.760 Y4.000 Z-1.9825 F3000
+G1 X17.780 Y4.000 Z-1.9803 F3000
+G1 X17.800 Y4.000 Z-1.9780 F3000
+G1 X17.820 Y4.000 Z-1.9758 F3000
+G1 X17.840 Y4.000 Z-1.9736 F3000
+G1 X17.860 Y4.000 Z-1.9715 F3000
+G1 X17.880 Y4.000 Z-1.9693 F3000
+G1 X17.900 Y4.000 Z-1.9672 F3000
+G1 X17.920 Y4.000 Z-1.9651 F3000
+G1 X17.940 Y4.000 Z-1.9630 F3000
+G1 X17.960 Y4.000 Z-1.9609 F3000
+G1 X17.980 Y4.000 Z-1.9589 F3000
+G1 X18.000 Y4.000 Z-1.9569 F3000
+G1 X18.020 Y4.000 Z-1.9549 F3000
+G1 X18.040 Y4.000 Z-1.9529 F3000
+G1 X18.060 Y4.000 Z-1.9509 F3000
+G1 X18.080 Y4.000 Z-1.9490 F3000
+G1 X18.100 Y4.000 Z-1.9470 F3000
+G1 X18.120 Y4.000 Z-1.9451 F3000
+G1 X18.140 Y4.000 Z-1.9433 F3000
+G1 X18.160 Y4.000 Z-1.9414 F3000
+G1 X18.180 Y4.000 Z-1.9395 F3000
+G1 X18.200 Y4.000 Z-1.9377 F3000
+G1 X18.220 Y4.000 Z-1.9359 F3000
+G1 X18.240 Y4.000 Z-1.9341 F3000
+G1 X18.260 Y4.000 Z-1.9324 F3000
+G1 X18.280 Y4.000 Z-1.9306 F3000
+G1 X18.300 Y4.000 Z-1.9289 F3000
+G1 X18.320 Y4.000 Z-1.9272 F3000
+G1 X18.340 Y4.000 Z-1.9255 F3000
+G1 X18.360 Y4.000 Z-1.9239 F3000
+G1 X18.380 Y4.000 Z-1.9222 F3000
+G1 X18.400 Y4.000 Z-1.9206 F3000
+G1 X18.420 Y4.000 Z-1.9190 F3000
+G1 X18.440 Y4.000 Z-1.9174 F3000
+G1 X18.460 Y4.000 Z-1.9159 F3000
+G1 X18.480 Y4.000 Z-1.9143 F3000
+G1 X18.500 Y4.000 Z-1.9128 F3000
+G1 X18.520 Y4.000 Z-1.9113 F3000
+G1 X18.540 Y4.000 Z-1.9098 F3000
+G1 X18.560 Y4.000 Z-1.9084 F3000
+G1 X18.580 Y4.000 Z-1.9069 F3000
+G1 X18.600 Y4.000 Z-1.9055 F3000
+G1 X18.620 Y4.000 Z-1.9041 F3000
+G1 X18.640 Y4.000 Z-1.9028 F3000
+G1 X18.660 Y4.000 Z-1.9014 F3000
+G1 X18.680 Y4.000 Z-1.9001 F3000
+G1 X18.700 Y4.000 Z-1.8987 F3000
+G1 X18.720 Y4.000 Z-1.8974 F3000
+G1 X18.740 Y4.000 Z-1.8962 F3000
+G1 X18.760 Y4.000 Z-1.8949 F3000
+G1 X18.780 Y4.000 Z-1.8937 F3000
+G1 X18.800 Y4.000 Z-1.8925 F3000
+G1 X18.820 Y4.000 Z-1.8913 F3000
+G1 X18.840 Y4.000 Z-1.8901 F3000
+G1 X18.860 Y4.000 Z-1.8889 F3000
+G1 X18.880 Y4.000 Z-1.8878 F3000
+G1 X18.900 Y4.000 Z-1.8867 F3000
+G1 X18.920 Y4.000 Z-1.8856 F3000
+G1 X18.940 Y4.000 Z-1.8845 F3000
+G1 X18.960 Y4.000 Z-1.8835 F3000
+G1 X18.980 Y4.000 Z-1.8824 F3000
+G1 X19.000 Y4.000 Z-1.8814 F3000
+G1 X19.020 Y4.000 Z-1.8804 F3000
+G1 X19.040 Y4.000 Z-1.8794 F3000
+G1 X19.060 Y4.000 Z-1.8785 F3000
+G1 X19.080 Y4.000 Z-1.8776 F3000
+G1 X19.100 Y4.000 Z-1.8766 F3000
+G1 X19.120 Y4.000 Z-1.8758 F3000
+G1 X19.140 Y4.000 Z-1.8749 F3000
+G1 X19.160 Y4.000 Z-1.8740 F3000
+G1 X19.180 Y4.000 Z-1.8732 F3000
+G1 X19.200 Y4.000 Z-1.8724 F3000
+G1 X19.220 Y4.000 Z-1.8716 F3000
+G1 X19.240 Y4.000 Z-1.8708 F3000
+G1 X19.260 Y4.000 Z-1.8701 F3000
+G1 X19.280 Y4.000 Z-1.8693 F3000
+G1 X19.300 Y4.000 Z-1.8686 F3000
+G1 X19.320 Y4.000 Z-1.8679 F3000
+G1 X19.340 Y4.000 Z-1.8673 F3000
+G1 X19.360 Y4.000 Z-1.8666 F3000
+G1 X19.380 Y4.000 Z-1.8660 F3000
+G1 X19.400 Y4.000 Z-1.8654 F3000
+G1 X19.420 Y4.000 Z-1.8648 F3000
+G1 X19.440 Y4.000 Z-1.8642 F3000
+G1 X19.460 Y4.000 Z-1.8636 F3000
+G1 X19.480 Y4.000 Z-1.8631 F3000
+G1 X19.500 Y4.000 Z-1.8626 F3000
+G1 X19.520 Y4.000 Z-1.8621 F3000
+G1 X19.540 Y4.000 Z-1.8616 F3000
+G1 X19.560 Y4.000 Z-1.8612 F3000
+G1 X19.580 Y4.000 Z-1.8608 F3000
+G1 X19.600 Y4.000 Z-1.8603 F3000
+G1 X19.620 Y4.000 Z-1.8599 F3000
+G1 X19.640 Y4.000 Z-1.8596 F3000
+G1 X19.660 Y4.000 Z-1.8592 F3000
+G1 X19.680 Y4.000 Z-1.8589 F3000
+G1 X19.700 Y4.000 Z-1.8586 F3000
+G1 X19.720 Y4.000 Z-1.8583 F3000
+G1 X19.740 Y4.000 Z-1.8580 F3000
+G1 X19.760 Y4.000 Z-1.8578 F3000
+G1 X19.780 Y4.000 Z-1.8575 F3000
+G1 X19.800 Y4.000 Z-1.8573 F3000
+G1 X19.820 Y4.000 Z-1.8571 F3000
+G1 X19.840 Y4.000 Z-1.8570 F3000
+G1 X19.860 Y4.000 Z-1.8568 F3000
+G1 X19.880 Y4.000 Z-1.8567 F3000
+G1 X19.900 Y4.000 Z-1.8566 F3000
+G1 X19.920 Y4.000 Z-1.8565 F3000
+G1 X19.940 Y4.000 Z-1.8564 F3000
+G1 X19.960 Y4.000 Z-1.8564 F3000
+G1 X19.980 Y4.000 Z-1.8563 F3000
+G1 X20.000 Y4.000 Z-1.8563 F3000
+G1 X20.020 Y4.000 Z-1.8563 F3000
+G1 X20.040 Y4.000 Z-1.8564 F3000
+G1 X20.060 Y4.000 Z-1.8564 F3000
+G1 X20.080 Y4.000 Z-1.8565 F3000
+G1 X20.100 Y4.000 Z-1.8566 F3000
+G1 X20.120 Y4.000 Z-1.8567 F3000
+G1 X20.140 Y4.000 Z-1.8568 F3000
+G1 X20.160 Y4.000 Z-1.8570 F3000
+G1 X20.180 Y4.000 Z-1.8571 F3000
+G1 X20.200 Y4.000 Z-1.8573 F3000
+G1 X20.220 Y4.000 Z-1.8575 F3000
+G1 X20.240 Y4.000 Z-1.8578 F3000
+G1 X20.260 Y4.000 Z-1.8580 F3000
+G1 X20.280 Y4.000 Z-1.8583 F3000
+G1 X20.300 Y4.000 Z-1.8586 F3000
+G1 X20.320 Y4.000 Z-1.8589 F3000
+G1 X20.340 Y4.000 Z-1.8592 F3000
+G1 X20.360 Y4.000 Z-1.8596 F3000
+G1 X20.380 Y4.000 Z-1.8599 F3000
+G1 X20.400 Y4.000 Z-1.8603 F3000
+G1 X20.420 Y4.000 Z-1.8608 F3000
+G1 X20.440 Y4.000 Z-1.8612 F3000
+G1 X20.460 Y4.000 Z-1.8616 F3000
+G1 X20.480 Y4.000 Z-1.8621 F3000
+G1 X20.500 Y4.000 Z-1.8626 F3000
+G1 X20.520 Y4.000 Z-1.8631 F3000
+G1 X20.540 Y4.000 Z-1.8636 F3000
+G1 X20.560 Y4.000 Z-1.8642 F3000
+G1 X20.580 Y4.000 Z-1.8648 F3000
+G1 X20.600 Y4.000 Z-1.8654 F3000
+G1 X20.620 Y4.000 Z-1.8660 F3000
+G1 X20.640 Y4.000 Z-1.8666 F3000
+G1 X20.660 Y4.000 Z-1.8673 F3000
+G1 X20.680 Y4.000 Z-1.8679 F3000
+G1 X20.700 Y4.000 Z-1.8686 F3000
+G1 X20.720 Y4.000 Z-1.8693 F3000
+G1 X20.740 Y4.000 Z-1.8701 F3000
+G1 X20.760 Y4.000 Z-1.8708 F3000
+G1 X20.780 Y4.000 Z-1.8716 F3000
+G1 X20.800 Y4.000 Z-1.8724 F3000
+G1 X20.820 Y4.000 Z-1.8732 F3000
+G1 X20.840 Y4.000 Z-1.8740 F3000
+G1 X20.860 Y4.000 Z-1.8749 F3000
+G1 X20.880 Y4.000 Z-1.8758 F3000
+G1 X20.900 Y4.000 Z-1.8766 F3000
+G1 X20.920 Y4.000 Z-1.8776 F3000
+G1 X20.940 Y4.000 Z-1.8785 F3000
+G1 X20.960 Y4.000 Z-1.8794 F3000
+G1 X20.980 Y4.000 Z-1.8804 F3000
+G1 X21.000 Y4.000 Z-1.8814 F3000
+G1 X21.020 Y4.000 Z-1.8824 F3000
+G1 X21.040 Y4.000 Z-1.8835 F3000
+G1 X21.060 Y4.000 Z-1.8845 F3000
+G1 X21.080 Y4.000 Z-1.8856 F3000
+G1 X21.100 Y4.000 Z-1.8867 F3000
+G1 X21.120 Y4.000 Z-1.8878 F3000
+G1 X21.140 Y4.000 Z-1.8889 F3000
+G1 X21.160 Y4.000 Z-1.8901 F3000
+G1 X21.180 Y4.000 Z-1.8913 F3000
+G1 X21.200 Y4.000 Z-1.8925 F3000
+G1 X21.220 Y4.000 Z-1.8937 F3000
+G1 X21.240 Y4.000 Z-1.8949 F3000
+G1 X21.260 Y4.000 Z-1.8962 F3000
+G1 X21.280 Y4.000 Z-1.8974 F3000
+G1 X21.300 Y4.000 Z-1.8987 F3000
+G1 X21.320 Y4.000 Z-1.9001 F3000
+G1 X21.340 Y4.000 Z-1.9014 F3000
+G1 X21.360 Y4.000 Z-1.9028 F3000
+G1 X21.380 Y4.000 Z-1.9041 F3000
+G1 X21.400 Y4.000 Z-1.9055 F3000
+G1 X21.420 Y4.000 Z-1.9069 F3000
+G1 X21.440 Y4.000 Z-1.9084 F3000
+G1 X21.460 Y4.000 Z-1.9098 F3000
+G1 X21.480 Y4.000 Z-1.9113 F3000
+G1 X21.500 Y4.000 Z-1.9128 F3000
+G1 X21.520 Y4.000 Z-1.9143 F3000
+G1 X21.540 Y4.000 Z-1.9159 F3000
+G1 X21.560 Y4.000 Z-1.9174 F3000
+G1 X21.580 Y4.000 Z-1.9190 F3000
+G1 X21.600 Y4.000 Z-1.9206 F3000
+G1 X21.620 Y4.000 Z-1.9222 F3000
+G1 X21.640 Y4.000 Z-1.9239 F3000
+G1 X21.660 Y4.000 Z-1.9255 F3000
+G1 X21.680 Y4.000 Z-1.9272 F3000
+G1 X21.700 Y4.000 Z-1.9289 F3000
+G1 X21.720 Y4.000 Z-1.9306 F3000
+G1 X21.740 Y4.000 Z-1.9324 F3000
+G1 X21.760 Y4.000 Z-1.9341 F3000
+G1 X21.780 Y4.000 Z-1.9359 F3000
+G1 X21.800 Y4.000 Z-1.9377 F3000
+G1 X21.820 Y4.000 Z-1.9395 F3000
+G1 X21.840 Y4.000 Z-1.9414 F3000
+G1 X21.860 Y4.000 Z-1.9433 F3000
+G1 X21.880 Y4.000 Z-1.9451 F3000
+G1 X21.900 Y4.000 Z-1.9470 F3000
+G1 X21.920 Y4.000 Z-1.9490 F3000
+G1 X21.940 Y4.000 Z-1.9509 F3000
+G1 X21.960 Y4.000 Z-1.9529 F3000
+G1 X21.980 Y4.000 Z-1.9549 F3000
+G1 X22.000 Y4.000 Z-1.9569 F3000
+G1 X22.020 Y4.000 Z-1.9589 F3000
+G1 X22.040 Y4.000 Z-1.9609 F3000
+G1 X22.060 Y4.000 Z-1.9630 F3000
+G1 X22.080 Y4.000 Z-1.9651 F3000
+G1 X22.100 Y4.000 Z-1.9672 F3000
+G1 X22.120 Y4.000 Z-1.9693 F3000
+G1 X22.140 Y4.000 Z-1.9715 F3000
+G1 X22.160 Y4.000 Z-1.9736 F3000
+G1 X22.180 Y4.000 Z-1.9758 F3000
+G1 X22.200 Y4.000 Z-1.9780 F3000
+G1 X22.220 Y4.000 Z-1.9803 F3000
+G1 X22.240 Y4.000 Z-1.9825 F3000
+G1 X22.260 Y4.000 Z-1.9848 F3000
+G1 X22.280 Y4.000 Z-1.9871 F3000
+G1 X22.300 Y4.000 Z-1.9894 F3000
+G1 X22.320 Y4.000 Z-1.9917 F3000
+G1 X22.340 Y4.000 Z-1.9941 F3000
+G1 X22.360 Y4.000 Z-1.9965 F3000
+G1 X22.380 Y4.000 Z-1.9988 F3000
+G1 X22.400 Y4.000 Z-2.0013 F3000
+G1 X22.420 Y4.000 Z-2.0037 F3000
+G1 X22.440 Y4.000 Z-2.0062 F3000
+G1 X22.460 Y4.000 Z-2.0086 F3000
+G1 X22.480 Y4.000 Z-2.0111 F3000
+G1 X22.500 Y4.000 Z-2.0136 F3000
+G1 X22.520 Y4.000 Z-2.0162 F3000
+G1 X22.540 Y4.000 Z-2.0187 F3000
+G1 X22.560 Y4.000 Z-2.0213 F3000
+G1 X22.580 Y4.000 Z-2.0239 F3000
+G1 X22.600 Y4.000 Z-2.0265 F3000
+G1 X22.620 Y4.000 Z-2.0292 F3000
+G1 X22.640 Y4.000 Z-2.0318 F3000
+G1 X22.660 Y4.000 Z-2.0345 F3000
+G1 X22.680 Y4.000 Z-2.0372 F3000
+G1 X22.700 Y4.000 Z-2.0399 F3000
+G1 X22.720 Y4.000 Z-2.0427 F3000
+G1 X22.740 Y4.000 Z-2.0454 F3000
+G1 X22.760 Y4.000 Z-2.0482 F3000
+G1 X22.780 Y4.000 Z-2.0510 F3000
+G1 X22.800 Y4.000 Z-2.0539 F3000
+G1 X22.820 Y4.000 Z-2.0567 F3000
+G1 X22.840 Y4.000 Z-2.0596 F3000
+G1 X22.860 Y4.000 Z-2.0625 F3000
+G1 X22.880 Y4.000 Z-2.0654 F3000
+G1 X22.900 Y4.000 Z-2.0683 F3000
+G1 X22.920 Y4.000 Z-2.0712 F3000
+G1 X22.940 Y4.000 Z-2.0742 F3000
+G1 X22.960 Y4.000 Z-2.0772 F3000
+G1 X22.980 Y4.000 Z-2.0802 F3000
+G1 X23.000 Y4.000 Z-2.0833 F3000
+G1 X23.020 Y4.000 Z-2.0863 F3000
+G1 X23.040 Y4.000 Z-2.0894 F3000
+G1 X23.060 Y4.000 Z-2.0925 F3000
+G1 X23.080 Y4.000 Z-2.0956 F3000
+G1 X23.100 Y4.000 Z-2.0987 F3000
+G1 X23.120 Y4.000 Z-2.1019 F3000
+G1 X23.140 Y4.000 Z-2.1051 F3000
+G1 X23.160 Y4.000 Z-2.1083 F3000
+G1 X23.180 Y4.000 Z-2.1115 F3000
+G1 X23.200 Y4.000 Z-2.1147 F3000
+G1 X23.220 Y4.000 Z-2.1180 F3000
+G1 X23.240 Y4.000 Z-2.1213 F3000
+G1 X23.260 Y4.000 Z-2.1246 F3000
+G1 X23.280 Y4.000 Z-2.1279 F3000
+G1 X23.300 Y4.000 Z-2.1312 F3000
+G1 X23.320 Y4.000 Z-2.1346 F3000
+G1 X23.340 Y4.000 Z-2.1380 F3000
+G1 X23.360 Y4.000 Z-2.1414 F3000
+G1 X23.380 Y4.000 Z-2.1448 F3000
+G1 X23.400 Y4.000 Z-2.1483 F3000
+G1 X23.420 Y4.000 Z-2.1518 F3000
+G1 X23.440 Y4.000 Z-2.1552 F3000
+G1 X23.460 Y4.000 Z-2.1588 F3000
+G1 X23.480 Y4.000 Z-2.1623 F3000
+G1 X23.500 Y4.000 Z-2.1658 F3000
+G1 X23.520 Y4.000 Z-2.1694 F3000
+G1 X23.540 Y4.000 Z-2.1730 F3000
+G1 X23.560 Y4.000 Z-2.1766 F3000
+G1 X23.580 Y4.000 Z-2.1803 F3000
+G1 X23.600 Y4.000 Z-2.1839 F3000
+G1 X23.620 Y4.000 Z-2.1876 F3000
+G1 X23.640 Y4.000 Z-2.1913 F3000
+G1 X23.660 Y4.000 Z-2.1950 F3000
+G1 X23.680 Y4.000 Z-2.1988 F3000
+G1 X23.700 Y4.000 Z-2.2026 F3000
+G1 X23.720 Y4.000 Z-2.2063 F3000
+G1 X23.740 Y4.000 Z-2.2101 F3000
+G1 X23.760 Y4.000 Z-2.2140 F3000
+G1 X23.780 Y4.000 Z-2.2178 F3000
+G1 X23.800 Y4.000 Z-2.2217 F3000
+G1 X23.820 Y4.000 Z-2.2256 F3000
+G1 X23.840 Y4.000 Z-2.2295 F3000
+G1 X23.860 Y4.000 Z-2.2334 F3000
+G1 X23.880 Y4.000 Z-2.2374 F3000
+G1 X23.900 Y4.000 Z-2.2414 F3000
+G1 X23.920 Y4.000 Z-2.2454 F3000
+G1 X23.940 Y4.000 Z-2.2494 F3000
+G1 X23.960 Y4.000 Z-2.2534 F3000
+G1 X23.980 Y4.000 Z-2.2575 F3000
+G1 X24.000 Y4.000 Z-2.2616 F3000
+G1 X24.020 Y4.000 Z-2.2657 F3000
+G1 X24.040 Y4.000 Z-2.2698 F3000
+G1 X24.060 Y4.000 Z-2.2740 F3000
+G1 X24.080 Y4.000 Z-2.2781 F3000
+G1 X24.100 Y4.000 Z-2.2823 F3000
+G1 X24.120 Y4.000 Z-2.2865 F3000
+G1 X24.140 Y4.000 Z-2.2908 F3000
+G1 X24.160 Y4.000 Z-2.2950 F3000
+G1 X24.180 Y4.000 Z-2.2993 F3000
+G1 X24.200 Y4.000 Z-2.3036 F3000
+G1 X24.220 Y4.000 Z-2.3079 F3000
+G1 X24.240 Y4.000 Z-2.3123 F3000
+G1 X24.260 Y4.000 Z-2.3166 F3000
+G1 X24.280 Y4.000 Z-2.3210 F3000
+G1 X24.300 Y4.000 Z-2.3254 F3000
+G1 X24.320 Y4.000 Z-2.3298 F3000
+G1 X24.340 Y4.000 Z-2.3343 F3000
+G1 X24.360 Y4.000 Z-2.3387 F3000
+G1 X24.380 Y4.000 Z-2.3432 F3000
+G1 X24.400 Y4.000 Z-2.3478 F3000
+G1 X24.420 Y4.000 Z-2.3523 F3000
+G1 X24.440 Y4.000 Z-2.3568 F3000
+G1 X24.460 Y4.000 Z-2.3614 F3000
+G1 X24.480 Y4.000 Z-2.3660 F3000
+G1 X24.500 Y4.000 Z-2.3706 F3000
+G1 X24.520 Y4.000 Z-2.3753 F3000
+G1 X24.540 Y4.000 Z-2.3799 F3000
+G1 X24.560 Y4.000 Z-2.3846 F3000
+G1 X24.580 Y4.000 Z-2.3893 F3000
+G1 X24.600 Y4.000 Z-2.3941 F3000
+G1 X24.620 Y4.000 Z-2.3988 F3000
+G1 X24.640 Y4.000 Z-2.4036 F3000
+G1 X24.660 Y4.000 Z-2.4084 F3000
+G1 X24.680 Y4.000 Z-2.4132 F3000
+G1 X24.700 Y4.000 Z-2.4180 F3000
+G1 X24.720 Y4.000 Z-2.4229 F3000
+G1 X24.740 Y4.000 Z-2.4278 F3000
+G1 X24.760 Y4.000 Z-2.4327 F3000
+G1 X24.780 Y4.000 Z-2.4376 F3000
+G1 X24.800 Y4.000 Z-2.4426 F3000
+G1 X24.820 Y4.000 Z-2.4475 F3000
+G1 X24.840 Y4.000 Z-2.4525 F3000
+G1 X24.860 Y4.000 Z-2.4575 F3000
+G1 X24.880 Y4.000 Z-2.4626 F3000
+G1 X24.900 Y4.000 Z-2.4676 F3000
+G1 X24.920 Y4.000 Z-2.4727 F3000
+G1 X24.940 Y4.000 Z-2.4778 F3000
+G1 X24.960 Y4.000 Z-2.4830 F3000
+G1 X24.980 Y4.000 Z-2.4881 F3000
+G1 X25.000 Y4.000 Z-2.4933 F3000
+G1 X25.020 Y4.000 Z-2.4985 F3000
+G1 X25.040 Y4.000 Z-2.5037 F3000
+G1 X25.060 Y4.000 Z-2.5089 F3000
+G1 X25.080 Y4.000 Z-2.5142 F3000
+G1 X25.100 Y4.000 Z-2.5194 F3000
+G1 X25.120 Y4.000 Z-2.5247 F3000
+G1 X25.140 Y4.000 Z-2.5301 F3000
+G1 X25.160 Y4.000 Z-2.5354 F3000
+G1 X25.180 Y4.000 Z-2.5408 F3000
+G1 X25.200 Y4.000 Z-2.5462 F3000
+G1 X25.220 Y4.000 Z-2.5516 F3000
+G1 X25.240 Y4.000 Z-2.5570 F3000
+G1 X25.260 Y4.000 Z-2.5625 F3000
+G1 X25.280 Y4.000 Z-2.5680 F3000
+G1 X25.300 Y4.000 Z-2.5735 F3000
+G1 X25.320 Y4.000 Z-2.5790 F3000
+G1 X25.340 Y4.000 Z-2.5845 F3000
+G1 X25.360 Y4.000 Z-2.5901 F3000
+G1 X25.380 Y4.000 Z-2.5957 F3000
+G1 X25.400 Y4.000 Z-2.6013 F3000
+G1 X25.420 Y4.000 Z-2.6069 F3000
+G1 X25.440 Y4.000 Z-2.6126 F3000
+G1 X25.460 Y4.000 Z-2.6183 F3000
+G1 X25.480 Y4.000 Z-2.6240 F3000
+G1 X25.500 Y4.000 Z-2.6297 F3000
+G1 X25.520 Y4.000 Z-2.6355 F3000
+G1 X25.540 Y4.000 Z-2.6412 F3000
+G1 X25.560 Y4.000 Z-2.6470 F3000
+G1 X25.580 Y4.000 Z-2.6528 F3000
+G1 X25.600 Y4.000 Z-2.6587 F3000
+G1 X25.620 Y4.000 Z-2.6645 F3000
+G1 X25.640 Y4.000 Z-2.6704 F3000
+G1 X25.660 Y4.000 Z-2.6763 F3000
+G1 X25.680 Y4.000 Z-2.6823 F3000
+G1 X25.700 Y4.000 Z-2.6882 F3000
+G1 X25.720 Y4.000 Z-2.6942 F3000
+G1 X25.740 Y4.000 Z-2.7002 F3000
+G1 X25.760 Y4.000 Z-2.7062 F3000
+G1 X25.780 Y4.000 Z-2.7123 F3000
+G1 X25.800 Y4.000 Z-2.7183 F3000
+G1 X25.820 Y4.000 Z-2.7244 F3000
+G1 X25.840 Y4.000 Z-2.7305 F3000
+G1 X25.860 Y4.000 Z-2.7367 F3000
+G1 X25.880 Y4.000 Z-2.7428 F3000
+G1 X25.900 Y4.000 Z-2.7490 F3000
+G1 X25.920 Y4.000 Z-2.7552 F3000
+G1 X25.940 Y4.000 Z-2.7614 F3000
+G1 X25.960 Y4.000 Z-2.7677 F3000
+G1 X25.980 Y4.000 Z-2.7740 F3000
+G1 X26.000 Y4.000 Z-2.7803 F3000
+G1 X26.020 Y4.000 Z-2.7866 F3000
+G1 X26.040 Y4.000 Z-2.7929 F3000
+G1 X26.060 Y4.000 Z-2.7993 F3000
+G1 X26.080 Y4.000 Z-2.8057 F3000
+G1 X26.100 Y4.000 Z-2.8121 F3000
+G1 X26.120 Y4.000 Z-2.8185 F3000
+G1 X26.140 Y4.000 Z-2.8250 F3000
+G1 X26.160 Y4.000 Z-2.8315 F3000
+G1 X26.180 Y4.000 Z-2.8380 F3000
+G1 X26.200 Y4.000 Z-2.8445 F3000
+G1 X26.220 Y4.000 Z-2.8511 F3000
+G1 X26.240 Y4.000 Z-2.8577 F3000
+G1 X26.260 Y4.000 Z-2.8643 F3000
+G1 X26.280 Y4.000 Z-2.8709 F3000
+G1 X26.300 Y4.000 Z-2.8775 F3000
+G1 X26.320 Y4.000 Z-2.8842 F3000
+G1 X26.340 Y4.000 Z-2.8909 F3000
+G1 X26.360 Y4.000 Z-2.8976 F3000
+G1 X26.380 Y4.000 Z-2.9043 F3000
+G1 X26.400 Y4.000 Z-2.9111 F3000
+G1 X26.420 Y4.000 Z-2.9179 F3000
+G1 X26.440 Y4.000 Z-2.9247 F3000
+G1 X26.460 Y4.000 Z-2.9316 F3000
+G1 X26.480 Y4.000 Z-2.9384 F3000
+G1 X26.500 Y4.000 Z-2.9453 F3000
+G1 X26.520 Y4.000 Z-2.9522 F3000
+G1 X26.540 Y4.000 Z-2.9591 F3000
+G1 X26.560 Y4.000 Z-2.9661 F3000
+G1 X26.580 Y4.000 Z-2.9731 F3000
+G1 X26.600 Y4.000 Z-2.9801 F3000
+G1 X26.620 Y4.000 Z-2.9871 F3000
+G1 X26.640 Y4.000 Z-2.9941 F3000
+G1 X26.660 Y4.000 Z-3.0012 F3000
+G1 X26.680 Y4.000 Z-3.0083 F3000
+G1 X26.700 Y4.000 Z-3.0154 F3000
+G1 X26.720 Y4.000 Z-3.0226 F3000
+G1 X26.740 Y4.000 Z-3.0297 F3000
+G1 X26.760 Y4.000 Z-3.0369 F3000
+G1 X26.780 Y4.000 Z-3.0442 F3000
+G1 X26.800 Y4.000 Z-3.0514 F3000
+G1 X26.820 Y4.000 Z-3.0587 F3000
+G1 X26.840 Y4.000 Z-3.0660 F3000
+G1 X26.860 Y4.000 Z-3.0733 F3000
+G1 X26.880 Y4.000 Z-3.0806 F3000
+G1 X26.900 Y4.000 Z-3.0880 F3000
+G1 X26.920 Y4.000 Z-3.0954 F3000
+G1 X26.940 Y4.000 Z-3.1028 F3000
+G1 X26.960 Y4.000 Z-3.1102 F3000
+G1 X26.980 Y4.000 Z-3.1177 F3000
+G1 X27.000 Y4.000 Z-3.1252 F3000
+G1 X27.020 Y4.000 Z-3.1327 F3000
+G1 X27.040 Y4.000 Z-3.1402 F3000
+G1 X27.060 Y4.000 Z-3.1478 F3000
+G1 X27.080 Y4.000 Z-3.1553 F3000
+G1 X27.100 Y4.000 Z-3.1629 F3000
+G1 X27.120 Y4.000 Z-3.1706 F3000
+G1 X27.140 Y4.000 Z-3.1782 F3000
+G1 X27.160 Y4.000 Z-3.1859 F3000
+G1 X27.180 Y4.000 Z-3.1936 F3000
+G1 X27.200 Y4.000 Z-3.2013 F3000
+G1 X27.220 Y4.000 Z-3.2091 F3000
+G1 X27.240 Y4.000 Z-3.2169 F3000
+G1 X27.260 Y4.000 Z-3.2247 F3000
+G1 X27.280 Y4.000 Z-3.2325 F3000
+G1 X27.300 Y4.000 Z-3.2404 F3000
+G1 X27.320 Y4.000 Z-3.2482 F3000
+G1 X27.340 Y4.000 Z-3.2561 F3000
+G1 X27.360 Y4.000 Z-3.2641 F3000
+G1 X27.380 Y4.000 Z-3.2720 F3000
+G1 X27.400 Y4.000 Z-3.2800 F3000
+G1 X27.420 Y4.000 Z-3.2880 F3000
+G1 X27.440 Y4.000 Z-3.2960 F3000
+G1 X27.460 Y4.000 Z-3.3041 F3000
+G1 X27.480 Y4.000 Z-3.3122 F3000
+G1 X27.500 Y4.000 Z-3.3203 F3000
+G1 X27.520 Y4.000 Z-3.3284 F3000
+G1 X27.540 Y4.000 Z-3.3366 F3000
+G1 X27.560 Y4.000 Z-3.3447 F3000
+G1 X27.580 Y4.000 Z-3.3530 F3000
+G1 X27.600 Y4.000 Z-3.3612 F3000
+G1 X27.620 Y4.000 Z-3.3694 F3000
+G1 X27.640 Y4.000 Z-3.3777 F3000
+G1 X27.660 Y4.000 Z-3.3860 F3000
+G1 X27.680 Y4.000 Z-3.3944 F3000
+G1 X27.700 Y4.000 Z-3.4027 F3000
+G1 X27.720 Y4.000 Z-3.4111 F3000
+G1 X27.740 Y4.000 Z-3.4195 F3000
+G1 X27.760 Y4.000 Z-3.4279 F3000
+G1 X27.780 Y4.000 Z-3.4364 F3000
+G1 X27.800 Y4.000 Z-3.4449 F3000
+G1 X27.820 Y4.000 Z-3.4534 F3000
+G1 X27.840 Y4.000 Z-3.4619 F3000
+G1 X27.860 Y4.000 Z-3.4705 F3000
+G1 X27.880 Y4.000 Z-3.4791 F3000
+G1 X27.900 Y4.000 Z-3.4877 F3000
+G1 X27.920 Y4.000 Z-3.4964 F3000
+G1 X27.940 Y4.000 Z-3.5050 F3000
+G1 X27.960 Y4.000 Z-3.5137 F3000
+G1 X27.980 Y4.000 Z-3.5224 F3000
+G1 X28.000 Y4.000 Z-3.5312 F3000
+G1 X28.020 Y4.000 Z-3.5399 F3000
+G1 X28.040 Y4.000 Z-3.5487 F3000
+G1 X28.060 Y4.000 Z-3.5576 F3000
+G1 X28.080 Y4.000 Z-3.5664 F3000
+G1 X28.100 Y4.000 Z-3.5753 F3000
+G1 X28.120 Y4.000 Z-3.5842 F3000
+G1 X28.140 Y4.000 Z-3.5931 F3000
+G1 X28.160 Y4.000 Z-3.6021 F3000
+G1 X28.180 Y4.000 Z-3.6111 F3000
+G1 X28.200 Y4.000 Z-3.6201 F3000
+G1 X28.220 Y4.000 Z-3.6291 F3000
+G1 X28.240 Y4.000 Z-3.6382 F3000
+G1 X28.260 Y4.000 Z-3.6472 F3000
+G1 X28.280 Y4.000 Z-3.6564 F3000
+G1 X28.300 Y4.000 Z-3.6655 F3000
+G1 X28.320 Y4.000 Z-3.6747 F3000
+G1 X28.340 Y4.000 Z-3.6839 F3000
+G1 X28.360 Y4.000 Z-3.6931 F3000
+G1 X28.380 Y4.000 Z-3.7023 F3000
+G1 X28.400 Y4.000 Z-3.7116 F3000
+G1 X28.420 Y4.000 Z-3.7209 F3000
+G1 X28.440 Y4.000 Z-3.7302 F3000
+G1 X28.460 Y4.000 Z-3.7396 F3000
+G1 X28.480 Y4.000 Z-3.7490 F3000
+G1 X28.500 Y4.000 Z-3.7584 F3000
+G1 X28.520 Y4.000 Z-3.7678 F3000
+G1 X28.540 Y4.000 Z-3.7773 F3000
+G1 X28.560 Y4.000 Z-3.7868 F3000
+G1 X28.580 Y4.000 Z-3.7963 F3000
+G1 X28.600 Y4.000 Z-3.8058 F3000
+G1 X28.620 Y4.000 Z-3.8154 F3000
+G1 X28.640 Y4.000 Z-3.8250 F3000
+G1 X28.660 Y4.000 Z-3.8346 F3000
+G1 X28.680 Y4.000 Z-3.8443 F3000
+G1 X28.700 Y4.000 Z-3.8540 F3000
+G1 X28.720 Y4.000 Z-3.8637 F3000
+G1 X28.740 Y4.000 Z-3.8734 F3000
+G1 X28.760 Y4.000 Z-3.8832 F3000
+G1 X28.780 Y4.000 Z-3.8930 F3000
+G1 X28.800 Y4.000 Z-3.9028 F3000
+G1 X28.820 Y4.000 Z-3.9126 F3000
+G1 X28.840 Y4.000 Z-3.9225 F3000
+G1 X28.860 Y4.000 Z-3.9324 F3000
+G1 X28.880 Y4.000 Z-3.9424 F3000
+G1 X28.900 Y4.000 Z-3.9523 F3000
+G1 X28.920 Y4.000 Z-3.9623 F3000
+G1 X28.940 Y4.000 Z-3.9723 F3000
+G1 X28.960 Y4.000 Z-3.9824 F3000
+G1 X28.980 Y4.000 Z-3.9924 F3000
+G1 X29.000 Y4.000 Z-4.0025 F3000
+G1 X29.020 Y4.000 Z-4.0127 F3000
+G1 X29.040 Y4.000 Z-4.0228 F3000
+G1 X29.060 Y4.000 Z-4.0330 F3000
+G1 X29.080 Y4.000 Z-4.0432 F3000
+G1 X29.100 Y4.000 Z-4.0535 F3000
+G1 X29.120 Y4.000 Z-4.0637 F3000
+G1 X29.140 Y4.000 Z-4.0740 F3000
+G1 X29.160 Y4.000 Z-4.0843 F3000
+G1 X29.180 Y4.000 Z-4.0947 F3000
+G1 X29.200 Y4.000 Z-4.1051 F3000
+G1 X29.220 Y4.000 Z-4.1155 F3000
+G1 X29.240 Y4.000 Z-4.1259 F3000
+G1 X29.260 Y4.000 Z-4.1364 F3000
+G1 X29.280 Y4.000 Z-4.1469 F3000
+G1 X29.300 Y4.000 Z-4.1574 F3000
+G1 X29.320 Y4.000 Z-4.1680 F3000
+G1 X29.340 Y4.000 Z-4.1786 F3000
+G1 X29.360 Y4.000 Z-4.1892 F3000
+G1 X29.380 Y4.000 Z-4.1998 F3000
+G1 X29.400 Y4.000 Z-4.2105 F3000
+G1 X29.420 Y4.000 Z-4.2212 F3000
+G1 X29.440 Y4.000 Z-4.2319 F3000
+G1 X29.460 Y4.000 Z-4.2427 F3000
+G1 X29.480 Y4.000 Z-4.2535 F3000
+G1 X29.500 Y4.000 Z-4.2643 F3000
+G1 X29.520 Y4.000 Z-4.2752 F3000
+G1 X29.540 Y4.000 Z-4.2861 F3000
+G1 X29.560 Y4.000 Z-4.2970 F3000
+G1 X29.580 Y4.000 Z-4.3079 F3000
+G1 X29.600 Y4.000 Z-4.3189 F3000
+G1 X29.620 Y4.000 Z-4.3299 F3000
+G1 X29.640 Y4.000 Z-4.3409 F3000
+G1 X29.660 Y4.000 Z-4.3520 F3000
+G1 X29.680 Y4.000 Z-4.3630 F3000
+G1 X29.700 Y4.000 Z-4.3742 F3000
+G1 X29.720 Y4.000 Z-4.3853 F3000
+G1 X29.740 Y4.000 Z-4.3965 F3000
+G1 X29.760 Y4.000 Z-4.4077 F3000
+G1 X29.780 Y4.000 Z-4.4189 F3000
+G1 X29.800 Y4.000 Z-4.4302 F3000
+G1 X29.820 Y4.000 Z-4.4415 F3000
+G1 X29.840 Y4.000 Z-4.4528 F3000
+G1 X29.860 Y4.000 Z-4.4642 F3000
+G1 X29.880 Y4.000 Z-4.4756 F3000
+G1 X29.900 Y4.000 Z-4.4870 F3000
+G1 X29.920 Y4.000 Z-4.4985 F3000
+G1 X29.940 Y4.000 Z-4.5099 F3000
+G1 X29.960 Y4.000 Z-4.5214 F3000
+G1 X29.980 Y4.000 Z-4.5330 F3000
+G1 X30.000 Y4.000 Z-4.5446 F3000
+G1 X30.020 Y4.000 Z-4.5562 F3000
+G1 X30.040 Y4.000 Z-4.5678 F3000
+G1 X30.060 Y4.000 Z-4.5795 F3000
+G1 X30.080 Y4.000 Z-4.5912 F3000
+G1 X30.100 Y4.000 Z-4.6029 F3000
+G1 X30.120 Y4.000 Z-4.6147 F3000
+G1 X30.140 Y4.000 Z-4.6265 F3000
+G1 X30.160 Y4.000 Z-4.6383 F3000
+G1 X30.180 Y4.000 Z-4.6501 F3000
+G1 X30.200 Y4.000 Z-4.6620 F3000
+G1 X30.220 Y4.000 Z-4.6739 F3000
+G1 X30.240 Y4.000 Z-4.6859 F3000
+G1 X30.260 Y4.000 Z-4.6979 F3000
+G1 X30.280 Y4.000 Z-4.7099 F3000
+G1 X30.300 Y4.000 Z-4.7219 F3000
+G1 X30.320 Y4.000 Z-4.7340 F3000
+G1 X30.340 Y4.000 Z-4.7461 F3000
+G1 X30.360 Y4.000 Z-4.7583 F3000
+G1 X30.380 Y4.000 Z-4.7704 F3000
+G1 X30.400 Y4.000 Z-4.7827 F3000
+G1 X30.420 Y4.000 Z-4.7949 F3000
+G1 X30.440 Y4.000 Z-4.8072 F3000
+G1 X30.460 Y4.000 Z-4.8195 F3000
+G1 X30.480 Y4.000 Z-4.8318 F3000
+G1 X30.500 Y4.000 Z-4.8442 F3000
+G1 X30.520 Y4.000 Z-4.8566 F3000
+G1 X30.540 Y4.000 Z-4.8690 F3000
+G1 X30.560 Y4.000 Z-4.8815 F3000
+G1 X30.580 Y4.000 Z-4.8940 F3000
+G1 X30.600 Y4.000 Z-4.9065 F3000
+G1 X30.620 Y4.000 Z-4.9191 F3000
+G1 X30.640 Y4.000 Z-4.9317 F3000
+G1 X30.660 Y4.000 Z-4.9443 F3000
+G1 X30.680 Y4.000 Z-4.9570 F3000
+G1 X30.700 Y4.000 Z-4.9697 F3000
+G1 X30.720 Y4.000 Z-4.9824 F3000
+G1 X30.740 Y4.000 Z-4.9952 F3000
+G1 X30.760 Y4.000 Z-5.0080 F3000
+G1 X30.780 Y4.000 Z-5.0208 F3000
+G1 X30.800 Y4.000 Z-5.0337 F3000
+G1 X30.820 Y4.000 Z-5.0466 F3000
+G1 X30.840 Y4.000 Z-5.0595 F3000
+G1 X30.860 Y4.000 Z-5.0725 F3000
+G1 X30.880 Y4.000 Z-5.0855 F3000
+G1 X30.900 Y4.000 Z-5.0985 F3000
+G1 X30.920 Y4.000 Z-5.1116 F3000
+G1 X30.940 Y4.000 Z-5.1247 F3000
+G1 X30.960 Y4.000 Z-5.1378 F3000
+G1 X30.980 Y4.000 Z-5.1510 F3000
+G1 X31.000 Y4.000 Z-5.1642 F3000
+G1 X31.020 Y4.000 Z-5.1774 F3000
+G1 X31.040 Y4.000 Z-5.1907 F3000
+G1 X31.060 Y4.000 Z-5.2040 F3000
+G1 X31.080 Y4.000 Z-5.2174 F3000
+G1 X31.100 Y4.000 Z-5.2308 F3000
+G1 X31.120 Y4.000 Z-5.2442 F3000
+G1 X31.140 Y4.000 Z-5.2576 F3000
+G1 X31.160 Y4.000 Z-5.2711 F3000
+G1 X31.180 Y4.000 Z-5.2846 F3000
+G1 X31.200 Y4.000 Z-5.2982 F3000
+G1 X31.220 Y4.000 Z-5.3118 F3000
+G1 X31.240 Y4.000 Z-5.3254 F3000
+G1 X31.260 Y4.000 Z-5.3391 F3000
+G1 X31.280 Y4.000 Z-5.3528 F3000
+G1 X31.300 Y4.000 Z-5.3665 F3000
+G1 X31.320 Y4.000 Z-5.3803 F3000
+G1 X31.340 Y4.000 Z-5.3941 F3000
+G1 X31.360 Y4.000 Z-5.4079 F3000
+G1 X31.380 Y4.000 Z-5.4218 F3000
+G1 X31.400 Y4.000 Z-5.4357 F3000
+G1 X31.420 Y4.000 Z-5.4497 F3000
+G1 X31.440 Y4.000 Z-5.4636 F3000
+G1 X31.460 Y4.000 Z-5.4777 F3000
+G1 X31.480 Y4.000 Z-5.4917 F3000
+G1 X31.500 Y4.000 Z-5.5058 F3000
+G1 X31.520 Y4.000 Z-5.5200 F3000
+G1 X31.540 Y4.000 Z-5.5341 F3000
+G1 X31.560 Y4.000 Z-5.5483 F3000
+G1 X31.580 Y4.000 Z-5.5626 F3000
+G1 X31.600 Y4.000 Z-5.5769 F3000
+G1 X31.620 Y4.000 Z-5.5912 F3000
+G1 X31.640 Y4.000 Z-5.6055 F3000
+G1 X31.660 Y4.000 Z-5.6199 F3000
+G1 X31.680 Y4.000 Z-5.6344 F3000
+G1 X31.700 Y4.000 Z-5.6488 F3000
+G1 X31.720 Y4.000 Z-5.6633 F3000
+G1 X31.740 Y4.000 Z-5.6779 F3000
+G1 X31.760 Y4.000 Z-5.6925 F3000
+G1 X31.780 Y4.000 Z-5.7071 F3000
+G1 X31.800 Y4.000 Z-5.7218 F3000
+G1 X31.820 Y4.000 Z-5.7365 F3000
+G1 X31.840 Y4.000 Z-5.7512 F3000
+G1 X31.860 Y4.000 Z-5.7660 F3000
+G1 X31.880 Y4.000 Z-5.7808 F3000
+G1 X31.900 Y4.000 Z-5.7956 F3000
+G1 X31.920 Y4.000 Z-5.8105 F3000
+G1 X31.940 Y4.000 Z-5.8254 F3000
+G1 X31.960 Y4.000 Z-5.8404 F3000
+G1 X31.980 Y4.000 Z-5.8554 F3000
+G1 X32.000 Y4.000 Z-5.8705 F3000
+G1 X32.020 Y4.000 Z-5.8856 F3000
+G1 X32.040 Y4.000 Z-5.9007 F3000
+G1 X32.060 Y4.000 Z-5.9158 F3000
+G1 X32.080 Y4.000 Z-5.9310 F3000
+G1 X32.100 Y4.000 Z-5.9463 F3000
+G1 X32.120 Y4.000 Z-5.9616 F3000
+G1 X32.140 Y4.000 Z-5.9769 F3000
+G1 X32.160 Y4.000 Z-5.9923 F3000
+G1 X32.180 Y4.000 Z-6.0077 F3000
+G1 X32.200 Y4.000 Z-6.0231 F3000
+G1 X32.220 Y4.000 Z-6.0386 F3000
+G1 X32.240 Y4.000 Z-6.0541 F3000
+G1 X32.260 Y4.000 Z-6.0697 F3000
+G1 X32.280 Y4.000 Z-6.0853 F3000
+G1 X32.300 Y4.000 Z-6.1010 F3000
+G1 X32.320 Y4.000 Z-6.1166 F3000
+G1 X32.340 Y4.000 Z-6.1324 F3000
+G1 X32.360 Y4.000 Z-6.1482 F3000
+G1 X32.380 Y4.000 Z-6.1640 F3000
+G1 X32.400 Y4.000 Z-6.1798 F3000
+G1 X32.420 Y4.000 Z-6.1957 F3000
+G1 X32.440 Y4.000 Z-6.2117 F3000
+G1 X32.460 Y4.000 Z-6.2276 F3000
+G1 X32.480 Y4.000 Z-6.2437 F3000
+G1 X32.500 Y4.000 Z-6.2597 F3000
+G1 X32.520 Y4.000 Z-6.2758 F3000
+G1 X32.540 Y4.000 Z-6.2920 F3000
+G1 X32.560 Y4.000 Z-6.3082 F3000
+G1 X32.580 Y4.000 Z-6.3244 F3000
+G1 X32.600 Y4.000 Z-6.3407 F3000
+G1 X32.620 Y4.000 Z-6.3570 F3000
+G1 X32.640 Y4.000 Z-6.3734 F3000
+G1 X32.660 Y4.000 Z-6.3898 F3000
+G1 X32.680 Y4.000 Z-6.4062 F3000
+G1 X32.700 Y4.000 Z-6.4227 F3000
+G1 X32.720 Y4.000 Z-6.4393 F3000
+G1 X32.740 Y4.000 Z-6.4559 F3000
+G1 X32.760 Y4.000 Z-6.4725 F3000
+G1 X32.780 Y4.000 Z-6.4892 F3000
+G1 X32.800 Y4.000 Z-6.5059 F3000
+G1 X32.820 Y4.000 Z-6.5226 F3000
+G1 X32.840 Y4.000 Z-6.5394 F3000
+G1 X32.860 Y4.000 Z-6.5563 F3000
+G1 X32.880 Y4.000 Z-6.5732 F3000
+G1 X32.900 Y4.000 Z-6.5901 F3000
+G1 X32.920 Y4.000 Z-6.6071 F3000
+G1 X32.940 Y4.000 Z-6.6242 F3000
+G1 X32.960 Y4.000 Z-6.6412 F3000
+G1 X32.980 Y4.000 Z-6.6583 F3000
+G1 X33.000 Y4.000 Z-6.6755 F3000
+G1 X33.020 Y4.000 Z-6.6927 F3000
+G1 X33.040 Y4.000 Z-6.7100 F3000
+G1 X33.060 Y4.000 Z-6.7273 F3000
+G1 X33.080 Y4.000 Z-6.7446 F3000
+G1 X33.100 Y4.000 Z-6.7620 F3000
+G1 X33.120 Y4.000 Z-6.7795 F3000
+G1 X33.140 Y4.000 Z-6.7970 F3000
+G1 X33.160 Y4.000 Z-6.8145 F3000
+G1 X33.180 Y4.000 Z-6.8321 F3000
+G1 X33.200 Y4.000 Z-6.8497 F3000
+G1 X33.220 Y4.000 Z-6.8674 F3000
+G1 X33.240 Y4.000 Z-6.8852 F3000
+G1 X33.260 Y4.000 Z-6.9029 F3000
+G1 X33.280 Y4.000 Z-6.9208 F3000
+G1 X33.300 Y4.000 Z-6.9386 F3000
+G1 X33.320 Y4.000 Z-6.9566 F3000
+G1 X33.340 Y4.000 Z-6.9745 F3000
+G1 X33.360 Y4.000 Z-6.9926 F3000
+G1 X33.380 Y4.000 Z-7.0106 F3000
+G1 X33.400 Y4.000 Z-7.0287 F3000
+G1 X33.420 Y4.000 Z-7.0469 F3000
+G1 X33.440 Y4.000 Z-7.0651 F3000
+G1 X33.460 Y4.000 Z-7.0834 F3000
+G1 X33.480 Y4.000 Z-7.1017 F3000
+G1 X33.500 Y4.000 Z-7.1201 F3000
+G1 X33.520 Y4.000 Z-7.1385 F3000
+G1 X33.540 Y4.000 Z-7.1570 F3000
+G1 X33.560 Y4.000 Z-7.1755 F3000
+G1 X33.580 Y4.000 Z-7.1941 F3000
+G1 X33.600 Y4.000 Z-7.2127 F3000
+G1 X33.620 Y4.000 Z-7.2313 F3000
+G1 X33.640 Y4.000 Z-7.2501 F3000
+G1 X33.660 Y4.000 Z-7.2688 F3000
+G1 X33.680 Y4.000 Z-7.2877 F3000
+G1 X33.700 Y4.000 Z-7.3066 F3000
+G1 X33.720 Y4.000 Z-7.3255 F3000
+G1 X33.740 Y4.000 Z-7.3445 F3000
+G1 X33.760 Y4.000 Z-7.3635 F3000
+G1 X33.780 Y4.000 Z-7.3826 F3000
+G1 X33.800 Y4.000 Z-7.4017 F3000
+G1 X33.820 Y4.000 Z-7.4209 F3000
+G1 X33.840 Y4.000 Z-7.4402 F3000
+G1 X33.860 Y4.000 Z-7.4595 F3000
+G1 X33.880 Y4.000 Z-7.4788 F3000
+G1 X33.900 Y4.000 Z-7.4983 F3000
+G1 X33.920 Y4.000 Z-7.5177 F3000
+G1 X33.940 Y4.000 Z-7.5372 F3000
+G1 X33.960 Y4.000 Z-7.5568 F3000
+G1 X33.980 Y4.000 Z-7.5764 F3000
+G1 X34.000 Y4.000 Z-7.5961 F3000
+G1 X34.020 Y4.000 Z-7.6159 F3000
+G1 X34.040 Y4.000 Z-7.6357 F3000
+G1 X34.060 Y4.000 Z-7.6555 F3000
+G1 X34.080 Y4.000 Z-7.6754 F3000
+G1 X34.100 Y4.000 Z-7.6954 F3000
+G1 X34.120 Y4.000 Z-7.7154 F3000
+G1 X34.140 Y4.000 Z-7.7355 F3000
+G1 X34.160 Y4.000 Z-7.7556 F3000
+G1 X34.180 Y4.000 Z-7.7758 F3000
+G1 X34.200 Y4.000 Z-7.7961 F3000
+G1 X34.220 Y4.000 Z-7.8164 F3000
+G1 X34.240 Y4.000 Z-7.8367 F3000
+G1 X34.260 Y4.000 Z-7.8572 F3000
+G1 X34.280 Y4.000 Z-7.8777 F3000
+G1 X34.300 Y4.000 Z-7.8982 F3000
+G1 X34.320 Y4.000 Z-7.9188 F3000
+G1 X34.340 Y4.000 Z-7.9395 F3000
+G1 X34.360 Y4.000 Z-7.9602 F3000
+G1 X34.380 Y4.000 Z-7.9810 F3000
+G1 X34.400 Y4.000 Z-8.0018 F3000
+G1 X34.420 Y4.000 Z-8.0227 F3000
+G1 X34.440 Y4.000 Z-8.0437 F3000
+G1 X34.460 Y4.000 Z-8.0647 F3000
+G1 X34.480 Y4.000 Z-8.0858 F3000
+G1 X34.500 Y4.000 Z-8.1069 F3000
+G1 X34.520 Y4.000 Z-8.1281 F3000
+G1 X34.540 Y4.000 Z-8.1494 F3000
+G1 X34.560 Y4.000 Z-8.1708 F3000
+G1 X34.580 Y4.000 Z-8.1921 F3000
+G1 X34.600 Y4.000 Z-8.2136 F3000
+G1 X34.620 Y4.000 Z-8.2351 F3000
+G1 X34.640 Y4.000 Z-8.2567 F3000
+G1 X34.660 Y4.000 Z-8.2784 F3000
+G1 X34.680 Y4.000 Z-8.3001 F3000
+G1 X34.700 Y4.000 Z-8.3219 F3000
+G1 X34.720 Y4.000 Z-8.3437 F3000
+G1 X34.740 Y4.000 Z-8.3656 F3000
+G1 X34.760 Y4.000 Z-8.3876 F3000
+G1 X34.780 Y4.000 Z-8.4096 F3000
+G1 X34.800 Y4.000 Z-8.4318 F3000
+G1 X34.820 Y4.000 Z-8.4539 F3000
+G1 X34.840 Y4.000 Z-8.4762 F3000
+G1 X34.860 Y4.000 Z-8.4985 F3000
+G1 X34.880 Y4.000 Z-8.5209 F3000
+G1 X34.900 Y4.000 Z-8.5433 F3000
+G1 X34.920 Y4.000 Z-8.5658 F3000
+G1 X34.940 Y4.000 Z-8.5884 F3000
+G1 X34.960 Y4.000 Z-8.6111 F3000
+G1 X34.980 Y4.000 Z-8.6338 F3000
+G1 X35.000 Y4.000 Z-8.6566 F3000
+G1 X35.020 Y4.000 Z-8.6794 F3000
+G1 X35.040 Y4.000 Z-8.7024 F3000
+G1 X35.060 Y4.000 Z-8.7254 F3000
+G1 X35.080 Y4.000 Z-8.7484 F3000
+G1 X35.100 Y4.000 Z-8.7716 F3000
+G1 X35.120 Y4.000 Z-8.7948 F3000
+G1 X35.140 Y4.000 Z-8.8181 F3000
+G1 X35.160 Y4.000 Z-8.8414 F3000
+G1 X35.180 Y4.000 Z-8.8649 F3000
+G1 X35.200 Y4.000 Z-8.8884 F3000
+G1 X35.220 Y4.000 Z-8.9120 F3000
+G1 X35.240 Y4.000 Z-8.9356 F3000
+G1 X35.260 Y4.000 Z-8.9593 F3000
+G1 X35.280 Y4.000 Z-8.9832 F3000
+G1 X35.300 Y4.000 Z-9.0070 F3000
+G1 X35.320 Y4.000 Z-9.0310 F3000
+G1 X35.340 Y4.000 Z-9.0550 F3000
+G1 X35.360 Y4.000 Z-9.0791 F3000
+G1 X35.380 Y4.000 Z-9.1033 F3000
+G1 X35.400 Y4.000 Z-9.1276 F3000
+G1 X35.420 Y4.000 Z-9.1519 F3000
+G1 X35.440 Y4.000 Z-9.1764 F3000
+G1 X35.460 Y4.000 Z-9.2009 F3000
+G1 X35.480 Y4.000 Z-9.2254 F3000
+G1 X35.500 Y4.000 Z-9.2501 F3000
+G1 X35.520 Y4.000 Z-9.2748 F3000
+G1 X35.540 Y4.000 Z-9.2997 F3000
+G1 X35.560 Y4.000 Z-9.3246 F3000
+G1 X35.580 Y4.000 Z-9.3496 F3000
+G1 X35.600 Y4.000 Z-9.3746 F3000
+G1 X35.620 Y4.000 Z-9.3998 F3000
+G1 X35.640 Y4.000 Z-9.4250 F3000
+G1 X35.660 Y4.000 Z-9.4503 F3000
+G1 X35.680 Y4.000 Z-9.4757 F3000
+G1 X35.700 Y4.000 Z-9.5012 F3000
+G1 X35.720 Y4.000 Z-9.5268 F3000
+G1 X35.740 Y4.000 Z-9.5525 F3000
+G1 X35.760 Y4.000 Z-9.5782 F3000
+G1 X35.780 Y4.000 Z-9.6040 F3000
+G1 X35.800 Y4.000 Z-9.6300 F3000
+G1 X35.820 Y4.000 Z-9.6560 F3000
+G1 X35.840 Y4.000 Z-9.6821 F3000
+G1 X35.860 Y4.000 Z-9.7083 F3000
+G1 X35.880 Y4.000 Z-9.7345 F3000
+G1 X35.900 Y4.000 Z-9.7609 F3000
+G1 X35.920 Y4.000 Z-9.7874 F3000
+G1 X35.940 Y4.000 Z-9.8139 F3000
+G1 X35.960 Y4.000 Z-9.8406 F3000
+G1 X35.980 Y4.000 Z-9.8673 F3000
+G1 X36.000 Y4.000 Z-9.8941 F3000
+G1 X36.020 Y4.000 Z-9.9210 F3000
+G1 X36.040 Y4.000 Z-9.9481 F3000
+G1 X36.060 Y4.000 Z-9.9752 F3000
+G1 X36.080 Y4.000 Z-10.0024 F3000
+G1 X36.100 Y4.000 Z-10.0297 F3000
+G1 X36.120 Y4.000 Z-10.0571 F3000
+G1 X36.140 Y4.000 Z-10.0846 F3000
+G1 X36.160 Y4.000 Z-10.1122 F3000
+G1 X36.180 Y4.000 Z-10.1399 F3000
+G1 X36.200 Y4.000 Z-10.1677 F3000
+G1 X36.220 Y4.000 Z-10.1956 F3000
+G1 X36.240 Y4.000 Z-10.2236 F3000
+G1 X36.260 Y4.000 Z-10.2517 F3000
+G1 X36.280 Y4.000 Z-10.2799 F3000
+G1 X36.300 Y4.000 Z-10.3083 F3000
+G1 X36.320 Y4.000 Z-10.3367 F3000
+G1 X36.340 Y4.000 Z-10.3652 F3000
+G1 X36.360 Y4.000 Z-10.3938 F3000
+G1 X36.380 Y4.000 Z-10.4226 F3000
+G1 X36.400 Y4.000 Z-10.4514 F3000
+G1 X36.420 Y4.000 Z-10.4804 F3000
+G1 X36.440 Y4.000 Z-10.5095 F3000
+G1 X36.460 Y4.000 Z-10.5386 F3000
+G1 X36.480 Y4.000 Z-10.5679 F3000
+G1 X36.500 Y4.000 Z-10.5973 F3000
+G1 X36.520 Y4.000 Z-10.6268 F3000
+G1 X36.540 Y4.000 Z-10.6565 F3000
+G1 X36.560 Y4.000 Z-10.6862 F3000
+G1 X36.580 Y4.000 Z-10.7161 F3000
+G1 X36.600 Y4.000 Z-10.7460 F3000
+G1 X36.620 Y4.000 Z-10.7761 F3000
+G1 X36.640 Y4.000 Z-10.8063 F3000
+G1 X36.660 Y4.000 Z-10.8367 F3000
+G1 X36.680 Y4.000 Z-10.8671 F3000
+G1 X36.700 Y4.000 Z-10.8977 F3000
+G1 X36.720 Y4.000 Z-10.9284 F3000
+G1 X36.740 Y4.000 Z-10.9592 F3000
+G1 X36.760 Y4.000 Z-10.9902 F3000
+G1 X36.780 Y4.000 Z-11.0212 F3000
+G1 X36.800 Y4.000 Z-11.0524 F3000
+G1 X36.820 Y4.000 Z-11.0838 F3000
+G1 X36.840 Y4.000 Z-11.1152 F3000
+G1 X36.860 Y4.000 Z-11.1468 F3000
+G1 X36.880 Y4.000 Z-11.1785 F3000
+G1 X36.900 Y4.000 Z-11.2104 F3000
+G1 X36.920 Y4.000 Z-11.2424 F3000
+G1 X36.940 Y4.000 Z-11.2745 F3000
+G1 X36.960 Y4.000 Z-11.3067 F3000
+G1 X36.980 Y4.000 Z-11.3391 F3000
+G1 X37.000 Y4.000 Z-11.3717 F3000
+G1 X37.020 Y4.000 Z-11.4043 F3000
+G1 X37.040 Y4.000 Z-11.4372 F3000
+G1 X37.060 Y4.000 Z-11.4701 F3000
+G1 X37.080 Y4.000 Z-11.5032 F3000
+G1 X37.100 Y4.000 Z-11.5365 F3000
+G1 X37.120 Y4.000 Z-11.5699 F3000
+G1 X37.140 Y4.000 Z-11.6034 F3000
+G1 X37.160 Y4.000 Z-11.6371 F3000
+G1 X37.180 Y4.000 Z-11.6710 F3000
+G1 X37.200 Y4.000 Z-11.7050 F3000
+G1 X37.220 Y4.000 Z-11.7391 F3000
+G1 X37.240 Y4.000 Z-11.7734 F3000
+G1 X37.260 Y4.000 Z-11.8079 F3000
+G1 X37.280 Y4.000 Z-11.8425 F3000
+G1 X37.300 Y4.000 Z-11.8773 F3000
+G1 X37.320 Y4.000 Z-11.9123 F3000
+G1 X37.340 Y4.000 Z-11.9474 F3000
+G1 X37.360 Y4.000 Z-11.9826 F3000
+G1 X37.380 Y4.000 Z-12.0181 F3000
+G1 X37.400 Y4.000 Z-12.0537 F3000
+G1 X37.420 Y4.000 Z-12.0895 F3000
+G1 X37.440 Y4.000 Z-12.1255 F3000
+G1 X37.460 Y4.000 Z-12.1616 F3000
+G1 X37.480 Y4.000 Z-12.1979 F3000
+G1 X37.500 Y4.000 Z-12.2344 F3000
+G1 X37.520 Y4.000 Z-12.2711 F3000
+G1 X37.540 Y4.000 Z-12.3080 F3000
+G1 X37.560 Y4.000 Z-12.3450 F3000
+G1 X37.580 Y4.000 Z-12.3823 F3000
+G1 X37.600 Y4.000 Z-12.4197 F3000
+G1 X37.620 Y4.000 Z-12.4573 F3000
+G1 X37.640 Y4.000 Z-12.4951 F3000
+G1 X37.660 Y4.000 Z-12.5332 F3000
+G1 X37.680 Y4.000 Z-12.5714 F3000
+G1 X37.700 Y4.000 Z-12.6098 F3000
+G1 X37.720 Y4.000 Z-12.6484 F3000
+G1 X37.740 Y4.000 Z-12.6872 F3000
+G1 X37.760 Y4.000 Z-12.7263 F3000
+G1 X37.780 Y4.000 Z-12.7655 F3000
+G1 X37.800 Y4.000 Z-12.8050 F3000
+G1 X37.820 Y4.000 Z-12.8447 F3000
+G1 X37.840 Y4.000 Z-12.8846 F3000
+G1 X37.860 Y4.000 Z-12.9247 F3000
+G1 X37.880 Y4.000 Z-12.9651 F3000
+G1 X37.900 Y4.000 Z-13.0057 F3000
+G1 X37.920 Y4.000 Z-13.0465 F3000
+G1 X37.940 Y4.000 Z-13.0876 F3000
+G1 X37.960 Y4.000 Z-13.1289 F3000
+G1 X37.980 Y4.000 Z-13.1704 F3000
+G1 X38.000 Y4.000 Z-13.2122 F3000
+G1 X38.020 Y4.000 Z-13.2543 F3000
+G1 X38.040 Y4.000 Z-13.2966 F3000
+G1 X38.060 Y4.000 Z-13.3391 F3000
+G1 X38.080 Y4.000 Z-13.3819 F3000
+G1 X38.100 Y4.000 Z-13.4250 F3000
+G1 X38.120 Y4.000 Z-13.4684 F3000
+G1 X38.140 Y4.000 Z-13.5120 F3000
+G1 X38.160 Y4.000 Z-13.5559 F3000
+G1 X38.180 Y4.000 Z-13.6001 F3000
+G1 X38.200 Y4.000 Z-13.6446 F3000
+G1 X38.220 Y4.000 Z-13.6894 F3000
+G1 X38.240 Y4.000 Z-13.7345 F3000
+G1 X38.260 Y4.000 Z-13.7799 F3000
+G1 X38.280 Y4.000 Z-13.8256 F3000
+G1 X38.300 Y4.000 Z-13.8716 F3000
+G1 X38.320 Y4.000 Z-13.9179 F3000
+G1 X38.340 Y4.000 Z-13.9645 F3000
+G1 X38.360 Y4.000 Z-14.0115 F3000
+G1 X38.380 Y4.000 Z-14.0588 F3000
+G1 X38.400 Y4.000 Z-14.1065 F3000
+G1 X38.420 Y4.000 Z-14.1545 F3000
+G1 X38.440 Y4.000 Z-14.2029 F3000
+G1 X38.460 Y4.000 Z-14.2516 F3000
+G1 X38.480 Y4.000 Z-14.3007 F3000
+G1 X38.500 Y4.000 Z-14.3502 F3000
+G1 X38.520 Y4.000 Z-14.4000 F3000
+G1 X38.540 Y4.000 Z-14.4503 F3000
+G1 X38.560 Y4.000 Z-14.5009 F3000
+G1 X38.580 Y4.000 Z-14.5520 F3000
+G1 X38.600 Y4.000 Z-14.6035 F3000
+G1 X38.620 Y4.000 Z-14.6554 F3000
+G1 X38.640 Y4.000 Z-14.7077 F3000
+G1 X38.660 Y4.000 Z-14.7605 F3000
+G1 X38.680 Y4.000 Z-14.8138 F3000
+G1 X38.700 Y4.000 Z-14.8675 F3000
+G1 X38.720 Y4.000 Z-14.9217 F3000
+G1 X38.740 Y4.000 Z-14.9763 F3000
+G1 X38.760 Y4.000 Z-15.0315 F3000
+G1 X38.780 Y4.000 Z-15.0872 F3000
+G1 X38.800 Y4.000 Z-15.1434 F3000
+G1 X38.820 Y4.000 Z-15.2002 F3000
+G1 X38.840 Y4.000 Z-15.2575 F3000
+G1 X38.860 Y4.000 Z-15.3154 F3000
+G1 X38.880 Y4.000 Z-15.3738 F3000
+G1 X38.900 Y4.000 Z-15.4329 F3000
+G1 X38.920 Y4.000 Z-15.4926 F3000
+G1 X38.940 Y4.000 Z-15.5529 F3000
+G1 X38.960 Y4.000 Z-15.6139 F3000
+G1 X38.980 Y4.000 Z-15.6755 F3000
+G1 X39.000 Y4.000 Z-15.7378 F3000
+G1 X39.020 Y4.000 Z-15.8009 F3000
+G1 X39.040 Y4.000 Z-15.8646 F3000
+G1 X39.060 Y4.000 Z-15.9292 F3000
+G1 X39.080 Y4.000 Z-15.9945 F3000
+G1 X39.100 Y4.000 Z-16.0607 F3000
+G1 X39.120 Y4.000 Z-16.1276 F3000
+G1 X39.140 Y4.000 Z-16.1955 F3000
+G1 X39.160 Y4.000 Z-16.2643 F3000
+G1 X39.180 Y4.000 Z-16.3340 F3000
+G1 X39.200 Y4.000 Z-16.4046 F3000
+G1 X39.220 Y4.000 Z-16.4763 F3000
+G1 X39.240 Y4.000 Z-16.5491 F3000
+G1 X39.260 Y4.000 Z-16.6229 F3000
+G1 X39.280 Y4.000 Z-16.6979 F3000
+G1 X39.300 Y4.000 Z-16.7741 F3000
+G1 X39.320 Y4.000 Z-16.8515 F3000
+G1 X39.340 Y4.000 Z-16.9303 F3000
+G1 X39.360 Y4.000 Z-17.0104 F3000
+G1 X39.380 Y4.000 Z-17.0920 F3000
+G1 X39.400 Y4.000 Z-17.1751 F3000
+G1 X39.420 Y4.000 Z-17.2598 F3000
+G1 X39.440 Y4.000 Z-17.3462 F3000
+G1 X39.460 Y4.000 Z-17.4344 F3000
+G1 X39.480 Y4.000 Z-17.5245 F3000
+G1 X39.500 Y4.000 Z-17.6167 F3000
+G1 X39.520 Y4.000 Z-17.7110 F3000
+G1 X39.540 Y4.000 Z-17.8077 F3000
+G1 X39.560 Y4.000 Z-17.9069 F3000
+G1 X39.580 Y4.000 Z-18.0087 F3000
+G1 X39.600 Y4.000 Z-18.1135 F3000
+G1 X39.620 Y4.000 Z-18.2215 F3000
+G1 X39.640 Y4.000 Z-18.3330 F3000
+G1 X39.660 Y4.000 Z-18.4482 F3000
+G1 X39.680 Y4.000 Z-18.5677 F3000
+G1 X39.700 Y4.000 Z-18.6919 F3000
+G1 X39.720 Y4.000 Z-18.8215 F3000
+G1 X39.740 Y4.000 Z-18.9570 F3000
+G1 X39.760 Y4.000 Z-19.0996 F3000
+G1 X39.780 Y4.000 Z-19.2502 F3000
+G1 X39.800 Y4.000 Z-19.4104 F3000
+G1 X39.820 Y4.000 Z-19.5824 F3000
+G1 X39.840 Y4.000 Z-19.7691 F3000
+G1 X39.860 Y4.000 Z-19.9751 F3000
+G1 X39.880 Y4.000 Z-20.2076 F3000
+G1 X39.900 Y4.000 Z-20.4809 F3000
+G1 X39.920 Y4.000 Z-20.8286 F3000
+G1 X39.940 Y4.000 Z-21.4174 F3000
+G1 X39.960 Y4.000 Z-21.8000 F3000
+G1 X39.980 Y4.000 Z-21.8000 F3000
+G1 X40.000 Y4.000 Z-21.8000 F3000
+G1 X40.000 Y4.500 Z-21.8000 F3000
+G1 X39.980 Y4.500 Z-21.8000 F3000
+G1 X39.960 Y4.500 Z-21.8000 F3000
+G1 X39.940 Y4.500 Z-21.8000 F3000
+G1 X39.920 Y4.500 Z-21.8000 F3000
+G1 X39.900 Y4.500 Z-21.8000 F3000
+G1 X39.880 Y4.500 Z-20.9137 F3000
+G1 X39.860 Y4.500 Z-20.5429 F3000
+G1 X39.840 Y4.500 Z-20.2591 F3000
+G1 X39.820 Y4.500 Z-20.0202 F3000
+G1 X39.800 Y4.500 Z-19.8100 F3000
+G1 X39.780 Y4.500 Z-19.6202 F3000
+G1 X39.760 Y4.500 Z-19.4458 F3000
+G1 X39.740 Y4.500 Z-19.2836 F3000
+G1 X39.720 Y4.500 Z-19.1314 F3000
+G1 X39.700 Y4.500 Z-18.9875 F3000
+G1 X39.680 Y4.500 Z-18.8508 F3000
+G1 X39.660 Y4.500 Z-18.7203 F3000
+G1 X39.640 Y4.500 Z-18.5953 F3000
+G1 X39.620 Y4.500 Z-18.4750 F3000
+G1 X39.600 Y4.500 Z-18.3591 F3000
+G1 X39.580 Y4.500 Z-18.2470 F3000
+G1 X39.560 Y4.500 Z-18.1385 F3000
+G1 X39.540 Y4.500 Z-18.0333 F3000
+G1 X39.520 Y4.500 Z-17.9309 F3000
+G1 X39.500 Y4.500 Z-17.8314 F3000
+G1 X39.480 Y4.500 Z-17.7343 F3000
+G1 X39.460 Y4.500 Z-17.6397 F3000
+G1 X39.440 Y4.500 Z-17.5472 F3000
+G1 X39.420 Y4.500 Z-17.4568 F3000
+G1 X39.400 Y4.500 Z-17.3683 F3000
+G1 X39.380 Y4.500 Z-17.2816 F3000
+G1 X39.360 Y4.500 Z-17.1967 F3000
+G1 X39.340 Y4.500 Z-17.1134 F3000
+G1 X39.320 Y4.500 Z-17.0316 F3000
+G1 X39.300 Y4.500 Z-16.9513 F3000
+G1 X39.280 Y4.500 Z-16.8724 F3000
+G1 X39.260 Y4.500 Z-16.7948 F3000
+G1 X39.240 Y4.500 Z-16.7184 F3000
+G1 X39.220 Y4.500 Z-16.6433 F3000
+G1 X39.200 Y4.500 Z-16.5693 F3000
+G1 X39.180 Y4.500 Z-16.4965 F3000
+G1 X39.160 Y4.500 Z-16.4246 F3000
+G1 X39.140 Y4.500 Z-16.3539 F3000
+G1 X39.120 Y4.500 Z-16.2841 F3000
+G1 X39.100 Y4.500 Z-16.2152 F3000
+G1 X39.080 Y4.500 Z-16.1472 F3000
+G1 X39.060 Y4.500 Z-16.0802 F3000
+G1 X39.040 Y4.500 Z-16.0139 F3000
+G1 X39.020 Y4.500 Z-15.9485 F3000
+G1 X39.000 Y4.500 Z-15.8839 F3000
+G1 X38.980 Y4.500 Z-15.8201 F3000
+G1 X38.960 Y4.500 Z-15.7570 F3000
+G1 X38.940 Y4.500 Z-15.6946 F3000
+G1 X38.920 Y4.500 Z-15.6329 F3000
+G1 X38.900 Y4.500 Z-15.5718 F3000
+G1 X38.880 Y4.500 Z-15.5115 F3000
+G1 X38.860 Y4.500 Z-15.4517 F3000
+G1 X38.840 Y4.500 Z-15.3926 F3000
+G1 X38.820 Y4.500 Z-15.3341 F3000
+G1 X38.800 Y4.500 Z-15.2762 F3000
+G1 X38.780 Y4.500 Z-15.2188 F3000
+G1 X38.760 Y4.500 Z-15.1620 F3000
+G1 X38.740 Y4.500 Z-15.1058 F3000
+G1 X38.720 Y4.500 Z-15.0501 F3000
+G1 X38.700 Y4.500 Z-14.9949 F3000
+G1 X38.680 Y4.500 Z-14.9401 F3000
+G1 X38.660 Y4.500 Z-14.8859 F3000
+G1 X38.640 Y4.500 Z-14.8322 F3000
+G1 X38.620 Y4.500 Z-14.7789 F3000
+G1 X38.600 Y4.500 Z-14.7261 F3000
+G1 X38.580 Y4.500 Z-14.6737 F3000
+G1 X38.560 Y4.500 Z-14.6218 F3000
+G1 X38.540 Y4.500 Z-14.5703 F3000
+G1 X38.520 Y4.500 Z-14.5192 F3000
+G1 X38.500 Y4.500 Z-14.4686 F3000
+G1 X38.480 Y4.500 Z-14.4183 F3000
+G1 X38.460 Y4.500 Z-14.3684 F3000
+G1 X38.440 Y4.500 Z-14.3189 F3000
+G1 X38.420 Y4.500 Z-14.2698 F3000
+G1 X38.400 Y4.500 Z-14.2211 F3000
+G1 X38.380 Y4.500 Z-14.1727 F3000
+G1 X38.360 Y4.500 Z-14.1247 F3000
+G1 X38.340 Y4.500 Z-14.0770 F3000
+G1 X38.320 Y4.500 Z-14.0297 F3000
+G1 X38.300 Y4.500 Z-13.9827 F3000
+G1 X38.280 Y4.500 Z-13.9361 F3000
+G1 X38.260 Y4.500 Z-13.8897 F3000
+G1 X38.240 Y4.500 Z-13.8437 F3000
+G1 X38.220 Y4.500 Z-13.7980 F3000
+G1 X38.200 Y4.500 Z-13.7526 F3000
+G1 X38.180 Y4.500 Z-13.7076 F3000
+G1 X38.160 Y4.500 Z-13.6628 F3000
+G1 X38.140 Y4.500 Z-13.6183 F3000
+G1 X38.120 Y4.500 Z-13.5741 F3000
+G1 X38.100 Y4.500 Z-13.5302 F3000
+G1 X38.080 Y4.500 Z-13.4865 F3000
+G1 X38.060 Y4.500 Z-13.4432 F3000
+G1 X38.040 Y4.500 Z-13.4001 F3000
+G1 X38.020 Y4.500 Z-13.3573 F3000
+G1 X38.000 Y4.500 Z-13.3147 F3000
+G1 X37.980 Y4.500 Z-13.2724 F3000
+G1 X37.960 Y4.500 Z-13.2304 F3000
+G1 X37.940 Y4.500 Z-13.1886 F3000
+G1 X37.920 Y4.500 Z-13.1470 F3000
+G1 X37.900 Y4.500 Z-13.1057 F3000
+G1 X37.880 Y4.500 Z-13.0647 F3000
+G1 X37.860 Y4.500 Z-13.0239 F3000
+G1 X37.840 Y4.500 Z-12.9833 F3000
+G1 X37.820 Y4.500 Z-12.9429 F3000
+G1 X37.800 Y4.500 Z-12.9028 F3000
+G1 X37.780 Y4.500 Z-12.8629 F3000
+G1 X37.760 Y4.500 Z-12.8232 F3000
+G1 X37.740 Y4.500 Z-12.7838 F3000
+G1 X37.720 Y4.500 Z-12.7445 F3000
+G1 X37.700 Y4.500 Z-12.7055 F3000
+G1 X37.680 Y4.500 Z-12.6667 F3000
+G1 X37.660 Y4.500 Z-12.6281 F3000
+G1 X37.640 Y4.500 Z-12.5897 F3000
+G1 X37.620 Y4.500 Z-12.5515 F3000
+G1 X37.600 Y4.500 Z-12.5135 F3000
+G1 X37.580 Y4.500 Z-12.4756 F3000
+G1 X37.560 Y4.500 Z-12.4380 F3000
+G1 X37.540 Y4.500 Z-12.4006 F3000
+G1 X37.520 Y4.500 Z-12.3634 F3000
+G1 X37.500 Y4.500 Z-12.3264 F3000
+G1 X37.480 Y4.500 Z-12.2895 F3000
+G1 X37.460 Y4.500 Z-12.2528 F3000
+G1 X37.440 Y4.500 Z-12.2163 F3000
+G1 X37.420 Y4.500 Z-12.1800 F3000
+G1 X37.400 Y4.500 Z-12.1439 F3000
+G1 X37.380 Y4.500 Z-12.1080 F3000
+G1 X37.360 Y4.500 Z-12.0722 F3000
+G1 X37.340 Y4.500 Z-12.0366 F3000
+G1 X37.320 Y4.500 Z-12.0011 F3000
+G1 X37.300 Y4.500 Z-11.9659 F3000
+G1 X37.280 Y4.500 Z-11.9308 F3000
+G1 X37.260 Y4.500 Z-11.8958 F3000
+G1 X37.240 Y4.500 Z-11.8611 F3000
+G1 X37.220 Y4.500 Z-11.8265 F3000
+G1 X37.200 Y4.500 Z-11.7920 F3000
+G1 X37.180 Y4.500 Z-11.7577 F3000
+G1 X37.160 Y4.500 Z-11.7236 F3000
+G1 X37.140 Y4.500 Z-11.6896 F3000
+G1 X37.120 Y4.500 Z-11.6558 F3000
+G1 X37.100 Y4.500 Z-11.6221 F3000
+G1 X37.080 Y4.500 Z-11.5886 F3000
+G1 X37.060 Y4.500 Z-11.5552 F3000
+G1 X37.040 Y4.500 Z-11.5219 F3000
+G1 X37.020 Y4.500 Z-11.4889 F3000
+G1 X37.000 Y4.500 Z-11.4559 F3000
+G1 X36.980 Y4.500 Z-11.4231 F3000
+G1 X36.960 Y4.500 Z-11.3905 F3000
+G1 X36.940 Y4.500 Z-11.3580 F3000
+G1 X36.920 Y4.500 Z-11.3256 F3000
+G1 X36.900 Y4.500 Z-11.2933 F3000
+G1 X36.880 Y4.500 Z-11.2612 F3000
+G1 X36.860 Y4.500 Z-11.2293 F3000
+G1 X36.840 Y4.500 Z-11.1974 F3000
+G1 X36.820 Y4.500 Z-11.1657 F3000
+G1 X36.800 Y4.500 Z-11.1342 F3000
+G1 X36.780 Y4.500 Z-11.1027 F3000
+G1 X36.760 Y4.500 Z-11.0714 F3000
+G1 X36.740 Y4.500 Z-11.0402 F3000
+G1 X36.720 Y4.500 Z-11.0092 F3000
+G1 X36.700 Y4.500 Z-10.9783 F3000
+G1 X36.680 Y4.500 Z-10.9475 F3000
+G1 X36.660 Y4.500 Z-10.9168 F3000
+G1 X36.640 Y4.500 Z-10.8862 F3000
+G1 X36.620 Y4.500 Z-10.8558 F3000
+G1 X36.600 Y4.500 Z-10.8255 F3000
+G1 X36.580 Y4.500 Z-10.7953 F3000
+G1 X36.560 Y4.500 Z-10.7652 F3000
+G1 X36.540 Y4.500 Z-10.7353 F3000
+G1 X36.520 Y4.500 Z-10.7054 F3000
+G1 X36.500 Y4.500 Z-10.6757 F3000
+G1 X36.480 Y4.500 Z-10.6461 F3000
+G1 X36.460 Y4.500 Z-10.6166 F3000
+G1 X36.440 Y4.500 Z-10.5872 F3000
+G1 X36.420 Y4.500 Z-10.5580 F3000
+G1 X36.400 Y4.500 Z-10.5288 F3000
+G1 X36.380 Y4.500 Z-10.4998 F3000
+G1 X36.360 Y4.500 Z-10.4708 F3000
+G1 X36.340 Y4.500 Z-10.4420 F3000
+G1 X36.320 Y4.500 Z-10.4133 F3000
+G1 X36.300 Y4.500 Z-10.3847 F3000
+G1 X36.280 Y4.500 Z-10.3562 F3000
+G1 X36.260 Y4.500 Z-10.3278 F3000
+G1 X36.240 Y4.500 Z-10.2995 F3000
+G1 X36.220 Y4.500 Z-10.2713 F3000
+G1 X36.200 Y4.500 Z-10.2432 F3000
+G1 X36.180 Y4.500 Z-10.2152 F3000
+G1 X36.160 Y4.500 Z-10.1873 F3000
+G1 X36.140 Y4.500 Z-10.1595 F3000
+G1 X36.120 Y4.500 Z-10.1319 F3000
+G1 X36.100 Y4.500 Z-10.1043 F3000
+G1 X36.080 Y4.500 Z-10.0768 F3000
+G1 X36.060 Y4.500 Z-10.0494 F3000
+G1 X36.040 Y4.500 Z-10.0221 F3000
+G1 X36.020 Y4.500 Z-9.9949 F3000
+G1 X36.000 Y4.500 Z-9.9678 F3000
+G1 X35.980 Y4.500 Z-9.9408 F3000
+G1 X35.960 Y4.500 Z-9.9139 F3000
+G1 X35.940 Y4.500 Z-9.8871 F3000
+G1 X35.920 Y4.500 Z-9.8604 F3000
+G1 X35.900 Y4.500 Z-9.8338 F3000
+G1 X35.880 Y4.500 Z-9.8073 F3000
+G1 X35.860 Y4.500 Z-9.7808 F3000
+G1 X35.840 Y4.500 Z-9.7545 F3000
+G1 X35.820 Y4.500 Z-9.7282 F3000
+G1 X35.800 Y4.500 Z-9.7021 F3000
+G1 X35.780 Y4.500 Z-9.6760 F3000
+G1 X35.760 Y4.500 Z-9.6500 F3000
+G1 X35.740 Y4.500 Z-9.6241 F3000
+G1 X35.720 Y4.500 Z-9.5983 F3000
+G1 X35.700 Y4.500 Z-9.5726 F3000
+G1 X35.680 Y4.500 Z-9.5469 F3000
+G1 X35.660 Y4.500 Z-9.5214 F3000
+G1 X35.640 Y4.500 Z-9.4959 F3000
+G1 X35.620 Y4.500 Z-9.4705 F3000
+G1 X35.600 Y4.500 Z-9.4452 F3000
+G1 X35.580 Y4.500 Z-9.4200 F3000
+G1 X35.560 Y4.500 Z-9.3949 F3000
+G1 X35.540 Y4.500 Z-9.3699 F3000
+G1 X35.520 Y4.500 Z-9.3449 F3000
+G1 X35.500 Y4.500 Z-9.3200 F3000
+G1 X35.480 Y4.500 Z-9.2952 F3000
+G1 X35.460 Y4.500 Z-9.2705 F3000
+G1 X35.440 Y4.500 Z-9.2459 F3000
+G1 X35.420 Y4.500 Z-9.2213 F3000
+G1 X35.400 Y4.500 Z-9.1968 F3000
+G1 X35.380 Y4.500 Z-9.1724 F3000
+G1 X35.360 Y4.500 Z-9.1481 F3000
+G1 X35.340 Y4.500 Z-9.1239 F3000
+G1 X35.320 Y4.500 Z-9.0997 F3000
+G1 X35.300 Y4.500 Z-9.0756 F3000
+G1 X35.280 Y4.500 Z-9.0516 F3000
+G1 X35.260 Y4.500 Z-9.0277 F3000
+G1 X35.240 Y4.500 Z-9.0038 F3000
+G1 X35.220 Y4.500 Z-8.9800 F3000
+G1 X35.200 Y4.500 Z-8.9563 F3000
+G1 X35.180 Y4.500 Z-8.9327 F3000
+G1 X35.160 Y4.500 Z-8.9091 F3000
+G1 X35.140 Y4.500 Z-8.8857 F3000
+G1 X35.120 Y4.500 Z-8.8622 F3000
+G1 X35.100 Y4.500 Z-8.8389 F3000
+G1 X35.080 Y4.500 Z-8.8156 F3000
+G1 X35.060 Y4.500 Z-8.7924 F3000
+G1 X35.040 Y4.500 Z-8.7693 F3000
+G1 X35.020 Y4.500 Z-8.7463 F3000
+G1 X35.000 Y4.500 Z-8.7233 F3000
+G1 X34.980 Y4.500 Z-8.7004 F3000
+G1 X34.960 Y4.500 Z-8.6776 F3000
+G1 X34.940 Y4.500 Z-8.6548 F3000
+G1 X34.920 Y4.500 Z-8.6321 F3000
+G1 X34.900 Y4.500 Z-8.6095 F3000
+G1 X34.880 Y4.500 Z-8.5869 F3000
+G1 X34.860 Y4.500 Z-8.5644 F3000
+G1 X34.840 Y4.500 Z-8.5420 F3000
+G1 X34.820 Y4.500 Z-8.5197 F3000
+G1 X34.800 Y4.500 Z-8.4974 F3000
+G1 X34.780 Y4.500 Z-8.4752 F3000
+G1 X34.760 Y4.500 Z-8.4530 F3000
+G1 X34.740 Y4.500 Z-8.4309 F3000
+G1 X34.720 Y4.500 Z-8.4089 F3000
+G1 X34.700 Y4.500 Z-8.3869 F3000
+G1 X34.680 Y4.500 Z-8.3651 F3000
+G1 X34.660 Y4.500 Z-8.3432 F3000
+G1 X34.640 Y4.500 Z-8.3215 F3000
+G1 X34.620 Y4.500 Z-8.2998 F3000
+G1 X34.600 Y4.500 Z-8.2782 F3000
+G1 X34.580 Y4.500 Z-8.2566 F3000
+G1 X34.560 Y4.500 Z-8.2351 F3000
+G1 X34.540 Y4.500 Z-8.2137 F3000
+G1 X34.520 Y4.500 Z-8.1923 F3000
+G1 X34.500 Y4.500 Z-8.1710 F3000
+G1 X34.480 Y4.500 Z-8.1497 F3000
+G1 X34.460 Y4.500 Z-8.1286 F3000
+G1 X34.440 Y4.500 Z-8.1074 F3000
+G1 X34.420 Y4.500 Z-8.0864 F3000
+G1 X34.400 Y4.500 Z-8.0654 F3000
+G1 X34.380 Y4.500 Z-8.0444 F3000
+G1 X34.360 Y4.500 Z-8.0236 F3000
+G1 X34.340 Y4.500 Z-8.0027 F3000
+G1 X34.320 Y4.500 Z-7.9820 F3000
+G1 X34.300 Y4.500 Z-7.9613 F3000
+G1 X34.280 Y4.500 Z-7.9406 F3000
+G1 X34.260 Y4.500 Z-7.9201 F3000
+G1 X34.240 Y4.500 Z-7.8996 F3000
+G1 X34.220 Y4.500 Z-7.8791 F3000
+G1 X34.200 Y4.500 Z-7.8587 F3000
+G1 X34.180 Y4.500 Z-7.8384 F3000
+G1 X34.160 Y4.500 Z-7.8181 F3000
+G1 X34.140 Y4.500 Z-7.7978 F3000
+G1 X34.120 Y4.500 Z-7.7777 F3000
+G1 X34.100 Y4.500 Z-7.7576 F3000
+G1 X34.080 Y4.500 Z-7.7375 F3000
+G1 X34.060 Y4.500 Z-7.7175 F3000
+G1 X34.040 Y4.500 Z-7.6976 F3000
+G1 X34.020 Y4.500 Z-7.6777 F3000
+G1 X34.000 Y4.500 Z-7.6579 F3000
+G1 X33.980 Y4.500 Z-7.6381 F3000
+G1 X33.960 Y4.500 Z-7.6184 F3000
+G1 X33.940 Y4.500 Z-7.5987 F3000
+G1 X33.920 Y4.500 Z-7.5791 F3000
+G1 X33.900 Y4.500 Z-7.5596 F3000
+G1 X33.880 Y4.500 Z-7.5401 F3000
+G1 X33.860 Y4.500 Z-7.5206 F3000
+G1 X33.840 Y4.500 Z-7.5012 F3000
+G1 X33.820 Y4.500 Z-7.4819 F3000
+G1 X33.800 Y4.500 Z-7.4626 F3000
+G1 X33.780 Y4.500 Z-7.4434 F3000
+G1 X33.760 Y4.500 Z-7.4242 F3000
+G1 X33.740 Y4.500 Z-7.4051 F3000
+G1 X33.720 Y4.500 Z-7.3861 F3000
+G1 X33.700 Y4.500 Z-7.3671 F3000
+G1 X33.680 Y4.500 Z-7.3481 F3000
+G1 X33.660 Y4.500 Z-7.3292 F3000
+G1 X33.640 Y4.500 Z-7.3103 F3000
+G1 X33.620 Y4.500 Z-7.2915 F3000
+G1 X33.600 Y4.500 Z-7.2728 F3000
+G1 X33.580 Y4.500 Z-7.2541 F3000
+G1 X33.560 Y4.500 Z-7.2354 F3000
+G1 X33.540 Y4.500 Z-7.2168 F3000
+G1 X33.520 Y4.500 Z-7.1983 F3000
+G1 X33.500 Y4.500 Z-7.1798 F3000
+G1 X33.480 Y4.500 Z-7.1614 F3000
+G1 X33.460 Y4.500 Z-7.1430 F3000
+G1 X33.440 Y4.500 Z-7.1246 F3000
+G1 X33.420 Y4.500 Z-7.1063 F3000
+G1 X33.400 Y4.500 Z-7.0881 F3000
+G1 X33.380 Y4.500 Z-7.0699 F3000
+G1 X33.360 Y4.500 Z-7.0518 F3000
+G1 X33.340 Y4.500 Z-7.0337 F3000
+G1 X33.320 Y4.500 Z-7.0156 F3000
+G1 X33.300 Y4.500 Z-6.9976 F3000
+G1 X33.280 Y4.500 Z-6.9797 F3000
+G1 X33.260 Y4.500 Z-6.9618 F3000
+G1 X33.240 Y4.500 Z-6.9439 F3000
+G1 X33.220 Y4.500 Z-6.9261 F3000
+G1 X33.200 Y4.500 Z-6.9084 F3000
+G1 X33.180 Y4.500 Z-6.8907 F3000
+G1 X33.160 Y4.500 Z-6.8730 F3000
+G1 X33.140 Y4.500 Z-6.8554 F3000
+G1 X33.120 Y4.500 Z-6.8379 F3000
+G1 X33.100 Y4.500 Z-6.8203 F3000
+G1 X33.080 Y4.500 Z-6.8029 F3000
+G1 X33.060 Y4.500 Z-6.7855 F3000
+G1 X33.040 Y4.500 Z-6.7681 F3000
+G1 X33.020 Y4.500 Z-6.7508 F3000
+G1 X33.000 Y4.500 Z-6.7335 F3000
+G1 X32.980 Y4.500 Z-6.7162 F3000
+G1 X32.960 Y4.500 Z-6.6991 F3000
+G1 X32.940 Y4.500 Z-6.6819 F3000
+G1 X32.920 Y4.500 Z-6.6648 F3000
+G1 X32.900 Y4.500 Z-6.6478 F3000
+G1 X32.880 Y4.500 Z-6.6308 F3000
+G1 X32.860 Y4.500 Z-6.6138 F3000
+G1 X32.840 Y4.500 Z-6.5969 F3000
+G1 X32.820 Y4.500 Z-6.5800 F3000
+G1 X32.800 Y4.500 Z-6.5632 F3000
+G1 X32.780 Y4.500 Z-6.5464 F3000
+G1 X32.760 Y4.500 Z-6.5297 F3000
+G1 X32.740 Y4.500 Z-6.5130 F3000
+G1 X32.720 Y4.500 Z-6.4964 F3000
+G1 X32.700 Y4.500 Z-6.4798 F3000
+G1 X32.680 Y4.500 Z-6.4632 F3000
+G1 X32.660 Y4.500 Z-6.4467 F3000
+G1 X32.640 Y4.500 Z-6.4302 F3000
+G1 X32.620 Y4.500 Z-6.4138 F3000
+G1 X32.600 Y4.500 Z-6.3974 F3000
+G1 X32.580 Y4.500 Z-6.3811 F3000
+G1 X32.560 Y4.500 Z-6.3648 F3000
+G1 X32.540 Y4.500 Z-6.3485 F3000
+G1 X32.520 Y4.500 Z-6.3323 F3000
+G1 X32.500 Y4.500 Z-6.3161 F3000
+G1 X32.480 Y4.500 Z-6.3000 F3000
+G1 X32.460 Y4.500 Z-6.2839 F3000
+G1 X32.440 Y4.500 Z-6.2679 F3000
+G1 X32.420 Y4.500 Z-6.2519 F3000
+G1 X32.400 Y4.500 Z-6.2359 F3000
+G1 X32.380 Y4.500 Z-6.2200 F3000
+G1 X32.360 Y4.500 Z-6.2042 F3000
+G1 X32.340 Y4.500 Z-6.1883 F3000
+G1 X32.320 Y4.500 Z-6.1725 F3000
+G1 X32.300 Y4.500 Z-6.1568 F3000
+G1 X32.280 Y4.500 Z-6.1411 F3000
+G1 X32.260 Y4.500 Z-6.1254 F3000
+G1 X32.240 Y4.500 Z-6.1098 F3000
+G1 X32.220 Y4.500 Z-6.0942 F3000
+G1 X32.200 Y4.500 Z-6.0787 F3000
+G1 X32.180 Y4.500 Z-6.0632 F3000
+G1 X32.160 Y4.500 Z-6.0477 F3000
+G1 X32.140 Y4.500 Z-6.0323 F3000
+G1 X32.120 Y4.500 Z-6.0169 F3000
+G1 X32.100 Y4.500 Z-6.0016 F3000
+G1 X32.080 Y4.500 Z-5.9863 F3000
+G1 X32.060 Y4.500 Z-5.9710 F3000
+G1 X32.040 Y4.500 Z-5.9558 F3000
+G1 X32.020 Y4.500 Z-5.9406 F3000
+G1 X32.000 Y4.500 Z-5.9255 F3000
+G1 X31.980 Y4.500 Z-5.9104 F3000
+G1 X31.960 Y4.500 Z-5.8953 F3000
+G1 X31.940 Y4.500 Z-5.8803 F3000
+G1 X31.920 Y4.500 Z-5.8653 F3000
+G1 X31.900 Y4.500 Z-5.8504 F3000
+G1 X31.880 Y4.500 Z-5.8355 F3000
+G1 X31.860 Y4.500 Z-5.8206 F3000
+G1 X31.840 Y4.500 Z-5.8058 F3000
+G1 X31.820 Y4.500 Z-5.7910 F3000
+G1 X31.800 Y4.500 Z-5.7763 F3000
+G1 X31.780 Y4.500 Z-5.7616 F3000
+G1 X31.760 Y4.500 Z-5.7469 F3000
+G1 X31.740 Y4.500 Z-5.7323 F3000
+G1 X31.720 Y4.500 Z-5.7177 F3000
+G1 X31.700 Y4.500 Z-5.7031 F3000
+G1 X31.680 Y4.500 Z-5.6886 F3000
+G1 X31.660 Y4.500 Z-5.6741 F3000
+G1 X31.640 Y4.500 Z-5.6597 F3000
+G1 X31.620 Y4.500 Z-5.6453 F3000
+G1 X31.600 Y4.500 Z-5.6309 F3000
+G1 X31.580 Y4.500 Z-5.6166 F3000
+G1 X31.560 Y4.500 Z-5.6023 F3000
+G1 X31.540 Y4.500 Z-5.5880 F3000
+G1 X31.520 Y4.500 Z-5.5738 F3000
+G1 X31.500 Y4.500 Z-5.5596 F3000
+G1 X31.480 Y4.500 Z-5.5455 F3000
+G1 X31.460 Y4.500 Z-5.5314 F3000
+G1 X31.440 Y4.500 Z-5.5173 F3000
+G1 X31.420 Y4.500 Z-5.5033 F3000
+G1 X31.400 Y4.500 Z-5.4893 F3000
+G1 X31.380 Y4.500 Z-5.4753 F3000
+G1 X31.360 Y4.500 Z-5.4614 F3000
+G1 X31.340 Y4.500 Z-5.4475 F3000
+G1 X31.320 Y4.500 Z-5.4336 F3000
+G1 X31.300 Y4.500 Z-5.4198 F3000
+G1 X31.280 Y4.500 Z-5.4060 F3000
+G1 X31.260 Y4.500 Z-5.3923 F3000
+G1 X31.240 Y4.500 Z-5.3786 F3000
+G1 X31.220 Y4.500 Z-5.3649 F3000
+G1 X31.200 Y4.500 Z-5.3513 F3000
+G1 X31.180 Y4.500 Z-5.3377 F3000
+G1 X31.160 Y4.500 Z-5.3241 F3000
+G1 X31.140 Y4.500 Z-5.3106 F3000
+G1 X31.120 Y4.500 Z-5.2971 F3000
+G1 X31.100 Y4.500 Z-5.2836 F3000
+G1 X31.080 Y4.500 Z-5.2702 F3000
+G1 X31.060 Y4.500 Z-5.2568 F3000
+G1 X31.040 Y4.500 Z-5.2435 F3000
+G1 X31.020 Y4.500 Z-5.2302 F3000
+G1 X31.000 Y4.500 Z-5.2169 F3000
+G1 X30.980 Y4.500 Z-5.2036 F3000
+G1 X30.960 Y4.500 Z-5.1904 F3000
+G1 X30.940 Y4.500 Z-5.1772 F3000
+G1 X30.920 Y4.500 Z-5.1641 F3000
+G1 X30.900 Y4.500 Z-5.1510 F3000
+G1 X30.880 Y4.500 Z-5.1379 F3000
+G1 X30.860 Y4.500 Z-5.1249 F3000
+G1 X30.840 Y4.500 Z-5.1118 F3000
+G1 X30.820 Y4.500 Z-5.0989 F3000
+G1 X30.800 Y4.500 Z-5.0859 F3000
+G1 X30.780 Y4.500 Z-5.0730 F3000
+G1 X30.760 Y4.500 Z-5.0602 F3000
+G1 X30.740 Y4.500 Z-5.0473 F3000
+G1 X30.720 Y4.500 Z-5.0345 F3000
+G1 X30.700 Y4.500 Z-5.0217 F3000
+G1 X30.680 Y4.500 Z-5.0090 F3000
+G1 X30.660 Y4.500 Z-4.9963 F3000
+G1 X30.640 Y4.500 Z-4.9836 F3000
+G1 X30.620 Y4.500 Z-4.9710 F3000
+G1 X30.600 Y4.500 Z-4.9584 F3000
+G1 X30.580 Y4.500 Z-4.9458 F3000
+G1 X30.560 Y4.500 Z-4.9333 F3000
+G1 X30.540 Y4.500 Z-4.9208 F3000
+G1 X30.520 Y4.500 Z-4.9083 F3000
+G1 X30.500 Y4.500 Z-4.8959 F3000
+G1 X30.480 Y4.500 Z-4.8835 F3000
+G1 X30.460 Y4.500 Z-4.8711 F3000
+G1 X30.440 Y4.500 Z-4.8587 F3000
+G1 X30.420 Y4.500 Z-4.8464 F3000
+G1 X30.400 Y4.500 Z-4.8342 F3000
+G1 X30.380 Y4.500 Z-4.8219 F3000
+G1 X30.360 Y4.500 Z-4.8097 F3000
+G1 X30.340 Y4.500 Z-4.7975 F3000
+G1 X30.320 Y4.500 Z-4.7854 F3000
+G1 X30.300 Y4.500 Z-4.7733 F3000
+G1 X30.280 Y4.500 Z-4.7612 F3000
+G1 X30.260 Y4.500 Z-4.7491 F3000
+G1 X30.240 Y4.500 Z-4.7371 F3000
+G1 X30.220 Y4.500 Z-4.7251 F3000
+G1 X30.200 Y4.500 Z-4.7132 F3000
+G1 X30.180 Y4.500 Z-4.7012 F3000
+G1 X30.160 Y4.500 Z-4.6893 F3000
+G1 X30.140 Y4.500 Z-4.6775 F3000
+G1 X30.120 Y4.500 Z-4.6657 F3000
+G1 X30.100 Y4.500 Z-4.6539 F3000
+G1 X30.080 Y4.500 Z-4.6421 F3000
+G1 X30.060 Y4.500 Z-4.6304 F3000
+G1 X30.040 Y4.500 Z-4.6187 F3000
+G1 X30.020 Y4.500 Z-4.6070 F3000
+G1 X30.000 Y4.500 Z-4.5953 F3000
+G1 X29.980 Y4.500 Z-4.5837 F3000
+G1 X29.960 Y4.500 Z-4.5722 F3000
+G1 X29.940 Y4.500 Z-4.5606 F3000
+G1 X29.920 Y4.500 Z-4.5491 F3000
+G1 X29.900 Y4.500 Z-4.5376 F3000
+G1 X29.880 Y4.500 Z-4.5262 F3000
+G1 X29.860 Y4.500 Z-4.5147 F3000
+G1 X29.840 Y4.500 Z-4.5033 F3000
+G1 X29.820 Y4.500 Z-4.4920 F3000
+G1 X29.800 Y4.500 Z-4.4806 F3000
+G1 X29.780 Y4.500 Z-4.4693 F3000
+G1 X29.760 Y4.500 Z-4.4581 F3000
+G1 X29.740 Y4.500 Z-4.4468 F3000
+G1 X29.720 Y4.500 Z-4.4356 F3000
+G1 X29.700 Y4.500 Z-4.4244 F3000
+G1 X29.680 Y4.500 Z-4.4133 F3000
+G1 X29.660 Y4.500 Z-4.4022 F3000
+G1 X29.640 Y4.500 Z-4.3911 F3000
+G1 X29.620 Y4.500 Z-4.3800 F3000
+G1 X29.600 Y4.500 Z-4.3690 F3000
+G1 X29.580 Y4.500 Z-4.3580 F3000
+G1 X29.560 Y4.500 Z-4.3470 F3000
+G1 X29.540 Y4.500 Z-4.3361 F3000
+G1 X29.520 Y4.500 Z-4.3252 F3000
+G1 X29.500 Y4.500 Z-4.3143 F3000
+G1 X29.480 Y4.500 Z-4.3034 F3000
+G1 X29.460 Y4.500 Z-4.2926 F3000
+G1 X29.440 Y4.500 Z-4.2818 F3000
+G1 X29.420 Y4.500 Z-4.2711 F3000
+G1 X29.400 Y4.500 Z-4.2603 F3000
+G1 X29.380 Y4.500 Z-4.2496 F3000
+G1 X29.360 Y4.500 Z-4.2390 F3000
+G1 X29.340 Y4.500 Z-4.2283 F3000
+G1 X29.320 Y4.500 Z-4.2177 F3000
+G1 X29.300 Y4.500 Z-4.2071 F3000
+G1 X29.280 Y4.500 Z-4.1965 F3000
+G1 X29.260 Y4.500 Z-4.1860 F3000
+G1 X29.240 Y4.500 Z-4.1755 F3000
+G1 X29.220 Y4.500 Z-4.1650 F3000
+G1 X29.200 Y4.500 Z-4.1546 F3000
+G1 X29.180 Y4.500 Z-4.1442 F3000
+G1 X29.160 Y4.500 Z-4.1338 F3000
+G1 X29.140 Y4.500 Z-4.1235 F3000
+G1 X29.120 Y4.500 Z-4.1131 F3000
+G1 X29.100 Y4.500 Z-4.1028 F3000
+G1 X29.080 Y4.500 Z-4.0926 F3000
+G1 X29.060 Y4.500 Z-4.0823 F3000
+G1 X29.040 Y4.500 Z-4.0721 F3000
+G1 X29.020 Y4.500 Z-4.0619 F3000
+G1 X29.000 Y4.500 Z-4.0518 F3000
+G1 X28.980 Y4.500 Z-4.0416 F3000
+G1 X28.960 Y4.500 Z-4.0315 F3000
+G1 X28.940 Y4.500 Z-4.0215 F3000
+G1 X28.920 Y4.500 Z-4.0114 F3000
+G1 X28.900 Y4.500 Z-4.0014 F3000
+G1 X28.880 Y4.500 Z-3.9914 F3000
+G1 X28.860 Y4.500 Z-3.9815 F3000
+G1 X28.840 Y4.500 Z-3.9715 F3000
+G1 X28.820 Y4.500 Z-3.9616 F3000
+G1 X28.800 Y4.500 Z-3.9518 F3000
+G1 X28.780 Y4.500 Z-3.9419 F3000
+G1 X28.760 Y4.500 Z-3.9321 F3000
+G1 X28.740 Y4.500 Z-3.9223 F3000
+G1 X28.720 Y4.500 Z-3.9125 F3000
+G1 X28.700 Y4.500 Z-3.9028 F3000
+G1 X28.680 Y4.500 Z-3.8931 F3000
+G1 X28.660 Y4.500 Z-3.8834 F3000
+G1 X28.640 Y4.500 Z-3.8738 F3000
+G1 X28.620 Y4.500 Z-3.8641 F3000
+G1 X28.600 Y4.500 Z-3.8545 F3000
+G1 X28.580 Y4.500 Z-3.8450 F3000
+G1 X28.560 Y4.500 Z-3.8354 F3000
+G1 X28.540 Y4.500 Z-3.8259 F3000
+G1 X28.520 Y4.500 Z-3.8164 F3000
+G1 X28.500 Y4.500 Z-3.8069 F3000
+G1 X28.480 Y4.500 Z-3.7975 F3000
+G1 X28.460 Y4.500 Z-3.7881 F3000
+G1 X28.440 Y4.500 Z-3.7787 F3000
+G1 X28.420 Y4.500 Z-3.7694 F3000
+G1 X28.400 Y4.500 Z-3.7600 F3000
+G1 X28.380 Y4.500 Z-3.7507 F3000
+G1 X28.360 Y4.500 Z-3.7415 F3000
+G1 X28.340 Y4.500 Z-3.7322 F3000
+G1 X28.320 Y4.500 Z-3.7230 F3000
+G1 X28.300 Y4.500 Z-3.7138 F3000
+G1 X28.280 Y4.500 Z-3.7047 F3000
+G1 X28.260 Y4.500 Z-3.6955 F3000
+G1 X28.240 Y4.500 Z-3.6864 F3000
+G1 X28.220 Y4.500 Z-3.6773 F3000
+G1 X28.200 Y4.500 Z-3.6683 F3000
+G1 X28.180 Y4.500 Z-3.6592 F3000
+G1 X28.160 Y4.500 Z-3.6502 F3000
+G1 X28.140 Y4.500 Z-3.6412 F3000
+G1 X28.120 Y4.500 Z-3.6323 F3000
+G1 X28.100 Y4.500 Z-3.6234 F3000
+G1 X28.080 Y4.500 Z-3.6145 F3000
+G1 X28.060 Y4.500 Z-3.6056 F3000
+G1 X28.040 Y4.500 Z-3.5967 F3000
+G1 X28.020 Y4.500 Z-3.5879 F3000
+G1 X28.000 Y4.500 Z-3.5791 F3000
+G1 X27.980 Y4.500 Z-3.5704 F3000
+G1 X27.960 Y4.500 Z-3.5616 F3000
+G1 X27.940 Y4.500 Z-3.5529 F3000
+G1 X27.920 Y4.500 Z-3.5442 F3000
+G1 X27.900 Y4.500 Z-3.5356 F3000
+G1 X27.880 Y4.500 Z-3.5269 F3000
+G1 X27.860 Y4.500 Z-3.5183 F3000
+G1 X27.840 Y4.500 Z-3.5097 F3000
+G1 X27.820 Y4.500 Z-3.5012 F3000
+G1 X27.800 Y4.500 Z-3.4926 F3000
+G1 X27.780 Y4.500 Z-3.4841 F3000
+G1 X27.760 Y4.500 Z-3.4756 F3000
+G1 X27.740 Y4.500 Z-3.4672 F3000
+G1 X27.720 Y4.500 Z-3.4587 F3000
+G1 X27.700 Y4.500 Z-3.4503 F3000
+G1 X27.680 Y4.500 Z-3.4420 F3000
+G1 X27.660 Y4.500 Z-3.4336 F3000
+G1 X27.640 Y4.500 Z-3.4253 F3000
+G1 X27.620 Y4.500 Z-3.4170 F3000
+G1 X27.600 Y4.500 Z-3.4087 F3000
+G1 X27.580 Y4.500 Z-3.4004 F3000
+G1 X27.560 Y4.500 Z-3.3922 F3000
+G1 X27.540 Y4.500 Z-3.3840 F3000
+G1 X27.520 Y4.500 Z-3.3758 F3000
+G1 X27.500 Y4.500 Z-3.3677 F3000
+G1 X27.480 Y4.500 Z-3.3596 F3000
+G1 X27.460 Y4.500 Z-3.3515 F3000
+G1 X27.440 Y4.500 Z-3.3434 F3000
+G1 X27.420 Y4.500 Z-3.3353 F3000
+G1 X27.400 Y4.500 Z-3.3273 F3000
+G1 X27.380 Y4.500 Z-3.3193 F3000
+G1 X27.360 Y4.500 Z-3.3113 F3000
+G1 X27.340 Y4.500 Z-3.3034 F3000
+G1 X27.320 Y4.500 Z-3.2955 F3000
+G1 X27.300 Y4.500 Z-3.2876 F3000
+G1 X27.280 Y4.500 Z-3.2797 F3000
+G1 X27.260 Y4.500 Z-3.2718 F3000
+G1 X27.240 Y4.500 Z-3.2640 F3000
+G1 X27.220 Y4.500 Z-3.2562 F3000
+G1 X27.200 Y4.500 Z-3.2485 F3000
+G1 X27.180 Y4.500 Z-3.2407 F3000
+G1 X27.160 Y4.500 Z-3.2330 F3000
+G1 X27.140 Y4.500 Z-3.2253 F3000
+G1 X27.120 Y4.500 Z-3.2176 F3000
+G1 X27.100 Y4.500 Z-3.2099 F3000
+G1 X27.080 Y4.500 Z-3.2023 F3000
+G1 X27.060 Y4.500 Z-3.1947 F3000
+G1 X27.040 Y4.500 Z-3.1871 F3000
+G1 X27.020 Y4.500 Z-3.1796 F3000
+G1 X27.000 Y4.500 Z-3.1721 F3000
+G1 X26.980 Y4.500 Z-3.1646 F3000
+G1 X26.960 Y4.500 Z-3.1571 F3000
+G1 X26.940 Y4.500 Z-3.1496 F3000
+G1 X26.920 Y4.500 Z-3.1422 F3000
+G1 X26.900 Y4.500 Z-3.1348 F3000
+G1 X26.880 Y4.500 Z-3.1274 F3000
+G1 X26.860 Y4.500 Z-3.1201 F3000
+G1 X26.840 Y4.500 Z-3.1127 F3000
+G1 X26.820 Y4.500 Z-3.1054 F3000
+G1 X26.800 Y4.500 Z-3.0981 F3000
+G1 X26.780 Y4.500 Z-3.0909 F3000
+G1 X26.760 Y4.500 Z-3.0836 F3000
+G1 X26.740 Y4.500 Z-3.0764 F3000
+G1 X26.720 Y4.500 Z-3.0692 F3000
+G1 X26.700 Y4.500 Z-3.0621 F3000
+G1 X26.680 Y4.500 Z-3.0549 F3000
+G1 X26.660 Y4.500 Z-3.0478 F3000
+G1 X26.640 Y4.500 Z-3.0407 F3000
+G1 X26.620 Y4.500 Z-3.0337 F3000
+G1 X26.600 Y4.500 Z-3.0266 F3000
+G1 X26.580 Y4.500 Z-3.0196 F3000
+G1 X26.560 Y4.500 Z-3.0126 F3000
+G1 X26.540 Y4.500 Z-3.0056 F3000
+G1 X26.520 Y4.500 Z-2.9987 F3000
+G1 X26.500 Y4.500 Z-2.9918 F3000
+G1 X26.480 Y4.500 Z-2.9849 F3000
+G1 X26.460 Y4.500 Z-2.9780 F3000
+G1 X26.440 Y4.500 Z-2.9711 F3000
+G1 X26.420 Y4.500 Z-2.9643 F3000
+G1 X26.400 Y4.500 Z-2.9575 F3000
+G1 X26.380 Y4.500 Z-2.9507 F3000
+G1 X26.360 Y4.500 Z-2.9440 F3000
+G1 X26.340 Y4.500 Z-2.9372 F3000
+G1 X26.320 Y4.500 Z-2.9305 F3000
+G1 X26.300 Y4.500 Z-2.9238 F3000
+G1 X26.280 Y4.500 Z-2.9172 F3000
+G1 X26.260 Y4.500 Z-2.9105 F3000
+G1 X26.240 Y4.500 Z-2.9039 F3000
+G1 X26.220 Y4.500 Z-2.8973 F3000
+G1 X26.200 Y4.500 Z-2.8907 F3000
+G1 X26.180 Y4.500 Z-2.8842 F3000
+G1 X26.160 Y4.500 Z-2.8777 F3000
+G1 X26.140 Y4.500 Z-2.8712 F3000
+G1 X26.120 Y4.500 Z-2.8647 F3000
+G1 X26.100 Y4.500 Z-2.8582 F3000
+G1 X26.080 Y4.500 Z-2.8518 F3000
+G1 X26.060 Y4.500 Z-2.8454 F3000
+G1 X26.040 Y4.500 Z-2.8390 F3000
+G1 X26.020 Y4.500 Z-2.8327 F3000
+G1 X26.000 Y4.500 Z-2.8263 F3000
+G1 X25.980 Y4.500 Z-2.8200 F3000
+G1 X25.960 Y4.500 Z-2.8137 F3000
+G1 X25.940 Y4.500 Z-2.8075 F3000
+G1 X25.920 Y4.500 Z-2.8012 F3000
+G1 X25.900 Y4.500 Z-2.7950 F3000
+G1 X25.880 Y4.500 Z-2.7888 F3000
+G1 X25.860 Y4.500 Z-2.7826 F3000
+G1 X25.840 Y4.500 Z-2.7765 F3000
+G1 X25.820 Y4.500 Z-2.7703 F3000
+G1 X25.800 Y4.500 Z-2.7642 F3000
+G1 X25.780 Y4.500 Z-2.7582 F3000
+G1 X25.760 Y4.500 Z-2.7521 F3000
+G1 X25.740 Y4.500 Z-2.7461 F3000
+G1 X25.720 Y4.500 Z-2.7401 F3000
+G1 X25.700 Y4.500 Z-2.7341 F3000
+G1 X25.680 Y4.500 Z-2.7281 F3000
+G1 X25.660 Y4.500 Z-2.7221 F3000
+G1 X25.640 Y4.500 Z-2.7162 F3000
+G1 X25.620 Y4.500 Z-2.7103 F3000
+G1 X25.600 Y4.500 Z-2.7045 F3000
+G1 X25.580 Y4.500 Z-2.6986 F3000
+G1 X25.560 Y4.500 Z-2.6928 F3000
+G1 X25.540 Y4.500 Z-2.6870 F3000
+G1 X25.520 Y4.500 Z-2.6812 F3000
+G1 X25.500 Y4.500 Z-2.6754 F3000
+G1 X25.480 Y4.500 Z-2.6697 F3000
+G1 X25.460 Y4.500 Z-2.6640 F3000
+G1 X25.440 Y4.500 Z-2.6583 F3000
+G1 X25.420 Y4.500 Z-2.6526 F3000
+G1 X25.400 Y4.500 Z-2.6469 F3000
+G1 X25.380 Y4.500 Z-2.6413 F3000
+G1 X25.360 Y4.500 Z-2.6357 F3000
+G1 X25.340 Y4.500 Z-2.6301 F3000
+G1 X25.320 Y4.500 Z-2.6246 F3000
+G1 X25.300 Y4.500 Z-2.6190 F3000
+G1 X25.280 Y4.500 Z-2.6135 F3000
+G1 X25.260 Y4.500 Z-2.6080 F3000
+G1 X25.240 Y4.500 Z-2.6025 F3000
+G1 X25.220 Y4.500 Z-2.5971 F3000
+G1 X25.200 Y4.500 Z-2.5917 F3000
+G1 X25.180 Y4.500 Z-2.5863 F3000
+G1 X25.160 Y4.500 Z-2.5809 F3000
+G1 X25.140 Y4.500 Z-2.5755 F3000
+G1 X25.120 Y4.500 Z-2.5702 F3000
+G1 X25.100 Y4.500 Z-2.5649 F3000
+G1 X25.080 Y4.500 Z-2.5596 F3000
+G1 X25.060 Y4.500 Z-2.5543 F3000
+G1 X25.040 Y4.500 Z-2.5491 F3000
+G1 X25.020 Y4.500 Z-2.5438 F3000
+G1 X25.000 Y4.500 Z-2.5386 F3000
+G1 X24.980 Y4.500 Z-2.5335 F3000
+G1 X24.960 Y4.500 Z-2.5283 F3000
+G1 X24.940 Y4.500 Z-2.5232 F3000
+G1 X24.920 Y4.500 Z-2.5180 F3000
+G1 X24.900 Y4.500 Z-2.5130 F3000
+G1 X24.880 Y4.500 Z-2.5079 F3000
+G1 X24.860 Y4.500 Z-2.5028 F3000
+G1 X24.840 Y4.500 Z-2.4978 F3000
+G1 X24.820 Y4.500 Z-2.4928 F3000
+G1 X24.800 Y4.500 Z-2.4878 F3000
+G1 X24.780 Y4.500 Z-2.4829 F3000
+G1 X24.760 Y4.500 Z-2.4779 F3000
+G1 X24.740 Y4.500 Z-2.4730 F3000
+G1 X24.720 Y4.500 Z-2.4681 F3000
+G1 X24.700 Y4.500 Z-2.4632 F3000
+G1 X24.680 Y4.500 Z-2.4584 F3000
+G1 X24.660 Y4.500 Z-2.4536 F3000
+G1 X24.640 Y4.500 Z-2.4488 F3000
+G1 X24.620 Y4.500 Z-2.4440 F3000
+G1 X24.600 Y4.500 Z-2.4392 F3000
+G1 X24.580 Y4.500 Z-2.4345 F3000
+G1 X24.560 Y4.500 Z-2.4298 F3000
+G1 X24.540 Y4.500 Z-2.4251 F3000
+G1 X24.520 Y4.500 Z-2.4204 F3000
+G1 X24.500 Y4.500 Z-2.4157 F3000
+G1 X24.480 Y4.500 Z-2.4111 F3000
+G1 X24.460 Y4.500 Z-2.4065 F3000
+G1 X24.440 Y4.500 Z-2.4019 F3000
+G1 X24.420 Y4.500 Z-2.3973 F3000
+G1 X24.400 Y4.500 Z-2.3928 F3000
+G1 X24.380 Y4.500 Z-2.3883 F3000
+G1 X24.360 Y4.500 Z-2.3838 F3000
+G1 X24.340 Y4.500 Z-2.3793 F3000
+G1 X24.320 Y4.500 Z-2.3748 F3000
+G1 X24.300 Y4.500 Z-2.3704 F3000
+G1 X24.280 Y4.500 Z-2.3660 F3000
+G1 X24.260 Y4.500 Z-2.3616 F3000
+G1 X24.240 Y4.500 Z-2.3572 F3000
+G1 X24.220 Y4.500 Z-2.3529 F3000
+G1 X24.200 Y4.500 Z-2.3485 F3000
+G1 X24.180 Y4.500 Z-2.3442 F3000
+G1 X24.160 Y4.500 Z-2.3399 F3000
+G1 X24.140 Y4.500 Z-2.3357 F3000
+G1 X24.120 Y4.500 Z-2.3314 F3000
+G1 X24.100 Y4.500 Z-2.3272 F3000
+G1 X24.080 Y4.500 Z-2.3230 F3000
+G1 X24.060 Y4.500 Z-2.3188 F3000
+G1 X24.040 Y4.500 Z-2.3147 F3000
+G1 X24.020 Y4.500 Z-2.3105 F3000
+G1 X24.000 Y4.500 Z-2.3064 F3000
+G1 X23.980 Y4.500 Z-2.3023 F3000
+G1 X23.960 Y4.500 Z-2.2982 F3000
+G1 X23.940 Y4.500 Z-2.2942 F3000
+G1 X23.920 Y4.500 Z-2.2902 F3000
+G1 X23.900 Y4.500 Z-2.2862 F3000
+G1 X23.880 Y4.500 Z-2.2822 F3000
+G1 X23.860 Y4.500 Z-2.2782 F3000
+G1 X23.840 Y4.500 Z-2.2743 F3000
+G1 X23.820 Y4.500 Z-2.2703 F3000
+G1 X23.800 Y4.500 Z-2.2664 F3000
+G1 X23.780 Y4.500 Z-2.2626 F3000
+G1 X23.760 Y4.500 Z-2.2587 F3000
+G1 X23.740 Y4.500 Z-2.2549 F3000
+G1 X23.720 Y4.500 Z-2.2510 F3000
+G1 X23.700 Y4.500 Z-2.2473 F3000
+G1 X23.680 Y4.500 Z-2.2435 F3000
+G1 X23.660 Y4.500 Z-2.2397 F3000
+G1 X23.640 Y4.500 Z-2.2360 F3000
+G1 X23.620 Y4.500 Z-2.2323 F3000
+G1 X23.600 Y4.500 Z-2.2286 F3000
+G1 X23.580 Y4.500 Z-2.2249 F3000
+G1 X23.560 Y4.500 Z-2.2213 F3000
+G1 X23.540 Y4.500 Z-2.2177 F3000
+G1 X23.520 Y4.500 Z-2.2140 F3000
+G1 X23.500 Y4.500 Z-2.2105 F3000
+G1 X23.480 Y4.500 Z-2.2069 F3000
+G1 X23.460 Y4.500 Z-2.2034 F3000
+G1 X23.440 Y4.500 Z-2.1998 F3000
+G1 X23.420 Y4.500 Z-2.1963 F3000
+G1 X23.400 Y4.500 Z-2.1929 F3000
+G1 X23.380 Y4.500 Z-2.1894 F3000
+G1 X23.360 Y4.500 Z-2.1860 F3000
+G1 X23.340 Y4.500 Z-2.1825 F3000
+G1 X23.320 Y4.500 Z-2.1792 F3000
+G1 X23.300 Y4.500 Z-2.1758 F3000
+G1 X23.280 Y4.500 Z-2.1724 F3000
+G1 X23.260 Y4.500 Z-2.1691 F3000
+G1 X23.240 Y4.500 Z-2.1658 F3000
+G1 X23.220 Y4.500 Z-2.1625 F3000
+G1 X23.200 Y4.500 Z-2.1592 F3000
+G1 X23.180 Y4.500 Z-2.1560 F3000
+G1 X23.160 Y4.500 Z-2.1528 F3000
+G1 X23.140 Y4.500 Z-2.1495 F3000
+G1 X23.120 Y4.500 Z-2.1464 F3000
+G1 X23.100 Y4.500 Z-2.1432 F3000
+G1 X23.080 Y4.500 Z-2.1401 F3000
+G1 X23.060 Y4.500 Z-2.1369 F3000
+G1 X23.040 Y4.500 Z-2.1338 F3000
+G1 X23.020 Y4.500 Z-2.1307 F3000
+G1 X23.000 Y4.500 Z-2.1277 F3000
+G1 X22.980 Y4.500 Z-2.1246 F3000
+G1 X22.960 Y4.500 Z-2.1216 F3000
+G1 X22.940 Y4.500 Z-2.1186 F3000
+G1 X22.920 Y4.500 Z-2.1157 F3000
+G1 X22.900 Y4.500 Z-2.1127 F3000
+G1 X22.880 Y4.500 Z-2.1098 F3000
+G1 X22.860 Y4.500 Z-2.1068 F3000
+G1 X22.840 Y4.500 Z-2.1039 F3000
+G1 X22.820 Y4.500 Z-2.1011 F3000
+G1 X22.800 Y4.500 Z-2.0982 F3000
+G1 X22.780 Y4.500 Z-2.0954 F3000
+G1 X22.760 Y4.500 Z-2.0926 F3000
+G1 X22.740 Y4.500 Z-2.0898 F3000
+G1 X22.720 Y4.500 Z-2.0870 F3000
+G1 X22.700 Y4.500 Z-2.0843 F3000
+G1 X22.680 Y4.500 Z-2.0815 F3000
+G1 X22.660 Y4.500 Z-2.0788 F3000
+G1 X22.640 Y4.500 Z-2.0761 F3000
+G1 X22.620 Y4.500 Z-2.0735 F3000
+G1 X22.600 Y4.500 Z-2.0708 F3000
+G1 X22.580 Y4.500 Z-2.0682 F3000
+G1 X22.560 Y4.500 Z-2.0656 F3000
+G1 X22.540 Y4.500 Z-2.0630 F3000
+G1 X22.520 Y4.500 Z-2.0605 F3000
+G1 X22.500 Y4.500 Z-2.0579 F3000
+G1 X22.480 Y4.500 Z-2.0554 F3000
+G1 X22.460 Y4.500 Z-2.0529 F3000
+G1 X22.440 Y4.500 Z-2.0504 F3000
+G1 X22.420 Y4.500 Z-2.0479 F3000
+G1 X22.400 Y4.500 Z-2.0455 F3000
+G1 X22.380 Y4.500 Z-2.0431 F3000
+G1 X22.360 Y4.500 Z-2.0407 F3000
+G1 X22.340 Y4.500 Z-2.0383 F3000
+G1 X22.320 Y4.500 Z-2.0360 F3000
+G1 X22.300 Y4.500 Z-2.0336 F3000
+G1 X22.280 Y4.500 Z-2.0313 F3000
+G1 X22.260 Y4.500 Z-2.0290 F3000
+G1 X22.240 Y4.500 Z-2.0267 F3000
+G1 X22.220 Y4.500 Z-2.0245 F3000
+G1 X22.200 Y4.500 Z-2.0222 F3000
+G1 X22.180 Y4.500 Z-2.0200 F3000
+G1 X22.160 Y4.500 Z-2.0178 F3000
+G1 X22.140 Y4.500 Z-2.0157 F3000
+G1 X22.120 Y4.500 Z-2.0135 F3000
+G1 X22.100 Y4.500 Z-2.0114 F3000
+G1 X22.080 Y4.500 Z-2.0093 F3000
+G1 X22.060 Y4.500 Z-2.0072 F3000
+G1 X22.040 Y4.500 Z-2.0051 F3000
+G1 X22.020 Y4.500 Z-2.0030 F3000
+G1 X22.000 Y4.500 Z-2.0010 F3000
+G1 X21.980 Y4.500 Z-1.9990 F3000
+G1 X21.960 Y4.500 Z-1.9970 F3000
+G1 X21.940 Y4.500 Z-1.9950 F3000
+G1 X21.920 Y4.500 Z-1.9931 F3000
+G1 X21.900 Y4.500 Z-1.9912 F3000
+G1 X21.880 Y4.500 Z-1.9893 F3000
+G1 X21.860 Y4.500 Z-1.9874 F3000
+G1 X21.840 Y4.500 Z-1.9855 F3000
+G1 X21.820 Y4.500 Z-1.9837 F3000
+G1 X21.800 Y4.500 Z-1.9818 F3000
+G1 X21.780 Y4.500 Z-1.9800 F3000
+G1 X21.760 Y4.500 Z-1.9782 F3000
+G1 X21.740 Y4.500 Z-1.9765 F3000
+G1 X21.720 Y4.500 Z-1.9747 F3000
+G1 X21.700 Y4.500 Z-1.9730 F3000
+G1 X21.680 Y4.500 Z-1.9713 F3000
+G1 X21.660 Y4.500 Z-1.9696 F3000
+G1 X21.640 Y4.500 Z-1.9679 F3000
+G1 X21.620 Y4.500 Z-1.9663 F3000
+G1 X21.600 Y4.500 Z-1.9647 F3000
+G1 X21.580 Y4.500 Z-1.9631 F3000
+G1 X21.560 Y4.500 Z-1.9615 F3000
+G1 X21.540 Y4.500 Z-1.9599 F3000
+G1 X21.520 Y4.500 Z-1.9584 F3000
+G1 X21.500 Y4.500 Z-1.9569 F3000
+G1 X21.480 Y4.500 Z-1.9554 F3000
+G1 X21.460 Y4.500 Z-1.9539 F3000
+G1 X21.440 Y4.500 Z-1.9524 F3000
+G1 X21.420 Y4.500 Z-1.9510 F3000
+G1 X21.400 Y4.500 Z-1.9496 F3000
+G1 X21.380 Y4.500 Z-1.9482 F3000
+G1 X21.360 Y4.500 Z-1.9468 F3000
+G1 X21.340 Y4.500 Z-1.9454 F3000
+G1 X21.320 Y4.500 Z-1.9441 F3000
+G1 X21.300 Y4.500 Z-1.9428 F3000
+G1 X21.280 Y4.500 Z-1.9415 F3000
+G1 X21.260 Y4.500 Z-1.9402 F3000
+G1 X21.240 Y4.500 Z-1.9389 F3000
+G1 X21.220 Y4.500 Z-1.9377 F3000
+G1 X21.200 Y4.500 Z-1.9365 F3000
+G1 X21.180 Y4.500 Z-1.9353 F3000
+G1 X21.160 Y4.500 Z-1.9341 F3000
+G1 X21.140 Y4.500 Z-1.9329 F3000
+G1 X21.120 Y4.500 Z-1.9318 F3000
+G1 X21.100 Y4.500 Z-1.9307 F3000
+G1 X21.080 Y4.500 Z-1.9296 F3000
+G1 X21.060 Y4.500 Z-1.9285 F3000
+G1 X21.040 Y4.500 Z-1.9274 F3000
+G1 X21.020 Y4.500 Z-1.9264 F3000
+G1 X21.000 Y4.500 Z-1.9254 F3000
+G1 X20.980 Y4.500 Z-1.9244 F3000
+G1 X20.960 Y4.500 Z-1.9234 F3000
+G1 X20.940 Y4.500 Z-1.9225 F3000
+G1 X20.920 Y4.500 Z-1.9215 F3000
+G1 X20.900 Y4.500 Z-1.9206 F3000
+G1 X20.880 Y4.500 Z-1.9197 F3000
+G1 X20.860 Y4.500 Z-1.9188 F3000
+G1 X20.840 Y4.500 Z-1.9180 F3000
+G1 X20.820 Y4.500 Z-1.9172 F3000
+G1 X20.800 Y4.500 Z-1.9163 F3000
+G1 X20.780 Y4.500 Z-1.9155 F3000
+G1 X20.760 Y4.500 Z-1.9148 F3000
+G1 X20.740 Y4.500 Z-1.9140 F3000
+G1 X20.720 Y4.500 Z-1.9133 F3000
+G1 X20.700 Y4.500 Z-1.9126 F3000
+G1 X20.680 Y4.500 Z-1.9119 F3000
+G1 X20.660 Y4.500 Z-1.9112 F3000
+G1 X20.640 Y4.500 Z-1.9105 F3000
+G1 X20.620 Y4.500 Z-1.9099 F3000
+G1 X20.600 Y4.500 Z-1.9093 F3000
+G1 X20.580 Y4.500 Z-1.9087 F3000
+G1 X20.560 Y4.500 Z-1.9081 F3000
+G1 X20.540 Y4.500 Z-1.9076 F3000
+G1 X20.520 Y4.500 Z-1.9070 F3000
+G1 X20.500 Y4.500 Z-1.9065 F3000
+G1 X20.480 Y4.500 Z-1.9060 F3000
+G1 X20.460 Y4.500 Z-1.9056 F3000
+G1 X20.440 Y4.500 Z-1.9051 F3000
+G1 X20.420 Y4.500 Z-1.9047 F3000
+G1 X20.400 Y4.500 Z-1.9043 F3000
+G1 X20.380 Y4.500 Z-1.9039 F3000
+G1 X20.360 Y4.500 Z-1.9035 F3000
+G1 X20.340 Y4.500 Z-1.9032 F3000
+G1 X20.320 Y4.500 Z-1.9028 F3000
+G1 X20.300 Y4.500 Z-1.9025 F3000
+G1 X20.280 Y4.500 Z-1.9022 F3000
+G1 X20.260 Y4.500 Z-1.9019 F3000
+G1 X20.240 Y4.500 Z-1.9017 F3000
+G1 X20.220 Y4.500 Z-1.9015 F3000
+G1 X20.200 Y4.500 Z-1.9013 F3000
+G1 X20.180 Y4.500 Z-1.9011 F3000
+G1 X20.160 Y4.500 Z-1.9009 F3000
+G1 X20.140 Y4.500 Z-1.9007 F3000
+G1 X20.120 Y4.500 Z-1.9006 F3000
+G1 X20.100 Y4.500 Z-1.9005 F3000
+G1 X20.080 Y4.500 Z-1.9004 F3000
+G1 X20.060 Y4.500 Z-1.9003 F3000
+G1 X20.040 Y4.500 Z-1.9003 F3000
+G1 X20.020 Y4.500 Z-1.9003 F3000
+G1 X20.000 Y4.500 Z-1.9003 F3000
+G1 X19.980 Y4.500 Z-1.9003 F3000
+G1 X19.960 Y4.500 Z-1.9003 F3000
+G1 X19.940 Y4.500 Z-1.9003 F3000
+G1 X19.920 Y4.500 Z-1.9004 F3000
+G1 X19.900 Y4.500 Z-1.9005 F3000
+G1 X19.880 Y4.500 Z-1.9006 F3000
+G1 X19.860 Y4.500 Z-1.9007 F3000
+G1 X19.840 Y4.500 Z-1.9009 F3000
+G1 X19.820 Y4.500 Z-1.9011 F3000
+G1 X19.800 Y4.500 Z-1.9013 F3000
+G1 X19.780 Y4.500 Z-1.9015 F3000
+G1 X19.760 Y4.500 Z-1.9017 F3000
+G1 X19.740 Y4.500 Z-1.9019 F3000
+G1 X19.720 Y4.500 Z-1.9022 F3000
+G1 X19.700 Y4.500 Z-1.9025 F3000
+G1 X19.680 Y4.500 Z-1.9028 F3000
+G1 X19.660 Y4.500 Z-1.9032 F3000
+G1 X19.640 Y4.500 Z-1.9035 F3000
+G1 X19.620 Y4.500 Z-1.9039 F3000
+G1 X19.600 Y4.500 Z-1.9043 F3000
+G1 X19.580 Y4.500 Z-1.9047 F3000
+G1 X19.560 Y4.500 Z-1.9051 F3000
+G1 X19.540 Y4.500 Z-1.9056 F3000
+G1 X19.520 Y4.500 Z-1.9060 F3000
+G1 X19.500 Y4.500 Z-1.9065 F3000
+G1 X19.480 Y4.500 Z-1.9070 F3000
+G1 X19.460 Y4.500 Z-1.9076 F3000
+G1 X19.440 Y4.500 Z-1.9081 F3000
+G1 X19.420 Y4.500 Z-1.9087 F3000
+G1 X19.400 Y4.500 Z-1.9093 F3000
+G1 X19.380 Y4.500 Z-1.9099 F3000
+G1 X19.360 Y4.500 Z-1.9105 F3000
+G1 X19.340 Y4.500 Z-1.9112 F3000
+G1 X19.320 Y4.500 Z-1.9119 F3000
+G1 X19.300 Y4.500 Z-1.9126 F3000
+G1 X19.280 Y4.500 Z-1.9133 F3000
+G1 X19.260 Y4.500 Z-1.9140 F3000
+G1 X19.240 Y4.500 Z-1.9148 F3000
+G1 X19.220 Y4.500 Z-1.9155 F3000
+G1 X19.200 Y4.500 Z-1.9163 F3000
+G1 X19.180 Y4.500 Z-1.9172 F3000
+G1 X19.160 Y4.500 Z-1.9180 F3000
+G1 X19.140 Y4.500 Z-1.9188 F3000
+G1 X19.120 Y4.500 Z-1.9197 F3000
+G1 X19.100 Y4.500 Z-1.9206 F3000
+G1 X19.080 Y4.500 Z-1.9215 F3000
+G1 X19.060 Y4.500 Z-1.9225 F3000
+G1 X19.040 Y4.500 Z-1.9234 F3000
+G1 X19.020 Y4.500 Z-1.9244 F3000
+G1 X19.000 Y4.500 Z-1.9254 F3000
+G1 X18.980 Y4.500 Z-1.9264 F3000
+G1 X18.960 Y4.500 Z-1.9274 F3000
+G1 X18.940 Y4.500 Z-1.9285 F3000
+G1 X18.920 Y4.500 Z-1.9296 F3000
+G1 X18.900 Y4.500 Z-1.9307 F3000
+G1 X18.880 Y4.500 Z-1.9318 F3000
+G1 X18.860 Y4.500 Z-1.9329 F3000
+G1 X18.840 Y4.500 Z-1.9341 F3000
+G1 X18.820 Y4.500 Z-1.9353 F3000
+G1 X18.800 Y4.500 Z-1.9365 F3000
+G1 X18.780 Y4.500 Z-1.9377 F3000
+G1 X18.760 Y4.500 Z-1.9389 F3000
+G1 X18.740 Y4.500 Z-1.9402 F3000
+G1 X18.720 Y4.500 Z-1.9415 F3000
+G1 X18.700 Y4.500 Z-1.9428 F3000
+G1 X18.680 Y4.500 Z-1.9441 F3000
+G1 X18.660 Y4.500 Z-1.9454 F3000
+G1 X18.640 Y4.500 Z-1.9468 F3000
+G1 X18.620 Y4.500 Z-1.9482 F3000
+G1 X18.600 Y4.500 Z-1.9496 F3000
+G1 X18.580 Y4.500 Z-1.9510 F3000
+G1 X18.560 Y4.500 Z-1.9524 F3000
+G1 X18.540 Y4.500 Z-1.9539 F3000
+G1 X18.520 Y4.500 Z-1.9554 F3000
+G1 X18.500 Y4.500 Z-1.9569 F3000
+G1 X18.480 Y4.500 Z-1.9584 F3000
+G1 X18.460 Y4.500 Z-1.9599 F3000
+G1 X18.440 Y4.500 Z-1.9615 F3000
+G1 X18.420 Y4.500 Z-1.9631 F3000
+G1 X18.400 Y4.500 Z-1.9647 F3000
+G1 X18.380 Y4.500 Z-1.9663 F3000
+G1 X18.360 Y4.500 Z-1.9679 F3000
+G1 X18.340 Y4.500 Z-1.9696 F3000
+G1 X18.320 Y4.500 Z-1.9713 F3000
+G1 X18.300 Y4.500 Z-1.9730 F3000
+G1 X18.280 Y4.500 Z-1.9747 F3000
+G1 X18.260 Y4.500 Z-1.9765 F3000
+G1 X18.240 Y4.500 Z-1.9782 F3000
+G1 X18.220 Y4.500 Z-1.9800 F3000
+G1 X18.200 Y4.500 Z-1.9818 F3000
+G1 X18.180 Y4.500 Z-1.9837 F3000
+G1 X18.160 Y4.500 Z-1.9855 F3000
+G1 X18.140 Y4.500 Z-1.9874 F3000
+G1 X18.120 Y4.500 Z-1.9893 F3000
+G1 X18.100 Y4.500 Z-1.9912 F3000
+G1 X18.080 Y4.500 Z-1.9931 F3000
+G1 X18.060 Y4.500 Z-1.9950 F3000
+G1 X18.040 Y4.500 Z-1.9970 F3000
+G1 X18.020 Y4.500 Z-1.9990 F3000
+G1 X18.000 Y4.500 Z-2.0010 F3000
+G1 X17.980 Y4.500 Z-2.0030 F3000
+G1 X17.960 Y4.500 Z-2.0051 F3000
+G1 X17.940 Y4.500 Z-2.0072 F3000
+G1 X17.920 Y4.500 Z-2.0093 F3000
+G1 X17.900 Y4.500 Z-2.0114 F3000
+G1 X17.880 Y4.500 Z-2.0135 F3000
+G1 X17.860 Y4.500 Z-2.0157 F3000
+G1 X17.840 Y4.500 Z-2.0178 F3000
+G1 X17.820 Y4.500 Z-2.0200 F3000
+G1 X17.800 Y4.500 Z-2.0222 F3000
+G1 X17.780 Y4.500 Z-2.0245 F3000
+G1 X17.760 Y4.500 Z-2.0267 F3000
+G1 X17.740 Y4.500 Z-2.0290 F3000
+G1 X17.720 Y4.500 Z-2.0313 F3000
+G1 X17.700 Y4.500 Z-2.0336 F3000
+G1 X17.680 Y4.500 Z-2.0360 F3000
+G1 X17.660 Y4.500 Z-2.0383 F3000
+G1 X17.640 Y4.500 Z-2.0407 F3000
+G1 X17.620 Y4.500 Z-2.0431 F3000
+G1 X17.600 Y4.500 Z-2.0455 F3000
+G1 X17.580 Y4.500 Z-2.0479 F3000
+G1 X17.560 Y4.500 Z-2.0504 F3000
+G1 X17.540 Y4.500 Z-2.0529 F3000
+G1 X17.520 Y4.500 Z-2.0554 F3000
+G1 X17.500 Y4.500 Z-2.0579 F3000
+G1 X17.480 Y4.500 Z-2.0605 F3000
+G1 X17.460 Y4.500 Z-2.0630 F3000
+G1 X17.440 Y4.500 Z-2.0656 F3000
+G1 X17.420 Y4.500 Z-2.0682 F3000
+G1 X17.400 Y4.500 Z-2.0708 F3000
+G1 X17.380 Y4.500 Z-2.0735 F3000
+G1 X17.360 Y4.500 Z-2.0761 F3000
+G1 X17.340 Y4.500 Z-2.0788 F3000
+G1 X17.320 Y4.500 Z-2.0815 F3000
+G1 X17.300 Y4.500 Z-2.0843 F3000
+G1 X17.280 Y4.500 Z-2.0870 F3000
+G1 X17.260 Y4.500 Z-2.0898 F3000
+G1 X17.240 Y4.500 Z-2.0926 F3000
+G1 X17.220 Y4.500 Z-2.0954 F3000
+G1 X17.200 Y4.500 Z-2.0982 F3000
+G1 X17.180 Y4.500 Z-2.1011 F3000
+G1 X17.160 Y4.500 Z-2.1039 F3000
+G1 X17.140 Y4.500 Z-2.1068 F3000
+G1 X17.120 Y4.500 Z-2.1098 F3000
+G1 X17.100 Y4.500 Z-2.1127 F3000
+G1 X17.080 Y4.500 Z-2.1157 F3000
+G1 X17.060 Y4.500 Z-2.1186 F3000
+G1 X17.040 Y4.500 Z-2.1216 F3000
+G1 X17.020 Y4.500 Z-2.1246 F3000
+G1 X17.000 Y4.500 Z-2.1277 F3000
+G1 X16.980 Y4.500 Z-2.1307 F3000
+G1 X16.960 Y4.500 Z-2.1338 F3000
+G1 X16.940 Y4.500 Z-2.1369 F3000
+G1 X16.920 Y4.500 Z-2.1401 F3000
+G1 X16.900 Y4.500 Z-2.1432 F3000
+G1 X16.880 Y4.500 Z-2.1464 F3000
+G1 X16.860 Y4.500 Z-2.1495 F3000
+G1 X16.840 Y4.500 Z-2.1528 F3000
+G1 X16.820 Y4.500 Z-2.1560 F3000
+G1 X16.800 Y4.500 Z-2.1592 F3000
+G1 X16.780 Y4.500 Z-2.1625 F3000
+G1 X16.760 Y4.500 Z-2.1658 F3000
+G1 X16.740 Y4.500 Z-2.1691 F3000
+G1 X16.720 Y4.500 Z-2.1724 F3000
+G1 X16.700 Y4.500 Z-2.1758 F3000
+G1 X16.680 Y4.500 Z-2.1792 F3000
+G1 X16.660 Y4.500 Z-2.1825 F3000
+G1 X16.640 Y4.500 Z-2.1860 F3000
+G1 X16.620 Y4.500 Z-2.1894 F3000
+G1 X16.600 Y4.500 Z-2.1929 F3000
+G1 X16.580 Y4.500 Z-2.1963 F3000
+G1 X16.560 Y4.500 Z-2.1998 F3000
+G1 X16.540 Y4.500 Z-2.2034 F3000
+G1 X16.520 Y4.500 Z-2.2069 F3000
+G1 X16.500 Y4.500 Z-2.2105 F3000
+G1 X16.480 Y4.500 Z-2.2140 F3000
+G1 X16.460 Y4.500 Z-2.2177 F3000
+G1 X16.440 Y4.500 Z-2.2213 F3000
+G1 X16.420 Y4.500 Z-2.2249 F3000
+G1 X16.400 Y4.500 Z-2.2286 F3000
+G1 X16.380 Y4.500 Z-2.2323 F3000
+G1 X16.360 Y4.500 Z-2.2360 F3000
+G1 X16.340 Y4.500 Z-2.2397 F3000
+G1 X16.320 Y4.500 Z-2.2435 F3000
+G1 X16.300 Y4.500 Z-2.2473 F3000
+G1 X16.280 Y4.500 Z-2.2510 F3000
+G1 X16.260 Y4.500 Z-2.2549 F3000
+G1 X16.240 Y4.500 Z-2.2587 F3000
+G1 X16.220 Y4.500 Z-2.2626 F3000
+G1 X16.200 Y4.500 Z-2.2664 F3000
+G1 X16.180 Y4.500 Z-2.2703 F3000
+G1 X16.160 Y4.500 Z-2.2743 F3000
+G1 X16.140 Y4.500 Z-2.2782 F3000
+G1 X16.120 Y4.500 Z-2.2822 F3000
+G1 X16.100 Y4.500 Z-2.2862 F3000
+G1 X16.080 Y4.500 Z-2.2902 F3000
+G1 X16.060 Y4.500 Z-2.2942 F3000
+G1 X16.040 Y4.500 Z-2.2982 F3000
+G1 X16.020 Y4.500 Z-2.3023 F3000
+G1 X16.000 Y4.500 Z-2.3064 F3000
+G1 X15.980 Y4.500 Z-2.3105 F3000
+G1 X15.960 Y4.500 Z-2.3147 F3000
+G1 X15.940 Y4.500 Z-2.3188 F3000
+G1 X15.920 Y4.500 Z-2.3230 F3000
+G1 X15.900 Y4.500 Z-2.3272 F3000
+G1 X15.880 Y4.500 Z-2.3314 F3000
+G1 X15.860 Y4.500 Z-2.3357 F3000
+G1 X15.840 Y4.500 Z-2.3399 F3000
+G1 X15.820 Y4.500 Z-2.3442 F3000
+G1 X15.800 Y4.500 Z-2.3485 F3000
+G1 X15.780 Y4.500 Z-2.3529 F3000
+G1 X15.760 Y4.500 Z-2.3572 F3000
+G1 X15.740 Y4.500 Z-2.3616 F3000
+G1 X15.720 Y4.500 Z-2.3660 F3000
+G1 X15.700 Y4.500 Z-2.3704 F3000
+G1 X15.680 Y4.500 Z-2.3748 F3000
+G1 X15.660 Y4.500 Z-2.3793 F3000
+G1 X15.640 Y4.500 Z-2.3838 F3000
+G1 X15.620 Y4.500 Z-2.3883 F3000
+G1 X15.600 Y4.500 Z-2.3928 F3000
+G1 X15.580 Y4.500 Z-2.3973 F3000
+G1 X15.560 Y4.500 Z-2.4019 F3000
+G1 X15.540 Y4.500 Z-2.4065 F3000
+G1 X15.520 Y4.500 Z-2.4111 F3000
+G1 X15.500 Y4.500 Z-2.4157 F3000
+G1 X15.480 Y4.500 Z-2.4204 F3000
+G1 X15.460 Y4.500 Z-2.4251 F3000
+G1 X15.440 Y4.500 Z-2.4298 F3000
+G1 X15.420 Y4.500 Z-2.4345 F3000
+G1 X15.400 Y4.500 Z-2.4392 F3000
+G1 X15.380 Y4.500 Z-2.4440 F3000
+G1 X15.360 Y4.500 Z-2.4488 F3000
+G1 X15.340 Y4.500 Z-2.4536 F3000
+G1 X15.320 Y4.500 Z-2.4584 F3000
+G1 X15.300 Y4.500 Z-2.4632 F3000
+G1 X15.280 Y4.500 Z-2.4681 F3000
+G1 X15.260 Y4.500 Z-2.4730 F3000
+G1 X15.240 Y4.500 Z-2.4779 F3000
+G1 X15.220 Y4.500 Z-2.4829 F3000
+G1 X15.200 Y4.500 Z-2.4878 F3000
+G1 X15.180 Y4.500 Z-2.4928 F3000
+G1 X15.160 Y4.500 Z-2.4978 F3000
+G1 X15.140 Y4.500 Z-2.5028 F3000
+G1 X15.120 Y4.500 Z-2.5079 F3000
+G1 X15.100 Y4.500 Z-2.5130 F3000
+G1 X15.080 Y4.500 Z-2.5180 F3000
+G1 X15.060 Y4.500 Z-2.5232 F3000
+G1 X15.040 Y4.500 Z-2.5283 F3000
+G1 X15.020 Y4.500 Z-2.5335 F3000
+G1 X15.000 Y4.500 Z-2.5386 F3000
+G1 X14.980 Y4.500 Z-2.5438 F3000
+G1 X14.960 Y4.500 Z-2.5491 F3000
+G1 X14.940 Y4.500 Z-2.5543 F3000
+G1 X14.920 Y4.500 Z-2.5596 F3000
+G1 X14.900 Y4.500 Z-2.5649 F3000
+G1 X14.880 Y4.500 Z-2.5702 F3000
+G1 X14.860 Y4.500 Z-2.5755 F3000
+G1 X14.840 Y4.500 Z-2.5809 F3000
+G1 X14.820 Y4.500 Z-2.5863 F3000
+G1 X14.800 Y4.500 Z-2.5917 F3000
+G1 X14.780 Y4.500 Z-2.5971 F3000
+G1 X14.760 Y4.500 Z-2.6025 F3000
+G1 X14.740 Y4.500 Z-2.6080 F3000
+G1 X14.720 Y4.500 Z-2.6135 F3000
+G1 X14.700 Y4.500 Z-2.6190 F3000
+G1 X14.680 Y4.500 Z-2.6246 F3000
+G1 X14.660 Y4.500 Z-2.6301 F3000
+G1 X14.640 Y4.500 Z-2.6357 F3000
+G1 X14.620 Y4.500 Z-2.6413 F3000
+G1 X14.600 Y4.500 Z-2.6469 F3000
+G1 X14.580 Y4.500 Z-2.6526 F3000
+G1 X14.560 Y4.500 Z-2.6583 F3000
+G1 X14.540 Y4.500 Z-2.6640 F3000
+G1 X14.520 Y4.500 Z-2.6697 F3000
+G1 X14.500 Y4.500 Z-2.6754 F3000
+G1 X14.480 Y4.500 Z-2.6812 F3000
+G1 X14.460 Y4.500 Z-2.6870 F3000
+G1 X14.440 Y4.500 Z-2.6928 F3000
+G1 X14.420 Y4.500 Z-2.6986 F3000
+G1 X14.400 Y4.500 Z-2.7045 F3000
+G1 X14.380 Y4.500 Z-2.7103 F3000
+G1 X14.360 Y4.500 Z-2.7162 F3000
+G1 X14.340 Y4.500 Z-2.7221 F3000
+G1 X14.320 Y4.500 Z-2.7281 F3000
+G1 X14.300 Y4.500 Z-2.7341 F3000
+G1 X14.280 Y4.500 Z-2.7401 F3000
+G1 X14.260 Y4.500 Z-2.7461 F3000
+G1 X14.240 Y4.500 Z-2.7521 F3000
+G1 X14.220 Y4.500 Z-2.7582 F3000
+G1 X14.200 Y4.500 Z-2.7642 F3000
+G1 X14.180 Y4.500 Z-2.7703 F3000
+G1 X14.160 Y4.500 Z-2.7765 F3000
+G1 X14.140 Y4.500 Z-2.7826 F3000
+G1 X14.120 Y4.500 Z-2.7888 F3000
+G1 X14.100 Y4.500 Z-2.7950 F3000
+G1 X14.080 Y4.500 Z-2.8012 F3000
+G1 X14.060 Y4.500 Z-2.8075 F3000
+G1 X14.040 Y4.500 Z-2.8137 F3000
+G1 X14.020 Y4.500 Z-2.8200 F3000
+G1 X14.000 Y4.500 Z-2.8263 F3000
+G1 X13.980 Y4.500 Z-2.8327 F3000
+G1 X13.960 Y4.500 Z-2.8390 F3000
+G1 X13.940 Y4.500 Z-2.8454 F3000
+G1 X13.920 Y4.500 Z-2.8518 F3000
+G1 X13.900 Y4.500 Z-2.8582 F3000
+G1 X13.880 Y4.500 Z-2.8647 F3000
+G1 X13.860 Y4.500 Z-2.8712 F3000
+G1 X13.840 Y4.500 Z-2.8777 F3000
+G1 X13.820 Y4.500 Z-2.8842 F3000
+G1 X13.800 Y4.500 Z-2.8907 F3000
+G1 X13.780 Y4.500 Z-2.8973 F3000
+G1 X13.760 Y4.500 Z-2.9039 F3000
+G1 X13.740 Y4.500 Z-2.9105 F3000
+G1 X13.720 Y4.500 Z-2.9172 F3000
+G1 X13.700 Y4.500 Z-2.9238 F3000
+G1 X13.680 Y4.500 Z-2.9305 F3000
+G1 X13.660 Y4.500 Z-2.9372 F3000
+G1 X13.640 Y4.500 Z-2.9440 F3000
+G1 X13.620 Y4.500 Z-2.9507 F3000
+G1 X13.600 Y4.500 Z-2.9575 F3000
+G1 X13.580 Y4.500 Z-2.9643 F3000
+G1 X13.560 Y4.500 Z-2.9711 F3000
+G1 X13.540 Y4.500 Z-2.9780 F3000
+G1 X13.520 Y4.500 Z-2.9849 F3000
+G1 X13.500 Y4.500 Z-2.9918 F3000
+G1 X13.480 Y4.500 Z-2.9987 F3000
+G1 X13.460 Y4.500 Z-3.0056 F3000
+G1 X13.440 Y4.500 Z-3.0126 F3000
+G1 X13.420 Y4.500 Z-3.0196 F3000
+G1 X13.400 Y4.500 Z-3.0266 F3000
+G1 X13.380 Y4.500 Z-3.0337 F3000
+G1 X13.360 Y4.500 Z-3.0407 F3000
+G1 X13.340 Y4.500 Z-3.0478 F3000
+G1 X13.320 Y4.500 Z-3.0549 F3000
+G1 X13.300 Y4.500 Z-3.0621 F3000
+G1 X13.280 Y4.500 Z-3.0692 F3000
+G1 X13.260 Y4.500 Z-3.0764 F3000
+G1 X13.240 Y4.500 Z-3.0836 F3000
+G1 X13.220 Y4.500 Z-3.0909 F3000
+G1 X13.200 Y4.500 Z-3.0981 F3000
+G1 X13.180 Y4.500 Z-3.1054 F3000
+G1 X13.160 Y4.500 Z-3.1127 F3000
+G1 X13.140 Y4.500 Z-3.1201 F3000
+G1 X13.120 Y4.500 Z-3.1274 F3000
+G1 X13.100 Y4.500 Z-3.1348 F3000
+G1 X13.080 Y4.500 Z-3.1422 F3000
+G1 X13.060 Y4.500 Z-3.1496 F3000
+G1 X13.040 Y4.500 Z-3.1571 F3000
+G1 X13.020 Y4.500 Z-3.1646 F3000
+G1 X13.000 Y4.500 Z-3.1721 F3000
+G1 X12.980 Y4.500 Z-3.1796 F3000
+G1 X12.960 Y4.500 Z-3.1871 F3000
+G1 X12.940 Y4.500 Z-3.1947 F3000
+G1 X12.920 Y4.500 Z-3.2023 F3000
+G1 X12.900 Y4.500 Z-3.2099 F3000
+G1 X12.880 Y4.500 Z-3.2176 F3000
+G1 X12.860 Y4.500 Z-3.2253 F3000
+G1 X12.840 Y4.500 Z-3.2330 F3000
+G1 X12.820 Y4.500 Z-3.2407 F3000
+G1 X12.800 Y4.500 Z-3.2485 F3000
+G1 X12.780 Y4.500 Z-3.2562 F3000
+G1 X12.760 Y4.500 Z-3.2640 F3000
+G1 X12.740 Y4.500 Z-3.2718 F3000
+G1 X12.720 Y4.500 Z-3.2797 F3000
+G1 X12.700 Y4.500 Z-3.2876 F3000
+G1 X12.680 Y4.500 Z-3.2955 F3000
+G1 X12.660 Y4.500 Z-3.3034 F3000
+G1 X12.640 Y4.500 Z-3.3113 F3000
+G1 X12.620 Y4.500 Z-3.3193 F3000
+G1 X12.600 Y4.500 Z-3.3273 F3000
+G1 X12.580 Y4.500 Z-3.3353 F3000
+G1 X12.560 Y4.500 Z-3.3434 F3000
+G1 X12.540 Y4.500 Z-3.3515 F3000
+G1 X12.520 Y4.500 Z-3.3596 F3000
+G1 X12.500 Y4.500 Z-3.3677 F3000
+G1 X12.480 Y4.500 Z-3.3758 F3000
+G1 X12.460 Y4.500 Z-3.3840 F3000
+G1 X12.440 Y4.500 Z-3.3922 F3000
+G1 X12.420 Y4.500 Z-3.4004 F3000
+G1 X12.400 Y4.500 Z-3.4087 F3000
+G1 X12.380 Y4.500 Z-3.4170 F3000
+G1 X12.360 Y4.500 Z-3.4253 F3000
+G1 X12.340 Y4.500 Z-3.4336 F3000
+G1 X12.320 Y4.500 Z-3.4420 F3000
+G1 X12.300 Y4.500 Z-3.4503 F3000
+G1 X12.280 Y4.500 Z-3.4587 F3000
+G1 X12.260 Y4.500 Z-3.4672 F3000
+G1 X12.240 Y4.500 Z-3.4756 F3000
+G1 X12.220 Y4.500 Z-3.4841 F3000
+G1 X12.200 Y4.500 Z-3.4926 F3000
+G1 X12.180 Y4.500 Z-3.5012 F3000
+G1 X12.160 Y4.500 Z-3.5097 F3000
+G1 X12.140 Y4.500 Z-3.5183 F3000
+G1 X12.120 Y4.500 Z-3.5269 F3000
+G1 X12.100 Y4.500 Z-3.5356 F3000
+G1 X12.080 Y4.500 Z-3.5442 F3000
+G1 X12.060 Y4.500 Z-3.5529 F3000
+G1 X12.040 Y4.500 Z-3.5616 F3000
+G1 X12.020 Y4.500 Z-3.5704 F3000
+G1 X12.000 Y4.500 Z-3.5791 F3000
+G1 X11.980 Y4.500 Z-3.5879 F3000
+G1 X11.960 Y4.500 Z-3.5967 F3000
+G1 X11.940 Y4.500 Z-3.6056 F3000
+G1 X11.920 Y4.500 Z-3.6145 F3000
+G1 X11.900 Y4.500 Z-3.6234 F3000
+G1 X11.880 Y4.500 Z-3.6323 F3000
+G1 X11.860 Y4.500 Z-3.6412 F3000
+G1 X11.840 Y4.500 Z-3.6502 F3000
+G1 X11.820 Y4.500 Z-3.6592 F3000
+G1 X11.800 Y4.500 Z-3.6683 F3000
+G1 X11.780 Y4.500 Z-3.6773 F3000
+G1 X11.760 Y4.500 Z-3.6864 F3000
+G1 X11.740 Y4.500 Z-3.6955 F3000
+G1 X11.720 Y4.500 Z-3.7047 F3000
+G1 X11.700 Y4.500 Z-3.7138 F3000
+G1 X11.680 Y4.500 Z-3.7230 F3000
+G1 X11.660 Y4.500 Z-3.7322 F3000
+G1 X11.640 Y4.500 Z-3.7415 F3000
+G1 X11.620 Y4.500 Z-3.7507 F3000
+G1 X11.600 Y4.500 Z-3.7600 F3000
+G1 X11.580 Y4.500 Z-3.7694 F3000
+G1 X11.560 Y4.500 Z-3.7787 F3000
+G1 X11.540 Y4.500 Z-3.7881 F3000
+G1 X11.520 Y4.500 Z-3.7975 F3000
+G1 X11.500 Y4.500 Z-3.8069 F3000
+G1 X11.480 Y4.500 Z-3.8164 F3000
+G1 X11.460 Y4.500 Z-3.8259 F3000
+G1 X11.440 Y4.500 Z-3.8354 F3000
+G1 X11.420 Y4.500 Z-3.8450 F3000
+G1 X11.400 Y4.500 Z-3.8545 F3000
+G1 X11.380 Y4.500 Z-3.8641 F3000
+G1 X11.360 Y4.500 Z-3.8738 F3000
+G1 X11.340 Y4.500 Z-3.8834 F3000
+G1 X11.320 Y4.500 Z-3.8931 F3000
+G1 X11.300 Y4.500 Z-3.9028 F3000
+G1 X11.280 Y4.500 Z-3.9125 F3000
+G1 X11.260 Y4.500 Z-3.9223 F3000
+G1 X11.240 Y4.500 Z-3.9321 F3000
+G1 X11.220 Y4.500 Z-3.9419 F3000
+G1 X11.200 Y4.500 Z-3.9518 F3000
+G1 X11.180 Y4.500 Z-3.9616 F3000
+G1 X11.160 Y4.500 Z-3.9715 F3000
+G1 X11.140 Y4.500 Z-3.9815 F3000
+G1 X11.120 Y4.500 Z-3.9914 F3000
+G1 X11.100 Y4.500 Z-4.0014 F3000
+G1 X11.080 Y4.500 Z-4.0114 F3000
+G1 X11.060 Y4.500 Z-4.0215 F3000
+G1 X11.040 Y4.500 Z-4.0315 F3000
+G1 X11.020 Y4.500 Z-4.0416 F3000
+G1 X11.000 Y4.500 Z-4.0518 F3000
+G1 X10.980 Y4.500 Z-4.0619 F3000
+G1 X10.960 Y4.500 Z-4.0721 F3000
+G1 X10.940 Y4.500 Z-4.0823 F3000
+G1 X10.920 Y4.500 Z-4.0926 F3000
+G1 X10.900 Y4.500 Z-4.1028 F3000
+G1 X10.880 Y4.500 Z-4.1131 F3000
+G1 X10.860 Y4.500 Z-4.1235 F3000
+G1 X10.840 Y4.500 Z-4.1338 F3000
+G1 X10.820 Y4.500 Z-4.1442 F3000
+G1 X10.800 Y4.500 Z-4.1546 F3000
+G1 X10.780 Y4.500 Z-4.1650 F3000
+G1 X10.760 Y4.500 Z-4.1755 F3000
+G1 X10.740 Y4.500 Z-4.1860 F3000
+G1 X10.720 Y4.500 Z-4.1965 F3000
+G1 X10.700 Y4.500 Z-4.2071 F3000
+G1 X10.680 Y4.500 Z-4.2177 F3000
+G1 X10.660 Y4.500 Z-4.2283 F3000
+G1 X10.640 Y4.500 Z-4.2390 F3000
+G1 X10.620 Y4.500 Z-4.2496 F3000
+G1 X10.600 Y4.500 Z-4.2603 F3000
+G1 X10.580 Y4.500 Z-4.2711 F3000
+G1 X10.560 Y4.500 Z-4.2818 F3000
+G1 X10.540 Y4.500 Z-4.2926 F3000
+G1 X10.520 Y4.500 Z-4.3034 F3000
+G1 X10.500 Y4.500 Z-4.3143 F3000
+G1 X10.480 Y4.500 Z-4.3252 F3000
+G1 X10.460 Y4.500 Z-4.3361 F3000
+G1 X10.440 Y4.500 Z-4.3470 F3000
+G1 X10.420 Y4.500 Z-4.3580 F3000
+G1 X10.400 Y4.500 Z-4.3690 F3000
+G1 X10.380 Y4.500 Z-4.3800 F3000
+G1 X10.360 Y4.500 Z-4.3911 F3000
+G1 X10.340 Y4.500 Z-4.4022 F3000
+G1 X10.320 Y4.500 Z-4.4133 F3000
+G1 X10.300 Y4.500 Z-4.4244 F3000
+G1 X10.280 Y4.500 Z-4.4356 F3000
+G1 X10.260 Y4.500 Z-4.4468 F3000
+G1 X10.240 Y4.500 Z-4.4581 F3000
+G1 X10.220 Y4.500 Z-4.4693 F3000
+G1 X10.200 Y4.500 Z-4.4806 F3000
+G1 X10.180 Y4.500 Z-4.4920 F3000
+G1 X10.160 Y4.500 Z-4.5033 F3000
+G1 X10.140 Y4.500 Z-4.5147 F3000
+G1 X10.120 Y4.500 Z-4.5262 F3000
+G1 X10.100 Y4.500 Z-4.5376 F3000
+G1 X10.080 Y4.500 Z-4.5491 F3000
+G1 X10.060 Y4.500 Z-4.5606 F3000
+G1 X10.040 Y4.500 Z-4.5722 F3000
+G1 X10.020 Y4.500 Z-4.5837 F3000
+G1 X10.000 Y4.500 Z-4.5953 F3000
+G1 X9.980 Y4.500 Z-4.6070 F3000
+G1 X9.960 Y4.500 Z-4.6187 F3000
+G1 X9.940 Y4.500 Z-4.6304 F3000
+G1 X9.920 Y4.500 Z-4.6421 F3000
+G1 X9.900 Y4.500 Z-4.6539 F3000
+G1 X9.880 Y4.500 Z-4.6657 F3000
+G1 X9.860 Y4.500 Z-4.6775 F3000
+G1 X9.840 Y4.500 Z-4.6893 F3000
+G1 X9.820 Y4.500 Z-4.7012 F3000
+G1 X9.800 Y4.500 Z-4.7132 F3000
+G1 X9.780 Y4.500 Z-4.7251 F3000
+G1 X9.760 Y4.500 Z-4.7371 F3000
+G1 X9.740 Y4.500 Z-4.7491 F3000
+G1 X9.720 Y4.500 Z-4.7612 F3000
+G1 X9.700 Y4.500 Z-4.7733 F3000
+G1 X9.680 Y4.500 Z-4.7854 F3000
+G1 X9.660 Y4.500 Z-4.7975 F3000
+G1 X9.640 Y4.500 Z-4.8097 F3000
+G1 X9.620 Y4.500 Z-4.8219 F3000
+G1 X9.600 Y4.500 Z-4.8342 F3000
+G1 X9.580 Y4.500 Z-4.8464 F3000
+G1 X9.560 Y4.500 Z-4.8587 F3000
+G1 X9.540 Y4.500 Z-4.8711 F3000
+G1 X9.520 Y4.500 Z-4.8835 F3000
+G1 X9.500 Y4.500 Z-4.8959 F3000
+G1 X9.480 Y4.500 Z-4.9083 F3000
+G1 X9.460 Y4.500 Z-4.9208 F3000
+G1 X9.440 Y4.500 Z-4.9333 F3000
+G1 X9.420 Y4.500 Z-4.9458 F3000
+G1 X9.400 Y4.500 Z-4.9584 F3000
+G1 X9.380 Y4.500 Z-4.9710 F3000
+G1 X9.360 Y4.500 Z-4.9836 F3000
+G1 X9.340 Y4.500 Z-4.9963 F3000
+G1 X9.320 Y4.500 Z-5.0090 F3000
+G1 X9.300 Y4.500 Z-5.0217 F3000
+G1 X9.280 Y4.500 Z-5.0345 F3000
+G1 X9.260 Y4.500 Z-5.0473 F3000
+G1 X9.240 Y4.500 Z-5.0602 F3000
+G1 X9.220 Y4.500 Z-5.0730 F3000
+G1 X9.200 Y4.500 Z-5.0859 F3000
+G1 X9.180 Y4.500 Z-5.0989 F3000
+G1 X9.160 Y4.500 Z-5.1118 F3000
+G1 X9.140 Y4.500 Z-5.1249 F3000
+G1 X9.120 Y4.500 Z-5.1379 F3000
+G1 X9.100 Y4.500 Z-5.1510 F3000
+G1 X9.080 Y4.500 Z-5.1641 F3000
+G1 X9.060 Y4.500 Z-5.1772 F3000
+G1 X9.040 Y4.500 Z-5.1904 F3000
+G1 X9.020 Y4.500 Z-5.2036 F3000
+G1 X9.000 Y4.500 Z-5.2169 F3000
+G1 X8.980 Y4.500 Z-5.2302 F3000
+G1 X8.960 Y4.500 Z-5.2435 F3000
+G1 X8.940 Y4.500 Z-5.2568 F3000
+G1 X8.920 Y4.500 Z-5.2702 F3000
+G1 X8.900 Y4.500 Z-5.2836 F3000
+G1 X8.880 Y4.500 Z-5.2971 F3000
+G1 X8.860 Y4.500 Z-5.3106 F3000
+G1 X8.840 Y4.500 Z-5.3241 F3000
+G1 X8.820 Y4.500 Z-5.3377 F3000
+G1 X8.800 Y4.500 Z-5.3513 F3000
+G1 X8.780 Y4.500 Z-5.3649 F3000
+G1 X8.760 Y4.500 Z-5.3786 F3000
+G1 X8.740 Y4.500 Z-5.3923 F3000
+G1 X8.720 Y4.500 Z-5.4060 F3000
+G1 X8.700 Y4.500 Z-5.4198 F3000
+G1 X8.680 Y4.500 Z-5.4336 F3000
+G1 X8.660 Y4.500 Z-5.4475 F3000
+G1 X8.640 Y4.500 Z-5.4614 F3000
+G1 X8.620 Y4.500 Z-5.4753 F3000
+G1 X8.600 Y4.500 Z-5.4893 F3000
+G1 X8.580 Y4.500 Z-5.5033 F3000
+G1 X8.560 Y4.500 Z-5.5173 F3000
+G1 X8.540 Y4.500 Z-5.5314 F3000
+G1 X8.520 Y4.500 Z-5.5455 F3000
+G1 X8.500 Y4.500 Z-5.5596 F3000
+G1 X8.480 Y4.500 Z-5.5738 F3000
+G1 X8.460 Y4.500 Z-5.5880 F3000
+G1 X8.440 Y4.500 Z-5.6023 F3000
+G1 X8.420 Y4.500 Z-5.6166 F3000
+G1 X8.400 Y4.500 Z-5.6309 F3000
+G1 X8.380 Y4.500 Z-5.6453 F3000
+G1 X8.360 Y4.500 Z-5.6597 F3000
+G1 X8.340 Y4.500 Z-5.6741 F3000
+G1 X8.320 Y4.500 Z-5.6886 F3000
+G1 X8.300 Y4.500 Z-5.7031 F3000
+G1 X8.280 Y4.500 Z-5.7177 F3000
+G1 X8.260 Y4.500 Z-5.7323 F3000
+G1 X8.240 Y4.500 Z-5.7469 F3000
+G1 X8.220 Y4.500 Z-5.7616 F3000
+G1 X8.200 Y4.500 Z-5.7763 F3000
+G1 X8.180 Y4.500 Z-5.7910 F3000
+G1 X8.160 Y4.500 Z-5.8058 F3000
+G1 X8.140 Y4.500 Z-5.8206 F3000
+G1 X8.120 Y4.500 Z-5.8355 F3000
+G1 X8.100 Y4.500 Z-5.8504 F3000
+G1 X8.080 Y4.500 Z-5.8653 F3000
+G1 X8.060 Y4.500 Z-5.8803 F3000
+G1 X8.040 Y4.500 Z-5.8953 F3000
+G1 X8.020 Y4.500 Z-5.9104 F3000
+G1 X8.000 Y4.500 Z-5.9255 F3000
+G1 X7.980 Y4.500 Z-5.9406 F3000
+G1 X7.960 Y4.500 Z-5.9558 F3000
+G1 X7.940 Y4.500 Z-5.9710 F3000
+G1 X7.920 Y4.500 Z-5.9863 F3000
+G1 X7.900 Y4.500 Z-6.0016 F3000
+G1 X7.880 Y4.500 Z-6.0169 F3000
+G1 X7.860 Y4.500 Z-6.0323 F3000
+G1 X7.840 Y4.500 Z-6.0477 F3000
+G1 X7.820 Y4.500 Z-6.0632 F3000
+G1 X7.800 Y4.500 Z-6.0787 F3000
+G1 X7.780 Y4.500 Z-6.0942 F3000
+G1 X7.760 Y4.500 Z-6.1098 F3000
+G1 X7.740 Y4.500 Z-6.1254 F3000
+G1 X7.720 Y4.500 Z-6.1411 F3000
+G1 X7.700 Y4.500 Z-6.1568 F3000
+G1 X7.680 Y4.500 Z-6.1725 F3000
+G1 X7.660 Y4.500 Z-6.1883 F3000
+G1 X7.640 Y4.500 Z-6.2042 F3000
+G1 X7.620 Y4.500 Z-6.2200 F3000
+G1 X7.600 Y4.500 Z-6.2359 F3000
+G1 X7.580 Y4.500 Z-6.2519 F3000
+G1 X7.560 Y4.500 Z-6.2679 F3000
+G1 X7.540 Y4.500 Z-6.2839 F3000
+G1 X7.520 Y4.500 Z-6.3000 F3000
+G1 X7.500 Y4.500 Z-6.3161 F3000
+G1 X7.480 Y4.500 Z-6.3323 F3000
+G1 X7.460 Y4.500 Z-6.3485 F3000
+G1 X7.440 Y4.500 Z-6.3648 F3000
+G1 X7.420 Y4.500 Z-6.3811 F3000
+G1 X7.400 Y4.500 Z-6.3974 F3000
+G1 X7.380 Y4.500 Z-6.4138 F3000
+G1 X7.360 Y4.500 Z-6.4302 F3000
+G1 X7.340 Y4.500 Z-6.4467 F3000
+G1 X7.320 Y4.500 Z-6.4632 F3000
+G1 X7.300 Y4.500 Z-6.4798 F3000
+G1 X7.280 Y4.500 Z-6.4964 F3000
+G1 X7.260 Y4.500 Z-6.5130 F3000
+G1 X7.240 Y4.500 Z-6.5297 F3000
+G1 X7.220 Y4.500 Z-6.5464 F3000
+G1 X7.200 Y4.500 Z-6.5632 F3000
+G1 X7.180 Y4.500 Z-6.5800 F3000
+G1 X7.160 Y4.500 Z-6.5969 F3000
+G1 X7.140 Y4.500 Z-6.6138 F3000
+G1 X7.120 Y4.500 Z-6.6308 F3000
+G1 X7.100 Y4.500 Z-6.6478 F3000
+G1 X7.080 Y4.500 Z-6.6648 F3000
+G1 X7.060 Y4.500 Z-6.6819 F3000
+G1 X7.040 Y4.500 Z-6.6991 F3000
+G1 X7.020 Y4.500 Z-6.7162 F3000
+G1 X7.000 Y4.500 Z-6.7335 F3000
+G1 X6.980 Y4.500 Z-6.7508 F3000
+G1 X6.960 Y4.500 Z-6.7681 F3000
+G1 X6.940 Y4.500 Z-6.7855 F3000
+G1 X6.920 Y4.500 Z-6.8029 F3000
+G1 X6.900 Y4.500 Z-6.8203 F3000
+G1 X6.880 Y4.500 Z-6.8379 F3000
+G1 X6.860 Y4.500 Z-6.8554 F3000
+G1 X6.840 Y4.500 Z-6.8730 F3000
+G1 X6.820 Y4.500 Z-6.8907 F3000
+G1 X6.800 Y4.500 Z-6.9084 F3000
+G1 X6.780 Y4.500 Z-6.9261 F3000
+G1 X6.760 Y4.500 Z-6.9439 F3000
+G1 X6.740 Y4.500 Z-6.9618 F3000
+G1 X6.720 Y4.500 Z-6.9797 F3000
+G1 X6.700 Y4.500 Z-6.9976 F3000
+G1 X6.680 Y4.500 Z-7.0156 F3000
+G1 X6.660 Y4.500 Z-7.0337 F3000
+G1 X6.640 Y4.500 Z-7.0518 F3000
+G1 X6.620 Y4.500 Z-7.0699 F3000
+G1 X6.600 Y4.500 Z-7.0881 F3000
+G1 X6.580 Y4.500 Z-7.1063 F3000
+G1 X6.560 Y4.500 Z-7.1246 F3000
+G1 X6.540 Y4.500 Z-7.1430 F3000
+G1 X6.520 Y4.500 Z-7.1614 F3000
+G1 X6.500 Y4.500 Z-7.1798 F3000
+G1 X6.480 Y4.500 Z-7.1983 F3000
+G1 X6.460 Y4.500 Z-7.2168 F3000
+G1 X6.440 Y4.500 Z-7.2354 F3000
+G1 X6.420 Y4.500 Z-7.2541 F3000
+G1 X6.400 Y4.500 Z-7.2728 F3000
+G1 X6.380 Y4.500 Z-7.2915 F3000
+G1 X6.360 Y4.500 Z-7.3103 F3000
+G1 X6.340 Y4.500 Z-7.3292 F3000
+G1 X6.320 Y4.500 Z-7.3481 F3000
+G1 X6.300 Y4.500 Z-7.3671 F3000
+G1 X6.280 Y4.500 Z-7.3861 F3000
+G1 X6.260 Y4.500 Z-7.4051 F3000
+G1 X6.240 Y4.500 Z-7.4242 F3000
+G1 X6.220 Y4.500 Z-7.4434 F3000
+G1 X6.200 Y4.500 Z-7.4626 F3000
+G1 X6.180 Y4.500 Z-7.4819 F3000
+G1 X6.160 Y4.500 Z-7.5012 F3000
+G1 X6.140 Y4.500 Z-7.5206 F3000
+G1 X6.120 Y4.500 Z-7.5401 F3000
+G1 X6.100 Y4.500 Z-7.5596 F3000
+G1 X6.080 Y4.500 Z-7.5791 F3000
+G1 X6.060 Y4.500 Z-7.5987 F3000
+G1 X6.040 Y4.500 Z-7.6184 F3000
+G1 X6.020 Y4.500 Z-7.6381 F3000
+G1 X6.000 Y4.500 Z-7.6579 F3000
+G1 X5.980 Y4.500 Z-7.6777 F3000
+G1 X5.960 Y4.500 Z-7.6976 F3000
+G1 X5.940 Y4.500 Z-7.7175 F3000
+G1 X5.920 Y4.500 Z-7.7375 F3000
+G1 X5.900 Y4.500 Z-7.7576 F3000
+G1 X5.880 Y4.500 Z-7.7777 F3000
+G1 X5.860 Y4.500 Z-7.7978 F3000
+G1 X5.840 Y4.500 Z-7.8181 F3000
+G1 X5.820 Y4.500 Z-7.8384 F3000
+G1 X5.800 Y4.500 Z-7.8587 F3000
+G1 X5.780 Y4.500 Z-7.8791 F3000
+G1 X5.760 Y4.500 Z-7.8996 F3000
+G1 X5.740 Y4.500 Z-7.9201 F3000
+G1 X5.720 Y4.500 Z-7.9406 F3000
+G1 X5.700 Y4.500 Z-7.9613 F3000
+G1 X5.680 Y4.500 Z-7.9820 F3000
+G1 X5.660 Y4.500 Z-8.0027 F3000
+G1 X5.640 Y4.500 Z-8.0236 F3000
+G1 X5.620 Y4.500 Z-8.0444 F3000
+G1 X5.600 Y4.500 Z-8.0654 F3000
+G1 X5.580 Y4.500 Z-8.0864 F3000
+G1 X5.560 Y4.500 Z-8.1074 F3000
+G1 X5.540 Y4.500 Z-8.1286 F3000
+G1 X5.520 Y4.500 Z-8.1497 F3000
+G1 X5.500 Y4.500 Z-8.1710 F3000
+G1 X5.480 Y4.500 Z-8.1923 F3000
+G1 X5.460 Y4.500 Z-8.2137 F3000
+G1 X5.440 Y4.500 Z-8.2351 F3000
+G1 X5.420 Y4.500 Z-8.2566 F3000
+G1 X5.400 Y4.500 Z-8.2782 F3000
+G1 X5.380 Y4.500 Z-8.2998 F3000
+G1 X5.360 Y4.500 Z-8.3215 F3000
+G1 X5.340 Y4.500 Z-8.3432 F3000
+G1 X5.320 Y4.500 Z-8.3651 F3000
+G1 X5.300 Y4.500 Z-8.3869 F3000
+G1 X5.280 Y4.500 Z-8.4089 F3000
+G1 X5.260 Y4.500 Z-8.4309 F3000
+G1 X5.240 Y4.500 Z-8.4530 F3000
+G1 X5.220 Y4.500 Z-8.4752 F3000
+G1 X5.200 Y4.500 Z-8.4974 F3000
+G1 X5.180 Y4.500 Z-8.5197 F3000
+G1 X5.160 Y4.500 Z-8.5420 F3000
+G1 X5.140 Y4.500 Z-8.5644 F3000
+G1 X5.120 Y4.500 Z-8.5869 F3000
+G1 X5.100 Y4.500 Z-8.6095 F3000
+G1 X5.080 Y4.500 Z-8.6321 F3000
+G1 X5.060 Y4.500 Z-8.6548 F3000
+G1 X5.040 Y4.500 Z-8.6776 F3000
+G1 X5.020 Y4.500 Z-8.7004 F3000
+G1 X5.000 Y4.500 Z-8.7233 F3000
+G1 X4.980 Y4.500 Z-8.7463 F3000
+G1 X4.960 Y4.500 Z-8.7693 F3000
+G1 X4.940 Y4.500 Z-8.7924 F3000
+G1 X4.920 Y4.500 Z-8.8156 F3000
+G1 X4.900 Y4.500 Z-8.8389 F3000
+G1 X4.880 Y4.500 Z-8.8622 F3000
+G1 X4.860 Y4.500 Z-8.8857 F3000
+G1 X4.840 Y4.500 Z-8.9091 F3000
+G1 X4.820 Y4.500 Z-8.9327 F3000
+G1 X4.800 Y4.500 Z-8.9563 F3000
+G1 X4.780 Y4.500 Z-8.9800 F3000
+G1 X4.760 Y4.500 Z-9.0038 F3000
+G1 X4.740 Y4.500 Z-9.0277 F3000
+G1 X4.720 Y4.500 Z-9.0516 F3000
+G1 X4.700 Y4.500 Z-9.0756 F3000
+G1 X4.680 Y4.500 Z-9.0997 F3000
+G1 X4.660 Y4.500 Z-9.1239 F3000
+G1 X4.640 Y4.500 Z-9.1481 F3000
+G1 X4.620 Y4.500 Z-9.1724 F3000
+G1 X4.600 Y4.500 Z-9.1968 F3000
+G1 X4.580 Y4.500 Z-9.2213 F3000
+G1 X4.560 Y4.500 Z-9.2459 F3000
+G1 X4.540 Y4.500 Z-9.2705 F3000
+G1 X4.520 Y4.500 Z-9.2952 F3000
+G1 X4.500 Y4.500 Z-9.3200 F3000
+G1 X4.480 Y4.500 Z-9.3449 F3000
+G1 X4.460 Y4.500 Z-9.3699 F3000
+G1 X4.440 Y4.500 Z-9.3949 F3000
+G1 X4.420 Y4.500 Z-9.4200 F3000
+G1 X4.400 Y4.500 Z-9.4452 F3000
+G1 X4.380 Y4.500 Z-9.4705 F3000
+G1 X4.360 Y4.500 Z-9.4959 F3000
+G1 X4.340 Y4.500 Z-9.5214 F3000
+G1 X4.320 Y4.500 Z-9.5469 F3000
+G1 X4.300 Y4.500 Z-9.5726 F3000
+G1 X4.280 Y4.500 Z-9.5983 F3000
+G1 X4.260 Y4.500 Z-9.6241 F3000
+G1 X4.240 Y4.500 Z-9.6500 F3000
+G1 X4.220 Y4.500 Z-9.6760 F3000
+G1 X4.200 Y4.500 Z-9.7021 F3000
+G1 X4.180 Y4.500 Z-9.7282 F3000
+G1 X4.160 Y4.500 Z-9.7545 F3000
+G1 X4.140 Y4.500 Z-9.7808 F3000
+G1 X4.120 Y4.500 Z-9.8073 F3000
+G1 X4.100 Y4.500 Z-9.8338 F3000
+G1 X4.080 Y4.500 Z-9.8604 F3000
+G1 X4.060 Y4.500 Z-9.8871 F3000
+G1 X4.040 Y4.500 Z-9.9139 F3000
+G1 X4.020 Y4.500 Z-9.9408 F3000
+G1 X4.000 Y4.500 Z-9.9678 F3000
+G1 X3.980 Y4.500 Z-9.9949 F3000
+G1 X3.960 Y4.500 Z-10.0221 F3000
+G1 X3.940 Y4.500 Z-10.0494 F3000
+G1 X3.920 Y4.500 Z-10.0768 F3000
+G1 X3.900 Y4.500 Z-10.1043 F3000
+G1 X3.880 Y4.500 Z-10.1319 F3000
+G1 X3.860 Y4.500 Z-10.1595 F3000
+G1 X3.840 Y4.500 Z-10.1873 F3000
+G1 X3.820 Y4.500 Z-10.2152 F3000
+G1 X3.800 Y4.500 Z-10.2432 F3000
+G1 X3.780 Y4.500 Z-10.2713 F3000
+G1 X3.760 Y4.500 Z-10.2995 F3000
+G1 X3.740 Y4.500 Z-10.3278 F3000
+G1 X3.720 Y4.500 Z-10.3562 F3000
+G1 X3.700 Y4.500 Z-10.3847 F3000
+G1 X3.680 Y4.500 Z-10.4133 F3000
+G1 X3.660 Y4.500 Z-10.4420 F3000
+G1 X3.640 Y4.500 Z-10.4708 F3000
+G1 X3.620 Y4.500 Z-10.4998 F3000
+G1 X3.600 Y4.500 Z-10.5288 F3000
+G1 X3.580 Y4.500 Z-10.5580 F3000
+G1 X3.560 Y4.500 Z-10.5872 F3000
+G1 X3.540 Y4.500 Z-10.6166 F3000
+G1 X3.520 Y4.500 Z-10.6461 F3000
+G1 X3.500 Y4.500 Z-10.6757 F3000
+G1 X3.480 Y4.500 Z-10.7054 F3000
+G1 X3.460 Y4.500 Z-10.7353 F3000
+G1 X3.440 Y4.500 Z-10.7652 F3000
+G1 X3.420 Y4.500 Z-10.7953 F3000
+G1 X3.400 Y4.500 Z-10.8255 F3000
+G1 X3.380 Y4.500 Z-10.8558 F3000
+G1 X3.360 Y4.500 Z-10.8862 F3000
+G1 X3.340 Y4.500 Z-10.9168 F3000
+G1 X3.320 Y4.500 Z-10.9475 F3000
+G1 X3.300 Y4.500 Z-10.9783 F3000
+G1 X3.280 Y4.500 Z-11.0092 F3000
+G1 X3.260 Y4.500 Z-11.0402 F3000
+G1 X3.240 Y4.500 Z-11.0714 F3000
+G1 X3.220 Y4.500 Z-11.1027 F3000
+G1 X3.200 Y4.500 Z-11.1342 F3000
+G1 X3.180 Y4.500 Z-11.1657 F3000
+G1 X3.160 Y4.500 Z-11.1974 F3000
+G1 X3.140 Y4.500 Z-11.2293 F3000
+G1 X3.120 Y4.500 Z-11.2612 F3000
+G1 X3.100 Y4.500 Z-11.2933 F3000
+G1 X3.080 Y4.500 Z-11.3256 F3000
+G1 X3.060 Y4.500 Z-11.3580 F3000
+G1 X3.040 Y4.500 Z-11.3905 F3000
+G1 X3.020 Y4.500 Z-11.4231 F3000
+G1 X3.000 Y4.500 Z-11.4559 F3000
+G1 X2.980 Y4.500 Z-11.4889 F3000
+G1 X2.960 Y4.500 Z-11.5219 F3000
+G1 X2.940 Y4.500 Z-11.5552 F3000
+G1 X2.920 Y4.500 Z-11.5886 F3000
+G1 X2.900 Y4.500 Z-11.6221 F3000
+G1 X2.880 Y4.500 Z-11.6558 F3000
+G1 X2.860 Y4.500 Z-11.6896 F3000
+G1 X2.840 Y4.500 Z-11.7236 F3000
+G1 X2.820 Y4.500 Z-11.7577 F3000
+G1 X2.800 Y4.500 Z-11.7920 F3000
+G1 X2.780 Y4.500 Z-11.8265 F3000
+G1 X2.760 Y4.500 Z-11.8611 F3000
+G1 X2.740 Y4.500 Z-11.8958 F3000
+G1 X2.720 Y4.500 Z-11.9308 F3000
+G1 X2.700 Y4.500 Z-11.9659 F3000
+G1 X2.680 Y4.500 Z-12.0011 F3000
+G1 X2.660 Y4.500 Z-12.0366 F3000
+G1 X2.640 Y4.500 Z-12.0722 F3000
+G1 X2.620 Y4.500 Z-12.1080 F3000
+G1 X2.600 Y4.500 Z-12.1439 F3000
+G1 X2.580 Y4.500 Z-12.1800 F3000
+G1 X2.560 Y4.500 Z-12.2163 F3000
+G1 X2.540 Y4.500 Z-12.2528 F3000
+G1 X2.520 Y4.500 Z-12.2895 F3000
+G1 X2.500 Y4.500 Z-12.3264 F3000
+G1 X2.480 Y4.500 Z-12.3634 F3000
+G1 X2.460 Y4.500 Z-12.4006 F3000
+G1 X2.440 Y4.500 Z-12.4380 F3000
+G1 X2.420 Y4.500 Z-12.4756 F3000
+G1 X2.400 Y4.500 Z-12.5135 F3000
+G1 X2.380 Y4.500 Z-12.5515 F3000
+G1 X2.360 Y4.500 Z-12.5897 F3000
+G1 X2.340 Y4.500 Z-12.6281 F3000
+G1 X2.320 Y4.500 Z-12.6667 F3000
+G1 X2.300 Y4.500 Z-12.7055 F3000
+G1 X2.280 Y4.500 Z-12.7445 F3000
+G1 X2.260 Y4.500 Z-12.7838 F3000
+G1 X2.240 Y4.500 Z-12.8232 F3000
+G1 X2.220 Y4.500 Z-12.8629 F3000
+G1 X2.200 Y4.500 Z-12.9028 F3000
+G1 X2.180 Y4.500 Z-12.9429 F3000
+G1 X2.160 Y4.500 Z-12.9833 F3000
+G1 X2.140 Y4.500 Z-13.0239 F3000
+G1 X2.120 Y4.500 Z-13.0647 F3000
+G1 X2.100 Y4.500 Z-13.1057 F3000
+G1 X2.080 Y4.500 Z-13.1470 F3000
+G1 X2.060 Y4.500 Z-13.1886 F3000
+G1 X2.040 Y4.500 Z-13.2304 F3000
+G1 X2.020 Y4.500 Z-13.2724 F3000
+G1 X2.000 Y4.500 Z-13.3147 F3000
+G1 X1.980 Y4.500 Z-13.3573 F3000
+G1 X1.960 Y4.500 Z-13.4001 F3000
+G1 X1.940 Y4.500 Z-13.4432 F3000
+G1 X1.920 Y4.500 Z-13.4865 F3000
+G1 X1.900 Y4.500 Z-13.5302 F3000
+G1 X1.880 Y4.500 Z-13.5741 F3000
+G1 X1.860 Y4.500 Z-13.6183 F3000
+G1 X1.840 Y4.500 Z-13.6628 F3000
+G1 X1.820 Y4.500 Z-13.7076 F3000
+G1 X1.800 Y4.500 Z-13.7526 F3000
+G1 X1.780 Y4.500 Z-13.7980 F3000
+G1 X1.760 Y4.500 Z-13.8437 F3000
+G1 X1.740 Y4.500 Z-13.8897 F3000
+G1 X1.720 Y4.500 Z-13.9361 F3000
+G1 X1.700 Y4.500 Z-13.9827 F3000
+G1 X1.680 Y4.500 Z-14.0297 F3000
+G1 X1.660 Y4.500 Z-14.0770 F3000
+G1 X1.640 Y4.500 Z-14.1247 F3000
+G1 X1.620 Y4.500 Z-14.1727 F3000
+G1 X1.600 Y4.500 Z-14.2211 F3000
+G1 X1.580 Y4.500 Z-14.2698 F3000
+G1 X1.560 Y4.500 Z-14.3189 F3000
+G1 X1.540 Y4.500 Z-14.3684 F3000
+G1 X1.520 Y4.500 Z-14.4183 F3000
+G1 X1.500 Y4.500 Z-14.4686 F3000
+G1 X1.480 Y4.500 Z-14.5192 F3000
+G1 X1.460 Y4.500 Z-14.5703 F3000
+G1 X1.440 Y4.500 Z-14.6218 F3000
+G1 X1.420 Y4.500 Z-14.6737 F3000
+G1 X1.400 Y4.500 Z-14.7261 F3000
+G1 X1.380 Y4.500 Z-14.7789 F3000
+G1 X1.360 Y4.500 Z-14.8322 F3000
+G1 X1.340 Y4.500 Z-14.8859 F3000
+G1 X1.320 Y4.500 Z-14.9401 F3000
+G1 X1.300 Y4.500 Z-14.9949 F3000
+G1 X1.280 Y4.500 Z-15.0501 F3000
+G1 X1.260 Y4.500 Z-15.1058 F3000
+G1 X1.240 Y4.500 Z-15.1620 F3000
+G1 X1.220 Y4.500 Z-15.2188 F3000
+G1 X1.200 Y4.500 Z-15.2762 F3000
+G1 X1.180 Y4.500 Z-15.3341 F3000
+G1 X1.160 Y4.500 Z-15.3926 F3000
+G1 X1.140 Y4.500 Z-15.4517 F3000
+G1 X1.120 Y4.500 Z-15.5115 F3000
+G1 X1.100 Y4.500 Z-15.5718 F3000
+G1 X1.080 Y4.500 Z-15.6329 F3000
+G1 X1.060 Y4.500 Z-15.6946 F3000
+G1 X1.040 Y4.500 Z-15.7570 F3000
+G1 X1.020 Y4.500 Z-15.8201 F3000
+G1 X1.000 Y4.500 Z-15.8839 F3000
+G1 X0.980 Y4.500 Z-15.9485 F3000
+G1 X0.960 Y4.500 Z-16.0139 F3000
+G1 X0.940 Y4.500 Z-16.0802 F3000
+G1 X0.920 Y4.500 Z-16.1472 F3000
+G1 X0.900 Y4.500 Z-16.2152 F3000
+G1 X0.880 Y4.500 Z-16.2841 F3000
+G1 X0.860 Y4.500 Z-16.3539 F3000
+G1 X0.840 Y4.500 Z-16.4246 F3000
+G1 X0.820 Y4.500 Z-16.4965 F3000
+G1 X0.800 Y4.500 Z-16.5693 F3000
+G1 X0.780 Y4.500 Z-16.6433 F3000
+G1 X0.760 Y4.500 Z-16.7184 F3000
+G1 X0.740 Y4.500 Z-16.7948 F3000
+G1 X0.720 Y4.500 Z-16.8724 F3000
+G1 X0.700 Y4.500 Z-16.9513 F3000
+G1 X0.680 Y4.500 Z-17.0316 F3000
+G1 X0.660 Y4.500 Z-17.1134 F3000
+G1 X0.640 Y4.500 Z-17.1967 F3000
+G1 X0.620 Y4.500 Z-17.2816 F3000
+G1 X0.600 Y4.500 Z-17.3683 F3000
+G1 X0.580 Y4.500 Z-17.4568 F3000
+G1 X0.560 Y4.500 Z-17.5472 F3000
+G1 X0.540 Y4.500 Z-17.6397 F3000
+G1 X0.520 Y4.500 Z-17.7343 F3000
+G1 X0.500 Y4.500 Z-17.8314 F3000
+G1 X0.480 Y4.500 Z-17.9309 F3000
+G1 X0.460 Y4.500 Z-18.0333 F3000
+G1 X0.440 Y4.500 Z-18.1385 F3000
+G1 X0.420 Y4.500 Z-18.2470 F3000
+G1 X0.400 Y4.500 Z-18.3591 F3000
+G1 X0.380 Y4.500 Z-18.4750 F3000
+G1 X0.360 Y4.500 Z-18.5953 F3000
+G1 X0.340 Y4.500 Z-18.7203 F3000
+G1 X0.320 Y4.500 Z-18.8508 F3000
+G1 X0.300 Y4.500 Z-18.9875 F3000
+G1 X0.280 Y4.500 Z-19.1314 F3000
+G1 X0.260 Y4.500 Z-19.2836 F3000
+G1 X0.240 Y4.500 Z-19.4458 F3000
+G1 X0.220 Y4.500 Z-19.6202 F3000
+G1 X0.200 Y4.500 Z-19.8100 F3000
+G1 X0.180 Y4.500 Z-20.0202 F3000
+G1 X0.160 Y4.500 Z-20.2591 F3000
+G1 X0.140 Y4.500 Z-20.5429 F3000
+G1 X0.120 Y4.500 Z-20.9137 F3000
+G1 X0.100 Y4.500 Z-21.8000 F3000
+G1 X0.080 Y4.500 Z-21.8000 F3000
+G1 X0.060 Y4.500 Z-21.8000 F3000
+G1 X0.040 Y4.500 Z-21.8000 F3000
+G1 X0.020 Y4.500 Z-21.8000 F3000
+G1 X0.000 Y4.500 Z-21.8000 F3000
@@ -0,0 +1,19 @@
+G21
+G90
+G0 X10 Y10 Z-20
+; Two holes retracting to R, then one retracting to the initial level Z-20
+G99 G81 X20 Y10 Z-30 R-22 F300
+X30
+G98 X40
+; Pecks, still retracting to the initial level
+G83 X50 Y10 Z-35 R-22 Q4
+G73 X60 Z-35 Q3
+G82 X70 Z-30 P500
+G80
+; R and Z relative to the initial level Z-10
+G0 Z-10
+G91 G99 G81 X10 Z-8 R-4 F300
+X10
+G98 X10
+G80
+G90 G0 Z0
@@ -0,0 +1,2 @@
+M211 S0
+G64 P0
@@ -0,0 +1,5 @@
+G21
+G90
+G0 X300 Y300 A100
+; The linear seek is the longer one, so A seeks at most one turn, slower than its homing rate
+G28.2 X Y A
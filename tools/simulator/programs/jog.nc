@@ -0,0 +1,8 @@
+G21
+G90
+M2002 X200 F6000
+; Cancel the 100mm/s jog half a second in, then back off from where it stopped
+!500 M410 J
+M400
+G91
+G1 X-10 F3000
@@ -0,0 +1,16 @@
+G21
+G90
+M2002 X200 F6000
+; Cancel the jog while the coalescer still holds back the moves behind it. They
+; then run from where it stopped, up to X150 and back down to X100.
+!0.15 M410 J
+G1 X190 F3000
+G1 X180 F3000
+G1 X170 F3000
+G1 X160 F3000
+G1 X150 F3000
+G1 X140 F3000
+G1 X130 F3000
+G1 X120 F3000
+G1 X110 F3000
+G1 X100 F3000
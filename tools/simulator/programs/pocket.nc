@@ -0,0 +1,55 @@
+G21
+G90
+G0 X0 Y0 Z5
+G0 X100 Y100
+G1 Z-1 F1000
+G1 X102 F3000
+G3 X102 Y100 I-2 J0
+G1 X104
+G3 X104 Y100 I-4 J0
+G1 X106
+G3 X106 Y100 I-6 J0
+G1 X108
+G3 X108 Y100 I-8 J0
+G1 X110
+G3 X110 Y100 I-10 J0
+G1 X115
+G3 X115 Y100 I-15 J0
+G1 X120
+G3 X120 Y100 I-20 J0
+G1 X125
+G3 X125 Y100 I-25 J0
+G1 X130
+G3 X130 Y100 I-30 J0
+G1 X135
+G3 X135 Y100 I-35 J0
+G1 X140
+G3 X140 Y100 I-40 J0
+G1 X145
+G3 X145 Y100 I-45 J0
+G1 X150
+G3 X150 Y100 I-50 J0
+G0 Z5
+G0 X20 Y20
+G1 Z-1 F1000
+G1 X70 F3000
+G2 X80 Y10 I0 J-10
+G1 Y-20
+G2 X70 Y-30 I-10 J0
+G1 X20
+G2 X10 Y-20 I0 J10
+G1 Y10
+G2 X20 Y20 I10 J0
+G1 X65
+G2 X75 Y10 I0 J-10
+G1 Y-20
+G2 X70 Y-25 I-5 J0
+G1 X25
+G2 X15 Y-15 I0 J10
+G1 Y10
+G2 X25 Y20 I10 J0
+G0 Z5
+G0 X0 Y0
+G1 Z-1 F1000
+G2 X600 Y600 I600 J0 F6000
+G0 Z5
@@ -0,0 +1,169 @@
+G21
+G90
+G0 X10 Y10 Z-1
+G1 Z-2 F1000
+G1 X14.330 Y12.500 F4000
+G1 X18.660 Y15.000 F4000
+G1 X22.990 Y12.500 F4000
+G1 X27.321 Y15.000 F4000
+G1 X31.651 Y12.500 F4000
+G1 X35.981 Y15.000 F4000
+G1 X40.311 Y12.500 F4000
+G1 X44.641 Y15.000 F4000
+G1 X48.971 Y12.500 F4000
+G1 X53.301 Y15.000 F4000
+G1 X57.631 Y12.500 F4000
+G1 X61.962 Y15.000 F4000
+G1 X66.292 Y12.500 F4000
+G1 X70.622 Y15.000 F4000
+G1 X74.952 Y12.500 F4000
+G1 X79.282 Y15.000 F4000
+G1 X83.612 Y12.500 F4000
+G1 X87.942 Y15.000 F4000
+G1 X92.272 Y12.500 F4000
+G1 X96.603 Y15.000 F4000
+G1 X100.933 Y12.500 F4000
+G1 X105.263 Y15.000 F4000
+G1 X109.593 Y12.500 F4000
+G1 X113.923 Y15.000 F4000
+G1 X118.253 Y12.500 F4000
+G1 X122.583 Y15.000 F4000
+G1 X126.913 Y12.500 F4000
+G1 X131.244 Y15.000 F4000
+G1 X135.574 Y12.500 F4000
+G1 X139.904 Y15.000 F4000
+G1 X144.234 Y12.500 F4000
+G1 X148.564 Y15.000 F4000
+G1 X152.894 Y12.500 F4000
+G1 X157.224 Y15.000 F4000
+G1 X161.554 Y12.500 F4000
+G1 X165.885 Y15.000 F4000
+G1 X170.215 Y12.500 F4000
+G1 X174.545 Y15.000 F4000
+G1 X178.875 Y12.500 F4000
+G1 X183.205 Y15.000 F4000
+G1 X183.205 Y20.000 F4000
+G1 X186.678 Y20.304 F4000
+G1 X190.045 Y21.206 F4000
+G1 X193.205 Y22.679 F4000
+G1 X196.061 Y24.679 F4000
+G1 X198.526 Y27.144 F4000
+G1 X200.526 Y30.000 F4000
+G1 X201.999 Y33.160 F4000
+G1 X202.901 Y36.527 F4000
+G1 X203.205 Y40.000 F4000
+G1 X202.901 Y43.473 F4000
+G1 X201.999 Y46.840 F4000
+G1 X200.526 Y50.000 F4000
+G1 X198.526 Y52.856 F4000
+G1 X196.061 Y55.321 F4000
+G1 X193.205 Y57.321 F4000
+G1 X190.045 Y58.794 F4000
+G1 X186.678 Y59.696 F4000
+G1 X183.205 Y60.000 F4000
+G1 X179.732 Y59.696 F4000
+G1 X176.365 Y58.794 F4000
+G1 X173.205 Y57.321 F4000
+G1 X170.349 Y55.321 F4000
+G1 X167.884 Y52.856 F4000
+G1 X165.885 Y50.000 F4000
+G1 X164.411 Y46.840 F4000
+G1 X163.509 Y43.473 F4000
+G1 X163.205 Y40.000 F4000
+G1 X163.509 Y36.527 F4000
+G1 X164.411 Y33.160 F4000
+G1 X165.885 Y30.000 F4000
+G1 X167.884 Y27.144 F4000
+G1 X170.349 Y24.679 F4000
+G1 X173.205 Y22.679 F4000
+G1 X176.365 Y21.206 F4000
+G1 X179.732 Y20.304 F4000
+G1 X183.205 Y20.000 F4000
+G1 X186.678 Y20.304 F4000
+G1 X190.045 Y21.206 F4000
+G1 X193.205 Y22.679 F4000
+G1 X196.061 Y24.679 F4000
+G1 X198.526 Y27.144 F4000
+G1 X200.526 Y30.000 F4000
+G1 X201.999 Y33.160 F4000
+G1 X202.901 Y36.527 F4000
+G1 X203.205 Y40.000 F4000
+G1 X202.901 Y43.473 F4000
+G1 X201.999 Y46.840 F4000
+G1 X200.526 Y50.000 F4000
+G1 X198.526 Y52.856 F4000
+G1 X196.061 Y55.321 F4000
+G1 X193.205 Y57.321 F4000
+G1 X190.045 Y58.794 F4000
+G1 X186.678 Y59.696 F4000
+G1 X183.205 Y60.000 F4000
+G1 X179.732 Y59.696 F4000
+G1 X176.365 Y58.794 F4000
+G1 X173.205 Y57.321 F4000
+G1 X170.349 Y55.321 F4000
+G1 X167.884 Y52.856 F4000
+G1 X165.885 Y50.000 F4000
+G1 X164.411 Y46.840 F4000
+G1 X163.509 Y43.473 F4000
+G1 X163.205 Y40.000 F4000
+G1 X163.509 Y36.527 F4000
+G1 X164.411 Y33.160 F4000
+G1 X165.885 Y30.000 F4000
+G1 X167.884 Y27.144 F4000
+G1 X170.349 Y24.679 F4000
+G1 X173.205 Y22.679 F4000
+G1 X176.365 Y21.206 F4000
+G1 X179.732 Y20.304 F4000
+G1 X183.205 Y20.000 F4000
+G1 X186.678 Y20.304 F4000
+G1 X190.045 Y21.206 F4000
+G1 X193.205 Y22.679 F4000
+G1 X196.061 Y24.679 F4000
+G1 X198.526 Y27.144 F4000
+G1 X200.526 Y30.000 F4000
+G1 X201.999 Y33.160 F4000
+G1 X202.901 Y36.527 F4000
+G1 X203.205 Y40.000 F4000
+G1 X202.901 Y43.473 F4000
+G1 X201.999 Y46.840 F4000
+G1 X200.526 Y50.000 F4000
+G1 X198.526 Y52.856 F4000
+G1 X196.061 Y55.321 F4000
+G1 X193.205 Y57.321 F4000
+G1 X190.045 Y58.794 F4000
+G1 X186.678 Y59.696 F4000
+G1 X183.205 Y60.000 F4000
+G1 X179.732 Y59.696 F4000
+G1 X176.365 Y58.794 F4000
+G1 X173.205 Y57.321 F4000
+G1 X170.349 Y55.321 F4000
+G1 X167.884 Y52.856 F4000
+G1 X165.885 Y50.000 F4000
+G1 X164.411 Y46.840 F4000
+G1 X163.509 Y43.473 F4000
+G1 X163.205 Y40.000 F4000
+G1 X163.509 Y36.527 F4000
+G1 X164.411 Y33.160 F4000
+G1 X165.885 Y30.000 F4000
+G1 X167.884 Y27.144 F4000
+G1 X170.349 Y24.679 F4000
+G1 X173.205 Y22.679 F4000
+G1 X176.365 Y21.206 F4000
+G1 X179.732 Y20.304 F4000
+G1 X183.205 Y20.000 F4000
+G1 X10.000 Y10.000 F4000
+G1 X60.000 Y10.000 F4000
+G1 X60.000 Y40.000 F4000
+G1 X10.000 Y40.000 F4000
+G1 X10.000 Y10.000 F4000
+G1 X10.000 Y10.000 F4000
+G1 X60.000 Y10.000 F4000
+G1 X60.000 Y40.000 F4000
+G1 X10.000 Y40.000 F4000
+G1 X10.000 Y10.000 F4000
+G1 X10.000 Y10.000 F4000
+G1 X60.000 Y10.000 F4000
+G1 X60.000 Y40.000 F4000
+G1 X10.000 Y40.000 F4000
+G1 X10.000 Y10.000 F4000
+G0 Z-1
@@ -0,0 +1,15 @@
+G21
+G90
+G0 X0 Y0
+G1 X50 Y0 F4000
+G1 X50 Y30
+G1 X0 Y30
+G1 X0 Y0
+G1 X50 Y0 F4000
+G1 X50 Y30
+G1 X0 Y30
+G1 X0 Y0
+G1 X50 Y0 F4000
+G1 X50 Y30
+G1 X0 Y30
+G1 X0 Y0
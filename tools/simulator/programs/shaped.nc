@@ -0,0 +1,9 @@
+G21
+G90
+G0 X0 Y0
+G1 X300 F12000
+G1 X20
+G1 X100
+G1 X0 F3000
+G1 X40 Y40
+G1 X0 Y0
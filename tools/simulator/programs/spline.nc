@@ -0,0 +1,11 @@
+G21
+G90
+G0 X100 Y100
+G1 Z-1 F1000
+G1 F3000
+; Two S-curves, then a quadratic, a cubic that lowers Z and a quadratic back to the start
+G5 X160 Y100 I20 J40 P-20 Q-40
+G5 X220 Y100 I20 J-40 P-20 Q40
+G5.1 X260 Y140 I40 J0
+G5 X200 Y160 Z-2 I0 J30 P10 Q-5
+G5.1 X100 Y100 I-50 J-60
@@ -0,0 +1,26 @@
+O1000 (SUBPROGRAMS FROM SD)
+M118 #start
+G0 X10 Y10
+M98 P100 L2
+M118 #middle
+G0 Y20
+M98 P200
+M98 P70000
+M118 #end
+G0 X0 Y0
+O100
+M118 #o100
+G1 X40 F3000
+G1 X10
+M99
+O200
+M118 #o200
+M98 P100
+G0 Y10
+M99
+O4464
+M118 #o4464
+M99
+O70000
+M118 #o70000
+M99
@@ -0,0 +1,10 @@
+G21
+G90
+G0 X100 Y50
+G0 Z-20
+T1
+M6
+; Answer the tool change prompt once the machine waits at the change position
+!30000 M108
+G0 X50 Y20
+G0 Z-10
@@ -0,0 +1,2 @@
+M211 S0
+M2000 O2 ?/motion/xShaper >{"type":2,"frequency":20,"damping":0.1}